@@ -1,11 +1,29 @@
+#define _GNU_SOURCE
+#include <assert.h>
 #include <ctype.h>
+#include <errno.h>
+#include <setjmp.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdnoreturn.h>
 #include <string.h>
 
 typedef struct Type Type;
+typedef struct Reg Reg;
+typedef struct BB BB;
+typedef struct IR IR;
+
+//
+// arena.c
+//
+
+void *arena_alloc(size_t size);
+void arena_reset(void);
+size_t arena_used(void);
+size_t arena_peak(void);
 
 //
 // tokenize.c
@@ -19,31 +37,77 @@ typedef enum {
   TK_EOF,      // End-of-file markers
 } TokenKind;
 
+// Keywords and punctuators
+typedef enum {
+  KW_RETURN,   // "return"
+  KW_IF,       // "if"
+  KW_ELSE,     // "else"
+  KW_WHILE,    // "while"
+  KW_FOR,      // "for"
+  KW_SIZEOF,   // "sizeof"
+  KW_CHAR,     // "char"
+  KW_SHORT,    // "short"
+  KW_INT,      // "int"
+  KW_LONG,     // "long"
+  PU_EQ,       // ==
+  PU_NE,       // !=
+  PU_LE,       // <=
+  PU_GE,       // >=
+  PU_LT,       // <
+  PU_GT,       // >
+  PU_ASSIGN,   // =
+  PU_PLUS,     // +
+  PU_MINUS,    // -
+  PU_STAR,     // *
+  PU_SLASH,    // /
+  PU_AMP,      // &
+  PU_SEMI,     // ;
+  PU_COMMA,    // ,
+  PU_LPAREN,   // (
+  PU_RPAREN,   // )
+  PU_LBRACE,   // {
+  PU_RBRACE,   // }
+  PU_LBRACKET, // [
+  PU_RBRACKET, // ]
+} Reserved;
+
 // Token type
 typedef struct Token Token;
 struct Token {
   TokenKind kind; // Token kind
   Token *next;    // Next token
+  Reserved id;    // If kind is TK_RESERVED, which one
   long val;       // If kind is TK_NUM, its value
+  char *name;     // If kind is TK_IDENT, its interned name
   char *str;      // Token string
   int len;        // Token length
 };
 
-void error(char *fmt, ...);
-void error_at(char *loc, char *fmt, ...);
-void error_tok(Token *tok, char *fmt, ...);
-Token *peek(char *s);
-Token *consume(char *op);
+// Marks code that the front end's checks make unreachable. Errors in
+// the input must be reported before code generation, which runs on
+// worker threads where error() cannot unwind to its caller.
+#define unreachable() (assert(!"unreachable"), abort())
+
+noreturn void error(char *fmt, ...);
+noreturn void out_of_memory(void);
+noreturn void error_at(char *loc, char *fmt, ...);
+noreturn void error_tok(Token *tok, char *fmt, ...);
+Token *peek(Reserved id);
+Token *consume(Reserved id);
 Token *consume_ident(void);
-void expect(char *op);
+void expect(Reserved id);
 long expect_number(void);
 char *expect_ident(void);
 bool at_eof(void);
 Token *tokenize(void);
 char *duplicate(char *str, int len);
+char *intern(char *str, int len);
 
+extern char *filename;
 extern char *user_input;
 extern Token *token;
+extern FILE *error_stream;
+extern jmp_buf *error_jmp;
 
 //
 // parse.c
@@ -55,6 +119,7 @@ struct Var {
   char *name; // Variable name
   Type *ty;   // Type
   int offset; // Offset from RBP
+  Reg *reg;   // Virtual register holding the variable, if any
 };
 
 typedef struct VarList VarList;
@@ -92,6 +157,12 @@ typedef enum {
 } NodeKind;
 
 // AST node type
+//
+// Nodes only carry the fields their kind uses. Kind-specific fields
+// share storage in a union, and new_node() allocates just enough
+// bytes for the kind (see node_size() in parse.c), so most nodes are
+// 40 or 48 bytes instead of one size fitting all. Only read the
+// fields that belong to a node's kind.
 typedef struct Node Node;
 struct Node {
   NodeKind kind; // Node kind
@@ -99,25 +170,36 @@ struct Node {
   Type *ty;      // Type, e.g. int or pointer to int
   Token *tok;    // Representative token
 
-  Node *lhs;     // Left-hand side
-  Node *rhs;     // Right-hand side
+  union {
+    // Operators, "return" and expression statement
+    struct {
+      Node *lhs; // Left-hand side
+      Node *rhs; // Right-hand side (binary operators only)
+    };
 
-  // "if, "while" or "for" statement
-  Node *cond;
-  Node *then;
-  Node *els;
-  Node *init;
-  Node *inc;
+    // "if, "while" or "for" statement
+    struct {
+      Node *cond;
+      Node *then;
+      union {
+        Node *els;  // "if" only
+        Node *init; // "for" only
+      };
+      Node *inc;    // "for" only
+    };
 
-  // Block
-  Node *body;
+    // Block
+    Node *body;
 
-  // Function call
-  char *funcname;
-  Node *args;
+    // Function call
+    struct {
+      char *funcname;
+      Node *args;
+    };
 
-  Var *var;      // Used if kind == ND_VAR
-  long val;      // Used if kind == ND_NUM
+    Var *var;      // Used if kind == ND_VAR
+    long val;      // Used if kind == ND_NUM
+  };
 };
 
 typedef struct Function Function;
@@ -126,32 +208,377 @@ struct Function {
   char *name;
   VarList *params;
 
+  Type *ty;      // Return type
   Node *node;
   VarList *locals;
   int stack_size;
+
+  // IR, valid while the function is being compiled
+  BB *bbs;       // Basic blocks in layout order, entry first
+  Reg *regs;     // Virtual registers
+  int nregs;
+  int used_regs; // Bitmask of real registers used
+  char *ir_dump; // Output of -dump-ir
+
+  // Generated assembly, or machine code from asm_end() if the
+  // output is an object
+  char *text;
+  size_t text_len;
+
+  // Cache key, if the cache is enabled
+  char cache_key[33];
+  bool cached;
 };
 
 Function *program(void);
 
+extern long node_count;
+
 //
 // typing.c
 //
 
-typedef enum { TY_INT, TY_PTR } TypeKind;
+typedef enum {
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_PTR,
+  TY_ARRAY,
+} TypeKind;
 
 struct Type {
   TypeKind kind;
-  Type *base;
+  int size;       // sizeof() value
+  int align;      // Alignment in bytes
+  Type *base;     // Pointee or element type if kind is TY_PTR or TY_ARRAY
+  int array_len;  // Number of elements if kind is TY_ARRAY
+  Type *pointer;  // Cached pointer to this type
 };
 
+extern Type *char_type;
+extern Type *short_type;
 extern Type *int_type;
+extern Type *long_type;
+extern long type_count;
 
+void init_types(void);
 bool is_integer(Type *ty);
 Type *pointer_to(Type *base);
+Type *array_of(Type *base, int len);
 void add_type(Node *node);
 
+//
+// fold.c
+//
+
+void fold(Function *prog);
+
+//
+// ir.c
+//
+
+typedef enum {
+  IR_IMM,   // dst = imm
+  IR_MOV,   // dst = a
+  IR_ARG,   // dst = imm'th argument
+  IR_BPREL, // dst = address of var
+  IR_ADD,   // dst = a + b
+  IR_SUB,   // dst = a - b
+  IR_MUL,   // dst = a * b
+  IR_DIV,   // dst = a / b
+  IR_SHL,   // dst = a << imm
+  IR_SHR,   // dst = a >> imm, shifting in zeros
+  IR_SAR,   // dst = a >> imm, shifting in the sign bit
+  IR_LEA,   // dst = a + b * imm, where imm is 1, 2, 4 or 8
+  IR_MULHI, // dst = high 64 bits of the 128-bit product a * imm
+  IR_EQ,    // dst = a == b
+  IR_NE,    // dst = a != b
+  IR_LT,    // dst = a < b
+  IR_LE,    // dst = a <= b
+  IR_SEXT,  // dst = a truncated to size bytes and sign-extended
+  IR_LOAD,  // dst = *a, loading size bytes and sign-extending them
+  IR_STORE, // *a = b, storing the low size bytes of b
+  IR_CALL,  // dst = name(args...)
+  IR_JMP,   // goto bb1
+  IR_BR,    // if (a cond b) goto bb1; else goto bb2, where b may be
+            // null for zero
+  IR_RET,   // return a (a may be null)
+} IROp;
+
+// Virtual register
+struct Reg {
+  Reg *next;
+  int vn;    // Virtual register number
+  Var *var;  // Variable held in this register, if any
+  IR *def;   // Instruction defining this temporary
+  int uses;  // Number of reads, counted by passes that need it
+  bool global; // Temporary used outside the block that defines it
+
+  // Set by register allocation
+  int live;          // Index among registers live across blocks, or -1
+  int start;         // Live interval
+  int end;
+  bool crosses_call; // Live across a function call
+  int rn;            // Real register number, or -1 if spilled
+  int offset;        // Stack slot from RBP if spilled
+};
+
+// IR instruction
+struct IR {
+  IR *next;
+  IROp op;
+  int nargs;    // IR_CALL
+  Reg *dst;
+  Reg *a;
+  Reg *b;
+
+  union {
+    long imm;   // IR_IMM, IR_ARG, shifts, IR_LEA, IR_MULHI
+    bool exact; // IR_DIV: the division is known to leave no remainder
+    int size;   // IR_SEXT, IR_LOAD, IR_STORE: 1, 2, 4 or 8
+    Var *var;   // IR_BPREL
+
+    // IR_JMP, IR_BR
+    struct {
+      BB *bb1;
+      BB *bb2;    // IR_BR only
+      IROp cond;  // IR_BR only: IR_EQ, IR_NE, IR_LT or IR_LE
+    };
+
+    // IR_CALL
+    struct {
+      char *name;
+      Reg **args;
+    };
+  };
+};
+
+// Basic block
+struct BB {
+  BB *next;   // Next block in layout order
+  int label;
+  IR *ir;     // Instructions
+  IR *last;   // Terminator
+
+  // Control flow graph
+  BB *succ[2];
+  int nsucc;
+  BB **pred;
+  int npred;
+  bool reachable;
+
+  // Set by register allocation
+  int start;  // Position of the first and last instructions
+  int end;
+  unsigned long *def;  // Registers live across blocks: defined,
+  unsigned long *use;  // used before defined,
+  unsigned long *in;   // live on entry
+  unsigned long *out;  // and live on exit
+};
+
+extern bool dump_ir;
+
+void *ir_alloc(size_t size);
+void ir_free(void);
+Reg *new_reg(void);
+BB *new_bb(void);
+IR *new_ir(IROp op, Reg *dst, Reg *a, Reg *b);
+void gen_ir(Function *fn);
+void print_ir(Function *fn, FILE *out, char *pass);
+
+//
+// reduce.c
+//
+
+void reduce_strength(Function *fn);
+
+//
+// loop.c
+//
+
+void hoist_invariants(Function *fn);
+
+//
+// x86-64 instructions
+//
+
+// Registers, numbered as in machine code
+enum {
+  RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+  R8, R9, R10, R11, R12, R13, R14, R15,
+};
+
+typedef enum {
+  OPD_NONE,
+  OPD_REG,   // Register
+  OPD_IMM,   // Immediate
+  OPD_MEM,   // Memory reference
+  OPD_SYM,   // Label or symbol
+  OPD_LABEL, // Block label of a function being compiled
+} OperandKind;
+
+typedef struct {
+  unsigned char kind; // OperandKind
+  signed char size;   // Size in bytes; 0 for a memory reference without PTR
+  signed char reg;    // OPD_REG: register number
+  signed char base;   // OPD_MEM: base register, or -1
+  signed char index;  // OPD_MEM: index register, or -1
+  signed char scale;  // OPD_MEM: index scale
+  int symlen;         // OPD_SYM, OPD_LABEL: length of sym
+  union {
+    long imm;         // OPD_IMM: value; OPD_LABEL: label number, 0 for return
+    long disp;        // OPD_MEM: displacement
+  };
+  char *sym;          // OPD_SYM: name; OPD_LABEL: function name
+} Operand;
+
+typedef enum {
+  I_LABEL,  // ops[0]:
+  I_GLOBAL, // .global ops[0]
+  I_MOV,
+  I_MOVSX,
+  I_MOVSXD,
+  I_MOVZB,
+  I_LEA,
+  I_ADD,
+  I_SUB,
+  I_IMUL,
+  I_IDIV,
+  I_CQO,
+  I_SHL,
+  I_SHR,
+  I_SAR,
+  I_CMP,
+  I_SETE,
+  I_SETNE,
+  I_SETL,
+  I_SETLE,
+  I_JMP,
+  I_JE,
+  I_JNE,
+  I_JL,
+  I_JGE,
+  I_JLE,
+  I_JG,
+  I_CALL,
+  I_PUSH,
+  I_POP,
+  I_RET,
+} Mnemonic;
+
+typedef struct {
+  Mnemonic mn;
+  int nops;
+  Operand ops[2];
+} Insn;
+
+//
+// peephole.c
+//
+
+extern bool no_peephole;
+
+int peephole(Insn *insns, int n);
+long peephole_eliminated(void);
+void peephole_reset(void);
+
+//
+// asm.c
+//
+
+typedef struct {
+  char *name;
+  long offset;  // Offset in the code if defined
+  bool defined;
+  bool global;
+} Symbol;
+
+// A 32-bit PC-relative reference to a symbol
+typedef struct {
+  long offset;  // Offset of the 4-byte field in the code
+  int sym;      // Index into Object::syms
+  long addend;
+} Reloc;
+
+// Assembled machine code
+typedef struct {
+  unsigned char *text;
+  size_t text_len;
+  Symbol *syms;
+  int nsyms;
+  Reloc *relocs;
+  int nrelocs;
+} Object;
+
+void asm_begin(void);
+void asm_insn(Insn *in);
+char *asm_end(size_t *len);
+Object *asm_link(Function *prog);
+void object_free(Object *obj);
+
+//
+// regalloc.c
+//
+
+void alloc_regs(Function *fn);
+
 //
 // codegen.c
 //
 
-void codegen(Function *prog);
+extern int regs[];
+extern int num_regs;
+extern int num_caller_saved;
+
+void codegen(Function *prog, int nthreads);
+Object *codegen_object(Function *prog, int nthreads);
+long codegen_instructions(void);
+
+//
+// main.c
+//
+
+Object *compile(char *path, char *src, int nthreads);
+
+//
+// server.c
+//
+
+void run_server(char *socket_path, int nthreads);
+
+//
+// cache.c
+//
+
+void cache_init(char *dir, char *salt);
+bool cache_enabled(void);
+void cache_key(Token *begin, Token *end, char *buf);
+char *cache_lookup(char *key, size_t *len);
+void cache_store(char *key, char *text, size_t len);
+
+//
+// elf.c
+//
+
+char *elf_image(Object *obj, size_t *size);
+
+//
+// jit.c
+//
+
+int jit_run(Object *obj);
+
+//
+// emit.c
+//
+
+char *reg_name(int reg, int size);
+void emit_insn(Insn *in);
+void emit_raw(char *s, size_t len);
+void emit_begin(void);
+char *emit_end(size_t *len);
+void emit_open(int fd);
+void emit_flush(void);
+char *emit_take(size_t *len);
+size_t emit_allocated(void);
@@ -0,0 +1,81 @@
+#include "9cc.h"
+
+// Every front-end object (tokens, AST nodes, types and variables)
+// lives until the end of a compilation, so instead of calling
+// calloc for each of them we carve them out of large chunks with a
+// bump pointer. Nothing is freed individually; arena_reset() throws
+// away everything at once.
+
+#define CHUNK_SIZE (1 << 20)
+
+typedef struct Chunk Chunk;
+struct Chunk {
+  Chunk *next;
+  char *cur;  // Next free byte
+  char *end;  // End of this chunk
+  char buf[];
+};
+
+static Chunk *chunks;
+static size_t used;
+static size_t peak;
+
+static Chunk *new_chunk(size_t size) {
+  size_t cap = size > CHUNK_SIZE ? size : CHUNK_SIZE;
+  Chunk *c = malloc(sizeof(Chunk) + cap);
+  if (!c)
+    error("out of memory");
+  c->cur = c->buf;
+  c->end = c->buf + cap;
+  return c;
+}
+
+// Returns zero-initialized memory that is valid until the next
+// call of arena_reset().
+void *arena_alloc(size_t size) {
+  size = (size + 7) & ~(size_t)7;
+
+  if (!chunks || chunks->end - chunks->cur < size) {
+    Chunk *c = new_chunk(size);
+    c->next = chunks;
+    chunks = c;
+  }
+
+  void *p = chunks->cur;
+  chunks->cur += size;
+  used += size;
+  if (used > peak)
+    peak = used;
+  return memset(p, 0, size);
+}
+
+// Frees everything allocated by arena_alloc(). The most recent
+// chunk is kept so that the next compilation does not have to
+// go back to malloc right away.
+void arena_reset(void) {
+  Chunk *keep = NULL;
+  for (Chunk *c = chunks; c;) {
+    Chunk *next = c->next;
+    if (!keep && c->end - c->buf == CHUNK_SIZE) {
+      keep = c;
+      keep->cur = keep->buf;
+      keep->next = NULL;
+    } else {
+      free(c);
+    }
+    c = next;
+  }
+  chunks = keep;
+  used = 0;
+}
+
+// Returns the number of bytes currently allocated.
+size_t arena_used(void) {
+  return used;
+}
+
+// Returns the largest number of bytes that were ever allocated
+// at the same time, i.e. the peak over all compilations.
+size_t arena_peak(void) {
+  return peak;
+}
@@ -0,0 +1,662 @@
+#include "9cc.h"
+
+// An assembler for the instructions the code generator builds. Each
+// function's instructions are encoded into x86-64 machine code on
+// the thread that generated them, and asm_link() puts the functions
+// together into code, symbols and relocations. Object files (elf.c)
+// and in-process runs (jit.c) are made from that without printing
+// and re-reading assembly.
+//
+// All jumps and calls use 32-bit displacements. Jumps to a
+// function's own labels are resolved when the function is encoded.
+// Calls are resolved by asm_link() if the program defines the
+// function, and become relocations against undefined symbols
+// otherwise.
+//
+// An encoded function is a self-contained byte string, so that it
+// can be kept in the cache like the assembly of a function:
+//
+//   int code_len, nrefs
+//   code_len bytes of machine code
+//   nrefs references to symbols, each an int offset in the code, a
+//   RefKind byte, an int name length and the name
+
+typedef enum {
+  REF_DEF,    // The symbol is defined at the offset
+  REF_GLOBAL, // The symbol is global
+  REF_CALL,   // The rel32 field at the offset calls the symbol
+} RefKind;
+
+#define HEADER_SIZE 8
+
+typedef struct {
+  char *data;
+  size_t len;
+  size_t cap;
+} Bytes;
+
+// A rel32 field that refers to a label of the function
+typedef struct {
+  int offset;
+  int label;
+} Jump;
+
+// The function being encoded on this thread
+typedef struct {
+  Bytes code;  // Header and code
+  Bytes refs;
+  int nrefs;
+  int *labels; // Code offset of each label, or -1
+  int labels_cap;
+  Jump *jumps;
+  int njumps;
+  int jumps_cap;
+} Encoder;
+
+static _Thread_local Encoder enc;
+
+static void reserve(Bytes *b, size_t n) {
+  if (b->len + n <= b->cap)
+    return;
+  while (b->len + n > b->cap)
+    b->cap = b->cap ? b->cap * 2 : 4096;
+  b->data = realloc(b->data, b->cap);
+  if (!b->data)
+    out_of_memory();
+}
+
+static void put_bytes(Bytes *b, void *p, size_t n) {
+  reserve(b, n);
+  memcpy(b->data + b->len, p, n);
+  b->len += n;
+}
+
+static void put(int c) {
+  if (enc.code.len == enc.code.cap)
+    reserve(&enc.code, 1);
+  enc.code.data[enc.code.len++] = c;
+}
+
+static void put32(long v) {
+  int i = v;
+  put_bytes(&enc.code, &i, 4);
+}
+
+static void put64(long v) {
+  put_bytes(&enc.code, &v, 8);
+}
+
+static int get32(char *p) {
+  int v;
+  memcpy(&v, p, 4);
+  return v;
+}
+
+// Returns the offset in the function's code where the next byte goes.
+static int here(void) {
+  return enc.code.len - HEADER_SIZE;
+}
+
+static void add_ref(RefKind kind, Operand *op) {
+  int offset = here();
+  char k = kind;
+  put_bytes(&enc.refs, &offset, 4);
+  put_bytes(&enc.refs, &k, 1);
+  put_bytes(&enc.refs, &op->symlen, 4);
+  put_bytes(&enc.refs, op->sym, op->symlen);
+  enc.nrefs++;
+}
+
+static void define_label(int label) {
+  if (label >= enc.labels_cap) {
+    int cap = enc.labels_cap ? enc.labels_cap : 64;
+    while (label >= cap)
+      cap *= 2;
+    enc.labels = realloc(enc.labels, sizeof(int) * cap);
+    if (!enc.labels)
+      out_of_memory();
+    for (int i = enc.labels_cap; i < cap; i++)
+      enc.labels[i] = -1;
+    enc.labels_cap = cap;
+  }
+  enc.labels[label] = here();
+}
+
+static void jump_to(Operand *target) {
+  if (enc.njumps == enc.jumps_cap) {
+    enc.jumps_cap = enc.jumps_cap ? enc.jumps_cap * 2 : 64;
+    enc.jumps = realloc(enc.jumps, sizeof(Jump) * enc.jumps_cap);
+    if (!enc.jumps)
+      out_of_memory();
+  }
+  enc.jumps[enc.njumps++] = (Jump){here(), target->imm};
+  put32(0);
+}
+
+//
+// Encoder
+//
+
+// True if `op` is one of spl, bpl, sil and dil, which can only be
+// encoded with a REX prefix.
+static bool needs_rex(Operand *op) {
+  return op->kind == OPD_REG && op->size == 1 && 4 <= op->reg && op->reg <= 7;
+}
+
+// Emits the prefixes, `opcode` and a ModRM byte (plus SIB and
+// displacement) for an instruction whose ModRM.reg field is `reg` and
+// whose ModRM.rm operand is `rm`. `size` is the operand size; 2
+// adds an operand-size prefix and 8 sets REX.W.
+static void encode_modrm(int size, int opcode, int reg, bool reg_rex, Operand *rm) {
+  if (size == 2)
+    put(0x66);
+
+  int rex = 0;
+  if (size == 8)
+    rex |= 8;
+  if (reg & 8)
+    rex |= 4;
+  if (rm->kind == OPD_MEM) {
+    if (rm->index >= 8)
+      rex |= 2;
+    if (rm->base >= 8)
+      rex |= 1;
+  } else if (rm->reg & 8) {
+    rex |= 1;
+  }
+  if (rex || reg_rex || needs_rex(rm))
+    put(0x40 | rex);
+
+  if (opcode > 0xff)
+    put(opcode >> 8);
+  put(opcode & 0xff);
+
+  reg &= 7;
+
+  if (rm->kind == OPD_REG) {
+    put(0xc0 | (reg << 3) | (rm->reg & 7));
+    return;
+  }
+
+  int base = rm->base;
+  int index = rm->index;
+  long disp = rm->disp;
+  int scale = rm->scale == 8 ? 3 : rm->scale == 4 ? 2 : rm->scale == 2 ? 1 : 0;
+  assert(base >= 0 && index != RSP);
+
+  int mod;
+  if (disp == 0 && (base & 7) != 5)
+    mod = 0;
+  else if (-128 <= disp && disp <= 127)
+    mod = 1;
+  else
+    mod = 2;
+
+  if (index < 0 && (base & 7) != 4) {
+    put((mod << 6) | (reg << 3) | (base & 7));
+  } else {
+    put((mod << 6) | (reg << 3) | 4);
+    put((scale << 6) | ((index < 0 ? 4 : index) & 7) << 3 | (base & 7));
+  }
+
+  if (mod == 1)
+    put(disp & 0xff);
+  else if (mod == 2)
+    put32(disp);
+}
+
+static bool is_imm8(long v) {
+  return -128 <= v && v <= 127;
+}
+
+static bool is_imm32(long v) {
+  return -2147483648L <= v && v <= 2147483647L;
+}
+
+// Returns the operand size of a two-operand instruction.
+static int operand_size(Operand *a, Operand *b) {
+  if (a->kind == OPD_REG)
+    return a->size;
+  if (b->kind == OPD_REG)
+    return b->size;
+  assert(a->size);
+  return a->size;
+}
+
+static void put_imm(int size, long v) {
+  if (size == 1) {
+    put(v & 0xff);
+  } else if (size == 2) {
+    put(v & 0xff);
+    put((v >> 8) & 0xff);
+  } else {
+    assert(size == 4 || is_imm32(v));
+    put32(v);
+  }
+}
+
+// add, sub and cmp, whose ModRM.reg extensions are 0, 5 and 7
+static void encode_alu(int ext, Operand *dst, Operand *src) {
+  int size = operand_size(dst, src);
+
+  if (src->kind == OPD_IMM) {
+    if (size == 1) {
+      encode_modrm(1, 0x80, ext, false, dst);
+      put(src->imm & 0xff);
+    } else if (is_imm8(src->imm)) {
+      encode_modrm(size, 0x83, ext, false, dst);
+      put(src->imm & 0xff);
+    } else {
+      encode_modrm(size, 0x81, ext, false, dst);
+      put_imm(size, src->imm);
+    }
+    return;
+  }
+
+  int op = ext << 3;
+  if (src->kind == OPD_REG)
+    encode_modrm(size, op | (size == 1 ? 0 : 1), src->reg, needs_rex(src), dst);
+  else
+    encode_modrm(size, op | (size == 1 ? 2 : 3), dst->reg, needs_rex(dst), src);
+}
+
+static void encode_mov(Operand *dst, Operand *src) {
+  int size = operand_size(dst, src);
+
+  if (src->kind == OPD_IMM) {
+    if (dst->kind == OPD_REG) {
+      if (size == 8 && !is_imm32(src->imm)) {
+        // movabs
+        put(0x48 | (dst->reg >> 3));
+        put(0xb8 | (dst->reg & 7));
+        put64(src->imm);
+        return;
+      }
+      if (size == 8) {
+        encode_modrm(8, 0xc7, 0, false, dst);
+        put32(src->imm);
+        return;
+      }
+      if (size == 2)
+        put(0x66);
+      if ((dst->reg & 8) || needs_rex(dst))
+        put(0x40 | (dst->reg >> 3));
+      put((size == 1 ? 0xb0 : 0xb8) | (dst->reg & 7));
+      put_imm(size, src->imm);
+      return;
+    }
+    encode_modrm(size, size == 1 ? 0xc6 : 0xc7, 0, false, dst);
+    put_imm(size, src->imm);
+    return;
+  }
+
+  if (src->kind == OPD_REG)
+    encode_modrm(size, size == 1 ? 0x88 : 0x89, src->reg, needs_rex(src), dst);
+  else
+    encode_modrm(size, size == 1 ? 0x8a : 0x8b, dst->reg, needs_rex(dst), src);
+}
+
+// movzx and movsx. `from` is the source size if a memory operand
+// does not give one.
+static void encode_movx(bool sign, Operand *dst, Operand *src, int from) {
+  if (src->size)
+    from = src->size;
+
+  if (from == 1)
+    encode_modrm(dst->size, sign ? 0x0fbe : 0x0fb6, dst->reg, false, src);
+  else if (from == 2)
+    encode_modrm(dst->size, sign ? 0x0fbf : 0x0fb7, dst->reg, false, src);
+  else if (from == 4 && sign)
+    encode_modrm(dst->size, 0x63, dst->reg, false, src);
+  else
+    unreachable();
+}
+
+// Condition codes of conditional jumps and setcc
+static unsigned char cond[] = {
+  [I_SETE] = 0x4, [I_SETNE] = 0x5, [I_SETL] = 0xc, [I_SETLE] = 0xe,
+  [I_JE] = 0x4,   [I_JNE] = 0x5,   [I_JL] = 0xc,   [I_JGE] = 0xd,
+  [I_JLE] = 0xe,  [I_JG] = 0xf,
+};
+
+// Starts encoding a function on the calling thread.
+void asm_begin(void) {
+  reserve(&enc.code, HEADER_SIZE);
+  enc.code.len = HEADER_SIZE;
+}
+
+// Appends an instruction to the function being encoded.
+void asm_insn(Insn *in) {
+  Operand *a = &in->ops[0];
+  Operand *b = &in->ops[1];
+
+  switch (in->mn) {
+  case I_LABEL:
+    if (a->kind == OPD_LABEL)
+      define_label(a->imm);
+    else
+      add_ref(REF_DEF, a);
+    return;
+  case I_GLOBAL:
+    add_ref(REF_GLOBAL, a);
+    return;
+  case I_MOV:
+    encode_mov(a, b);
+    return;
+  case I_MOVSX:
+    encode_movx(true, a, b, 0);
+    return;
+  case I_MOVSXD:
+    encode_movx(true, a, b, 4);
+    return;
+  case I_MOVZB:
+    encode_movx(false, a, b, 1);
+    return;
+  case I_LEA:
+    encode_modrm(a->size, 0x8d, a->reg, false, b);
+    return;
+  case I_ADD:
+    encode_alu(0, a, b);
+    return;
+  case I_SUB:
+    encode_alu(5, a, b);
+    return;
+  case I_CMP:
+    encode_alu(7, a, b);
+    return;
+  case I_IMUL:
+    if (in->nops == 1) {
+      encode_modrm(a->size, 0xf7, 5, false, a);
+    } else if (b->kind != OPD_IMM) {
+      encode_modrm(a->size, 0x0faf, a->reg, false, b);
+    } else if (is_imm8(b->imm)) {
+      // "imul r, imm" is "imul r, r, imm".
+      encode_modrm(a->size, 0x6b, a->reg, false, a);
+      put(b->imm & 0xff);
+    } else {
+      encode_modrm(a->size, 0x69, a->reg, false, a);
+      put_imm(a->size == 8 ? 4 : a->size, b->imm);
+    }
+    return;
+  case I_IDIV:
+    encode_modrm(a->size, 0xf7, 7, false, a);
+    return;
+  case I_CQO:
+    put(0x48);
+    put(0x99);
+    return;
+  case I_SHL:
+  case I_SHR:
+  case I_SAR: {
+    int ext = in->mn == I_SHL ? 4 : in->mn == I_SHR ? 5 : 7;
+    if (b->imm == 1) {
+      encode_modrm(a->size, 0xd1, ext, false, a);
+    } else {
+      encode_modrm(a->size, 0xc1, ext, false, a);
+      put(b->imm & 0xff);
+    }
+    return;
+  }
+  case I_SETE:
+  case I_SETNE:
+  case I_SETL:
+  case I_SETLE:
+    encode_modrm(1, 0x0f90 | cond[in->mn], 0, false, a);
+    return;
+  case I_JMP:
+    put(0xe9);
+    jump_to(a);
+    return;
+  case I_JE:
+  case I_JNE:
+  case I_JL:
+  case I_JGE:
+  case I_JLE:
+  case I_JG:
+    put(0x0f);
+    put(0x80 | cond[in->mn]);
+    jump_to(a);
+    return;
+  case I_CALL:
+    put(0xe8);
+    add_ref(REF_CALL, a);
+    put32(0);
+    return;
+  case I_PUSH:
+    if (a->reg & 8)
+      put(0x41);
+    put(0x50 | (a->reg & 7));
+    return;
+  case I_POP:
+    if (a->reg & 8)
+      put(0x41);
+    put(0x58 | (a->reg & 7));
+    return;
+  case I_RET:
+    put(0xc3);
+    return;
+  }
+  unreachable();
+}
+
+// Finishes the function begun by asm_begin() and returns it encoded
+// as described at the top of this file. The caller owns the
+// returned memory.
+char *asm_end(size_t *len) {
+  for (int i = 0; i < enc.njumps; i++) {
+    Jump *j = &enc.jumps[i];
+    assert(j->label < enc.labels_cap && enc.labels[j->label] >= 0);
+    int rel = enc.labels[j->label] - (j->offset + 4);
+    memcpy(enc.code.data + HEADER_SIZE + j->offset, &rel, 4);
+  }
+
+  int code_len = here();
+  memcpy(enc.code.data, &code_len, 4);
+  memcpy(enc.code.data + 4, &enc.nrefs, 4);
+  put_bytes(&enc.code, enc.refs.data, enc.refs.len);
+
+  char *data = enc.code.data;
+  *len = enc.code.len;
+  free(enc.refs.data);
+  free(enc.labels);
+  free(enc.jumps);
+  enc = (Encoder){};
+  return data;
+}
+
+//
+// Linker
+//
+
+typedef struct {
+  char *name;
+  int len;
+  int offset;   // Offset in .text, or -1 if not defined
+  bool global;
+  bool used;    // Referenced by a relocation
+  int index;    // Index in the output symbol table
+} Label;
+
+typedef struct {
+  int offset;   // Offset of the rel32 field
+  Label *label;
+} Fixup;
+
+static Fixup *fixups;
+static int nfixups;
+static int fixups_cap;
+
+// Labels are kept in an open-addressing hash table. Fixups point to
+// labels, so the table holds pointers that stay valid when it grows.
+static Label **labels;
+static int labels_cap;
+static int labels_used;
+
+static unsigned hash_label(char *name, int len) {
+  unsigned h = 2166136261u;
+  for (int i = 0; i < len; i++)
+    h = (h ^ (unsigned char)name[i]) * 16777619u;
+  return h;
+}
+
+static void grow_labels(void) {
+  Label **old = labels;
+  int oldcap = labels_cap;
+
+  labels_cap = oldcap ? oldcap * 2 : 1024;
+  labels = calloc(labels_cap, sizeof(Label *));
+  if (!labels)
+    error("out of memory");
+
+  for (int i = 0; i < oldcap; i++) {
+    if (!old[i])
+      continue;
+    int j = hash_label(old[i]->name, old[i]->len) & (labels_cap - 1);
+    while (labels[j])
+      j = (j + 1) & (labels_cap - 1);
+    labels[j] = old[i];
+  }
+  free(old);
+}
+
+static Label *get_label(char *name, int len) {
+  if (labels_used * 2 >= labels_cap)
+    grow_labels();
+
+  int i = hash_label(name, len) & (labels_cap - 1);
+  for (; labels[i]; i = (i + 1) & (labels_cap - 1))
+    if (labels[i]->len == len && !memcmp(labels[i]->name, name, len))
+      return labels[i];
+
+  Label *l = calloc(1, sizeof(Label));
+  if (!l)
+    error("out of memory");
+  l->name = name;
+  l->len = len;
+  l->offset = -1;
+  labels[i] = l;
+  labels_used++;
+  return l;
+}
+
+static void add_fixup(int offset, Label *label) {
+  if (nfixups == fixups_cap) {
+    fixups_cap = fixups_cap ? fixups_cap * 2 : 1024;
+    fixups = realloc(fixups, sizeof(Fixup) * fixups_cap);
+    if (!fixups)
+      error("out of memory");
+  }
+  fixups[nfixups++] = (Fixup){offset, label};
+}
+
+// Links the encoded functions of `prog`, in order, into one Object.
+Object *asm_link(Function *prog) {
+  fixups = NULL;
+  nfixups = fixups_cap = 0;
+  labels = NULL;
+  labels_cap = labels_used = 0;
+
+  size_t len = 0;
+  for (Function *fn = prog; fn; fn = fn->next)
+    len += get32(fn->text);
+  unsigned char *code = malloc(len + 1);
+  if (!code)
+    error("out of memory");
+
+  size_t base = 0;
+  for (Function *fn = prog; fn; fn = fn->next) {
+    char *p = fn->text;
+    int code_len = get32(p);
+    int nrefs = get32(p + 4);
+    memcpy(code + base, p + HEADER_SIZE, code_len);
+    p += HEADER_SIZE + code_len;
+
+    for (int i = 0; i < nrefs; i++) {
+      int offset = base + get32(p);
+      RefKind kind = p[4];
+      int namelen = get32(p + 5);
+      Label *l = get_label(p + 9, namelen);
+      p += 9 + namelen;
+
+      switch (kind) {
+      case REF_DEF:
+        if (l->offset >= 0)
+          error("assembler: symbol redefined: %.*s", l->len, l->name);
+        l->offset = offset;
+        break;
+      case REF_GLOBAL:
+        l->global = true;
+        break;
+      case REF_CALL:
+        add_fixup(offset, l);
+        break;
+      }
+    }
+    base += code_len;
+  }
+
+  Object *obj = calloc(1, sizeof(Object));
+
+  // Resolve calls to functions defined here, and turn the others
+  // into relocations.
+  for (int i = 0; i < nfixups; i++) {
+    Fixup *f = &fixups[i];
+    Label *l = f->label;
+    if (l->offset >= 0) {
+      int rel = l->offset - (f->offset + 4);
+      memcpy(code + f->offset, &rel, 4);
+      continue;
+    }
+    l->used = true;
+    obj->nrelocs++;
+  }
+
+  obj->relocs = calloc(obj->nrelocs + 1, sizeof(Reloc));
+  int nrelocs = 0;
+
+  // Symbols: defined functions and every undefined symbol that is
+  // called.
+  for (int i = 0; i < labels_cap; i++) {
+    Label *l = labels[i];
+    if (l && (l->offset >= 0 || l->used))
+      obj->nsyms++;
+  }
+
+  obj->syms = calloc(obj->nsyms + 1, sizeof(Symbol));
+  int nsyms = 0;
+  for (int i = 0; i < labels_cap; i++) {
+    Label *l = labels[i];
+    if (l && (l->offset >= 0 || l->used)) {
+      Symbol *sym = &obj->syms[nsyms];
+      sym->name = duplicate(l->name, l->len);
+      sym->offset = l->offset;
+      sym->defined = l->offset >= 0;
+      sym->global = l->global || !sym->defined;
+      l->index = nsyms++;
+    }
+  }
+
+  for (int i = 0; i < nfixups; i++) {
+    Fixup *f = &fixups[i];
+    if (f->label->offset < 0)
+      obj->relocs[nrelocs++] = (Reloc){f->offset, f->label->index, -4};
+  }
+
+  obj->text = code;
+  obj->text_len = len;
+
+  free(fixups);
+  for (int i = 0; i < labels_cap; i++)
+    free(labels[i]);
+  free(labels);
+  return obj;
+}
+
+// Frees an Object returned by asm_link(). Symbol names are in the
+// arena and go with it.
+void object_free(Object *obj) {
+  free(obj->text);
+  free(obj->syms);
+  free(obj->relocs);
+  free(obj);
+}
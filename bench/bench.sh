@@ -0,0 +1,57 @@
+#!/bin/bash
+#
+# Measures compile throughput on generated programs. Each workload
+# is compiled several times and the fastest run is reported.
+#
+# usage: bench/bench.sh [ extra 9cc flags ]
+
+cd "$(dirname "$0")/.." || exit 1
+
+runs=${RUNS:-3}
+flags="$*"
+
+# workload size
+workloads="expr:5000 funcs:20000 locals:20000 loops:5000"
+
+field() {
+  sed -n "s/.*\"$1\": \([0-9.]*\).*/\1/p" <<< "$2"
+}
+
+phase_ms() {
+  sed -n "s/.*\"name\": \"$1\", \"ms\": \([0-9.]*\).*/\1/p" <<< "$2"
+}
+
+printf '%-8s %10s %10s %10s %10s %12s %12s %12s\n' \
+  workload tokens nodes insts 'total ms' 'tokens/s' 'nodes/s' 'insts/s'
+
+for w in $workloads; do
+  name=${w%%:*}
+  size=${w##*:}
+  src=bench/tmp-$name.c
+  bench/gen "$name" "$size" > "$src" || exit 1
+
+  best=
+  for i in $(seq "$runs"); do
+    report=$(./9cc $flags -ftime-report=json -o /dev/null "$src" 2>&1) || {
+      echo "$report"
+      exit 1
+    }
+    total=$(field total_ms "$report")
+    if [ -z "$best" ] || awk "BEGIN { exit !($total < $best) }"; then
+      best=$total
+      best_report=$report
+    fi
+  done
+
+  r=$best_report
+  awk -v name="$name" -v tokens="$(field tokens "$r")" \
+      -v nodes="$(field nodes "$r")" -v insts="$(field instructions "$r")" \
+      -v total="$(field total_ms "$r")" -v tok_ms="$(phase_ms tokenize "$r")" \
+      -v parse_ms="$(phase_ms parse "$r")" -v gen_ms="$(phase_ms codegen "$r")" '
+    function rate(n, ms) { return ms > 0 ? n / (ms / 1000) : 0 }
+    BEGIN {
+      printf "%-8s %10d %10d %10d %10.1f %12.0f %12.0f %12.0f\n", name,
+        tokens, nodes, insts, total, rate(tokens, tok_ms),
+        rate(nodes, parse_ms), rate(insts, gen_ms)
+    }'
+done
@@ -0,0 +1,125 @@
+// Generates large programs for benchmarking the compiler.
+//
+// usage: gen <workload> <size>
+//
+// Workloads:
+//   expr    a function with <size> statements of deeply nested expressions
+//   funcs   <size> small functions that call each other
+//   locals  a function with <size> local variables
+//   loops   a function with <size> nests of for/while loops
+//
+// The output only uses the grammar 9cc supports and is deterministic
+// for a given workload and size.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static unsigned long seed = 1;
+
+static int rnd(int n) {
+  seed = seed * 6364136223846793005ul + 1442695040888963407ul;
+  return (seed >> 33) % n;
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: gen {expr|funcs|locals|loops} <size>\n");
+  exit(1);
+}
+
+static char *vars[] = {"a", "b", "c", "d"};
+
+static void gen_expr(int depth) {
+  if (depth == 0 || rnd(8) == 0) {
+    if (rnd(2))
+      printf("%s", vars[rnd(4)]);
+    else
+      printf("%d", rnd(100) + 1);
+    return;
+  }
+
+  // Divisors are nonzero constants so that the program can run.
+  static char *ops[] = {"+", "-", "*", "/", "<", "<=", "==", "!="};
+  char *op = ops[rnd(8)];
+  printf("(");
+  gen_expr(depth - 1);
+  printf("%s", op);
+  if (*op == '/')
+    printf("%d", rnd(9) + 1);
+  else
+    gen_expr(depth - 1);
+  printf(")");
+}
+
+static void expr(int n) {
+  printf("int main() {\n  int a=1; int b=2; int c=3; int d=4;\n");
+  for (int i = 0; i < n; i++) {
+    printf("  %s=", vars[rnd(4)]);
+    gen_expr(8);
+    printf(";\n");
+  }
+  printf("  return a;\n}\n");
+}
+
+static void funcs(int n) {
+  for (int i = 0; i < n; i++) {
+    printf("int f%d(int x, int y) {\n", i);
+    printf("  int i=0; int s=0;\n");
+    printf("  for (i=0; i<y; i=i+1) s=s+x*%d;\n", rnd(10) + 1);
+    printf("  if (s>%d) s=s-x; else s=s+y;\n", rnd(1000));
+    if (i > 0)
+      printf("  return s+f%d(x-1, y);\n", i - 1);
+    else
+      printf("  return s;\n");
+    printf("}\n");
+  }
+  printf("int main() { return f%d(3, 4); }\n", n - 1);
+}
+
+static void locals(int n) {
+  printf("int main() {\n  int v0=1;\n");
+  for (int i = 1; i < n; i++)
+    printf("  int v%d=v%d+%d;\n", i, rnd(i), rnd(10));
+  printf("  int *p=&v0;\n");
+  for (int i = 0; i < n; i++)
+    printf("  v%d=v%d*v%d-*p;\n", rnd(n), rnd(n), rnd(n));
+  printf("  return v%d;\n}\n", n - 1);
+}
+
+static void loops(int n) {
+  printf("int main() {\n  int i=0; int j=0; int k=0; int s=0;\n");
+  for (int i = 0; i < n; i++) {
+    printf("  for (i=0; i<%d; i=i+1) {\n", rnd(10) + 1);
+    printf("    j=0;\n");
+    printf("    while (j<i) {\n");
+    printf("      for (k=0; k<j; k=k+1) {\n");
+    printf("        if (k<%d) s=s+k*j; else s=s-i;\n", rnd(5));
+    printf("        while (s>%d) s=s/2;\n", rnd(1000) + 100);
+    printf("      }\n");
+    printf("      j=j+1;\n");
+    printf("    }\n");
+    printf("  }\n");
+  }
+  printf("  return s;\n}\n");
+}
+
+int main(int argc, char **argv) {
+  if (argc != 3)
+    usage();
+
+  int n = atoi(argv[2]);
+  if (n <= 0)
+    usage();
+
+  if (!strcmp(argv[1], "expr"))
+    expr(n);
+  else if (!strcmp(argv[1], "funcs"))
+    funcs(n);
+  else if (!strcmp(argv[1], "locals"))
+    locals(n);
+  else if (!strcmp(argv[1], "loops"))
+    loops(n);
+  else
+    usage();
+  return 0;
+}
@@ -0,0 +1,40004 @@
+int main() {
+  int v0=1;
+  int v1=v0+4;
+  int v2=v0+6;
+  int v3=v2+4;
+  int v4=v2+0;
+  int v5=v1+9;
+  int v6=v4+3;
+  int v7=v5+2;
+  int v8=v4+4;
+  int v9=v8+0;
+  int v10=v5+2;
+  int v11=v1+7;
+  int v12=v6+6;
+  int v13=v7+9;
+  int v14=v8+4;
+  int v15=v13+1;
+  int v16=v2+7;
+  int v17=v9+8;
+  int v18=v0+4;
+  int v19=v12+6;
+  int v20=v9+6;
+  int v21=v16+5;
+  int v22=v4+0;
+  int v23=v15+1;
+  int v24=v21+8;
+  int v25=v19+3;
+  int v26=v8+2;
+  int v27=v16+6;
+  int v28=v20+1;
+  int v29=v14+8;
+  int v30=v10+7;
+  int v31=v18+3;
+  int v32=v21+8;
+  int v33=v5+1;
+  int v34=v8+3;
+  int v35=v19+2;
+  int v36=v9+2;
+  int v37=v7+9;
+  int v38=v20+5;
+  int v39=v36+9;
+  int v40=v5+5;
+  int v41=v7+1;
+  int v42=v20+9;
+  int v43=v15+2;
+  int v44=v3+0;
+  int v45=v22+8;
+  int v46=v32+2;
+  int v47=v43+7;
+  int v48=v2+9;
+  int v49=v4+1;
+  int v50=v40+9;
+  int v51=v0+9;
+  int v52=v2+0;
+  int v53=v2+8;
+  int v54=v3+6;
+  int v55=v47+8;
+  int v56=v16+4;
+  int v57=v23+3;
+  int v58=v21+5;
+  int v59=v22+5;
+  int v60=v20+9;
+  int v61=v43+2;
+  int v62=v5+1;
+  int v63=v27+5;
+  int v64=v24+4;
+  int v65=v44+6;
+  int v66=v1+8;
+  int v67=v29+4;
+  int v68=v54+6;
+  int v69=v33+0;
+  int v70=v69+3;
+  int v71=v28+4;
+  int v72=v5+2;
+  int v73=v64+1;
+  int v74=v18+2;
+  int v75=v7+1;
+  int v76=v61+7;
+  int v77=v35+7;
+  int v78=v65+8;
+  int v79=v45+5;
+  int v80=v7+6;
+  int v81=v80+6;
+  int v82=v80+8;
+  int v83=v64+0;
+  int v84=v27+6;
+  int v85=v17+3;
+  int v86=v1+6;
+  int v87=v8+0;
+  int v88=v54+9;
+  int v89=v71+0;
+  int v90=v33+9;
+  int v91=v1+5;
+  int v92=v69+9;
+  int v93=v76+2;
+  int v94=v53+8;
+  int v95=v31+5;
+  int v96=v89+2;
+  int v97=v11+6;
+  int v98=v75+8;
+  int v99=v71+6;
+  int v100=v73+8;
+  int v101=v89+5;
+  int v102=v34+6;
+  int v103=v64+8;
+  int v104=v97+0;
+  int v105=v16+1;
+  int v106=v19+0;
+  int v107=v94+1;
+  int v108=v81+0;
+  int v109=v22+2;
+  int v110=v68+6;
+  int v111=v75+2;
+  int v112=v76+2;
+  int v113=v23+9;
+  int v114=v88+7;
+  int v115=v23+7;
+  int v116=v78+6;
+  int v117=v71+5;
+  int v118=v74+4;
+  int v119=v42+7;
+  int v120=v29+9;
+  int v121=v82+0;
+  int v122=v25+7;
+  int v123=v79+9;
+  int v124=v35+9;
+  int v125=v82+1;
+  int v126=v50+5;
+  int v127=v74+7;
+  int v128=v73+6;
+  int v129=v78+2;
+  int v130=v124+7;
+  int v131=v61+4;
+  int v132=v124+5;
+  int v133=v64+8;
+  int v134=v50+5;
+  int v135=v117+7;
+  int v136=v134+0;
+  int v137=v82+3;
+  int v138=v108+0;
+  int v139=v55+4;
+  int v140=v132+0;
+  int v141=v113+0;
+  int v142=v129+8;
+  int v143=v105+9;
+  int v144=v79+1;
+  int v145=v40+2;
+  int v146=v65+0;
+  int v147=v26+1;
+  int v148=v66+3;
+  int v149=v36+5;
+  int v150=v23+2;
+  int v151=v120+6;
+  int v152=v72+5;
+  int v153=v32+5;
+  int v154=v120+0;
+  int v155=v117+9;
+  int v156=v9+1;
+  int v157=v21+9;
+  int v158=v29+3;
+  int v159=v146+5;
+  int v160=v119+8;
+  int v161=v24+3;
+  int v162=v147+3;
+  int v163=v131+4;
+  int v164=v104+2;
+  int v165=v161+5;
+  int v166=v146+3;
+  int v167=v149+2;
+  int v168=v32+4;
+  int v169=v159+7;
+  int v170=v148+2;
+  int v171=v29+0;
+  int v172=v67+3;
+  int v173=v121+3;
+  int v174=v156+7;
+  int v175=v70+9;
+  int v176=v135+7;
+  int v177=v13+5;
+  int v178=v79+7;
+  int v179=v98+3;
+  int v180=v10+3;
+  int v181=v165+5;
+  int v182=v172+1;
+  int v183=v159+3;
+  int v184=v145+8;
+  int v185=v27+3;
+  int v186=v175+6;
+  int v187=v52+2;
+  int v188=v164+1;
+  int v189=v143+5;
+  int v190=v43+9;
+  int v191=v116+6;
+  int v192=v15+9;
+  int v193=v148+7;
+  int v194=v16+7;
+  int v195=v55+1;
+  int v196=v100+8;
+  int v197=v93+9;
+  int v198=v116+2;
+  int v199=v93+3;
+  int v200=v112+5;
+  int v201=v131+2;
+  int v202=v142+4;
+  int v203=v199+2;
+  int v204=v159+3;
+  int v205=v29+9;
+  int v206=v189+7;
+  int v207=v164+7;
+  int v208=v124+7;
+  int v209=v39+3;
+  int v210=v22+4;
+  int v211=v130+4;
+  int v212=v191+1;
+  int v213=v211+2;
+  int v214=v155+5;
+  int v215=v60+2;
+  int v216=v129+1;
+  int v217=v9+9;
+  int v218=v111+4;
+  int v219=v200+9;
+  int v220=v148+6;
+  int v221=v161+7;
+  int v222=v197+3;
+  int v223=v133+4;
+  int v224=v156+1;
+  int v225=v123+2;
+  int v226=v14+3;
+  int v227=v94+4;
+  int v228=v142+8;
+  int v229=v112+2;
+  int v230=v162+6;
+  int v231=v67+8;
+  int v232=v157+4;
+  int v233=v43+9;
+  int v234=v151+3;
+  int v235=v55+0;
+  int v236=v97+5;
+  int v237=v1+2;
+  int v238=v164+8;
+  int v239=v15+5;
+  int v240=v22+2;
+  int v241=v7+6;
+  int v242=v234+6;
+  int v243=v221+4;
+  int v244=v149+5;
+  int v245=v200+5;
+  int v246=v10+1;
+  int v247=v70+1;
+  int v248=v133+5;
+  int v249=v103+0;
+  int v250=v129+5;
+  int v251=v18+8;
+  int v252=v37+8;
+  int v253=v125+1;
+  int v254=v11+6;
+  int v255=v124+6;
+  int v256=v198+1;
+  int v257=v256+7;
+  int v258=v25+2;
+  int v259=v83+4;
+  int v260=v13+2;
+  int v261=v25+9;
+  int v262=v65+7;
+  int v263=v44+4;
+  int v264=v132+5;
+  int v265=v97+3;
+  int v266=v147+8;
+  int v267=v185+0;
+  int v268=v199+6;
+  int v269=v47+1;
+  int v270=v199+3;
+  int v271=v214+0;
+  int v272=v38+7;
+  int v273=v205+0;
+  int v274=v231+5;
+  int v275=v189+5;
+  int v276=v215+2;
+  int v277=v188+6;
+  int v278=v231+8;
+  int v279=v172+3;
+  int v280=v123+7;
+  int v281=v69+0;
+  int v282=v17+0;
+  int v283=v145+6;
+  int v284=v212+5;
+  int v285=v149+8;
+  int v286=v97+3;
+  int v287=v178+2;
+  int v288=v180+1;
+  int v289=v58+6;
+  int v290=v179+5;
+  int v291=v182+6;
+  int v292=v154+4;
+  int v293=v243+3;
+  int v294=v76+1;
+  int v295=v147+2;
+  int v296=v176+3;
+  int v297=v115+2;
+  int v298=v82+3;
+  int v299=v173+4;
+  int v300=v66+3;
+  int v301=v185+4;
+  int v302=v288+5;
+  int v303=v220+2;
+  int v304=v63+7;
+  int v305=v80+8;
+  int v306=v61+5;
+  int v307=v15+7;
+  int v308=v251+7;
+  int v309=v8+4;
+  int v310=v129+7;
+  int v311=v189+9;
+  int v312=v140+7;
+  int v313=v77+8;
+  int v314=v264+1;
+  int v315=v170+2;
+  int v316=v189+5;
+  int v317=v124+6;
+  int v318=v307+8;
+  int v319=v76+6;
+  int v320=v44+4;
+  int v321=v142+3;
+  int v322=v99+9;
+  int v323=v104+2;
+  int v324=v120+7;
+  int v325=v48+0;
+  int v326=v220+5;
+  int v327=v200+8;
+  int v328=v75+7;
+  int v329=v105+0;
+  int v330=v39+5;
+  int v331=v48+9;
+  int v332=v188+2;
+  int v333=v328+6;
+  int v334=v261+9;
+  int v335=v49+5;
+  int v336=v98+7;
+  int v337=v19+7;
+  int v338=v211+9;
+  int v339=v314+7;
+  int v340=v180+1;
+  int v341=v297+7;
+  int v342=v320+3;
+  int v343=v92+5;
+  int v344=v185+3;
+  int v345=v156+1;
+  int v346=v171+8;
+  int v347=v7+0;
+  int v348=v204+6;
+  int v349=v215+1;
+  int v350=v288+7;
+  int v351=v134+2;
+  int v352=v17+9;
+  int v353=v39+8;
+  int v354=v251+3;
+  int v355=v46+5;
+  int v356=v220+7;
+  int v357=v256+2;
+  int v358=v160+6;
+  int v359=v38+0;
+  int v360=v126+3;
+  int v361=v43+1;
+  int v362=v72+4;
+  int v363=v222+0;
+  int v364=v177+2;
+  int v365=v280+0;
+  int v366=v209+7;
+  int v367=v169+4;
+  int v368=v172+8;
+  int v369=v263+9;
+  int v370=v172+5;
+  int v371=v248+2;
+  int v372=v223+2;
+  int v373=v214+9;
+  int v374=v146+9;
+  int v375=v84+3;
+  int v376=v90+1;
+  int v377=v3+7;
+  int v378=v63+3;
+  int v379=v19+4;
+  int v380=v295+9;
+  int v381=v346+8;
+  int v382=v308+5;
+  int v383=v15+8;
+  int v384=v227+2;
+  int v385=v320+1;
+  int v386=v174+7;
+  int v387=v135+9;
+  int v388=v12+1;
+  int v389=v85+5;
+  int v390=v361+9;
+  int v391=v285+7;
+  int v392=v157+5;
+  int v393=v209+0;
+  int v394=v62+4;
+  int v395=v100+7;
+  int v396=v386+5;
+  int v397=v158+1;
+  int v398=v224+5;
+  int v399=v204+6;
+  int v400=v346+1;
+  int v401=v154+9;
+  int v402=v14+1;
+  int v403=v140+1;
+  int v404=v373+9;
+  int v405=v23+7;
+  int v406=v299+8;
+  int v407=v371+4;
+  int v408=v306+3;
+  int v409=v188+3;
+  int v410=v353+0;
+  int v411=v321+8;
+  int v412=v383+3;
+  int v413=v230+8;
+  int v414=v410+7;
+  int v415=v239+8;
+  int v416=v3+5;
+  int v417=v165+2;
+  int v418=v104+6;
+  int v419=v126+8;
+  int v420=v340+7;
+  int v421=v198+1;
+  int v422=v143+9;
+  int v423=v99+1;
+  int v424=v69+5;
+  int v425=v275+7;
+  int v426=v353+6;
+  int v427=v315+4;
+  int v428=v306+7;
+  int v429=v409+9;
+  int v430=v206+1;
+  int v431=v72+5;
+  int v432=v119+6;
+  int v433=v50+6;
+  int v434=v344+6;
+  int v435=v81+7;
+  int v436=v324+8;
+  int v437=v141+8;
+  int v438=v78+2;
+  int v439=v354+8;
+  int v440=v229+7;
+  int v441=v41+2;
+  int v442=v383+1;
+  int v443=v349+0;
+  int v444=v392+9;
+  int v445=v436+3;
+  int v446=v231+2;
+  int v447=v276+9;
+  int v448=v302+8;
+  int v449=v297+2;
+  int v450=v258+8;
+  int v451=v68+5;
+  int v452=v254+0;
+  int v453=v434+3;
+  int v454=v396+3;
+  int v455=v341+8;
+  int v456=v399+5;
+  int v457=v310+7;
+  int v458=v418+4;
+  int v459=v140+2;
+  int v460=v253+7;
+  int v461=v349+9;
+  int v462=v259+5;
+  int v463=v184+8;
+  int v464=v378+9;
+  int v465=v332+6;
+  int v466=v390+5;
+  int v467=v389+9;
+  int v468=v138+2;
+  int v469=v359+6;
+  int v470=v234+1;
+  int v471=v99+7;
+  int v472=v157+0;
+  int v473=v127+0;
+  int v474=v377+3;
+  int v475=v422+7;
+  int v476=v291+1;
+  int v477=v434+4;
+  int v478=v407+2;
+  int v479=v193+5;
+  int v480=v223+7;
+  int v481=v98+2;
+  int v482=v135+5;
+  int v483=v67+3;
+  int v484=v20+8;
+  int v485=v344+0;
+  int v486=v215+6;
+  int v487=v189+4;
+  int v488=v149+8;
+  int v489=v428+0;
+  int v490=v260+4;
+  int v491=v116+9;
+  int v492=v143+9;
+  int v493=v233+5;
+  int v494=v424+2;
+  int v495=v220+9;
+  int v496=v379+8;
+  int v497=v36+6;
+  int v498=v157+2;
+  int v499=v495+6;
+  int v500=v315+7;
+  int v501=v488+6;
+  int v502=v109+0;
+  int v503=v377+1;
+  int v504=v151+7;
+  int v505=v443+5;
+  int v506=v439+7;
+  int v507=v281+9;
+  int v508=v387+9;
+  int v509=v164+1;
+  int v510=v0+0;
+  int v511=v11+2;
+  int v512=v49+6;
+  int v513=v87+1;
+  int v514=v478+5;
+  int v515=v138+2;
+  int v516=v153+3;
+  int v517=v91+7;
+  int v518=v232+3;
+  int v519=v161+9;
+  int v520=v355+2;
+  int v521=v471+1;
+  int v522=v98+4;
+  int v523=v183+4;
+  int v524=v521+8;
+  int v525=v101+0;
+  int v526=v50+2;
+  int v527=v51+2;
+  int v528=v495+2;
+  int v529=v510+2;
+  int v530=v381+2;
+  int v531=v380+0;
+  int v532=v7+8;
+  int v533=v39+4;
+  int v534=v223+4;
+  int v535=v454+8;
+  int v536=v163+8;
+  int v537=v378+5;
+  int v538=v35+0;
+  int v539=v423+2;
+  int v540=v47+6;
+  int v541=v497+4;
+  int v542=v158+1;
+  int v543=v192+8;
+  int v544=v187+3;
+  int v545=v185+2;
+  int v546=v542+3;
+  int v547=v74+0;
+  int v548=v197+0;
+  int v549=v395+2;
+  int v550=v275+8;
+  int v551=v90+1;
+  int v552=v224+1;
+  int v553=v350+1;
+  int v554=v480+7;
+  int v555=v74+7;
+  int v556=v224+9;
+  int v557=v448+3;
+  int v558=v252+7;
+  int v559=v431+5;
+  int v560=v200+3;
+  int v561=v257+3;
+  int v562=v114+5;
+  int v563=v29+8;
+  int v564=v226+6;
+  int v565=v404+2;
+  int v566=v142+0;
+  int v567=v371+7;
+  int v568=v434+3;
+  int v569=v523+6;
+  int v570=v407+0;
+  int v571=v561+5;
+  int v572=v271+7;
+  int v573=v15+2;
+  int v574=v568+1;
+  int v575=v92+8;
+  int v576=v179+5;
+  int v577=v146+9;
+  int v578=v111+4;
+  int v579=v515+4;
+  int v580=v78+3;
+  int v581=v329+6;
+  int v582=v117+9;
+  int v583=v19+3;
+  int v584=v61+5;
+  int v585=v217+3;
+  int v586=v241+1;
+  int v587=v549+5;
+  int v588=v344+1;
+  int v589=v163+8;
+  int v590=v453+4;
+  int v591=v399+4;
+  int v592=v424+6;
+  int v593=v509+7;
+  int v594=v522+8;
+  int v595=v540+4;
+  int v596=v172+4;
+  int v597=v563+8;
+  int v598=v14+6;
+  int v599=v507+9;
+  int v600=v184+2;
+  int v601=v3+7;
+  int v602=v459+9;
+  int v603=v9+4;
+  int v604=v259+7;
+  int v605=v22+5;
+  int v606=v585+5;
+  int v607=v589+4;
+  int v608=v238+3;
+  int v609=v98+7;
+  int v610=v474+0;
+  int v611=v162+5;
+  int v612=v508+0;
+  int v613=v334+7;
+  int v614=v104+6;
+  int v615=v237+8;
+  int v616=v490+0;
+  int v617=v82+9;
+  int v618=v112+7;
+  int v619=v244+6;
+  int v620=v289+6;
+  int v621=v63+2;
+  int v622=v180+5;
+  int v623=v15+8;
+  int v624=v477+2;
+  int v625=v538+0;
+  int v626=v20+0;
+  int v627=v302+9;
+  int v628=v569+8;
+  int v629=v516+3;
+  int v630=v92+0;
+  int v631=v118+4;
+  int v632=v307+6;
+  int v633=v510+0;
+  int v634=v126+4;
+  int v635=v408+1;
+  int v636=v341+6;
+  int v637=v234+8;
+  int v638=v142+6;
+  int v639=v610+6;
+  int v640=v221+9;
+  int v641=v638+6;
+  int v642=v627+3;
+  int v643=v384+0;
+  int v644=v609+1;
+  int v645=v376+1;
+  int v646=v306+1;
+  int v647=v112+0;
+  int v648=v560+4;
+  int v649=v471+5;
+  int v650=v181+4;
+  int v651=v38+5;
+  int v652=v156+4;
+  int v653=v446+5;
+  int v654=v234+8;
+  int v655=v236+6;
+  int v656=v54+9;
+  int v657=v650+2;
+  int v658=v584+6;
+  int v659=v318+3;
+  int v660=v54+7;
+  int v661=v399+6;
+  int v662=v31+9;
+  int v663=v578+8;
+  int v664=v377+2;
+  int v665=v355+8;
+  int v666=v390+4;
+  int v667=v47+9;
+  int v668=v311+1;
+  int v669=v538+0;
+  int v670=v103+8;
+  int v671=v189+6;
+  int v672=v434+3;
+  int v673=v169+5;
+  int v674=v646+8;
+  int v675=v493+1;
+  int v676=v217+9;
+  int v677=v498+9;
+  int v678=v410+7;
+  int v679=v7+5;
+  int v680=v330+4;
+  int v681=v426+1;
+  int v682=v297+7;
+  int v683=v556+5;
+  int v684=v595+7;
+  int v685=v441+6;
+  int v686=v652+9;
+  int v687=v368+5;
+  int v688=v590+8;
+  int v689=v20+9;
+  int v690=v51+5;
+  int v691=v285+9;
+  int v692=v220+7;
+  int v693=v185+5;
+  int v694=v214+4;
+  int v695=v87+1;
+  int v696=v439+6;
+  int v697=v418+4;
+  int v698=v608+1;
+  int v699=v304+3;
+  int v700=v392+8;
+  int v701=v329+9;
+  int v702=v188+3;
+  int v703=v60+8;
+  int v704=v314+4;
+  int v705=v455+0;
+  int v706=v696+8;
+  int v707=v569+8;
+  int v708=v152+7;
+  int v709=v359+3;
+  int v710=v299+9;
+  int v711=v508+0;
+  int v712=v60+5;
+  int v713=v683+9;
+  int v714=v339+6;
+  int v715=v181+4;
+  int v716=v70+2;
+  int v717=v184+7;
+  int v718=v612+8;
+  int v719=v228+0;
+  int v720=v14+3;
+  int v721=v495+9;
+  int v722=v468+4;
+  int v723=v562+5;
+  int v724=v317+3;
+  int v725=v304+1;
+  int v726=v578+6;
+  int v727=v392+2;
+  int v728=v247+5;
+  int v729=v207+8;
+  int v730=v712+5;
+  int v731=v99+0;
+  int v732=v528+0;
+  int v733=v545+8;
+  int v734=v717+3;
+  int v735=v614+5;
+  int v736=v3+4;
+  int v737=v499+4;
+  int v738=v346+1;
+  int v739=v566+5;
+  int v740=v562+7;
+  int v741=v335+2;
+  int v742=v410+1;
+  int v743=v339+8;
+  int v744=v679+5;
+  int v745=v498+2;
+  int v746=v222+9;
+  int v747=v420+0;
+  int v748=v620+0;
+  int v749=v92+0;
+  int v750=v469+7;
+  int v751=v266+2;
+  int v752=v126+2;
+  int v753=v325+7;
+  int v754=v355+4;
+  int v755=v686+4;
+  int v756=v465+9;
+  int v757=v222+2;
+  int v758=v302+8;
+  int v759=v124+1;
+  int v760=v217+3;
+  int v761=v438+5;
+  int v762=v83+3;
+  int v763=v221+5;
+  int v764=v720+2;
+  int v765=v172+5;
+  int v766=v299+0;
+  int v767=v155+2;
+  int v768=v311+9;
+  int v769=v364+2;
+  int v770=v146+9;
+  int v771=v238+7;
+  int v772=v546+1;
+  int v773=v725+5;
+  int v774=v710+5;
+  int v775=v620+0;
+  int v776=v170+3;
+  int v777=v234+2;
+  int v778=v194+9;
+  int v779=v144+8;
+  int v780=v196+1;
+  int v781=v55+2;
+  int v782=v436+5;
+  int v783=v238+0;
+  int v784=v243+3;
+  int v785=v17+8;
+  int v786=v154+1;
+  int v787=v41+1;
+  int v788=v311+4;
+  int v789=v664+5;
+  int v790=v33+3;
+  int v791=v605+9;
+  int v792=v763+3;
+  int v793=v661+3;
+  int v794=v315+4;
+  int v795=v587+0;
+  int v796=v348+6;
+  int v797=v231+6;
+  int v798=v770+2;
+  int v799=v430+3;
+  int v800=v639+8;
+  int v801=v595+8;
+  int v802=v732+2;
+  int v803=v499+9;
+  int v804=v152+8;
+  int v805=v164+1;
+  int v806=v791+5;
+  int v807=v381+9;
+  int v808=v427+8;
+  int v809=v2+2;
+  int v810=v547+9;
+  int v811=v21+2;
+  int v812=v57+9;
+  int v813=v698+2;
+  int v814=v290+5;
+  int v815=v477+2;
+  int v816=v3+0;
+  int v817=v537+6;
+  int v818=v148+1;
+  int v819=v539+0;
+  int v820=v145+9;
+  int v821=v327+0;
+  int v822=v46+9;
+  int v823=v723+6;
+  int v824=v393+1;
+  int v825=v577+9;
+  int v826=v2+3;
+  int v827=v55+4;
+  int v828=v77+8;
+  int v829=v565+8;
+  int v830=v715+4;
+  int v831=v72+1;
+  int v832=v738+2;
+  int v833=v57+2;
+  int v834=v64+6;
+  int v835=v570+6;
+  int v836=v112+8;
+  int v837=v805+0;
+  int v838=v825+0;
+  int v839=v102+1;
+  int v840=v654+9;
+  int v841=v100+3;
+  int v842=v109+0;
+  int v843=v702+5;
+  int v844=v391+0;
+  int v845=v653+8;
+  int v846=v682+5;
+  int v847=v530+6;
+  int v848=v270+4;
+  int v849=v108+9;
+  int v850=v569+3;
+  int v851=v844+2;
+  int v852=v515+3;
+  int v853=v774+1;
+  int v854=v552+9;
+  int v855=v347+7;
+  int v856=v184+1;
+  int v857=v826+5;
+  int v858=v573+2;
+  int v859=v94+6;
+  int v860=v530+9;
+  int v861=v520+0;
+  int v862=v843+3;
+  int v863=v485+0;
+  int v864=v421+5;
+  int v865=v310+6;
+  int v866=v464+9;
+  int v867=v817+3;
+  int v868=v275+5;
+  int v869=v861+8;
+  int v870=v154+7;
+  int v871=v5+6;
+  int v872=v803+6;
+  int v873=v634+8;
+  int v874=v623+8;
+  int v875=v655+7;
+  int v876=v730+2;
+  int v877=v132+6;
+  int v878=v266+2;
+  int v879=v639+6;
+  int v880=v502+0;
+  int v881=v471+9;
+  int v882=v132+8;
+  int v883=v417+7;
+  int v884=v823+4;
+  int v885=v843+4;
+  int v886=v711+7;
+  int v887=v505+4;
+  int v888=v830+8;
+  int v889=v184+3;
+  int v890=v235+2;
+  int v891=v832+9;
+  int v892=v210+2;
+  int v893=v661+6;
+  int v894=v434+1;
+  int v895=v837+8;
+  int v896=v301+6;
+  int v897=v720+6;
+  int v898=v49+1;
+  int v899=v418+5;
+  int v900=v608+7;
+  int v901=v55+4;
+  int v902=v329+2;
+  int v903=v617+2;
+  int v904=v580+1;
+  int v905=v106+3;
+  int v906=v223+0;
+  int v907=v675+1;
+  int v908=v98+9;
+  int v909=v204+3;
+  int v910=v507+7;
+  int v911=v223+6;
+  int v912=v329+0;
+  int v913=v565+7;
+  int v914=v607+1;
+  int v915=v265+3;
+  int v916=v26+1;
+  int v917=v624+6;
+  int v918=v285+0;
+  int v919=v175+8;
+  int v920=v764+2;
+  int v921=v146+2;
+  int v922=v771+6;
+  int v923=v653+7;
+  int v924=v753+3;
+  int v925=v185+0;
+  int v926=v826+6;
+  int v927=v709+3;
+  int v928=v217+5;
+  int v929=v58+2;
+  int v930=v367+5;
+  int v931=v586+1;
+  int v932=v517+3;
+  int v933=v720+9;
+  int v934=v589+0;
+  int v935=v493+1;
+  int v936=v877+7;
+  int v937=v220+2;
+  int v938=v331+1;
+  int v939=v903+3;
+  int v940=v910+3;
+  int v941=v485+2;
+  int v942=v585+9;
+  int v943=v888+4;
+  int v944=v498+8;
+  int v945=v342+1;
+  int v946=v330+6;
+  int v947=v905+8;
+  int v948=v451+6;
+  int v949=v279+8;
+  int v950=v131+3;
+  int v951=v290+9;
+  int v952=v221+4;
+  int v953=v345+5;
+  int v954=v340+4;
+  int v955=v625+5;
+  int v956=v803+2;
+  int v957=v316+1;
+  int v958=v311+5;
+  int v959=v210+6;
+  int v960=v105+4;
+  int v961=v56+5;
+  int v962=v871+8;
+  int v963=v853+2;
+  int v964=v265+4;
+  int v965=v3+5;
+  int v966=v198+2;
+  int v967=v355+5;
+  int v968=v124+4;
+  int v969=v886+3;
+  int v970=v728+1;
+  int v971=v743+2;
+  int v972=v727+8;
+  int v973=v383+0;
+  int v974=v374+8;
+  int v975=v196+9;
+  int v976=v109+0;
+  int v977=v479+4;
+  int v978=v41+9;
+  int v979=v564+3;
+  int v980=v561+7;
+  int v981=v854+3;
+  int v982=v480+4;
+  int v983=v668+3;
+  int v984=v278+1;
+  int v985=v462+6;
+  int v986=v351+3;
+  int v987=v465+3;
+  int v988=v50+8;
+  int v989=v377+5;
+  int v990=v174+8;
+  int v991=v411+5;
+  int v992=v732+8;
+  int v993=v940+3;
+  int v994=v387+5;
+  int v995=v676+4;
+  int v996=v466+8;
+  int v997=v802+4;
+  int v998=v930+0;
+  int v999=v558+7;
+  int v1000=v441+8;
+  int v1001=v166+9;
+  int v1002=v805+5;
+  int v1003=v949+6;
+  int v1004=v465+3;
+  int v1005=v516+9;
+  int v1006=v754+2;
+  int v1007=v304+7;
+  int v1008=v66+4;
+  int v1009=v585+4;
+  int v1010=v355+3;
+  int v1011=v163+1;
+  int v1012=v983+4;
+  int v1013=v1006+9;
+  int v1014=v16+9;
+  int v1015=v515+6;
+  int v1016=v112+4;
+  int v1017=v615+1;
+  int v1018=v713+6;
+  int v1019=v693+8;
+  int v1020=v340+7;
+  int v1021=v808+0;
+  int v1022=v677+6;
+  int v1023=v552+4;
+  int v1024=v205+7;
+  int v1025=v952+3;
+  int v1026=v686+9;
+  int v1027=v627+8;
+  int v1028=v100+0;
+  int v1029=v942+5;
+  int v1030=v734+8;
+  int v1031=v210+6;
+  int v1032=v158+7;
+  int v1033=v324+4;
+  int v1034=v392+9;
+  int v1035=v288+2;
+  int v1036=v400+3;
+  int v1037=v33+3;
+  int v1038=v198+3;
+  int v1039=v893+3;
+  int v1040=v553+7;
+  int v1041=v1032+0;
+  int v1042=v140+7;
+  int v1043=v204+5;
+  int v1044=v27+6;
+  int v1045=v816+0;
+  int v1046=v738+1;
+  int v1047=v636+0;
+  int v1048=v1+7;
+  int v1049=v828+0;
+  int v1050=v241+4;
+  int v1051=v453+9;
+  int v1052=v998+0;
+  int v1053=v205+0;
+  int v1054=v984+4;
+  int v1055=v77+7;
+  int v1056=v278+8;
+  int v1057=v971+0;
+  int v1058=v304+6;
+  int v1059=v979+5;
+  int v1060=v72+4;
+  int v1061=v481+3;
+  int v1062=v969+6;
+  int v1063=v707+3;
+  int v1064=v657+7;
+  int v1065=v83+6;
+  int v1066=v193+0;
+  int v1067=v298+0;
+  int v1068=v397+6;
+  int v1069=v35+7;
+  int v1070=v378+6;
+  int v1071=v548+3;
+  int v1072=v934+5;
+  int v1073=v689+7;
+  int v1074=v226+7;
+  int v1075=v348+9;
+  int v1076=v359+9;
+  int v1077=v296+7;
+  int v1078=v920+2;
+  int v1079=v395+9;
+  int v1080=v344+8;
+  int v1081=v279+1;
+  int v1082=v636+3;
+  int v1083=v259+0;
+  int v1084=v376+9;
+  int v1085=v1046+7;
+  int v1086=v14+7;
+  int v1087=v921+8;
+  int v1088=v943+6;
+  int v1089=v345+8;
+  int v1090=v307+0;
+  int v1091=v974+8;
+  int v1092=v491+9;
+  int v1093=v402+2;
+  int v1094=v47+8;
+  int v1095=v188+9;
+  int v1096=v158+4;
+  int v1097=v247+2;
+  int v1098=v566+0;
+  int v1099=v520+6;
+  int v1100=v1064+5;
+  int v1101=v53+2;
+  int v1102=v66+9;
+  int v1103=v252+9;
+  int v1104=v332+4;
+  int v1105=v884+7;
+  int v1106=v862+1;
+  int v1107=v453+6;
+  int v1108=v1053+4;
+  int v1109=v931+8;
+  int v1110=v380+7;
+  int v1111=v248+7;
+  int v1112=v288+1;
+  int v1113=v1096+4;
+  int v1114=v690+7;
+  int v1115=v216+2;
+  int v1116=v542+5;
+  int v1117=v507+7;
+  int v1118=v851+4;
+  int v1119=v589+9;
+  int v1120=v527+4;
+  int v1121=v828+6;
+  int v1122=v1066+2;
+  int v1123=v1111+0;
+  int v1124=v811+4;
+  int v1125=v280+9;
+  int v1126=v877+6;
+  int v1127=v459+3;
+  int v1128=v928+4;
+  int v1129=v1051+1;
+  int v1130=v726+8;
+  int v1131=v524+4;
+  int v1132=v546+4;
+  int v1133=v1064+1;
+  int v1134=v103+7;
+  int v1135=v946+2;
+  int v1136=v493+2;
+  int v1137=v529+9;
+  int v1138=v562+9;
+  int v1139=v516+5;
+  int v1140=v568+2;
+  int v1141=v444+1;
+  int v1142=v1009+2;
+  int v1143=v893+8;
+  int v1144=v1122+2;
+  int v1145=v943+0;
+  int v1146=v774+7;
+  int v1147=v1118+6;
+  int v1148=v160+3;
+  int v1149=v719+3;
+  int v1150=v1122+0;
+  int v1151=v132+8;
+  int v1152=v200+6;
+  int v1153=v1001+4;
+  int v1154=v13+7;
+  int v1155=v935+7;
+  int v1156=v1060+6;
+  int v1157=v587+1;
+  int v1158=v521+2;
+  int v1159=v760+1;
+  int v1160=v945+1;
+  int v1161=v1090+5;
+  int v1162=v547+6;
+  int v1163=v1063+2;
+  int v1164=v1033+9;
+  int v1165=v160+4;
+  int v1166=v902+2;
+  int v1167=v53+1;
+  int v1168=v775+8;
+  int v1169=v705+9;
+  int v1170=v334+8;
+  int v1171=v992+8;
+  int v1172=v917+0;
+  int v1173=v637+2;
+  int v1174=v1062+6;
+  int v1175=v935+0;
+  int v1176=v688+4;
+  int v1177=v480+8;
+  int v1178=v56+5;
+  int v1179=v1+9;
+  int v1180=v429+5;
+  int v1181=v509+0;
+  int v1182=v851+5;
+  int v1183=v1062+4;
+  int v1184=v911+4;
+  int v1185=v878+7;
+  int v1186=v465+5;
+  int v1187=v1076+0;
+  int v1188=v765+0;
+  int v1189=v828+8;
+  int v1190=v931+9;
+  int v1191=v512+3;
+  int v1192=v142+9;
+  int v1193=v313+6;
+  int v1194=v1187+0;
+  int v1195=v402+1;
+  int v1196=v67+3;
+  int v1197=v995+7;
+  int v1198=v760+9;
+  int v1199=v887+9;
+  int v1200=v234+0;
+  int v1201=v485+3;
+  int v1202=v785+7;
+  int v1203=v536+8;
+  int v1204=v79+4;
+  int v1205=v616+1;
+  int v1206=v190+8;
+  int v1207=v842+0;
+  int v1208=v934+0;
+  int v1209=v1149+6;
+  int v1210=v422+9;
+  int v1211=v566+7;
+  int v1212=v411+8;
+  int v1213=v167+3;
+  int v1214=v952+7;
+  int v1215=v575+9;
+  int v1216=v1011+3;
+  int v1217=v631+5;
+  int v1218=v961+3;
+  int v1219=v198+1;
+  int v1220=v206+6;
+  int v1221=v1192+4;
+  int v1222=v1034+0;
+  int v1223=v1078+1;
+  int v1224=v877+3;
+  int v1225=v386+1;
+  int v1226=v619+5;
+  int v1227=v804+1;
+  int v1228=v301+1;
+  int v1229=v1187+5;
+  int v1230=v820+1;
+  int v1231=v473+0;
+  int v1232=v1215+2;
+  int v1233=v295+6;
+  int v1234=v558+8;
+  int v1235=v24+3;
+  int v1236=v225+9;
+  int v1237=v800+9;
+  int v1238=v1052+7;
+  int v1239=v304+4;
+  int v1240=v257+8;
+  int v1241=v172+0;
+  int v1242=v389+7;
+  int v1243=v1058+2;
+  int v1244=v1243+5;
+  int v1245=v692+1;
+  int v1246=v176+4;
+  int v1247=v1133+6;
+  int v1248=v131+5;
+  int v1249=v171+1;
+  int v1250=v520+1;
+  int v1251=v1076+3;
+  int v1252=v278+7;
+  int v1253=v1200+5;
+  int v1254=v736+8;
+  int v1255=v966+9;
+  int v1256=v1162+3;
+  int v1257=v105+3;
+  int v1258=v204+9;
+  int v1259=v56+5;
+  int v1260=v472+6;
+  int v1261=v1033+9;
+  int v1262=v569+9;
+  int v1263=v615+0;
+  int v1264=v256+4;
+  int v1265=v842+7;
+  int v1266=v681+6;
+  int v1267=v991+7;
+  int v1268=v10+3;
+  int v1269=v621+2;
+  int v1270=v711+0;
+  int v1271=v768+2;
+  int v1272=v27+8;
+  int v1273=v619+6;
+  int v1274=v423+4;
+  int v1275=v858+8;
+  int v1276=v420+9;
+  int v1277=v680+1;
+  int v1278=v404+5;
+  int v1279=v1034+2;
+  int v1280=v748+7;
+  int v1281=v272+9;
+  int v1282=v1281+1;
+  int v1283=v273+4;
+  int v1284=v134+1;
+  int v1285=v152+7;
+  int v1286=v1229+5;
+  int v1287=v330+6;
+  int v1288=v781+3;
+  int v1289=v1023+0;
+  int v1290=v588+6;
+  int v1291=v675+3;
+  int v1292=v849+2;
+  int v1293=v413+5;
+  int v1294=v1217+1;
+  int v1295=v1236+6;
+  int v1296=v1271+9;
+  int v1297=v608+9;
+  int v1298=v282+1;
+  int v1299=v827+6;
+  int v1300=v1148+7;
+  int v1301=v868+0;
+  int v1302=v286+2;
+  int v1303=v577+7;
+  int v1304=v884+2;
+  int v1305=v89+5;
+  int v1306=v119+0;
+  int v1307=v177+1;
+  int v1308=v965+4;
+  int v1309=v188+7;
+  int v1310=v1302+9;
+  int v1311=v354+6;
+  int v1312=v1240+3;
+  int v1313=v426+2;
+  int v1314=v864+6;
+  int v1315=v909+4;
+  int v1316=v576+5;
+  int v1317=v347+0;
+  int v1318=v544+2;
+  int v1319=v396+1;
+  int v1320=v926+1;
+  int v1321=v911+4;
+  int v1322=v1102+6;
+  int v1323=v211+5;
+  int v1324=v1283+6;
+  int v1325=v84+2;
+  int v1326=v1189+5;
+  int v1327=v1028+9;
+  int v1328=v376+5;
+  int v1329=v365+6;
+  int v1330=v1305+6;
+  int v1331=v20+6;
+  int v1332=v94+0;
+  int v1333=v788+5;
+  int v1334=v307+2;
+  int v1335=v532+3;
+  int v1336=v1068+5;
+  int v1337=v942+5;
+  int v1338=v791+4;
+  int v1339=v263+5;
+  int v1340=v916+1;
+  int v1341=v585+6;
+  int v1342=v1136+8;
+  int v1343=v999+1;
+  int v1344=v1298+8;
+  int v1345=v1160+9;
+  int v1346=v1074+9;
+  int v1347=v250+5;
+  int v1348=v766+8;
+  int v1349=v429+4;
+  int v1350=v346+6;
+  int v1351=v408+4;
+  int v1352=v315+9;
+  int v1353=v173+7;
+  int v1354=v988+6;
+  int v1355=v1276+9;
+  int v1356=v50+4;
+  int v1357=v114+3;
+  int v1358=v459+6;
+  int v1359=v99+4;
+  int v1360=v1239+9;
+  int v1361=v1109+2;
+  int v1362=v621+3;
+  int v1363=v1055+6;
+  int v1364=v952+9;
+  int v1365=v207+0;
+  int v1366=v1239+2;
+  int v1367=v65+9;
+  int v1368=v22+3;
+  int v1369=v280+5;
+  int v1370=v1229+2;
+  int v1371=v312+0;
+  int v1372=v335+5;
+  int v1373=v674+1;
+  int v1374=v1330+7;
+  int v1375=v122+2;
+  int v1376=v224+4;
+  int v1377=v599+9;
+  int v1378=v754+9;
+  int v1379=v1342+8;
+  int v1380=v1335+3;
+  int v1381=v794+4;
+  int v1382=v994+6;
+  int v1383=v310+5;
+  int v1384=v831+2;
+  int v1385=v180+8;
+  int v1386=v756+0;
+  int v1387=v84+6;
+  int v1388=v1149+3;
+  int v1389=v1371+4;
+  int v1390=v226+0;
+  int v1391=v1128+2;
+  int v1392=v1320+0;
+  int v1393=v403+3;
+  int v1394=v351+3;
+  int v1395=v928+1;
+  int v1396=v877+9;
+  int v1397=v1182+9;
+  int v1398=v448+4;
+  int v1399=v171+0;
+  int v1400=v165+7;
+  int v1401=v554+7;
+  int v1402=v616+5;
+  int v1403=v1315+2;
+  int v1404=v666+8;
+  int v1405=v1064+6;
+  int v1406=v1139+3;
+  int v1407=v1043+2;
+  int v1408=v807+3;
+  int v1409=v1115+8;
+  int v1410=v1384+0;
+  int v1411=v692+2;
+  int v1412=v964+8;
+  int v1413=v1394+4;
+  int v1414=v424+7;
+  int v1415=v1287+3;
+  int v1416=v892+8;
+  int v1417=v578+3;
+  int v1418=v526+9;
+  int v1419=v1411+8;
+  int v1420=v43+9;
+  int v1421=v840+1;
+  int v1422=v190+6;
+  int v1423=v1002+1;
+  int v1424=v185+5;
+  int v1425=v644+4;
+  int v1426=v910+0;
+  int v1427=v812+7;
+  int v1428=v572+6;
+  int v1429=v1049+1;
+  int v1430=v1403+5;
+  int v1431=v301+0;
+  int v1432=v755+2;
+  int v1433=v722+1;
+  int v1434=v890+7;
+  int v1435=v388+8;
+  int v1436=v1031+6;
+  int v1437=v1394+5;
+  int v1438=v170+6;
+  int v1439=v113+5;
+  int v1440=v202+4;
+  int v1441=v967+2;
+  int v1442=v966+6;
+  int v1443=v1158+7;
+  int v1444=v929+6;
+  int v1445=v1089+3;
+  int v1446=v876+7;
+  int v1447=v1367+0;
+  int v1448=v266+2;
+  int v1449=v556+5;
+  int v1450=v832+8;
+  int v1451=v387+5;
+  int v1452=v762+8;
+  int v1453=v940+1;
+  int v1454=v1003+3;
+  int v1455=v330+5;
+  int v1456=v539+2;
+  int v1457=v1380+8;
+  int v1458=v1382+5;
+  int v1459=v541+5;
+  int v1460=v168+7;
+  int v1461=v1159+2;
+  int v1462=v998+1;
+  int v1463=v655+3;
+  int v1464=v7+5;
+  int v1465=v1298+9;
+  int v1466=v442+4;
+  int v1467=v743+8;
+  int v1468=v502+4;
+  int v1469=v814+9;
+  int v1470=v1004+1;
+  int v1471=v123+9;
+  int v1472=v1228+7;
+  int v1473=v1059+0;
+  int v1474=v557+4;
+  int v1475=v881+2;
+  int v1476=v979+7;
+  int v1477=v264+8;
+  int v1478=v384+9;
+  int v1479=v525+4;
+  int v1480=v855+9;
+  int v1481=v480+6;
+  int v1482=v1136+4;
+  int v1483=v1123+1;
+  int v1484=v125+6;
+  int v1485=v382+6;
+  int v1486=v590+9;
+  int v1487=v1089+4;
+  int v1488=v280+7;
+  int v1489=v838+4;
+  int v1490=v1293+0;
+  int v1491=v1428+0;
+  int v1492=v682+5;
+  int v1493=v1454+6;
+  int v1494=v1378+2;
+  int v1495=v1017+3;
+  int v1496=v332+5;
+  int v1497=v356+4;
+  int v1498=v992+4;
+  int v1499=v239+3;
+  int v1500=v61+7;
+  int v1501=v370+7;
+  int v1502=v51+8;
+  int v1503=v929+5;
+  int v1504=v460+3;
+  int v1505=v704+0;
+  int v1506=v1431+3;
+  int v1507=v629+6;
+  int v1508=v694+3;
+  int v1509=v365+8;
+  int v1510=v1175+0;
+  int v1511=v1454+7;
+  int v1512=v591+7;
+  int v1513=v1118+5;
+  int v1514=v595+4;
+  int v1515=v466+2;
+  int v1516=v1453+7;
+  int v1517=v1179+8;
+  int v1518=v254+5;
+  int v1519=v178+8;
+  int v1520=v493+7;
+  int v1521=v451+4;
+  int v1522=v87+4;
+  int v1523=v1072+7;
+  int v1524=v849+5;
+  int v1525=v439+2;
+  int v1526=v1130+7;
+  int v1527=v65+0;
+  int v1528=v600+8;
+  int v1529=v67+4;
+  int v1530=v618+9;
+  int v1531=v221+2;
+  int v1532=v911+8;
+  int v1533=v796+7;
+  int v1534=v537+7;
+  int v1535=v488+9;
+  int v1536=v904+5;
+  int v1537=v394+8;
+  int v1538=v1287+1;
+  int v1539=v307+0;
+  int v1540=v43+2;
+  int v1541=v228+5;
+  int v1542=v788+2;
+  int v1543=v951+1;
+  int v1544=v397+2;
+  int v1545=v325+9;
+  int v1546=v380+3;
+  int v1547=v1460+6;
+  int v1548=v809+1;
+  int v1549=v1314+6;
+  int v1550=v72+5;
+  int v1551=v1548+3;
+  int v1552=v402+2;
+  int v1553=v9+6;
+  int v1554=v691+4;
+  int v1555=v1392+9;
+  int v1556=v484+7;
+  int v1557=v982+3;
+  int v1558=v1504+3;
+  int v1559=v239+6;
+  int v1560=v346+8;
+  int v1561=v122+1;
+  int v1562=v1168+9;
+  int v1563=v1123+7;
+  int v1564=v894+2;
+  int v1565=v1224+0;
+  int v1566=v750+2;
+  int v1567=v165+4;
+  int v1568=v123+8;
+  int v1569=v1417+1;
+  int v1570=v1144+7;
+  int v1571=v738+5;
+  int v1572=v1275+4;
+  int v1573=v299+2;
+  int v1574=v1205+4;
+  int v1575=v60+7;
+  int v1576=v626+5;
+  int v1577=v92+5;
+  int v1578=v380+6;
+  int v1579=v230+1;
+  int v1580=v502+5;
+  int v1581=v423+7;
+  int v1582=v66+3;
+  int v1583=v120+3;
+  int v1584=v942+7;
+  int v1585=v42+1;
+  int v1586=v160+1;
+  int v1587=v58+2;
+  int v1588=v609+8;
+  int v1589=v897+4;
+  int v1590=v2+1;
+  int v1591=v643+0;
+  int v1592=v107+6;
+  int v1593=v224+1;
+  int v1594=v325+1;
+  int v1595=v1351+5;
+  int v1596=v150+3;
+  int v1597=v522+9;
+  int v1598=v1175+2;
+  int v1599=v1546+3;
+  int v1600=v320+3;
+  int v1601=v1280+6;
+  int v1602=v902+5;
+  int v1603=v584+0;
+  int v1604=v1200+2;
+  int v1605=v748+8;
+  int v1606=v1100+6;
+  int v1607=v867+8;
+  int v1608=v443+2;
+  int v1609=v553+2;
+  int v1610=v620+3;
+  int v1611=v1012+6;
+  int v1612=v829+1;
+  int v1613=v467+2;
+  int v1614=v1009+9;
+  int v1615=v224+3;
+  int v1616=v550+4;
+  int v1617=v586+7;
+  int v1618=v838+5;
+  int v1619=v1435+6;
+  int v1620=v458+9;
+  int v1621=v1460+6;
+  int v1622=v629+9;
+  int v1623=v588+3;
+  int v1624=v769+3;
+  int v1625=v1038+3;
+  int v1626=v641+3;
+  int v1627=v238+8;
+  int v1628=v1333+0;
+  int v1629=v727+9;
+  int v1630=v57+2;
+  int v1631=v1620+8;
+  int v1632=v559+3;
+  int v1633=v954+0;
+  int v1634=v1062+2;
+  int v1635=v907+5;
+  int v1636=v653+9;
+  int v1637=v312+4;
+  int v1638=v801+8;
+  int v1639=v1620+1;
+  int v1640=v1517+2;
+  int v1641=v329+3;
+  int v1642=v214+6;
+  int v1643=v800+0;
+  int v1644=v1019+7;
+  int v1645=v1551+4;
+  int v1646=v253+2;
+  int v1647=v220+7;
+  int v1648=v957+8;
+  int v1649=v812+0;
+  int v1650=v394+5;
+  int v1651=v131+4;
+  int v1652=v1353+8;
+  int v1653=v1121+5;
+  int v1654=v906+4;
+  int v1655=v632+0;
+  int v1656=v262+2;
+  int v1657=v1580+8;
+  int v1658=v424+9;
+  int v1659=v102+9;
+  int v1660=v262+5;
+  int v1661=v1010+4;
+  int v1662=v1394+3;
+  int v1663=v74+9;
+  int v1664=v1469+9;
+  int v1665=v32+1;
+  int v1666=v1060+6;
+  int v1667=v1658+6;
+  int v1668=v194+4;
+  int v1669=v194+6;
+  int v1670=v184+9;
+  int v1671=v673+8;
+  int v1672=v1259+1;
+  int v1673=v1134+7;
+  int v1674=v1103+5;
+  int v1675=v857+6;
+  int v1676=v880+1;
+  int v1677=v755+8;
+  int v1678=v643+2;
+  int v1679=v330+3;
+  int v1680=v132+5;
+  int v1681=v1045+1;
+  int v1682=v1249+4;
+  int v1683=v101+7;
+  int v1684=v1553+0;
+  int v1685=v1423+8;
+  int v1686=v1178+1;
+  int v1687=v1489+4;
+  int v1688=v357+3;
+  int v1689=v549+3;
+  int v1690=v607+6;
+  int v1691=v1317+2;
+  int v1692=v13+1;
+  int v1693=v841+8;
+  int v1694=v1509+6;
+  int v1695=v1408+0;
+  int v1696=v1409+7;
+  int v1697=v949+5;
+  int v1698=v1594+2;
+  int v1699=v814+6;
+  int v1700=v1654+1;
+  int v1701=v293+5;
+  int v1702=v1264+0;
+  int v1703=v383+4;
+  int v1704=v1559+8;
+  int v1705=v502+0;
+  int v1706=v1177+0;
+  int v1707=v527+7;
+  int v1708=v1129+3;
+  int v1709=v211+4;
+  int v1710=v1461+4;
+  int v1711=v1177+0;
+  int v1712=v1564+1;
+  int v1713=v1422+7;
+  int v1714=v291+7;
+  int v1715=v307+8;
+  int v1716=v1319+9;
+  int v1717=v127+1;
+  int v1718=v1225+9;
+  int v1719=v1174+5;
+  int v1720=v158+5;
+  int v1721=v889+3;
+  int v1722=v208+7;
+  int v1723=v1479+8;
+  int v1724=v1142+0;
+  int v1725=v1545+2;
+  int v1726=v1438+2;
+  int v1727=v647+3;
+  int v1728=v940+0;
+  int v1729=v540+9;
+  int v1730=v190+7;
+  int v1731=v1191+4;
+  int v1732=v432+1;
+  int v1733=v1240+5;
+  int v1734=v1389+2;
+  int v1735=v57+0;
+  int v1736=v1239+8;
+  int v1737=v29+2;
+  int v1738=v1532+4;
+  int v1739=v557+1;
+  int v1740=v219+0;
+  int v1741=v1323+2;
+  int v1742=v1384+9;
+  int v1743=v1008+5;
+  int v1744=v1473+1;
+  int v1745=v1569+6;
+  int v1746=v1619+1;
+  int v1747=v439+6;
+  int v1748=v232+3;
+  int v1749=v984+4;
+  int v1750=v928+9;
+  int v1751=v1136+0;
+  int v1752=v1248+2;
+  int v1753=v1017+6;
+  int v1754=v842+0;
+  int v1755=v640+6;
+  int v1756=v942+9;
+  int v1757=v1111+0;
+  int v1758=v722+8;
+  int v1759=v1368+4;
+  int v1760=v1230+7;
+  int v1761=v1709+8;
+  int v1762=v526+6;
+  int v1763=v540+4;
+  int v1764=v206+2;
+  int v1765=v139+5;
+  int v1766=v357+4;
+  int v1767=v1263+3;
+  int v1768=v912+9;
+  int v1769=v416+6;
+  int v1770=v153+0;
+  int v1771=v174+9;
+  int v1772=v1661+3;
+  int v1773=v650+4;
+  int v1774=v467+8;
+  int v1775=v946+6;
+  int v1776=v784+0;
+  int v1777=v1171+5;
+  int v1778=v666+4;
+  int v1779=v1264+6;
+  int v1780=v133+0;
+  int v1781=v1467+6;
+  int v1782=v1068+3;
+  int v1783=v994+2;
+  int v1784=v69+5;
+  int v1785=v1372+8;
+  int v1786=v839+1;
+  int v1787=v178+1;
+  int v1788=v500+3;
+  int v1789=v898+5;
+  int v1790=v226+8;
+  int v1791=v509+9;
+  int v1792=v151+6;
+  int v1793=v486+3;
+  int v1794=v874+1;
+  int v1795=v46+1;
+  int v1796=v1221+3;
+  int v1797=v589+9;
+  int v1798=v526+3;
+  int v1799=v1786+5;
+  int v1800=v518+7;
+  int v1801=v1392+9;
+  int v1802=v1152+8;
+  int v1803=v1794+2;
+  int v1804=v769+1;
+  int v1805=v249+0;
+  int v1806=v1243+6;
+  int v1807=v301+4;
+  int v1808=v882+8;
+  int v1809=v1361+7;
+  int v1810=v1384+8;
+  int v1811=v1751+6;
+  int v1812=v1758+8;
+  int v1813=v655+7;
+  int v1814=v956+3;
+  int v1815=v1350+5;
+  int v1816=v1337+6;
+  int v1817=v253+1;
+  int v1818=v73+7;
+  int v1819=v1680+2;
+  int v1820=v725+6;
+  int v1821=v1814+3;
+  int v1822=v210+1;
+  int v1823=v786+9;
+  int v1824=v1172+9;
+  int v1825=v1601+6;
+  int v1826=v399+7;
+  int v1827=v198+9;
+  int v1828=v514+1;
+  int v1829=v762+0;
+  int v1830=v835+3;
+  int v1831=v1773+2;
+  int v1832=v794+2;
+  int v1833=v1490+9;
+  int v1834=v1780+8;
+  int v1835=v1787+2;
+  int v1836=v452+2;
+  int v1837=v1056+4;
+  int v1838=v1467+5;
+  int v1839=v1302+3;
+  int v1840=v1471+5;
+  int v1841=v685+1;
+  int v1842=v1057+5;
+  int v1843=v991+9;
+  int v1844=v852+6;
+  int v1845=v149+1;
+  int v1846=v784+9;
+  int v1847=v1502+3;
+  int v1848=v1573+8;
+  int v1849=v1300+2;
+  int v1850=v1170+9;
+  int v1851=v1089+6;
+  int v1852=v585+5;
+  int v1853=v375+7;
+  int v1854=v956+4;
+  int v1855=v979+1;
+  int v1856=v1583+8;
+  int v1857=v813+4;
+  int v1858=v391+7;
+  int v1859=v1133+7;
+  int v1860=v1313+9;
+  int v1861=v61+2;
+  int v1862=v794+9;
+  int v1863=v859+5;
+  int v1864=v1100+5;
+  int v1865=v1581+6;
+  int v1866=v432+7;
+  int v1867=v63+9;
+  int v1868=v1541+5;
+  int v1869=v1426+0;
+  int v1870=v1389+0;
+  int v1871=v1513+5;
+  int v1872=v318+5;
+  int v1873=v662+8;
+  int v1874=v192+5;
+  int v1875=v1528+1;
+  int v1876=v737+0;
+  int v1877=v1512+8;
+  int v1878=v653+8;
+  int v1879=v1468+8;
+  int v1880=v1806+2;
+  int v1881=v910+0;
+  int v1882=v79+7;
+  int v1883=v748+8;
+  int v1884=v557+9;
+  int v1885=v423+4;
+  int v1886=v1376+8;
+  int v1887=v1134+3;
+  int v1888=v1746+1;
+  int v1889=v221+0;
+  int v1890=v20+0;
+  int v1891=v1265+8;
+  int v1892=v1327+4;
+  int v1893=v825+3;
+  int v1894=v1245+5;
+  int v1895=v977+3;
+  int v1896=v9+5;
+  int v1897=v889+7;
+  int v1898=v915+4;
+  int v1899=v1794+9;
+  int v1900=v912+6;
+  int v1901=v1125+7;
+  int v1902=v298+7;
+  int v1903=v747+5;
+  int v1904=v354+8;
+  int v1905=v101+1;
+  int v1906=v264+8;
+  int v1907=v299+0;
+  int v1908=v1629+9;
+  int v1909=v1446+2;
+  int v1910=v1119+3;
+  int v1911=v320+5;
+  int v1912=v1370+3;
+  int v1913=v1277+9;
+  int v1914=v1473+4;
+  int v1915=v711+6;
+  int v1916=v1546+5;
+  int v1917=v8+3;
+  int v1918=v129+3;
+  int v1919=v482+2;
+  int v1920=v1539+1;
+  int v1921=v1356+1;
+  int v1922=v222+7;
+  int v1923=v564+5;
+  int v1924=v35+6;
+  int v1925=v147+4;
+  int v1926=v1517+3;
+  int v1927=v1920+2;
+  int v1928=v1862+2;
+  int v1929=v371+1;
+  int v1930=v297+7;
+  int v1931=v931+7;
+  int v1932=v1332+8;
+  int v1933=v1071+4;
+  int v1934=v1681+7;
+  int v1935=v1312+0;
+  int v1936=v366+0;
+  int v1937=v1326+9;
+  int v1938=v55+3;
+  int v1939=v494+0;
+  int v1940=v1195+5;
+  int v1941=v1211+1;
+  int v1942=v1079+9;
+  int v1943=v1757+4;
+  int v1944=v691+0;
+  int v1945=v722+8;
+  int v1946=v761+9;
+  int v1947=v1373+4;
+  int v1948=v517+1;
+  int v1949=v325+1;
+  int v1950=v52+0;
+  int v1951=v1295+5;
+  int v1952=v874+8;
+  int v1953=v632+2;
+  int v1954=v1466+0;
+  int v1955=v898+6;
+  int v1956=v135+6;
+  int v1957=v835+3;
+  int v1958=v295+9;
+  int v1959=v1092+3;
+  int v1960=v172+8;
+  int v1961=v1435+2;
+  int v1962=v1952+0;
+  int v1963=v532+6;
+  int v1964=v381+0;
+  int v1965=v1393+0;
+  int v1966=v1032+0;
+  int v1967=v631+3;
+  int v1968=v499+9;
+  int v1969=v751+9;
+  int v1970=v24+3;
+  int v1971=v434+9;
+  int v1972=v1215+3;
+  int v1973=v69+0;
+  int v1974=v676+5;
+  int v1975=v373+5;
+  int v1976=v1755+6;
+  int v1977=v840+2;
+  int v1978=v251+3;
+  int v1979=v1356+5;
+  int v1980=v1419+6;
+  int v1981=v1210+3;
+  int v1982=v1843+3;
+  int v1983=v1480+5;
+  int v1984=v1608+8;
+  int v1985=v147+0;
+  int v1986=v1632+6;
+  int v1987=v422+8;
+  int v1988=v382+1;
+  int v1989=v1454+7;
+  int v1990=v1045+8;
+  int v1991=v1787+5;
+  int v1992=v1483+1;
+  int v1993=v25+2;
+  int v1994=v1245+0;
+  int v1995=v1596+7;
+  int v1996=v545+0;
+  int v1997=v1217+0;
+  int v1998=v513+6;
+  int v1999=v1229+8;
+  int v2000=v1711+8;
+  int v2001=v353+7;
+  int v2002=v623+0;
+  int v2003=v1118+5;
+  int v2004=v951+0;
+  int v2005=v474+6;
+  int v2006=v1687+4;
+  int v2007=v1823+7;
+  int v2008=v697+5;
+  int v2009=v125+0;
+  int v2010=v1703+5;
+  int v2011=v838+8;
+  int v2012=v840+8;
+  int v2013=v1627+0;
+  int v2014=v399+1;
+  int v2015=v728+9;
+  int v2016=v1408+7;
+  int v2017=v1849+9;
+  int v2018=v1539+2;
+  int v2019=v1815+2;
+  int v2020=v641+4;
+  int v2021=v1251+0;
+  int v2022=v1997+5;
+  int v2023=v876+0;
+  int v2024=v50+7;
+  int v2025=v880+8;
+  int v2026=v30+1;
+  int v2027=v434+3;
+  int v2028=v1798+7;
+  int v2029=v348+1;
+  int v2030=v1330+2;
+  int v2031=v1662+0;
+  int v2032=v1534+7;
+  int v2033=v1677+4;
+  int v2034=v1112+2;
+  int v2035=v797+6;
+  int v2036=v586+7;
+  int v2037=v991+9;
+  int v2038=v1838+5;
+  int v2039=v277+1;
+  int v2040=v921+2;
+  int v2041=v1440+9;
+  int v2042=v1049+7;
+  int v2043=v368+6;
+  int v2044=v1859+3;
+  int v2045=v1190+6;
+  int v2046=v527+0;
+  int v2047=v1833+5;
+  int v2048=v529+6;
+  int v2049=v850+8;
+  int v2050=v1969+6;
+  int v2051=v1447+4;
+  int v2052=v269+5;
+  int v2053=v1988+6;
+  int v2054=v809+0;
+  int v2055=v1283+8;
+  int v2056=v708+4;
+  int v2057=v1481+0;
+  int v2058=v471+6;
+  int v2059=v290+9;
+  int v2060=v257+9;
+  int v2061=v1986+3;
+  int v2062=v71+9;
+  int v2063=v1894+6;
+  int v2064=v1212+8;
+  int v2065=v1137+6;
+  int v2066=v1563+0;
+  int v2067=v1602+0;
+  int v2068=v1959+8;
+  int v2069=v1072+5;
+  int v2070=v1048+5;
+  int v2071=v1526+1;
+  int v2072=v1088+5;
+  int v2073=v608+0;
+  int v2074=v504+6;
+  int v2075=v604+0;
+  int v2076=v5+3;
+  int v2077=v449+7;
+  int v2078=v208+9;
+  int v2079=v1587+1;
+  int v2080=v1914+8;
+  int v2081=v1099+4;
+  int v2082=v259+2;
+  int v2083=v1951+5;
+  int v2084=v748+0;
+  int v2085=v735+6;
+  int v2086=v1895+1;
+  int v2087=v491+9;
+  int v2088=v357+0;
+  int v2089=v90+9;
+  int v2090=v1374+3;
+  int v2091=v1126+8;
+  int v2092=v1315+8;
+  int v2093=v1473+1;
+  int v2094=v1707+8;
+  int v2095=v234+4;
+  int v2096=v290+9;
+  int v2097=v360+7;
+  int v2098=v716+4;
+  int v2099=v1084+5;
+  int v2100=v540+6;
+  int v2101=v1754+9;
+  int v2102=v218+2;
+  int v2103=v1227+8;
+  int v2104=v895+4;
+  int v2105=v1111+4;
+  int v2106=v1363+3;
+  int v2107=v1699+9;
+  int v2108=v1246+7;
+  int v2109=v485+2;
+  int v2110=v734+6;
+  int v2111=v829+2;
+  int v2112=v854+6;
+  int v2113=v1981+1;
+  int v2114=v946+9;
+  int v2115=v474+3;
+  int v2116=v485+3;
+  int v2117=v36+6;
+  int v2118=v1731+3;
+  int v2119=v482+6;
+  int v2120=v149+8;
+  int v2121=v206+0;
+  int v2122=v1174+2;
+  int v2123=v628+1;
+  int v2124=v1788+9;
+  int v2125=v913+9;
+  int v2126=v868+4;
+  int v2127=v1361+2;
+  int v2128=v86+3;
+  int v2129=v890+1;
+  int v2130=v314+3;
+  int v2131=v1069+1;
+  int v2132=v1931+0;
+  int v2133=v2125+4;
+  int v2134=v2104+0;
+  int v2135=v1324+8;
+  int v2136=v1229+8;
+  int v2137=v1595+8;
+  int v2138=v1054+8;
+  int v2139=v319+9;
+  int v2140=v1614+5;
+  int v2141=v499+8;
+  int v2142=v887+8;
+  int v2143=v1841+3;
+  int v2144=v351+0;
+  int v2145=v38+1;
+  int v2146=v1461+9;
+  int v2147=v1693+7;
+  int v2148=v751+2;
+  int v2149=v205+9;
+  int v2150=v295+4;
+  int v2151=v2065+7;
+  int v2152=v1178+0;
+  int v2153=v1664+3;
+  int v2154=v1728+7;
+  int v2155=v1508+5;
+  int v2156=v733+2;
+  int v2157=v829+2;
+  int v2158=v2030+0;
+  int v2159=v374+7;
+  int v2160=v639+2;
+  int v2161=v71+5;
+  int v2162=v1990+4;
+  int v2163=v280+4;
+  int v2164=v549+6;
+  int v2165=v1776+4;
+  int v2166=v1775+1;
+  int v2167=v28+8;
+  int v2168=v232+4;
+  int v2169=v1439+4;
+  int v2170=v1331+0;
+  int v2171=v276+9;
+  int v2172=v1380+5;
+  int v2173=v263+1;
+  int v2174=v293+7;
+  int v2175=v1350+4;
+  int v2176=v1903+1;
+  int v2177=v273+9;
+  int v2178=v1074+8;
+  int v2179=v2153+6;
+  int v2180=v1863+0;
+  int v2181=v1697+4;
+  int v2182=v1488+3;
+  int v2183=v279+4;
+  int v2184=v866+5;
+  int v2185=v295+2;
+  int v2186=v1860+7;
+  int v2187=v1902+1;
+  int v2188=v659+8;
+  int v2189=v1996+0;
+  int v2190=v161+9;
+  int v2191=v2043+0;
+  int v2192=v798+0;
+  int v2193=v77+8;
+  int v2194=v850+1;
+  int v2195=v1348+9;
+  int v2196=v824+3;
+  int v2197=v289+1;
+  int v2198=v1263+2;
+  int v2199=v266+7;
+  int v2200=v1220+9;
+  int v2201=v24+8;
+  int v2202=v1612+7;
+  int v2203=v643+1;
+  int v2204=v1533+9;
+  int v2205=v1970+6;
+  int v2206=v868+5;
+  int v2207=v120+3;
+  int v2208=v2170+1;
+  int v2209=v56+7;
+  int v2210=v1876+3;
+  int v2211=v1324+5;
+  int v2212=v813+0;
+  int v2213=v179+1;
+  int v2214=v1594+0;
+  int v2215=v1272+6;
+  int v2216=v775+0;
+  int v2217=v865+7;
+  int v2218=v631+1;
+  int v2219=v420+4;
+  int v2220=v846+7;
+  int v2221=v1089+3;
+  int v2222=v1565+6;
+  int v2223=v1760+0;
+  int v2224=v983+5;
+  int v2225=v1357+8;
+  int v2226=v1792+0;
+  int v2227=v1215+1;
+  int v2228=v1734+9;
+  int v2229=v163+6;
+  int v2230=v1808+9;
+  int v2231=v553+4;
+  int v2232=v1291+6;
+  int v2233=v753+2;
+  int v2234=v630+6;
+  int v2235=v1655+2;
+  int v2236=v789+3;
+  int v2237=v679+1;
+  int v2238=v600+1;
+  int v2239=v1612+6;
+  int v2240=v1623+7;
+  int v2241=v1379+5;
+  int v2242=v927+1;
+  int v2243=v2228+7;
+  int v2244=v1416+9;
+  int v2245=v1308+3;
+  int v2246=v2221+7;
+  int v2247=v1139+1;
+  int v2248=v42+1;
+  int v2249=v1342+7;
+  int v2250=v1304+1;
+  int v2251=v545+5;
+  int v2252=v152+1;
+  int v2253=v331+9;
+  int v2254=v258+8;
+  int v2255=v304+6;
+  int v2256=v279+9;
+  int v2257=v212+5;
+  int v2258=v106+1;
+  int v2259=v1104+7;
+  int v2260=v809+0;
+  int v2261=v1633+1;
+  int v2262=v388+4;
+  int v2263=v101+5;
+  int v2264=v1174+8;
+  int v2265=v1215+1;
+  int v2266=v675+0;
+  int v2267=v1174+7;
+  int v2268=v991+0;
+  int v2269=v1597+1;
+  int v2270=v1937+8;
+  int v2271=v1823+8;
+  int v2272=v247+3;
+  int v2273=v1132+7;
+  int v2274=v1566+2;
+  int v2275=v1217+1;
+  int v2276=v622+1;
+  int v2277=v894+5;
+  int v2278=v1870+2;
+  int v2279=v1888+0;
+  int v2280=v483+6;
+  int v2281=v1569+5;
+  int v2282=v1091+2;
+  int v2283=v168+1;
+  int v2284=v1887+3;
+  int v2285=v1633+6;
+  int v2286=v1327+0;
+  int v2287=v110+0;
+  int v2288=v1166+4;
+  int v2289=v262+3;
+  int v2290=v769+4;
+  int v2291=v1494+1;
+  int v2292=v1933+8;
+  int v2293=v1090+0;
+  int v2294=v92+1;
+  int v2295=v730+4;
+  int v2296=v898+6;
+  int v2297=v1985+0;
+  int v2298=v347+1;
+  int v2299=v1095+0;
+  int v2300=v412+7;
+  int v2301=v636+4;
+  int v2302=v552+4;
+  int v2303=v1664+7;
+  int v2304=v491+2;
+  int v2305=v56+4;
+  int v2306=v459+9;
+  int v2307=v2271+3;
+  int v2308=v1947+5;
+  int v2309=v1479+0;
+  int v2310=v405+3;
+  int v2311=v187+6;
+  int v2312=v1991+0;
+  int v2313=v2167+7;
+  int v2314=v1062+7;
+  int v2315=v1328+0;
+  int v2316=v1150+6;
+  int v2317=v2278+0;
+  int v2318=v689+1;
+  int v2319=v2093+8;
+  int v2320=v1383+8;
+  int v2321=v2092+2;
+  int v2322=v1419+0;
+  int v2323=v2056+3;
+  int v2324=v1799+6;
+  int v2325=v1872+6;
+  int v2326=v373+6;
+  int v2327=v1386+7;
+  int v2328=v348+9;
+  int v2329=v709+0;
+  int v2330=v1152+9;
+  int v2331=v460+7;
+  int v2332=v248+4;
+  int v2333=v342+2;
+  int v2334=v499+6;
+  int v2335=v1542+5;
+  int v2336=v1827+6;
+  int v2337=v2262+8;
+  int v2338=v503+0;
+  int v2339=v741+2;
+  int v2340=v2247+2;
+  int v2341=v2074+7;
+  int v2342=v1622+7;
+  int v2343=v2283+0;
+  int v2344=v209+1;
+  int v2345=v41+6;
+  int v2346=v1348+6;
+  int v2347=v1827+2;
+  int v2348=v1037+2;
+  int v2349=v2086+9;
+  int v2350=v388+3;
+  int v2351=v1998+0;
+  int v2352=v652+2;
+  int v2353=v1192+4;
+  int v2354=v1900+2;
+  int v2355=v1739+1;
+  int v2356=v1205+9;
+  int v2357=v19+7;
+  int v2358=v386+3;
+  int v2359=v2037+6;
+  int v2360=v2183+3;
+  int v2361=v693+3;
+  int v2362=v1421+5;
+  int v2363=v584+1;
+  int v2364=v1485+0;
+  int v2365=v2113+3;
+  int v2366=v613+2;
+  int v2367=v20+3;
+  int v2368=v938+5;
+  int v2369=v132+7;
+  int v2370=v621+6;
+  int v2371=v511+0;
+  int v2372=v722+5;
+  int v2373=v1591+9;
+  int v2374=v507+6;
+  int v2375=v295+4;
+  int v2376=v651+5;
+  int v2377=v583+5;
+  int v2378=v839+4;
+  int v2379=v1256+1;
+  int v2380=v1324+9;
+  int v2381=v1410+7;
+  int v2382=v1356+9;
+  int v2383=v330+0;
+  int v2384=v373+2;
+  int v2385=v1043+2;
+  int v2386=v1764+6;
+  int v2387=v823+8;
+  int v2388=v439+9;
+  int v2389=v967+5;
+  int v2390=v178+5;
+  int v2391=v1178+9;
+  int v2392=v1354+8;
+  int v2393=v707+7;
+  int v2394=v462+6;
+  int v2395=v1651+8;
+  int v2396=v1261+1;
+  int v2397=v2026+1;
+  int v2398=v213+9;
+  int v2399=v1334+8;
+  int v2400=v301+3;
+  int v2401=v162+1;
+  int v2402=v2250+2;
+  int v2403=v1589+6;
+  int v2404=v700+0;
+  int v2405=v649+4;
+  int v2406=v2116+3;
+  int v2407=v235+9;
+  int v2408=v453+9;
+  int v2409=v1929+0;
+  int v2410=v1751+5;
+  int v2411=v287+0;
+  int v2412=v409+4;
+  int v2413=v1357+9;
+  int v2414=v2041+1;
+  int v2415=v838+7;
+  int v2416=v888+3;
+  int v2417=v1876+6;
+  int v2418=v1137+9;
+  int v2419=v804+4;
+  int v2420=v1023+6;
+  int v2421=v2152+2;
+  int v2422=v2034+5;
+  int v2423=v689+1;
+  int v2424=v102+4;
+  int v2425=v2181+8;
+  int v2426=v1363+3;
+  int v2427=v2176+2;
+  int v2428=v1592+6;
+  int v2429=v1296+5;
+  int v2430=v2313+3;
+  int v2431=v2417+1;
+  int v2432=v1269+9;
+  int v2433=v571+8;
+  int v2434=v2184+8;
+  int v2435=v925+3;
+  int v2436=v1383+0;
+  int v2437=v254+8;
+  int v2438=v1401+1;
+  int v2439=v974+0;
+  int v2440=v2333+4;
+  int v2441=v505+4;
+  int v2442=v1775+5;
+  int v2443=v217+6;
+  int v2444=v2242+3;
+  int v2445=v408+3;
+  int v2446=v864+9;
+  int v2447=v1443+4;
+  int v2448=v362+4;
+  int v2449=v1444+0;
+  int v2450=v285+7;
+  int v2451=v2406+9;
+  int v2452=v606+2;
+  int v2453=v1452+9;
+  int v2454=v2300+1;
+  int v2455=v2107+2;
+  int v2456=v1630+5;
+  int v2457=v752+7;
+  int v2458=v1467+3;
+  int v2459=v1793+6;
+  int v2460=v464+0;
+  int v2461=v87+5;
+  int v2462=v1529+5;
+  int v2463=v824+8;
+  int v2464=v2153+6;
+  int v2465=v542+4;
+  int v2466=v208+5;
+  int v2467=v2164+4;
+  int v2468=v432+9;
+  int v2469=v1671+8;
+  int v2470=v2442+5;
+  int v2471=v1388+7;
+  int v2472=v2286+9;
+  int v2473=v848+0;
+  int v2474=v523+3;
+  int v2475=v1173+8;
+  int v2476=v1661+0;
+  int v2477=v1182+1;
+  int v2478=v1692+3;
+  int v2479=v2181+0;
+  int v2480=v429+5;
+  int v2481=v2436+1;
+  int v2482=v2369+9;
+  int v2483=v1337+9;
+  int v2484=v685+5;
+  int v2485=v1531+8;
+  int v2486=v2006+5;
+  int v2487=v1264+7;
+  int v2488=v1101+6;
+  int v2489=v283+5;
+  int v2490=v2444+7;
+  int v2491=v1280+9;
+  int v2492=v459+3;
+  int v2493=v553+9;
+  int v2494=v1000+6;
+  int v2495=v1303+8;
+  int v2496=v1871+1;
+  int v2497=v1977+5;
+  int v2498=v249+0;
+  int v2499=v2239+0;
+  int v2500=v439+3;
+  int v2501=v1647+3;
+  int v2502=v1582+3;
+  int v2503=v200+0;
+  int v2504=v2146+4;
+  int v2505=v715+0;
+  int v2506=v824+2;
+  int v2507=v2312+5;
+  int v2508=v1384+5;
+  int v2509=v1546+2;
+  int v2510=v1177+0;
+  int v2511=v14+2;
+  int v2512=v1186+8;
+  int v2513=v1782+5;
+  int v2514=v730+3;
+  int v2515=v160+2;
+  int v2516=v2467+2;
+  int v2517=v1721+7;
+  int v2518=v2233+8;
+  int v2519=v2107+5;
+  int v2520=v686+9;
+  int v2521=v793+7;
+  int v2522=v2405+4;
+  int v2523=v1079+9;
+  int v2524=v459+4;
+  int v2525=v884+2;
+  int v2526=v366+8;
+  int v2527=v2391+3;
+  int v2528=v1386+2;
+  int v2529=v1322+0;
+  int v2530=v197+4;
+  int v2531=v594+1;
+  int v2532=v554+3;
+  int v2533=v782+8;
+  int v2534=v1317+0;
+  int v2535=v799+3;
+  int v2536=v1690+8;
+  int v2537=v2105+6;
+  int v2538=v2110+9;
+  int v2539=v2182+3;
+  int v2540=v1245+1;
+  int v2541=v1573+6;
+  int v2542=v349+6;
+  int v2543=v217+7;
+  int v2544=v631+9;
+  int v2545=v929+0;
+  int v2546=v1306+1;
+  int v2547=v1425+7;
+  int v2548=v2056+8;
+  int v2549=v2027+9;
+  int v2550=v249+7;
+  int v2551=v658+5;
+  int v2552=v1054+8;
+  int v2553=v622+3;
+  int v2554=v1050+7;
+  int v2555=v1109+4;
+  int v2556=v709+3;
+  int v2557=v1382+4;
+  int v2558=v254+2;
+  int v2559=v1720+8;
+  int v2560=v1052+3;
+  int v2561=v1282+6;
+  int v2562=v2203+4;
+  int v2563=v1396+9;
+  int v2564=v1929+5;
+  int v2565=v2196+4;
+  int v2566=v550+7;
+  int v2567=v1941+5;
+  int v2568=v1092+0;
+  int v2569=v1819+1;
+  int v2570=v1045+6;
+  int v2571=v1028+0;
+  int v2572=v2007+8;
+  int v2573=v1789+3;
+  int v2574=v184+8;
+  int v2575=v172+4;
+  int v2576=v697+0;
+  int v2577=v1385+1;
+  int v2578=v1893+5;
+  int v2579=v210+8;
+  int v2580=v136+4;
+  int v2581=v1651+9;
+  int v2582=v1706+4;
+  int v2583=v2336+3;
+  int v2584=v1653+8;
+  int v2585=v137+5;
+  int v2586=v2145+1;
+  int v2587=v432+9;
+  int v2588=v2217+3;
+  int v2589=v2040+8;
+  int v2590=v791+0;
+  int v2591=v55+0;
+  int v2592=v1061+2;
+  int v2593=v501+7;
+  int v2594=v912+0;
+  int v2595=v1895+2;
+  int v2596=v725+9;
+  int v2597=v1705+1;
+  int v2598=v233+4;
+  int v2599=v2486+2;
+  int v2600=v277+2;
+  int v2601=v2393+4;
+  int v2602=v1999+7;
+  int v2603=v1966+4;
+  int v2604=v2508+0;
+  int v2605=v701+5;
+  int v2606=v259+9;
+  int v2607=v1780+9;
+  int v2608=v1668+4;
+  int v2609=v1510+5;
+  int v2610=v1594+7;
+  int v2611=v2308+3;
+  int v2612=v1942+2;
+  int v2613=v378+5;
+  int v2614=v690+6;
+  int v2615=v2555+0;
+  int v2616=v2412+2;
+  int v2617=v1020+0;
+  int v2618=v1975+1;
+  int v2619=v1654+7;
+  int v2620=v2583+1;
+  int v2621=v336+4;
+  int v2622=v2413+3;
+  int v2623=v2055+5;
+  int v2624=v739+7;
+  int v2625=v1713+6;
+  int v2626=v1249+3;
+  int v2627=v2435+7;
+  int v2628=v1770+7;
+  int v2629=v2321+2;
+  int v2630=v794+6;
+  int v2631=v1505+3;
+  int v2632=v238+9;
+  int v2633=v2450+4;
+  int v2634=v184+4;
+  int v2635=v614+8;
+  int v2636=v1095+8;
+  int v2637=v1464+1;
+  int v2638=v381+7;
+  int v2639=v2429+6;
+  int v2640=v1392+0;
+  int v2641=v1994+2;
+  int v2642=v2112+7;
+  int v2643=v417+9;
+  int v2644=v243+9;
+  int v2645=v15+5;
+  int v2646=v1849+9;
+  int v2647=v674+1;
+  int v2648=v1246+6;
+  int v2649=v1707+2;
+  int v2650=v400+1;
+  int v2651=v1281+7;
+  int v2652=v2582+6;
+  int v2653=v1932+5;
+  int v2654=v111+9;
+  int v2655=v1432+1;
+  int v2656=v1427+1;
+  int v2657=v1019+8;
+  int v2658=v2424+9;
+  int v2659=v2417+3;
+  int v2660=v1592+4;
+  int v2661=v590+7;
+  int v2662=v215+3;
+  int v2663=v1755+6;
+  int v2664=v1562+6;
+  int v2665=v425+9;
+  int v2666=v2212+2;
+  int v2667=v2285+6;
+  int v2668=v98+0;
+  int v2669=v1555+3;
+  int v2670=v2044+5;
+  int v2671=v1891+0;
+  int v2672=v2213+0;
+  int v2673=v771+6;
+  int v2674=v2180+7;
+  int v2675=v1806+7;
+  int v2676=v1096+1;
+  int v2677=v1007+7;
+  int v2678=v1765+0;
+  int v2679=v2364+0;
+  int v2680=v2026+6;
+  int v2681=v1649+7;
+  int v2682=v1509+3;
+  int v2683=v2031+4;
+  int v2684=v1150+7;
+  int v2685=v994+4;
+  int v2686=v2182+8;
+  int v2687=v1461+2;
+  int v2688=v2318+4;
+  int v2689=v539+7;
+  int v2690=v1557+8;
+  int v2691=v2018+8;
+  int v2692=v1913+7;
+  int v2693=v65+3;
+  int v2694=v284+7;
+  int v2695=v2274+6;
+  int v2696=v2046+5;
+  int v2697=v2313+0;
+  int v2698=v1800+8;
+  int v2699=v306+4;
+  int v2700=v1544+0;
+  int v2701=v1342+8;
+  int v2702=v2633+5;
+  int v2703=v1868+6;
+  int v2704=v728+0;
+  int v2705=v1951+9;
+  int v2706=v213+5;
+  int v2707=v1832+0;
+  int v2708=v2344+9;
+  int v2709=v1743+6;
+  int v2710=v2357+2;
+  int v2711=v309+6;
+  int v2712=v2062+3;
+  int v2713=v910+5;
+  int v2714=v2278+9;
+  int v2715=v224+3;
+  int v2716=v2115+4;
+  int v2717=v2304+1;
+  int v2718=v2493+0;
+  int v2719=v680+3;
+  int v2720=v365+2;
+  int v2721=v187+1;
+  int v2722=v2441+4;
+  int v2723=v749+2;
+  int v2724=v109+2;
+  int v2725=v2260+8;
+  int v2726=v2342+0;
+  int v2727=v1238+9;
+  int v2728=v1863+5;
+  int v2729=v1738+3;
+  int v2730=v998+8;
+  int v2731=v765+3;
+  int v2732=v2052+6;
+  int v2733=v1899+2;
+  int v2734=v2303+1;
+  int v2735=v690+2;
+  int v2736=v540+4;
+  int v2737=v2346+5;
+  int v2738=v2619+4;
+  int v2739=v387+0;
+  int v2740=v164+9;
+  int v2741=v2341+9;
+  int v2742=v1739+1;
+  int v2743=v1336+2;
+  int v2744=v863+3;
+  int v2745=v1450+6;
+  int v2746=v2619+6;
+  int v2747=v651+5;
+  int v2748=v1793+6;
+  int v2749=v1449+2;
+  int v2750=v757+0;
+  int v2751=v1569+2;
+  int v2752=v742+5;
+  int v2753=v1157+0;
+  int v2754=v2707+9;
+  int v2755=v2244+9;
+  int v2756=v1160+5;
+  int v2757=v2049+6;
+  int v2758=v919+3;
+  int v2759=v776+1;
+  int v2760=v961+0;
+  int v2761=v2609+7;
+  int v2762=v510+8;
+  int v2763=v112+2;
+  int v2764=v618+0;
+  int v2765=v2393+3;
+  int v2766=v909+7;
+  int v2767=v1942+8;
+  int v2768=v131+7;
+  int v2769=v920+8;
+  int v2770=v88+3;
+  int v2771=v2342+6;
+  int v2772=v2132+1;
+  int v2773=v1232+2;
+  int v2774=v1931+5;
+  int v2775=v989+0;
+  int v2776=v1806+1;
+  int v2777=v1916+1;
+  int v2778=v1012+5;
+  int v2779=v2033+6;
+  int v2780=v1920+8;
+  int v2781=v319+1;
+  int v2782=v2366+5;
+  int v2783=v480+4;
+  int v2784=v143+5;
+  int v2785=v1984+2;
+  int v2786=v2438+4;
+  int v2787=v839+3;
+  int v2788=v1297+5;
+  int v2789=v1069+0;
+  int v2790=v2393+1;
+  int v2791=v2388+7;
+  int v2792=v2045+6;
+  int v2793=v755+1;
+  int v2794=v2537+1;
+  int v2795=v765+1;
+  int v2796=v472+7;
+  int v2797=v2432+7;
+  int v2798=v128+4;
+  int v2799=v2652+3;
+  int v2800=v190+1;
+  int v2801=v1631+8;
+  int v2802=v32+7;
+  int v2803=v1427+5;
+  int v2804=v1479+7;
+  int v2805=v2737+9;
+  int v2806=v672+2;
+  int v2807=v2409+3;
+  int v2808=v2740+5;
+  int v2809=v1766+9;
+  int v2810=v1516+3;
+  int v2811=v985+8;
+  int v2812=v2424+3;
+  int v2813=v2454+8;
+  int v2814=v564+8;
+  int v2815=v980+2;
+  int v2816=v1689+1;
+  int v2817=v1339+1;
+  int v2818=v1528+2;
+  int v2819=v98+8;
+  int v2820=v1668+5;
+  int v2821=v1666+1;
+  int v2822=v2556+1;
+  int v2823=v1093+5;
+  int v2824=v746+6;
+  int v2825=v976+1;
+  int v2826=v2455+4;
+  int v2827=v1996+7;
+  int v2828=v1798+0;
+  int v2829=v1751+8;
+  int v2830=v76+1;
+  int v2831=v2457+5;
+  int v2832=v2472+1;
+  int v2833=v594+5;
+  int v2834=v1978+1;
+  int v2835=v287+1;
+  int v2836=v1242+5;
+  int v2837=v1731+9;
+  int v2838=v459+2;
+  int v2839=v901+8;
+  int v2840=v255+8;
+  int v2841=v220+4;
+  int v2842=v1538+6;
+  int v2843=v2184+0;
+  int v2844=v1110+9;
+  int v2845=v1061+7;
+  int v2846=v36+9;
+  int v2847=v2180+8;
+  int v2848=v1687+9;
+  int v2849=v2375+5;
+  int v2850=v347+8;
+  int v2851=v2719+8;
+  int v2852=v2473+1;
+  int v2853=v965+6;
+  int v2854=v1584+7;
+  int v2855=v1755+6;
+  int v2856=v1438+3;
+  int v2857=v1740+6;
+  int v2858=v994+2;
+  int v2859=v1804+0;
+  int v2860=v279+4;
+  int v2861=v2755+6;
+  int v2862=v2185+2;
+  int v2863=v2087+9;
+  int v2864=v1392+1;
+  int v2865=v836+9;
+  int v2866=v2476+0;
+  int v2867=v2491+9;
+  int v2868=v2074+9;
+  int v2869=v1483+9;
+  int v2870=v1333+0;
+  int v2871=v1872+8;
+  int v2872=v2852+2;
+  int v2873=v2464+0;
+  int v2874=v84+5;
+  int v2875=v1633+1;
+  int v2876=v1998+9;
+  int v2877=v1961+0;
+  int v2878=v2009+9;
+  int v2879=v1681+4;
+  int v2880=v2230+6;
+  int v2881=v929+8;
+  int v2882=v1408+0;
+  int v2883=v1488+4;
+  int v2884=v2504+4;
+  int v2885=v259+8;
+  int v2886=v1453+7;
+  int v2887=v2299+6;
+  int v2888=v1315+7;
+  int v2889=v2062+8;
+  int v2890=v520+7;
+  int v2891=v2541+8;
+  int v2892=v2496+0;
+  int v2893=v21+6;
+  int v2894=v532+2;
+  int v2895=v2040+1;
+  int v2896=v1662+0;
+  int v2897=v1828+3;
+  int v2898=v1926+3;
+  int v2899=v2205+4;
+  int v2900=v2610+8;
+  int v2901=v1750+2;
+  int v2902=v2717+4;
+  int v2903=v1840+2;
+  int v2904=v1668+4;
+  int v2905=v2680+0;
+  int v2906=v1081+8;
+  int v2907=v1794+0;
+  int v2908=v362+4;
+  int v2909=v724+8;
+  int v2910=v1646+0;
+  int v2911=v646+3;
+  int v2912=v1893+9;
+  int v2913=v2112+4;
+  int v2914=v1177+9;
+  int v2915=v2771+8;
+  int v2916=v2009+6;
+  int v2917=v1632+2;
+  int v2918=v972+3;
+  int v2919=v831+1;
+  int v2920=v2013+6;
+  int v2921=v2285+5;
+  int v2922=v852+2;
+  int v2923=v198+3;
+  int v2924=v170+2;
+  int v2925=v1052+8;
+  int v2926=v659+0;
+  int v2927=v2048+8;
+  int v2928=v1563+9;
+  int v2929=v2435+3;
+  int v2930=v2182+8;
+  int v2931=v516+4;
+  int v2932=v471+5;
+  int v2933=v592+7;
+  int v2934=v231+9;
+  int v2935=v2686+3;
+  int v2936=v2658+6;
+  int v2937=v2193+9;
+  int v2938=v2771+2;
+  int v2939=v29+2;
+  int v2940=v1689+6;
+  int v2941=v1471+3;
+  int v2942=v407+8;
+  int v2943=v1546+5;
+  int v2944=v2222+8;
+  int v2945=v1667+4;
+  int v2946=v246+4;
+  int v2947=v2523+9;
+  int v2948=v1156+4;
+  int v2949=v1979+9;
+  int v2950=v2267+7;
+  int v2951=v2011+5;
+  int v2952=v1690+3;
+  int v2953=v1641+0;
+  int v2954=v1757+5;
+  int v2955=v823+8;
+  int v2956=v403+8;
+  int v2957=v1933+2;
+  int v2958=v44+0;
+  int v2959=v1446+7;
+  int v2960=v350+8;
+  int v2961=v2049+2;
+  int v2962=v2540+7;
+  int v2963=v2267+6;
+  int v2964=v887+9;
+  int v2965=v1514+6;
+  int v2966=v1778+6;
+  int v2967=v989+1;
+  int v2968=v2204+9;
+  int v2969=v2597+9;
+  int v2970=v423+2;
+  int v2971=v768+4;
+  int v2972=v501+3;
+  int v2973=v546+4;
+  int v2974=v2216+8;
+  int v2975=v1583+1;
+  int v2976=v1947+2;
+  int v2977=v222+1;
+  int v2978=v2922+9;
+  int v2979=v2034+3;
+  int v2980=v2083+6;
+  int v2981=v1171+3;
+  int v2982=v47+1;
+  int v2983=v1815+6;
+  int v2984=v1017+7;
+  int v2985=v305+9;
+  int v2986=v834+8;
+  int v2987=v1655+3;
+  int v2988=v1963+1;
+  int v2989=v1373+8;
+  int v2990=v511+5;
+  int v2991=v152+2;
+  int v2992=v2858+0;
+  int v2993=v168+0;
+  int v2994=v2742+9;
+  int v2995=v660+3;
+  int v2996=v2024+4;
+  int v2997=v257+0;
+  int v2998=v1306+9;
+  int v2999=v2062+7;
+  int v3000=v2519+0;
+  int v3001=v397+5;
+  int v3002=v392+0;
+  int v3003=v2337+6;
+  int v3004=v2846+0;
+  int v3005=v1608+8;
+  int v3006=v1866+6;
+  int v3007=v888+3;
+  int v3008=v2323+3;
+  int v3009=v2696+7;
+  int v3010=v304+0;
+  int v3011=v2379+9;
+  int v3012=v449+0;
+  int v3013=v2302+5;
+  int v3014=v1748+4;
+  int v3015=v1533+5;
+  int v3016=v670+5;
+  int v3017=v2315+2;
+  int v3018=v2613+4;
+  int v3019=v355+2;
+  int v3020=v2305+5;
+  int v3021=v698+8;
+  int v3022=v656+3;
+  int v3023=v1055+6;
+  int v3024=v195+0;
+  int v3025=v454+1;
+  int v3026=v2315+8;
+  int v3027=v777+1;
+  int v3028=v619+2;
+  int v3029=v2192+7;
+  int v3030=v23+9;
+  int v3031=v1131+2;
+  int v3032=v573+8;
+  int v3033=v1574+4;
+  int v3034=v1416+8;
+  int v3035=v273+0;
+  int v3036=v1163+3;
+  int v3037=v2809+2;
+  int v3038=v1813+5;
+  int v3039=v2036+0;
+  int v3040=v604+7;
+  int v3041=v1719+6;
+  int v3042=v417+0;
+  int v3043=v1172+0;
+  int v3044=v1876+9;
+  int v3045=v2821+6;
+  int v3046=v1824+7;
+  int v3047=v1020+2;
+  int v3048=v1346+8;
+  int v3049=v1043+5;
+  int v3050=v950+3;
+  int v3051=v172+8;
+  int v3052=v145+4;
+  int v3053=v2027+5;
+  int v3054=v1319+9;
+  int v3055=v1339+5;
+  int v3056=v745+9;
+  int v3057=v448+3;
+  int v3058=v1920+9;
+  int v3059=v1808+6;
+  int v3060=v742+2;
+  int v3061=v2702+9;
+  int v3062=v1572+7;
+  int v3063=v2058+5;
+  int v3064=v2273+0;
+  int v3065=v1939+1;
+  int v3066=v2361+9;
+  int v3067=v505+0;
+  int v3068=v1719+0;
+  int v3069=v2399+6;
+  int v3070=v1328+8;
+  int v3071=v1305+4;
+  int v3072=v346+9;
+  int v3073=v2944+3;
+  int v3074=v1312+9;
+  int v3075=v937+3;
+  int v3076=v3051+9;
+  int v3077=v2496+3;
+  int v3078=v2961+1;
+  int v3079=v95+6;
+  int v3080=v943+2;
+  int v3081=v74+0;
+  int v3082=v1767+5;
+  int v3083=v454+3;
+  int v3084=v517+1;
+  int v3085=v1182+1;
+  int v3086=v775+8;
+  int v3087=v1230+8;
+  int v3088=v1643+6;
+  int v3089=v1334+5;
+  int v3090=v2873+5;
+  int v3091=v450+5;
+  int v3092=v162+6;
+  int v3093=v708+9;
+  int v3094=v557+2;
+  int v3095=v818+5;
+  int v3096=v1986+4;
+  int v3097=v2680+4;
+  int v3098=v2547+6;
+  int v3099=v992+8;
+  int v3100=v2173+7;
+  int v3101=v3100+3;
+  int v3102=v1363+2;
+  int v3103=v533+6;
+  int v3104=v751+3;
+  int v3105=v393+3;
+  int v3106=v183+2;
+  int v3107=v2718+5;
+  int v3108=v324+6;
+  int v3109=v694+3;
+  int v3110=v793+4;
+  int v3111=v596+9;
+  int v3112=v2674+6;
+  int v3113=v1442+3;
+  int v3114=v1457+6;
+  int v3115=v391+1;
+  int v3116=v224+7;
+  int v3117=v49+4;
+  int v3118=v2461+6;
+  int v3119=v1172+8;
+  int v3120=v1286+8;
+  int v3121=v886+0;
+  int v3122=v1480+7;
+  int v3123=v1096+8;
+  int v3124=v1803+6;
+  int v3125=v2137+0;
+  int v3126=v229+2;
+  int v3127=v794+4;
+  int v3128=v1621+0;
+  int v3129=v45+6;
+  int v3130=v2397+7;
+  int v3131=v2659+8;
+  int v3132=v882+6;
+  int v3133=v2729+4;
+  int v3134=v1820+0;
+  int v3135=v723+3;
+  int v3136=v2778+8;
+  int v3137=v2849+1;
+  int v3138=v976+2;
+  int v3139=v1670+2;
+  int v3140=v220+2;
+  int v3141=v332+7;
+  int v3142=v1207+2;
+  int v3143=v1230+9;
+  int v3144=v497+7;
+  int v3145=v183+4;
+  int v3146=v2373+4;
+  int v3147=v2392+0;
+  int v3148=v972+2;
+  int v3149=v1577+7;
+  int v3150=v2297+0;
+  int v3151=v2533+4;
+  int v3152=v773+1;
+  int v3153=v2116+9;
+  int v3154=v2246+3;
+  int v3155=v812+1;
+  int v3156=v2028+3;
+  int v3157=v1711+8;
+  int v3158=v453+1;
+  int v3159=v2177+3;
+  int v3160=v717+9;
+  int v3161=v2223+2;
+  int v3162=v2205+1;
+  int v3163=v263+3;
+  int v3164=v1796+3;
+  int v3165=v2762+0;
+  int v3166=v2568+2;
+  int v3167=v1765+7;
+  int v3168=v155+6;
+  int v3169=v150+2;
+  int v3170=v2117+4;
+  int v3171=v1016+4;
+  int v3172=v2433+4;
+  int v3173=v369+8;
+  int v3174=v3095+3;
+  int v3175=v3085+6;
+  int v3176=v734+8;
+  int v3177=v1603+4;
+  int v3178=v2539+4;
+  int v3179=v1782+6;
+  int v3180=v1420+0;
+  int v3181=v2606+0;
+  int v3182=v2506+2;
+  int v3183=v366+5;
+  int v3184=v1746+9;
+  int v3185=v2217+7;
+  int v3186=v1141+4;
+  int v3187=v2190+4;
+  int v3188=v1927+0;
+  int v3189=v2668+4;
+  int v3190=v2487+8;
+  int v3191=v1850+5;
+  int v3192=v2038+3;
+  int v3193=v2096+5;
+  int v3194=v2823+3;
+  int v3195=v856+5;
+  int v3196=v2484+3;
+  int v3197=v1004+7;
+  int v3198=v2031+8;
+  int v3199=v2456+9;
+  int v3200=v1612+9;
+  int v3201=v2415+7;
+  int v3202=v1962+0;
+  int v3203=v465+0;
+  int v3204=v959+8;
+  int v3205=v1032+9;
+  int v3206=v803+8;
+  int v3207=v1219+3;
+  int v3208=v185+2;
+  int v3209=v2292+8;
+  int v3210=v1300+2;
+  int v3211=v107+4;
+  int v3212=v2610+2;
+  int v3213=v1722+6;
+  int v3214=v2448+4;
+  int v3215=v2944+0;
+  int v3216=v2643+0;
+  int v3217=v2338+4;
+  int v3218=v2056+9;
+  int v3219=v1709+3;
+  int v3220=v3119+4;
+  int v3221=v2415+2;
+  int v3222=v2630+5;
+  int v3223=v1631+3;
+  int v3224=v1957+6;
+  int v3225=v1659+8;
+  int v3226=v2820+5;
+  int v3227=v2009+0;
+  int v3228=v1000+0;
+  int v3229=v2660+2;
+  int v3230=v2485+4;
+  int v3231=v853+1;
+  int v3232=v874+4;
+  int v3233=v2248+9;
+  int v3234=v2816+2;
+  int v3235=v1990+6;
+  int v3236=v1504+8;
+  int v3237=v2620+3;
+  int v3238=v5+6;
+  int v3239=v1692+1;
+  int v3240=v1210+2;
+  int v3241=v2706+8;
+  int v3242=v603+4;
+  int v3243=v615+3;
+  int v3244=v974+7;
+  int v3245=v3073+6;
+  int v3246=v1729+6;
+  int v3247=v370+5;
+  int v3248=v3102+9;
+  int v3249=v1344+0;
+  int v3250=v3181+3;
+  int v3251=v450+8;
+  int v3252=v1329+2;
+  int v3253=v2147+8;
+  int v3254=v2952+3;
+  int v3255=v2581+0;
+  int v3256=v163+4;
+  int v3257=v3059+3;
+  int v3258=v1550+0;
+  int v3259=v2349+5;
+  int v3260=v759+2;
+  int v3261=v1718+5;
+  int v3262=v513+9;
+  int v3263=v2230+1;
+  int v3264=v1931+5;
+  int v3265=v1425+4;
+  int v3266=v656+5;
+  int v3267=v92+6;
+  int v3268=v525+4;
+  int v3269=v2416+3;
+  int v3270=v227+2;
+  int v3271=v53+3;
+  int v3272=v2438+0;
+  int v3273=v1368+6;
+  int v3274=v2998+5;
+  int v3275=v2441+7;
+  int v3276=v2966+5;
+  int v3277=v1238+3;
+  int v3278=v118+2;
+  int v3279=v372+3;
+  int v3280=v695+0;
+  int v3281=v991+5;
+  int v3282=v308+7;
+  int v3283=v1954+3;
+  int v3284=v1865+0;
+  int v3285=v1066+9;
+  int v3286=v3008+2;
+  int v3287=v1060+1;
+  int v3288=v2762+6;
+  int v3289=v3054+5;
+  int v3290=v296+9;
+  int v3291=v2442+7;
+  int v3292=v3111+2;
+  int v3293=v937+3;
+  int v3294=v934+5;
+  int v3295=v26+1;
+  int v3296=v776+7;
+  int v3297=v10+4;
+  int v3298=v2333+8;
+  int v3299=v1630+0;
+  int v3300=v2549+8;
+  int v3301=v192+6;
+  int v3302=v617+5;
+  int v3303=v2748+3;
+  int v3304=v608+1;
+  int v3305=v1043+5;
+  int v3306=v574+5;
+  int v3307=v2938+3;
+  int v3308=v1779+9;
+  int v3309=v2998+6;
+  int v3310=v314+7;
+  int v3311=v1467+5;
+  int v3312=v2608+9;
+  int v3313=v1316+0;
+  int v3314=v2916+7;
+  int v3315=v999+4;
+  int v3316=v1101+6;
+  int v3317=v1691+2;
+  int v3318=v1375+9;
+  int v3319=v1585+3;
+  int v3320=v2180+9;
+  int v3321=v1468+8;
+  int v3322=v1150+0;
+  int v3323=v390+3;
+  int v3324=v2485+3;
+  int v3325=v1256+1;
+  int v3326=v2768+3;
+  int v3327=v2291+1;
+  int v3328=v2132+3;
+  int v3329=v2918+4;
+  int v3330=v472+2;
+  int v3331=v2302+8;
+  int v3332=v1420+8;
+  int v3333=v1073+3;
+  int v3334=v753+2;
+  int v3335=v99+7;
+  int v3336=v3121+3;
+  int v3337=v1902+7;
+  int v3338=v1397+6;
+  int v3339=v2936+8;
+  int v3340=v1951+0;
+  int v3341=v2577+6;
+  int v3342=v2112+6;
+  int v3343=v375+5;
+  int v3344=v1271+4;
+  int v3345=v120+6;
+  int v3346=v1970+8;
+  int v3347=v987+7;
+  int v3348=v1801+8;
+  int v3349=v1973+5;
+  int v3350=v1037+0;
+  int v3351=v3317+9;
+  int v3352=v2819+2;
+  int v3353=v603+5;
+  int v3354=v15+7;
+  int v3355=v598+4;
+  int v3356=v1821+2;
+  int v3357=v1686+4;
+  int v3358=v1024+2;
+  int v3359=v1906+4;
+  int v3360=v1603+0;
+  int v3361=v122+6;
+  int v3362=v622+6;
+  int v3363=v147+7;
+  int v3364=v2382+5;
+  int v3365=v531+5;
+  int v3366=v247+0;
+  int v3367=v952+0;
+  int v3368=v1033+9;
+  int v3369=v1497+8;
+  int v3370=v2585+1;
+  int v3371=v2411+3;
+  int v3372=v2162+5;
+  int v3373=v1051+8;
+  int v3374=v234+8;
+  int v3375=v611+5;
+  int v3376=v3069+7;
+  int v3377=v2593+3;
+  int v3378=v824+0;
+  int v3379=v2842+1;
+  int v3380=v1982+8;
+  int v3381=v1158+2;
+  int v3382=v2496+3;
+  int v3383=v231+5;
+  int v3384=v693+1;
+  int v3385=v2917+9;
+  int v3386=v33+5;
+  int v3387=v3059+8;
+  int v3388=v3028+7;
+  int v3389=v1710+1;
+  int v3390=v294+8;
+  int v3391=v1658+0;
+  int v3392=v1029+5;
+  int v3393=v1260+5;
+  int v3394=v656+8;
+  int v3395=v2796+0;
+  int v3396=v3267+2;
+  int v3397=v1854+0;
+  int v3398=v3256+2;
+  int v3399=v1467+4;
+  int v3400=v1502+3;
+  int v3401=v2917+5;
+  int v3402=v818+4;
+  int v3403=v473+2;
+  int v3404=v1382+3;
+  int v3405=v1592+5;
+  int v3406=v3294+3;
+  int v3407=v2007+6;
+  int v3408=v411+3;
+  int v3409=v2145+8;
+  int v3410=v2488+0;
+  int v3411=v1794+2;
+  int v3412=v2794+9;
+  int v3413=v1002+9;
+  int v3414=v343+7;
+  int v3415=v3053+5;
+  int v3416=v799+0;
+  int v3417=v1980+5;
+  int v3418=v488+8;
+  int v3419=v505+3;
+  int v3420=v1994+6;
+  int v3421=v1619+1;
+  int v3422=v446+4;
+  int v3423=v591+4;
+  int v3424=v3210+3;
+  int v3425=v2660+4;
+  int v3426=v348+0;
+  int v3427=v1911+3;
+  int v3428=v3351+2;
+  int v3429=v957+6;
+  int v3430=v1476+9;
+  int v3431=v322+7;
+  int v3432=v1530+0;
+  int v3433=v2880+2;
+  int v3434=v3100+1;
+  int v3435=v2021+7;
+  int v3436=v1253+5;
+  int v3437=v2809+6;
+  int v3438=v1465+3;
+  int v3439=v2214+5;
+  int v3440=v2910+8;
+  int v3441=v3300+4;
+  int v3442=v1521+2;
+  int v3443=v3296+4;
+  int v3444=v2553+8;
+  int v3445=v2324+0;
+  int v3446=v2190+0;
+  int v3447=v2906+1;
+  int v3448=v2314+0;
+  int v3449=v119+6;
+  int v3450=v499+8;
+  int v3451=v2777+0;
+  int v3452=v3312+9;
+  int v3453=v3280+9;
+  int v3454=v3093+2;
+  int v3455=v3149+2;
+  int v3456=v2783+7;
+  int v3457=v1610+9;
+  int v3458=v967+3;
+  int v3459=v2652+5;
+  int v3460=v851+6;
+  int v3461=v1299+4;
+  int v3462=v2118+9;
+  int v3463=v131+8;
+  int v3464=v680+0;
+  int v3465=v2656+6;
+  int v3466=v581+1;
+  int v3467=v2322+3;
+  int v3468=v2522+3;
+  int v3469=v3085+5;
+  int v3470=v167+0;
+  int v3471=v1088+8;
+  int v3472=v1356+3;
+  int v3473=v530+7;
+  int v3474=v1598+3;
+  int v3475=v2365+8;
+  int v3476=v1865+8;
+  int v3477=v1136+1;
+  int v3478=v1020+8;
+  int v3479=v2264+8;
+  int v3480=v537+8;
+  int v3481=v2720+4;
+  int v3482=v3340+4;
+  int v3483=v1514+7;
+  int v3484=v2807+7;
+  int v3485=v1007+1;
+  int v3486=v1399+7;
+  int v3487=v1683+4;
+  int v3488=v656+5;
+  int v3489=v222+1;
+  int v3490=v718+8;
+  int v3491=v53+3;
+  int v3492=v2458+9;
+  int v3493=v1799+1;
+  int v3494=v2569+7;
+  int v3495=v385+2;
+  int v3496=v2401+4;
+  int v3497=v1617+3;
+  int v3498=v1584+7;
+  int v3499=v2396+3;
+  int v3500=v1073+8;
+  int v3501=v1573+7;
+  int v3502=v2862+3;
+  int v3503=v822+1;
+  int v3504=v1165+2;
+  int v3505=v689+2;
+  int v3506=v2537+0;
+  int v3507=v336+9;
+  int v3508=v2463+3;
+  int v3509=v2917+6;
+  int v3510=v3176+5;
+  int v3511=v2687+5;
+  int v3512=v905+2;
+  int v3513=v568+8;
+  int v3514=v2345+0;
+  int v3515=v997+9;
+  int v3516=v1709+2;
+  int v3517=v347+6;
+  int v3518=v1039+7;
+  int v3519=v2204+4;
+  int v3520=v2374+3;
+  int v3521=v1740+5;
+  int v3522=v1183+6;
+  int v3523=v198+4;
+  int v3524=v290+6;
+  int v3525=v1342+1;
+  int v3526=v3240+0;
+  int v3527=v1608+2;
+  int v3528=v1753+8;
+  int v3529=v2549+9;
+  int v3530=v956+1;
+  int v3531=v261+4;
+  int v3532=v2841+9;
+  int v3533=v1677+1;
+  int v3534=v1041+1;
+  int v3535=v2821+1;
+  int v3536=v3285+7;
+  int v3537=v3138+3;
+  int v3538=v2725+9;
+  int v3539=v384+4;
+  int v3540=v6+3;
+  int v3541=v398+1;
+  int v3542=v2696+3;
+  int v3543=v380+2;
+  int v3544=v2417+5;
+  int v3545=v1286+3;
+  int v3546=v944+3;
+  int v3547=v1567+6;
+  int v3548=v710+1;
+  int v3549=v236+6;
+  int v3550=v3162+3;
+  int v3551=v1798+9;
+  int v3552=v3304+9;
+  int v3553=v2834+8;
+  int v3554=v1707+3;
+  int v3555=v3356+6;
+  int v3556=v2795+6;
+  int v3557=v882+3;
+  int v3558=v3026+7;
+  int v3559=v3352+9;
+  int v3560=v2437+3;
+  int v3561=v2655+8;
+  int v3562=v669+9;
+  int v3563=v2172+5;
+  int v3564=v2388+2;
+  int v3565=v60+6;
+  int v3566=v1421+9;
+  int v3567=v2531+0;
+  int v3568=v1543+2;
+  int v3569=v1729+7;
+  int v3570=v811+9;
+  int v3571=v823+2;
+  int v3572=v2665+9;
+  int v3573=v1918+6;
+  int v3574=v1786+4;
+  int v3575=v3042+8;
+  int v3576=v900+2;
+  int v3577=v2452+3;
+  int v3578=v1707+6;
+  int v3579=v523+7;
+  int v3580=v3279+8;
+  int v3581=v2106+1;
+  int v3582=v2629+3;
+  int v3583=v1271+6;
+  int v3584=v2942+4;
+  int v3585=v802+2;
+  int v3586=v1309+3;
+  int v3587=v2758+2;
+  int v3588=v3498+0;
+  int v3589=v1796+9;
+  int v3590=v2605+8;
+  int v3591=v2478+3;
+  int v3592=v1207+2;
+  int v3593=v1354+7;
+  int v3594=v3268+5;
+  int v3595=v2675+1;
+  int v3596=v661+1;
+  int v3597=v1399+5;
+  int v3598=v84+0;
+  int v3599=v3096+8;
+  int v3600=v1460+3;
+  int v3601=v1395+4;
+  int v3602=v344+8;
+  int v3603=v2184+5;
+  int v3604=v2497+6;
+  int v3605=v2165+9;
+  int v3606=v2577+3;
+  int v3607=v2588+0;
+  int v3608=v1026+4;
+  int v3609=v3529+6;
+  int v3610=v1773+6;
+  int v3611=v3230+9;
+  int v3612=v355+6;
+  int v3613=v2054+2;
+  int v3614=v1766+0;
+  int v3615=v2299+3;
+  int v3616=v1481+3;
+  int v3617=v2419+3;
+  int v3618=v3586+3;
+  int v3619=v970+4;
+  int v3620=v2428+2;
+  int v3621=v2546+9;
+  int v3622=v2260+0;
+  int v3623=v2058+0;
+  int v3624=v705+5;
+  int v3625=v1367+4;
+  int v3626=v1077+8;
+  int v3627=v2902+9;
+  int v3628=v742+5;
+  int v3629=v2345+7;
+  int v3630=v2741+1;
+  int v3631=v2731+7;
+  int v3632=v26+4;
+  int v3633=v589+3;
+  int v3634=v862+5;
+  int v3635=v766+5;
+  int v3636=v535+5;
+  int v3637=v1175+4;
+  int v3638=v42+8;
+  int v3639=v1908+0;
+  int v3640=v1300+8;
+  int v3641=v1666+6;
+  int v3642=v2372+3;
+  int v3643=v1953+0;
+  int v3644=v574+5;
+  int v3645=v3560+7;
+  int v3646=v261+5;
+  int v3647=v1092+7;
+  int v3648=v3373+1;
+  int v3649=v1789+9;
+  int v3650=v2409+6;
+  int v3651=v1749+1;
+  int v3652=v2038+3;
+  int v3653=v3138+3;
+  int v3654=v3311+7;
+  int v3655=v2765+5;
+  int v3656=v2856+0;
+  int v3657=v640+5;
+  int v3658=v2668+5;
+  int v3659=v1911+7;
+  int v3660=v2685+3;
+  int v3661=v1425+6;
+  int v3662=v924+3;
+  int v3663=v836+6;
+  int v3664=v3399+6;
+  int v3665=v1884+4;
+  int v3666=v1114+1;
+  int v3667=v361+4;
+  int v3668=v1300+8;
+  int v3669=v3040+0;
+  int v3670=v3454+4;
+  int v3671=v1181+2;
+  int v3672=v2990+4;
+  int v3673=v3635+1;
+  int v3674=v981+1;
+  int v3675=v2384+0;
+  int v3676=v2553+2;
+  int v3677=v3390+1;
+  int v3678=v1644+9;
+  int v3679=v1677+1;
+  int v3680=v266+1;
+  int v3681=v2047+8;
+  int v3682=v2986+6;
+  int v3683=v3518+7;
+  int v3684=v85+2;
+  int v3685=v1467+0;
+  int v3686=v546+2;
+  int v3687=v363+7;
+  int v3688=v2049+7;
+  int v3689=v2367+8;
+  int v3690=v313+5;
+  int v3691=v461+5;
+  int v3692=v2881+0;
+  int v3693=v1130+0;
+  int v3694=v2753+7;
+  int v3695=v1943+7;
+  int v3696=v2311+7;
+  int v3697=v2558+6;
+  int v3698=v538+0;
+  int v3699=v680+4;
+  int v3700=v3367+2;
+  int v3701=v3470+5;
+  int v3702=v2465+1;
+  int v3703=v769+1;
+  int v3704=v2726+6;
+  int v3705=v2462+6;
+  int v3706=v2934+9;
+  int v3707=v1464+9;
+  int v3708=v3520+8;
+  int v3709=v285+8;
+  int v3710=v1794+5;
+  int v3711=v3453+1;
+  int v3712=v2653+0;
+  int v3713=v3018+1;
+  int v3714=v3681+3;
+  int v3715=v211+1;
+  int v3716=v3338+3;
+  int v3717=v3047+3;
+  int v3718=v2354+5;
+  int v3719=v3603+3;
+  int v3720=v3558+3;
+  int v3721=v326+0;
+  int v3722=v828+7;
+  int v3723=v2747+5;
+  int v3724=v90+0;
+  int v3725=v169+3;
+  int v3726=v288+3;
+  int v3727=v1934+7;
+  int v3728=v817+0;
+  int v3729=v2363+0;
+  int v3730=v1786+2;
+  int v3731=v355+7;
+  int v3732=v379+5;
+  int v3733=v3505+8;
+  int v3734=v3395+2;
+  int v3735=v1851+4;
+  int v3736=v2412+8;
+  int v3737=v2196+4;
+  int v3738=v3381+1;
+  int v3739=v1199+3;
+  int v3740=v2040+3;
+  int v3741=v382+9;
+  int v3742=v136+2;
+  int v3743=v3617+7;
+  int v3744=v740+3;
+  int v3745=v1270+2;
+  int v3746=v2513+7;
+  int v3747=v2296+1;
+  int v3748=v3695+8;
+  int v3749=v640+8;
+  int v3750=v635+3;
+  int v3751=v137+6;
+  int v3752=v3114+2;
+  int v3753=v2154+6;
+  int v3754=v1176+0;
+  int v3755=v2148+0;
+  int v3756=v729+8;
+  int v3757=v2477+9;
+  int v3758=v2093+2;
+  int v3759=v2484+1;
+  int v3760=v1982+4;
+  int v3761=v1506+3;
+  int v3762=v46+7;
+  int v3763=v2423+7;
+  int v3764=v1981+4;
+  int v3765=v2992+8;
+  int v3766=v2420+7;
+  int v3767=v2654+9;
+  int v3768=v2401+3;
+  int v3769=v1946+0;
+  int v3770=v995+7;
+  int v3771=v2029+4;
+  int v3772=v2899+0;
+  int v3773=v3669+7;
+  int v3774=v1625+9;
+  int v3775=v3012+5;
+  int v3776=v313+5;
+  int v3777=v2022+7;
+  int v3778=v35+6;
+  int v3779=v70+5;
+  int v3780=v3382+7;
+  int v3781=v3321+5;
+  int v3782=v3281+0;
+  int v3783=v2807+2;
+  int v3784=v1387+4;
+  int v3785=v3200+7;
+  int v3786=v720+8;
+  int v3787=v2391+2;
+  int v3788=v2319+4;
+  int v3789=v277+0;
+  int v3790=v88+2;
+  int v3791=v1596+8;
+  int v3792=v436+1;
+  int v3793=v2493+1;
+  int v3794=v2277+1;
+  int v3795=v1118+1;
+  int v3796=v2846+3;
+  int v3797=v125+3;
+  int v3798=v1587+4;
+  int v3799=v243+2;
+  int v3800=v123+4;
+  int v3801=v1235+4;
+  int v3802=v1067+0;
+  int v3803=v1+7;
+  int v3804=v2698+6;
+  int v3805=v50+5;
+  int v3806=v927+2;
+  int v3807=v3757+0;
+  int v3808=v2420+5;
+  int v3809=v1684+1;
+  int v3810=v474+0;
+  int v3811=v3698+2;
+  int v3812=v380+2;
+  int v3813=v2128+1;
+  int v3814=v2459+2;
+  int v3815=v1281+7;
+  int v3816=v1110+6;
+  int v3817=v77+3;
+  int v3818=v1364+2;
+  int v3819=v2079+7;
+  int v3820=v922+0;
+  int v3821=v940+6;
+  int v3822=v3091+7;
+  int v3823=v2923+7;
+  int v3824=v1078+8;
+  int v3825=v1936+6;
+  int v3826=v1642+6;
+  int v3827=v2533+8;
+  int v3828=v1582+7;
+  int v3829=v3466+3;
+  int v3830=v3252+6;
+  int v3831=v333+9;
+  int v3832=v2733+1;
+  int v3833=v1106+5;
+  int v3834=v319+8;
+  int v3835=v3767+8;
+  int v3836=v2825+3;
+  int v3837=v3255+8;
+  int v3838=v1440+6;
+  int v3839=v2685+7;
+  int v3840=v1997+0;
+  int v3841=v2128+9;
+  int v3842=v765+5;
+  int v3843=v2962+8;
+  int v3844=v39+5;
+  int v3845=v3085+9;
+  int v3846=v3688+2;
+  int v3847=v2628+5;
+  int v3848=v3791+0;
+  int v3849=v3631+3;
+  int v3850=v1430+8;
+  int v3851=v1172+5;
+  int v3852=v1750+2;
+  int v3853=v3376+3;
+  int v3854=v3153+1;
+  int v3855=v2103+1;
+  int v3856=v2279+5;
+  int v3857=v520+8;
+  int v3858=v1527+3;
+  int v3859=v3845+2;
+  int v3860=v481+9;
+  int v3861=v1753+8;
+  int v3862=v3833+4;
+  int v3863=v1466+0;
+  int v3864=v2740+9;
+  int v3865=v1386+0;
+  int v3866=v327+5;
+  int v3867=v1407+1;
+  int v3868=v433+3;
+  int v3869=v3819+0;
+  int v3870=v767+9;
+  int v3871=v644+0;
+  int v3872=v3864+3;
+  int v3873=v385+7;
+  int v3874=v1208+7;
+  int v3875=v2517+8;
+  int v3876=v2400+6;
+  int v3877=v2084+8;
+  int v3878=v2657+8;
+  int v3879=v88+5;
+  int v3880=v2550+2;
+  int v3881=v3719+2;
+  int v3882=v3321+8;
+  int v3883=v199+8;
+  int v3884=v82+2;
+  int v3885=v1920+4;
+  int v3886=v1992+6;
+  int v3887=v1601+4;
+  int v3888=v1685+1;
+  int v3889=v196+7;
+  int v3890=v2622+3;
+  int v3891=v332+1;
+  int v3892=v1483+2;
+  int v3893=v2015+5;
+  int v3894=v3764+1;
+  int v3895=v330+6;
+  int v3896=v3830+3;
+  int v3897=v3609+3;
+  int v3898=v3120+7;
+  int v3899=v1100+1;
+  int v3900=v3714+4;
+  int v3901=v3018+3;
+  int v3902=v3490+3;
+  int v3903=v1764+8;
+  int v3904=v456+4;
+  int v3905=v547+6;
+  int v3906=v1584+7;
+  int v3907=v1198+0;
+  int v3908=v2295+3;
+  int v3909=v240+9;
+  int v3910=v2052+7;
+  int v3911=v1207+4;
+  int v3912=v309+5;
+  int v3913=v603+2;
+  int v3914=v3759+3;
+  int v3915=v3441+7;
+  int v3916=v1718+0;
+  int v3917=v2640+3;
+  int v3918=v2330+1;
+  int v3919=v1323+3;
+  int v3920=v1711+0;
+  int v3921=v1527+3;
+  int v3922=v2834+8;
+  int v3923=v3453+5;
+  int v3924=v3386+7;
+  int v3925=v1863+4;
+  int v3926=v1017+5;
+  int v3927=v2464+1;
+  int v3928=v3843+6;
+  int v3929=v2115+3;
+  int v3930=v3213+5;
+  int v3931=v2359+1;
+  int v3932=v558+9;
+  int v3933=v2292+0;
+  int v3934=v19+7;
+  int v3935=v92+1;
+  int v3936=v1263+1;
+  int v3937=v3041+6;
+  int v3938=v2338+7;
+  int v3939=v2843+6;
+  int v3940=v24+7;
+  int v3941=v3298+8;
+  int v3942=v3652+9;
+  int v3943=v78+6;
+  int v3944=v1175+6;
+  int v3945=v2984+8;
+  int v3946=v1724+1;
+  int v3947=v3107+0;
+  int v3948=v1713+4;
+  int v3949=v843+7;
+  int v3950=v1038+7;
+  int v3951=v2598+1;
+  int v3952=v706+6;
+  int v3953=v3051+0;
+  int v3954=v2968+3;
+  int v3955=v66+3;
+  int v3956=v121+3;
+  int v3957=v1604+4;
+  int v3958=v3455+4;
+  int v3959=v2737+4;
+  int v3960=v3679+9;
+  int v3961=v1118+0;
+  int v3962=v331+5;
+  int v3963=v981+3;
+  int v3964=v971+2;
+  int v3965=v1562+0;
+  int v3966=v2575+2;
+  int v3967=v715+7;
+  int v3968=v828+6;
+  int v3969=v2452+3;
+  int v3970=v3616+0;
+  int v3971=v2535+4;
+  int v3972=v2728+6;
+  int v3973=v853+0;
+  int v3974=v2435+2;
+  int v3975=v1044+6;
+  int v3976=v913+6;
+  int v3977=v1733+9;
+  int v3978=v1178+7;
+  int v3979=v654+9;
+  int v3980=v2656+6;
+  int v3981=v2984+6;
+  int v3982=v3447+9;
+  int v3983=v1824+7;
+  int v3984=v3591+5;
+  int v3985=v1347+3;
+  int v3986=v2845+3;
+  int v3987=v2904+9;
+  int v3988=v3228+3;
+  int v3989=v527+5;
+  int v3990=v3951+5;
+  int v3991=v2041+8;
+  int v3992=v2726+0;
+  int v3993=v1215+1;
+  int v3994=v3379+2;
+  int v3995=v2813+4;
+  int v3996=v2112+3;
+  int v3997=v2227+7;
+  int v3998=v1021+0;
+  int v3999=v888+4;
+  int v4000=v1628+0;
+  int v4001=v3382+2;
+  int v4002=v2815+6;
+  int v4003=v606+1;
+  int v4004=v3662+6;
+  int v4005=v2329+8;
+  int v4006=v747+0;
+  int v4007=v1636+9;
+  int v4008=v3326+2;
+  int v4009=v2273+8;
+  int v4010=v1421+7;
+  int v4011=v3603+5;
+  int v4012=v1558+5;
+  int v4013=v3920+5;
+  int v4014=v3777+4;
+  int v4015=v746+6;
+  int v4016=v2248+3;
+  int v4017=v2940+4;
+  int v4018=v3479+4;
+  int v4019=v331+4;
+  int v4020=v323+8;
+  int v4021=v3406+4;
+  int v4022=v1500+2;
+  int v4023=v1543+7;
+  int v4024=v3591+6;
+  int v4025=v1377+5;
+  int v4026=v274+5;
+  int v4027=v2543+4;
+  int v4028=v1610+8;
+  int v4029=v3914+5;
+  int v4030=v1288+8;
+  int v4031=v2376+4;
+  int v4032=v1370+9;
+  int v4033=v1370+2;
+  int v4034=v3759+7;
+  int v4035=v3527+8;
+  int v4036=v2648+2;
+  int v4037=v1291+9;
+  int v4038=v3190+0;
+  int v4039=v251+7;
+  int v4040=v1652+3;
+  int v4041=v2137+4;
+  int v4042=v1276+4;
+  int v4043=v3953+2;
+  int v4044=v43+5;
+  int v4045=v2459+8;
+  int v4046=v2328+6;
+  int v4047=v2172+8;
+  int v4048=v1482+8;
+  int v4049=v1082+1;
+  int v4050=v1090+9;
+  int v4051=v2128+7;
+  int v4052=v2616+1;
+  int v4053=v2624+2;
+  int v4054=v956+5;
+  int v4055=v1840+8;
+  int v4056=v20+0;
+  int v4057=v3955+7;
+  int v4058=v3124+6;
+  int v4059=v3137+0;
+  int v4060=v2562+7;
+  int v4061=v2141+6;
+  int v4062=v1904+8;
+  int v4063=v1043+6;
+  int v4064=v1985+9;
+  int v4065=v3256+0;
+  int v4066=v794+6;
+  int v4067=v3636+3;
+  int v4068=v2018+0;
+  int v4069=v1422+9;
+  int v4070=v3636+9;
+  int v4071=v458+4;
+  int v4072=v3739+2;
+  int v4073=v1006+4;
+  int v4074=v1333+7;
+  int v4075=v928+6;
+  int v4076=v3676+1;
+  int v4077=v3113+2;
+  int v4078=v899+3;
+  int v4079=v1930+8;
+  int v4080=v195+8;
+  int v4081=v3545+7;
+  int v4082=v3642+2;
+  int v4083=v3356+0;
+  int v4084=v508+9;
+  int v4085=v1778+6;
+  int v4086=v1336+6;
+  int v4087=v2094+7;
+  int v4088=v840+8;
+  int v4089=v607+4;
+  int v4090=v1936+2;
+  int v4091=v1954+3;
+  int v4092=v580+8;
+  int v4093=v3205+2;
+  int v4094=v1246+3;
+  int v4095=v3048+7;
+  int v4096=v3128+3;
+  int v4097=v3566+6;
+  int v4098=v3265+6;
+  int v4099=v1303+4;
+  int v4100=v3221+9;
+  int v4101=v1166+2;
+  int v4102=v3890+6;
+  int v4103=v3614+5;
+  int v4104=v679+8;
+  int v4105=v322+4;
+  int v4106=v2213+3;
+  int v4107=v2693+6;
+  int v4108=v2493+4;
+  int v4109=v2967+5;
+  int v4110=v1554+7;
+  int v4111=v1445+0;
+  int v4112=v3702+7;
+  int v4113=v3975+0;
+  int v4114=v213+1;
+  int v4115=v639+3;
+  int v4116=v1447+8;
+  int v4117=v1449+3;
+  int v4118=v2697+7;
+  int v4119=v2410+8;
+  int v4120=v1919+8;
+  int v4121=v3361+8;
+  int v4122=v12+9;
+  int v4123=v209+3;
+  int v4124=v1787+8;
+  int v4125=v492+9;
+  int v4126=v1966+0;
+  int v4127=v75+3;
+  int v4128=v2886+2;
+  int v4129=v1682+1;
+  int v4130=v1420+5;
+  int v4131=v870+6;
+  int v4132=v609+9;
+  int v4133=v1588+6;
+  int v4134=v2742+0;
+  int v4135=v230+6;
+  int v4136=v3169+4;
+  int v4137=v3822+8;
+  int v4138=v141+9;
+  int v4139=v3313+1;
+  int v4140=v2582+7;
+  int v4141=v249+4;
+  int v4142=v1897+2;
+  int v4143=v225+9;
+  int v4144=v2642+9;
+  int v4145=v2021+9;
+  int v4146=v4127+0;
+  int v4147=v1680+8;
+  int v4148=v553+7;
+  int v4149=v2904+0;
+  int v4150=v88+5;
+  int v4151=v965+8;
+  int v4152=v362+8;
+  int v4153=v1370+2;
+  int v4154=v2044+9;
+  int v4155=v536+0;
+  int v4156=v1276+6;
+  int v4157=v846+4;
+  int v4158=v2636+3;
+  int v4159=v304+2;
+  int v4160=v653+5;
+  int v4161=v2464+0;
+  int v4162=v639+7;
+  int v4163=v3235+8;
+  int v4164=v2701+5;
+  int v4165=v3290+7;
+  int v4166=v2035+3;
+  int v4167=v292+2;
+  int v4168=v2131+4;
+  int v4169=v3864+5;
+  int v4170=v3657+4;
+  int v4171=v3526+5;
+  int v4172=v428+8;
+  int v4173=v1093+8;
+  int v4174=v2943+9;
+  int v4175=v1434+6;
+  int v4176=v713+7;
+  int v4177=v886+0;
+  int v4178=v3368+8;
+  int v4179=v547+7;
+  int v4180=v1245+8;
+  int v4181=v2571+5;
+  int v4182=v2630+8;
+  int v4183=v3113+7;
+  int v4184=v2570+5;
+  int v4185=v350+2;
+  int v4186=v89+4;
+  int v4187=v2626+0;
+  int v4188=v2796+1;
+  int v4189=v2798+1;
+  int v4190=v3929+3;
+  int v4191=v1285+9;
+  int v4192=v3249+3;
+  int v4193=v727+6;
+  int v4194=v1628+5;
+  int v4195=v3869+3;
+  int v4196=v3244+5;
+  int v4197=v2848+4;
+  int v4198=v327+7;
+  int v4199=v3241+7;
+  int v4200=v2116+6;
+  int v4201=v2631+9;
+  int v4202=v822+7;
+  int v4203=v2507+0;
+  int v4204=v1112+5;
+  int v4205=v925+7;
+  int v4206=v661+8;
+  int v4207=v3510+1;
+  int v4208=v998+0;
+  int v4209=v509+9;
+  int v4210=v2791+4;
+  int v4211=v1660+7;
+  int v4212=v4008+4;
+  int v4213=v793+5;
+  int v4214=v1722+8;
+  int v4215=v2083+8;
+  int v4216=v2012+4;
+  int v4217=v188+5;
+  int v4218=v2248+6;
+  int v4219=v3411+0;
+  int v4220=v2562+9;
+  int v4221=v2145+5;
+  int v4222=v2910+7;
+  int v4223=v1099+4;
+  int v4224=v2290+6;
+  int v4225=v2914+6;
+  int v4226=v172+3;
+  int v4227=v495+0;
+  int v4228=v2125+8;
+  int v4229=v4167+1;
+  int v4230=v1560+8;
+  int v4231=v1767+8;
+  int v4232=v1455+0;
+  int v4233=v3818+1;
+  int v4234=v590+0;
+  int v4235=v4081+9;
+  int v4236=v82+2;
+  int v4237=v12+4;
+  int v4238=v353+6;
+  int v4239=v985+5;
+  int v4240=v805+6;
+  int v4241=v114+3;
+  int v4242=v3666+2;
+  int v4243=v3114+4;
+  int v4244=v2338+4;
+  int v4245=v2418+6;
+  int v4246=v844+7;
+  int v4247=v319+8;
+  int v4248=v2484+7;
+  int v4249=v647+2;
+  int v4250=v2524+9;
+  int v4251=v4122+0;
+  int v4252=v3039+1;
+  int v4253=v2862+3;
+  int v4254=v889+9;
+  int v4255=v881+2;
+  int v4256=v3853+9;
+  int v4257=v1964+4;
+  int v4258=v1254+1;
+  int v4259=v2133+1;
+  int v4260=v565+0;
+  int v4261=v1503+3;
+  int v4262=v3759+1;
+  int v4263=v1484+5;
+  int v4264=v4105+1;
+  int v4265=v1397+7;
+  int v4266=v2897+2;
+  int v4267=v2298+4;
+  int v4268=v1896+2;
+  int v4269=v2486+3;
+  int v4270=v427+0;
+  int v4271=v2376+0;
+  int v4272=v3248+5;
+  int v4273=v372+1;
+  int v4274=v828+4;
+  int v4275=v673+8;
+  int v4276=v4172+4;
+  int v4277=v589+5;
+  int v4278=v1449+3;
+  int v4279=v891+9;
+  int v4280=v763+5;
+  int v4281=v3462+4;
+  int v4282=v2565+7;
+  int v4283=v2803+2;
+  int v4284=v3413+1;
+  int v4285=v1118+2;
+  int v4286=v2005+1;
+  int v4287=v376+8;
+  int v4288=v1056+2;
+  int v4289=v3605+4;
+  int v4290=v57+9;
+  int v4291=v445+3;
+  int v4292=v1449+0;
+  int v4293=v1672+5;
+  int v4294=v3399+1;
+  int v4295=v1542+0;
+  int v4296=v3026+5;
+  int v4297=v808+1;
+  int v4298=v2053+4;
+  int v4299=v2717+9;
+  int v4300=v3371+5;
+  int v4301=v1991+7;
+  int v4302=v2022+2;
+  int v4303=v935+8;
+  int v4304=v1293+3;
+  int v4305=v2456+0;
+  int v4306=v790+8;
+  int v4307=v3987+0;
+  int v4308=v3443+8;
+  int v4309=v3724+3;
+  int v4310=v3146+5;
+  int v4311=v736+5;
+  int v4312=v2963+9;
+  int v4313=v2832+0;
+  int v4314=v3202+2;
+  int v4315=v1799+3;
+  int v4316=v1871+4;
+  int v4317=v1676+7;
+  int v4318=v4142+9;
+  int v4319=v2280+1;
+  int v4320=v2150+0;
+  int v4321=v3947+9;
+  int v4322=v873+0;
+  int v4323=v232+6;
+  int v4324=v1820+7;
+  int v4325=v2061+5;
+  int v4326=v2119+5;
+  int v4327=v151+5;
+  int v4328=v906+0;
+  int v4329=v1993+4;
+  int v4330=v1260+2;
+  int v4331=v2818+5;
+  int v4332=v1435+5;
+  int v4333=v2893+8;
+  int v4334=v4328+3;
+  int v4335=v3606+7;
+  int v4336=v2196+4;
+  int v4337=v3340+8;
+  int v4338=v3436+3;
+  int v4339=v2932+2;
+  int v4340=v4071+2;
+  int v4341=v1497+0;
+  int v4342=v4304+8;
+  int v4343=v1876+4;
+  int v4344=v289+5;
+  int v4345=v4173+1;
+  int v4346=v1112+6;
+  int v4347=v3959+5;
+  int v4348=v4271+5;
+  int v4349=v1475+2;
+  int v4350=v2778+5;
+  int v4351=v974+1;
+  int v4352=v1462+6;
+  int v4353=v166+8;
+  int v4354=v4285+3;
+  int v4355=v1870+2;
+  int v4356=v245+0;
+  int v4357=v3361+6;
+  int v4358=v2219+0;
+  int v4359=v1981+0;
+  int v4360=v4085+5;
+  int v4361=v2585+7;
+  int v4362=v2487+6;
+  int v4363=v642+1;
+  int v4364=v355+4;
+  int v4365=v4114+2;
+  int v4366=v126+5;
+  int v4367=v363+8;
+  int v4368=v872+0;
+  int v4369=v2914+0;
+  int v4370=v1783+7;
+  int v4371=v1564+4;
+  int v4372=v2577+7;
+  int v4373=v2300+5;
+  int v4374=v4108+6;
+  int v4375=v1586+4;
+  int v4376=v777+0;
+  int v4377=v3452+6;
+  int v4378=v658+2;
+  int v4379=v4001+7;
+  int v4380=v1442+5;
+  int v4381=v400+9;
+  int v4382=v192+4;
+  int v4383=v1715+9;
+  int v4384=v1545+7;
+  int v4385=v824+1;
+  int v4386=v196+1;
+  int v4387=v3204+5;
+  int v4388=v2402+1;
+  int v4389=v230+6;
+  int v4390=v3151+6;
+  int v4391=v2938+4;
+  int v4392=v4367+2;
+  int v4393=v213+5;
+  int v4394=v3287+1;
+  int v4395=v4354+1;
+  int v4396=v4342+0;
+  int v4397=v2820+0;
+  int v4398=v2260+3;
+  int v4399=v1656+1;
+  int v4400=v2202+8;
+  int v4401=v1276+3;
+  int v4402=v2247+8;
+  int v4403=v1729+3;
+  int v4404=v242+7;
+  int v4405=v3901+9;
+  int v4406=v769+1;
+  int v4407=v3137+1;
+  int v4408=v4399+7;
+  int v4409=v3294+8;
+  int v4410=v692+2;
+  int v4411=v852+2;
+  int v4412=v1568+9;
+  int v4413=v3714+6;
+  int v4414=v3716+4;
+  int v4415=v675+7;
+  int v4416=v562+7;
+  int v4417=v4343+6;
+  int v4418=v50+5;
+  int v4419=v3261+4;
+  int v4420=v301+0;
+  int v4421=v911+7;
+  int v4422=v1099+9;
+  int v4423=v3118+6;
+  int v4424=v490+5;
+  int v4425=v462+0;
+  int v4426=v1274+0;
+  int v4427=v2969+4;
+  int v4428=v4325+4;
+  int v4429=v2692+3;
+  int v4430=v2417+1;
+  int v4431=v3428+3;
+  int v4432=v939+0;
+  int v4433=v3379+8;
+  int v4434=v3568+7;
+  int v4435=v1961+4;
+  int v4436=v3068+5;
+  int v4437=v1796+8;
+  int v4438=v527+2;
+  int v4439=v148+4;
+  int v4440=v939+4;
+  int v4441=v1262+4;
+  int v4442=v2469+2;
+  int v4443=v3023+2;
+  int v4444=v284+9;
+  int v4445=v655+5;
+  int v4446=v230+9;
+  int v4447=v3271+2;
+  int v4448=v966+7;
+  int v4449=v627+2;
+  int v4450=v2618+6;
+  int v4451=v2659+3;
+  int v4452=v1687+7;
+  int v4453=v128+8;
+  int v4454=v1773+5;
+  int v4455=v3188+2;
+  int v4456=v525+6;
+  int v4457=v3898+6;
+  int v4458=v552+2;
+  int v4459=v2198+9;
+  int v4460=v3283+7;
+  int v4461=v3819+7;
+  int v4462=v948+4;
+  int v4463=v313+5;
+  int v4464=v3353+3;
+  int v4465=v2876+6;
+  int v4466=v3581+9;
+  int v4467=v1348+4;
+  int v4468=v614+1;
+  int v4469=v3071+0;
+  int v4470=v748+5;
+  int v4471=v1318+0;
+  int v4472=v2531+9;
+  int v4473=v4221+0;
+  int v4474=v2644+6;
+  int v4475=v2168+4;
+  int v4476=v2920+4;
+  int v4477=v1652+0;
+  int v4478=v1039+7;
+  int v4479=v275+8;
+  int v4480=v1909+9;
+  int v4481=v1180+1;
+  int v4482=v326+9;
+  int v4483=v1919+5;
+  int v4484=v2025+1;
+  int v4485=v378+4;
+  int v4486=v3334+9;
+  int v4487=v633+4;
+  int v4488=v3127+7;
+  int v4489=v3055+0;
+  int v4490=v1423+5;
+  int v4491=v2847+8;
+  int v4492=v4107+9;
+  int v4493=v904+8;
+  int v4494=v4265+3;
+  int v4495=v230+2;
+  int v4496=v3456+6;
+  int v4497=v2735+5;
+  int v4498=v834+4;
+  int v4499=v1738+4;
+  int v4500=v1472+8;
+  int v4501=v1235+4;
+  int v4502=v3610+6;
+  int v4503=v4342+9;
+  int v4504=v3909+4;
+  int v4505=v4014+7;
+  int v4506=v883+3;
+  int v4507=v2274+7;
+  int v4508=v3154+5;
+  int v4509=v3323+2;
+  int v4510=v1479+0;
+  int v4511=v935+8;
+  int v4512=v79+3;
+  int v4513=v2062+8;
+  int v4514=v2208+0;
+  int v4515=v1902+9;
+  int v4516=v3266+8;
+  int v4517=v753+6;
+  int v4518=v2326+4;
+  int v4519=v2316+1;
+  int v4520=v2859+1;
+  int v4521=v3779+0;
+  int v4522=v180+1;
+  int v4523=v113+8;
+  int v4524=v1483+8;
+  int v4525=v1148+4;
+  int v4526=v1391+1;
+  int v4527=v1153+1;
+  int v4528=v4268+1;
+  int v4529=v413+5;
+  int v4530=v1121+6;
+  int v4531=v1221+3;
+  int v4532=v3497+8;
+  int v4533=v1611+8;
+  int v4534=v3305+6;
+  int v4535=v3129+6;
+  int v4536=v739+5;
+  int v4537=v1799+5;
+  int v4538=v497+7;
+  int v4539=v3603+2;
+  int v4540=v703+9;
+  int v4541=v1002+8;
+  int v4542=v2480+0;
+  int v4543=v369+4;
+  int v4544=v3138+2;
+  int v4545=v2631+1;
+  int v4546=v4172+5;
+  int v4547=v3951+2;
+  int v4548=v1756+8;
+  int v4549=v404+0;
+  int v4550=v744+7;
+  int v4551=v2393+7;
+  int v4552=v795+8;
+  int v4553=v3367+9;
+  int v4554=v2426+7;
+  int v4555=v1202+1;
+  int v4556=v1677+8;
+  int v4557=v608+6;
+  int v4558=v2611+2;
+  int v4559=v1877+8;
+  int v4560=v4228+6;
+  int v4561=v4201+0;
+  int v4562=v4231+9;
+  int v4563=v2179+1;
+  int v4564=v2829+2;
+  int v4565=v705+1;
+  int v4566=v719+5;
+  int v4567=v390+8;
+  int v4568=v2463+4;
+  int v4569=v1389+5;
+  int v4570=v1223+5;
+  int v4571=v3638+7;
+  int v4572=v4281+1;
+  int v4573=v30+9;
+  int v4574=v2877+4;
+  int v4575=v3322+2;
+  int v4576=v2552+3;
+  int v4577=v3028+9;
+  int v4578=v3580+3;
+  int v4579=v2907+0;
+  int v4580=v3639+5;
+  int v4581=v3384+3;
+  int v4582=v74+3;
+  int v4583=v825+8;
+  int v4584=v1648+1;
+  int v4585=v3936+8;
+  int v4586=v538+0;
+  int v4587=v1094+5;
+  int v4588=v882+7;
+  int v4589=v1113+3;
+  int v4590=v347+4;
+  int v4591=v1509+9;
+  int v4592=v1711+7;
+  int v4593=v2663+8;
+  int v4594=v718+6;
+  int v4595=v3975+7;
+  int v4596=v4125+3;
+  int v4597=v2538+7;
+  int v4598=v4407+9;
+  int v4599=v434+9;
+  int v4600=v1087+2;
+  int v4601=v4419+7;
+  int v4602=v2402+3;
+  int v4603=v3043+2;
+  int v4604=v4583+9;
+  int v4605=v2842+6;
+  int v4606=v4588+7;
+  int v4607=v2418+0;
+  int v4608=v3389+2;
+  int v4609=v3119+0;
+  int v4610=v3637+8;
+  int v4611=v2099+5;
+  int v4612=v4032+1;
+  int v4613=v2881+7;
+  int v4614=v2895+5;
+  int v4615=v3041+0;
+  int v4616=v3143+0;
+  int v4617=v2760+0;
+  int v4618=v241+1;
+  int v4619=v1334+3;
+  int v4620=v3082+4;
+  int v4621=v776+2;
+  int v4622=v1959+7;
+  int v4623=v1341+1;
+  int v4624=v4322+2;
+  int v4625=v686+3;
+  int v4626=v140+4;
+  int v4627=v1981+2;
+  int v4628=v1546+9;
+  int v4629=v4068+9;
+  int v4630=v2337+5;
+  int v4631=v161+5;
+  int v4632=v554+1;
+  int v4633=v4487+8;
+  int v4634=v344+5;
+  int v4635=v604+2;
+  int v4636=v3321+0;
+  int v4637=v3132+0;
+  int v4638=v1788+4;
+  int v4639=v1599+2;
+  int v4640=v407+9;
+  int v4641=v2971+0;
+  int v4642=v4078+9;
+  int v4643=v1860+7;
+  int v4644=v1707+5;
+  int v4645=v3081+4;
+  int v4646=v2441+5;
+  int v4647=v2842+4;
+  int v4648=v1222+0;
+  int v4649=v3729+7;
+  int v4650=v1112+1;
+  int v4651=v1416+1;
+  int v4652=v2911+3;
+  int v4653=v883+6;
+  int v4654=v2105+4;
+  int v4655=v3919+1;
+  int v4656=v753+3;
+  int v4657=v1974+9;
+  int v4658=v1014+3;
+  int v4659=v3096+3;
+  int v4660=v1458+6;
+  int v4661=v684+7;
+  int v4662=v1029+6;
+  int v4663=v4117+8;
+  int v4664=v1699+2;
+  int v4665=v2362+0;
+  int v4666=v929+1;
+  int v4667=v4077+1;
+  int v4668=v2586+5;
+  int v4669=v4408+7;
+  int v4670=v1020+8;
+  int v4671=v680+7;
+  int v4672=v877+9;
+  int v4673=v3892+2;
+  int v4674=v2136+5;
+  int v4675=v1977+9;
+  int v4676=v2683+2;
+  int v4677=v2211+3;
+  int v4678=v3403+1;
+  int v4679=v3257+8;
+  int v4680=v454+1;
+  int v4681=v1528+5;
+  int v4682=v2521+7;
+  int v4683=v2253+5;
+  int v4684=v2819+2;
+  int v4685=v1498+8;
+  int v4686=v3269+5;
+  int v4687=v4650+9;
+  int v4688=v1659+5;
+  int v4689=v4643+3;
+  int v4690=v773+4;
+  int v4691=v3328+9;
+  int v4692=v2664+3;
+  int v4693=v2578+9;
+  int v4694=v1350+3;
+  int v4695=v2928+2;
+  int v4696=v3219+1;
+  int v4697=v3439+4;
+  int v4698=v3534+7;
+  int v4699=v1842+0;
+  int v4700=v2487+0;
+  int v4701=v3998+7;
+  int v4702=v2343+0;
+  int v4703=v2699+5;
+  int v4704=v3844+3;
+  int v4705=v4139+5;
+  int v4706=v3735+2;
+  int v4707=v1543+7;
+  int v4708=v2255+3;
+  int v4709=v1928+2;
+  int v4710=v3077+2;
+  int v4711=v2000+8;
+  int v4712=v3682+1;
+  int v4713=v2084+0;
+  int v4714=v649+1;
+  int v4715=v3669+2;
+  int v4716=v4649+7;
+  int v4717=v547+6;
+  int v4718=v1549+0;
+  int v4719=v4417+2;
+  int v4720=v1393+7;
+  int v4721=v4648+1;
+  int v4722=v4221+4;
+  int v4723=v2742+4;
+  int v4724=v210+4;
+  int v4725=v3739+5;
+  int v4726=v531+6;
+  int v4727=v3346+6;
+  int v4728=v2722+9;
+  int v4729=v4608+7;
+  int v4730=v32+4;
+  int v4731=v1254+0;
+  int v4732=v4282+6;
+  int v4733=v4012+9;
+  int v4734=v3904+2;
+  int v4735=v1610+9;
+  int v4736=v2364+0;
+  int v4737=v2638+1;
+  int v4738=v4264+9;
+  int v4739=v2300+9;
+  int v4740=v286+7;
+  int v4741=v3340+1;
+  int v4742=v3562+8;
+  int v4743=v3296+7;
+  int v4744=v1142+6;
+  int v4745=v2461+2;
+  int v4746=v4361+5;
+  int v4747=v2108+4;
+  int v4748=v4237+8;
+  int v4749=v180+9;
+  int v4750=v2244+1;
+  int v4751=v19+7;
+  int v4752=v3184+9;
+  int v4753=v3079+4;
+  int v4754=v924+5;
+  int v4755=v3392+7;
+  int v4756=v2339+2;
+  int v4757=v4178+9;
+  int v4758=v3511+7;
+  int v4759=v4638+3;
+  int v4760=v375+6;
+  int v4761=v292+7;
+  int v4762=v2339+2;
+  int v4763=v2070+4;
+  int v4764=v1724+4;
+  int v4765=v2343+0;
+  int v4766=v817+9;
+  int v4767=v1103+6;
+  int v4768=v3511+1;
+  int v4769=v4561+1;
+  int v4770=v1621+1;
+  int v4771=v3047+8;
+  int v4772=v460+1;
+  int v4773=v2215+4;
+  int v4774=v2656+8;
+  int v4775=v4597+2;
+  int v4776=v3785+0;
+  int v4777=v4570+0;
+  int v4778=v680+0;
+  int v4779=v508+0;
+  int v4780=v3796+4;
+  int v4781=v3452+5;
+  int v4782=v1905+5;
+  int v4783=v4251+3;
+  int v4784=v4003+2;
+  int v4785=v4521+8;
+  int v4786=v844+7;
+  int v4787=v4738+8;
+  int v4788=v3668+6;
+  int v4789=v411+5;
+  int v4790=v1742+1;
+  int v4791=v4269+1;
+  int v4792=v4100+2;
+  int v4793=v4701+8;
+  int v4794=v4419+1;
+  int v4795=v2100+9;
+  int v4796=v3225+0;
+  int v4797=v3172+8;
+  int v4798=v2286+6;
+  int v4799=v1731+9;
+  int v4800=v2612+1;
+  int v4801=v3693+4;
+  int v4802=v2321+0;
+  int v4803=v2131+4;
+  int v4804=v4148+8;
+  int v4805=v1058+3;
+  int v4806=v4702+2;
+  int v4807=v1695+8;
+  int v4808=v2181+2;
+  int v4809=v4340+6;
+  int v4810=v4365+6;
+  int v4811=v4187+1;
+  int v4812=v2667+6;
+  int v4813=v2261+9;
+  int v4814=v4772+7;
+  int v4815=v376+9;
+  int v4816=v3428+3;
+  int v4817=v2553+4;
+  int v4818=v4685+1;
+  int v4819=v1609+0;
+  int v4820=v1932+0;
+  int v4821=v822+7;
+  int v4822=v790+4;
+  int v4823=v1840+1;
+  int v4824=v845+8;
+  int v4825=v3336+3;
+  int v4826=v4611+9;
+  int v4827=v3215+6;
+  int v4828=v3585+9;
+  int v4829=v2027+0;
+  int v4830=v4110+2;
+  int v4831=v4742+6;
+  int v4832=v1615+2;
+  int v4833=v1036+3;
+  int v4834=v3405+1;
+  int v4835=v391+6;
+  int v4836=v4190+9;
+  int v4837=v4017+2;
+  int v4838=v4664+7;
+  int v4839=v4260+8;
+  int v4840=v892+7;
+  int v4841=v3333+7;
+  int v4842=v3515+4;
+  int v4843=v4821+1;
+  int v4844=v2795+8;
+  int v4845=v4201+3;
+  int v4846=v2173+0;
+  int v4847=v2639+6;
+  int v4848=v3515+5;
+  int v4849=v17+1;
+  int v4850=v4795+0;
+  int v4851=v2953+5;
+  int v4852=v2547+0;
+  int v4853=v627+0;
+  int v4854=v3596+9;
+  int v4855=v968+0;
+  int v4856=v2337+8;
+  int v4857=v531+7;
+  int v4858=v2067+5;
+  int v4859=v1290+2;
+  int v4860=v3279+9;
+  int v4861=v1316+7;
+  int v4862=v4162+9;
+  int v4863=v3967+3;
+  int v4864=v1730+5;
+  int v4865=v95+9;
+  int v4866=v315+5;
+  int v4867=v4852+2;
+  int v4868=v3026+6;
+  int v4869=v4529+2;
+  int v4870=v518+2;
+  int v4871=v4682+1;
+  int v4872=v148+2;
+  int v4873=v3800+1;
+  int v4874=v2073+5;
+  int v4875=v2812+6;
+  int v4876=v1162+9;
+  int v4877=v24+5;
+  int v4878=v2762+8;
+  int v4879=v3952+8;
+  int v4880=v796+9;
+  int v4881=v75+8;
+  int v4882=v1203+6;
+  int v4883=v1097+7;
+  int v4884=v479+9;
+  int v4885=v4419+0;
+  int v4886=v975+3;
+  int v4887=v1654+9;
+  int v4888=v2823+4;
+  int v4889=v423+9;
+  int v4890=v2672+8;
+  int v4891=v2247+5;
+  int v4892=v2154+4;
+  int v4893=v4288+6;
+  int v4894=v1308+9;
+  int v4895=v1995+1;
+  int v4896=v423+3;
+  int v4897=v4784+1;
+  int v4898=v4019+5;
+  int v4899=v2396+1;
+  int v4900=v3768+1;
+  int v4901=v139+4;
+  int v4902=v1671+1;
+  int v4903=v332+8;
+  int v4904=v532+5;
+  int v4905=v2267+9;
+  int v4906=v1769+3;
+  int v4907=v400+0;
+  int v4908=v3225+1;
+  int v4909=v4822+7;
+  int v4910=v548+7;
+  int v4911=v2129+2;
+  int v4912=v2174+8;
+  int v4913=v2229+5;
+  int v4914=v2005+8;
+  int v4915=v270+2;
+  int v4916=v2966+8;
+  int v4917=v606+9;
+  int v4918=v3718+8;
+  int v4919=v1031+1;
+  int v4920=v1195+7;
+  int v4921=v84+2;
+  int v4922=v127+0;
+  int v4923=v1996+4;
+  int v4924=v1732+3;
+  int v4925=v2102+6;
+  int v4926=v478+8;
+  int v4927=v3300+4;
+  int v4928=v949+7;
+  int v4929=v503+1;
+  int v4930=v3296+6;
+  int v4931=v4117+7;
+  int v4932=v3259+3;
+  int v4933=v1913+0;
+  int v4934=v938+9;
+  int v4935=v4176+9;
+  int v4936=v2295+8;
+  int v4937=v2418+3;
+  int v4938=v684+3;
+  int v4939=v1866+8;
+  int v4940=v1557+5;
+  int v4941=v4724+3;
+  int v4942=v340+0;
+  int v4943=v584+7;
+  int v4944=v3873+5;
+  int v4945=v2607+6;
+  int v4946=v3050+7;
+  int v4947=v3702+4;
+  int v4948=v1257+3;
+  int v4949=v287+5;
+  int v4950=v1554+4;
+  int v4951=v3491+2;
+  int v4952=v2321+2;
+  int v4953=v3726+8;
+  int v4954=v1134+6;
+  int v4955=v3139+8;
+  int v4956=v367+8;
+  int v4957=v2540+8;
+  int v4958=v2046+5;
+  int v4959=v2876+0;
+  int v4960=v160+2;
+  int v4961=v1615+9;
+  int v4962=v2183+3;
+  int v4963=v4886+4;
+  int v4964=v2717+3;
+  int v4965=v2431+9;
+  int v4966=v4072+9;
+  int v4967=v1263+5;
+  int v4968=v711+1;
+  int v4969=v4134+0;
+  int v4970=v89+1;
+  int v4971=v3485+3;
+  int v4972=v4073+7;
+  int v4973=v349+0;
+  int v4974=v3107+7;
+  int v4975=v4615+0;
+  int v4976=v3621+9;
+  int v4977=v1408+0;
+  int v4978=v4622+3;
+  int v4979=v3655+2;
+  int v4980=v4894+7;
+  int v4981=v851+7;
+  int v4982=v142+4;
+  int v4983=v2659+9;
+  int v4984=v3232+1;
+  int v4985=v1191+6;
+  int v4986=v2169+1;
+  int v4987=v2520+9;
+  int v4988=v524+3;
+  int v4989=v234+5;
+  int v4990=v823+3;
+  int v4991=v2918+6;
+  int v4992=v957+0;
+  int v4993=v2916+4;
+  int v4994=v1707+7;
+  int v4995=v3623+3;
+  int v4996=v2897+1;
+  int v4997=v3163+4;
+  int v4998=v423+0;
+  int v4999=v2218+1;
+  int v5000=v1595+5;
+  int v5001=v3922+8;
+  int v5002=v1308+1;
+  int v5003=v1183+1;
+  int v5004=v3522+3;
+  int v5005=v4244+2;
+  int v5006=v3284+9;
+  int v5007=v831+8;
+  int v5008=v4858+0;
+  int v5009=v4310+4;
+  int v5010=v2890+7;
+  int v5011=v3524+2;
+  int v5012=v4778+5;
+  int v5013=v1298+3;
+  int v5014=v913+4;
+  int v5015=v800+7;
+  int v5016=v312+6;
+  int v5017=v4690+1;
+  int v5018=v2142+7;
+  int v5019=v3010+1;
+  int v5020=v2247+7;
+  int v5021=v789+5;
+  int v5022=v2330+8;
+  int v5023=v2291+9;
+  int v5024=v4477+6;
+  int v5025=v1484+7;
+  int v5026=v4399+6;
+  int v5027=v1378+8;
+  int v5028=v4196+5;
+  int v5029=v3666+1;
+  int v5030=v1352+4;
+  int v5031=v1779+9;
+  int v5032=v2266+3;
+  int v5033=v1284+9;
+  int v5034=v2756+2;
+  int v5035=v1508+8;
+  int v5036=v1658+1;
+  int v5037=v4440+0;
+  int v5038=v843+9;
+  int v5039=v1810+6;
+  int v5040=v2444+7;
+  int v5041=v4514+1;
+  int v5042=v1259+2;
+  int v5043=v1731+3;
+  int v5044=v2205+4;
+  int v5045=v1696+4;
+  int v5046=v147+9;
+  int v5047=v84+8;
+  int v5048=v3134+9;
+  int v5049=v4004+9;
+  int v5050=v306+2;
+  int v5051=v3661+5;
+  int v5052=v1426+0;
+  int v5053=v1774+3;
+  int v5054=v4094+9;
+  int v5055=v674+8;
+  int v5056=v4462+8;
+  int v5057=v3182+7;
+  int v5058=v1766+1;
+  int v5059=v1412+0;
+  int v5060=v1550+8;
+  int v5061=v536+5;
+  int v5062=v1516+2;
+  int v5063=v3165+7;
+  int v5064=v4519+9;
+  int v5065=v634+7;
+  int v5066=v1340+9;
+  int v5067=v3831+8;
+  int v5068=v3667+5;
+  int v5069=v2447+2;
+  int v5070=v3240+0;
+  int v5071=v4147+2;
+  int v5072=v548+6;
+  int v5073=v2806+6;
+  int v5074=v1800+6;
+  int v5075=v851+2;
+  int v5076=v1783+9;
+  int v5077=v1428+7;
+  int v5078=v2152+6;
+  int v5079=v2557+0;
+  int v5080=v4692+1;
+  int v5081=v194+7;
+  int v5082=v3249+8;
+  int v5083=v2714+8;
+  int v5084=v1277+9;
+  int v5085=v1342+8;
+  int v5086=v3639+9;
+  int v5087=v386+6;
+  int v5088=v63+8;
+  int v5089=v1254+2;
+  int v5090=v1390+1;
+  int v5091=v3100+1;
+  int v5092=v172+4;
+  int v5093=v4439+3;
+  int v5094=v1202+4;
+  int v5095=v2262+2;
+  int v5096=v3508+7;
+  int v5097=v2978+7;
+  int v5098=v2052+9;
+  int v5099=v2745+0;
+  int v5100=v4909+1;
+  int v5101=v2683+5;
+  int v5102=v784+8;
+  int v5103=v630+3;
+  int v5104=v3069+7;
+  int v5105=v2293+7;
+  int v5106=v2079+5;
+  int v5107=v4757+2;
+  int v5108=v4376+2;
+  int v5109=v3632+4;
+  int v5110=v3836+5;
+  int v5111=v1893+8;
+  int v5112=v2668+0;
+  int v5113=v2788+1;
+  int v5114=v3356+7;
+  int v5115=v974+9;
+  int v5116=v4986+3;
+  int v5117=v1182+8;
+  int v5118=v2691+9;
+  int v5119=v4086+3;
+  int v5120=v3132+9;
+  int v5121=v3201+8;
+  int v5122=v1795+2;
+  int v5123=v3157+7;
+  int v5124=v1034+0;
+  int v5125=v891+6;
+  int v5126=v1896+7;
+  int v5127=v4375+4;
+  int v5128=v3011+5;
+  int v5129=v5105+1;
+  int v5130=v1243+2;
+  int v5131=v1309+8;
+  int v5132=v1867+8;
+  int v5133=v4969+9;
+  int v5134=v837+7;
+  int v5135=v435+1;
+  int v5136=v2796+9;
+  int v5137=v3086+4;
+  int v5138=v4472+5;
+  int v5139=v1052+0;
+  int v5140=v867+9;
+  int v5141=v997+4;
+  int v5142=v3292+6;
+  int v5143=v1671+6;
+  int v5144=v1342+0;
+  int v5145=v344+8;
+  int v5146=v3296+9;
+  int v5147=v970+6;
+  int v5148=v1839+9;
+  int v5149=v4466+8;
+  int v5150=v2720+0;
+  int v5151=v2263+4;
+  int v5152=v431+5;
+  int v5153=v82+9;
+  int v5154=v4736+6;
+  int v5155=v2705+0;
+  int v5156=v4691+0;
+  int v5157=v5042+9;
+  int v5158=v560+1;
+  int v5159=v1133+2;
+  int v5160=v769+2;
+  int v5161=v4992+8;
+  int v5162=v1583+9;
+  int v5163=v1626+3;
+  int v5164=v4743+3;
+  int v5165=v784+2;
+  int v5166=v3049+4;
+  int v5167=v1875+7;
+  int v5168=v1111+3;
+  int v5169=v3267+9;
+  int v5170=v1592+5;
+  int v5171=v4122+9;
+  int v5172=v297+7;
+  int v5173=v1300+0;
+  int v5174=v4625+1;
+  int v5175=v2526+6;
+  int v5176=v1151+9;
+  int v5177=v2894+0;
+  int v5178=v3038+1;
+  int v5179=v4839+4;
+  int v5180=v5028+4;
+  int v5181=v4801+4;
+  int v5182=v2841+4;
+  int v5183=v1683+5;
+  int v5184=v511+2;
+  int v5185=v1332+3;
+  int v5186=v2536+7;
+  int v5187=v663+0;
+  int v5188=v1494+1;
+  int v5189=v1921+5;
+  int v5190=v3713+5;
+  int v5191=v1318+7;
+  int v5192=v5171+5;
+  int v5193=v4776+5;
+  int v5194=v3171+9;
+  int v5195=v2948+0;
+  int v5196=v3932+9;
+  int v5197=v430+9;
+  int v5198=v2759+9;
+  int v5199=v1376+3;
+  int v5200=v3937+3;
+  int v5201=v4410+6;
+  int v5202=v2065+0;
+  int v5203=v335+4;
+  int v5204=v3245+7;
+  int v5205=v304+5;
+  int v5206=v5184+1;
+  int v5207=v1359+6;
+  int v5208=v971+5;
+  int v5209=v2296+6;
+  int v5210=v3472+6;
+  int v5211=v5189+4;
+  int v5212=v4271+0;
+  int v5213=v3715+9;
+  int v5214=v2908+0;
+  int v5215=v608+5;
+  int v5216=v3315+0;
+  int v5217=v1458+2;
+  int v5218=v3747+7;
+  int v5219=v3105+1;
+  int v5220=v1213+0;
+  int v5221=v2925+6;
+  int v5222=v1239+7;
+  int v5223=v2152+7;
+  int v5224=v1612+2;
+  int v5225=v2982+0;
+  int v5226=v3489+6;
+  int v5227=v3568+8;
+  int v5228=v4100+3;
+  int v5229=v3004+8;
+  int v5230=v2042+1;
+  int v5231=v179+7;
+  int v5232=v3803+5;
+  int v5233=v3638+0;
+  int v5234=v136+4;
+  int v5235=v4879+1;
+  int v5236=v3593+2;
+  int v5237=v865+9;
+  int v5238=v2794+9;
+  int v5239=v3207+7;
+  int v5240=v3507+4;
+  int v5241=v990+2;
+  int v5242=v2537+2;
+  int v5243=v1062+2;
+  int v5244=v4515+5;
+  int v5245=v4718+5;
+  int v5246=v472+9;
+  int v5247=v2655+9;
+  int v5248=v1774+2;
+  int v5249=v122+0;
+  int v5250=v2103+3;
+  int v5251=v4612+2;
+  int v5252=v4470+7;
+  int v5253=v351+9;
+  int v5254=v503+5;
+  int v5255=v3468+1;
+  int v5256=v5172+8;
+  int v5257=v1482+0;
+  int v5258=v1081+4;
+  int v5259=v1134+4;
+  int v5260=v4164+2;
+  int v5261=v2241+2;
+  int v5262=v4147+7;
+  int v5263=v1206+3;
+  int v5264=v4213+8;
+  int v5265=v933+6;
+  int v5266=v4104+8;
+  int v5267=v2369+2;
+  int v5268=v4538+7;
+  int v5269=v2457+4;
+  int v5270=v1746+5;
+  int v5271=v1705+7;
+  int v5272=v1151+7;
+  int v5273=v3558+2;
+  int v5274=v101+1;
+  int v5275=v2170+4;
+  int v5276=v1001+3;
+  int v5277=v2265+7;
+  int v5278=v3689+5;
+  int v5279=v3454+2;
+  int v5280=v2645+5;
+  int v5281=v2755+5;
+  int v5282=v3200+3;
+  int v5283=v1164+9;
+  int v5284=v3049+1;
+  int v5285=v1475+5;
+  int v5286=v1762+2;
+  int v5287=v2304+5;
+  int v5288=v2395+5;
+  int v5289=v2198+9;
+  int v5290=v4441+7;
+  int v5291=v5050+5;
+  int v5292=v5192+0;
+  int v5293=v759+9;
+  int v5294=v2528+7;
+  int v5295=v2974+6;
+  int v5296=v2331+9;
+  int v5297=v4591+5;
+  int v5298=v2759+2;
+  int v5299=v3014+8;
+  int v5300=v2549+0;
+  int v5301=v4317+2;
+  int v5302=v3836+6;
+  int v5303=v4904+7;
+  int v5304=v1629+6;
+  int v5305=v5119+1;
+  int v5306=v4048+1;
+  int v5307=v2589+4;
+  int v5308=v1547+6;
+  int v5309=v4676+4;
+  int v5310=v411+2;
+  int v5311=v3590+8;
+  int v5312=v102+4;
+  int v5313=v267+4;
+  int v5314=v1403+1;
+  int v5315=v4817+7;
+  int v5316=v4500+4;
+  int v5317=v5266+8;
+  int v5318=v1317+0;
+  int v5319=v428+1;
+  int v5320=v158+1;
+  int v5321=v1047+9;
+  int v5322=v1940+2;
+  int v5323=v663+5;
+  int v5324=v2889+7;
+  int v5325=v2010+1;
+  int v5326=v1181+4;
+  int v5327=v2831+4;
+  int v5328=v762+4;
+  int v5329=v2966+0;
+  int v5330=v227+8;
+  int v5331=v3535+9;
+  int v5332=v2411+0;
+  int v5333=v764+2;
+  int v5334=v689+3;
+  int v5335=v468+3;
+  int v5336=v4658+9;
+  int v5337=v746+9;
+  int v5338=v984+4;
+  int v5339=v1414+7;
+  int v5340=v5004+1;
+  int v5341=v3992+4;
+  int v5342=v2874+9;
+  int v5343=v3559+7;
+  int v5344=v2401+9;
+  int v5345=v3300+5;
+  int v5346=v721+8;
+  int v5347=v3298+2;
+  int v5348=v1358+4;
+  int v5349=v1576+6;
+  int v5350=v1481+5;
+  int v5351=v1422+7;
+  int v5352=v4767+9;
+  int v5353=v4026+4;
+  int v5354=v3699+0;
+  int v5355=v4543+6;
+  int v5356=v861+2;
+  int v5357=v4296+2;
+  int v5358=v2324+6;
+  int v5359=v4710+2;
+  int v5360=v1068+0;
+  int v5361=v3559+6;
+  int v5362=v2779+0;
+  int v5363=v1409+9;
+  int v5364=v303+9;
+  int v5365=v717+6;
+  int v5366=v3027+5;
+  int v5367=v2467+0;
+  int v5368=v336+4;
+  int v5369=v4251+9;
+  int v5370=v3582+8;
+  int v5371=v4757+0;
+  int v5372=v4897+6;
+  int v5373=v3777+8;
+  int v5374=v2947+4;
+  int v5375=v5191+5;
+  int v5376=v5026+3;
+  int v5377=v2243+5;
+  int v5378=v2137+7;
+  int v5379=v4075+4;
+  int v5380=v4627+0;
+  int v5381=v275+6;
+  int v5382=v2033+9;
+  int v5383=v1760+0;
+  int v5384=v968+4;
+  int v5385=v3200+0;
+  int v5386=v2904+6;
+  int v5387=v359+5;
+  int v5388=v81+9;
+  int v5389=v1928+2;
+  int v5390=v2543+3;
+  int v5391=v3179+4;
+  int v5392=v2727+4;
+  int v5393=v687+6;
+  int v5394=v4956+0;
+  int v5395=v4467+1;
+  int v5396=v5060+2;
+  int v5397=v4141+1;
+  int v5398=v529+2;
+  int v5399=v1263+5;
+  int v5400=v4414+0;
+  int v5401=v4072+5;
+  int v5402=v5133+2;
+  int v5403=v5350+9;
+  int v5404=v518+0;
+  int v5405=v1437+9;
+  int v5406=v1221+4;
+  int v5407=v2825+7;
+  int v5408=v2341+1;
+  int v5409=v2775+8;
+  int v5410=v1053+6;
+  int v5411=v2554+9;
+  int v5412=v2538+6;
+  int v5413=v3780+5;
+  int v5414=v4861+0;
+  int v5415=v5018+6;
+  int v5416=v1161+6;
+  int v5417=v3031+2;
+  int v5418=v3846+3;
+  int v5419=v4183+0;
+  int v5420=v3547+3;
+  int v5421=v2647+4;
+  int v5422=v2430+2;
+  int v5423=v543+1;
+  int v5424=v4259+2;
+  int v5425=v1231+0;
+  int v5426=v1256+5;
+  int v5427=v2496+3;
+  int v5428=v1297+1;
+  int v5429=v3272+8;
+  int v5430=v2711+7;
+  int v5431=v4116+5;
+  int v5432=v2085+2;
+  int v5433=v2324+1;
+  int v5434=v1425+5;
+  int v5435=v1467+1;
+  int v5436=v155+8;
+  int v5437=v3660+6;
+  int v5438=v5425+7;
+  int v5439=v2643+6;
+  int v5440=v2690+0;
+  int v5441=v1599+0;
+  int v5442=v4761+9;
+  int v5443=v2278+3;
+  int v5444=v3652+2;
+  int v5445=v2326+5;
+  int v5446=v3775+3;
+  int v5447=v2391+5;
+  int v5448=v4279+9;
+  int v5449=v1107+3;
+  int v5450=v4522+2;
+  int v5451=v1125+6;
+  int v5452=v3124+5;
+  int v5453=v446+7;
+  int v5454=v1230+3;
+  int v5455=v4268+4;
+  int v5456=v3107+4;
+  int v5457=v1895+8;
+  int v5458=v260+2;
+  int v5459=v1251+4;
+  int v5460=v5213+5;
+  int v5461=v3324+1;
+  int v5462=v873+0;
+  int v5463=v2362+2;
+  int v5464=v2207+2;
+  int v5465=v148+4;
+  int v5466=v1322+3;
+  int v5467=v2125+7;
+  int v5468=v4965+2;
+  int v5469=v2556+7;
+  int v5470=v5087+6;
+  int v5471=v700+6;
+  int v5472=v1361+0;
+  int v5473=v1367+1;
+  int v5474=v4620+3;
+  int v5475=v2952+6;
+  int v5476=v2341+3;
+  int v5477=v1343+5;
+  int v5478=v30+6;
+  int v5479=v3715+6;
+  int v5480=v2014+5;
+  int v5481=v3445+6;
+  int v5482=v3549+7;
+  int v5483=v463+9;
+  int v5484=v5105+6;
+  int v5485=v4640+3;
+  int v5486=v4936+9;
+  int v5487=v1419+5;
+  int v5488=v4073+3;
+  int v5489=v2782+4;
+  int v5490=v2623+6;
+  int v5491=v1426+6;
+  int v5492=v695+1;
+  int v5493=v2395+8;
+  int v5494=v2399+5;
+  int v5495=v1536+7;
+  int v5496=v2944+1;
+  int v5497=v3869+0;
+  int v5498=v4821+6;
+  int v5499=v2487+7;
+  int v5500=v2418+7;
+  int v5501=v1718+1;
+  int v5502=v3544+2;
+  int v5503=v2293+5;
+  int v5504=v1478+9;
+  int v5505=v3057+2;
+  int v5506=v154+4;
+  int v5507=v84+2;
+  int v5508=v2141+8;
+  int v5509=v876+5;
+  int v5510=v4807+4;
+  int v5511=v2481+0;
+  int v5512=v5488+3;
+  int v5513=v850+8;
+  int v5514=v4989+2;
+  int v5515=v4811+8;
+  int v5516=v2890+2;
+  int v5517=v2536+1;
+  int v5518=v3786+1;
+  int v5519=v1130+9;
+  int v5520=v1382+8;
+  int v5521=v791+2;
+  int v5522=v749+4;
+  int v5523=v4377+5;
+  int v5524=v803+6;
+  int v5525=v3324+3;
+  int v5526=v5159+5;
+  int v5527=v3260+6;
+  int v5528=v3698+8;
+  int v5529=v3435+2;
+  int v5530=v4509+6;
+  int v5531=v2324+1;
+  int v5532=v1065+5;
+  int v5533=v325+8;
+  int v5534=v3953+1;
+  int v5535=v1103+4;
+  int v5536=v1974+7;
+  int v5537=v3306+8;
+  int v5538=v4418+8;
+  int v5539=v593+4;
+  int v5540=v2361+3;
+  int v5541=v729+7;
+  int v5542=v126+8;
+  int v5543=v3121+9;
+  int v5544=v4908+8;
+  int v5545=v571+9;
+  int v5546=v4669+3;
+  int v5547=v5070+0;
+  int v5548=v2790+9;
+  int v5549=v1632+9;
+  int v5550=v3653+7;
+  int v5551=v2843+4;
+  int v5552=v5177+9;
+  int v5553=v1614+0;
+  int v5554=v883+8;
+  int v5555=v3235+6;
+  int v5556=v4057+1;
+  int v5557=v3098+7;
+  int v5558=v3106+1;
+  int v5559=v741+4;
+  int v5560=v2258+8;
+  int v5561=v1857+5;
+  int v5562=v2065+4;
+  int v5563=v4784+5;
+  int v5564=v1624+2;
+  int v5565=v2924+4;
+  int v5566=v3648+4;
+  int v5567=v1426+4;
+  int v5568=v1810+4;
+  int v5569=v4496+5;
+  int v5570=v1453+7;
+  int v5571=v4061+3;
+  int v5572=v4638+1;
+  int v5573=v3118+9;
+  int v5574=v5360+1;
+  int v5575=v1692+1;
+  int v5576=v2337+8;
+  int v5577=v669+7;
+  int v5578=v3963+3;
+  int v5579=v2835+4;
+  int v5580=v4898+8;
+  int v5581=v4209+3;
+  int v5582=v4229+4;
+  int v5583=v2219+4;
+  int v5584=v461+3;
+  int v5585=v2099+9;
+  int v5586=v2832+3;
+  int v5587=v1354+0;
+  int v5588=v975+7;
+  int v5589=v25+2;
+  int v5590=v4110+1;
+  int v5591=v2005+0;
+  int v5592=v350+7;
+  int v5593=v3458+6;
+  int v5594=v784+3;
+  int v5595=v2205+5;
+  int v5596=v4236+9;
+  int v5597=v2902+2;
+  int v5598=v2540+9;
+  int v5599=v3246+0;
+  int v5600=v4425+4;
+  int v5601=v4046+2;
+  int v5602=v2030+1;
+  int v5603=v4241+4;
+  int v5604=v3435+7;
+  int v5605=v313+2;
+  int v5606=v3837+4;
+  int v5607=v2432+0;
+  int v5608=v2507+2;
+  int v5609=v79+5;
+  int v5610=v1081+8;
+  int v5611=v2795+9;
+  int v5612=v3490+1;
+  int v5613=v4009+9;
+  int v5614=v5570+7;
+  int v5615=v2246+0;
+  int v5616=v2958+2;
+  int v5617=v4480+9;
+  int v5618=v2006+5;
+  int v5619=v5450+1;
+  int v5620=v3993+6;
+  int v5621=v561+4;
+  int v5622=v609+5;
+  int v5623=v4602+7;
+  int v5624=v5321+8;
+  int v5625=v2413+5;
+  int v5626=v1922+2;
+  int v5627=v5019+5;
+  int v5628=v1391+0;
+  int v5629=v69+2;
+  int v5630=v1537+4;
+  int v5631=v2274+6;
+  int v5632=v3817+0;
+  int v5633=v4598+7;
+  int v5634=v5597+1;
+  int v5635=v1049+7;
+  int v5636=v3930+4;
+  int v5637=v4433+6;
+  int v5638=v1568+4;
+  int v5639=v509+9;
+  int v5640=v1020+6;
+  int v5641=v93+5;
+  int v5642=v626+3;
+  int v5643=v1749+6;
+  int v5644=v2986+4;
+  int v5645=v4827+0;
+  int v5646=v4246+0;
+  int v5647=v2139+0;
+  int v5648=v885+6;
+  int v5649=v2837+5;
+  int v5650=v5522+3;
+  int v5651=v5399+3;
+  int v5652=v5100+6;
+  int v5653=v2671+8;
+  int v5654=v5229+0;
+  int v5655=v2989+5;
+  int v5656=v237+1;
+  int v5657=v700+5;
+  int v5658=v1102+4;
+  int v5659=v666+5;
+  int v5660=v3837+8;
+  int v5661=v943+7;
+  int v5662=v2486+7;
+  int v5663=v1310+5;
+  int v5664=v511+6;
+  int v5665=v4317+5;
+  int v5666=v4844+0;
+  int v5667=v2847+0;
+  int v5668=v3851+4;
+  int v5669=v2841+0;
+  int v5670=v3331+0;
+  int v5671=v3986+6;
+  int v5672=v5004+3;
+  int v5673=v3020+6;
+  int v5674=v506+0;
+  int v5675=v4814+9;
+  int v5676=v2143+4;
+  int v5677=v3981+3;
+  int v5678=v1620+6;
+  int v5679=v420+3;
+  int v5680=v4792+4;
+  int v5681=v276+6;
+  int v5682=v705+1;
+  int v5683=v5046+0;
+  int v5684=v4944+7;
+  int v5685=v5041+4;
+  int v5686=v451+7;
+  int v5687=v430+1;
+  int v5688=v2322+8;
+  int v5689=v4937+3;
+  int v5690=v3819+2;
+  int v5691=v2673+7;
+  int v5692=v4617+3;
+  int v5693=v4045+6;
+  int v5694=v3226+6;
+  int v5695=v5204+7;
+  int v5696=v2484+3;
+  int v5697=v2008+1;
+  int v5698=v2480+8;
+  int v5699=v3105+3;
+  int v5700=v4196+0;
+  int v5701=v4910+6;
+  int v5702=v1434+1;
+  int v5703=v5576+0;
+  int v5704=v3131+7;
+  int v5705=v4903+9;
+  int v5706=v441+1;
+  int v5707=v1445+2;
+  int v5708=v3894+3;
+  int v5709=v4853+7;
+  int v5710=v1696+5;
+  int v5711=v151+4;
+  int v5712=v2860+5;
+  int v5713=v2688+8;
+  int v5714=v4907+8;
+  int v5715=v487+9;
+  int v5716=v288+0;
+  int v5717=v4522+3;
+  int v5718=v3828+8;
+  int v5719=v894+2;
+  int v5720=v2052+1;
+  int v5721=v605+5;
+  int v5722=v2697+6;
+  int v5723=v4323+3;
+  int v5724=v543+3;
+  int v5725=v1810+4;
+  int v5726=v2435+7;
+  int v5727=v1460+8;
+  int v5728=v881+0;
+  int v5729=v4125+3;
+  int v5730=v2361+8;
+  int v5731=v4293+8;
+  int v5732=v1718+5;
+  int v5733=v3825+9;
+  int v5734=v352+3;
+  int v5735=v4822+9;
+  int v5736=v3829+5;
+  int v5737=v2467+3;
+  int v5738=v4946+6;
+  int v5739=v1615+9;
+  int v5740=v5106+3;
+  int v5741=v3405+2;
+  int v5742=v1622+9;
+  int v5743=v870+1;
+  int v5744=v469+5;
+  int v5745=v1395+9;
+  int v5746=v1706+7;
+  int v5747=v4098+6;
+  int v5748=v677+0;
+  int v5749=v5270+1;
+  int v5750=v2149+8;
+  int v5751=v2283+4;
+  int v5752=v895+2;
+  int v5753=v3543+5;
+  int v5754=v3156+0;
+  int v5755=v5438+9;
+  int v5756=v5599+5;
+  int v5757=v4895+9;
+  int v5758=v5200+0;
+  int v5759=v4710+8;
+  int v5760=v1467+0;
+  int v5761=v3497+0;
+  int v5762=v5509+6;
+  int v5763=v146+2;
+  int v5764=v411+9;
+  int v5765=v4534+2;
+  int v5766=v1332+5;
+  int v5767=v1039+8;
+  int v5768=v2972+6;
+  int v5769=v1040+8;
+  int v5770=v1953+0;
+  int v5771=v5248+5;
+  int v5772=v2861+8;
+  int v5773=v4689+2;
+  int v5774=v756+6;
+  int v5775=v127+2;
+  int v5776=v2933+1;
+  int v5777=v1898+7;
+  int v5778=v5624+2;
+  int v5779=v909+8;
+  int v5780=v2867+0;
+  int v5781=v2307+4;
+  int v5782=v2999+6;
+  int v5783=v4426+8;
+  int v5784=v1926+6;
+  int v5785=v1533+0;
+  int v5786=v1678+8;
+  int v5787=v4679+8;
+  int v5788=v4160+6;
+  int v5789=v3741+0;
+  int v5790=v4550+8;
+  int v5791=v5620+3;
+  int v5792=v375+3;
+  int v5793=v3210+4;
+  int v5794=v3423+2;
+  int v5795=v352+7;
+  int v5796=v3659+0;
+  int v5797=v2147+2;
+  int v5798=v1992+6;
+  int v5799=v4162+1;
+  int v5800=v4170+4;
+  int v5801=v5237+0;
+  int v5802=v5100+1;
+  int v5803=v1124+8;
+  int v5804=v432+1;
+  int v5805=v2156+3;
+  int v5806=v5060+8;
+  int v5807=v2872+2;
+  int v5808=v2570+9;
+  int v5809=v3055+8;
+  int v5810=v2820+2;
+  int v5811=v2288+8;
+  int v5812=v5579+4;
+  int v5813=v913+8;
+  int v5814=v194+0;
+  int v5815=v3504+5;
+  int v5816=v4089+3;
+  int v5817=v5152+9;
+  int v5818=v4677+2;
+  int v5819=v5072+0;
+  int v5820=v2155+6;
+  int v5821=v4629+2;
+  int v5822=v181+1;
+  int v5823=v4337+8;
+  int v5824=v1256+1;
+  int v5825=v4954+3;
+  int v5826=v2444+5;
+  int v5827=v60+7;
+  int v5828=v1328+9;
+  int v5829=v4496+7;
+  int v5830=v580+8;
+  int v5831=v3759+2;
+  int v5832=v1470+1;
+  int v5833=v1161+3;
+  int v5834=v1543+6;
+  int v5835=v36+2;
+  int v5836=v800+9;
+  int v5837=v4385+6;
+  int v5838=v580+1;
+  int v5839=v3909+2;
+  int v5840=v499+7;
+  int v5841=v20+4;
+  int v5842=v142+7;
+  int v5843=v2798+9;
+  int v5844=v756+6;
+  int v5845=v436+7;
+  int v5846=v2729+1;
+  int v5847=v4740+7;
+  int v5848=v5725+6;
+  int v5849=v3776+5;
+  int v5850=v4145+5;
+  int v5851=v233+2;
+  int v5852=v1444+2;
+  int v5853=v754+1;
+  int v5854=v3813+2;
+  int v5855=v685+5;
+  int v5856=v1934+6;
+  int v5857=v5750+9;
+  int v5858=v4243+0;
+  int v5859=v3199+2;
+  int v5860=v4464+4;
+  int v5861=v4829+3;
+  int v5862=v3248+2;
+  int v5863=v2414+0;
+  int v5864=v5861+1;
+  int v5865=v4085+5;
+  int v5866=v587+2;
+  int v5867=v4841+4;
+  int v5868=v3607+8;
+  int v5869=v1963+5;
+  int v5870=v4462+5;
+  int v5871=v1794+4;
+  int v5872=v5258+2;
+  int v5873=v3896+4;
+  int v5874=v4991+7;
+  int v5875=v868+3;
+  int v5876=v2342+1;
+  int v5877=v5086+6;
+  int v5878=v4567+8;
+  int v5879=v2650+1;
+  int v5880=v671+1;
+  int v5881=v4523+0;
+  int v5882=v1101+2;
+  int v5883=v282+1;
+  int v5884=v306+8;
+  int v5885=v3863+5;
+  int v5886=v4617+1;
+  int v5887=v4350+6;
+  int v5888=v777+2;
+  int v5889=v1638+5;
+  int v5890=v3603+0;
+  int v5891=v5122+3;
+  int v5892=v1649+3;
+  int v5893=v657+3;
+  int v5894=v3692+9;
+  int v5895=v4565+0;
+  int v5896=v1699+7;
+  int v5897=v2998+5;
+  int v5898=v3336+4;
+  int v5899=v2769+5;
+  int v5900=v2816+7;
+  int v5901=v2373+9;
+  int v5902=v4438+3;
+  int v5903=v2447+3;
+  int v5904=v5098+5;
+  int v5905=v1333+3;
+  int v5906=v5488+4;
+  int v5907=v1433+1;
+  int v5908=v574+8;
+  int v5909=v3486+1;
+  int v5910=v831+7;
+  int v5911=v2475+9;
+  int v5912=v5681+2;
+  int v5913=v5607+8;
+  int v5914=v907+2;
+  int v5915=v4639+7;
+  int v5916=v3440+5;
+  int v5917=v4837+7;
+  int v5918=v4503+1;
+  int v5919=v2105+9;
+  int v5920=v5396+9;
+  int v5921=v2935+1;
+  int v5922=v1732+6;
+  int v5923=v3834+4;
+  int v5924=v2417+6;
+  int v5925=v2515+0;
+  int v5926=v148+6;
+  int v5927=v4941+1;
+  int v5928=v1144+8;
+  int v5929=v1252+5;
+  int v5930=v98+1;
+  int v5931=v5116+0;
+  int v5932=v699+2;
+  int v5933=v1649+4;
+  int v5934=v3877+2;
+  int v5935=v1403+5;
+  int v5936=v235+7;
+  int v5937=v4483+5;
+  int v5938=v5855+2;
+  int v5939=v1029+0;
+  int v5940=v249+6;
+  int v5941=v5108+9;
+  int v5942=v1420+0;
+  int v5943=v4239+0;
+  int v5944=v2988+6;
+  int v5945=v4683+3;
+  int v5946=v2984+4;
+  int v5947=v221+0;
+  int v5948=v1908+5;
+  int v5949=v3352+5;
+  int v5950=v3773+1;
+  int v5951=v4120+3;
+  int v5952=v1612+6;
+  int v5953=v3400+7;
+  int v5954=v2507+9;
+  int v5955=v3872+8;
+  int v5956=v4737+2;
+  int v5957=v422+5;
+  int v5958=v1797+3;
+  int v5959=v422+2;
+  int v5960=v532+5;
+  int v5961=v2630+7;
+  int v5962=v3846+3;
+  int v5963=v3174+7;
+  int v5964=v2100+9;
+  int v5965=v1881+1;
+  int v5966=v1788+2;
+  int v5967=v473+0;
+  int v5968=v5043+1;
+  int v5969=v4365+7;
+  int v5970=v3342+6;
+  int v5971=v4782+8;
+  int v5972=v3256+1;
+  int v5973=v4463+7;
+  int v5974=v1754+6;
+  int v5975=v4997+4;
+  int v5976=v1135+1;
+  int v5977=v4780+3;
+  int v5978=v4022+0;
+  int v5979=v2906+5;
+  int v5980=v3952+2;
+  int v5981=v2056+8;
+  int v5982=v2393+0;
+  int v5983=v5242+4;
+  int v5984=v3049+9;
+  int v5985=v3598+5;
+  int v5986=v1736+0;
+  int v5987=v323+9;
+  int v5988=v4436+0;
+  int v5989=v1573+6;
+  int v5990=v1603+9;
+  int v5991=v789+7;
+  int v5992=v5669+3;
+  int v5993=v5358+3;
+  int v5994=v4160+4;
+  int v5995=v5503+8;
+  int v5996=v4089+4;
+  int v5997=v1607+3;
+  int v5998=v1797+9;
+  int v5999=v5536+1;
+  int v6000=v694+6;
+  int v6001=v5869+9;
+  int v6002=v5879+0;
+  int v6003=v3338+2;
+  int v6004=v4844+8;
+  int v6005=v21+4;
+  int v6006=v5172+4;
+  int v6007=v5052+8;
+  int v6008=v3022+9;
+  int v6009=v2824+9;
+  int v6010=v3379+6;
+  int v6011=v2580+1;
+  int v6012=v3140+7;
+  int v6013=v1109+2;
+  int v6014=v4226+0;
+  int v6015=v5326+7;
+  int v6016=v1986+5;
+  int v6017=v4473+5;
+  int v6018=v3076+5;
+  int v6019=v356+7;
+  int v6020=v3400+3;
+  int v6021=v16+3;
+  int v6022=v1175+1;
+  int v6023=v827+6;
+  int v6024=v2527+9;
+  int v6025=v4381+7;
+  int v6026=v4004+6;
+  int v6027=v3550+8;
+  int v6028=v1705+2;
+  int v6029=v277+7;
+  int v6030=v141+5;
+  int v6031=v990+1;
+  int v6032=v3383+7;
+  int v6033=v2705+7;
+  int v6034=v1529+3;
+  int v6035=v3741+0;
+  int v6036=v2083+5;
+  int v6037=v5530+5;
+  int v6038=v5128+5;
+  int v6039=v1673+3;
+  int v6040=v3259+7;
+  int v6041=v4858+9;
+  int v6042=v2834+1;
+  int v6043=v3664+1;
+  int v6044=v1706+4;
+  int v6045=v1503+7;
+  int v6046=v1670+8;
+  int v6047=v4715+2;
+  int v6048=v4366+0;
+  int v6049=v2301+3;
+  int v6050=v1498+1;
+  int v6051=v6045+3;
+  int v6052=v1236+4;
+  int v6053=v40+0;
+  int v6054=v423+5;
+  int v6055=v802+2;
+  int v6056=v4284+2;
+  int v6057=v847+5;
+  int v6058=v5016+3;
+  int v6059=v3956+0;
+  int v6060=v1153+7;
+  int v6061=v3907+4;
+  int v6062=v3467+2;
+  int v6063=v2563+6;
+  int v6064=v3254+5;
+  int v6065=v3877+5;
+  int v6066=v5348+0;
+  int v6067=v1388+8;
+  int v6068=v1793+4;
+  int v6069=v1411+3;
+  int v6070=v5062+6;
+  int v6071=v5328+7;
+  int v6072=v5393+1;
+  int v6073=v3666+8;
+  int v6074=v1862+1;
+  int v6075=v1141+4;
+  int v6076=v1833+6;
+  int v6077=v1661+6;
+  int v6078=v4847+4;
+  int v6079=v4254+4;
+  int v6080=v1119+2;
+  int v6081=v525+0;
+  int v6082=v4045+7;
+  int v6083=v1442+0;
+  int v6084=v3886+0;
+  int v6085=v3495+3;
+  int v6086=v2046+3;
+  int v6087=v2035+9;
+  int v6088=v4100+6;
+  int v6089=v733+4;
+  int v6090=v520+2;
+  int v6091=v4764+2;
+  int v6092=v3758+0;
+  int v6093=v5782+2;
+  int v6094=v2430+0;
+  int v6095=v5154+5;
+  int v6096=v1697+4;
+  int v6097=v5848+5;
+  int v6098=v667+6;
+  int v6099=v3144+0;
+  int v6100=v1239+2;
+  int v6101=v3641+4;
+  int v6102=v5932+1;
+  int v6103=v1416+4;
+  int v6104=v254+3;
+  int v6105=v5766+7;
+  int v6106=v5212+2;
+  int v6107=v5345+1;
+  int v6108=v4777+2;
+  int v6109=v2750+5;
+  int v6110=v5831+9;
+  int v6111=v1505+9;
+  int v6112=v3143+6;
+  int v6113=v0+3;
+  int v6114=v908+4;
+  int v6115=v1078+8;
+  int v6116=v3109+3;
+  int v6117=v254+0;
+  int v6118=v5617+4;
+  int v6119=v4098+1;
+  int v6120=v5285+6;
+  int v6121=v1183+8;
+  int v6122=v845+5;
+  int v6123=v909+9;
+  int v6124=v2188+5;
+  int v6125=v6026+7;
+  int v6126=v1597+2;
+  int v6127=v4712+6;
+  int v6128=v773+5;
+  int v6129=v5880+9;
+  int v6130=v2582+6;
+  int v6131=v3880+3;
+  int v6132=v2382+3;
+  int v6133=v4725+9;
+  int v6134=v4701+5;
+  int v6135=v5658+5;
+  int v6136=v2568+4;
+  int v6137=v3938+1;
+  int v6138=v2190+5;
+  int v6139=v790+8;
+  int v6140=v3325+7;
+  int v6141=v3832+9;
+  int v6142=v3271+8;
+  int v6143=v3722+8;
+  int v6144=v4854+5;
+  int v6145=v5498+8;
+  int v6146=v2452+7;
+  int v6147=v2502+6;
+  int v6148=v2252+8;
+  int v6149=v2483+2;
+  int v6150=v2371+3;
+  int v6151=v4766+2;
+  int v6152=v3236+4;
+  int v6153=v151+0;
+  int v6154=v5110+1;
+  int v6155=v3356+0;
+  int v6156=v4233+5;
+  int v6157=v298+3;
+  int v6158=v2461+7;
+  int v6159=v1024+4;
+  int v6160=v1246+0;
+  int v6161=v5766+0;
+  int v6162=v3340+4;
+  int v6163=v2790+0;
+  int v6164=v3332+1;
+  int v6165=v5825+1;
+  int v6166=v1954+2;
+  int v6167=v4447+3;
+  int v6168=v4777+7;
+  int v6169=v1589+4;
+  int v6170=v3517+2;
+  int v6171=v5961+8;
+  int v6172=v4835+0;
+  int v6173=v4033+5;
+  int v6174=v5551+5;
+  int v6175=v1409+0;
+  int v6176=v1722+2;
+  int v6177=v1427+7;
+  int v6178=v2723+3;
+  int v6179=v4288+6;
+  int v6180=v5609+3;
+  int v6181=v3440+9;
+  int v6182=v3528+3;
+  int v6183=v2550+7;
+  int v6184=v4970+8;
+  int v6185=v6073+2;
+  int v6186=v3182+2;
+  int v6187=v3951+4;
+  int v6188=v1495+3;
+  int v6189=v3622+7;
+  int v6190=v1265+5;
+  int v6191=v5417+7;
+  int v6192=v5860+9;
+  int v6193=v5394+3;
+  int v6194=v3005+1;
+  int v6195=v4617+8;
+  int v6196=v3269+8;
+  int v6197=v1770+6;
+  int v6198=v810+5;
+  int v6199=v996+3;
+  int v6200=v4108+7;
+  int v6201=v2631+7;
+  int v6202=v2709+2;
+  int v6203=v2712+9;
+  int v6204=v2277+6;
+  int v6205=v2407+2;
+  int v6206=v3503+6;
+  int v6207=v2711+4;
+  int v6208=v3455+9;
+  int v6209=v2459+4;
+  int v6210=v1907+0;
+  int v6211=v1995+9;
+  int v6212=v4364+2;
+  int v6213=v1457+4;
+  int v6214=v595+4;
+  int v6215=v272+0;
+  int v6216=v3344+5;
+  int v6217=v158+4;
+  int v6218=v1922+7;
+  int v6219=v971+9;
+  int v6220=v2873+8;
+  int v6221=v253+5;
+  int v6222=v1543+5;
+  int v6223=v4630+8;
+  int v6224=v430+5;
+  int v6225=v1980+2;
+  int v6226=v4630+1;
+  int v6227=v2536+7;
+  int v6228=v4992+1;
+  int v6229=v1292+1;
+  int v6230=v5252+4;
+  int v6231=v1854+5;
+  int v6232=v3583+9;
+  int v6233=v3631+1;
+  int v6234=v1026+1;
+  int v6235=v5013+0;
+  int v6236=v5985+5;
+  int v6237=v236+9;
+  int v6238=v560+8;
+  int v6239=v508+5;
+  int v6240=v1071+3;
+  int v6241=v4284+5;
+  int v6242=v4748+2;
+  int v6243=v2258+0;
+  int v6244=v2536+0;
+  int v6245=v990+7;
+  int v6246=v2019+6;
+  int v6247=v6003+2;
+  int v6248=v198+8;
+  int v6249=v2663+3;
+  int v6250=v812+4;
+  int v6251=v3959+4;
+  int v6252=v5693+4;
+  int v6253=v1837+5;
+  int v6254=v3340+6;
+  int v6255=v4490+3;
+  int v6256=v2066+5;
+  int v6257=v5166+9;
+  int v6258=v1439+3;
+  int v6259=v3597+9;
+  int v6260=v5253+8;
+  int v6261=v5852+5;
+  int v6262=v2112+8;
+  int v6263=v6091+7;
+  int v6264=v5970+0;
+  int v6265=v6078+1;
+  int v6266=v4824+8;
+  int v6267=v280+3;
+  int v6268=v979+5;
+  int v6269=v2072+6;
+  int v6270=v431+0;
+  int v6271=v4113+4;
+  int v6272=v5075+3;
+  int v6273=v1881+2;
+  int v6274=v1760+8;
+  int v6275=v6245+9;
+  int v6276=v1436+0;
+  int v6277=v5689+6;
+  int v6278=v3127+5;
+  int v6279=v2884+0;
+  int v6280=v4216+9;
+  int v6281=v2557+2;
+  int v6282=v428+6;
+  int v6283=v163+9;
+  int v6284=v2111+6;
+  int v6285=v4003+6;
+  int v6286=v2176+0;
+  int v6287=v4198+6;
+  int v6288=v4627+6;
+  int v6289=v2498+6;
+  int v6290=v3307+8;
+  int v6291=v5006+8;
+  int v6292=v5886+3;
+  int v6293=v2165+6;
+  int v6294=v3242+9;
+  int v6295=v1761+6;
+  int v6296=v23+7;
+  int v6297=v3333+8;
+  int v6298=v1161+8;
+  int v6299=v1348+2;
+  int v6300=v443+7;
+  int v6301=v4634+4;
+  int v6302=v3764+6;
+  int v6303=v303+3;
+  int v6304=v3792+1;
+  int v6305=v5253+4;
+  int v6306=v1603+5;
+  int v6307=v1266+0;
+  int v6308=v5403+3;
+  int v6309=v480+0;
+  int v6310=v1765+8;
+  int v6311=v4158+9;
+  int v6312=v3248+4;
+  int v6313=v4756+7;
+  int v6314=v5583+2;
+  int v6315=v4036+0;
+  int v6316=v5797+8;
+  int v6317=v1896+9;
+  int v6318=v1666+7;
+  int v6319=v3014+2;
+  int v6320=v6145+4;
+  int v6321=v4469+5;
+  int v6322=v391+4;
+  int v6323=v4671+8;
+  int v6324=v175+2;
+  int v6325=v2914+7;
+  int v6326=v280+7;
+  int v6327=v4570+9;
+  int v6328=v2417+9;
+  int v6329=v3754+7;
+  int v6330=v2960+9;
+  int v6331=v894+1;
+  int v6332=v5938+5;
+  int v6333=v2465+1;
+  int v6334=v5400+5;
+  int v6335=v5033+7;
+  int v6336=v2540+1;
+  int v6337=v739+8;
+  int v6338=v4813+7;
+  int v6339=v4742+2;
+  int v6340=v3054+4;
+  int v6341=v4136+8;
+  int v6342=v989+0;
+  int v6343=v3708+2;
+  int v6344=v1761+5;
+  int v6345=v206+2;
+  int v6346=v4912+6;
+  int v6347=v1469+0;
+  int v6348=v6282+3;
+  int v6349=v817+9;
+  int v6350=v4829+5;
+  int v6351=v1836+2;
+  int v6352=v3710+7;
+  int v6353=v5483+6;
+  int v6354=v1162+9;
+  int v6355=v562+9;
+  int v6356=v5687+4;
+  int v6357=v520+9;
+  int v6358=v2902+6;
+  int v6359=v699+6;
+  int v6360=v5615+3;
+  int v6361=v4481+6;
+  int v6362=v5400+3;
+  int v6363=v945+4;
+  int v6364=v4466+8;
+  int v6365=v3491+1;
+  int v6366=v1164+9;
+  int v6367=v3938+2;
+  int v6368=v169+4;
+  int v6369=v4791+7;
+  int v6370=v4800+0;
+  int v6371=v1253+6;
+  int v6372=v4268+9;
+  int v6373=v4922+8;
+  int v6374=v6303+0;
+  int v6375=v936+5;
+  int v6376=v1737+4;
+  int v6377=v5188+7;
+  int v6378=v5325+1;
+  int v6379=v2348+3;
+  int v6380=v222+1;
+  int v6381=v2484+8;
+  int v6382=v153+4;
+  int v6383=v5074+2;
+  int v6384=v279+5;
+  int v6385=v3026+6;
+  int v6386=v3009+5;
+  int v6387=v1011+5;
+  int v6388=v4485+7;
+  int v6389=v1063+1;
+  int v6390=v657+2;
+  int v6391=v5979+3;
+  int v6392=v513+9;
+  int v6393=v3653+9;
+  int v6394=v2485+3;
+  int v6395=v5921+6;
+  int v6396=v1581+0;
+  int v6397=v3929+9;
+  int v6398=v1661+0;
+  int v6399=v1973+1;
+  int v6400=v4776+7;
+  int v6401=v3358+6;
+  int v6402=v4915+6;
+  int v6403=v1573+3;
+  int v6404=v3908+8;
+  int v6405=v4731+5;
+  int v6406=v1299+8;
+  int v6407=v5630+6;
+  int v6408=v1653+1;
+  int v6409=v329+8;
+  int v6410=v4289+6;
+  int v6411=v4493+5;
+  int v6412=v2267+6;
+  int v6413=v3690+9;
+  int v6414=v1788+1;
+  int v6415=v2896+6;
+  int v6416=v1991+5;
+  int v6417=v302+8;
+  int v6418=v3540+4;
+  int v6419=v5089+2;
+  int v6420=v2437+2;
+  int v6421=v548+5;
+  int v6422=v1477+4;
+  int v6423=v3729+4;
+  int v6424=v3762+8;
+  int v6425=v348+5;
+  int v6426=v2860+5;
+  int v6427=v4098+5;
+  int v6428=v342+1;
+  int v6429=v2598+2;
+  int v6430=v6+3;
+  int v6431=v2822+5;
+  int v6432=v5543+0;
+  int v6433=v1687+3;
+  int v6434=v6361+8;
+  int v6435=v3907+6;
+  int v6436=v175+4;
+  int v6437=v2298+0;
+  int v6438=v5382+4;
+  int v6439=v702+0;
+  int v6440=v4697+8;
+  int v6441=v1481+3;
+  int v6442=v823+1;
+  int v6443=v4669+4;
+  int v6444=v6019+2;
+  int v6445=v4208+9;
+  int v6446=v6093+6;
+  int v6447=v4221+9;
+  int v6448=v936+4;
+  int v6449=v5888+2;
+  int v6450=v5378+1;
+  int v6451=v4560+1;
+  int v6452=v5051+6;
+  int v6453=v2113+5;
+  int v6454=v2028+3;
+  int v6455=v578+8;
+  int v6456=v3957+8;
+  int v6457=v5061+1;
+  int v6458=v244+3;
+  int v6459=v1749+7;
+  int v6460=v4224+8;
+  int v6461=v3258+2;
+  int v6462=v5780+7;
+  int v6463=v2476+0;
+  int v6464=v2820+7;
+  int v6465=v229+8;
+  int v6466=v366+8;
+  int v6467=v2721+6;
+  int v6468=v412+8;
+  int v6469=v1506+5;
+  int v6470=v2771+7;
+  int v6471=v3868+9;
+  int v6472=v1767+6;
+  int v6473=v5174+9;
+  int v6474=v5084+6;
+  int v6475=v4575+5;
+  int v6476=v4423+7;
+  int v6477=v3373+3;
+  int v6478=v1224+0;
+  int v6479=v967+8;
+  int v6480=v1924+3;
+  int v6481=v2694+4;
+  int v6482=v1453+1;
+  int v6483=v2598+7;
+  int v6484=v697+9;
+  int v6485=v3570+9;
+  int v6486=v3063+1;
+  int v6487=v3552+7;
+  int v6488=v243+7;
+  int v6489=v6363+8;
+  int v6490=v3629+7;
+  int v6491=v4579+5;
+  int v6492=v1953+7;
+  int v6493=v655+1;
+  int v6494=v1549+9;
+  int v6495=v3209+0;
+  int v6496=v890+4;
+  int v6497=v3872+8;
+  int v6498=v6298+8;
+  int v6499=v766+6;
+  int v6500=v3184+8;
+  int v6501=v4234+5;
+  int v6502=v346+0;
+  int v6503=v479+8;
+  int v6504=v1662+8;
+  int v6505=v1996+3;
+  int v6506=v3653+0;
+  int v6507=v117+5;
+  int v6508=v5476+6;
+  int v6509=v3113+2;
+  int v6510=v5088+2;
+  int v6511=v2755+9;
+  int v6512=v1807+4;
+  int v6513=v3561+8;
+  int v6514=v3978+6;
+  int v6515=v981+7;
+  int v6516=v4557+1;
+  int v6517=v4886+4;
+  int v6518=v1271+6;
+  int v6519=v376+3;
+  int v6520=v5794+0;
+  int v6521=v4068+1;
+  int v6522=v5087+1;
+  int v6523=v4871+1;
+  int v6524=v79+1;
+  int v6525=v632+3;
+  int v6526=v1316+5;
+  int v6527=v4881+5;
+  int v6528=v4323+3;
+  int v6529=v3986+0;
+  int v6530=v4711+9;
+  int v6531=v2683+5;
+  int v6532=v3824+6;
+  int v6533=v669+7;
+  int v6534=v5034+5;
+  int v6535=v1674+5;
+  int v6536=v1740+3;
+  int v6537=v5531+5;
+  int v6538=v4885+1;
+  int v6539=v774+0;
+  int v6540=v3469+1;
+  int v6541=v5899+0;
+  int v6542=v2046+0;
+  int v6543=v173+2;
+  int v6544=v2302+2;
+  int v6545=v845+2;
+  int v6546=v5094+1;
+  int v6547=v3607+9;
+  int v6548=v1223+0;
+  int v6549=v5870+8;
+  int v6550=v1142+6;
+  int v6551=v4054+9;
+  int v6552=v1983+9;
+  int v6553=v2836+3;
+  int v6554=v4546+5;
+  int v6555=v3635+2;
+  int v6556=v1819+7;
+  int v6557=v148+1;
+  int v6558=v2172+5;
+  int v6559=v382+2;
+  int v6560=v3541+0;
+  int v6561=v6331+2;
+  int v6562=v1014+9;
+  int v6563=v3421+7;
+  int v6564=v407+4;
+  int v6565=v3362+1;
+  int v6566=v473+5;
+  int v6567=v4052+5;
+  int v6568=v4701+5;
+  int v6569=v1572+4;
+  int v6570=v15+7;
+  int v6571=v4939+7;
+  int v6572=v119+0;
+  int v6573=v805+7;
+  int v6574=v278+5;
+  int v6575=v2983+4;
+  int v6576=v36+0;
+  int v6577=v1093+2;
+  int v6578=v3313+5;
+  int v6579=v1433+5;
+  int v6580=v2253+3;
+  int v6581=v5965+5;
+  int v6582=v163+7;
+  int v6583=v1883+7;
+  int v6584=v2990+4;
+  int v6585=v785+3;
+  int v6586=v4530+5;
+  int v6587=v3180+4;
+  int v6588=v326+9;
+  int v6589=v3938+2;
+  int v6590=v147+1;
+  int v6591=v3991+8;
+  int v6592=v1542+9;
+  int v6593=v1738+1;
+  int v6594=v1858+3;
+  int v6595=v4002+1;
+  int v6596=v2898+9;
+  int v6597=v1575+9;
+  int v6598=v6170+7;
+  int v6599=v2013+1;
+  int v6600=v467+6;
+  int v6601=v2664+0;
+  int v6602=v4028+8;
+  int v6603=v582+3;
+  int v6604=v1254+6;
+  int v6605=v1064+8;
+  int v6606=v6453+1;
+  int v6607=v4593+6;
+  int v6608=v3217+1;
+  int v6609=v5760+4;
+  int v6610=v4976+4;
+  int v6611=v5129+8;
+  int v6612=v6397+4;
+  int v6613=v1980+0;
+  int v6614=v823+2;
+  int v6615=v4271+2;
+  int v6616=v4799+6;
+  int v6617=v1809+0;
+  int v6618=v5323+5;
+  int v6619=v532+2;
+  int v6620=v1588+0;
+  int v6621=v1630+5;
+  int v6622=v1473+5;
+  int v6623=v4974+0;
+  int v6624=v3499+5;
+  int v6625=v5406+3;
+  int v6626=v6026+5;
+  int v6627=v527+0;
+  int v6628=v3690+7;
+  int v6629=v5364+9;
+  int v6630=v323+9;
+  int v6631=v5614+4;
+  int v6632=v5502+6;
+  int v6633=v4444+7;
+  int v6634=v315+5;
+  int v6635=v1060+8;
+  int v6636=v1781+0;
+  int v6637=v1218+3;
+  int v6638=v2088+0;
+  int v6639=v642+7;
+  int v6640=v2692+5;
+  int v6641=v2998+0;
+  int v6642=v3234+3;
+  int v6643=v2574+4;
+  int v6644=v6244+3;
+  int v6645=v682+0;
+  int v6646=v746+7;
+  int v6647=v4240+1;
+  int v6648=v5026+6;
+  int v6649=v5109+2;
+  int v6650=v5793+2;
+  int v6651=v1169+4;
+  int v6652=v4045+4;
+  int v6653=v5994+2;
+  int v6654=v1080+4;
+  int v6655=v6600+0;
+  int v6656=v532+0;
+  int v6657=v4255+4;
+  int v6658=v836+4;
+  int v6659=v6089+5;
+  int v6660=v3739+8;
+  int v6661=v3482+8;
+  int v6662=v305+0;
+  int v6663=v4820+6;
+  int v6664=v2917+7;
+  int v6665=v5981+4;
+  int v6666=v3364+1;
+  int v6667=v2013+5;
+  int v6668=v3150+2;
+  int v6669=v6610+5;
+  int v6670=v5264+8;
+  int v6671=v5965+7;
+  int v6672=v1035+8;
+  int v6673=v4829+5;
+  int v6674=v3475+9;
+  int v6675=v183+5;
+  int v6676=v4637+8;
+  int v6677=v1994+1;
+  int v6678=v1604+2;
+  int v6679=v5996+5;
+  int v6680=v4227+3;
+  int v6681=v1781+9;
+  int v6682=v3519+7;
+  int v6683=v4174+1;
+  int v6684=v3667+1;
+  int v6685=v4068+5;
+  int v6686=v2229+2;
+  int v6687=v4970+1;
+  int v6688=v2289+1;
+  int v6689=v2433+7;
+  int v6690=v5252+9;
+  int v6691=v6299+2;
+  int v6692=v2543+6;
+  int v6693=v1505+1;
+  int v6694=v2331+5;
+  int v6695=v4652+7;
+  int v6696=v5316+2;
+  int v6697=v473+3;
+  int v6698=v659+0;
+  int v6699=v2464+5;
+  int v6700=v2736+6;
+  int v6701=v2487+1;
+  int v6702=v5544+8;
+  int v6703=v5152+2;
+  int v6704=v1007+3;
+  int v6705=v5564+8;
+  int v6706=v6587+8;
+  int v6707=v6141+4;
+  int v6708=v1493+7;
+  int v6709=v3831+5;
+  int v6710=v5986+8;
+  int v6711=v4898+4;
+  int v6712=v3544+6;
+  int v6713=v463+5;
+  int v6714=v513+2;
+  int v6715=v6123+4;
+  int v6716=v1586+6;
+  int v6717=v6661+7;
+  int v6718=v2976+5;
+  int v6719=v6450+9;
+  int v6720=v1042+0;
+  int v6721=v6246+0;
+  int v6722=v3096+0;
+  int v6723=v5184+4;
+  int v6724=v4943+2;
+  int v6725=v4846+3;
+  int v6726=v949+7;
+  int v6727=v2237+1;
+  int v6728=v4325+9;
+  int v6729=v6708+0;
+  int v6730=v465+0;
+  int v6731=v2769+1;
+  int v6732=v2012+2;
+  int v6733=v3992+0;
+  int v6734=v6713+9;
+  int v6735=v4052+2;
+  int v6736=v4074+1;
+  int v6737=v3159+3;
+  int v6738=v6252+3;
+  int v6739=v4957+5;
+  int v6740=v4267+1;
+  int v6741=v750+6;
+  int v6742=v3930+9;
+  int v6743=v5994+5;
+  int v6744=v2224+8;
+  int v6745=v3147+5;
+  int v6746=v5801+4;
+  int v6747=v5489+4;
+  int v6748=v882+7;
+  int v6749=v1110+4;
+  int v6750=v6661+1;
+  int v6751=v843+8;
+  int v6752=v3361+9;
+  int v6753=v5468+3;
+  int v6754=v4689+1;
+  int v6755=v600+3;
+  int v6756=v3440+7;
+  int v6757=v4154+7;
+  int v6758=v5678+1;
+  int v6759=v1381+8;
+  int v6760=v6066+9;
+  int v6761=v6280+7;
+  int v6762=v2772+3;
+  int v6763=v828+2;
+  int v6764=v2216+7;
+  int v6765=v3247+1;
+  int v6766=v256+2;
+  int v6767=v4754+4;
+  int v6768=v6707+8;
+  int v6769=v2270+2;
+  int v6770=v4911+8;
+  int v6771=v2149+0;
+  int v6772=v6256+1;
+  int v6773=v3374+2;
+  int v6774=v6741+6;
+  int v6775=v1336+6;
+  int v6776=v4804+1;
+  int v6777=v4218+2;
+  int v6778=v183+6;
+  int v6779=v6155+5;
+  int v6780=v3098+5;
+  int v6781=v540+4;
+  int v6782=v3118+4;
+  int v6783=v2007+9;
+  int v6784=v3945+3;
+  int v6785=v3558+4;
+  int v6786=v2418+0;
+  int v6787=v2160+9;
+  int v6788=v5462+4;
+  int v6789=v3127+1;
+  int v6790=v3077+0;
+  int v6791=v258+0;
+  int v6792=v3897+6;
+  int v6793=v2940+3;
+  int v6794=v1508+8;
+  int v6795=v1602+4;
+  int v6796=v5638+0;
+  int v6797=v4446+0;
+  int v6798=v5231+3;
+  int v6799=v4571+0;
+  int v6800=v3824+6;
+  int v6801=v4580+0;
+  int v6802=v1361+7;
+  int v6803=v50+2;
+  int v6804=v4487+5;
+  int v6805=v2797+6;
+  int v6806=v4123+9;
+  int v6807=v5885+3;
+  int v6808=v11+3;
+  int v6809=v1357+8;
+  int v6810=v2487+4;
+  int v6811=v5328+4;
+  int v6812=v3236+7;
+  int v6813=v4150+0;
+  int v6814=v6059+1;
+  int v6815=v3428+7;
+  int v6816=v1938+1;
+  int v6817=v686+8;
+  int v6818=v1498+3;
+  int v6819=v2873+3;
+  int v6820=v508+8;
+  int v6821=v3286+4;
+  int v6822=v3877+1;
+  int v6823=v1231+5;
+  int v6824=v431+3;
+  int v6825=v6778+2;
+  int v6826=v3133+8;
+  int v6827=v921+5;
+  int v6828=v3091+3;
+  int v6829=v435+5;
+  int v6830=v6607+8;
+  int v6831=v6277+2;
+  int v6832=v4739+2;
+  int v6833=v920+5;
+  int v6834=v3015+2;
+  int v6835=v2578+1;
+  int v6836=v983+1;
+  int v6837=v3169+3;
+  int v6838=v2594+3;
+  int v6839=v65+6;
+  int v6840=v5911+1;
+  int v6841=v2408+2;
+  int v6842=v1832+2;
+  int v6843=v785+4;
+  int v6844=v4653+6;
+  int v6845=v5197+0;
+  int v6846=v2041+8;
+  int v6847=v4884+2;
+  int v6848=v3620+7;
+  int v6849=v5388+6;
+  int v6850=v3709+7;
+  int v6851=v6497+7;
+  int v6852=v128+7;
+  int v6853=v379+8;
+  int v6854=v2499+2;
+  int v6855=v5824+3;
+  int v6856=v3431+6;
+  int v6857=v1280+3;
+  int v6858=v4177+8;
+  int v6859=v6297+7;
+  int v6860=v1792+6;
+  int v6861=v2556+9;
+  int v6862=v6497+0;
+  int v6863=v2763+5;
+  int v6864=v3984+7;
+  int v6865=v3022+0;
+  int v6866=v6806+5;
+  int v6867=v1858+2;
+  int v6868=v1874+7;
+  int v6869=v4793+6;
+  int v6870=v5212+3;
+  int v6871=v2972+5;
+  int v6872=v4579+6;
+  int v6873=v531+8;
+  int v6874=v5671+1;
+  int v6875=v3280+6;
+  int v6876=v528+7;
+  int v6877=v4340+7;
+  int v6878=v5553+6;
+  int v6879=v3251+4;
+  int v6880=v4515+6;
+  int v6881=v5190+9;
+  int v6882=v1281+6;
+  int v6883=v6587+8;
+  int v6884=v2346+5;
+  int v6885=v0+6;
+  int v6886=v1315+5;
+  int v6887=v4114+1;
+  int v6888=v3555+4;
+  int v6889=v3756+3;
+  int v6890=v2967+6;
+  int v6891=v2244+0;
+  int v6892=v6321+0;
+  int v6893=v4058+6;
+  int v6894=v6233+6;
+  int v6895=v3321+8;
+  int v6896=v1845+1;
+  int v6897=v5707+8;
+  int v6898=v1982+7;
+  int v6899=v4722+4;
+  int v6900=v2266+9;
+  int v6901=v1701+4;
+  int v6902=v191+6;
+  int v6903=v4803+2;
+  int v6904=v2256+2;
+  int v6905=v4808+7;
+  int v6906=v4285+4;
+  int v6907=v1288+5;
+  int v6908=v5262+4;
+  int v6909=v1233+0;
+  int v6910=v4242+4;
+  int v6911=v1626+3;
+  int v6912=v5937+0;
+  int v6913=v1924+9;
+  int v6914=v6831+3;
+  int v6915=v4705+8;
+  int v6916=v4329+3;
+  int v6917=v4214+5;
+  int v6918=v5102+8;
+  int v6919=v834+8;
+  int v6920=v2617+2;
+  int v6921=v4370+4;
+  int v6922=v3384+6;
+  int v6923=v1004+3;
+  int v6924=v402+1;
+  int v6925=v1082+7;
+  int v6926=v6699+3;
+  int v6927=v1872+0;
+  int v6928=v6544+0;
+  int v6929=v3135+1;
+  int v6930=v83+8;
+  int v6931=v3131+6;
+  int v6932=v6596+7;
+  int v6933=v1837+1;
+  int v6934=v488+1;
+  int v6935=v5021+5;
+  int v6936=v5307+4;
+  int v6937=v3900+1;
+  int v6938=v1610+1;
+  int v6939=v6755+9;
+  int v6940=v3239+4;
+  int v6941=v2658+3;
+  int v6942=v2326+1;
+  int v6943=v3098+7;
+  int v6944=v5519+0;
+  int v6945=v5214+0;
+  int v6946=v4318+9;
+  int v6947=v4996+8;
+  int v6948=v6262+7;
+  int v6949=v3259+6;
+  int v6950=v5421+3;
+  int v6951=v124+1;
+  int v6952=v2704+7;
+  int v6953=v5817+0;
+  int v6954=v718+9;
+  int v6955=v4139+3;
+  int v6956=v3417+7;
+  int v6957=v5555+6;
+  int v6958=v3221+3;
+  int v6959=v6651+9;
+  int v6960=v6413+2;
+  int v6961=v4567+6;
+  int v6962=v4671+8;
+  int v6963=v3270+0;
+  int v6964=v574+6;
+  int v6965=v1328+9;
+  int v6966=v6842+2;
+  int v6967=v5917+9;
+  int v6968=v3137+9;
+  int v6969=v1016+9;
+  int v6970=v3108+8;
+  int v6971=v5814+5;
+  int v6972=v6469+4;
+  int v6973=v2280+6;
+  int v6974=v2838+0;
+  int v6975=v2838+3;
+  int v6976=v2909+7;
+  int v6977=v4465+4;
+  int v6978=v23+0;
+  int v6979=v4599+4;
+  int v6980=v4068+2;
+  int v6981=v4008+0;
+  int v6982=v2205+6;
+  int v6983=v6838+5;
+  int v6984=v1914+5;
+  int v6985=v1756+8;
+  int v6986=v4096+9;
+  int v6987=v6365+4;
+  int v6988=v4267+7;
+  int v6989=v786+9;
+  int v6990=v4616+6;
+  int v6991=v1491+5;
+  int v6992=v4598+4;
+  int v6993=v2149+1;
+  int v6994=v2688+4;
+  int v6995=v1220+6;
+  int v6996=v3002+1;
+  int v6997=v4822+9;
+  int v6998=v1597+1;
+  int v6999=v5517+3;
+  int v7000=v4621+4;
+  int v7001=v4103+7;
+  int v7002=v2701+9;
+  int v7003=v5849+9;
+  int v7004=v4059+3;
+  int v7005=v1645+9;
+  int v7006=v4247+4;
+  int v7007=v954+4;
+  int v7008=v760+9;
+  int v7009=v787+9;
+  int v7010=v1899+6;
+  int v7011=v4912+4;
+  int v7012=v3296+0;
+  int v7013=v2966+0;
+  int v7014=v6201+5;
+  int v7015=v254+0;
+  int v7016=v2474+4;
+  int v7017=v2876+4;
+  int v7018=v5173+0;
+  int v7019=v661+2;
+  int v7020=v6399+5;
+  int v7021=v2571+7;
+  int v7022=v787+1;
+  int v7023=v6820+2;
+  int v7024=v3332+6;
+  int v7025=v664+3;
+  int v7026=v966+5;
+  int v7027=v6312+4;
+  int v7028=v4281+5;
+  int v7029=v1879+7;
+  int v7030=v6965+0;
+  int v7031=v6208+6;
+  int v7032=v3399+1;
+  int v7033=v4176+2;
+  int v7034=v848+3;
+  int v7035=v2308+7;
+  int v7036=v1959+1;
+  int v7037=v758+5;
+  int v7038=v6490+2;
+  int v7039=v2151+6;
+  int v7040=v1115+8;
+  int v7041=v3165+0;
+  int v7042=v1838+9;
+  int v7043=v3890+4;
+  int v7044=v6486+2;
+  int v7045=v737+9;
+  int v7046=v1870+6;
+  int v7047=v6454+4;
+  int v7048=v4622+7;
+  int v7049=v4114+9;
+  int v7050=v5071+1;
+  int v7051=v483+4;
+  int v7052=v3801+7;
+  int v7053=v6642+3;
+  int v7054=v1061+8;
+  int v7055=v4630+0;
+  int v7056=v6301+1;
+  int v7057=v6956+9;
+  int v7058=v2139+5;
+  int v7059=v4869+7;
+  int v7060=v4377+3;
+  int v7061=v6102+2;
+  int v7062=v5449+8;
+  int v7063=v2780+0;
+  int v7064=v2672+3;
+  int v7065=v6822+2;
+  int v7066=v385+8;
+  int v7067=v7057+9;
+  int v7068=v5223+6;
+  int v7069=v75+3;
+  int v7070=v3396+0;
+  int v7071=v6391+8;
+  int v7072=v3903+3;
+  int v7073=v6066+8;
+  int v7074=v6320+0;
+  int v7075=v6471+0;
+  int v7076=v6379+5;
+  int v7077=v5957+4;
+  int v7078=v6715+9;
+  int v7079=v2855+1;
+  int v7080=v6742+9;
+  int v7081=v3015+0;
+  int v7082=v5030+2;
+  int v7083=v1698+8;
+  int v7084=v2677+5;
+  int v7085=v6882+0;
+  int v7086=v4589+6;
+  int v7087=v2793+1;
+  int v7088=v6038+4;
+  int v7089=v1269+4;
+  int v7090=v2609+3;
+  int v7091=v378+9;
+  int v7092=v5162+7;
+  int v7093=v1654+4;
+  int v7094=v61+0;
+  int v7095=v4844+5;
+  int v7096=v6218+7;
+  int v7097=v6233+6;
+  int v7098=v4829+6;
+  int v7099=v4624+3;
+  int v7100=v2925+2;
+  int v7101=v3314+6;
+  int v7102=v6439+7;
+  int v7103=v5569+1;
+  int v7104=v6587+4;
+  int v7105=v2571+5;
+  int v7106=v1617+9;
+  int v7107=v6088+9;
+  int v7108=v4242+6;
+  int v7109=v1315+4;
+  int v7110=v6591+8;
+  int v7111=v6692+7;
+  int v7112=v3006+0;
+  int v7113=v5736+7;
+  int v7114=v1597+3;
+  int v7115=v4028+2;
+  int v7116=v5955+6;
+  int v7117=v2490+2;
+  int v7118=v4872+9;
+  int v7119=v567+5;
+  int v7120=v4176+6;
+  int v7121=v2451+3;
+  int v7122=v2170+7;
+  int v7123=v1883+2;
+  int v7124=v3780+5;
+  int v7125=v4513+5;
+  int v7126=v3521+1;
+  int v7127=v3395+0;
+  int v7128=v1202+4;
+  int v7129=v5859+8;
+  int v7130=v6577+2;
+  int v7131=v2410+4;
+  int v7132=v6553+5;
+  int v7133=v6307+6;
+  int v7134=v4217+4;
+  int v7135=v5916+9;
+  int v7136=v5863+7;
+  int v7137=v2694+0;
+  int v7138=v882+0;
+  int v7139=v3969+0;
+  int v7140=v5722+5;
+  int v7141=v6272+3;
+  int v7142=v3850+9;
+  int v7143=v6133+7;
+  int v7144=v1006+5;
+  int v7145=v4078+5;
+  int v7146=v4790+4;
+  int v7147=v4482+4;
+  int v7148=v6767+0;
+  int v7149=v6643+5;
+  int v7150=v5294+4;
+  int v7151=v4931+7;
+  int v7152=v7037+6;
+  int v7153=v1980+3;
+  int v7154=v773+9;
+  int v7155=v4737+7;
+  int v7156=v5542+8;
+  int v7157=v5128+9;
+  int v7158=v3791+8;
+  int v7159=v3941+9;
+  int v7160=v4361+2;
+  int v7161=v5153+7;
+  int v7162=v297+4;
+  int v7163=v5584+4;
+  int v7164=v6249+4;
+  int v7165=v185+0;
+  int v7166=v1054+5;
+  int v7167=v1103+6;
+  int v7168=v3573+1;
+  int v7169=v2711+4;
+  int v7170=v6361+4;
+  int v7171=v6641+6;
+  int v7172=v2482+8;
+  int v7173=v5123+9;
+  int v7174=v6510+5;
+  int v7175=v5506+0;
+  int v7176=v3305+4;
+  int v7177=v1441+2;
+  int v7178=v479+7;
+  int v7179=v4916+6;
+  int v7180=v4366+8;
+  int v7181=v608+5;
+  int v7182=v3924+4;
+  int v7183=v7063+0;
+  int v7184=v3276+4;
+  int v7185=v4153+0;
+  int v7186=v55+3;
+  int v7187=v5097+0;
+  int v7188=v5037+8;
+  int v7189=v39+8;
+  int v7190=v2658+0;
+  int v7191=v4877+5;
+  int v7192=v4710+5;
+  int v7193=v2871+8;
+  int v7194=v6351+8;
+  int v7195=v5110+0;
+  int v7196=v3986+8;
+  int v7197=v5592+6;
+  int v7198=v6500+3;
+  int v7199=v5886+3;
+  int v7200=v3639+4;
+  int v7201=v5717+2;
+  int v7202=v2389+6;
+  int v7203=v3073+1;
+  int v7204=v3940+7;
+  int v7205=v492+2;
+  int v7206=v5527+6;
+  int v7207=v410+5;
+  int v7208=v1724+4;
+  int v7209=v2030+8;
+  int v7210=v4306+6;
+  int v7211=v3087+9;
+  int v7212=v1652+7;
+  int v7213=v731+6;
+  int v7214=v5344+9;
+  int v7215=v2591+5;
+  int v7216=v921+4;
+  int v7217=v2486+9;
+  int v7218=v6693+3;
+  int v7219=v434+7;
+  int v7220=v7171+4;
+  int v7221=v491+4;
+  int v7222=v867+1;
+  int v7223=v690+9;
+  int v7224=v6439+3;
+  int v7225=v5470+7;
+  int v7226=v5942+2;
+  int v7227=v5481+7;
+  int v7228=v5197+0;
+  int v7229=v1138+3;
+  int v7230=v7021+9;
+  int v7231=v2479+6;
+  int v7232=v2462+8;
+  int v7233=v456+3;
+  int v7234=v1404+4;
+  int v7235=v6628+6;
+  int v7236=v5064+5;
+  int v7237=v1299+7;
+  int v7238=v6308+0;
+  int v7239=v6122+9;
+  int v7240=v1099+2;
+  int v7241=v1701+1;
+  int v7242=v2109+9;
+  int v7243=v2265+3;
+  int v7244=v4141+8;
+  int v7245=v1166+0;
+  int v7246=v3102+9;
+  int v7247=v4909+2;
+  int v7248=v1232+5;
+  int v7249=v776+7;
+  int v7250=v3511+0;
+  int v7251=v1730+0;
+  int v7252=v2054+2;
+  int v7253=v141+8;
+  int v7254=v1261+5;
+  int v7255=v1985+1;
+  int v7256=v5360+3;
+  int v7257=v6478+3;
+  int v7258=v7065+9;
+  int v7259=v6241+9;
+  int v7260=v1813+9;
+  int v7261=v4766+2;
+  int v7262=v5905+8;
+  int v7263=v2902+1;
+  int v7264=v1591+7;
+  int v7265=v2640+4;
+  int v7266=v3217+1;
+  int v7267=v4997+0;
+  int v7268=v2320+7;
+  int v7269=v3620+6;
+  int v7270=v2156+8;
+  int v7271=v5228+6;
+  int v7272=v3042+1;
+  int v7273=v1593+9;
+  int v7274=v462+1;
+  int v7275=v6325+5;
+  int v7276=v2531+6;
+  int v7277=v6964+9;
+  int v7278=v4681+5;
+  int v7279=v1386+5;
+  int v7280=v5578+3;
+  int v7281=v2610+2;
+  int v7282=v1471+8;
+  int v7283=v4923+1;
+  int v7284=v4554+8;
+  int v7285=v359+7;
+  int v7286=v6469+2;
+  int v7287=v247+0;
+  int v7288=v4897+0;
+  int v7289=v4505+3;
+  int v7290=v2530+6;
+  int v7291=v823+2;
+  int v7292=v2538+5;
+  int v7293=v5620+3;
+  int v7294=v3417+6;
+  int v7295=v6711+4;
+  int v7296=v943+6;
+  int v7297=v1633+4;
+  int v7298=v2483+6;
+  int v7299=v25+1;
+  int v7300=v4128+7;
+  int v7301=v938+7;
+  int v7302=v4900+9;
+  int v7303=v5127+2;
+  int v7304=v1178+3;
+  int v7305=v6555+1;
+  int v7306=v3051+1;
+  int v7307=v3810+6;
+  int v7308=v6831+3;
+  int v7309=v6762+5;
+  int v7310=v6832+5;
+  int v7311=v4610+1;
+  int v7312=v1166+2;
+  int v7313=v6372+0;
+  int v7314=v4088+9;
+  int v7315=v2480+5;
+  int v7316=v6923+5;
+  int v7317=v3355+7;
+  int v7318=v4191+9;
+  int v7319=v2237+6;
+  int v7320=v2348+6;
+  int v7321=v2299+5;
+  int v7322=v3855+8;
+  int v7323=v5700+6;
+  int v7324=v4808+6;
+  int v7325=v5012+1;
+  int v7326=v366+8;
+  int v7327=v0+2;
+  int v7328=v6320+9;
+  int v7329=v4342+0;
+  int v7330=v3422+3;
+  int v7331=v2163+9;
+  int v7332=v5844+1;
+  int v7333=v2728+9;
+  int v7334=v2355+3;
+  int v7335=v2682+8;
+  int v7336=v3809+6;
+  int v7337=v7069+5;
+  int v7338=v471+3;
+  int v7339=v5473+8;
+  int v7340=v4604+2;
+  int v7341=v5626+6;
+  int v7342=v4299+1;
+  int v7343=v7109+9;
+  int v7344=v4914+5;
+  int v7345=v5926+5;
+  int v7346=v629+0;
+  int v7347=v7136+2;
+  int v7348=v6209+7;
+  int v7349=v3837+0;
+  int v7350=v6490+6;
+  int v7351=v4286+7;
+  int v7352=v2029+0;
+  int v7353=v4725+6;
+  int v7354=v5606+5;
+  int v7355=v4772+3;
+  int v7356=v3964+6;
+  int v7357=v4272+6;
+  int v7358=v7176+4;
+  int v7359=v2921+1;
+  int v7360=v5251+8;
+  int v7361=v4611+7;
+  int v7362=v3477+6;
+  int v7363=v2845+0;
+  int v7364=v2047+9;
+  int v7365=v3660+4;
+  int v7366=v2075+9;
+  int v7367=v1869+1;
+  int v7368=v2348+6;
+  int v7369=v3065+2;
+  int v7370=v5696+7;
+  int v7371=v532+8;
+  int v7372=v3673+0;
+  int v7373=v655+5;
+  int v7374=v2850+6;
+  int v7375=v4286+7;
+  int v7376=v313+4;
+  int v7377=v4055+5;
+  int v7378=v927+3;
+  int v7379=v3910+0;
+  int v7380=v3721+2;
+  int v7381=v856+0;
+  int v7382=v7031+8;
+  int v7383=v1204+8;
+  int v7384=v202+4;
+  int v7385=v3504+7;
+  int v7386=v4224+9;
+  int v7387=v6096+9;
+  int v7388=v731+8;
+  int v7389=v807+3;
+  int v7390=v1170+9;
+  int v7391=v4622+4;
+  int v7392=v782+0;
+  int v7393=v6610+6;
+  int v7394=v290+5;
+  int v7395=v4730+7;
+  int v7396=v2373+7;
+  int v7397=v4743+1;
+  int v7398=v4593+0;
+  int v7399=v4437+8;
+  int v7400=v6790+5;
+  int v7401=v7286+0;
+  int v7402=v4675+3;
+  int v7403=v2711+9;
+  int v7404=v3161+5;
+  int v7405=v4456+9;
+  int v7406=v93+5;
+  int v7407=v3732+0;
+  int v7408=v7349+4;
+  int v7409=v5667+8;
+  int v7410=v1265+9;
+  int v7411=v1343+6;
+  int v7412=v2105+9;
+  int v7413=v6804+3;
+  int v7414=v836+4;
+  int v7415=v6190+6;
+  int v7416=v5453+8;
+  int v7417=v2797+3;
+  int v7418=v5330+2;
+  int v7419=v1626+6;
+  int v7420=v5597+0;
+  int v7421=v3287+7;
+  int v7422=v4838+8;
+  int v7423=v6365+8;
+  int v7424=v2902+2;
+  int v7425=v4704+0;
+  int v7426=v6592+3;
+  int v7427=v5469+6;
+  int v7428=v1053+8;
+  int v7429=v3692+6;
+  int v7430=v809+6;
+  int v7431=v6712+7;
+  int v7432=v4882+2;
+  int v7433=v6724+3;
+  int v7434=v4434+5;
+  int v7435=v3464+9;
+  int v7436=v4833+5;
+  int v7437=v5795+5;
+  int v7438=v5986+0;
+  int v7439=v1104+7;
+  int v7440=v6342+4;
+  int v7441=v6344+7;
+  int v7442=v6559+5;
+  int v7443=v6144+1;
+  int v7444=v3552+4;
+  int v7445=v2176+2;
+  int v7446=v2942+7;
+  int v7447=v3622+2;
+  int v7448=v5157+5;
+  int v7449=v5102+8;
+  int v7450=v3497+2;
+  int v7451=v172+0;
+  int v7452=v3784+8;
+  int v7453=v4608+2;
+  int v7454=v4426+2;
+  int v7455=v508+2;
+  int v7456=v4575+2;
+  int v7457=v7228+7;
+  int v7458=v2922+8;
+  int v7459=v2399+2;
+  int v7460=v3188+5;
+  int v7461=v980+3;
+  int v7462=v1353+6;
+  int v7463=v3780+7;
+  int v7464=v2550+6;
+  int v7465=v797+0;
+  int v7466=v1944+9;
+  int v7467=v1229+4;
+  int v7468=v2783+5;
+  int v7469=v6787+0;
+  int v7470=v6412+9;
+  int v7471=v3496+3;
+  int v7472=v5434+7;
+  int v7473=v920+8;
+  int v7474=v785+6;
+  int v7475=v3146+8;
+  int v7476=v5767+8;
+  int v7477=v3626+1;
+  int v7478=v4353+8;
+  int v7479=v4450+9;
+  int v7480=v209+1;
+  int v7481=v250+5;
+  int v7482=v4446+3;
+  int v7483=v3961+9;
+  int v7484=v1022+1;
+  int v7485=v2561+7;
+  int v7486=v6146+0;
+  int v7487=v3405+5;
+  int v7488=v2825+2;
+  int v7489=v46+7;
+  int v7490=v4905+6;
+  int v7491=v1878+6;
+  int v7492=v3989+1;
+  int v7493=v3905+9;
+  int v7494=v3065+5;
+  int v7495=v6081+4;
+  int v7496=v5992+8;
+  int v7497=v1842+2;
+  int v7498=v3881+0;
+  int v7499=v1216+4;
+  int v7500=v5426+4;
+  int v7501=v1145+1;
+  int v7502=v3365+0;
+  int v7503=v1791+9;
+  int v7504=v4269+5;
+  int v7505=v1007+3;
+  int v7506=v63+3;
+  int v7507=v360+6;
+  int v7508=v1573+2;
+  int v7509=v2486+6;
+  int v7510=v1329+3;
+  int v7511=v3626+5;
+  int v7512=v6375+2;
+  int v7513=v2191+8;
+  int v7514=v4174+6;
+  int v7515=v2466+5;
+  int v7516=v1907+9;
+  int v7517=v5826+1;
+  int v7518=v2539+3;
+  int v7519=v2994+4;
+  int v7520=v4723+8;
+  int v7521=v5778+9;
+  int v7522=v4256+0;
+  int v7523=v2689+0;
+  int v7524=v789+5;
+  int v7525=v7373+6;
+  int v7526=v7254+0;
+  int v7527=v5135+3;
+  int v7528=v5147+1;
+  int v7529=v2187+4;
+  int v7530=v2954+9;
+  int v7531=v5005+4;
+  int v7532=v915+3;
+  int v7533=v2299+3;
+  int v7534=v3503+1;
+  int v7535=v3136+8;
+  int v7536=v2170+0;
+  int v7537=v423+9;
+  int v7538=v3995+1;
+  int v7539=v402+3;
+  int v7540=v3130+9;
+  int v7541=v1910+3;
+  int v7542=v3888+4;
+  int v7543=v201+1;
+  int v7544=v6024+4;
+  int v7545=v3865+4;
+  int v7546=v1393+2;
+  int v7547=v7070+8;
+  int v7548=v6444+5;
+  int v7549=v2135+8;
+  int v7550=v1652+4;
+  int v7551=v7040+4;
+  int v7552=v3291+6;
+  int v7553=v1033+3;
+  int v7554=v6566+3;
+  int v7555=v7025+5;
+  int v7556=v4796+5;
+  int v7557=v7275+0;
+  int v7558=v7456+2;
+  int v7559=v6730+7;
+  int v7560=v4978+9;
+  int v7561=v1227+7;
+  int v7562=v7314+8;
+  int v7563=v134+5;
+  int v7564=v806+2;
+  int v7565=v3008+4;
+  int v7566=v4158+9;
+  int v7567=v2108+1;
+  int v7568=v2487+4;
+  int v7569=v2671+3;
+  int v7570=v6915+8;
+  int v7571=v5559+5;
+  int v7572=v2379+9;
+  int v7573=v4460+8;
+  int v7574=v4965+3;
+  int v7575=v2978+6;
+  int v7576=v6830+7;
+  int v7577=v6234+0;
+  int v7578=v5814+9;
+  int v7579=v5005+7;
+  int v7580=v7152+5;
+  int v7581=v1137+7;
+  int v7582=v2950+8;
+  int v7583=v3863+1;
+  int v7584=v668+1;
+  int v7585=v6532+7;
+  int v7586=v678+2;
+  int v7587=v558+4;
+  int v7588=v7259+7;
+  int v7589=v4304+4;
+  int v7590=v486+1;
+  int v7591=v3160+5;
+  int v7592=v2484+8;
+  int v7593=v6935+6;
+  int v7594=v6333+5;
+  int v7595=v1354+4;
+  int v7596=v6442+2;
+  int v7597=v1492+0;
+  int v7598=v3124+9;
+  int v7599=v2705+0;
+  int v7600=v7405+9;
+  int v7601=v462+1;
+  int v7602=v2605+1;
+  int v7603=v247+6;
+  int v7604=v3450+9;
+  int v7605=v1713+6;
+  int v7606=v3487+1;
+  int v7607=v4466+0;
+  int v7608=v6800+9;
+  int v7609=v3259+0;
+  int v7610=v3446+0;
+  int v7611=v1648+5;
+  int v7612=v5132+2;
+  int v7613=v4642+4;
+  int v7614=v5336+5;
+  int v7615=v4029+0;
+  int v7616=v5808+1;
+  int v7617=v2782+3;
+  int v7618=v6509+3;
+  int v7619=v2906+9;
+  int v7620=v7009+5;
+  int v7621=v4252+5;
+  int v7622=v2795+2;
+  int v7623=v5502+3;
+  int v7624=v976+7;
+  int v7625=v5699+8;
+  int v7626=v7299+5;
+  int v7627=v433+9;
+  int v7628=v7071+6;
+  int v7629=v4166+2;
+  int v7630=v1745+6;
+  int v7631=v4736+5;
+  int v7632=v6256+0;
+  int v7633=v5856+9;
+  int v7634=v7160+8;
+  int v7635=v3682+8;
+  int v7636=v6773+2;
+  int v7637=v3330+0;
+  int v7638=v6447+2;
+  int v7639=v5979+4;
+  int v7640=v2298+9;
+  int v7641=v5092+4;
+  int v7642=v203+8;
+  int v7643=v7617+5;
+  int v7644=v4445+7;
+  int v7645=v1415+2;
+  int v7646=v3196+1;
+  int v7647=v932+9;
+  int v7648=v3918+1;
+  int v7649=v1635+2;
+  int v7650=v2360+0;
+  int v7651=v6457+9;
+  int v7652=v4032+9;
+  int v7653=v6576+3;
+  int v7654=v6811+7;
+  int v7655=v872+9;
+  int v7656=v7385+9;
+  int v7657=v7245+2;
+  int v7658=v598+6;
+  int v7659=v1208+9;
+  int v7660=v7035+5;
+  int v7661=v2955+7;
+  int v7662=v6612+2;
+  int v7663=v5046+4;
+  int v7664=v3330+9;
+  int v7665=v505+3;
+  int v7666=v2772+6;
+  int v7667=v6604+8;
+  int v7668=v3065+7;
+  int v7669=v4265+6;
+  int v7670=v5158+2;
+  int v7671=v4326+8;
+  int v7672=v2752+1;
+  int v7673=v4588+4;
+  int v7674=v1284+0;
+  int v7675=v5315+5;
+  int v7676=v4551+8;
+  int v7677=v7435+0;
+  int v7678=v7363+8;
+  int v7679=v5586+7;
+  int v7680=v2123+0;
+  int v7681=v3631+3;
+  int v7682=v2013+6;
+  int v7683=v898+4;
+  int v7684=v217+6;
+  int v7685=v1117+6;
+  int v7686=v222+2;
+  int v7687=v5130+5;
+  int v7688=v5794+5;
+  int v7689=v5325+3;
+  int v7690=v7498+6;
+  int v7691=v5346+2;
+  int v7692=v2492+8;
+  int v7693=v280+9;
+  int v7694=v6892+4;
+  int v7695=v7463+3;
+  int v7696=v660+2;
+  int v7697=v6091+3;
+  int v7698=v6584+7;
+  int v7699=v900+0;
+  int v7700=v3100+4;
+  int v7701=v2620+1;
+  int v7702=v2437+1;
+  int v7703=v3146+3;
+  int v7704=v364+2;
+  int v7705=v782+2;
+  int v7706=v1457+7;
+  int v7707=v1365+8;
+  int v7708=v6618+4;
+  int v7709=v4957+9;
+  int v7710=v7338+8;
+  int v7711=v4260+1;
+  int v7712=v1533+2;
+  int v7713=v944+7;
+  int v7714=v7618+2;
+  int v7715=v134+7;
+  int v7716=v4276+3;
+  int v7717=v570+0;
+  int v7718=v1520+0;
+  int v7719=v5947+4;
+  int v7720=v1444+1;
+  int v7721=v5176+4;
+  int v7722=v7672+9;
+  int v7723=v7162+6;
+  int v7724=v1532+9;
+  int v7725=v1366+7;
+  int v7726=v6682+1;
+  int v7727=v2618+4;
+  int v7728=v1110+1;
+  int v7729=v4372+4;
+  int v7730=v4129+1;
+  int v7731=v1763+0;
+  int v7732=v1077+2;
+  int v7733=v175+0;
+  int v7734=v3906+8;
+  int v7735=v4605+7;
+  int v7736=v5813+2;
+  int v7737=v5393+7;
+  int v7738=v1857+6;
+  int v7739=v6332+7;
+  int v7740=v828+6;
+  int v7741=v3693+2;
+  int v7742=v4402+8;
+  int v7743=v4456+8;
+  int v7744=v725+7;
+  int v7745=v5589+1;
+  int v7746=v476+6;
+  int v7747=v4760+6;
+  int v7748=v1303+3;
+  int v7749=v3755+6;
+  int v7750=v2848+9;
+  int v7751=v5043+2;
+  int v7752=v5637+8;
+  int v7753=v169+3;
+  int v7754=v2556+0;
+  int v7755=v6524+4;
+  int v7756=v5327+1;
+  int v7757=v840+8;
+  int v7758=v5681+2;
+  int v7759=v4115+0;
+  int v7760=v3540+0;
+  int v7761=v176+6;
+  int v7762=v5148+2;
+  int v7763=v5915+5;
+  int v7764=v769+4;
+  int v7765=v7414+3;
+  int v7766=v2958+8;
+  int v7767=v5034+9;
+  int v7768=v824+4;
+  int v7769=v986+8;
+  int v7770=v3362+1;
+  int v7771=v949+8;
+  int v7772=v5955+1;
+  int v7773=v5017+6;
+  int v7774=v5660+2;
+  int v7775=v7219+8;
+  int v7776=v6980+3;
+  int v7777=v7644+0;
+  int v7778=v7471+2;
+  int v7779=v3623+4;
+  int v7780=v6342+7;
+  int v7781=v4320+5;
+  int v7782=v1148+5;
+  int v7783=v6106+0;
+  int v7784=v2009+6;
+  int v7785=v5600+5;
+  int v7786=v3788+6;
+  int v7787=v4136+2;
+  int v7788=v3206+9;
+  int v7789=v1327+2;
+  int v7790=v1012+2;
+  int v7791=v5359+3;
+  int v7792=v2745+4;
+  int v7793=v766+3;
+  int v7794=v5817+6;
+  int v7795=v1926+2;
+  int v7796=v6346+9;
+  int v7797=v1849+6;
+  int v7798=v3901+3;
+  int v7799=v2139+5;
+  int v7800=v386+2;
+  int v7801=v3162+7;
+  int v7802=v3980+6;
+  int v7803=v5718+6;
+  int v7804=v1425+8;
+  int v7805=v2748+5;
+  int v7806=v3074+2;
+  int v7807=v6271+6;
+  int v7808=v6614+3;
+  int v7809=v1366+5;
+  int v7810=v6747+5;
+  int v7811=v5885+2;
+  int v7812=v3344+5;
+  int v7813=v545+6;
+  int v7814=v2075+5;
+  int v7815=v6420+1;
+  int v7816=v6228+9;
+  int v7817=v589+8;
+  int v7818=v5036+5;
+  int v7819=v2638+2;
+  int v7820=v7469+9;
+  int v7821=v185+9;
+  int v7822=v4460+3;
+  int v7823=v2092+9;
+  int v7824=v6256+6;
+  int v7825=v5954+9;
+  int v7826=v5156+4;
+  int v7827=v1040+5;
+  int v7828=v5480+5;
+  int v7829=v2430+9;
+  int v7830=v6668+3;
+  int v7831=v1321+3;
+  int v7832=v4668+2;
+  int v7833=v4982+9;
+  int v7834=v3167+5;
+  int v7835=v6199+6;
+  int v7836=v1442+8;
+  int v7837=v5239+8;
+  int v7838=v6301+9;
+  int v7839=v3342+3;
+  int v7840=v5722+1;
+  int v7841=v7829+0;
+  int v7842=v3996+6;
+  int v7843=v3026+6;
+  int v7844=v7297+6;
+  int v7845=v2056+0;
+  int v7846=v6872+5;
+  int v7847=v144+8;
+  int v7848=v4807+3;
+  int v7849=v3655+8;
+  int v7850=v1453+6;
+  int v7851=v5356+2;
+  int v7852=v2554+2;
+  int v7853=v5135+0;
+  int v7854=v4146+5;
+  int v7855=v2064+5;
+  int v7856=v3327+7;
+  int v7857=v3068+3;
+  int v7858=v3949+0;
+  int v7859=v2177+2;
+  int v7860=v5183+3;
+  int v7861=v7553+6;
+  int v7862=v3286+5;
+  int v7863=v5389+7;
+  int v7864=v6102+7;
+  int v7865=v7145+6;
+  int v7866=v3659+4;
+  int v7867=v436+7;
+  int v7868=v5891+4;
+  int v7869=v4843+7;
+  int v7870=v7844+0;
+  int v7871=v4809+6;
+  int v7872=v185+4;
+  int v7873=v5629+5;
+  int v7874=v3905+8;
+  int v7875=v3771+1;
+  int v7876=v3615+1;
+  int v7877=v7059+3;
+  int v7878=v1819+4;
+  int v7879=v3831+0;
+  int v7880=v3976+2;
+  int v7881=v1863+6;
+  int v7882=v4096+5;
+  int v7883=v800+6;
+  int v7884=v4330+5;
+  int v7885=v603+0;
+  int v7886=v5400+2;
+  int v7887=v2045+5;
+  int v7888=v3660+1;
+  int v7889=v2154+5;
+  int v7890=v3358+2;
+  int v7891=v1494+8;
+  int v7892=v3480+3;
+  int v7893=v5026+1;
+  int v7894=v413+1;
+  int v7895=v1600+4;
+  int v7896=v471+4;
+  int v7897=v1205+5;
+  int v7898=v6243+0;
+  int v7899=v628+6;
+  int v7900=v88+1;
+  int v7901=v1316+5;
+  int v7902=v6126+5;
+  int v7903=v1028+5;
+  int v7904=v6204+3;
+  int v7905=v6956+0;
+  int v7906=v1618+2;
+  int v7907=v54+4;
+  int v7908=v4627+0;
+  int v7909=v4865+3;
+  int v7910=v4871+0;
+  int v7911=v156+6;
+  int v7912=v7333+9;
+  int v7913=v3496+8;
+  int v7914=v1887+4;
+  int v7915=v1537+5;
+  int v7916=v5074+1;
+  int v7917=v6198+5;
+  int v7918=v539+7;
+  int v7919=v1978+4;
+  int v7920=v1258+6;
+  int v7921=v7550+3;
+  int v7922=v5482+5;
+  int v7923=v2663+0;
+  int v7924=v2905+9;
+  int v7925=v3703+3;
+  int v7926=v3488+7;
+  int v7927=v4056+8;
+  int v7928=v6242+1;
+  int v7929=v102+6;
+  int v7930=v1234+2;
+  int v7931=v6577+8;
+  int v7932=v3515+6;
+  int v7933=v4945+1;
+  int v7934=v5545+5;
+  int v7935=v258+3;
+  int v7936=v7626+8;
+  int v7937=v2342+3;
+  int v7938=v4558+0;
+  int v7939=v787+1;
+  int v7940=v4568+2;
+  int v7941=v1577+5;
+  int v7942=v1577+6;
+  int v7943=v984+7;
+  int v7944=v1649+8;
+  int v7945=v2605+1;
+  int v7946=v6067+4;
+  int v7947=v4584+0;
+  int v7948=v4390+3;
+  int v7949=v2821+0;
+  int v7950=v1688+3;
+  int v7951=v7362+0;
+  int v7952=v2285+6;
+  int v7953=v6024+0;
+  int v7954=v7750+1;
+  int v7955=v6558+1;
+  int v7956=v5769+9;
+  int v7957=v7390+6;
+  int v7958=v3485+1;
+  int v7959=v6386+1;
+  int v7960=v1531+5;
+  int v7961=v1088+1;
+  int v7962=v3865+5;
+  int v7963=v3438+7;
+  int v7964=v4844+1;
+  int v7965=v952+2;
+  int v7966=v3298+2;
+  int v7967=v6369+0;
+  int v7968=v4680+3;
+  int v7969=v2869+5;
+  int v7970=v7752+2;
+  int v7971=v5586+7;
+  int v7972=v5035+5;
+  int v7973=v177+6;
+  int v7974=v4585+7;
+  int v7975=v6204+5;
+  int v7976=v253+4;
+  int v7977=v6855+6;
+  int v7978=v5192+7;
+  int v7979=v4113+0;
+  int v7980=v678+8;
+  int v7981=v7372+1;
+  int v7982=v281+8;
+  int v7983=v1702+8;
+  int v7984=v4579+8;
+  int v7985=v1672+8;
+  int v7986=v6020+4;
+  int v7987=v5373+3;
+  int v7988=v2550+1;
+  int v7989=v2192+6;
+  int v7990=v4083+1;
+  int v7991=v953+2;
+  int v7992=v7369+1;
+  int v7993=v3222+8;
+  int v7994=v5898+1;
+  int v7995=v1342+8;
+  int v7996=v4165+0;
+  int v7997=v806+1;
+  int v7998=v428+3;
+  int v7999=v3978+6;
+  int v8000=v2937+3;
+  int v8001=v4255+4;
+  int v8002=v270+2;
+  int v8003=v415+2;
+  int v8004=v4535+7;
+  int v8005=v2275+1;
+  int v8006=v6400+5;
+  int v8007=v1844+6;
+  int v8008=v6386+3;
+  int v8009=v6094+5;
+  int v8010=v6887+8;
+  int v8011=v5803+9;
+  int v8012=v7806+6;
+  int v8013=v6659+7;
+  int v8014=v379+3;
+  int v8015=v4082+1;
+  int v8016=v4858+4;
+  int v8017=v3537+0;
+  int v8018=v5517+5;
+  int v8019=v43+4;
+  int v8020=v260+6;
+  int v8021=v195+8;
+  int v8022=v1902+5;
+  int v8023=v901+5;
+  int v8024=v7163+5;
+  int v8025=v1415+8;
+  int v8026=v3469+9;
+  int v8027=v5111+5;
+  int v8028=v4600+4;
+  int v8029=v4378+8;
+  int v8030=v1457+2;
+  int v8031=v2345+6;
+  int v8032=v4894+6;
+  int v8033=v3942+2;
+  int v8034=v200+6;
+  int v8035=v1558+9;
+  int v8036=v438+2;
+  int v8037=v1602+8;
+  int v8038=v6733+2;
+  int v8039=v37+1;
+  int v8040=v1764+2;
+  int v8041=v331+4;
+  int v8042=v7722+1;
+  int v8043=v5500+2;
+  int v8044=v3016+5;
+  int v8045=v4981+1;
+  int v8046=v305+5;
+  int v8047=v4937+9;
+  int v8048=v4256+7;
+  int v8049=v6522+5;
+  int v8050=v253+3;
+  int v8051=v6005+3;
+  int v8052=v6021+1;
+  int v8053=v4807+1;
+  int v8054=v1336+3;
+  int v8055=v3761+7;
+  int v8056=v4598+7;
+  int v8057=v4950+6;
+  int v8058=v6380+2;
+  int v8059=v2004+5;
+  int v8060=v712+9;
+  int v8061=v3193+5;
+  int v8062=v261+7;
+  int v8063=v3938+9;
+  int v8064=v2198+2;
+  int v8065=v7331+8;
+  int v8066=v4504+0;
+  int v8067=v1558+7;
+  int v8068=v3593+9;
+  int v8069=v3211+1;
+  int v8070=v6582+2;
+  int v8071=v2365+7;
+  int v8072=v6976+6;
+  int v8073=v3781+9;
+  int v8074=v6556+9;
+  int v8075=v7264+0;
+  int v8076=v5158+8;
+  int v8077=v4163+4;
+  int v8078=v7198+2;
+  int v8079=v3386+0;
+  int v8080=v6062+8;
+  int v8081=v1399+3;
+  int v8082=v7948+1;
+  int v8083=v5363+5;
+  int v8084=v7831+8;
+  int v8085=v5964+1;
+  int v8086=v5462+6;
+  int v8087=v3614+8;
+  int v8088=v6069+3;
+  int v8089=v7261+6;
+  int v8090=v1671+5;
+  int v8091=v6644+4;
+  int v8092=v6724+3;
+  int v8093=v7813+9;
+  int v8094=v3987+8;
+  int v8095=v2618+6;
+  int v8096=v3040+0;
+  int v8097=v7101+8;
+  int v8098=v5116+5;
+  int v8099=v5286+9;
+  int v8100=v1372+1;
+  int v8101=v2119+4;
+  int v8102=v3465+4;
+  int v8103=v1510+3;
+  int v8104=v6912+4;
+  int v8105=v6792+6;
+  int v8106=v470+9;
+  int v8107=v4+0;
+  int v8108=v4098+5;
+  int v8109=v5694+2;
+  int v8110=v556+7;
+  int v8111=v5612+7;
+  int v8112=v1580+9;
+  int v8113=v208+3;
+  int v8114=v2687+4;
+  int v8115=v6928+4;
+  int v8116=v275+8;
+  int v8117=v1973+4;
+  int v8118=v2821+2;
+  int v8119=v3941+3;
+  int v8120=v2264+9;
+  int v8121=v1082+6;
+  int v8122=v7458+7;
+  int v8123=v2508+8;
+  int v8124=v3764+6;
+  int v8125=v2454+5;
+  int v8126=v4153+6;
+  int v8127=v6965+5;
+  int v8128=v5141+5;
+  int v8129=v2385+6;
+  int v8130=v3821+6;
+  int v8131=v6648+2;
+  int v8132=v1669+3;
+  int v8133=v1500+8;
+  int v8134=v8046+5;
+  int v8135=v554+8;
+  int v8136=v3323+8;
+  int v8137=v4623+2;
+  int v8138=v4159+7;
+  int v8139=v7832+0;
+  int v8140=v4910+5;
+  int v8141=v8061+2;
+  int v8142=v5942+2;
+  int v8143=v2118+1;
+  int v8144=v6786+2;
+  int v8145=v7101+8;
+  int v8146=v6161+9;
+  int v8147=v4826+5;
+  int v8148=v1034+6;
+  int v8149=v1307+2;
+  int v8150=v6116+2;
+  int v8151=v980+5;
+  int v8152=v2192+4;
+  int v8153=v2384+8;
+  int v8154=v1135+3;
+  int v8155=v5166+5;
+  int v8156=v5070+0;
+  int v8157=v3843+5;
+  int v8158=v3773+5;
+  int v8159=v3870+1;
+  int v8160=v1744+2;
+  int v8161=v6956+0;
+  int v8162=v6924+8;
+  int v8163=v5277+5;
+  int v8164=v639+7;
+  int v8165=v1779+5;
+  int v8166=v7503+2;
+  int v8167=v247+8;
+  int v8168=v5304+4;
+  int v8169=v1596+3;
+  int v8170=v462+2;
+  int v8171=v7405+7;
+  int v8172=v6196+9;
+  int v8173=v5507+4;
+  int v8174=v14+2;
+  int v8175=v1017+4;
+  int v8176=v2677+3;
+  int v8177=v7226+4;
+  int v8178=v972+4;
+  int v8179=v6777+0;
+  int v8180=v4623+0;
+  int v8181=v902+5;
+  int v8182=v1368+1;
+  int v8183=v4890+5;
+  int v8184=v1953+9;
+  int v8185=v2442+4;
+  int v8186=v3978+9;
+  int v8187=v7323+9;
+  int v8188=v7237+8;
+  int v8189=v6058+9;
+  int v8190=v7798+4;
+  int v8191=v1185+7;
+  int v8192=v2761+9;
+  int v8193=v6951+3;
+  int v8194=v673+1;
+  int v8195=v7239+4;
+  int v8196=v756+5;
+  int v8197=v2519+6;
+  int v8198=v5141+7;
+  int v8199=v1033+5;
+  int v8200=v7491+5;
+  int v8201=v1400+5;
+  int v8202=v1702+9;
+  int v8203=v571+6;
+  int v8204=v8078+0;
+  int v8205=v2322+5;
+  int v8206=v4058+4;
+  int v8207=v665+3;
+  int v8208=v54+8;
+  int v8209=v588+5;
+  int v8210=v5420+4;
+  int v8211=v1598+7;
+  int v8212=v7591+3;
+  int v8213=v5018+0;
+  int v8214=v3706+4;
+  int v8215=v6388+6;
+  int v8216=v2391+9;
+  int v8217=v7071+0;
+  int v8218=v97+4;
+  int v8219=v6557+1;
+  int v8220=v1345+7;
+  int v8221=v469+9;
+  int v8222=v5533+6;
+  int v8223=v2889+2;
+  int v8224=v4950+8;
+  int v8225=v3738+3;
+  int v8226=v4436+2;
+  int v8227=v4743+5;
+  int v8228=v5179+1;
+  int v8229=v1371+0;
+  int v8230=v4846+0;
+  int v8231=v2466+3;
+  int v8232=v7823+0;
+  int v8233=v1048+7;
+  int v8234=v4803+1;
+  int v8235=v5734+8;
+  int v8236=v4612+4;
+  int v8237=v157+5;
+  int v8238=v3961+2;
+  int v8239=v7557+8;
+  int v8240=v1335+5;
+  int v8241=v4320+5;
+  int v8242=v6864+3;
+  int v8243=v2095+2;
+  int v8244=v4516+5;
+  int v8245=v7888+7;
+  int v8246=v5610+6;
+  int v8247=v8186+0;
+  int v8248=v5314+3;
+  int v8249=v3121+7;
+  int v8250=v6398+2;
+  int v8251=v4159+9;
+  int v8252=v7358+8;
+  int v8253=v3985+8;
+  int v8254=v431+5;
+  int v8255=v554+3;
+  int v8256=v2539+8;
+  int v8257=v6140+4;
+  int v8258=v1030+2;
+  int v8259=v3120+2;
+  int v8260=v8100+7;
+  int v8261=v7332+1;
+  int v8262=v4994+0;
+  int v8263=v2937+8;
+  int v8264=v404+5;
+  int v8265=v2025+7;
+  int v8266=v6540+0;
+  int v8267=v5698+2;
+  int v8268=v7866+7;
+  int v8269=v1856+2;
+  int v8270=v3444+0;
+  int v8271=v2458+9;
+  int v8272=v2631+3;
+  int v8273=v7784+1;
+  int v8274=v6724+3;
+  int v8275=v3943+5;
+  int v8276=v4012+3;
+  int v8277=v7092+9;
+  int v8278=v2059+2;
+  int v8279=v2401+8;
+  int v8280=v2028+8;
+  int v8281=v5129+9;
+  int v8282=v1820+7;
+  int v8283=v1972+5;
+  int v8284=v2411+3;
+  int v8285=v7782+6;
+  int v8286=v3576+0;
+  int v8287=v4210+4;
+  int v8288=v1593+1;
+  int v8289=v5211+0;
+  int v8290=v3114+9;
+  int v8291=v2852+3;
+  int v8292=v3737+0;
+  int v8293=v1814+2;
+  int v8294=v4403+5;
+  int v8295=v4963+6;
+  int v8296=v6577+5;
+  int v8297=v4107+4;
+  int v8298=v735+3;
+  int v8299=v6568+0;
+  int v8300=v4618+9;
+  int v8301=v3402+8;
+  int v8302=v7430+9;
+  int v8303=v3796+6;
+  int v8304=v4803+1;
+  int v8305=v1154+7;
+  int v8306=v4325+3;
+  int v8307=v2999+7;
+  int v8308=v1346+1;
+  int v8309=v4679+9;
+  int v8310=v2805+0;
+  int v8311=v1843+5;
+  int v8312=v7041+3;
+  int v8313=v1606+8;
+  int v8314=v7167+1;
+  int v8315=v930+9;
+  int v8316=v1072+1;
+  int v8317=v230+6;
+  int v8318=v6444+8;
+  int v8319=v3160+7;
+  int v8320=v274+2;
+  int v8321=v1634+4;
+  int v8322=v292+8;
+  int v8323=v7370+7;
+  int v8324=v559+7;
+  int v8325=v6110+7;
+  int v8326=v7554+2;
+  int v8327=v7987+3;
+  int v8328=v955+9;
+  int v8329=v7546+1;
+  int v8330=v6182+0;
+  int v8331=v1099+9;
+  int v8332=v396+1;
+  int v8333=v1839+2;
+  int v8334=v1200+2;
+  int v8335=v944+4;
+  int v8336=v4839+1;
+  int v8337=v6389+8;
+  int v8338=v2877+7;
+  int v8339=v1174+5;
+  int v8340=v1128+1;
+  int v8341=v5325+2;
+  int v8342=v958+1;
+  int v8343=v8309+1;
+  int v8344=v7350+4;
+  int v8345=v3200+5;
+  int v8346=v6172+3;
+  int v8347=v7851+6;
+  int v8348=v3649+3;
+  int v8349=v1743+7;
+  int v8350=v854+4;
+  int v8351=v4606+3;
+  int v8352=v5411+8;
+  int v8353=v2433+3;
+  int v8354=v4133+2;
+  int v8355=v3416+1;
+  int v8356=v4932+3;
+  int v8357=v106+6;
+  int v8358=v7168+0;
+  int v8359=v3891+5;
+  int v8360=v6996+6;
+  int v8361=v6712+1;
+  int v8362=v6518+3;
+  int v8363=v3346+3;
+  int v8364=v4608+6;
+  int v8365=v412+9;
+  int v8366=v6645+8;
+  int v8367=v4589+8;
+  int v8368=v1516+3;
+  int v8369=v5483+9;
+  int v8370=v4392+4;
+  int v8371=v2235+5;
+  int v8372=v52+4;
+  int v8373=v7576+5;
+  int v8374=v5855+4;
+  int v8375=v2648+9;
+  int v8376=v4532+0;
+  int v8377=v1973+9;
+  int v8378=v2336+1;
+  int v8379=v5717+4;
+  int v8380=v5729+9;
+  int v8381=v706+5;
+  int v8382=v6956+1;
+  int v8383=v804+3;
+  int v8384=v3066+7;
+  int v8385=v4649+5;
+  int v8386=v3462+5;
+  int v8387=v5350+2;
+  int v8388=v2432+8;
+  int v8389=v3270+5;
+  int v8390=v6903+3;
+  int v8391=v5357+3;
+  int v8392=v5422+5;
+  int v8393=v5676+6;
+  int v8394=v1002+2;
+  int v8395=v4804+1;
+  int v8396=v8362+8;
+  int v8397=v4077+1;
+  int v8398=v2945+8;
+  int v8399=v4295+0;
+  int v8400=v506+4;
+  int v8401=v3970+2;
+  int v8402=v1944+8;
+  int v8403=v7181+4;
+  int v8404=v2965+0;
+  int v8405=v3157+6;
+  int v8406=v4322+9;
+  int v8407=v1225+4;
+  int v8408=v6763+6;
+  int v8409=v701+8;
+  int v8410=v4624+9;
+  int v8411=v3287+6;
+  int v8412=v2554+4;
+  int v8413=v7992+2;
+  int v8414=v423+8;
+  int v8415=v8268+6;
+  int v8416=v6624+8;
+  int v8417=v6009+7;
+  int v8418=v2670+7;
+  int v8419=v48+3;
+  int v8420=v6782+8;
+  int v8421=v4801+6;
+  int v8422=v3270+2;
+  int v8423=v6187+9;
+  int v8424=v1208+7;
+  int v8425=v4843+5;
+  int v8426=v745+7;
+  int v8427=v442+6;
+  int v8428=v3128+8;
+  int v8429=v6721+0;
+  int v8430=v3538+7;
+  int v8431=v1875+0;
+  int v8432=v4263+9;
+  int v8433=v7285+5;
+  int v8434=v8056+6;
+  int v8435=v3431+3;
+  int v8436=v6414+4;
+  int v8437=v7840+0;
+  int v8438=v4010+5;
+  int v8439=v5248+5;
+  int v8440=v5827+1;
+  int v8441=v5331+8;
+  int v8442=v8042+3;
+  int v8443=v7562+8;
+  int v8444=v3211+0;
+  int v8445=v6460+5;
+  int v8446=v4573+0;
+  int v8447=v18+4;
+  int v8448=v3647+4;
+  int v8449=v3072+5;
+  int v8450=v3615+8;
+  int v8451=v699+8;
+  int v8452=v4815+0;
+  int v8453=v2486+5;
+  int v8454=v1638+3;
+  int v8455=v2507+4;
+  int v8456=v2352+5;
+  int v8457=v553+8;
+  int v8458=v6923+0;
+  int v8459=v2680+1;
+  int v8460=v6549+3;
+  int v8461=v4764+6;
+  int v8462=v343+8;
+  int v8463=v7345+8;
+  int v8464=v2965+3;
+  int v8465=v151+6;
+  int v8466=v1427+4;
+  int v8467=v7160+0;
+  int v8468=v3465+7;
+  int v8469=v37+9;
+  int v8470=v5835+5;
+  int v8471=v5849+7;
+  int v8472=v174+0;
+  int v8473=v3621+5;
+  int v8474=v4518+6;
+  int v8475=v4992+6;
+  int v8476=v8084+8;
+  int v8477=v6793+1;
+  int v8478=v1996+1;
+  int v8479=v7890+0;
+  int v8480=v1853+5;
+  int v8481=v1429+7;
+  int v8482=v1381+5;
+  int v8483=v7406+0;
+  int v8484=v7566+5;
+  int v8485=v406+2;
+  int v8486=v65+3;
+  int v8487=v1444+0;
+  int v8488=v7104+6;
+  int v8489=v5013+1;
+  int v8490=v1999+3;
+  int v8491=v2530+7;
+  int v8492=v2758+2;
+  int v8493=v3957+5;
+  int v8494=v6831+8;
+  int v8495=v6762+2;
+  int v8496=v3192+4;
+  int v8497=v6676+8;
+  int v8498=v7698+6;
+  int v8499=v1766+3;
+  int v8500=v3987+3;
+  int v8501=v7684+0;
+  int v8502=v2494+2;
+  int v8503=v5943+0;
+  int v8504=v6569+3;
+  int v8505=v8398+0;
+  int v8506=v3874+8;
+  int v8507=v5036+5;
+  int v8508=v7867+6;
+  int v8509=v7060+5;
+  int v8510=v651+1;
+  int v8511=v598+1;
+  int v8512=v3168+2;
+  int v8513=v7078+6;
+  int v8514=v757+7;
+  int v8515=v8187+0;
+  int v8516=v3248+8;
+  int v8517=v4562+9;
+  int v8518=v2677+9;
+  int v8519=v8132+8;
+  int v8520=v18+7;
+  int v8521=v724+2;
+  int v8522=v5196+5;
+  int v8523=v5035+4;
+  int v8524=v3541+9;
+  int v8525=v2058+3;
+  int v8526=v865+4;
+  int v8527=v926+4;
+  int v8528=v3440+7;
+  int v8529=v6549+7;
+  int v8530=v3256+5;
+  int v8531=v4735+8;
+  int v8532=v4164+4;
+  int v8533=v2333+3;
+  int v8534=v4989+8;
+  int v8535=v374+0;
+  int v8536=v5051+3;
+  int v8537=v8446+1;
+  int v8538=v2739+5;
+  int v8539=v5843+3;
+  int v8540=v1643+5;
+  int v8541=v6362+0;
+  int v8542=v7590+9;
+  int v8543=v703+0;
+  int v8544=v4043+0;
+  int v8545=v8314+8;
+  int v8546=v698+4;
+  int v8547=v5910+4;
+  int v8548=v508+0;
+  int v8549=v5097+7;
+  int v8550=v3094+6;
+  int v8551=v7298+9;
+  int v8552=v7055+4;
+  int v8553=v4006+9;
+  int v8554=v672+5;
+  int v8555=v1867+2;
+  int v8556=v6336+3;
+  int v8557=v5366+5;
+  int v8558=v1011+2;
+  int v8559=v2937+0;
+  int v8560=v6410+7;
+  int v8561=v4877+3;
+  int v8562=v130+3;
+  int v8563=v4223+2;
+  int v8564=v4846+8;
+  int v8565=v6916+3;
+  int v8566=v581+7;
+  int v8567=v6566+6;
+  int v8568=v5034+3;
+  int v8569=v1421+6;
+  int v8570=v7496+1;
+  int v8571=v2562+2;
+  int v8572=v747+1;
+  int v8573=v5883+8;
+  int v8574=v6590+8;
+  int v8575=v3428+4;
+  int v8576=v5695+8;
+  int v8577=v7032+9;
+  int v8578=v2825+0;
+  int v8579=v4630+1;
+  int v8580=v3987+3;
+  int v8581=v6802+0;
+  int v8582=v1407+8;
+  int v8583=v4628+2;
+  int v8584=v547+6;
+  int v8585=v1845+9;
+  int v8586=v2401+6;
+  int v8587=v7115+5;
+  int v8588=v2104+9;
+  int v8589=v7509+6;
+  int v8590=v1101+1;
+  int v8591=v5998+7;
+  int v8592=v6067+4;
+  int v8593=v2788+1;
+  int v8594=v3952+0;
+  int v8595=v4548+8;
+  int v8596=v175+1;
+  int v8597=v5496+8;
+  int v8598=v841+5;
+  int v8599=v2621+6;
+  int v8600=v6957+6;
+  int v8601=v2865+9;
+  int v8602=v5565+2;
+  int v8603=v5493+0;
+  int v8604=v5257+0;
+  int v8605=v7242+0;
+  int v8606=v3898+7;
+  int v8607=v1626+2;
+  int v8608=v7131+8;
+  int v8609=v4716+8;
+  int v8610=v1861+2;
+  int v8611=v7590+7;
+  int v8612=v4833+0;
+  int v8613=v6953+6;
+  int v8614=v5230+0;
+  int v8615=v61+3;
+  int v8616=v3083+5;
+  int v8617=v1020+0;
+  int v8618=v2875+3;
+  int v8619=v4017+6;
+  int v8620=v6475+4;
+  int v8621=v425+6;
+  int v8622=v5157+0;
+  int v8623=v5688+4;
+  int v8624=v1781+2;
+  int v8625=v1458+3;
+  int v8626=v7327+4;
+  int v8627=v7598+3;
+  int v8628=v5576+3;
+  int v8629=v3743+7;
+  int v8630=v943+2;
+  int v8631=v4891+9;
+  int v8632=v6422+5;
+  int v8633=v2061+5;
+  int v8634=v4885+9;
+  int v8635=v2557+6;
+  int v8636=v7805+9;
+  int v8637=v5537+1;
+  int v8638=v6124+7;
+  int v8639=v7585+3;
+  int v8640=v6173+4;
+  int v8641=v4175+0;
+  int v8642=v2749+8;
+  int v8643=v8143+3;
+  int v8644=v4424+9;
+  int v8645=v3886+4;
+  int v8646=v3537+2;
+  int v8647=v1949+5;
+  int v8648=v1449+0;
+  int v8649=v5968+4;
+  int v8650=v1121+5;
+  int v8651=v5600+9;
+  int v8652=v1492+0;
+  int v8653=v5084+5;
+  int v8654=v4404+5;
+  int v8655=v2558+9;
+  int v8656=v3786+3;
+  int v8657=v3827+2;
+  int v8658=v4636+7;
+  int v8659=v6456+9;
+  int v8660=v2866+7;
+  int v8661=v7216+1;
+  int v8662=v7242+4;
+  int v8663=v7806+5;
+  int v8664=v6319+1;
+  int v8665=v6452+3;
+  int v8666=v8128+2;
+  int v8667=v6372+9;
+  int v8668=v5466+5;
+  int v8669=v6638+5;
+  int v8670=v2868+9;
+  int v8671=v3334+9;
+  int v8672=v5249+9;
+  int v8673=v7041+4;
+  int v8674=v426+0;
+  int v8675=v4791+4;
+  int v8676=v7003+3;
+  int v8677=v2098+6;
+  int v8678=v5234+9;
+  int v8679=v5814+1;
+  int v8680=v5541+7;
+  int v8681=v7410+5;
+  int v8682=v3151+5;
+  int v8683=v3948+8;
+  int v8684=v7655+4;
+  int v8685=v6757+0;
+  int v8686=v5738+9;
+  int v8687=v2944+6;
+  int v8688=v583+1;
+  int v8689=v2563+5;
+  int v8690=v7079+9;
+  int v8691=v5265+4;
+  int v8692=v647+7;
+  int v8693=v5392+8;
+  int v8694=v6264+3;
+  int v8695=v664+0;
+  int v8696=v5661+4;
+  int v8697=v8129+0;
+  int v8698=v2411+4;
+  int v8699=v1048+2;
+  int v8700=v4450+8;
+  int v8701=v3291+6;
+  int v8702=v8590+2;
+  int v8703=v8576+7;
+  int v8704=v8481+0;
+  int v8705=v8633+2;
+  int v8706=v7983+5;
+  int v8707=v577+2;
+  int v8708=v2975+0;
+  int v8709=v8173+8;
+  int v8710=v6519+4;
+  int v8711=v5528+7;
+  int v8712=v7421+4;
+  int v8713=v878+7;
+  int v8714=v6761+9;
+  int v8715=v8232+1;
+  int v8716=v2830+1;
+  int v8717=v986+8;
+  int v8718=v249+9;
+  int v8719=v771+5;
+  int v8720=v2290+3;
+  int v8721=v6650+0;
+  int v8722=v8140+3;
+  int v8723=v5844+1;
+  int v8724=v7738+4;
+  int v8725=v3564+0;
+  int v8726=v2742+5;
+  int v8727=v6651+9;
+  int v8728=v4136+0;
+  int v8729=v750+8;
+  int v8730=v7170+6;
+  int v8731=v307+9;
+  int v8732=v3686+2;
+  int v8733=v7438+4;
+  int v8734=v7364+7;
+  int v8735=v745+3;
+  int v8736=v7892+1;
+  int v8737=v4002+9;
+  int v8738=v1524+6;
+  int v8739=v6640+2;
+  int v8740=v2802+5;
+  int v8741=v8405+7;
+  int v8742=v6790+2;
+  int v8743=v5169+9;
+  int v8744=v2294+8;
+  int v8745=v2446+6;
+  int v8746=v8575+1;
+  int v8747=v4787+9;
+  int v8748=v368+0;
+  int v8749=v7534+6;
+  int v8750=v7908+9;
+  int v8751=v6759+3;
+  int v8752=v750+3;
+  int v8753=v5162+8;
+  int v8754=v4066+3;
+  int v8755=v3368+4;
+  int v8756=v6579+4;
+  int v8757=v268+0;
+  int v8758=v4917+6;
+  int v8759=v8288+5;
+  int v8760=v7242+6;
+  int v8761=v7942+7;
+  int v8762=v606+4;
+  int v8763=v3687+0;
+  int v8764=v4605+4;
+  int v8765=v5631+3;
+  int v8766=v6268+9;
+  int v8767=v1522+5;
+  int v8768=v7888+2;
+  int v8769=v2405+0;
+  int v8770=v7715+2;
+  int v8771=v5903+8;
+  int v8772=v380+1;
+  int v8773=v4426+2;
+  int v8774=v3671+7;
+  int v8775=v2179+8;
+  int v8776=v2706+1;
+  int v8777=v7133+6;
+  int v8778=v5563+4;
+  int v8779=v4953+3;
+  int v8780=v6882+4;
+  int v8781=v5184+9;
+  int v8782=v5618+6;
+  int v8783=v7617+7;
+  int v8784=v8715+2;
+  int v8785=v6844+7;
+  int v8786=v2895+0;
+  int v8787=v5726+7;
+  int v8788=v8070+1;
+  int v8789=v2035+7;
+  int v8790=v148+1;
+  int v8791=v6501+6;
+  int v8792=v3053+7;
+  int v8793=v8185+1;
+  int v8794=v8046+4;
+  int v8795=v88+6;
+  int v8796=v7811+3;
+  int v8797=v7038+7;
+  int v8798=v6305+6;
+  int v8799=v7+3;
+  int v8800=v7370+6;
+  int v8801=v3018+3;
+  int v8802=v1731+6;
+  int v8803=v4224+2;
+  int v8804=v5619+5;
+  int v8805=v4528+8;
+  int v8806=v5730+0;
+  int v8807=v7920+6;
+  int v8808=v6395+2;
+  int v8809=v1753+4;
+  int v8810=v2593+7;
+  int v8811=v7969+7;
+  int v8812=v7189+2;
+  int v8813=v1176+0;
+  int v8814=v379+4;
+  int v8815=v782+4;
+  int v8816=v6313+2;
+  int v8817=v3180+2;
+  int v8818=v473+2;
+  int v8819=v2331+6;
+  int v8820=v3672+2;
+  int v8821=v1375+4;
+  int v8822=v2504+8;
+  int v8823=v3559+5;
+  int v8824=v7704+2;
+  int v8825=v6729+2;
+  int v8826=v6477+5;
+  int v8827=v2605+8;
+  int v8828=v6586+6;
+  int v8829=v8670+7;
+  int v8830=v3934+2;
+  int v8831=v6875+1;
+  int v8832=v7699+8;
+  int v8833=v7764+7;
+  int v8834=v5817+4;
+  int v8835=v5088+1;
+  int v8836=v1664+1;
+  int v8837=v8117+5;
+  int v8838=v4910+0;
+  int v8839=v227+8;
+  int v8840=v6215+4;
+  int v8841=v5331+5;
+  int v8842=v5191+9;
+  int v8843=v5977+7;
+  int v8844=v2873+6;
+  int v8845=v1298+1;
+  int v8846=v5286+0;
+  int v8847=v6093+1;
+  int v8848=v3462+2;
+  int v8849=v8251+0;
+  int v8850=v128+5;
+  int v8851=v47+2;
+  int v8852=v181+9;
+  int v8853=v6276+8;
+  int v8854=v7619+0;
+  int v8855=v3511+8;
+  int v8856=v1986+8;
+  int v8857=v2784+2;
+  int v8858=v33+6;
+  int v8859=v6684+0;
+  int v8860=v445+7;
+  int v8861=v1486+1;
+  int v8862=v329+7;
+  int v8863=v7831+3;
+  int v8864=v1565+2;
+  int v8865=v1983+9;
+  int v8866=v7475+7;
+  int v8867=v1998+9;
+  int v8868=v5655+0;
+  int v8869=v2192+6;
+  int v8870=v4544+3;
+  int v8871=v3115+3;
+  int v8872=v8810+8;
+  int v8873=v376+4;
+  int v8874=v3768+6;
+  int v8875=v1177+8;
+  int v8876=v7720+3;
+  int v8877=v5006+0;
+  int v8878=v4053+5;
+  int v8879=v4072+7;
+  int v8880=v6813+9;
+  int v8881=v6175+2;
+  int v8882=v2324+1;
+  int v8883=v4998+3;
+  int v8884=v1117+8;
+  int v8885=v7004+6;
+  int v8886=v8539+7;
+  int v8887=v2145+4;
+  int v8888=v87+4;
+  int v8889=v7812+3;
+  int v8890=v2066+3;
+  int v8891=v7747+7;
+  int v8892=v7833+2;
+  int v8893=v176+0;
+  int v8894=v6779+3;
+  int v8895=v6495+8;
+  int v8896=v3190+5;
+  int v8897=v6918+8;
+  int v8898=v7513+8;
+  int v8899=v4377+7;
+  int v8900=v3456+9;
+  int v8901=v7440+2;
+  int v8902=v4782+1;
+  int v8903=v5250+9;
+  int v8904=v3736+3;
+  int v8905=v5059+2;
+  int v8906=v5344+9;
+  int v8907=v4407+7;
+  int v8908=v7790+6;
+  int v8909=v1314+1;
+  int v8910=v2443+2;
+  int v8911=v1519+6;
+  int v8912=v871+6;
+  int v8913=v3299+3;
+  int v8914=v4487+3;
+  int v8915=v1414+6;
+  int v8916=v8512+9;
+  int v8917=v7210+3;
+  int v8918=v8486+6;
+  int v8919=v2324+8;
+  int v8920=v8113+5;
+  int v8921=v1000+6;
+  int v8922=v2272+2;
+  int v8923=v1968+1;
+  int v8924=v5900+8;
+  int v8925=v5133+1;
+  int v8926=v5242+4;
+  int v8927=v2980+3;
+  int v8928=v4747+1;
+  int v8929=v1000+4;
+  int v8930=v500+3;
+  int v8931=v3739+4;
+  int v8932=v2660+2;
+  int v8933=v6364+1;
+  int v8934=v7557+8;
+  int v8935=v6144+6;
+  int v8936=v219+2;
+  int v8937=v6327+3;
+  int v8938=v494+9;
+  int v8939=v8339+6;
+  int v8940=v2385+3;
+  int v8941=v1838+7;
+  int v8942=v2316+0;
+  int v8943=v7667+1;
+  int v8944=v4604+4;
+  int v8945=v2069+4;
+  int v8946=v5859+6;
+  int v8947=v2867+5;
+  int v8948=v6509+8;
+  int v8949=v5512+8;
+  int v8950=v6251+8;
+  int v8951=v3408+7;
+  int v8952=v6208+8;
+  int v8953=v4090+6;
+  int v8954=v3599+5;
+  int v8955=v8171+2;
+  int v8956=v4597+4;
+  int v8957=v4670+0;
+  int v8958=v6467+4;
+  int v8959=v3846+3;
+  int v8960=v7526+6;
+  int v8961=v537+0;
+  int v8962=v3238+4;
+  int v8963=v7175+1;
+  int v8964=v5792+7;
+  int v8965=v7600+9;
+  int v8966=v8787+5;
+  int v8967=v7069+6;
+  int v8968=v1609+0;
+  int v8969=v2893+0;
+  int v8970=v1093+8;
+  int v8971=v134+2;
+  int v8972=v1486+4;
+  int v8973=v2185+3;
+  int v8974=v3218+6;
+  int v8975=v1642+7;
+  int v8976=v8946+7;
+  int v8977=v3152+6;
+  int v8978=v4579+5;
+  int v8979=v891+5;
+  int v8980=v8843+4;
+  int v8981=v1504+4;
+  int v8982=v2643+0;
+  int v8983=v1347+4;
+  int v8984=v3626+5;
+  int v8985=v8027+8;
+  int v8986=v1580+2;
+  int v8987=v2402+7;
+  int v8988=v450+9;
+  int v8989=v5997+3;
+  int v8990=v3864+7;
+  int v8991=v3474+1;
+  int v8992=v4559+7;
+  int v8993=v1135+8;
+  int v8994=v7342+8;
+  int v8995=v1903+2;
+  int v8996=v4421+2;
+  int v8997=v7369+7;
+  int v8998=v1049+6;
+  int v8999=v1825+1;
+  int v9000=v8456+3;
+  int v9001=v7726+5;
+  int v9002=v4325+9;
+  int v9003=v6478+3;
+  int v9004=v1748+6;
+  int v9005=v401+6;
+  int v9006=v5507+9;
+  int v9007=v7145+8;
+  int v9008=v5421+4;
+  int v9009=v2108+5;
+  int v9010=v828+8;
+  int v9011=v2753+1;
+  int v9012=v4952+5;
+  int v9013=v3357+2;
+  int v9014=v4940+2;
+  int v9015=v1124+9;
+  int v9016=v924+0;
+  int v9017=v4413+7;
+  int v9018=v4826+6;
+  int v9019=v5903+1;
+  int v9020=v5771+5;
+  int v9021=v6404+2;
+  int v9022=v6129+3;
+  int v9023=v5510+6;
+  int v9024=v4336+1;
+  int v9025=v2321+1;
+  int v9026=v3443+4;
+  int v9027=v5252+4;
+  int v9028=v7012+1;
+  int v9029=v2419+4;
+  int v9030=v8250+4;
+  int v9031=v1652+0;
+  int v9032=v2371+6;
+  int v9033=v6607+1;
+  int v9034=v2345+1;
+  int v9035=v5997+9;
+  int v9036=v3170+2;
+  int v9037=v1455+1;
+  int v9038=v7554+6;
+  int v9039=v7174+3;
+  int v9040=v8447+0;
+  int v9041=v1710+3;
+  int v9042=v2674+7;
+  int v9043=v5124+4;
+  int v9044=v8161+9;
+  int v9045=v1138+8;
+  int v9046=v773+9;
+  int v9047=v2082+8;
+  int v9048=v7104+6;
+  int v9049=v5941+5;
+  int v9050=v3810+5;
+  int v9051=v2425+4;
+  int v9052=v443+6;
+  int v9053=v8677+7;
+  int v9054=v1544+7;
+  int v9055=v3854+1;
+  int v9056=v5195+1;
+  int v9057=v6697+2;
+  int v9058=v2293+2;
+  int v9059=v6423+6;
+  int v9060=v1837+5;
+  int v9061=v1252+2;
+  int v9062=v5342+3;
+  int v9063=v600+2;
+  int v9064=v5581+3;
+  int v9065=v3137+5;
+  int v9066=v3232+5;
+  int v9067=v882+9;
+  int v9068=v4135+6;
+  int v9069=v5623+8;
+  int v9070=v7751+7;
+  int v9071=v2707+2;
+  int v9072=v985+4;
+  int v9073=v2275+8;
+  int v9074=v52+4;
+  int v9075=v6515+2;
+  int v9076=v7434+9;
+  int v9077=v6650+3;
+  int v9078=v333+3;
+  int v9079=v5247+8;
+  int v9080=v2928+8;
+  int v9081=v8906+0;
+  int v9082=v7936+1;
+  int v9083=v3779+2;
+  int v9084=v7953+8;
+  int v9085=v6042+3;
+  int v9086=v5154+1;
+  int v9087=v7240+5;
+  int v9088=v518+8;
+  int v9089=v2250+5;
+  int v9090=v679+4;
+  int v9091=v4613+4;
+  int v9092=v799+3;
+  int v9093=v4659+5;
+  int v9094=v6827+6;
+  int v9095=v6581+7;
+  int v9096=v5692+3;
+  int v9097=v1540+3;
+  int v9098=v6039+5;
+  int v9099=v1015+2;
+  int v9100=v7669+7;
+  int v9101=v1874+2;
+  int v9102=v4251+8;
+  int v9103=v6126+2;
+  int v9104=v6312+8;
+  int v9105=v374+8;
+  int v9106=v7957+1;
+  int v9107=v4844+9;
+  int v9108=v1466+2;
+  int v9109=v725+6;
+  int v9110=v7790+4;
+  int v9111=v3146+6;
+  int v9112=v635+0;
+  int v9113=v1343+4;
+  int v9114=v2590+8;
+  int v9115=v7380+7;
+  int v9116=v8309+4;
+  int v9117=v7765+6;
+  int v9118=v6557+8;
+  int v9119=v856+4;
+  int v9120=v7233+7;
+  int v9121=v305+6;
+  int v9122=v3730+9;
+  int v9123=v5068+5;
+  int v9124=v8288+5;
+  int v9125=v7855+0;
+  int v9126=v8456+2;
+  int v9127=v7906+4;
+  int v9128=v7568+3;
+  int v9129=v7062+4;
+  int v9130=v2332+6;
+  int v9131=v7611+8;
+  int v9132=v1090+7;
+  int v9133=v7393+8;
+  int v9134=v2051+6;
+  int v9135=v8803+0;
+  int v9136=v3737+6;
+  int v9137=v579+5;
+  int v9138=v5458+1;
+  int v9139=v5085+5;
+  int v9140=v2993+3;
+  int v9141=v8710+7;
+  int v9142=v6269+3;
+  int v9143=v7972+2;
+  int v9144=v1916+5;
+  int v9145=v2920+2;
+  int v9146=v6594+3;
+  int v9147=v2650+5;
+  int v9148=v6436+6;
+  int v9149=v1000+6;
+  int v9150=v6697+2;
+  int v9151=v8427+6;
+  int v9152=v6267+9;
+  int v9153=v6252+4;
+  int v9154=v5950+8;
+  int v9155=v8901+6;
+  int v9156=v87+9;
+  int v9157=v2271+8;
+  int v9158=v2897+2;
+  int v9159=v5980+1;
+  int v9160=v5579+0;
+  int v9161=v7404+6;
+  int v9162=v117+1;
+  int v9163=v3450+7;
+  int v9164=v7899+2;
+  int v9165=v2057+0;
+  int v9166=v5851+4;
+  int v9167=v5798+8;
+  int v9168=v1543+4;
+  int v9169=v2699+1;
+  int v9170=v3482+3;
+  int v9171=v6500+0;
+  int v9172=v274+1;
+  int v9173=v8804+6;
+  int v9174=v4620+7;
+  int v9175=v6676+1;
+  int v9176=v6480+7;
+  int v9177=v6246+5;
+  int v9178=v5455+9;
+  int v9179=v1286+9;
+  int v9180=v6039+6;
+  int v9181=v3365+5;
+  int v9182=v3704+9;
+  int v9183=v7055+4;
+  int v9184=v6035+6;
+  int v9185=v1903+0;
+  int v9186=v7604+5;
+  int v9187=v1858+9;
+  int v9188=v3059+1;
+  int v9189=v8621+2;
+  int v9190=v9137+4;
+  int v9191=v1679+7;
+  int v9192=v5089+5;
+  int v9193=v5645+8;
+  int v9194=v3016+5;
+  int v9195=v5071+5;
+  int v9196=v7228+3;
+  int v9197=v4198+1;
+  int v9198=v6672+3;
+  int v9199=v5351+8;
+  int v9200=v4491+3;
+  int v9201=v4638+0;
+  int v9202=v2822+1;
+  int v9203=v3313+6;
+  int v9204=v6215+7;
+  int v9205=v7391+1;
+  int v9206=v4407+2;
+  int v9207=v4053+0;
+  int v9208=v4551+0;
+  int v9209=v8967+9;
+  int v9210=v5866+7;
+  int v9211=v846+9;
+  int v9212=v3803+9;
+  int v9213=v1466+0;
+  int v9214=v8269+3;
+  int v9215=v2075+2;
+  int v9216=v4867+1;
+  int v9217=v1378+4;
+  int v9218=v8363+1;
+  int v9219=v3843+9;
+  int v9220=v1654+6;
+  int v9221=v577+3;
+  int v9222=v8738+7;
+  int v9223=v3302+2;
+  int v9224=v6618+0;
+  int v9225=v5977+3;
+  int v9226=v7122+7;
+  int v9227=v4995+2;
+  int v9228=v9221+7;
+  int v9229=v7250+0;
+  int v9230=v4394+8;
+  int v9231=v3861+2;
+  int v9232=v779+4;
+  int v9233=v5404+0;
+  int v9234=v4412+1;
+  int v9235=v7864+5;
+  int v9236=v3140+4;
+  int v9237=v3369+5;
+  int v9238=v8702+2;
+  int v9239=v273+0;
+  int v9240=v5146+5;
+  int v9241=v7523+0;
+  int v9242=v7648+6;
+  int v9243=v3252+3;
+  int v9244=v8563+2;
+  int v9245=v8743+8;
+  int v9246=v1691+3;
+  int v9247=v7066+0;
+  int v9248=v4231+1;
+  int v9249=v6686+1;
+  int v9250=v758+9;
+  int v9251=v587+7;
+  int v9252=v5103+2;
+  int v9253=v8799+9;
+  int v9254=v4212+7;
+  int v9255=v8221+7;
+  int v9256=v1243+0;
+  int v9257=v2966+3;
+  int v9258=v2521+5;
+  int v9259=v8152+2;
+  int v9260=v1571+7;
+  int v9261=v1370+3;
+  int v9262=v9019+8;
+  int v9263=v6763+5;
+  int v9264=v5932+8;
+  int v9265=v6071+0;
+  int v9266=v8758+0;
+  int v9267=v5878+5;
+  int v9268=v5700+2;
+  int v9269=v6093+8;
+  int v9270=v7882+3;
+  int v9271=v5221+9;
+  int v9272=v2293+3;
+  int v9273=v117+6;
+  int v9274=v6953+0;
+  int v9275=v9126+2;
+  int v9276=v938+2;
+  int v9277=v1755+5;
+  int v9278=v3113+4;
+  int v9279=v9181+5;
+  int v9280=v5814+5;
+  int v9281=v3937+3;
+  int v9282=v1324+2;
+  int v9283=v4247+0;
+  int v9284=v3478+1;
+  int v9285=v1310+5;
+  int v9286=v1801+8;
+  int v9287=v227+3;
+  int v9288=v6450+8;
+  int v9289=v4829+4;
+  int v9290=v325+4;
+  int v9291=v1112+2;
+  int v9292=v647+0;
+  int v9293=v6435+3;
+  int v9294=v7631+9;
+  int v9295=v1420+4;
+  int v9296=v9282+7;
+  int v9297=v1772+7;
+  int v9298=v1076+2;
+  int v9299=v1383+6;
+  int v9300=v9293+8;
+  int v9301=v2460+0;
+  int v9302=v3973+3;
+  int v9303=v2296+0;
+  int v9304=v8316+3;
+  int v9305=v3783+8;
+  int v9306=v8243+2;
+  int v9307=v74+7;
+  int v9308=v1696+0;
+  int v9309=v8554+7;
+  int v9310=v7509+8;
+  int v9311=v5937+7;
+  int v9312=v3335+2;
+  int v9313=v2633+7;
+  int v9314=v5193+9;
+  int v9315=v2148+9;
+  int v9316=v6432+4;
+  int v9317=v2809+9;
+  int v9318=v7447+2;
+  int v9319=v438+4;
+  int v9320=v162+9;
+  int v9321=v6446+7;
+  int v9322=v5395+2;
+  int v9323=v5382+2;
+  int v9324=v4193+5;
+  int v9325=v3150+7;
+  int v9326=v3001+0;
+  int v9327=v2795+8;
+  int v9328=v9182+3;
+  int v9329=v5161+8;
+  int v9330=v1919+1;
+  int v9331=v3610+4;
+  int v9332=v1778+7;
+  int v9333=v6037+4;
+  int v9334=v1676+9;
+  int v9335=v7781+5;
+  int v9336=v3801+5;
+  int v9337=v1378+4;
+  int v9338=v857+0;
+  int v9339=v8221+0;
+  int v9340=v8529+4;
+  int v9341=v786+2;
+  int v9342=v9006+2;
+  int v9343=v5964+0;
+  int v9344=v653+6;
+  int v9345=v1686+8;
+  int v9346=v1064+1;
+  int v9347=v6773+2;
+  int v9348=v7352+3;
+  int v9349=v8123+2;
+  int v9350=v7265+2;
+  int v9351=v5549+7;
+  int v9352=v7458+1;
+  int v9353=v6507+0;
+  int v9354=v2694+2;
+  int v9355=v5054+5;
+  int v9356=v2098+4;
+  int v9357=v7717+9;
+  int v9358=v1612+4;
+  int v9359=v5473+0;
+  int v9360=v4606+9;
+  int v9361=v1066+1;
+  int v9362=v4056+6;
+  int v9363=v8560+5;
+  int v9364=v1185+3;
+  int v9365=v2649+3;
+  int v9366=v8325+3;
+  int v9367=v4194+0;
+  int v9368=v6276+9;
+  int v9369=v3609+8;
+  int v9370=v4857+8;
+  int v9371=v8294+0;
+  int v9372=v1893+3;
+  int v9373=v1267+4;
+  int v9374=v6098+1;
+  int v9375=v2206+6;
+  int v9376=v6811+3;
+  int v9377=v3115+2;
+  int v9378=v2634+4;
+  int v9379=v2603+4;
+  int v9380=v2866+0;
+  int v9381=v1486+4;
+  int v9382=v8209+9;
+  int v9383=v2582+2;
+  int v9384=v3283+1;
+  int v9385=v7922+2;
+  int v9386=v5862+4;
+  int v9387=v5459+3;
+  int v9388=v199+1;
+  int v9389=v7044+7;
+  int v9390=v7668+0;
+  int v9391=v9234+5;
+  int v9392=v8161+5;
+  int v9393=v4953+8;
+  int v9394=v3352+1;
+  int v9395=v5167+9;
+  int v9396=v2784+4;
+  int v9397=v749+7;
+  int v9398=v9178+9;
+  int v9399=v4275+6;
+  int v9400=v803+7;
+  int v9401=v4370+3;
+  int v9402=v6083+5;
+  int v9403=v7865+2;
+  int v9404=v4439+4;
+  int v9405=v1581+7;
+  int v9406=v9275+0;
+  int v9407=v7061+1;
+  int v9408=v2337+8;
+  int v9409=v4907+1;
+  int v9410=v7803+0;
+  int v9411=v4597+6;
+  int v9412=v8911+3;
+  int v9413=v6244+1;
+  int v9414=v2338+3;
+  int v9415=v2965+2;
+  int v9416=v8704+0;
+  int v9417=v1867+5;
+  int v9418=v1716+0;
+  int v9419=v6315+7;
+  int v9420=v1385+9;
+  int v9421=v7149+9;
+  int v9422=v2576+6;
+  int v9423=v2341+0;
+  int v9424=v6034+1;
+  int v9425=v4259+2;
+  int v9426=v7437+2;
+  int v9427=v4825+0;
+  int v9428=v7221+1;
+  int v9429=v2229+6;
+  int v9430=v6937+6;
+  int v9431=v5103+7;
+  int v9432=v2250+0;
+  int v9433=v430+1;
+  int v9434=v9143+9;
+  int v9435=v379+4;
+  int v9436=v7728+6;
+  int v9437=v9043+2;
+  int v9438=v1401+7;
+  int v9439=v1306+2;
+  int v9440=v2671+9;
+  int v9441=v7012+1;
+  int v9442=v5729+3;
+  int v9443=v1300+2;
+  int v9444=v8914+6;
+  int v9445=v5673+2;
+  int v9446=v1468+8;
+  int v9447=v7714+0;
+  int v9448=v7238+4;
+  int v9449=v1353+6;
+  int v9450=v7849+1;
+  int v9451=v8885+3;
+  int v9452=v4625+0;
+  int v9453=v161+8;
+  int v9454=v4975+0;
+  int v9455=v2335+5;
+  int v9456=v6523+0;
+  int v9457=v3297+9;
+  int v9458=v3262+7;
+  int v9459=v4394+4;
+  int v9460=v4469+1;
+  int v9461=v6938+1;
+  int v9462=v8046+8;
+  int v9463=v2476+5;
+  int v9464=v8915+8;
+  int v9465=v6179+1;
+  int v9466=v8603+3;
+  int v9467=v603+6;
+  int v9468=v8381+3;
+  int v9469=v5442+0;
+  int v9470=v2736+0;
+  int v9471=v7848+6;
+  int v9472=v6385+6;
+  int v9473=v4084+8;
+  int v9474=v5999+6;
+  int v9475=v3135+2;
+  int v9476=v7896+0;
+  int v9477=v3124+0;
+  int v9478=v2954+1;
+  int v9479=v9442+9;
+  int v9480=v5598+7;
+  int v9481=v7465+6;
+  int v9482=v437+5;
+  int v9483=v6876+5;
+  int v9484=v5125+0;
+  int v9485=v2947+6;
+  int v9486=v8535+4;
+  int v9487=v8541+6;
+  int v9488=v6324+2;
+  int v9489=v6458+0;
+  int v9490=v2225+3;
+  int v9491=v6549+3;
+  int v9492=v2185+5;
+  int v9493=v6219+3;
+  int v9494=v4155+9;
+  int v9495=v5612+6;
+  int v9496=v2831+5;
+  int v9497=v7969+6;
+  int v9498=v1667+1;
+  int v9499=v6467+8;
+  int v9500=v7449+9;
+  int v9501=v5391+4;
+  int v9502=v9087+7;
+  int v9503=v5827+1;
+  int v9504=v5297+5;
+  int v9505=v3927+2;
+  int v9506=v3510+8;
+  int v9507=v4642+5;
+  int v9508=v5768+5;
+  int v9509=v7055+6;
+  int v9510=v7386+0;
+  int v9511=v3136+0;
+  int v9512=v3975+2;
+  int v9513=v9127+1;
+  int v9514=v3844+7;
+  int v9515=v2908+6;
+  int v9516=v5717+5;
+  int v9517=v6890+3;
+  int v9518=v7533+8;
+  int v9519=v6784+2;
+  int v9520=v4035+6;
+  int v9521=v7578+6;
+  int v9522=v6750+3;
+  int v9523=v5941+8;
+  int v9524=v5749+7;
+  int v9525=v4308+8;
+  int v9526=v2735+0;
+  int v9527=v2501+4;
+  int v9528=v9492+9;
+  int v9529=v9080+2;
+  int v9530=v1617+4;
+  int v9531=v4208+7;
+  int v9532=v8862+4;
+  int v9533=v52+6;
+  int v9534=v5518+8;
+  int v9535=v4959+3;
+  int v9536=v1690+2;
+  int v9537=v5178+0;
+  int v9538=v811+1;
+  int v9539=v2161+1;
+  int v9540=v3375+8;
+  int v9541=v2642+8;
+  int v9542=v2898+0;
+  int v9543=v7406+4;
+  int v9544=v4670+2;
+  int v9545=v6964+1;
+  int v9546=v7501+7;
+  int v9547=v2773+3;
+  int v9548=v3329+9;
+  int v9549=v2685+1;
+  int v9550=v4513+4;
+  int v9551=v4313+2;
+  int v9552=v6811+0;
+  int v9553=v8555+2;
+  int v9554=v4905+3;
+  int v9555=v140+1;
+  int v9556=v2791+3;
+  int v9557=v3853+9;
+  int v9558=v8007+4;
+  int v9559=v1322+6;
+  int v9560=v6422+1;
+  int v9561=v5118+5;
+  int v9562=v380+6;
+  int v9563=v1805+2;
+  int v9564=v1798+0;
+  int v9565=v8148+2;
+  int v9566=v2789+4;
+  int v9567=v7845+4;
+  int v9568=v8146+7;
+  int v9569=v1371+4;
+  int v9570=v856+3;
+  int v9571=v3925+7;
+  int v9572=v3756+6;
+  int v9573=v6710+8;
+  int v9574=v2323+3;
+  int v9575=v1813+3;
+  int v9576=v392+1;
+  int v9577=v6728+6;
+  int v9578=v5044+0;
+  int v9579=v2623+1;
+  int v9580=v5805+6;
+  int v9581=v7919+9;
+  int v9582=v6713+0;
+  int v9583=v2845+6;
+  int v9584=v2447+4;
+  int v9585=v512+6;
+  int v9586=v8442+1;
+  int v9587=v3567+0;
+  int v9588=v1659+6;
+  int v9589=v9114+8;
+  int v9590=v4340+7;
+  int v9591=v9204+0;
+  int v9592=v7417+5;
+  int v9593=v5307+4;
+  int v9594=v1622+8;
+  int v9595=v8524+2;
+  int v9596=v4681+2;
+  int v9597=v5470+0;
+  int v9598=v9477+3;
+  int v9599=v796+0;
+  int v9600=v8350+9;
+  int v9601=v5402+3;
+  int v9602=v7563+8;
+  int v9603=v1180+0;
+  int v9604=v9220+3;
+  int v9605=v6719+5;
+  int v9606=v4357+9;
+  int v9607=v4112+1;
+  int v9608=v1446+0;
+  int v9609=v2280+2;
+  int v9610=v5788+6;
+  int v9611=v4148+9;
+  int v9612=v9543+9;
+  int v9613=v9547+8;
+  int v9614=v5003+6;
+  int v9615=v776+6;
+  int v9616=v5551+0;
+  int v9617=v4659+6;
+  int v9618=v6678+9;
+  int v9619=v8731+8;
+  int v9620=v2112+6;
+  int v9621=v7467+3;
+  int v9622=v5259+8;
+  int v9623=v3499+2;
+  int v9624=v598+3;
+  int v9625=v9005+1;
+  int v9626=v5405+6;
+  int v9627=v1905+6;
+  int v9628=v4066+9;
+  int v9629=v2194+0;
+  int v9630=v3817+5;
+  int v9631=v734+0;
+  int v9632=v9506+8;
+  int v9633=v5797+9;
+  int v9634=v5062+2;
+  int v9635=v7403+9;
+  int v9636=v2470+7;
+  int v9637=v5529+7;
+  int v9638=v9348+8;
+  int v9639=v7277+4;
+  int v9640=v7865+3;
+  int v9641=v8423+4;
+  int v9642=v8021+1;
+  int v9643=v3625+3;
+  int v9644=v2725+9;
+  int v9645=v9139+4;
+  int v9646=v6624+2;
+  int v9647=v1782+4;
+  int v9648=v1099+6;
+  int v9649=v5515+6;
+  int v9650=v4537+6;
+  int v9651=v1024+3;
+  int v9652=v1322+7;
+  int v9653=v212+4;
+  int v9654=v394+7;
+  int v9655=v3902+1;
+  int v9656=v435+8;
+  int v9657=v6771+7;
+  int v9658=v719+7;
+  int v9659=v3015+0;
+  int v9660=v9206+2;
+  int v9661=v3510+4;
+  int v9662=v7269+9;
+  int v9663=v696+4;
+  int v9664=v7712+5;
+  int v9665=v2679+8;
+  int v9666=v2672+7;
+  int v9667=v8908+2;
+  int v9668=v8417+5;
+  int v9669=v945+6;
+  int v9670=v6286+3;
+  int v9671=v3004+8;
+  int v9672=v2893+7;
+  int v9673=v7888+9;
+  int v9674=v3118+4;
+  int v9675=v1248+5;
+  int v9676=v582+0;
+  int v9677=v8276+0;
+  int v9678=v983+6;
+  int v9679=v133+7;
+  int v9680=v4606+0;
+  int v9681=v6336+8;
+  int v9682=v8647+6;
+  int v9683=v3617+3;
+  int v9684=v1125+1;
+  int v9685=v2669+0;
+  int v9686=v7322+3;
+  int v9687=v4809+9;
+  int v9688=v3069+5;
+  int v9689=v7764+1;
+  int v9690=v5418+7;
+  int v9691=v5275+8;
+  int v9692=v6543+1;
+  int v9693=v6504+6;
+  int v9694=v5264+8;
+  int v9695=v1509+7;
+  int v9696=v1814+5;
+  int v9697=v2244+7;
+  int v9698=v7810+6;
+  int v9699=v6879+9;
+  int v9700=v7653+7;
+  int v9701=v4425+9;
+  int v9702=v3746+7;
+  int v9703=v7877+3;
+  int v9704=v9168+6;
+  int v9705=v3933+5;
+  int v9706=v132+2;
+  int v9707=v8388+6;
+  int v9708=v1175+3;
+  int v9709=v2671+2;
+  int v9710=v3119+9;
+  int v9711=v1293+1;
+  int v9712=v6627+3;
+  int v9713=v4939+8;
+  int v9714=v6155+3;
+  int v9715=v7272+8;
+  int v9716=v9223+6;
+  int v9717=v413+8;
+  int v9718=v4596+9;
+  int v9719=v5374+0;
+  int v9720=v4345+5;
+  int v9721=v6650+6;
+  int v9722=v4592+1;
+  int v9723=v9259+6;
+  int v9724=v5198+2;
+  int v9725=v8014+4;
+  int v9726=v2615+6;
+  int v9727=v2995+4;
+  int v9728=v7203+5;
+  int v9729=v2311+1;
+  int v9730=v8072+6;
+  int v9731=v4433+4;
+  int v9732=v7669+5;
+  int v9733=v6417+9;
+  int v9734=v7882+8;
+  int v9735=v1021+2;
+  int v9736=v6188+0;
+  int v9737=v9591+7;
+  int v9738=v7420+5;
+  int v9739=v7977+6;
+  int v9740=v9407+6;
+  int v9741=v7498+0;
+  int v9742=v3699+4;
+  int v9743=v9302+0;
+  int v9744=v435+3;
+  int v9745=v8811+7;
+  int v9746=v7074+5;
+  int v9747=v4124+9;
+  int v9748=v2334+4;
+  int v9749=v8923+7;
+  int v9750=v148+0;
+  int v9751=v536+4;
+  int v9752=v8590+7;
+  int v9753=v2257+7;
+  int v9754=v7756+4;
+  int v9755=v6321+7;
+  int v9756=v2864+4;
+  int v9757=v5933+6;
+  int v9758=v6738+2;
+  int v9759=v6127+2;
+  int v9760=v836+9;
+  int v9761=v3853+2;
+  int v9762=v2783+4;
+  int v9763=v7893+6;
+  int v9764=v1860+3;
+  int v9765=v4324+6;
+  int v9766=v6624+4;
+  int v9767=v14+2;
+  int v9768=v6673+9;
+  int v9769=v8987+5;
+  int v9770=v8275+5;
+  int v9771=v839+0;
+  int v9772=v5584+0;
+  int v9773=v9361+7;
+  int v9774=v5744+0;
+  int v9775=v896+1;
+  int v9776=v1477+8;
+  int v9777=v5588+6;
+  int v9778=v8214+0;
+  int v9779=v2120+2;
+  int v9780=v1561+9;
+  int v9781=v9303+4;
+  int v9782=v7386+0;
+  int v9783=v7280+6;
+  int v9784=v8206+0;
+  int v9785=v2464+4;
+  int v9786=v2975+2;
+  int v9787=v7023+1;
+  int v9788=v3151+4;
+  int v9789=v4646+3;
+  int v9790=v584+4;
+  int v9791=v8072+8;
+  int v9792=v9425+7;
+  int v9793=v4484+3;
+  int v9794=v5935+7;
+  int v9795=v1591+2;
+  int v9796=v3690+7;
+  int v9797=v6252+3;
+  int v9798=v1306+7;
+  int v9799=v3369+7;
+  int v9800=v5309+6;
+  int v9801=v4140+5;
+  int v9802=v4588+3;
+  int v9803=v8940+4;
+  int v9804=v3969+0;
+  int v9805=v6455+9;
+  int v9806=v4640+4;
+  int v9807=v1837+8;
+  int v9808=v1199+2;
+  int v9809=v9401+7;
+  int v9810=v1505+1;
+  int v9811=v193+2;
+  int v9812=v4195+1;
+  int v9813=v3474+0;
+  int v9814=v5956+7;
+  int v9815=v8544+9;
+  int v9816=v7885+6;
+  int v9817=v4452+7;
+  int v9818=v2309+5;
+  int v9819=v1486+6;
+  int v9820=v4665+2;
+  int v9821=v3214+9;
+  int v9822=v6035+3;
+  int v9823=v607+9;
+  int v9824=v1987+2;
+  int v9825=v5550+9;
+  int v9826=v4325+2;
+  int v9827=v6088+2;
+  int v9828=v7489+6;
+  int v9829=v7605+4;
+  int v9830=v6319+5;
+  int v9831=v6176+9;
+  int v9832=v7991+4;
+  int v9833=v7295+4;
+  int v9834=v7388+2;
+  int v9835=v9222+2;
+  int v9836=v8396+1;
+  int v9837=v5529+4;
+  int v9838=v2290+6;
+  int v9839=v336+8;
+  int v9840=v946+8;
+  int v9841=v934+5;
+  int v9842=v9309+6;
+  int v9843=v7590+5;
+  int v9844=v8098+1;
+  int v9845=v8430+0;
+  int v9846=v7521+8;
+  int v9847=v2515+7;
+  int v9848=v9823+5;
+  int v9849=v2405+4;
+  int v9850=v7473+6;
+  int v9851=v4439+9;
+  int v9852=v3+3;
+  int v9853=v1030+0;
+  int v9854=v3654+6;
+  int v9855=v923+9;
+  int v9856=v8112+1;
+  int v9857=v8131+0;
+  int v9858=v1954+8;
+  int v9859=v8859+5;
+  int v9860=v9129+2;
+  int v9861=v2539+0;
+  int v9862=v7646+6;
+  int v9863=v2922+1;
+  int v9864=v735+0;
+  int v9865=v5391+6;
+  int v9866=v9289+1;
+  int v9867=v3684+3;
+  int v9868=v8114+9;
+  int v9869=v787+6;
+  int v9870=v1944+5;
+  int v9871=v580+9;
+  int v9872=v2002+2;
+  int v9873=v7842+8;
+  int v9874=v9390+7;
+  int v9875=v5319+2;
+  int v9876=v6666+9;
+  int v9877=v2686+0;
+  int v9878=v7845+6;
+  int v9879=v3546+6;
+  int v9880=v29+9;
+  int v9881=v4818+1;
+  int v9882=v4552+5;
+  int v9883=v4998+2;
+  int v9884=v2110+7;
+  int v9885=v362+8;
+  int v9886=v3560+5;
+  int v9887=v8262+4;
+  int v9888=v7309+9;
+  int v9889=v9106+8;
+  int v9890=v4093+1;
+  int v9891=v8917+1;
+  int v9892=v1593+1;
+  int v9893=v2755+9;
+  int v9894=v8979+8;
+  int v9895=v9318+9;
+  int v9896=v1992+0;
+  int v9897=v2974+7;
+  int v9898=v2072+2;
+  int v9899=v7724+5;
+  int v9900=v9147+7;
+  int v9901=v1575+2;
+  int v9902=v7237+6;
+  int v9903=v8750+8;
+  int v9904=v3197+5;
+  int v9905=v2210+7;
+  int v9906=v9171+4;
+  int v9907=v9239+6;
+  int v9908=v6291+0;
+  int v9909=v3053+1;
+  int v9910=v7961+2;
+  int v9911=v5598+0;
+  int v9912=v6353+1;
+  int v9913=v955+8;
+  int v9914=v3726+6;
+  int v9915=v5683+9;
+  int v9916=v4267+8;
+  int v9917=v6460+7;
+  int v9918=v4206+4;
+  int v9919=v7973+5;
+  int v9920=v4268+2;
+  int v9921=v3145+0;
+  int v9922=v9626+3;
+  int v9923=v1498+5;
+  int v9924=v885+3;
+  int v9925=v2963+4;
+  int v9926=v5329+3;
+  int v9927=v4962+2;
+  int v9928=v296+1;
+  int v9929=v4921+2;
+  int v9930=v9862+9;
+  int v9931=v4511+4;
+  int v9932=v9744+6;
+  int v9933=v3689+4;
+  int v9934=v9280+8;
+  int v9935=v579+1;
+  int v9936=v480+2;
+  int v9937=v5531+3;
+  int v9938=v6149+2;
+  int v9939=v6408+4;
+  int v9940=v714+3;
+  int v9941=v1744+8;
+  int v9942=v587+8;
+  int v9943=v7888+7;
+  int v9944=v9497+6;
+  int v9945=v2154+5;
+  int v9946=v1026+9;
+  int v9947=v366+2;
+  int v9948=v745+0;
+  int v9949=v8962+3;
+  int v9950=v5822+1;
+  int v9951=v7217+3;
+  int v9952=v8030+6;
+  int v9953=v8493+3;
+  int v9954=v2001+6;
+  int v9955=v4393+1;
+  int v9956=v4380+0;
+  int v9957=v695+0;
+  int v9958=v2424+2;
+  int v9959=v1734+4;
+  int v9960=v3485+0;
+  int v9961=v4099+4;
+  int v9962=v215+9;
+  int v9963=v5315+0;
+  int v9964=v7452+2;
+  int v9965=v2211+1;
+  int v9966=v7622+4;
+  int v9967=v4182+5;
+  int v9968=v7160+8;
+  int v9969=v2720+6;
+  int v9970=v2955+0;
+  int v9971=v5822+1;
+  int v9972=v5551+8;
+  int v9973=v6976+3;
+  int v9974=v792+5;
+  int v9975=v4011+7;
+  int v9976=v4575+4;
+  int v9977=v3377+7;
+  int v9978=v740+2;
+  int v9979=v4145+7;
+  int v9980=v4080+9;
+  int v9981=v6578+8;
+  int v9982=v1241+3;
+  int v9983=v4208+1;
+  int v9984=v8594+8;
+  int v9985=v6865+0;
+  int v9986=v8136+5;
+  int v9987=v4857+4;
+  int v9988=v4971+9;
+  int v9989=v6131+8;
+  int v9990=v1322+3;
+  int v9991=v6489+9;
+  int v9992=v7825+3;
+  int v9993=v4910+2;
+  int v9994=v264+7;
+  int v9995=v9439+7;
+  int v9996=v6206+5;
+  int v9997=v701+0;
+  int v9998=v7317+4;
+  int v9999=v970+9;
+  int v10000=v6654+0;
+  int v10001=v688+3;
+  int v10002=v8115+0;
+  int v10003=v5569+6;
+  int v10004=v3096+7;
+  int v10005=v980+7;
+  int v10006=v2704+2;
+  int v10007=v8356+5;
+  int v10008=v15+4;
+  int v10009=v8687+9;
+  int v10010=v9881+9;
+  int v10011=v1641+4;
+  int v10012=v3990+7;
+  int v10013=v8191+4;
+  int v10014=v7275+9;
+  int v10015=v5357+2;
+  int v10016=v4821+8;
+  int v10017=v1089+0;
+  int v10018=v9592+3;
+  int v10019=v3106+4;
+  int v10020=v6328+2;
+  int v10021=v9581+8;
+  int v10022=v5962+3;
+  int v10023=v7234+0;
+  int v10024=v4847+2;
+  int v10025=v8924+9;
+  int v10026=v6773+4;
+  int v10027=v1705+7;
+  int v10028=v8793+4;
+  int v10029=v4892+1;
+  int v10030=v3056+4;
+  int v10031=v4268+2;
+  int v10032=v747+9;
+  int v10033=v1326+4;
+  int v10034=v3083+3;
+  int v10035=v8589+4;
+  int v10036=v1474+8;
+  int v10037=v3447+5;
+  int v10038=v2279+5;
+  int v10039=v4325+2;
+  int v10040=v7378+8;
+  int v10041=v9194+1;
+  int v10042=v8943+8;
+  int v10043=v6944+3;
+  int v10044=v3942+4;
+  int v10045=v3925+0;
+  int v10046=v6671+6;
+  int v10047=v3609+1;
+  int v10048=v209+4;
+  int v10049=v8616+6;
+  int v10050=v6545+2;
+  int v10051=v8995+9;
+  int v10052=v7310+2;
+  int v10053=v2597+5;
+  int v10054=v2398+7;
+  int v10055=v8193+2;
+  int v10056=v1094+5;
+  int v10057=v1927+0;
+  int v10058=v7809+6;
+  int v10059=v3769+2;
+  int v10060=v2517+7;
+  int v10061=v102+5;
+  int v10062=v4373+9;
+  int v10063=v2894+7;
+  int v10064=v2037+7;
+  int v10065=v2001+9;
+  int v10066=v6565+5;
+  int v10067=v2263+1;
+  int v10068=v6085+5;
+  int v10069=v5504+0;
+  int v10070=v6580+0;
+  int v10071=v2237+0;
+  int v10072=v6942+2;
+  int v10073=v9316+5;
+  int v10074=v6461+9;
+  int v10075=v5649+3;
+  int v10076=v7598+0;
+  int v10077=v3316+0;
+  int v10078=v5403+3;
+  int v10079=v7979+6;
+  int v10080=v8080+8;
+  int v10081=v7757+6;
+  int v10082=v8852+5;
+  int v10083=v4101+7;
+  int v10084=v9790+5;
+  int v10085=v1424+4;
+  int v10086=v3860+0;
+  int v10087=v6836+2;
+  int v10088=v9883+1;
+  int v10089=v5901+9;
+  int v10090=v2933+9;
+  int v10091=v9941+8;
+  int v10092=v4442+0;
+  int v10093=v1028+3;
+  int v10094=v46+5;
+  int v10095=v702+9;
+  int v10096=v479+2;
+  int v10097=v1696+5;
+  int v10098=v5358+8;
+  int v10099=v6801+0;
+  int v10100=v9875+5;
+  int v10101=v8515+0;
+  int v10102=v7436+7;
+  int v10103=v9917+6;
+  int v10104=v5791+5;
+  int v10105=v5327+6;
+  int v10106=v3+1;
+  int v10107=v980+2;
+  int v10108=v6145+8;
+  int v10109=v5685+9;
+  int v10110=v4759+2;
+  int v10111=v5680+5;
+  int v10112=v697+4;
+  int v10113=v7099+8;
+  int v10114=v7332+8;
+  int v10115=v5478+0;
+  int v10116=v4027+3;
+  int v10117=v1712+2;
+  int v10118=v4454+7;
+  int v10119=v4074+3;
+  int v10120=v4803+2;
+  int v10121=v9983+5;
+  int v10122=v2607+6;
+  int v10123=v2285+2;
+  int v10124=v4128+5;
+  int v10125=v6529+1;
+  int v10126=v4003+3;
+  int v10127=v3622+9;
+  int v10128=v6684+0;
+  int v10129=v1720+3;
+  int v10130=v2503+7;
+  int v10131=v988+6;
+  int v10132=v4744+3;
+  int v10133=v4296+4;
+  int v10134=v3924+8;
+  int v10135=v422+8;
+  int v10136=v3553+3;
+  int v10137=v1375+4;
+  int v10138=v6779+7;
+  int v10139=v4746+1;
+  int v10140=v9105+7;
+  int v10141=v5315+1;
+  int v10142=v6753+4;
+  int v10143=v2221+9;
+  int v10144=v5010+3;
+  int v10145=v7244+1;
+  int v10146=v3931+0;
+  int v10147=v9681+4;
+  int v10148=v9562+1;
+  int v10149=v10029+0;
+  int v10150=v7948+0;
+  int v10151=v7164+9;
+  int v10152=v2223+3;
+  int v10153=v3545+6;
+  int v10154=v1870+8;
+  int v10155=v7815+9;
+  int v10156=v2043+7;
+  int v10157=v198+5;
+  int v10158=v1838+0;
+  int v10159=v6816+2;
+  int v10160=v2988+0;
+  int v10161=v9144+6;
+  int v10162=v1605+6;
+  int v10163=v2545+0;
+  int v10164=v8508+7;
+  int v10165=v4535+0;
+  int v10166=v3529+7;
+  int v10167=v3608+3;
+  int v10168=v7677+2;
+  int v10169=v3203+1;
+  int v10170=v2156+1;
+  int v10171=v1010+3;
+  int v10172=v551+2;
+  int v10173=v5151+6;
+  int v10174=v5734+5;
+  int v10175=v229+9;
+  int v10176=v701+6;
+  int v10177=v233+5;
+  int v10178=v9457+1;
+  int v10179=v2868+8;
+  int v10180=v4912+0;
+  int v10181=v7986+1;
+  int v10182=v6556+8;
+  int v10183=v7976+6;
+  int v10184=v3680+7;
+  int v10185=v4956+8;
+  int v10186=v8942+8;
+  int v10187=v1138+6;
+  int v10188=v4198+4;
+  int v10189=v3184+9;
+  int v10190=v7172+3;
+  int v10191=v5376+6;
+  int v10192=v4495+3;
+  int v10193=v4476+7;
+  int v10194=v836+9;
+  int v10195=v8612+6;
+  int v10196=v3347+3;
+  int v10197=v3806+3;
+  int v10198=v5541+7;
+  int v10199=v5580+8;
+  int v10200=v6425+0;
+  int v10201=v9006+1;
+  int v10202=v4721+0;
+  int v10203=v6548+1;
+  int v10204=v592+3;
+  int v10205=v4222+6;
+  int v10206=v4236+4;
+  int v10207=v8294+9;
+  int v10208=v9310+3;
+  int v10209=v2609+3;
+  int v10210=v6480+1;
+  int v10211=v3373+6;
+  int v10212=v6970+7;
+  int v10213=v4587+5;
+  int v10214=v4397+3;
+  int v10215=v5176+8;
+  int v10216=v7315+4;
+  int v10217=v5660+8;
+  int v10218=v4271+1;
+  int v10219=v6604+5;
+  int v10220=v9994+2;
+  int v10221=v6948+1;
+  int v10222=v7910+8;
+  int v10223=v1022+9;
+  int v10224=v5905+7;
+  int v10225=v5480+5;
+  int v10226=v9032+6;
+  int v10227=v8916+9;
+  int v10228=v1288+2;
+  int v10229=v6945+5;
+  int v10230=v2616+6;
+  int v10231=v7048+1;
+  int v10232=v5396+9;
+  int v10233=v7868+7;
+  int v10234=v3702+9;
+  int v10235=v7033+9;
+  int v10236=v2542+1;
+  int v10237=v1240+4;
+  int v10238=v3596+2;
+  int v10239=v6746+0;
+  int v10240=v8243+0;
+  int v10241=v1300+9;
+  int v10242=v9188+4;
+  int v10243=v6378+1;
+  int v10244=v928+6;
+  int v10245=v692+7;
+  int v10246=v9137+9;
+  int v10247=v9611+6;
+  int v10248=v5325+5;
+  int v10249=v7108+7;
+  int v10250=v5734+0;
+  int v10251=v1664+6;
+  int v10252=v2112+5;
+  int v10253=v7269+5;
+  int v10254=v9882+7;
+  int v10255=v7103+2;
+  int v10256=v428+5;
+  int v10257=v3947+7;
+  int v10258=v4781+6;
+  int v10259=v5584+6;
+  int v10260=v10135+7;
+  int v10261=v1896+4;
+  int v10262=v7839+4;
+  int v10263=v6319+1;
+  int v10264=v6280+8;
+  int v10265=v4716+8;
+  int v10266=v1196+0;
+  int v10267=v8051+9;
+  int v10268=v7605+9;
+  int v10269=v1840+2;
+  int v10270=v7056+8;
+  int v10271=v9340+5;
+  int v10272=v8570+0;
+  int v10273=v287+5;
+  int v10274=v7522+1;
+  int v10275=v3387+4;
+  int v10276=v619+0;
+  int v10277=v7394+1;
+  int v10278=v7139+5;
+  int v10279=v4767+0;
+  int v10280=v5193+6;
+  int v10281=v4515+0;
+  int v10282=v7407+1;
+  int v10283=v5088+8;
+  int v10284=v4291+0;
+  int v10285=v2826+2;
+  int v10286=v3430+5;
+  int v10287=v3200+6;
+  int v10288=v2186+6;
+  int v10289=v7712+6;
+  int v10290=v5286+0;
+  int v10291=v7924+0;
+  int v10292=v8139+9;
+  int v10293=v7619+2;
+  int v10294=v33+3;
+  int v10295=v1346+7;
+  int v10296=v303+8;
+  int v10297=v4767+7;
+  int v10298=v8175+5;
+  int v10299=v6698+6;
+  int v10300=v7599+8;
+  int v10301=v5759+8;
+  int v10302=v3993+0;
+  int v10303=v2731+7;
+  int v10304=v9489+9;
+  int v10305=v8331+3;
+  int v10306=v8266+9;
+  int v10307=v1714+0;
+  int v10308=v2632+1;
+  int v10309=v1700+8;
+  int v10310=v8793+8;
+  int v10311=v7285+8;
+  int v10312=v9942+4;
+  int v10313=v6294+5;
+  int v10314=v2650+8;
+  int v10315=v1117+9;
+  int v10316=v7393+3;
+  int v10317=v1532+1;
+  int v10318=v4842+2;
+  int v10319=v3806+9;
+  int v10320=v2402+2;
+  int v10321=v5894+9;
+  int v10322=v6735+8;
+  int v10323=v1076+0;
+  int v10324=v6662+7;
+  int v10325=v5176+7;
+  int v10326=v8054+4;
+  int v10327=v4788+4;
+  int v10328=v7512+7;
+  int v10329=v4579+4;
+  int v10330=v1764+2;
+  int v10331=v10011+3;
+  int v10332=v5335+7;
+  int v10333=v10058+8;
+  int v10334=v9651+5;
+  int v10335=v7283+1;
+  int v10336=v8079+0;
+  int v10337=v3794+6;
+  int v10338=v6572+9;
+  int v10339=v5737+2;
+  int v10340=v9241+5;
+  int v10341=v10277+0;
+  int v10342=v841+4;
+  int v10343=v605+4;
+  int v10344=v156+9;
+  int v10345=v1724+2;
+  int v10346=v8594+2;
+  int v10347=v8691+8;
+  int v10348=v6529+3;
+  int v10349=v5997+6;
+  int v10350=v7020+8;
+  int v10351=v9646+4;
+  int v10352=v8281+7;
+  int v10353=v5588+5;
+  int v10354=v2979+0;
+  int v10355=v2221+9;
+  int v10356=v2010+3;
+  int v10357=v16+2;
+  int v10358=v10074+4;
+  int v10359=v6945+4;
+  int v10360=v7402+8;
+  int v10361=v1141+0;
+  int v10362=v10131+9;
+  int v10363=v2817+6;
+  int v10364=v1229+1;
+  int v10365=v947+7;
+  int v10366=v367+0;
+  int v10367=v3315+3;
+  int v10368=v1839+2;
+  int v10369=v10345+6;
+  int v10370=v9308+7;
+  int v10371=v9293+1;
+  int v10372=v9202+0;
+  int v10373=v9249+7;
+  int v10374=v7557+3;
+  int v10375=v1613+3;
+  int v10376=v9304+8;
+  int v10377=v7362+6;
+  int v10378=v5575+6;
+  int v10379=v734+4;
+  int v10380=v4350+6;
+  int v10381=v1218+7;
+  int v10382=v6116+8;
+  int v10383=v1323+6;
+  int v10384=v5667+8;
+  int v10385=v1970+2;
+  int v10386=v9258+9;
+  int v10387=v5601+3;
+  int v10388=v7370+5;
+  int v10389=v2976+9;
+  int v10390=v1469+3;
+  int v10391=v7410+9;
+  int v10392=v7032+4;
+  int v10393=v2322+8;
+  int v10394=v2821+1;
+  int v10395=v2525+6;
+  int v10396=v4240+3;
+  int v10397=v9672+2;
+  int v10398=v6817+0;
+  int v10399=v5382+0;
+  int v10400=v6726+2;
+  int v10401=v9165+7;
+  int v10402=v3571+6;
+  int v10403=v1081+9;
+  int v10404=v4562+9;
+  int v10405=v5071+1;
+  int v10406=v9721+5;
+  int v10407=v7622+8;
+  int v10408=v1620+3;
+  int v10409=v10220+7;
+  int v10410=v3069+5;
+  int v10411=v7874+5;
+  int v10412=v3807+0;
+  int v10413=v3519+5;
+  int v10414=v608+3;
+  int v10415=v2247+7;
+  int v10416=v8416+6;
+  int v10417=v9444+3;
+  int v10418=v3577+4;
+  int v10419=v1786+9;
+  int v10420=v205+2;
+  int v10421=v2725+9;
+  int v10422=v1933+0;
+  int v10423=v6410+9;
+  int v10424=v5844+3;
+  int v10425=v3827+1;
+  int v10426=v7174+2;
+  int v10427=v8047+6;
+  int v10428=v6493+7;
+  int v10429=v6756+5;
+  int v10430=v9901+7;
+  int v10431=v2907+4;
+  int v10432=v7241+2;
+  int v10433=v9287+4;
+  int v10434=v4361+1;
+  int v10435=v8907+2;
+  int v10436=v2329+3;
+  int v10437=v262+7;
+  int v10438=v728+9;
+  int v10439=v7271+7;
+  int v10440=v3546+8;
+  int v10441=v2033+5;
+  int v10442=v1232+6;
+  int v10443=v5295+8;
+  int v10444=v9170+2;
+  int v10445=v7030+7;
+  int v10446=v824+9;
+  int v10447=v8898+7;
+  int v10448=v1681+4;
+  int v10449=v721+3;
+  int v10450=v547+1;
+  int v10451=v2814+1;
+  int v10452=v8175+1;
+  int v10453=v4413+8;
+  int v10454=v4760+1;
+  int v10455=v3303+9;
+  int v10456=v1743+4;
+  int v10457=v8103+4;
+  int v10458=v7057+7;
+  int v10459=v10027+0;
+  int v10460=v7952+8;
+  int v10461=v3238+5;
+  int v10462=v6576+1;
+  int v10463=v4434+9;
+  int v10464=v9259+9;
+  int v10465=v8827+2;
+  int v10466=v5917+1;
+  int v10467=v2715+8;
+  int v10468=v8546+4;
+  int v10469=v3204+5;
+  int v10470=v2398+8;
+  int v10471=v10004+8;
+  int v10472=v8824+6;
+  int v10473=v2853+6;
+  int v10474=v1682+4;
+  int v10475=v3900+1;
+  int v10476=v3360+4;
+  int v10477=v8766+9;
+  int v10478=v7421+8;
+  int v10479=v2296+9;
+  int v10480=v4467+0;
+  int v10481=v2465+6;
+  int v10482=v9623+4;
+  int v10483=v8644+2;
+  int v10484=v1214+5;
+  int v10485=v9664+2;
+  int v10486=v2556+4;
+  int v10487=v5218+6;
+  int v10488=v7462+6;
+  int v10489=v22+3;
+  int v10490=v2078+9;
+  int v10491=v7650+3;
+  int v10492=v3621+6;
+  int v10493=v498+2;
+  int v10494=v3106+8;
+  int v10495=v4739+6;
+  int v10496=v7676+4;
+  int v10497=v1752+7;
+  int v10498=v2333+9;
+  int v10499=v3826+9;
+  int v10500=v3518+7;
+  int v10501=v2460+6;
+  int v10502=v2445+5;
+  int v10503=v3905+4;
+  int v10504=v2941+1;
+  int v10505=v10493+5;
+  int v10506=v2761+1;
+  int v10507=v5361+1;
+  int v10508=v9515+6;
+  int v10509=v8970+3;
+  int v10510=v8007+1;
+  int v10511=v5435+6;
+  int v10512=v3011+0;
+  int v10513=v8579+0;
+  int v10514=v387+8;
+  int v10515=v2777+6;
+  int v10516=v10491+9;
+  int v10517=v10320+7;
+  int v10518=v1872+1;
+  int v10519=v2848+9;
+  int v10520=v3550+7;
+  int v10521=v4602+6;
+  int v10522=v2249+3;
+  int v10523=v8832+1;
+  int v10524=v8648+9;
+  int v10525=v2191+8;
+  int v10526=v7308+9;
+  int v10527=v8547+3;
+  int v10528=v4459+4;
+  int v10529=v976+3;
+  int v10530=v752+8;
+  int v10531=v2163+3;
+  int v10532=v10387+8;
+  int v10533=v9172+2;
+  int v10534=v7845+2;
+  int v10535=v7898+8;
+  int v10536=v4763+7;
+  int v10537=v5927+9;
+  int v10538=v6262+3;
+  int v10539=v2909+0;
+  int v10540=v1148+1;
+  int v10541=v6823+8;
+  int v10542=v9018+7;
+  int v10543=v347+8;
+  int v10544=v3865+0;
+  int v10545=v9969+3;
+  int v10546=v367+3;
+  int v10547=v1152+1;
+  int v10548=v2078+7;
+  int v10549=v3841+1;
+  int v10550=v10287+1;
+  int v10551=v6827+4;
+  int v10552=v7186+0;
+  int v10553=v9173+0;
+  int v10554=v340+4;
+  int v10555=v88+6;
+  int v10556=v2914+9;
+  int v10557=v9063+9;
+  int v10558=v9574+5;
+  int v10559=v8211+1;
+  int v10560=v8518+2;
+  int v10561=v4727+7;
+  int v10562=v4712+6;
+  int v10563=v10269+9;
+  int v10564=v7267+8;
+  int v10565=v4369+4;
+  int v10566=v9034+1;
+  int v10567=v7683+5;
+  int v10568=v4316+7;
+  int v10569=v4568+2;
+  int v10570=v1611+3;
+  int v10571=v6261+6;
+  int v10572=v9901+4;
+  int v10573=v2474+5;
+  int v10574=v1595+4;
+  int v10575=v8577+0;
+  int v10576=v4911+2;
+  int v10577=v2956+7;
+  int v10578=v4347+7;
+  int v10579=v9326+9;
+  int v10580=v3376+2;
+  int v10581=v6993+1;
+  int v10582=v600+0;
+  int v10583=v3513+1;
+  int v10584=v5426+5;
+  int v10585=v9676+4;
+  int v10586=v7722+5;
+  int v10587=v5746+3;
+  int v10588=v8644+4;
+  int v10589=v2995+2;
+  int v10590=v4466+1;
+  int v10591=v8658+3;
+  int v10592=v8151+0;
+  int v10593=v1781+4;
+  int v10594=v3008+8;
+  int v10595=v7916+1;
+  int v10596=v9605+9;
+  int v10597=v9551+9;
+  int v10598=v7072+2;
+  int v10599=v7358+7;
+  int v10600=v9576+0;
+  int v10601=v8041+8;
+  int v10602=v9326+0;
+  int v10603=v2268+7;
+  int v10604=v2234+5;
+  int v10605=v2832+3;
+  int v10606=v1990+7;
+  int v10607=v757+0;
+  int v10608=v9913+1;
+  int v10609=v3705+5;
+  int v10610=v8636+6;
+  int v10611=v1586+9;
+  int v10612=v39+1;
+  int v10613=v78+2;
+  int v10614=v7292+5;
+  int v10615=v7373+8;
+  int v10616=v10284+2;
+  int v10617=v7855+9;
+  int v10618=v7046+0;
+  int v10619=v10482+6;
+  int v10620=v4286+3;
+  int v10621=v10503+4;
+  int v10622=v2116+5;
+  int v10623=v1595+5;
+  int v10624=v6665+8;
+  int v10625=v7051+7;
+  int v10626=v9392+9;
+  int v10627=v7525+7;
+  int v10628=v3878+9;
+  int v10629=v7156+0;
+  int v10630=v5831+9;
+  int v10631=v7669+0;
+  int v10632=v8036+4;
+  int v10633=v5283+4;
+  int v10634=v5054+7;
+  int v10635=v74+6;
+  int v10636=v5507+1;
+  int v10637=v8912+1;
+  int v10638=v2616+7;
+  int v10639=v1659+3;
+  int v10640=v494+2;
+  int v10641=v6714+4;
+  int v10642=v3608+1;
+  int v10643=v4176+0;
+  int v10644=v2525+6;
+  int v10645=v7405+2;
+  int v10646=v3743+7;
+  int v10647=v10011+4;
+  int v10648=v7791+9;
+  int v10649=v5111+5;
+  int v10650=v9001+3;
+  int v10651=v5408+6;
+  int v10652=v2613+1;
+  int v10653=v10306+4;
+  int v10654=v5742+8;
+  int v10655=v8663+1;
+  int v10656=v4257+9;
+  int v10657=v2172+3;
+  int v10658=v5105+8;
+  int v10659=v7922+4;
+  int v10660=v1322+3;
+  int v10661=v1438+5;
+  int v10662=v1477+9;
+  int v10663=v7108+7;
+  int v10664=v3350+0;
+  int v10665=v5602+8;
+  int v10666=v910+6;
+  int v10667=v7680+8;
+  int v10668=v8321+5;
+  int v10669=v1087+1;
+  int v10670=v6710+9;
+  int v10671=v6946+6;
+  int v10672=v2031+0;
+  int v10673=v7772+3;
+  int v10674=v10665+1;
+  int v10675=v1422+3;
+  int v10676=v662+1;
+  int v10677=v2056+5;
+  int v10678=v4726+0;
+  int v10679=v5726+9;
+  int v10680=v461+1;
+  int v10681=v5087+3;
+  int v10682=v9799+0;
+  int v10683=v7887+5;
+  int v10684=v5700+1;
+  int v10685=v2361+3;
+  int v10686=v5690+5;
+  int v10687=v7856+7;
+  int v10688=v9414+7;
+  int v10689=v9606+3;
+  int v10690=v2907+0;
+  int v10691=v8080+0;
+  int v10692=v8190+2;
+  int v10693=v1873+6;
+  int v10694=v9266+0;
+  int v10695=v8568+4;
+  int v10696=v2533+3;
+  int v10697=v6863+9;
+  int v10698=v1223+9;
+  int v10699=v2619+6;
+  int v10700=v8706+0;
+  int v10701=v1213+3;
+  int v10702=v8722+4;
+  int v10703=v9370+2;
+  int v10704=v6237+8;
+  int v10705=v6533+8;
+  int v10706=v620+4;
+  int v10707=v9006+9;
+  int v10708=v1340+9;
+  int v10709=v4686+5;
+  int v10710=v7560+9;
+  int v10711=v4579+4;
+  int v10712=v2886+7;
+  int v10713=v5007+2;
+  int v10714=v7541+9;
+  int v10715=v3440+7;
+  int v10716=v6069+8;
+  int v10717=v4450+1;
+  int v10718=v6502+1;
+  int v10719=v8473+2;
+  int v10720=v3548+5;
+  int v10721=v3275+2;
+  int v10722=v1626+3;
+  int v10723=v10330+4;
+  int v10724=v2810+1;
+  int v10725=v5000+4;
+  int v10726=v6735+1;
+  int v10727=v1257+0;
+  int v10728=v3620+2;
+  int v10729=v7712+4;
+  int v10730=v10253+0;
+  int v10731=v2534+2;
+  int v10732=v6488+9;
+  int v10733=v4589+4;
+  int v10734=v6502+2;
+  int v10735=v4621+3;
+  int v10736=v3414+3;
+  int v10737=v3255+0;
+  int v10738=v1720+2;
+  int v10739=v7227+7;
+  int v10740=v4045+8;
+  int v10741=v4751+0;
+  int v10742=v9586+7;
+  int v10743=v7463+3;
+  int v10744=v9619+8;
+  int v10745=v8900+1;
+  int v10746=v7886+6;
+  int v10747=v6216+5;
+  int v10748=v1487+6;
+  int v10749=v9155+5;
+  int v10750=v6812+7;
+  int v10751=v6470+8;
+  int v10752=v1764+1;
+  int v10753=v9357+4;
+  int v10754=v8875+8;
+  int v10755=v10258+2;
+  int v10756=v10603+4;
+  int v10757=v8124+4;
+  int v10758=v10261+6;
+  int v10759=v7131+2;
+  int v10760=v2767+9;
+  int v10761=v6276+1;
+  int v10762=v9659+5;
+  int v10763=v9850+1;
+  int v10764=v6055+1;
+  int v10765=v1859+7;
+  int v10766=v8848+2;
+  int v10767=v10434+5;
+  int v10768=v3112+4;
+  int v10769=v1423+7;
+  int v10770=v899+8;
+  int v10771=v5926+2;
+  int v10772=v9644+0;
+  int v10773=v7402+7;
+  int v10774=v6112+2;
+  int v10775=v79+9;
+  int v10776=v5152+2;
+  int v10777=v38+3;
+  int v10778=v8422+3;
+  int v10779=v7128+2;
+  int v10780=v10571+5;
+  int v10781=v5752+2;
+  int v10782=v311+1;
+  int v10783=v8064+9;
+  int v10784=v1982+9;
+  int v10785=v9323+9;
+  int v10786=v7247+9;
+  int v10787=v5497+9;
+  int v10788=v9347+7;
+  int v10789=v8628+4;
+  int v10790=v8609+1;
+  int v10791=v2780+4;
+  int v10792=v9941+2;
+  int v10793=v10257+7;
+  int v10794=v2866+9;
+  int v10795=v5856+3;
+  int v10796=v8151+8;
+  int v10797=v7330+3;
+  int v10798=v7299+3;
+  int v10799=v472+6;
+  int v10800=v4973+7;
+  int v10801=v4264+0;
+  int v10802=v7721+4;
+  int v10803=v65+9;
+  int v10804=v9097+5;
+  int v10805=v8465+5;
+  int v10806=v4856+7;
+  int v10807=v6232+9;
+  int v10808=v1689+6;
+  int v10809=v8587+2;
+  int v10810=v7221+4;
+  int v10811=v8430+9;
+  int v10812=v9920+0;
+  int v10813=v6965+5;
+  int v10814=v4196+2;
+  int v10815=v10170+3;
+  int v10816=v10600+2;
+  int v10817=v5930+3;
+  int v10818=v10209+2;
+  int v10819=v4853+9;
+  int v10820=v2349+2;
+  int v10821=v5372+5;
+  int v10822=v789+6;
+  int v10823=v9381+5;
+  int v10824=v5406+8;
+  int v10825=v5054+3;
+  int v10826=v677+1;
+  int v10827=v1533+1;
+  int v10828=v6236+2;
+  int v10829=v2438+2;
+  int v10830=v7037+9;
+  int v10831=v7838+4;
+  int v10832=v2511+8;
+  int v10833=v5046+9;
+  int v10834=v8414+3;
+  int v10835=v6873+1;
+  int v10836=v4807+2;
+  int v10837=v7454+9;
+  int v10838=v7738+4;
+  int v10839=v9714+9;
+  int v10840=v8545+4;
+  int v10841=v752+2;
+  int v10842=v475+0;
+  int v10843=v8134+7;
+  int v10844=v7261+2;
+  int v10845=v649+8;
+  int v10846=v6893+5;
+  int v10847=v6985+5;
+  int v10848=v7039+4;
+  int v10849=v9152+9;
+  int v10850=v4542+3;
+  int v10851=v1648+0;
+  int v10852=v10636+4;
+  int v10853=v9848+6;
+  int v10854=v4487+3;
+  int v10855=v7420+9;
+  int v10856=v5581+6;
+  int v10857=v10064+5;
+  int v10858=v699+1;
+  int v10859=v9139+5;
+  int v10860=v633+0;
+  int v10861=v2393+9;
+  int v10862=v6901+0;
+  int v10863=v1121+5;
+  int v10864=v2581+0;
+  int v10865=v6134+9;
+  int v10866=v10746+8;
+  int v10867=v5016+4;
+  int v10868=v8788+8;
+  int v10869=v7773+2;
+  int v10870=v2549+5;
+  int v10871=v3069+0;
+  int v10872=v8821+3;
+  int v10873=v2866+8;
+  int v10874=v5091+0;
+  int v10875=v1958+9;
+  int v10876=v10378+3;
+  int v10877=v1120+4;
+  int v10878=v2839+8;
+  int v10879=v274+8;
+  int v10880=v9788+2;
+  int v10881=v9149+6;
+  int v10882=v5552+3;
+  int v10883=v9304+5;
+  int v10884=v8809+1;
+  int v10885=v8650+0;
+  int v10886=v9087+0;
+  int v10887=v3956+8;
+  int v10888=v8143+0;
+  int v10889=v3299+0;
+  int v10890=v10544+9;
+  int v10891=v8311+0;
+  int v10892=v2328+3;
+  int v10893=v4523+4;
+  int v10894=v7750+7;
+  int v10895=v10654+4;
+  int v10896=v6675+4;
+  int v10897=v10693+6;
+  int v10898=v3698+6;
+  int v10899=v1857+0;
+  int v10900=v10603+0;
+  int v10901=v7618+5;
+  int v10902=v4077+5;
+  int v10903=v8815+9;
+  int v10904=v2629+5;
+  int v10905=v9632+7;
+  int v10906=v1380+3;
+  int v10907=v2081+0;
+  int v10908=v5500+7;
+  int v10909=v10341+7;
+  int v10910=v5849+2;
+  int v10911=v6761+2;
+  int v10912=v4248+5;
+  int v10913=v9447+9;
+  int v10914=v1336+9;
+  int v10915=v57+6;
+  int v10916=v2772+4;
+  int v10917=v1124+9;
+  int v10918=v2432+6;
+  int v10919=v9105+6;
+  int v10920=v9753+8;
+  int v10921=v9113+0;
+  int v10922=v6349+9;
+  int v10923=v7242+5;
+  int v10924=v9932+8;
+  int v10925=v10241+6;
+  int v10926=v9435+0;
+  int v10927=v2239+1;
+  int v10928=v9903+2;
+  int v10929=v4690+7;
+  int v10930=v4319+5;
+  int v10931=v2951+5;
+  int v10932=v8150+7;
+  int v10933=v773+3;
+  int v10934=v7332+7;
+  int v10935=v4624+5;
+  int v10936=v7253+7;
+  int v10937=v5779+7;
+  int v10938=v7257+8;
+  int v10939=v2725+1;
+  int v10940=v917+0;
+  int v10941=v2436+1;
+  int v10942=v7308+9;
+  int v10943=v8352+9;
+  int v10944=v8042+1;
+  int v10945=v3387+3;
+  int v10946=v4672+8;
+  int v10947=v10542+4;
+  int v10948=v1233+6;
+  int v10949=v7400+8;
+  int v10950=v1164+8;
+  int v10951=v10458+3;
+  int v10952=v5624+9;
+  int v10953=v4716+9;
+  int v10954=v5399+2;
+  int v10955=v883+0;
+  int v10956=v4929+6;
+  int v10957=v2147+5;
+  int v10958=v6856+2;
+  int v10959=v10755+3;
+  int v10960=v10664+2;
+  int v10961=v5686+8;
+  int v10962=v7560+0;
+  int v10963=v1053+3;
+  int v10964=v10844+1;
+  int v10965=v5615+5;
+  int v10966=v5654+6;
+  int v10967=v8202+1;
+  int v10968=v4382+8;
+  int v10969=v6326+4;
+  int v10970=v10066+3;
+  int v10971=v4608+1;
+  int v10972=v5242+4;
+  int v10973=v9182+0;
+  int v10974=v8934+2;
+  int v10975=v7837+8;
+  int v10976=v8903+3;
+  int v10977=v2579+0;
+  int v10978=v10497+4;
+  int v10979=v1091+2;
+  int v10980=v10768+3;
+  int v10981=v220+0;
+  int v10982=v7676+2;
+  int v10983=v8864+4;
+  int v10984=v8611+8;
+  int v10985=v8989+9;
+  int v10986=v510+0;
+  int v10987=v283+7;
+  int v10988=v6817+2;
+  int v10989=v4621+8;
+  int v10990=v5394+3;
+  int v10991=v7876+1;
+  int v10992=v6576+4;
+  int v10993=v2688+0;
+  int v10994=v9521+9;
+  int v10995=v7419+6;
+  int v10996=v10783+6;
+  int v10997=v8651+8;
+  int v10998=v1605+1;
+  int v10999=v2598+8;
+  int v11000=v9113+1;
+  int v11001=v4934+8;
+  int v11002=v9373+9;
+  int v11003=v3231+9;
+  int v11004=v7156+5;
+  int v11005=v602+1;
+  int v11006=v10283+7;
+  int v11007=v5395+6;
+  int v11008=v6368+4;
+  int v11009=v2265+3;
+  int v11010=v6871+2;
+  int v11011=v5368+9;
+  int v11012=v3531+1;
+  int v11013=v5308+9;
+  int v11014=v6032+7;
+  int v11015=v10185+0;
+  int v11016=v3+9;
+  int v11017=v9833+8;
+  int v11018=v1616+4;
+  int v11019=v3729+2;
+  int v11020=v5420+6;
+  int v11021=v4569+5;
+  int v11022=v7453+2;
+  int v11023=v8644+2;
+  int v11024=v1619+7;
+  int v11025=v3173+9;
+  int v11026=v10259+2;
+  int v11027=v9109+0;
+  int v11028=v3143+4;
+  int v11029=v4436+7;
+  int v11030=v5026+2;
+  int v11031=v9368+8;
+  int v11032=v7492+7;
+  int v11033=v3334+0;
+  int v11034=v6103+8;
+  int v11035=v1102+3;
+  int v11036=v8663+8;
+  int v11037=v3894+0;
+  int v11038=v2175+8;
+  int v11039=v9364+6;
+  int v11040=v1416+3;
+  int v11041=v10463+1;
+  int v11042=v8770+6;
+  int v11043=v4302+7;
+  int v11044=v6755+9;
+  int v11045=v8587+1;
+  int v11046=v2821+5;
+  int v11047=v4779+7;
+  int v11048=v3236+3;
+  int v11049=v1553+6;
+  int v11050=v5942+0;
+  int v11051=v8731+5;
+  int v11052=v6789+7;
+  int v11053=v399+3;
+  int v11054=v1367+3;
+  int v11055=v2964+8;
+  int v11056=v7742+0;
+  int v11057=v8498+7;
+  int v11058=v9560+0;
+  int v11059=v1640+0;
+  int v11060=v7846+6;
+  int v11061=v446+2;
+  int v11062=v5397+0;
+  int v11063=v3962+6;
+  int v11064=v2332+5;
+  int v11065=v7170+7;
+  int v11066=v7937+9;
+  int v11067=v4258+0;
+  int v11068=v3071+8;
+  int v11069=v3048+1;
+  int v11070=v7000+4;
+  int v11071=v8439+8;
+  int v11072=v9132+4;
+  int v11073=v9588+1;
+  int v11074=v7963+8;
+  int v11075=v4828+3;
+  int v11076=v873+5;
+  int v11077=v3733+5;
+  int v11078=v6220+2;
+  int v11079=v6439+8;
+  int v11080=v59+1;
+  int v11081=v6294+1;
+  int v11082=v1838+3;
+  int v11083=v1775+0;
+  int v11084=v3413+2;
+  int v11085=v6093+9;
+  int v11086=v9034+3;
+  int v11087=v10718+5;
+  int v11088=v7659+3;
+  int v11089=v8066+3;
+  int v11090=v4101+0;
+  int v11091=v5170+4;
+  int v11092=v5876+4;
+  int v11093=v516+7;
+  int v11094=v10277+0;
+  int v11095=v11023+6;
+  int v11096=v9739+6;
+  int v11097=v219+4;
+  int v11098=v5854+9;
+  int v11099=v5876+0;
+  int v11100=v4086+7;
+  int v11101=v5192+7;
+  int v11102=v9835+9;
+  int v11103=v1253+7;
+  int v11104=v11067+1;
+  int v11105=v6166+4;
+  int v11106=v6013+9;
+  int v11107=v6646+9;
+  int v11108=v9856+3;
+  int v11109=v6127+0;
+  int v11110=v10995+3;
+  int v11111=v5965+6;
+  int v11112=v10096+6;
+  int v11113=v4651+7;
+  int v11114=v5987+3;
+  int v11115=v7797+9;
+  int v11116=v2982+6;
+  int v11117=v4745+9;
+  int v11118=v4591+6;
+  int v11119=v7133+9;
+  int v11120=v114+4;
+  int v11121=v6939+8;
+  int v11122=v6806+0;
+  int v11123=v6466+9;
+  int v11124=v8135+0;
+  int v11125=v2388+6;
+  int v11126=v6835+7;
+  int v11127=v10824+6;
+  int v11128=v7091+6;
+  int v11129=v5256+3;
+  int v11130=v8442+9;
+  int v11131=v3446+7;
+  int v11132=v3023+9;
+  int v11133=v190+3;
+  int v11134=v6953+0;
+  int v11135=v8308+5;
+  int v11136=v10687+6;
+  int v11137=v4285+7;
+  int v11138=v9732+7;
+  int v11139=v6609+5;
+  int v11140=v636+8;
+  int v11141=v9260+9;
+  int v11142=v4204+2;
+  int v11143=v1788+3;
+  int v11144=v7749+1;
+  int v11145=v6626+0;
+  int v11146=v6779+8;
+  int v11147=v204+4;
+  int v11148=v7713+3;
+  int v11149=v8379+6;
+  int v11150=v2187+6;
+  int v11151=v8686+2;
+  int v11152=v10873+6;
+  int v11153=v1334+8;
+  int v11154=v4291+0;
+  int v11155=v7137+8;
+  int v11156=v9772+2;
+  int v11157=v6154+4;
+  int v11158=v9605+5;
+  int v11159=v1341+5;
+  int v11160=v1097+0;
+  int v11161=v9824+1;
+  int v11162=v10539+3;
+  int v11163=v3461+4;
+  int v11164=v7925+7;
+  int v11165=v11098+0;
+  int v11166=v4317+0;
+  int v11167=v8267+2;
+  int v11168=v10915+7;
+  int v11169=v2375+5;
+  int v11170=v77+2;
+  int v11171=v2185+9;
+  int v11172=v2143+3;
+  int v11173=v7642+8;
+  int v11174=v6748+6;
+  int v11175=v398+6;
+  int v11176=v4870+0;
+  int v11177=v8528+4;
+  int v11178=v4687+7;
+  int v11179=v3019+4;
+  int v11180=v1533+7;
+  int v11181=v9149+1;
+  int v11182=v9476+4;
+  int v11183=v9173+7;
+  int v11184=v9366+7;
+  int v11185=v6262+8;
+  int v11186=v11061+2;
+  int v11187=v987+2;
+  int v11188=v10812+9;
+  int v11189=v10478+4;
+  int v11190=v4365+2;
+  int v11191=v3807+2;
+  int v11192=v9371+4;
+  int v11193=v6549+7;
+  int v11194=v10832+3;
+  int v11195=v1632+0;
+  int v11196=v4894+6;
+  int v11197=v3999+3;
+  int v11198=v5954+8;
+  int v11199=v529+2;
+  int v11200=v10924+7;
+  int v11201=v9982+5;
+  int v11202=v9305+5;
+  int v11203=v5052+3;
+  int v11204=v3249+8;
+  int v11205=v1587+5;
+  int v11206=v6655+1;
+  int v11207=v4751+9;
+  int v11208=v11136+6;
+  int v11209=v2457+1;
+  int v11210=v131+4;
+  int v11211=v2055+1;
+  int v11212=v8964+7;
+  int v11213=v2904+5;
+  int v11214=v7985+8;
+  int v11215=v10498+0;
+  int v11216=v985+7;
+  int v11217=v244+4;
+  int v11218=v6178+8;
+  int v11219=v4575+6;
+  int v11220=v9694+7;
+  int v11221=v6323+3;
+  int v11222=v4635+6;
+  int v11223=v425+6;
+  int v11224=v7821+2;
+  int v11225=v7739+0;
+  int v11226=v5315+1;
+  int v11227=v1030+9;
+  int v11228=v9170+8;
+  int v11229=v3228+4;
+  int v11230=v26+9;
+  int v11231=v5575+2;
+  int v11232=v1186+4;
+  int v11233=v3864+1;
+  int v11234=v9794+1;
+  int v11235=v6954+5;
+  int v11236=v5113+4;
+  int v11237=v2485+9;
+  int v11238=v4830+2;
+  int v11239=v9887+7;
+  int v11240=v9517+0;
+  int v11241=v6218+6;
+  int v11242=v1716+5;
+  int v11243=v9871+7;
+  int v11244=v10811+0;
+  int v11245=v2057+5;
+  int v11246=v1681+2;
+  int v11247=v5074+3;
+  int v11248=v5366+9;
+  int v11249=v4295+8;
+  int v11250=v1310+5;
+  int v11251=v8164+1;
+  int v11252=v8215+8;
+  int v11253=v8653+4;
+  int v11254=v9075+5;
+  int v11255=v972+5;
+  int v11256=v4887+6;
+  int v11257=v1749+1;
+  int v11258=v2970+1;
+  int v11259=v3301+7;
+  int v11260=v10785+4;
+  int v11261=v7919+9;
+  int v11262=v3351+2;
+  int v11263=v10837+1;
+  int v11264=v1000+9;
+  int v11265=v6972+5;
+  int v11266=v11123+5;
+  int v11267=v3493+0;
+  int v11268=v3186+1;
+  int v11269=v9170+8;
+  int v11270=v7706+4;
+  int v11271=v2756+6;
+  int v11272=v5261+0;
+  int v11273=v2124+2;
+  int v11274=v8636+0;
+  int v11275=v23+6;
+  int v11276=v10430+6;
+  int v11277=v5148+2;
+  int v11278=v9752+4;
+  int v11279=v4977+3;
+  int v11280=v9913+6;
+  int v11281=v4290+3;
+  int v11282=v4243+7;
+  int v11283=v2496+3;
+  int v11284=v1204+8;
+  int v11285=v7194+6;
+  int v11286=v4310+0;
+  int v11287=v9516+9;
+  int v11288=v5441+3;
+  int v11289=v1390+2;
+  int v11290=v8450+9;
+  int v11291=v743+6;
+  int v11292=v9221+7;
+  int v11293=v3010+8;
+  int v11294=v8473+5;
+  int v11295=v3106+2;
+  int v11296=v8096+7;
+  int v11297=v9507+2;
+  int v11298=v7796+3;
+  int v11299=v3484+8;
+  int v11300=v9844+1;
+  int v11301=v3444+8;
+  int v11302=v11032+0;
+  int v11303=v6661+5;
+  int v11304=v9983+4;
+  int v11305=v9397+5;
+  int v11306=v1496+1;
+  int v11307=v9020+0;
+  int v11308=v46+7;
+  int v11309=v4546+5;
+  int v11310=v10444+2;
+  int v11311=v6253+5;
+  int v11312=v4353+2;
+  int v11313=v8604+8;
+  int v11314=v1325+3;
+  int v11315=v5724+9;
+  int v11316=v10908+9;
+  int v11317=v4766+1;
+  int v11318=v5206+1;
+  int v11319=v4927+5;
+  int v11320=v3104+6;
+  int v11321=v2678+1;
+  int v11322=v9145+2;
+  int v11323=v5726+6;
+  int v11324=v9679+4;
+  int v11325=v8770+6;
+  int v11326=v10559+2;
+  int v11327=v8474+1;
+  int v11328=v5001+5;
+  int v11329=v10175+2;
+  int v11330=v5738+9;
+  int v11331=v6215+6;
+  int v11332=v2236+4;
+  int v11333=v4291+0;
+  int v11334=v9048+9;
+  int v11335=v9496+9;
+  int v11336=v720+2;
+  int v11337=v9996+9;
+  int v11338=v7221+3;
+  int v11339=v8256+8;
+  int v11340=v974+8;
+  int v11341=v10840+8;
+  int v11342=v862+2;
+  int v11343=v691+7;
+  int v11344=v9303+8;
+  int v11345=v10245+6;
+  int v11346=v6395+0;
+  int v11347=v3679+6;
+  int v11348=v4289+0;
+  int v11349=v9568+2;
+  int v11350=v1952+3;
+  int v11351=v4783+1;
+  int v11352=v1840+2;
+  int v11353=v2721+2;
+  int v11354=v7048+1;
+  int v11355=v9798+4;
+  int v11356=v8645+3;
+  int v11357=v8775+8;
+  int v11358=v10878+4;
+  int v11359=v8852+0;
+  int v11360=v6467+9;
+  int v11361=v2375+8;
+  int v11362=v5799+8;
+  int v11363=v225+1;
+  int v11364=v7611+0;
+  int v11365=v10492+3;
+  int v11366=v3526+4;
+  int v11367=v4511+8;
+  int v11368=v9385+2;
+  int v11369=v2840+9;
+  int v11370=v847+3;
+  int v11371=v8347+6;
+  int v11372=v833+9;
+  int v11373=v9584+6;
+  int v11374=v9571+1;
+  int v11375=v3169+1;
+  int v11376=v3238+3;
+  int v11377=v3192+9;
+  int v11378=v525+0;
+  int v11379=v4590+0;
+  int v11380=v2594+6;
+  int v11381=v6938+3;
+  int v11382=v9585+0;
+  int v11383=v1340+9;
+  int v11384=v10339+9;
+  int v11385=v2221+9;
+  int v11386=v8965+1;
+  int v11387=v10395+7;
+  int v11388=v580+8;
+  int v11389=v8156+7;
+  int v11390=v4148+3;
+  int v11391=v226+8;
+  int v11392=v2953+6;
+  int v11393=v7740+9;
+  int v11394=v1185+7;
+  int v11395=v7749+3;
+  int v11396=v9551+0;
+  int v11397=v4514+1;
+  int v11398=v10239+6;
+  int v11399=v3924+8;
+  int v11400=v8645+2;
+  int v11401=v3008+9;
+  int v11402=v2077+7;
+  int v11403=v9371+0;
+  int v11404=v10626+9;
+  int v11405=v4258+1;
+  int v11406=v9458+4;
+  int v11407=v1847+5;
+  int v11408=v5269+0;
+  int v11409=v8981+9;
+  int v11410=v617+7;
+  int v11411=v11+5;
+  int v11412=v2404+1;
+  int v11413=v11059+7;
+  int v11414=v1639+7;
+  int v11415=v4741+8;
+  int v11416=v6016+4;
+  int v11417=v1123+4;
+  int v11418=v3908+6;
+  int v11419=v3448+4;
+  int v11420=v9699+8;
+  int v11421=v6657+3;
+  int v11422=v3409+0;
+  int v11423=v9281+0;
+  int v11424=v1622+8;
+  int v11425=v3112+2;
+  int v11426=v4346+8;
+  int v11427=v9208+3;
+  int v11428=v9597+1;
+  int v11429=v8916+0;
+  int v11430=v10817+5;
+  int v11431=v316+8;
+  int v11432=v11017+5;
+  int v11433=v9566+2;
+  int v11434=v5268+1;
+  int v11435=v4637+3;
+  int v11436=v4508+6;
+  int v11437=v839+1;
+  int v11438=v6314+7;
+  int v11439=v1371+8;
+  int v11440=v7002+7;
+  int v11441=v8574+6;
+  int v11442=v9510+9;
+  int v11443=v908+6;
+  int v11444=v4482+6;
+  int v11445=v8417+0;
+  int v11446=v2632+7;
+  int v11447=v4430+4;
+  int v11448=v4758+2;
+  int v11449=v9701+0;
+  int v11450=v10869+5;
+  int v11451=v9973+0;
+  int v11452=v2247+4;
+  int v11453=v8619+8;
+  int v11454=v7487+7;
+  int v11455=v9689+2;
+  int v11456=v9986+3;
+  int v11457=v10804+8;
+  int v11458=v6173+6;
+  int v11459=v2240+1;
+  int v11460=v8547+7;
+  int v11461=v1970+3;
+  int v11462=v8589+7;
+  int v11463=v5262+6;
+  int v11464=v819+9;
+  int v11465=v2118+5;
+  int v11466=v4365+2;
+  int v11467=v2133+1;
+  int v11468=v178+4;
+  int v11469=v5670+7;
+  int v11470=v6069+5;
+  int v11471=v8992+0;
+  int v11472=v9175+0;
+  int v11473=v3513+2;
+  int v11474=v8999+3;
+  int v11475=v5471+7;
+  int v11476=v3551+6;
+  int v11477=v6037+8;
+  int v11478=v2013+0;
+  int v11479=v5913+2;
+  int v11480=v409+8;
+  int v11481=v5165+7;
+  int v11482=v2787+4;
+  int v11483=v2077+3;
+  int v11484=v1695+5;
+  int v11485=v4513+6;
+  int v11486=v3559+4;
+  int v11487=v3890+8;
+  int v11488=v2148+3;
+  int v11489=v3203+9;
+  int v11490=v11294+9;
+  int v11491=v6750+3;
+  int v11492=v8982+3;
+  int v11493=v1222+1;
+  int v11494=v2186+4;
+  int v11495=v3718+9;
+  int v11496=v487+6;
+  int v11497=v8882+8;
+  int v11498=v3552+9;
+  int v11499=v896+4;
+  int v11500=v10319+3;
+  int v11501=v9968+4;
+  int v11502=v5526+2;
+  int v11503=v1797+7;
+  int v11504=v1967+8;
+  int v11505=v8886+5;
+  int v11506=v9643+6;
+  int v11507=v3003+2;
+  int v11508=v3589+6;
+  int v11509=v5357+5;
+  int v11510=v6827+6;
+  int v11511=v1778+1;
+  int v11512=v10883+2;
+  int v11513=v7968+7;
+  int v11514=v1224+2;
+  int v11515=v559+1;
+  int v11516=v2293+1;
+  int v11517=v831+9;
+  int v11518=v9037+1;
+  int v11519=v1446+6;
+  int v11520=v1265+5;
+  int v11521=v3839+2;
+  int v11522=v9802+4;
+  int v11523=v437+7;
+  int v11524=v3236+5;
+  int v11525=v1851+5;
+  int v11526=v570+7;
+  int v11527=v8583+2;
+  int v11528=v2685+6;
+  int v11529=v318+4;
+  int v11530=v1766+4;
+  int v11531=v516+5;
+  int v11532=v5933+8;
+  int v11533=v5211+2;
+  int v11534=v5056+9;
+  int v11535=v1857+2;
+  int v11536=v7137+3;
+  int v11537=v8463+6;
+  int v11538=v787+6;
+  int v11539=v6507+6;
+  int v11540=v4415+0;
+  int v11541=v11143+1;
+  int v11542=v5591+0;
+  int v11543=v334+3;
+  int v11544=v6036+6;
+  int v11545=v1+1;
+  int v11546=v1112+2;
+  int v11547=v9074+5;
+  int v11548=v8087+5;
+  int v11549=v10194+1;
+  int v11550=v490+4;
+  int v11551=v1675+4;
+  int v11552=v60+9;
+  int v11553=v8293+5;
+  int v11554=v5323+4;
+  int v11555=v9384+5;
+  int v11556=v6591+1;
+  int v11557=v2408+2;
+  int v11558=v10167+7;
+  int v11559=v10477+8;
+  int v11560=v5460+9;
+  int v11561=v11493+1;
+  int v11562=v10433+4;
+  int v11563=v4760+3;
+  int v11564=v2003+6;
+  int v11565=v9778+3;
+  int v11566=v8374+4;
+  int v11567=v11094+8;
+  int v11568=v5484+0;
+  int v11569=v5250+1;
+  int v11570=v4887+5;
+  int v11571=v10235+1;
+  int v11572=v4565+9;
+  int v11573=v2344+5;
+  int v11574=v10032+9;
+  int v11575=v11537+1;
+  int v11576=v6019+6;
+  int v11577=v3865+0;
+  int v11578=v5439+7;
+  int v11579=v9449+4;
+  int v11580=v2256+7;
+  int v11581=v3008+6;
+  int v11582=v3365+7;
+  int v11583=v6340+9;
+  int v11584=v3957+4;
+  int v11585=v10968+4;
+  int v11586=v6197+6;
+  int v11587=v4483+0;
+  int v11588=v6185+8;
+  int v11589=v6583+2;
+  int v11590=v141+2;
+  int v11591=v682+5;
+  int v11592=v11323+3;
+  int v11593=v1544+9;
+  int v11594=v11511+6;
+  int v11595=v2862+0;
+  int v11596=v6673+4;
+  int v11597=v4872+1;
+  int v11598=v5917+0;
+  int v11599=v9751+9;
+  int v11600=v8123+8;
+  int v11601=v9935+9;
+  int v11602=v3940+3;
+  int v11603=v9993+3;
+  int v11604=v9829+1;
+  int v11605=v1518+2;
+  int v11606=v7727+9;
+  int v11607=v2050+2;
+  int v11608=v11165+9;
+  int v11609=v10457+8;
+  int v11610=v6315+0;
+  int v11611=v1253+1;
+  int v11612=v9955+5;
+  int v11613=v1630+3;
+  int v11614=v1362+6;
+  int v11615=v2818+0;
+  int v11616=v3852+7;
+  int v11617=v10728+8;
+  int v11618=v11294+8;
+  int v11619=v10570+8;
+  int v11620=v5424+6;
+  int v11621=v10776+0;
+  int v11622=v2194+7;
+  int v11623=v6544+0;
+  int v11624=v7470+4;
+  int v11625=v9503+9;
+  int v11626=v3108+1;
+  int v11627=v2997+2;
+  int v11628=v8776+8;
+  int v11629=v8653+1;
+  int v11630=v6508+6;
+  int v11631=v2499+5;
+  int v11632=v9721+1;
+  int v11633=v11121+6;
+  int v11634=v3906+9;
+  int v11635=v3286+5;
+  int v11636=v1908+6;
+  int v11637=v1922+4;
+  int v11638=v7867+7;
+  int v11639=v5996+0;
+  int v11640=v8204+2;
+  int v11641=v10232+6;
+  int v11642=v7469+7;
+  int v11643=v1954+0;
+  int v11644=v11338+8;
+  int v11645=v5171+1;
+  int v11646=v7177+1;
+  int v11647=v8087+5;
+  int v11648=v6415+8;
+  int v11649=v1262+5;
+  int v11650=v3451+4;
+  int v11651=v11409+1;
+  int v11652=v9739+1;
+  int v11653=v8236+9;
+  int v11654=v6201+9;
+  int v11655=v7345+5;
+  int v11656=v6821+3;
+  int v11657=v8045+4;
+  int v11658=v11124+8;
+  int v11659=v9150+2;
+  int v11660=v4053+9;
+  int v11661=v4192+6;
+  int v11662=v1945+2;
+  int v11663=v1845+4;
+  int v11664=v5215+5;
+  int v11665=v10654+9;
+  int v11666=v440+9;
+  int v11667=v9951+7;
+  int v11668=v2482+9;
+  int v11669=v10391+3;
+  int v11670=v9448+8;
+  int v11671=v3662+7;
+  int v11672=v9089+6;
+  int v11673=v6632+3;
+  int v11674=v1767+4;
+  int v11675=v7035+2;
+  int v11676=v9453+7;
+  int v11677=v970+8;
+  int v11678=v410+7;
+  int v11679=v267+9;
+  int v11680=v3400+6;
+  int v11681=v116+1;
+  int v11682=v1333+5;
+  int v11683=v9918+5;
+  int v11684=v10476+4;
+  int v11685=v736+0;
+  int v11686=v5000+5;
+  int v11687=v2195+5;
+  int v11688=v1394+7;
+  int v11689=v2753+3;
+  int v11690=v10612+0;
+  int v11691=v9256+4;
+  int v11692=v2618+3;
+  int v11693=v5779+2;
+  int v11694=v6883+4;
+  int v11695=v7982+2;
+  int v11696=v2194+2;
+  int v11697=v11348+0;
+  int v11698=v7415+7;
+  int v11699=v2296+1;
+  int v11700=v2038+8;
+  int v11701=v8175+4;
+  int v11702=v11203+0;
+  int v11703=v7506+8;
+  int v11704=v8532+5;
+  int v11705=v4004+6;
+  int v11706=v5678+6;
+  int v11707=v5608+3;
+  int v11708=v1273+8;
+  int v11709=v1789+0;
+  int v11710=v3453+0;
+  int v11711=v9909+2;
+  int v11712=v9249+8;
+  int v11713=v11103+9;
+  int v11714=v3869+5;
+  int v11715=v7989+6;
+  int v11716=v530+7;
+  int v11717=v9732+7;
+  int v11718=v4358+8;
+  int v11719=v4751+5;
+  int v11720=v4769+6;
+  int v11721=v3685+2;
+  int v11722=v11327+1;
+  int v11723=v3223+1;
+  int v11724=v125+8;
+  int v11725=v8987+0;
+  int v11726=v9255+1;
+  int v11727=v5403+5;
+  int v11728=v6343+7;
+  int v11729=v1537+9;
+  int v11730=v9152+5;
+  int v11731=v10587+3;
+  int v11732=v293+3;
+  int v11733=v1767+6;
+  int v11734=v5238+3;
+  int v11735=v830+2;
+  int v11736=v3032+6;
+  int v11737=v3381+1;
+  int v11738=v977+2;
+  int v11739=v6056+9;
+  int v11740=v9683+4;
+  int v11741=v117+3;
+  int v11742=v3842+0;
+  int v11743=v10858+5;
+  int v11744=v451+1;
+  int v11745=v6539+8;
+  int v11746=v5050+8;
+  int v11747=v893+1;
+  int v11748=v5327+6;
+  int v11749=v9463+0;
+  int v11750=v5617+6;
+  int v11751=v8959+2;
+  int v11752=v8360+7;
+  int v11753=v5881+6;
+  int v11754=v8775+2;
+  int v11755=v7653+9;
+  int v11756=v11217+1;
+  int v11757=v2786+1;
+  int v11758=v4355+6;
+  int v11759=v1090+2;
+  int v11760=v3761+6;
+  int v11761=v2616+8;
+  int v11762=v1296+0;
+  int v11763=v9002+6;
+  int v11764=v9597+2;
+  int v11765=v5164+7;
+  int v11766=v792+4;
+  int v11767=v11366+2;
+  int v11768=v1459+7;
+  int v11769=v7027+8;
+  int v11770=v9028+4;
+  int v11771=v3320+9;
+  int v11772=v11173+4;
+  int v11773=v6583+0;
+  int v11774=v1972+6;
+  int v11775=v3285+0;
+  int v11776=v7921+4;
+  int v11777=v8713+8;
+  int v11778=v384+5;
+  int v11779=v9265+1;
+  int v11780=v5126+4;
+  int v11781=v10169+3;
+  int v11782=v5694+3;
+  int v11783=v4820+4;
+  int v11784=v10808+0;
+  int v11785=v6801+2;
+  int v11786=v5309+4;
+  int v11787=v6370+7;
+  int v11788=v4150+8;
+  int v11789=v6525+9;
+  int v11790=v545+1;
+  int v11791=v10176+4;
+  int v11792=v11633+2;
+  int v11793=v10455+5;
+  int v11794=v1414+1;
+  int v11795=v8941+0;
+  int v11796=v9508+2;
+  int v11797=v6049+8;
+  int v11798=v10850+7;
+  int v11799=v9278+4;
+  int v11800=v1428+4;
+  int v11801=v396+8;
+  int v11802=v9262+0;
+  int v11803=v8720+1;
+  int v11804=v4564+0;
+  int v11805=v7355+0;
+  int v11806=v8052+9;
+  int v11807=v6376+4;
+  int v11808=v10290+9;
+  int v11809=v10255+9;
+  int v11810=v11727+6;
+  int v11811=v386+8;
+  int v11812=v1754+1;
+  int v11813=v9682+8;
+  int v11814=v8914+5;
+  int v11815=v6076+6;
+  int v11816=v7818+5;
+  int v11817=v5382+7;
+  int v11818=v6194+9;
+  int v11819=v6733+0;
+  int v11820=v6202+8;
+  int v11821=v6828+1;
+  int v11822=v11322+6;
+  int v11823=v2617+4;
+  int v11824=v2326+4;
+  int v11825=v2961+4;
+  int v11826=v9732+2;
+  int v11827=v438+6;
+  int v11828=v11364+1;
+  int v11829=v5666+5;
+  int v11830=v9259+7;
+  int v11831=v5473+4;
+  int v11832=v2244+8;
+  int v11833=v1613+2;
+  int v11834=v1739+9;
+  int v11835=v6059+4;
+  int v11836=v4374+8;
+  int v11837=v4171+1;
+  int v11838=v7708+7;
+  int v11839=v9645+2;
+  int v11840=v10214+5;
+  int v11841=v6006+4;
+  int v11842=v3353+9;
+  int v11843=v11096+6;
+  int v11844=v10318+0;
+  int v11845=v10533+3;
+  int v11846=v8727+3;
+  int v11847=v5499+4;
+  int v11848=v3884+5;
+  int v11849=v6253+9;
+  int v11850=v11162+3;
+  int v11851=v4785+5;
+  int v11852=v11556+4;
+  int v11853=v3121+6;
+  int v11854=v7323+2;
+  int v11855=v232+6;
+  int v11856=v5053+7;
+  int v11857=v8421+6;
+  int v11858=v2008+7;
+  int v11859=v11145+2;
+  int v11860=v3334+4;
+  int v11861=v3373+9;
+  int v11862=v2818+7;
+  int v11863=v10986+0;
+  int v11864=v6624+4;
+  int v11865=v11680+5;
+  int v11866=v9608+5;
+  int v11867=v3581+6;
+  int v11868=v1420+2;
+  int v11869=v10536+5;
+  int v11870=v4835+5;
+  int v11871=v3184+7;
+  int v11872=v1294+3;
+  int v11873=v4516+2;
+  int v11874=v7752+7;
+  int v11875=v4208+3;
+  int v11876=v9465+7;
+  int v11877=v5529+6;
+  int v11878=v11372+8;
+  int v11879=v8404+8;
+  int v11880=v804+5;
+  int v11881=v3010+5;
+  int v11882=v2349+5;
+  int v11883=v6340+0;
+  int v11884=v8258+9;
+  int v11885=v54+6;
+  int v11886=v10398+2;
+  int v11887=v1817+1;
+  int v11888=v6288+3;
+  int v11889=v9799+4;
+  int v11890=v8172+1;
+  int v11891=v10255+3;
+  int v11892=v8874+4;
+  int v11893=v9759+2;
+  int v11894=v1238+0;
+  int v11895=v10935+5;
+  int v11896=v9348+7;
+  int v11897=v9392+1;
+  int v11898=v7484+2;
+  int v11899=v7984+7;
+  int v11900=v7004+4;
+  int v11901=v2847+6;
+  int v11902=v10244+3;
+  int v11903=v4992+5;
+  int v11904=v5576+9;
+  int v11905=v9386+1;
+  int v11906=v7014+0;
+  int v11907=v7628+8;
+  int v11908=v1907+7;
+  int v11909=v3910+9;
+  int v11910=v1832+8;
+  int v11911=v2028+1;
+  int v11912=v7836+1;
+  int v11913=v11400+2;
+  int v11914=v3811+3;
+  int v11915=v3886+4;
+  int v11916=v4211+4;
+  int v11917=v10190+7;
+  int v11918=v10425+5;
+  int v11919=v11635+6;
+  int v11920=v6123+6;
+  int v11921=v4800+8;
+  int v11922=v6030+5;
+  int v11923=v8031+8;
+  int v11924=v10221+8;
+  int v11925=v10333+2;
+  int v11926=v4209+4;
+  int v11927=v10279+7;
+  int v11928=v914+1;
+  int v11929=v5567+9;
+  int v11930=v3352+7;
+  int v11931=v5348+4;
+  int v11932=v11092+8;
+  int v11933=v9384+4;
+  int v11934=v7762+1;
+  int v11935=v7630+4;
+  int v11936=v8880+2;
+  int v11937=v3957+9;
+  int v11938=v9806+2;
+  int v11939=v11935+1;
+  int v11940=v8567+9;
+  int v11941=v7075+6;
+  int v11942=v5711+0;
+  int v11943=v5546+0;
+  int v11944=v4350+2;
+  int v11945=v7995+5;
+  int v11946=v8264+9;
+  int v11947=v543+9;
+  int v11948=v8790+8;
+  int v11949=v7846+7;
+  int v11950=v9095+5;
+  int v11951=v9785+8;
+  int v11952=v10195+7;
+  int v11953=v1204+6;
+  int v11954=v100+6;
+  int v11955=v7945+0;
+  int v11956=v4194+7;
+  int v11957=v3487+3;
+  int v11958=v5355+3;
+  int v11959=v7989+2;
+  int v11960=v3834+4;
+  int v11961=v9506+1;
+  int v11962=v1713+5;
+  int v11963=v4363+7;
+  int v11964=v11410+9;
+  int v11965=v9969+8;
+  int v11966=v7307+6;
+  int v11967=v4690+0;
+  int v11968=v9729+8;
+  int v11969=v488+3;
+  int v11970=v7543+9;
+  int v11971=v3010+0;
+  int v11972=v804+8;
+  int v11973=v6484+0;
+  int v11974=v8807+3;
+  int v11975=v8066+9;
+  int v11976=v6399+4;
+  int v11977=v1727+5;
+  int v11978=v1242+6;
+  int v11979=v2747+7;
+  int v11980=v6143+4;
+  int v11981=v10273+2;
+  int v11982=v4242+0;
+  int v11983=v2358+0;
+  int v11984=v7999+1;
+  int v11985=v10780+6;
+  int v11986=v381+9;
+  int v11987=v6317+8;
+  int v11988=v9980+3;
+  int v11989=v8649+5;
+  int v11990=v2644+0;
+  int v11991=v2671+0;
+  int v11992=v657+7;
+  int v11993=v3524+3;
+  int v11994=v10300+7;
+  int v11995=v5508+5;
+  int v11996=v488+2;
+  int v11997=v5257+9;
+  int v11998=v10302+6;
+  int v11999=v4066+4;
+  int v12000=v10996+3;
+  int v12001=v5126+3;
+  int v12002=v210+4;
+  int v12003=v11159+7;
+  int v12004=v7379+5;
+  int v12005=v3124+6;
+  int v12006=v10493+2;
+  int v12007=v8528+6;
+  int v12008=v3789+0;
+  int v12009=v9178+7;
+  int v12010=v4743+0;
+  int v12011=v2351+8;
+  int v12012=v7464+5;
+  int v12013=v5359+7;
+  int v12014=v8285+2;
+  int v12015=v7717+5;
+  int v12016=v7875+5;
+  int v12017=v43+6;
+  int v12018=v10116+0;
+  int v12019=v5258+2;
+  int v12020=v4069+5;
+  int v12021=v6238+3;
+  int v12022=v2046+7;
+  int v12023=v934+3;
+  int v12024=v8437+7;
+  int v12025=v10494+1;
+  int v12026=v9375+9;
+  int v12027=v8447+1;
+  int v12028=v4717+4;
+  int v12029=v9996+7;
+  int v12030=v9886+1;
+  int v12031=v2896+3;
+  int v12032=v9440+2;
+  int v12033=v9877+9;
+  int v12034=v4714+5;
+  int v12035=v1553+4;
+  int v12036=v7918+3;
+  int v12037=v6893+5;
+  int v12038=v593+1;
+  int v12039=v10815+2;
+  int v12040=v1605+5;
+  int v12041=v5632+4;
+  int v12042=v5087+6;
+  int v12043=v11331+3;
+  int v12044=v2246+9;
+  int v12045=v10392+6;
+  int v12046=v3760+3;
+  int v12047=v678+8;
+  int v12048=v559+7;
+  int v12049=v11714+8;
+  int v12050=v7109+2;
+  int v12051=v8054+4;
+  int v12052=v4413+0;
+  int v12053=v10158+0;
+  int v12054=v10017+8;
+  int v12055=v8730+1;
+  int v12056=v7480+1;
+  int v12057=v3278+7;
+  int v12058=v10414+1;
+  int v12059=v9167+5;
+  int v12060=v5326+1;
+  int v12061=v7373+3;
+  int v12062=v3837+8;
+  int v12063=v3427+1;
+  int v12064=v7801+1;
+  int v12065=v4218+3;
+  int v12066=v4058+5;
+  int v12067=v6375+8;
+  int v12068=v3283+5;
+  int v12069=v5674+8;
+  int v12070=v9033+4;
+  int v12071=v7455+4;
+  int v12072=v1734+8;
+  int v12073=v10418+8;
+  int v12074=v6922+6;
+  int v12075=v6305+6;
+  int v12076=v3506+2;
+  int v12077=v8812+7;
+  int v12078=v1326+5;
+  int v12079=v10332+1;
+  int v12080=v10565+8;
+  int v12081=v11966+0;
+  int v12082=v3526+9;
+  int v12083=v4430+4;
+  int v12084=v1545+7;
+  int v12085=v7364+3;
+  int v12086=v6223+0;
+  int v12087=v3335+3;
+  int v12088=v3761+6;
+  int v12089=v6993+5;
+  int v12090=v7536+8;
+  int v12091=v5602+8;
+  int v12092=v4835+9;
+  int v12093=v2567+1;
+  int v12094=v10850+8;
+  int v12095=v2898+6;
+  int v12096=v914+6;
+  int v12097=v9106+2;
+  int v12098=v4819+6;
+  int v12099=v670+1;
+  int v12100=v7829+1;
+  int v12101=v7159+6;
+  int v12102=v558+5;
+  int v12103=v4391+8;
+  int v12104=v3329+3;
+  int v12105=v9784+6;
+  int v12106=v7880+7;
+  int v12107=v9705+7;
+  int v12108=v3793+8;
+  int v12109=v9107+5;
+  int v12110=v8112+3;
+  int v12111=v593+0;
+  int v12112=v8674+5;
+  int v12113=v7066+8;
+  int v12114=v6782+0;
+  int v12115=v8275+3;
+  int v12116=v2763+4;
+  int v12117=v10779+2;
+  int v12118=v3630+4;
+  int v12119=v7447+5;
+  int v12120=v2809+8;
+  int v12121=v4912+4;
+  int v12122=v4415+7;
+  int v12123=v10948+8;
+  int v12124=v5713+6;
+  int v12125=v8662+4;
+  int v12126=v2321+9;
+  int v12127=v11957+1;
+  int v12128=v4189+8;
+  int v12129=v10478+4;
+  int v12130=v1084+1;
+  int v12131=v4019+3;
+  int v12132=v7296+6;
+  int v12133=v209+0;
+  int v12134=v9852+6;
+  int v12135=v9919+8;
+  int v12136=v10235+0;
+  int v12137=v5000+0;
+  int v12138=v9323+7;
+  int v12139=v3454+2;
+  int v12140=v7447+5;
+  int v12141=v1894+2;
+  int v12142=v5662+0;
+  int v12143=v7121+6;
+  int v12144=v370+3;
+  int v12145=v10879+3;
+  int v12146=v1564+9;
+  int v12147=v3911+9;
+  int v12148=v3791+1;
+  int v12149=v9432+1;
+  int v12150=v8055+1;
+  int v12151=v5739+1;
+  int v12152=v9658+1;
+  int v12153=v10224+4;
+  int v12154=v11602+7;
+  int v12155=v2535+9;
+  int v12156=v3285+2;
+  int v12157=v4117+8;
+  int v12158=v5180+0;
+  int v12159=v7241+5;
+  int v12160=v11177+6;
+  int v12161=v7026+8;
+  int v12162=v2148+7;
+  int v12163=v9333+8;
+  int v12164=v6280+6;
+  int v12165=v5238+0;
+  int v12166=v3515+3;
+  int v12167=v5865+6;
+  int v12168=v4329+3;
+  int v12169=v897+9;
+  int v12170=v3561+8;
+  int v12171=v11180+8;
+  int v12172=v6563+5;
+  int v12173=v10684+1;
+  int v12174=v2264+0;
+  int v12175=v9453+7;
+  int v12176=v5840+1;
+  int v12177=v4635+3;
+  int v12178=v5290+2;
+  int v12179=v11051+5;
+  int v12180=v11815+9;
+  int v12181=v4319+6;
+  int v12182=v276+5;
+  int v12183=v944+9;
+  int v12184=v11466+7;
+  int v12185=v5620+9;
+  int v12186=v4200+6;
+  int v12187=v1422+9;
+  int v12188=v3175+6;
+  int v12189=v5108+7;
+  int v12190=v10602+2;
+  int v12191=v10579+7;
+  int v12192=v10628+1;
+  int v12193=v6926+8;
+  int v12194=v229+6;
+  int v12195=v4772+2;
+  int v12196=v4635+9;
+  int v12197=v8188+4;
+  int v12198=v1471+5;
+  int v12199=v5359+8;
+  int v12200=v7395+9;
+  int v12201=v100+3;
+  int v12202=v3755+9;
+  int v12203=v3425+1;
+  int v12204=v7130+9;
+  int v12205=v1839+1;
+  int v12206=v616+5;
+  int v12207=v5681+7;
+  int v12208=v1589+3;
+  int v12209=v6261+3;
+  int v12210=v9702+8;
+  int v12211=v3027+5;
+  int v12212=v6925+0;
+  int v12213=v1375+7;
+  int v12214=v2731+5;
+  int v12215=v594+8;
+  int v12216=v1575+2;
+  int v12217=v8756+1;
+  int v12218=v10159+4;
+  int v12219=v1458+8;
+  int v12220=v8593+2;
+  int v12221=v679+8;
+  int v12222=v5644+1;
+  int v12223=v4302+9;
+  int v12224=v10072+6;
+  int v12225=v2772+4;
+  int v12226=v6111+0;
+  int v12227=v10342+8;
+  int v12228=v10184+1;
+  int v12229=v8352+7;
+  int v12230=v2+3;
+  int v12231=v7946+5;
+  int v12232=v1739+6;
+  int v12233=v5175+5;
+  int v12234=v9272+2;
+  int v12235=v9578+2;
+  int v12236=v2759+4;
+  int v12237=v12160+7;
+  int v12238=v11637+8;
+  int v12239=v4065+2;
+  int v12240=v2039+2;
+  int v12241=v3218+6;
+  int v12242=v8016+1;
+  int v12243=v4878+5;
+  int v12244=v11217+9;
+  int v12245=v11756+7;
+  int v12246=v8459+7;
+  int v12247=v911+8;
+  int v12248=v7194+8;
+  int v12249=v11890+8;
+  int v12250=v10066+8;
+  int v12251=v5034+0;
+  int v12252=v3481+1;
+  int v12253=v1439+0;
+  int v12254=v1266+5;
+  int v12255=v11633+1;
+  int v12256=v4495+2;
+  int v12257=v3910+1;
+  int v12258=v2878+5;
+  int v12259=v5760+8;
+  int v12260=v10648+2;
+  int v12261=v10599+4;
+  int v12262=v6073+9;
+  int v12263=v7632+4;
+  int v12264=v11518+8;
+  int v12265=v9103+1;
+  int v12266=v2802+7;
+  int v12267=v5176+2;
+  int v12268=v6875+8;
+  int v12269=v1288+6;
+  int v12270=v9917+6;
+  int v12271=v3796+2;
+  int v12272=v9514+3;
+  int v12273=v5763+3;
+  int v12274=v9848+7;
+  int v12275=v6036+7;
+  int v12276=v4787+9;
+  int v12277=v3918+0;
+  int v12278=v4461+4;
+  int v12279=v11374+2;
+  int v12280=v1608+0;
+  int v12281=v5098+5;
+  int v12282=v2515+2;
+  int v12283=v1836+5;
+  int v12284=v8770+6;
+  int v12285=v270+5;
+  int v12286=v5991+8;
+  int v12287=v5282+7;
+  int v12288=v4018+8;
+  int v12289=v8080+8;
+  int v12290=v3367+9;
+  int v12291=v3466+1;
+  int v12292=v8504+6;
+  int v12293=v7179+2;
+  int v12294=v8189+8;
+  int v12295=v9203+0;
+  int v12296=v858+6;
+  int v12297=v8754+4;
+  int v12298=v3827+3;
+  int v12299=v65+3;
+  int v12300=v5938+8;
+  int v12301=v6699+6;
+  int v12302=v5798+6;
+  int v12303=v11407+5;
+  int v12304=v2274+8;
+  int v12305=v6295+9;
+  int v12306=v6434+1;
+  int v12307=v5724+1;
+  int v12308=v7507+5;
+  int v12309=v6304+9;
+  int v12310=v768+7;
+  int v12311=v7320+9;
+  int v12312=v8597+0;
+  int v12313=v6753+7;
+  int v12314=v6312+3;
+  int v12315=v1368+8;
+  int v12316=v4723+6;
+  int v12317=v5574+9;
+  int v12318=v95+6;
+  int v12319=v2354+7;
+  int v12320=v6727+9;
+  int v12321=v3686+0;
+  int v12322=v2029+1;
+  int v12323=v10872+8;
+  int v12324=v1790+7;
+  int v12325=v10262+0;
+  int v12326=v9255+4;
+  int v12327=v10958+0;
+  int v12328=v959+9;
+  int v12329=v3482+0;
+  int v12330=v9529+1;
+  int v12331=v3006+0;
+  int v12332=v3401+2;
+  int v12333=v10290+8;
+  int v12334=v6459+7;
+  int v12335=v7217+5;
+  int v12336=v10287+3;
+  int v12337=v5603+6;
+  int v12338=v11194+9;
+  int v12339=v1600+5;
+  int v12340=v3705+5;
+  int v12341=v1925+8;
+  int v12342=v7209+0;
+  int v12343=v5989+6;
+  int v12344=v10728+8;
+  int v12345=v4269+0;
+  int v12346=v3697+3;
+  int v12347=v9252+5;
+  int v12348=v2784+8;
+  int v12349=v3846+5;
+  int v12350=v5837+1;
+  int v12351=v9440+0;
+  int v12352=v7280+3;
+  int v12353=v4137+7;
+  int v12354=v1041+6;
+  int v12355=v1383+1;
+  int v12356=v11853+9;
+  int v12357=v10006+0;
+  int v12358=v6602+0;
+  int v12359=v3569+8;
+  int v12360=v7479+3;
+  int v12361=v6396+4;
+  int v12362=v3439+0;
+  int v12363=v92+3;
+  int v12364=v4424+5;
+  int v12365=v7451+4;
+  int v12366=v8023+7;
+  int v12367=v3239+4;
+  int v12368=v5041+4;
+  int v12369=v10342+7;
+  int v12370=v3176+2;
+  int v12371=v5413+0;
+  int v12372=v3032+5;
+  int v12373=v10928+8;
+  int v12374=v616+7;
+  int v12375=v7413+7;
+  int v12376=v3500+4;
+  int v12377=v7131+9;
+  int v12378=v9258+7;
+  int v12379=v8826+4;
+  int v12380=v4145+5;
+  int v12381=v1344+6;
+  int v12382=v6592+1;
+  int v12383=v11855+9;
+  int v12384=v5073+8;
+  int v12385=v9684+4;
+  int v12386=v10167+6;
+  int v12387=v6112+8;
+  int v12388=v3043+2;
+  int v12389=v3240+2;
+  int v12390=v169+4;
+  int v12391=v9618+3;
+  int v12392=v7504+6;
+  int v12393=v10956+3;
+  int v12394=v8979+4;
+  int v12395=v1219+5;
+  int v12396=v10847+5;
+  int v12397=v930+7;
+  int v12398=v8060+7;
+  int v12399=v2219+7;
+  int v12400=v9461+4;
+  int v12401=v7285+6;
+  int v12402=v8794+0;
+  int v12403=v5894+5;
+  int v12404=v7458+8;
+  int v12405=v9389+4;
+  int v12406=v12174+6;
+  int v12407=v11259+0;
+  int v12408=v10220+0;
+  int v12409=v7602+0;
+  int v12410=v4300+9;
+  int v12411=v8871+1;
+  int v12412=v11066+3;
+  int v12413=v10231+3;
+  int v12414=v4599+3;
+  int v12415=v11862+2;
+  int v12416=v4522+0;
+  int v12417=v7758+5;
+  int v12418=v8963+4;
+  int v12419=v12273+5;
+  int v12420=v4726+8;
+  int v12421=v11686+1;
+  int v12422=v10897+5;
+  int v12423=v10219+4;
+  int v12424=v11928+6;
+  int v12425=v12421+2;
+  int v12426=v6968+5;
+  int v12427=v6381+2;
+  int v12428=v10020+7;
+  int v12429=v2604+5;
+  int v12430=v11860+8;
+  int v12431=v11227+4;
+  int v12432=v10934+5;
+  int v12433=v1717+5;
+  int v12434=v11675+8;
+  int v12435=v8937+3;
+  int v12436=v7274+2;
+  int v12437=v11680+3;
+  int v12438=v5743+0;
+  int v12439=v3959+9;
+  int v12440=v1493+3;
+  int v12441=v7459+6;
+  int v12442=v4587+4;
+  int v12443=v6794+6;
+  int v12444=v3801+1;
+  int v12445=v1719+3;
+  int v12446=v4663+3;
+  int v12447=v1856+0;
+  int v12448=v1881+7;
+  int v12449=v6764+4;
+  int v12450=v9831+5;
+  int v12451=v6632+6;
+  int v12452=v7739+6;
+  int v12453=v8165+0;
+  int v12454=v4116+5;
+  int v12455=v8012+0;
+  int v12456=v12089+3;
+  int v12457=v5162+1;
+  int v12458=v3320+6;
+  int v12459=v8315+6;
+  int v12460=v7948+2;
+  int v12461=v2867+2;
+  int v12462=v6210+4;
+  int v12463=v4666+6;
+  int v12464=v6605+4;
+  int v12465=v9098+3;
+  int v12466=v12440+4;
+  int v12467=v6412+6;
+  int v12468=v9092+5;
+  int v12469=v11364+4;
+  int v12470=v5398+1;
+  int v12471=v4994+8;
+  int v12472=v12130+9;
+  int v12473=v4283+3;
+  int v12474=v2179+9;
+  int v12475=v6072+4;
+  int v12476=v8377+3;
+  int v12477=v3866+9;
+  int v12478=v4721+3;
+  int v12479=v3824+3;
+  int v12480=v1563+6;
+  int v12481=v11145+5;
+  int v12482=v12208+8;
+  int v12483=v4310+8;
+  int v12484=v5963+0;
+  int v12485=v4202+5;
+  int v12486=v7483+2;
+  int v12487=v11916+1;
+  int v12488=v9596+3;
+  int v12489=v8851+6;
+  int v12490=v6701+7;
+  int v12491=v11919+0;
+  int v12492=v4019+7;
+  int v12493=v6632+0;
+  int v12494=v4999+7;
+  int v12495=v8283+6;
+  int v12496=v6419+2;
+  int v12497=v5898+0;
+  int v12498=v933+4;
+  int v12499=v10173+0;
+  int v12500=v4831+2;
+  int v12501=v6039+0;
+  int v12502=v10447+2;
+  int v12503=v2676+5;
+  int v12504=v6577+3;
+  int v12505=v11204+2;
+  int v12506=v10299+6;
+  int v12507=v137+6;
+  int v12508=v7883+0;
+  int v12509=v6822+2;
+  int v12510=v7178+2;
+  int v12511=v2799+3;
+  int v12512=v11082+5;
+  int v12513=v10678+5;
+  int v12514=v7076+4;
+  int v12515=v1480+4;
+  int v12516=v1537+3;
+  int v12517=v5244+3;
+  int v12518=v3652+0;
+  int v12519=v270+8;
+  int v12520=v7873+6;
+  int v12521=v7682+2;
+  int v12522=v12085+3;
+  int v12523=v1994+2;
+  int v12524=v6956+8;
+  int v12525=v2613+1;
+  int v12526=v10847+8;
+  int v12527=v9740+8;
+  int v12528=v3501+8;
+  int v12529=v8161+0;
+  int v12530=v10034+2;
+  int v12531=v2549+8;
+  int v12532=v8582+5;
+  int v12533=v12448+9;
+  int v12534=v3775+7;
+  int v12535=v8878+3;
+  int v12536=v12226+2;
+  int v12537=v1111+8;
+  int v12538=v1862+2;
+  int v12539=v4296+0;
+  int v12540=v12102+7;
+  int v12541=v12164+4;
+  int v12542=v10787+8;
+  int v12543=v9400+7;
+  int v12544=v11103+9;
+  int v12545=v7815+1;
+  int v12546=v6444+5;
+  int v12547=v723+4;
+  int v12548=v10441+2;
+  int v12549=v1380+5;
+  int v12550=v6679+5;
+  int v12551=v8544+7;
+  int v12552=v7413+5;
+  int v12553=v8744+6;
+  int v12554=v6428+3;
+  int v12555=v8194+2;
+  int v12556=v3543+1;
+  int v12557=v3853+3;
+  int v12558=v5586+9;
+  int v12559=v3016+5;
+  int v12560=v1551+0;
+  int v12561=v1124+4;
+  int v12562=v3578+9;
+  int v12563=v7454+1;
+  int v12564=v4914+8;
+  int v12565=v10871+6;
+  int v12566=v6087+4;
+  int v12567=v7561+1;
+  int v12568=v5505+5;
+  int v12569=v9065+7;
+  int v12570=v2338+4;
+  int v12571=v8492+3;
+  int v12572=v6693+4;
+  int v12573=v9508+9;
+  int v12574=v11484+4;
+  int v12575=v10550+8;
+  int v12576=v7794+9;
+  int v12577=v10720+7;
+  int v12578=v162+7;
+  int v12579=v3834+8;
+  int v12580=v11267+8;
+  int v12581=v6325+0;
+  int v12582=v6925+1;
+  int v12583=v9879+0;
+  int v12584=v867+5;
+  int v12585=v4947+7;
+  int v12586=v7729+8;
+  int v12587=v377+2;
+  int v12588=v8885+2;
+  int v12589=v6356+3;
+  int v12590=v785+5;
+  int v12591=v6594+5;
+  int v12592=v6347+5;
+  int v12593=v6261+9;
+  int v12594=v2413+4;
+  int v12595=v12471+4;
+  int v12596=v2412+0;
+  int v12597=v6478+1;
+  int v12598=v6906+0;
+  int v12599=v9078+6;
+  int v12600=v2848+5;
+  int v12601=v8186+5;
+  int v12602=v8419+9;
+  int v12603=v1029+7;
+  int v12604=v11713+0;
+  int v12605=v10201+5;
+  int v12606=v11119+0;
+  int v12607=v3533+3;
+  int v12608=v11766+1;
+  int v12609=v4876+1;
+  int v12610=v3111+4;
+  int v12611=v6964+1;
+  int v12612=v631+9;
+  int v12613=v5262+1;
+  int v12614=v7299+1;
+  int v12615=v1474+8;
+  int v12616=v3805+5;
+  int v12617=v5845+8;
+  int v12618=v6884+0;
+  int v12619=v4138+4;
+  int v12620=v3889+6;
+  int v12621=v2545+3;
+  int v12622=v1812+7;
+  int v12623=v4871+4;
+  int v12624=v5760+2;
+  int v12625=v9618+0;
+  int v12626=v724+0;
+  int v12627=v7181+1;
+  int v12628=v11858+9;
+  int v12629=v10440+2;
+  int v12630=v5829+5;
+  int v12631=v1553+7;
+  int v12632=v5432+6;
+  int v12633=v11456+1;
+  int v12634=v3187+7;
+  int v12635=v6278+8;
+  int v12636=v8270+8;
+  int v12637=v3472+7;
+  int v12638=v533+0;
+  int v12639=v2891+8;
+  int v12640=v8544+3;
+  int v12641=v11143+2;
+  int v12642=v3264+0;
+  int v12643=v7171+2;
+  int v12644=v4157+4;
+  int v12645=v2868+5;
+  int v12646=v3076+7;
+  int v12647=v12591+5;
+  int v12648=v11186+7;
+  int v12649=v6782+5;
+  int v12650=v6299+5;
+  int v12651=v3268+7;
+  int v12652=v6527+2;
+  int v12653=v2441+2;
+  int v12654=v979+9;
+  int v12655=v1172+5;
+  int v12656=v654+3;
+  int v12657=v6812+1;
+  int v12658=v2729+6;
+  int v12659=v8675+5;
+  int v12660=v9724+9;
+  int v12661=v12657+4;
+  int v12662=v9365+5;
+  int v12663=v9116+4;
+  int v12664=v3824+8;
+  int v12665=v5512+4;
+  int v12666=v12194+7;
+  int v12667=v6454+5;
+  int v12668=v10721+6;
+  int v12669=v4731+5;
+  int v12670=v11502+1;
+  int v12671=v10796+0;
+  int v12672=v2881+1;
+  int v12673=v6511+4;
+  int v12674=v139+5;
+  int v12675=v8410+9;
+  int v12676=v6266+3;
+  int v12677=v6379+1;
+  int v12678=v3953+1;
+  int v12679=v5737+5;
+  int v12680=v3817+0;
+  int v12681=v6910+8;
+  int v12682=v761+1;
+  int v12683=v5549+2;
+  int v12684=v7227+1;
+  int v12685=v1088+3;
+  int v12686=v11038+9;
+  int v12687=v968+2;
+  int v12688=v5569+9;
+  int v12689=v3584+7;
+  int v12690=v9256+8;
+  int v12691=v8482+9;
+  int v12692=v4384+2;
+  int v12693=v3778+0;
+  int v12694=v8403+8;
+  int v12695=v6307+7;
+  int v12696=v11916+3;
+  int v12697=v7596+6;
+  int v12698=v9763+9;
+  int v12699=v7730+3;
+  int v12700=v8871+0;
+  int v12701=v3439+5;
+  int v12702=v6056+3;
+  int v12703=v11065+2;
+  int v12704=v7463+6;
+  int v12705=v2276+2;
+  int v12706=v7342+3;
+  int v12707=v9683+0;
+  int v12708=v5749+6;
+  int v12709=v7870+7;
+  int v12710=v7150+2;
+  int v12711=v2305+1;
+  int v12712=v4301+5;
+  int v12713=v3375+5;
+  int v12714=v9011+7;
+  int v12715=v5174+6;
+  int v12716=v12498+2;
+  int v12717=v12626+2;
+  int v12718=v2799+4;
+  int v12719=v11261+1;
+  int v12720=v7346+3;
+  int v12721=v12671+7;
+  int v12722=v6129+7;
+  int v12723=v1966+7;
+  int v12724=v11803+8;
+  int v12725=v1316+2;
+  int v12726=v11445+3;
+  int v12727=v6745+7;
+  int v12728=v1320+2;
+  int v12729=v6655+2;
+  int v12730=v2292+4;
+  int v12731=v5424+4;
+  int v12732=v7498+7;
+  int v12733=v10483+4;
+  int v12734=v7438+0;
+  int v12735=v2869+3;
+  int v12736=v4801+6;
+  int v12737=v11546+0;
+  int v12738=v4468+4;
+  int v12739=v4708+8;
+  int v12740=v7161+3;
+  int v12741=v7619+8;
+  int v12742=v1846+6;
+  int v12743=v468+6;
+  int v12744=v696+7;
+  int v12745=v6857+3;
+  int v12746=v823+2;
+  int v12747=v12396+4;
+  int v12748=v9594+7;
+  int v12749=v899+9;
+  int v12750=v692+2;
+  int v12751=v10696+1;
+  int v12752=v523+3;
+  int v12753=v6584+1;
+  int v12754=v2020+7;
+  int v12755=v4242+3;
+  int v12756=v1032+9;
+  int v12757=v8965+3;
+  int v12758=v3342+3;
+  int v12759=v6638+4;
+  int v12760=v1725+7;
+  int v12761=v10699+3;
+  int v12762=v5139+1;
+  int v12763=v11874+9;
+  int v12764=v12586+5;
+  int v12765=v706+9;
+  int v12766=v6255+6;
+  int v12767=v6596+8;
+  int v12768=v12474+5;
+  int v12769=v7250+3;
+  int v12770=v10312+2;
+  int v12771=v7102+9;
+  int v12772=v1939+4;
+  int v12773=v5913+9;
+  int v12774=v2523+3;
+  int v12775=v3598+7;
+  int v12776=v5163+5;
+  int v12777=v9607+9;
+  int v12778=v7074+8;
+  int v12779=v5726+8;
+  int v12780=v824+3;
+  int v12781=v12469+2;
+  int v12782=v4777+3;
+  int v12783=v1897+2;
+  int v12784=v11267+8;
+  int v12785=v2561+6;
+  int v12786=v7369+8;
+  int v12787=v4485+7;
+  int v12788=v7995+3;
+  int v12789=v8335+2;
+  int v12790=v5309+1;
+  int v12791=v12075+2;
+  int v12792=v10649+3;
+  int v12793=v10614+2;
+  int v12794=v12786+9;
+  int v12795=v14+9;
+  int v12796=v492+0;
+  int v12797=v1050+7;
+  int v12798=v9254+0;
+  int v12799=v9497+6;
+  int v12800=v477+3;
+  int v12801=v8088+1;
+  int v12802=v10371+8;
+  int v12803=v10322+3;
+  int v12804=v3832+1;
+  int v12805=v7156+3;
+  int v12806=v12395+6;
+  int v12807=v2498+0;
+  int v12808=v3725+5;
+  int v12809=v3766+7;
+  int v12810=v2596+2;
+  int v12811=v10504+8;
+  int v12812=v7905+6;
+  int v12813=v839+5;
+  int v12814=v2577+6;
+  int v12815=v6988+2;
+  int v12816=v2461+1;
+  int v12817=v1650+3;
+  int v12818=v10404+0;
+  int v12819=v850+5;
+  int v12820=v7747+4;
+  int v12821=v2091+7;
+  int v12822=v12305+1;
+  int v12823=v2930+4;
+  int v12824=v5740+6;
+  int v12825=v12350+7;
+  int v12826=v1028+9;
+  int v12827=v3551+1;
+  int v12828=v5614+6;
+  int v12829=v6433+1;
+  int v12830=v5086+1;
+  int v12831=v11256+6;
+  int v12832=v1552+4;
+  int v12833=v6930+3;
+  int v12834=v537+8;
+  int v12835=v6351+6;
+  int v12836=v12082+3;
+  int v12837=v1986+4;
+  int v12838=v8939+4;
+  int v12839=v11972+9;
+  int v12840=v7608+6;
+  int v12841=v6259+4;
+  int v12842=v9216+7;
+  int v12843=v9587+3;
+  int v12844=v7864+8;
+  int v12845=v6801+4;
+  int v12846=v11450+6;
+  int v12847=v703+9;
+  int v12848=v4046+8;
+  int v12849=v4627+5;
+  int v12850=v316+9;
+  int v12851=v11156+7;
+  int v12852=v1701+3;
+  int v12853=v7833+6;
+  int v12854=v8875+0;
+  int v12855=v11285+0;
+  int v12856=v3191+0;
+  int v12857=v5859+5;
+  int v12858=v5136+6;
+  int v12859=v11029+4;
+  int v12860=v2275+2;
+  int v12861=v11056+9;
+  int v12862=v3802+4;
+  int v12863=v10853+9;
+  int v12864=v8154+6;
+  int v12865=v4414+8;
+  int v12866=v5976+2;
+  int v12867=v11033+6;
+  int v12868=v9795+8;
+  int v12869=v4175+7;
+  int v12870=v5976+3;
+  int v12871=v6877+9;
+  int v12872=v5336+2;
+  int v12873=v2645+2;
+  int v12874=v3194+3;
+  int v12875=v6844+2;
+  int v12876=v11571+4;
+  int v12877=v12423+3;
+  int v12878=v3472+2;
+  int v12879=v5846+3;
+  int v12880=v9767+5;
+  int v12881=v12067+0;
+  int v12882=v145+9;
+  int v12883=v6104+9;
+  int v12884=v2965+2;
+  int v12885=v7974+1;
+  int v12886=v6950+0;
+  int v12887=v531+7;
+  int v12888=v11484+6;
+  int v12889=v9881+7;
+  int v12890=v8071+6;
+  int v12891=v5129+3;
+  int v12892=v2397+4;
+  int v12893=v10174+7;
+  int v12894=v7606+8;
+  int v12895=v2126+4;
+  int v12896=v3264+2;
+  int v12897=v7330+0;
+  int v12898=v10912+5;
+  int v12899=v6639+8;
+  int v12900=v11892+1;
+  int v12901=v1155+7;
+  int v12902=v2627+8;
+  int v12903=v123+1;
+  int v12904=v3686+8;
+  int v12905=v9382+3;
+  int v12906=v7373+2;
+  int v12907=v10159+6;
+  int v12908=v8063+7;
+  int v12909=v12072+6;
+  int v12910=v1421+6;
+  int v12911=v11467+4;
+  int v12912=v8757+2;
+  int v12913=v5645+4;
+  int v12914=v5877+4;
+  int v12915=v10153+1;
+  int v12916=v1491+9;
+  int v12917=v10306+0;
+  int v12918=v11535+0;
+  int v12919=v3826+9;
+  int v12920=v2572+5;
+  int v12921=v8646+2;
+  int v12922=v5419+0;
+  int v12923=v6357+6;
+  int v12924=v7058+6;
+  int v12925=v2806+0;
+  int v12926=v6185+5;
+  int v12927=v3870+2;
+  int v12928=v3939+9;
+  int v12929=v5973+8;
+  int v12930=v4891+2;
+  int v12931=v9536+4;
+  int v12932=v11523+0;
+  int v12933=v8996+8;
+  int v12934=v1347+2;
+  int v12935=v11399+7;
+  int v12936=v2705+2;
+  int v12937=v131+8;
+  int v12938=v7052+4;
+  int v12939=v11512+6;
+  int v12940=v2960+8;
+  int v12941=v2887+6;
+  int v12942=v1001+8;
+  int v12943=v11061+6;
+  int v12944=v6248+2;
+  int v12945=v10608+1;
+  int v12946=v3054+4;
+  int v12947=v1975+4;
+  int v12948=v5791+0;
+  int v12949=v12039+2;
+  int v12950=v628+5;
+  int v12951=v25+4;
+  int v12952=v8932+8;
+  int v12953=v608+5;
+  int v12954=v1740+5;
+  int v12955=v993+9;
+  int v12956=v8744+2;
+  int v12957=v12844+0;
+  int v12958=v4255+8;
+  int v12959=v1171+9;
+  int v12960=v11715+9;
+  int v12961=v9130+3;
+  int v12962=v12083+5;
+  int v12963=v6496+2;
+  int v12964=v9524+7;
+  int v12965=v4886+8;
+  int v12966=v12910+1;
+  int v12967=v432+5;
+  int v12968=v7437+2;
+  int v12969=v1651+6;
+  int v12970=v2542+8;
+  int v12971=v1289+1;
+  int v12972=v8367+9;
+  int v12973=v5951+6;
+  int v12974=v1656+3;
+  int v12975=v8682+5;
+  int v12976=v1514+9;
+  int v12977=v2800+4;
+  int v12978=v10971+8;
+  int v12979=v11130+1;
+  int v12980=v10079+3;
+  int v12981=v11212+1;
+  int v12982=v954+7;
+  int v12983=v5703+7;
+  int v12984=v10400+4;
+  int v12985=v5731+4;
+  int v12986=v581+8;
+  int v12987=v6379+7;
+  int v12988=v9292+1;
+  int v12989=v10123+0;
+  int v12990=v7798+0;
+  int v12991=v10075+3;
+  int v12992=v1537+9;
+  int v12993=v9970+0;
+  int v12994=v266+1;
+  int v12995=v12246+5;
+  int v12996=v4318+5;
+  int v12997=v451+4;
+  int v12998=v3418+8;
+  int v12999=v7038+5;
+  int v13000=v94+2;
+  int v13001=v10754+5;
+  int v13002=v3384+2;
+  int v13003=v10559+3;
+  int v13004=v7840+2;
+  int v13005=v1446+5;
+  int v13006=v402+1;
+  int v13007=v9228+7;
+  int v13008=v12853+4;
+  int v13009=v10832+9;
+  int v13010=v9036+3;
+  int v13011=v2981+9;
+  int v13012=v2142+1;
+  int v13013=v7740+6;
+  int v13014=v826+0;
+  int v13015=v5122+7;
+  int v13016=v8043+8;
+  int v13017=v3766+3;
+  int v13018=v5412+2;
+  int v13019=v11290+7;
+  int v13020=v8022+8;
+  int v13021=v1257+9;
+  int v13022=v3861+1;
+  int v13023=v12103+5;
+  int v13024=v11575+3;
+  int v13025=v6172+1;
+  int v13026=v3044+7;
+  int v13027=v4049+5;
+  int v13028=v10218+1;
+  int v13029=v11469+6;
+  int v13030=v10377+4;
+  int v13031=v227+6;
+  int v13032=v4284+8;
+  int v13033=v12874+0;
+  int v13034=v2537+5;
+  int v13035=v7053+0;
+  int v13036=v12895+9;
+  int v13037=v8206+5;
+  int v13038=v3233+9;
+  int v13039=v7230+6;
+  int v13040=v2145+6;
+  int v13041=v6997+4;
+  int v13042=v4452+2;
+  int v13043=v11161+6;
+  int v13044=v2593+7;
+  int v13045=v9585+5;
+  int v13046=v2194+8;
+  int v13047=v6854+4;
+  int v13048=v6612+7;
+  int v13049=v10610+5;
+  int v13050=v5850+9;
+  int v13051=v1248+5;
+  int v13052=v2327+0;
+  int v13053=v4547+1;
+  int v13054=v8835+4;
+  int v13055=v5138+6;
+  int v13056=v10273+5;
+  int v13057=v8260+0;
+  int v13058=v3500+4;
+  int v13059=v5216+7;
+  int v13060=v7366+4;
+  int v13061=v10721+1;
+  int v13062=v7832+2;
+  int v13063=v9931+4;
+  int v13064=v1911+6;
+  int v13065=v4520+9;
+  int v13066=v721+4;
+  int v13067=v5242+1;
+  int v13068=v11666+5;
+  int v13069=v1514+3;
+  int v13070=v3943+8;
+  int v13071=v7981+0;
+  int v13072=v11587+6;
+  int v13073=v3407+2;
+  int v13074=v6473+7;
+  int v13075=v8935+5;
+  int v13076=v8041+5;
+  int v13077=v11679+2;
+  int v13078=v739+4;
+  int v13079=v391+2;
+  int v13080=v1178+2;
+  int v13081=v11649+0;
+  int v13082=v2316+7;
+  int v13083=v10161+5;
+  int v13084=v3402+5;
+  int v13085=v1815+3;
+  int v13086=v7801+6;
+  int v13087=v7320+4;
+  int v13088=v1848+4;
+  int v13089=v2522+9;
+  int v13090=v12590+5;
+  int v13091=v12151+4;
+  int v13092=v13056+5;
+  int v13093=v2141+3;
+  int v13094=v4552+7;
+  int v13095=v7467+6;
+  int v13096=v1013+5;
+  int v13097=v4632+9;
+  int v13098=v5483+9;
+  int v13099=v7171+9;
+  int v13100=v4154+6;
+  int v13101=v4244+0;
+  int v13102=v3049+2;
+  int v13103=v2311+6;
+  int v13104=v2000+6;
+  int v13105=v6102+0;
+  int v13106=v4870+1;
+  int v13107=v7484+1;
+  int v13108=v11959+4;
+  int v13109=v1230+0;
+  int v13110=v1886+3;
+  int v13111=v1410+3;
+  int v13112=v2490+4;
+  int v13113=v6830+9;
+  int v13114=v652+4;
+  int v13115=v8907+5;
+  int v13116=v3728+7;
+  int v13117=v5810+7;
+  int v13118=v7819+6;
+  int v13119=v11228+1;
+  int v13120=v9299+0;
+  int v13121=v6658+1;
+  int v13122=v5990+7;
+  int v13123=v3142+5;
+  int v13124=v6018+0;
+  int v13125=v6594+5;
+  int v13126=v2934+6;
+  int v13127=v6241+9;
+  int v13128=v10097+5;
+  int v13129=v12555+9;
+  int v13130=v3455+4;
+  int v13131=v3173+5;
+  int v13132=v10745+9;
+  int v13133=v11849+1;
+  int v13134=v11509+6;
+  int v13135=v6766+8;
+  int v13136=v12441+7;
+  int v13137=v1682+6;
+  int v13138=v10670+7;
+  int v13139=v2394+7;
+  int v13140=v4009+3;
+  int v13141=v4324+4;
+  int v13142=v10913+9;
+  int v13143=v8391+7;
+  int v13144=v8014+3;
+  int v13145=v10137+9;
+  int v13146=v12918+6;
+  int v13147=v4362+8;
+  int v13148=v8235+3;
+  int v13149=v4416+7;
+  int v13150=v972+8;
+  int v13151=v3883+1;
+  int v13152=v1831+8;
+  int v13153=v4832+7;
+  int v13154=v10732+3;
+  int v13155=v4622+1;
+  int v13156=v230+1;
+  int v13157=v5724+8;
+  int v13158=v10687+5;
+  int v13159=v1940+5;
+  int v13160=v7972+7;
+  int v13161=v4025+0;
+  int v13162=v1529+4;
+  int v13163=v850+4;
+  int v13164=v8524+1;
+  int v13165=v3330+9;
+  int v13166=v6928+7;
+  int v13167=v11214+8;
+  int v13168=v4272+8;
+  int v13169=v13011+4;
+  int v13170=v623+7;
+  int v13171=v2981+9;
+  int v13172=v6579+2;
+  int v13173=v2981+1;
+  int v13174=v3164+0;
+  int v13175=v12285+2;
+  int v13176=v4502+8;
+  int v13177=v7906+2;
+  int v13178=v8373+0;
+  int v13179=v8052+1;
+  int v13180=v789+9;
+  int v13181=v3032+9;
+  int v13182=v2810+0;
+  int v13183=v8860+7;
+  int v13184=v12295+1;
+  int v13185=v11244+1;
+  int v13186=v9269+3;
+  int v13187=v12726+2;
+  int v13188=v2862+4;
+  int v13189=v11084+2;
+  int v13190=v7862+4;
+  int v13191=v1414+6;
+  int v13192=v4239+0;
+  int v13193=v4015+9;
+  int v13194=v7504+1;
+  int v13195=v3059+5;
+  int v13196=v3915+6;
+  int v13197=v6736+1;
+  int v13198=v5387+9;
+  int v13199=v6294+7;
+  int v13200=v801+4;
+  int v13201=v8059+9;
+  int v13202=v8411+8;
+  int v13203=v11341+6;
+  int v13204=v5727+6;
+  int v13205=v7051+1;
+  int v13206=v6503+8;
+  int v13207=v10917+3;
+  int v13208=v10227+4;
+  int v13209=v915+4;
+  int v13210=v11835+2;
+  int v13211=v5857+5;
+  int v13212=v13054+9;
+  int v13213=v3392+3;
+  int v13214=v3598+6;
+  int v13215=v8739+2;
+  int v13216=v2789+8;
+  int v13217=v3487+4;
+  int v13218=v2299+2;
+  int v13219=v10624+9;
+  int v13220=v12849+3;
+  int v13221=v12234+5;
+  int v13222=v12856+0;
+  int v13223=v4843+6;
+  int v13224=v4232+9;
+  int v13225=v7317+8;
+  int v13226=v11652+1;
+  int v13227=v4129+9;
+  int v13228=v2904+7;
+  int v13229=v11691+6;
+  int v13230=v6856+1;
+  int v13231=v12298+6;
+  int v13232=v7899+3;
+  int v13233=v3480+5;
+  int v13234=v7578+4;
+  int v13235=v201+7;
+  int v13236=v12458+7;
+  int v13237=v7917+7;
+  int v13238=v7647+9;
+  int v13239=v1249+5;
+  int v13240=v6984+0;
+  int v13241=v9944+8;
+  int v13242=v6754+6;
+  int v13243=v11373+6;
+  int v13244=v3645+2;
+  int v13245=v11366+5;
+  int v13246=v7172+2;
+  int v13247=v6867+6;
+  int v13248=v3856+3;
+  int v13249=v302+0;
+  int v13250=v124+6;
+  int v13251=v2335+8;
+  int v13252=v9846+6;
+  int v13253=v11682+5;
+  int v13254=v374+5;
+  int v13255=v10414+4;
+  int v13256=v7938+8;
+  int v13257=v4807+2;
+  int v13258=v12272+7;
+  int v13259=v11066+6;
+  int v13260=v9265+5;
+  int v13261=v1039+3;
+  int v13262=v1186+5;
+  int v13263=v4516+1;
+  int v13264=v7223+1;
+  int v13265=v10910+6;
+  int v13266=v9988+8;
+  int v13267=v8473+7;
+  int v13268=v8555+1;
+  int v13269=v6169+8;
+  int v13270=v10714+4;
+  int v13271=v11383+6;
+  int v13272=v3538+4;
+  int v13273=v5410+3;
+  int v13274=v8092+5;
+  int v13275=v10135+3;
+  int v13276=v5684+0;
+  int v13277=v3331+7;
+  int v13278=v12531+3;
+  int v13279=v349+3;
+  int v13280=v3126+9;
+  int v13281=v1135+4;
+  int v13282=v11754+6;
+  int v13283=v4324+4;
+  int v13284=v9731+7;
+  int v13285=v2855+1;
+  int v13286=v5812+5;
+  int v13287=v7768+2;
+  int v13288=v8824+8;
+  int v13289=v9625+7;
+  int v13290=v7332+2;
+  int v13291=v3958+1;
+  int v13292=v1738+8;
+  int v13293=v9814+4;
+  int v13294=v6855+0;
+  int v13295=v6823+2;
+  int v13296=v7133+7;
+  int v13297=v353+4;
+  int v13298=v6261+4;
+  int v13299=v9631+3;
+  int v13300=v13134+0;
+  int v13301=v2576+1;
+  int v13302=v11438+8;
+  int v13303=v1862+1;
+  int v13304=v8520+2;
+  int v13305=v10704+8;
+  int v13306=v11342+1;
+  int v13307=v770+4;
+  int v13308=v6527+7;
+  int v13309=v13061+9;
+  int v13310=v296+5;
+  int v13311=v10425+4;
+  int v13312=v1314+5;
+  int v13313=v11963+9;
+  int v13314=v5455+6;
+  int v13315=v11450+9;
+  int v13316=v458+8;
+  int v13317=v3268+9;
+  int v13318=v295+7;
+  int v13319=v3411+6;
+  int v13320=v9707+8;
+  int v13321=v4833+8;
+  int v13322=v2292+7;
+  int v13323=v6620+7;
+  int v13324=v4234+5;
+  int v13325=v13008+0;
+  int v13326=v5730+6;
+  int v13327=v1247+0;
+  int v13328=v7830+6;
+  int v13329=v11655+3;
+  int v13330=v8797+6;
+  int v13331=v11296+0;
+  int v13332=v1725+5;
+  int v13333=v420+7;
+  int v13334=v4349+8;
+  int v13335=v7893+1;
+  int v13336=v1051+6;
+  int v13337=v4344+4;
+  int v13338=v7330+0;
+  int v13339=v10043+0;
+  int v13340=v4990+5;
+  int v13341=v2734+7;
+  int v13342=v13269+8;
+  int v13343=v6472+3;
+  int v13344=v12096+8;
+  int v13345=v9046+8;
+  int v13346=v4928+2;
+  int v13347=v5992+3;
+  int v13348=v4468+0;
+  int v13349=v3408+8;
+  int v13350=v176+8;
+  int v13351=v2053+4;
+  int v13352=v2992+5;
+  int v13353=v10487+6;
+  int v13354=v13030+5;
+  int v13355=v10001+3;
+  int v13356=v6131+7;
+  int v13357=v6327+0;
+  int v13358=v9819+7;
+  int v13359=v9366+2;
+  int v13360=v8646+4;
+  int v13361=v9845+0;
+  int v13362=v6093+4;
+  int v13363=v4828+6;
+  int v13364=v4896+3;
+  int v13365=v5905+7;
+  int v13366=v6516+9;
+  int v13367=v6417+2;
+  int v13368=v368+8;
+  int v13369=v13240+3;
+  int v13370=v10147+0;
+  int v13371=v346+8;
+  int v13372=v5223+1;
+  int v13373=v7743+7;
+  int v13374=v2751+1;
+  int v13375=v4576+4;
+  int v13376=v214+3;
+  int v13377=v9326+9;
+  int v13378=v5895+4;
+  int v13379=v11115+5;
+  int v13380=v2238+9;
+  int v13381=v12607+5;
+  int v13382=v8058+9;
+  int v13383=v9252+2;
+  int v13384=v10955+8;
+  int v13385=v3974+6;
+  int v13386=v10375+2;
+  int v13387=v5699+2;
+  int v13388=v10073+8;
+  int v13389=v3210+9;
+  int v13390=v7933+9;
+  int v13391=v10508+1;
+  int v13392=v2831+5;
+  int v13393=v1737+6;
+  int v13394=v1532+6;
+  int v13395=v8595+5;
+  int v13396=v287+5;
+  int v13397=v1696+5;
+  int v13398=v8527+4;
+  int v13399=v4610+7;
+  int v13400=v915+8;
+  int v13401=v5106+7;
+  int v13402=v2022+1;
+  int v13403=v3719+9;
+  int v13404=v2131+5;
+  int v13405=v1840+4;
+  int v13406=v7758+9;
+  int v13407=v7077+8;
+  int v13408=v1419+6;
+  int v13409=v2674+3;
+  int v13410=v24+4;
+  int v13411=v4753+8;
+  int v13412=v1313+6;
+  int v13413=v6292+9;
+  int v13414=v11284+4;
+  int v13415=v2467+9;
+  int v13416=v3953+3;
+  int v13417=v6123+5;
+  int v13418=v11143+7;
+  int v13419=v7529+8;
+  int v13420=v1417+4;
+  int v13421=v12255+4;
+  int v13422=v651+5;
+  int v13423=v112+6;
+  int v13424=v9620+0;
+  int v13425=v10158+4;
+  int v13426=v13186+7;
+  int v13427=v8322+3;
+  int v13428=v4281+6;
+  int v13429=v4091+9;
+  int v13430=v3253+9;
+  int v13431=v4699+4;
+  int v13432=v6550+9;
+  int v13433=v13195+3;
+  int v13434=v7940+5;
+  int v13435=v12005+4;
+  int v13436=v1346+6;
+  int v13437=v7940+4;
+  int v13438=v583+4;
+  int v13439=v2481+5;
+  int v13440=v6819+9;
+  int v13441=v135+4;
+  int v13442=v12397+6;
+  int v13443=v13102+3;
+  int v13444=v12195+9;
+  int v13445=v3985+2;
+  int v13446=v2585+1;
+  int v13447=v4868+1;
+  int v13448=v9146+5;
+  int v13449=v11616+8;
+  int v13450=v4857+5;
+  int v13451=v3720+8;
+  int v13452=v5871+9;
+  int v13453=v12908+8;
+  int v13454=v856+9;
+  int v13455=v10511+2;
+  int v13456=v100+1;
+  int v13457=v1887+0;
+  int v13458=v1283+4;
+  int v13459=v5984+9;
+  int v13460=v5948+2;
+  int v13461=v4820+6;
+  int v13462=v5406+9;
+  int v13463=v10984+4;
+  int v13464=v4120+0;
+  int v13465=v2371+5;
+  int v13466=v786+3;
+  int v13467=v13247+3;
+  int v13468=v9067+9;
+  int v13469=v4912+0;
+  int v13470=v5058+7;
+  int v13471=v10171+7;
+  int v13472=v6241+4;
+  int v13473=v709+7;
+  int v13474=v3148+1;
+  int v13475=v9767+9;
+  int v13476=v7331+0;
+  int v13477=v5482+4;
+  int v13478=v4312+4;
+  int v13479=v6987+1;
+  int v13480=v5788+7;
+  int v13481=v3590+4;
+  int v13482=v587+0;
+  int v13483=v4733+8;
+  int v13484=v12721+1;
+  int v13485=v7838+2;
+  int v13486=v9667+3;
+  int v13487=v735+1;
+  int v13488=v5291+8;
+  int v13489=v1695+2;
+  int v13490=v9439+6;
+  int v13491=v11563+1;
+  int v13492=v9064+6;
+  int v13493=v5874+8;
+  int v13494=v2085+9;
+  int v13495=v6060+7;
+  int v13496=v3335+7;
+  int v13497=v999+3;
+  int v13498=v3381+0;
+  int v13499=v11937+1;
+  int v13500=v12674+0;
+  int v13501=v982+9;
+  int v13502=v8161+3;
+  int v13503=v12672+0;
+  int v13504=v6564+5;
+  int v13505=v6805+3;
+  int v13506=v9929+2;
+  int v13507=v540+4;
+  int v13508=v11963+7;
+  int v13509=v12761+6;
+  int v13510=v8050+9;
+  int v13511=v12149+5;
+  int v13512=v1245+3;
+  int v13513=v11548+4;
+  int v13514=v4782+4;
+  int v13515=v5726+9;
+  int v13516=v11539+4;
+  int v13517=v8154+6;
+  int v13518=v2740+0;
+  int v13519=v4196+4;
+  int v13520=v5798+7;
+  int v13521=v1507+7;
+  int v13522=v1653+1;
+  int v13523=v7446+9;
+  int v13524=v8081+4;
+  int v13525=v13028+0;
+  int v13526=v1088+1;
+  int v13527=v6702+5;
+  int v13528=v10872+2;
+  int v13529=v12898+9;
+  int v13530=v8787+5;
+  int v13531=v12920+9;
+  int v13532=v10888+8;
+  int v13533=v5302+8;
+  int v13534=v12068+9;
+  int v13535=v839+5;
+  int v13536=v7757+2;
+  int v13537=v11361+8;
+  int v13538=v8257+8;
+  int v13539=v8945+5;
+  int v13540=v2824+2;
+  int v13541=v3016+3;
+  int v13542=v1339+6;
+  int v13543=v4619+2;
+  int v13544=v7224+5;
+  int v13545=v3097+2;
+  int v13546=v7140+5;
+  int v13547=v8342+0;
+  int v13548=v4171+6;
+  int v13549=v9697+3;
+  int v13550=v7087+2;
+  int v13551=v7269+0;
+  int v13552=v10783+4;
+  int v13553=v12398+9;
+  int v13554=v12650+9;
+  int v13555=v6005+0;
+  int v13556=v5692+1;
+  int v13557=v6745+2;
+  int v13558=v11434+4;
+  int v13559=v11818+5;
+  int v13560=v6356+8;
+  int v13561=v7927+5;
+  int v13562=v3607+7;
+  int v13563=v3790+0;
+  int v13564=v11176+7;
+  int v13565=v6642+3;
+  int v13566=v8636+5;
+  int v13567=v11526+3;
+  int v13568=v8663+6;
+  int v13569=v12558+4;
+  int v13570=v10942+2;
+  int v13571=v9339+1;
+  int v13572=v7975+9;
+  int v13573=v7223+8;
+  int v13574=v12385+7;
+  int v13575=v10244+1;
+  int v13576=v1950+0;
+  int v13577=v2362+6;
+  int v13578=v5757+8;
+  int v13579=v4067+5;
+  int v13580=v9867+8;
+  int v13581=v7869+5;
+  int v13582=v12935+5;
+  int v13583=v1055+2;
+  int v13584=v5405+5;
+  int v13585=v7369+9;
+  int v13586=v8131+6;
+  int v13587=v9379+6;
+  int v13588=v8979+2;
+  int v13589=v675+0;
+  int v13590=v8609+5;
+  int v13591=v9713+9;
+  int v13592=v7573+5;
+  int v13593=v6466+2;
+  int v13594=v7333+2;
+  int v13595=v12860+2;
+  int v13596=v3284+3;
+  int v13597=v8515+0;
+  int v13598=v5165+6;
+  int v13599=v785+9;
+  int v13600=v9310+3;
+  int v13601=v11752+9;
+  int v13602=v9293+4;
+  int v13603=v11304+6;
+  int v13604=v9132+6;
+  int v13605=v13267+6;
+  int v13606=v5392+5;
+  int v13607=v829+3;
+  int v13608=v1470+9;
+  int v13609=v12665+2;
+  int v13610=v9775+7;
+  int v13611=v735+6;
+  int v13612=v8979+2;
+  int v13613=v6037+9;
+  int v13614=v12727+3;
+  int v13615=v2093+3;
+  int v13616=v4886+6;
+  int v13617=v168+9;
+  int v13618=v10182+0;
+  int v13619=v11321+9;
+  int v13620=v345+7;
+  int v13621=v1262+4;
+  int v13622=v272+5;
+  int v13623=v6525+8;
+  int v13624=v7416+7;
+  int v13625=v767+5;
+  int v13626=v7849+1;
+  int v13627=v1230+3;
+  int v13628=v1291+3;
+  int v13629=v273+8;
+  int v13630=v6264+8;
+  int v13631=v9780+4;
+  int v13632=v10522+7;
+  int v13633=v7154+2;
+  int v13634=v13099+0;
+  int v13635=v8122+7;
+  int v13636=v12227+0;
+  int v13637=v12935+9;
+  int v13638=v5172+9;
+  int v13639=v4930+3;
+  int v13640=v9687+6;
+  int v13641=v5132+7;
+  int v13642=v4400+6;
+  int v13643=v478+4;
+  int v13644=v12837+4;
+  int v13645=v8585+1;
+  int v13646=v3225+3;
+  int v13647=v128+2;
+  int v13648=v4047+6;
+  int v13649=v3731+5;
+  int v13650=v1790+7;
+  int v13651=v11195+0;
+  int v13652=v13501+5;
+  int v13653=v7585+5;
+  int v13654=v8623+9;
+  int v13655=v7947+4;
+  int v13656=v7555+3;
+  int v13657=v7052+9;
+  int v13658=v2422+1;
+  int v13659=v2859+1;
+  int v13660=v10758+1;
+  int v13661=v8029+0;
+  int v13662=v9068+5;
+  int v13663=v5103+7;
+  int v13664=v4611+0;
+  int v13665=v4280+5;
+  int v13666=v4778+1;
+  int v13667=v4946+1;
+  int v13668=v4899+0;
+  int v13669=v5247+6;
+  int v13670=v3506+0;
+  int v13671=v6633+6;
+  int v13672=v7348+8;
+  int v13673=v70+5;
+  int v13674=v1811+8;
+  int v13675=v1889+8;
+  int v13676=v10031+1;
+  int v13677=v218+3;
+  int v13678=v1998+2;
+  int v13679=v8593+2;
+  int v13680=v281+1;
+  int v13681=v8950+1;
+  int v13682=v1157+1;
+  int v13683=v12418+7;
+  int v13684=v6755+4;
+  int v13685=v5715+2;
+  int v13686=v4346+2;
+  int v13687=v11255+3;
+  int v13688=v480+5;
+  int v13689=v5033+4;
+  int v13690=v12316+0;
+  int v13691=v13516+9;
+  int v13692=v1751+8;
+  int v13693=v7133+6;
+  int v13694=v10491+0;
+  int v13695=v11596+8;
+  int v13696=v4398+3;
+  int v13697=v2468+9;
+  int v13698=v11341+3;
+  int v13699=v12731+0;
+  int v13700=v10871+7;
+  int v13701=v457+9;
+  int v13702=v7437+6;
+  int v13703=v9675+1;
+  int v13704=v5943+0;
+  int v13705=v11646+8;
+  int v13706=v4526+9;
+  int v13707=v6361+5;
+  int v13708=v5059+6;
+  int v13709=v8436+0;
+  int v13710=v8011+7;
+  int v13711=v1832+6;
+  int v13712=v9349+6;
+  int v13713=v9898+0;
+  int v13714=v13339+2;
+  int v13715=v7601+0;
+  int v13716=v66+7;
+  int v13717=v3696+4;
+  int v13718=v11394+4;
+  int v13719=v10368+7;
+  int v13720=v13360+7;
+  int v13721=v1476+9;
+  int v13722=v13251+8;
+  int v13723=v10091+8;
+  int v13724=v6553+7;
+  int v13725=v7606+0;
+  int v13726=v6363+0;
+  int v13727=v8407+7;
+  int v13728=v9582+5;
+  int v13729=v11589+1;
+  int v13730=v11594+5;
+  int v13731=v3350+9;
+  int v13732=v7773+9;
+  int v13733=v6061+8;
+  int v13734=v12845+7;
+  int v13735=v4514+1;
+  int v13736=v3367+0;
+  int v13737=v12389+0;
+  int v13738=v6976+0;
+  int v13739=v9813+3;
+  int v13740=v595+5;
+  int v13741=v5696+6;
+  int v13742=v10117+1;
+  int v13743=v9028+2;
+  int v13744=v9345+9;
+  int v13745=v421+5;
+  int v13746=v9518+3;
+  int v13747=v8131+6;
+  int v13748=v8313+2;
+  int v13749=v4876+7;
+  int v13750=v3425+0;
+  int v13751=v13292+7;
+  int v13752=v7354+4;
+  int v13753=v4379+4;
+  int v13754=v9683+3;
+  int v13755=v5082+0;
+  int v13756=v4403+0;
+  int v13757=v10826+3;
+  int v13758=v12373+7;
+  int v13759=v5553+9;
+  int v13760=v5429+5;
+  int v13761=v11458+0;
+  int v13762=v12215+2;
+  int v13763=v251+3;
+  int v13764=v10986+7;
+  int v13765=v7736+6;
+  int v13766=v6295+5;
+  int v13767=v9541+4;
+  int v13768=v3707+2;
+  int v13769=v7917+1;
+  int v13770=v2807+9;
+  int v13771=v9036+8;
+  int v13772=v197+0;
+  int v13773=v12880+4;
+  int v13774=v1786+1;
+  int v13775=v13371+9;
+  int v13776=v5947+1;
+  int v13777=v10101+8;
+  int v13778=v9293+3;
+  int v13779=v674+0;
+  int v13780=v11572+3;
+  int v13781=v9585+9;
+  int v13782=v12458+3;
+  int v13783=v13264+8;
+  int v13784=v2715+2;
+  int v13785=v1878+6;
+  int v13786=v3301+8;
+  int v13787=v6500+1;
+  int v13788=v9317+4;
+  int v13789=v6729+2;
+  int v13790=v8325+4;
+  int v13791=v9846+7;
+  int v13792=v13491+5;
+  int v13793=v6777+0;
+  int v13794=v10322+0;
+  int v13795=v2691+7;
+  int v13796=v3528+9;
+  int v13797=v13582+4;
+  int v13798=v10476+7;
+  int v13799=v10206+6;
+  int v13800=v1664+9;
+  int v13801=v10579+2;
+  int v13802=v3012+9;
+  int v13803=v3820+9;
+  int v13804=v13362+8;
+  int v13805=v863+6;
+  int v13806=v2196+7;
+  int v13807=v2092+5;
+  int v13808=v3068+6;
+  int v13809=v4179+1;
+  int v13810=v11611+7;
+  int v13811=v7374+2;
+  int v13812=v3266+8;
+  int v13813=v12270+2;
+  int v13814=v7371+5;
+  int v13815=v235+7;
+  int v13816=v9078+4;
+  int v13817=v12771+6;
+  int v13818=v12883+4;
+  int v13819=v10555+7;
+  int v13820=v5232+5;
+  int v13821=v728+4;
+  int v13822=v4640+3;
+  int v13823=v7388+6;
+  int v13824=v10037+9;
+  int v13825=v620+9;
+  int v13826=v7013+6;
+  int v13827=v7784+9;
+  int v13828=v11278+2;
+  int v13829=v12611+7;
+  int v13830=v12107+9;
+  int v13831=v3561+9;
+  int v13832=v302+6;
+  int v13833=v12952+2;
+  int v13834=v53+4;
+  int v13835=v13286+0;
+  int v13836=v4642+7;
+  int v13837=v9955+9;
+  int v13838=v1578+4;
+  int v13839=v10079+4;
+  int v13840=v8542+9;
+  int v13841=v11108+1;
+  int v13842=v8847+1;
+  int v13843=v8680+4;
+  int v13844=v13268+3;
+  int v13845=v12271+2;
+  int v13846=v7430+0;
+  int v13847=v8802+7;
+  int v13848=v10614+0;
+  int v13849=v7196+6;
+  int v13850=v2779+0;
+  int v13851=v7514+6;
+  int v13852=v10466+8;
+  int v13853=v11151+3;
+  int v13854=v7539+3;
+  int v13855=v7166+4;
+  int v13856=v9064+1;
+  int v13857=v8031+0;
+  int v13858=v11298+8;
+  int v13859=v5217+7;
+  int v13860=v10234+3;
+  int v13861=v3104+7;
+  int v13862=v2881+2;
+  int v13863=v150+8;
+  int v13864=v6023+8;
+  int v13865=v10372+8;
+  int v13866=v9166+3;
+  int v13867=v4764+4;
+  int v13868=v211+3;
+  int v13869=v7365+1;
+  int v13870=v5805+7;
+  int v13871=v10310+2;
+  int v13872=v10247+7;
+  int v13873=v7949+2;
+  int v13874=v3356+1;
+  int v13875=v3404+0;
+  int v13876=v10182+5;
+  int v13877=v5309+0;
+  int v13878=v13226+3;
+  int v13879=v6925+6;
+  int v13880=v2784+2;
+  int v13881=v6863+2;
+  int v13882=v3028+8;
+  int v13883=v7210+4;
+  int v13884=v1337+4;
+  int v13885=v11473+8;
+  int v13886=v4112+5;
+  int v13887=v11208+9;
+  int v13888=v5141+9;
+  int v13889=v691+5;
+  int v13890=v12955+3;
+  int v13891=v9580+7;
+  int v13892=v12997+5;
+  int v13893=v2017+8;
+  int v13894=v3650+0;
+  int v13895=v369+1;
+  int v13896=v1626+3;
+  int v13897=v13304+8;
+  int v13898=v8759+0;
+  int v13899=v10215+2;
+  int v13900=v2263+1;
+  int v13901=v875+5;
+  int v13902=v6761+2;
+  int v13903=v8998+5;
+  int v13904=v11405+4;
+  int v13905=v9778+2;
+  int v13906=v1401+4;
+  int v13907=v5733+1;
+  int v13908=v12103+6;
+  int v13909=v7925+2;
+  int v13910=v7482+3;
+  int v13911=v4923+2;
+  int v13912=v9404+2;
+  int v13913=v7005+8;
+  int v13914=v8326+0;
+  int v13915=v13085+3;
+  int v13916=v10749+3;
+  int v13917=v5161+8;
+  int v13918=v1016+9;
+  int v13919=v950+1;
+  int v13920=v10053+0;
+  int v13921=v54+6;
+  int v13922=v4862+5;
+  int v13923=v13288+9;
+  int v13924=v1304+8;
+  int v13925=v5441+7;
+  int v13926=v501+3;
+  int v13927=v6870+1;
+  int v13928=v403+2;
+  int v13929=v6285+4;
+  int v13930=v9453+0;
+  int v13931=v8733+1;
+  int v13932=v8358+5;
+  int v13933=v11226+4;
+  int v13934=v11140+1;
+  int v13935=v2227+2;
+  int v13936=v10483+9;
+  int v13937=v9917+4;
+  int v13938=v9887+7;
+  int v13939=v7970+1;
+  int v13940=v2361+7;
+  int v13941=v3142+5;
+  int v13942=v9557+2;
+  int v13943=v13178+1;
+  int v13944=v5060+4;
+  int v13945=v9914+2;
+  int v13946=v10236+1;
+  int v13947=v6687+1;
+  int v13948=v1486+8;
+  int v13949=v4545+5;
+  int v13950=v5459+8;
+  int v13951=v370+9;
+  int v13952=v6941+3;
+  int v13953=v1035+9;
+  int v13954=v485+3;
+  int v13955=v1857+4;
+  int v13956=v5353+1;
+  int v13957=v1631+8;
+  int v13958=v1596+7;
+  int v13959=v7729+3;
+  int v13960=v11884+2;
+  int v13961=v7449+9;
+  int v13962=v12785+6;
+  int v13963=v9881+8;
+  int v13964=v2061+3;
+  int v13965=v13738+5;
+  int v13966=v6606+9;
+  int v13967=v5810+8;
+  int v13968=v9163+9;
+  int v13969=v9669+6;
+  int v13970=v7384+5;
+  int v13971=v9446+5;
+  int v13972=v1198+1;
+  int v13973=v1008+0;
+  int v13974=v3047+7;
+  int v13975=v13520+0;
+  int v13976=v939+8;
+  int v13977=v9442+7;
+  int v13978=v11590+3;
+  int v13979=v10495+0;
+  int v13980=v12275+2;
+  int v13981=v5887+0;
+  int v13982=v7129+0;
+  int v13983=v4609+1;
+  int v13984=v11363+1;
+  int v13985=v3108+8;
+  int v13986=v7709+0;
+  int v13987=v13298+6;
+  int v13988=v4775+1;
+  int v13989=v3106+6;
+  int v13990=v13228+9;
+  int v13991=v10031+0;
+  int v13992=v1240+6;
+  int v13993=v7350+3;
+  int v13994=v8929+9;
+  int v13995=v9564+0;
+  int v13996=v10812+8;
+  int v13997=v9056+2;
+  int v13998=v3960+3;
+  int v13999=v13929+8;
+  int v14000=v5747+5;
+  int v14001=v2051+1;
+  int v14002=v9317+2;
+  int v14003=v11867+5;
+  int v14004=v5397+7;
+  int v14005=v7339+5;
+  int v14006=v2415+9;
+  int v14007=v10072+3;
+  int v14008=v12872+0;
+  int v14009=v13002+1;
+  int v14010=v6492+2;
+  int v14011=v12401+2;
+  int v14012=v1774+7;
+  int v14013=v2885+2;
+  int v14014=v893+9;
+  int v14015=v2368+4;
+  int v14016=v312+9;
+  int v14017=v9762+0;
+  int v14018=v8743+0;
+  int v14019=v3136+0;
+  int v14020=v3639+9;
+  int v14021=v7484+3;
+  int v14022=v13179+9;
+  int v14023=v95+3;
+  int v14024=v10684+5;
+  int v14025=v10141+8;
+  int v14026=v4543+4;
+  int v14027=v7559+2;
+  int v14028=v1079+3;
+  int v14029=v7251+3;
+  int v14030=v1554+5;
+  int v14031=v654+6;
+  int v14032=v12585+6;
+  int v14033=v6351+8;
+  int v14034=v11640+7;
+  int v14035=v10897+0;
+  int v14036=v1848+6;
+  int v14037=v3548+7;
+  int v14038=v5010+2;
+  int v14039=v5814+3;
+  int v14040=v12138+6;
+  int v14041=v771+8;
+  int v14042=v6618+4;
+  int v14043=v10448+6;
+  int v14044=v3393+5;
+  int v14045=v12266+0;
+  int v14046=v11080+7;
+  int v14047=v8128+4;
+  int v14048=v2174+4;
+  int v14049=v14045+4;
+  int v14050=v3399+0;
+  int v14051=v4548+9;
+  int v14052=v7380+8;
+  int v14053=v7144+8;
+  int v14054=v3579+0;
+  int v14055=v4631+0;
+  int v14056=v4782+4;
+  int v14057=v3007+5;
+  int v14058=v11058+9;
+  int v14059=v5555+0;
+  int v14060=v9700+1;
+  int v14061=v3868+9;
+  int v14062=v7099+2;
+  int v14063=v2985+2;
+  int v14064=v426+0;
+  int v14065=v12451+2;
+  int v14066=v1123+5;
+  int v14067=v1750+9;
+  int v14068=v9678+5;
+  int v14069=v4386+9;
+  int v14070=v4988+2;
+  int v14071=v1328+3;
+  int v14072=v2965+4;
+  int v14073=v2192+0;
+  int v14074=v6437+3;
+  int v14075=v7419+7;
+  int v14076=v9761+0;
+  int v14077=v9018+2;
+  int v14078=v13464+0;
+  int v14079=v2504+7;
+  int v14080=v12340+2;
+  int v14081=v7880+5;
+  int v14082=v1544+3;
+  int v14083=v12971+9;
+  int v14084=v8502+5;
+  int v14085=v4853+9;
+  int v14086=v7619+2;
+  int v14087=v2361+4;
+  int v14088=v6954+5;
+  int v14089=v5502+5;
+  int v14090=v9743+8;
+  int v14091=v2396+9;
+  int v14092=v8370+1;
+  int v14093=v100+6;
+  int v14094=v6138+6;
+  int v14095=v8253+9;
+  int v14096=v9983+7;
+  int v14097=v6900+3;
+  int v14098=v2650+5;
+  int v14099=v8812+9;
+  int v14100=v13655+4;
+  int v14101=v3792+4;
+  int v14102=v8825+0;
+  int v14103=v12425+1;
+  int v14104=v980+0;
+  int v14105=v13418+7;
+  int v14106=v11314+8;
+  int v14107=v5482+3;
+  int v14108=v3567+6;
+  int v14109=v4930+0;
+  int v14110=v9541+6;
+  int v14111=v119+8;
+  int v14112=v1045+9;
+  int v14113=v1971+6;
+  int v14114=v13272+1;
+  int v14115=v6224+9;
+  int v14116=v237+5;
+  int v14117=v9110+5;
+  int v14118=v4487+2;
+  int v14119=v4646+1;
+  int v14120=v8097+3;
+  int v14121=v8093+1;
+  int v14122=v3020+0;
+  int v14123=v7377+9;
+  int v14124=v10806+8;
+  int v14125=v6142+7;
+  int v14126=v10187+2;
+  int v14127=v5925+3;
+  int v14128=v8031+4;
+  int v14129=v9955+9;
+  int v14130=v9848+4;
+  int v14131=v5764+3;
+  int v14132=v4616+3;
+  int v14133=v4558+5;
+  int v14134=v9162+9;
+  int v14135=v1315+2;
+  int v14136=v5974+3;
+  int v14137=v11761+3;
+  int v14138=v3175+1;
+  int v14139=v11415+1;
+  int v14140=v7523+2;
+  int v14141=v6870+6;
+  int v14142=v8475+2;
+  int v14143=v8797+5;
+  int v14144=v4798+8;
+  int v14145=v10414+8;
+  int v14146=v12650+9;
+  int v14147=v2777+0;
+  int v14148=v11080+7;
+  int v14149=v5067+3;
+  int v14150=v9100+9;
+  int v14151=v10176+9;
+  int v14152=v9738+4;
+  int v14153=v13824+2;
+  int v14154=v11524+6;
+  int v14155=v6600+3;
+  int v14156=v11234+4;
+  int v14157=v8089+3;
+  int v14158=v8655+5;
+  int v14159=v399+8;
+  int v14160=v13810+9;
+  int v14161=v1423+7;
+  int v14162=v8298+0;
+  int v14163=v7576+8;
+  int v14164=v13878+1;
+  int v14165=v5642+7;
+  int v14166=v6060+9;
+  int v14167=v3188+5;
+  int v14168=v13091+2;
+  int v14169=v2160+7;
+  int v14170=v8547+0;
+  int v14171=v13210+2;
+  int v14172=v8954+8;
+  int v14173=v8270+7;
+  int v14174=v12787+1;
+  int v14175=v13488+0;
+  int v14176=v10343+1;
+  int v14177=v6085+8;
+  int v14178=v13407+8;
+  int v14179=v2529+1;
+  int v14180=v8081+0;
+  int v14181=v1079+6;
+  int v14182=v728+0;
+  int v14183=v11082+7;
+  int v14184=v1715+0;
+  int v14185=v992+3;
+  int v14186=v12765+5;
+  int v14187=v11075+9;
+  int v14188=v10198+2;
+  int v14189=v12887+2;
+  int v14190=v5779+1;
+  int v14191=v7654+9;
+  int v14192=v4171+0;
+  int v14193=v11689+0;
+  int v14194=v374+5;
+  int v14195=v5183+9;
+  int v14196=v10315+7;
+  int v14197=v11911+2;
+  int v14198=v12268+3;
+  int v14199=v5519+8;
+  int v14200=v5815+1;
+  int v14201=v11822+1;
+  int v14202=v10448+9;
+  int v14203=v12284+3;
+  int v14204=v13689+1;
+  int v14205=v1413+4;
+  int v14206=v2611+9;
+  int v14207=v10305+3;
+  int v14208=v7528+3;
+  int v14209=v5958+1;
+  int v14210=v5875+2;
+  int v14211=v8476+6;
+  int v14212=v3666+1;
+  int v14213=v9825+5;
+  int v14214=v11875+4;
+  int v14215=v6891+7;
+  int v14216=v8785+3;
+  int v14217=v9826+8;
+  int v14218=v10529+7;
+  int v14219=v7185+9;
+  int v14220=v7759+1;
+  int v14221=v13947+8;
+  int v14222=v8344+2;
+  int v14223=v13704+0;
+  int v14224=v1084+9;
+  int v14225=v10669+3;
+  int v14226=v13641+6;
+  int v14227=v11738+2;
+  int v14228=v12343+3;
+  int v14229=v9570+4;
+  int v14230=v2474+6;
+  int v14231=v11647+3;
+  int v14232=v12621+3;
+  int v14233=v12304+5;
+  int v14234=v9286+5;
+  int v14235=v1906+8;
+  int v14236=v8856+8;
+  int v14237=v1608+1;
+  int v14238=v9748+6;
+  int v14239=v10976+2;
+  int v14240=v1622+3;
+  int v14241=v9275+6;
+  int v14242=v13292+8;
+  int v14243=v11356+0;
+  int v14244=v10602+6;
+  int v14245=v9197+9;
+  int v14246=v8148+3;
+  int v14247=v8918+4;
+  int v14248=v8932+8;
+  int v14249=v7029+5;
+  int v14250=v5+9;
+  int v14251=v1504+9;
+  int v14252=v1480+1;
+  int v14253=v4103+0;
+  int v14254=v10066+9;
+  int v14255=v10087+9;
+  int v14256=v10759+2;
+  int v14257=v13841+1;
+  int v14258=v5642+4;
+  int v14259=v2898+3;
+  int v14260=v13185+6;
+  int v14261=v4251+8;
+  int v14262=v418+2;
+  int v14263=v6676+1;
+  int v14264=v10647+6;
+  int v14265=v8520+3;
+  int v14266=v2950+2;
+  int v14267=v11926+2;
+  int v14268=v11892+2;
+  int v14269=v7130+8;
+  int v14270=v6234+2;
+  int v14271=v7350+0;
+  int v14272=v2660+7;
+  int v14273=v12155+4;
+  int v14274=v8221+3;
+  int v14275=v1803+0;
+  int v14276=v11291+9;
+  int v14277=v4984+3;
+  int v14278=v7881+8;
+  int v14279=v13412+8;
+  int v14280=v4117+9;
+  int v14281=v4808+5;
+  int v14282=v14100+4;
+  int v14283=v4782+9;
+  int v14284=v7349+6;
+  int v14285=v12783+9;
+  int v14286=v13842+3;
+  int v14287=v14138+1;
+  int v14288=v7369+9;
+  int v14289=v8460+6;
+  int v14290=v4200+7;
+  int v14291=v8285+4;
+  int v14292=v6217+5;
+  int v14293=v10038+1;
+  int v14294=v12419+5;
+  int v14295=v11704+6;
+  int v14296=v9827+4;
+  int v14297=v8667+6;
+  int v14298=v14051+0;
+  int v14299=v12641+1;
+  int v14300=v1563+2;
+  int v14301=v13487+2;
+  int v14302=v12154+1;
+  int v14303=v12299+1;
+  int v14304=v9541+6;
+  int v14305=v10945+5;
+  int v14306=v4240+0;
+  int v14307=v3266+5;
+  int v14308=v6472+2;
+  int v14309=v8573+7;
+  int v14310=v11536+7;
+  int v14311=v8550+5;
+  int v14312=v10947+5;
+  int v14313=v13073+4;
+  int v14314=v11227+9;
+  int v14315=v4729+3;
+  int v14316=v8811+9;
+  int v14317=v10620+4;
+  int v14318=v9128+9;
+  int v14319=v1067+0;
+  int v14320=v10080+7;
+  int v14321=v5145+5;
+  int v14322=v4484+1;
+  int v14323=v10529+1;
+  int v14324=v5998+0;
+  int v14325=v4084+0;
+  int v14326=v3692+0;
+  int v14327=v6264+1;
+  int v14328=v5158+1;
+  int v14329=v2601+8;
+  int v14330=v4257+4;
+  int v14331=v9879+8;
+  int v14332=v8174+0;
+  int v14333=v6053+8;
+  int v14334=v8512+1;
+  int v14335=v9539+3;
+  int v14336=v9672+6;
+  int v14337=v10171+0;
+  int v14338=v11280+9;
+  int v14339=v10042+3;
+  int v14340=v13173+3;
+  int v14341=v11006+5;
+  int v14342=v12284+7;
+  int v14343=v3434+5;
+  int v14344=v4729+7;
+  int v14345=v12557+9;
+  int v14346=v754+0;
+  int v14347=v11594+2;
+  int v14348=v14166+0;
+  int v14349=v5849+6;
+  int v14350=v10740+9;
+  int v14351=v2125+0;
+  int v14352=v13318+0;
+  int v14353=v13389+7;
+  int v14354=v14048+1;
+  int v14355=v8672+2;
+  int v14356=v9590+8;
+  int v14357=v3194+0;
+  int v14358=v7578+3;
+  int v14359=v11206+6;
+  int v14360=v6421+3;
+  int v14361=v1442+3;
+  int v14362=v12699+3;
+  int v14363=v2787+7;
+  int v14364=v1922+4;
+  int v14365=v8585+6;
+  int v14366=v13786+0;
+  int v14367=v6846+9;
+  int v14368=v6011+9;
+  int v14369=v2511+3;
+  int v14370=v3751+6;
+  int v14371=v1163+3;
+  int v14372=v2922+2;
+  int v14373=v5210+2;
+  int v14374=v6767+3;
+  int v14375=v8503+2;
+  int v14376=v1737+7;
+  int v14377=v8157+2;
+  int v14378=v10761+5;
+  int v14379=v12422+1;
+  int v14380=v3253+5;
+  int v14381=v1749+2;
+  int v14382=v8792+0;
+  int v14383=v12584+1;
+  int v14384=v5301+8;
+  int v14385=v14290+5;
+  int v14386=v3038+0;
+  int v14387=v5615+7;
+  int v14388=v3970+6;
+  int v14389=v906+9;
+  int v14390=v6306+0;
+  int v14391=v7862+9;
+  int v14392=v5688+2;
+  int v14393=v10688+0;
+  int v14394=v11251+1;
+  int v14395=v3425+0;
+  int v14396=v9749+7;
+  int v14397=v14231+1;
+  int v14398=v10283+8;
+  int v14399=v13607+3;
+  int v14400=v1034+2;
+  int v14401=v8253+7;
+  int v14402=v8284+5;
+  int v14403=v9725+6;
+  int v14404=v1201+4;
+  int v14405=v6114+9;
+  int v14406=v6630+0;
+  int v14407=v5673+0;
+  int v14408=v12014+1;
+  int v14409=v4542+2;
+  int v14410=v9501+9;
+  int v14411=v12291+8;
+  int v14412=v11387+9;
+  int v14413=v13072+1;
+  int v14414=v7583+9;
+  int v14415=v8248+1;
+  int v14416=v13538+4;
+  int v14417=v3452+9;
+  int v14418=v13421+1;
+  int v14419=v12814+3;
+  int v14420=v1748+0;
+  int v14421=v13267+0;
+  int v14422=v9323+9;
+  int v14423=v11521+3;
+  int v14424=v9367+3;
+  int v14425=v4554+8;
+  int v14426=v7661+4;
+  int v14427=v3946+5;
+  int v14428=v1144+7;
+  int v14429=v8743+2;
+  int v14430=v7779+3;
+  int v14431=v12411+8;
+  int v14432=v6111+0;
+  int v14433=v14106+9;
+  int v14434=v5371+9;
+  int v14435=v6366+9;
+  int v14436=v3652+8;
+  int v14437=v3556+7;
+  int v14438=v11276+1;
+  int v14439=v1977+1;
+  int v14440=v6805+7;
+  int v14441=v9601+3;
+  int v14442=v2361+8;
+  int v14443=v11488+4;
+  int v14444=v4971+1;
+  int v14445=v4885+0;
+  int v14446=v6055+1;
+  int v14447=v6404+6;
+  int v14448=v4613+2;
+  int v14449=v8633+8;
+  int v14450=v4175+6;
+  int v14451=v6599+7;
+  int v14452=v12840+8;
+  int v14453=v12071+2;
+  int v14454=v1793+8;
+  int v14455=v8983+9;
+  int v14456=v12960+9;
+  int v14457=v9129+3;
+  int v14458=v10601+8;
+  int v14459=v6337+4;
+  int v14460=v7762+0;
+  int v14461=v3317+4;
+  int v14462=v12126+1;
+  int v14463=v1224+3;
+  int v14464=v12291+6;
+  int v14465=v10425+4;
+  int v14466=v3886+0;
+  int v14467=v5757+7;
+  int v14468=v8810+7;
+  int v14469=v7479+4;
+  int v14470=v5887+6;
+  int v14471=v9540+4;
+  int v14472=v8898+4;
+  int v14473=v6016+0;
+  int v14474=v1853+2;
+  int v14475=v10342+2;
+  int v14476=v9912+0;
+  int v14477=v5306+7;
+  int v14478=v2483+3;
+  int v14479=v13583+0;
+  int v14480=v1215+4;
+  int v14481=v2501+1;
+  int v14482=v13938+5;
+  int v14483=v4278+5;
+  int v14484=v6051+3;
+  int v14485=v12228+7;
+  int v14486=v13389+8;
+  int v14487=v9753+0;
+  int v14488=v7471+6;
+  int v14489=v10005+3;
+  int v14490=v9177+5;
+  int v14491=v713+3;
+  int v14492=v8208+3;
+  int v14493=v11456+1;
+  int v14494=v4295+1;
+  int v14495=v10234+2;
+  int v14496=v5436+2;
+  int v14497=v2757+0;
+  int v14498=v2465+2;
+  int v14499=v5741+8;
+  int v14500=v13734+1;
+  int v14501=v7718+2;
+  int v14502=v1710+3;
+  int v14503=v1253+9;
+  int v14504=v770+7;
+  int v14505=v14022+2;
+  int v14506=v13490+0;
+  int v14507=v11310+1;
+  int v14508=v1716+4;
+  int v14509=v2790+4;
+  int v14510=v10034+2;
+  int v14511=v14161+7;
+  int v14512=v3235+2;
+  int v14513=v5968+9;
+  int v14514=v5808+8;
+  int v14515=v8176+5;
+  int v14516=v9372+7;
+  int v14517=v2472+9;
+  int v14518=v9700+2;
+  int v14519=v3049+4;
+  int v14520=v11165+8;
+  int v14521=v13463+1;
+  int v14522=v9548+3;
+  int v14523=v663+9;
+  int v14524=v8912+7;
+  int v14525=v13242+0;
+  int v14526=v12889+5;
+  int v14527=v443+3;
+  int v14528=v942+6;
+  int v14529=v12654+4;
+  int v14530=v8975+0;
+  int v14531=v9233+0;
+  int v14532=v4485+2;
+  int v14533=v11589+9;
+  int v14534=v7774+2;
+  int v14535=v1743+2;
+  int v14536=v1957+2;
+  int v14537=v7362+0;
+  int v14538=v5781+1;
+  int v14539=v6670+4;
+  int v14540=v12314+0;
+  int v14541=v10259+6;
+  int v14542=v6318+3;
+  int v14543=v9954+7;
+  int v14544=v7056+7;
+  int v14545=v13640+7;
+  int v14546=v11208+8;
+  int v14547=v3369+9;
+  int v14548=v9064+8;
+  int v14549=v5526+7;
+  int v14550=v1816+8;
+  int v14551=v14066+2;
+  int v14552=v11628+8;
+  int v14553=v13507+4;
+  int v14554=v3198+3;
+  int v14555=v4597+3;
+  int v14556=v1145+8;
+  int v14557=v1101+2;
+  int v14558=v12715+4;
+  int v14559=v14373+5;
+  int v14560=v14045+5;
+  int v14561=v5295+7;
+  int v14562=v13943+9;
+  int v14563=v7592+9;
+  int v14564=v586+4;
+  int v14565=v8897+9;
+  int v14566=v11287+2;
+  int v14567=v12515+9;
+  int v14568=v3506+4;
+  int v14569=v6940+1;
+  int v14570=v3607+7;
+  int v14571=v11434+8;
+  int v14572=v8098+6;
+  int v14573=v12269+8;
+  int v14574=v3538+2;
+  int v14575=v1305+8;
+  int v14576=v11876+8;
+  int v14577=v10097+3;
+  int v14578=v7468+0;
+  int v14579=v9605+1;
+  int v14580=v11537+5;
+  int v14581=v2920+8;
+  int v14582=v3160+0;
+  int v14583=v1338+2;
+  int v14584=v1257+9;
+  int v14585=v5550+7;
+  int v14586=v10875+5;
+  int v14587=v13345+1;
+  int v14588=v3167+1;
+  int v14589=v10842+1;
+  int v14590=v3818+2;
+  int v14591=v12495+0;
+  int v14592=v4585+3;
+  int v14593=v5247+4;
+  int v14594=v4972+3;
+  int v14595=v12322+6;
+  int v14596=v3985+9;
+  int v14597=v359+6;
+  int v14598=v10844+8;
+  int v14599=v2893+7;
+  int v14600=v15+7;
+  int v14601=v468+5;
+  int v14602=v11589+1;
+  int v14603=v8267+9;
+  int v14604=v8282+9;
+  int v14605=v7319+8;
+  int v14606=v3209+4;
+  int v14607=v6623+2;
+  int v14608=v2186+5;
+  int v14609=v12885+8;
+  int v14610=v6215+2;
+  int v14611=v7782+5;
+  int v14612=v6386+3;
+  int v14613=v9250+6;
+  int v14614=v14003+9;
+  int v14615=v6510+8;
+  int v14616=v12280+0;
+  int v14617=v2856+0;
+  int v14618=v5023+0;
+  int v14619=v9596+3;
+  int v14620=v13428+2;
+  int v14621=v819+8;
+  int v14622=v6958+6;
+  int v14623=v7845+7;
+  int v14624=v752+1;
+  int v14625=v4792+6;
+  int v14626=v2143+9;
+  int v14627=v1091+2;
+  int v14628=v13405+6;
+  int v14629=v7542+0;
+  int v14630=v4118+4;
+  int v14631=v12957+2;
+  int v14632=v9903+0;
+  int v14633=v6377+7;
+  int v14634=v5789+0;
+  int v14635=v2714+4;
+  int v14636=v3184+1;
+  int v14637=v10532+9;
+  int v14638=v11406+8;
+  int v14639=v13735+0;
+  int v14640=v1534+2;
+  int v14641=v11619+1;
+  int v14642=v10802+5;
+  int v14643=v10830+7;
+  int v14644=v5542+4;
+  int v14645=v6479+6;
+  int v14646=v12136+3;
+  int v14647=v12662+6;
+  int v14648=v3588+7;
+  int v14649=v5139+5;
+  int v14650=v14156+4;
+  int v14651=v8698+6;
+  int v14652=v1167+3;
+  int v14653=v12604+1;
+  int v14654=v604+1;
+  int v14655=v2114+1;
+  int v14656=v7088+6;
+  int v14657=v9417+1;
+  int v14658=v12884+1;
+  int v14659=v10776+9;
+  int v14660=v8795+5;
+  int v14661=v1978+7;
+  int v14662=v5650+2;
+  int v14663=v2400+4;
+  int v14664=v1363+9;
+  int v14665=v3645+1;
+  int v14666=v3858+8;
+  int v14667=v8089+1;
+  int v14668=v1854+7;
+  int v14669=v13714+7;
+  int v14670=v5334+1;
+  int v14671=v12983+9;
+  int v14672=v3845+2;
+  int v14673=v3249+7;
+  int v14674=v3618+2;
+  int v14675=v3876+6;
+  int v14676=v7816+0;
+  int v14677=v9543+6;
+  int v14678=v11597+3;
+  int v14679=v10984+6;
+  int v14680=v10310+4;
+  int v14681=v1084+4;
+  int v14682=v12859+0;
+  int v14683=v4810+7;
+  int v14684=v7665+2;
+  int v14685=v13326+7;
+  int v14686=v6453+6;
+  int v14687=v4642+7;
+  int v14688=v8965+5;
+  int v14689=v2972+5;
+  int v14690=v4199+2;
+  int v14691=v1080+1;
+  int v14692=v3187+2;
+  int v14693=v2654+4;
+  int v14694=v3191+2;
+  int v14695=v1185+6;
+  int v14696=v4836+9;
+  int v14697=v9159+8;
+  int v14698=v8349+3;
+  int v14699=v5188+5;
+  int v14700=v3115+7;
+  int v14701=v13604+7;
+  int v14702=v6790+5;
+  int v14703=v11676+9;
+  int v14704=v13736+3;
+  int v14705=v4990+0;
+  int v14706=v4990+7;
+  int v14707=v12372+5;
+  int v14708=v14451+5;
+  int v14709=v1951+5;
+  int v14710=v1002+2;
+  int v14711=v4441+8;
+  int v14712=v293+7;
+  int v14713=v13182+8;
+  int v14714=v418+4;
+  int v14715=v7145+8;
+  int v14716=v12936+2;
+  int v14717=v11597+3;
+  int v14718=v2644+8;
+  int v14719=v9334+8;
+  int v14720=v4198+6;
+  int v14721=v7561+8;
+  int v14722=v4791+4;
+  int v14723=v6365+9;
+  int v14724=v4690+6;
+  int v14725=v5378+9;
+  int v14726=v2823+0;
+  int v14727=v7332+1;
+  int v14728=v2319+4;
+  int v14729=v11127+5;
+  int v14730=v1317+7;
+  int v14731=v8329+3;
+  int v14732=v10568+9;
+  int v14733=v13226+7;
+  int v14734=v9410+3;
+  int v14735=v13951+7;
+  int v14736=v714+4;
+  int v14737=v7287+0;
+  int v14738=v10869+5;
+  int v14739=v1458+4;
+  int v14740=v14260+8;
+  int v14741=v14604+6;
+  int v14742=v11118+4;
+  int v14743=v12205+9;
+  int v14744=v9757+4;
+  int v14745=v9173+2;
+  int v14746=v8307+8;
+  int v14747=v4608+4;
+  int v14748=v14671+9;
+  int v14749=v13417+5;
+  int v14750=v5370+5;
+  int v14751=v14377+0;
+  int v14752=v7181+2;
+  int v14753=v6376+7;
+  int v14754=v9497+4;
+  int v14755=v10903+5;
+  int v14756=v1583+8;
+  int v14757=v5472+9;
+  int v14758=v9714+5;
+  int v14759=v9390+9;
+  int v14760=v5785+2;
+  int v14761=v1220+9;
+  int v14762=v7755+5;
+  int v14763=v14569+5;
+  int v14764=v5053+5;
+  int v14765=v1196+9;
+  int v14766=v7396+8;
+  int v14767=v10060+7;
+  int v14768=v9374+3;
+  int v14769=v5543+0;
+  int v14770=v11254+0;
+  int v14771=v3313+5;
+  int v14772=v7144+6;
+  int v14773=v1836+5;
+  int v14774=v9053+5;
+  int v14775=v12234+3;
+  int v14776=v3033+9;
+  int v14777=v13428+2;
+  int v14778=v1390+6;
+  int v14779=v11652+0;
+  int v14780=v12352+1;
+  int v14781=v9084+0;
+  int v14782=v6462+5;
+  int v14783=v3302+8;
+  int v14784=v7246+4;
+  int v14785=v9421+5;
+  int v14786=v5856+0;
+  int v14787=v7634+1;
+  int v14788=v5471+7;
+  int v14789=v10589+9;
+  int v14790=v4622+2;
+  int v14791=v3659+5;
+  int v14792=v5378+6;
+  int v14793=v13074+2;
+  int v14794=v8342+4;
+  int v14795=v7079+4;
+  int v14796=v13790+5;
+  int v14797=v11987+4;
+  int v14798=v5088+3;
+  int v14799=v96+6;
+  int v14800=v6165+4;
+  int v14801=v14339+9;
+  int v14802=v249+6;
+  int v14803=v14516+9;
+  int v14804=v4245+9;
+  int v14805=v7672+6;
+  int v14806=v8897+1;
+  int v14807=v1886+6;
+  int v14808=v14635+0;
+  int v14809=v9273+9;
+  int v14810=v781+2;
+  int v14811=v5460+4;
+  int v14812=v3388+3;
+  int v14813=v13064+1;
+  int v14814=v14282+9;
+  int v14815=v14518+9;
+  int v14816=v1853+5;
+  int v14817=v4465+4;
+  int v14818=v9346+1;
+  int v14819=v6518+3;
+  int v14820=v6055+4;
+  int v14821=v5223+8;
+  int v14822=v1968+6;
+  int v14823=v3209+6;
+  int v14824=v3172+9;
+  int v14825=v8513+6;
+  int v14826=v4801+3;
+  int v14827=v369+5;
+  int v14828=v13314+8;
+  int v14829=v5745+8;
+  int v14830=v14454+7;
+  int v14831=v14509+3;
+  int v14832=v9372+9;
+  int v14833=v10656+5;
+  int v14834=v8391+3;
+  int v14835=v13770+2;
+  int v14836=v588+2;
+  int v14837=v5489+7;
+  int v14838=v11326+0;
+  int v14839=v13285+7;
+  int v14840=v12802+4;
+  int v14841=v831+3;
+  int v14842=v12924+8;
+  int v14843=v9965+3;
+  int v14844=v10721+4;
+  int v14845=v481+3;
+  int v14846=v13+6;
+  int v14847=v1949+5;
+  int v14848=v7308+4;
+  int v14849=v1716+0;
+  int v14850=v334+1;
+  int v14851=v6921+3;
+  int v14852=v13736+4;
+  int v14853=v12257+6;
+  int v14854=v9438+0;
+  int v14855=v14073+5;
+  int v14856=v1172+6;
+  int v14857=v11398+0;
+  int v14858=v14665+1;
+  int v14859=v13202+4;
+  int v14860=v8071+4;
+  int v14861=v11771+0;
+  int v14862=v12030+8;
+  int v14863=v14244+1;
+  int v14864=v1938+8;
+  int v14865=v8867+0;
+  int v14866=v7150+5;
+  int v14867=v3811+0;
+  int v14868=v14432+7;
+  int v14869=v4752+2;
+  int v14870=v1897+7;
+  int v14871=v8214+9;
+  int v14872=v7851+4;
+  int v14873=v10336+4;
+  int v14874=v7053+8;
+  int v14875=v8933+5;
+  int v14876=v10215+1;
+  int v14877=v5093+8;
+  int v14878=v11248+2;
+  int v14879=v2713+4;
+  int v14880=v14506+4;
+  int v14881=v9828+9;
+  int v14882=v10038+3;
+  int v14883=v10687+4;
+  int v14884=v8783+0;
+  int v14885=v14001+3;
+  int v14886=v11400+5;
+  int v14887=v1404+1;
+  int v14888=v9288+7;
+  int v14889=v6912+5;
+  int v14890=v5714+7;
+  int v14891=v7985+8;
+  int v14892=v9169+5;
+  int v14893=v1003+4;
+  int v14894=v6951+1;
+  int v14895=v9447+3;
+  int v14896=v48+6;
+  int v14897=v40+7;
+  int v14898=v1662+8;
+  int v14899=v9751+4;
+  int v14900=v13841+8;
+  int v14901=v14292+2;
+  int v14902=v5120+8;
+  int v14903=v2759+3;
+  int v14904=v11521+0;
+  int v14905=v1114+3;
+  int v14906=v12074+7;
+  int v14907=v9092+4;
+  int v14908=v7925+8;
+  int v14909=v6175+4;
+  int v14910=v12512+4;
+  int v14911=v6500+1;
+  int v14912=v7847+7;
+  int v14913=v3409+1;
+  int v14914=v10313+6;
+  int v14915=v6782+6;
+  int v14916=v11205+7;
+  int v14917=v13167+0;
+  int v14918=v13565+9;
+  int v14919=v848+8;
+  int v14920=v12425+5;
+  int v14921=v4615+9;
+  int v14922=v8199+2;
+  int v14923=v11328+2;
+  int v14924=v5043+6;
+  int v14925=v5400+9;
+  int v14926=v7372+0;
+  int v14927=v14099+3;
+  int v14928=v753+2;
+  int v14929=v4912+5;
+  int v14930=v5394+2;
+  int v14931=v10993+9;
+  int v14932=v7740+0;
+  int v14933=v1482+0;
+  int v14934=v6336+3;
+  int v14935=v510+1;
+  int v14936=v5111+1;
+  int v14937=v4811+0;
+  int v14938=v8070+6;
+  int v14939=v12120+3;
+  int v14940=v14579+5;
+  int v14941=v1666+0;
+  int v14942=v2978+2;
+  int v14943=v13211+4;
+  int v14944=v4749+9;
+  int v14945=v1149+7;
+  int v14946=v11746+6;
+  int v14947=v144+1;
+  int v14948=v9806+7;
+  int v14949=v261+3;
+  int v14950=v14840+0;
+  int v14951=v8373+5;
+  int v14952=v11737+8;
+  int v14953=v8375+8;
+  int v14954=v5261+3;
+  int v14955=v11267+5;
+  int v14956=v12977+5;
+  int v14957=v5175+9;
+  int v14958=v13241+7;
+  int v14959=v1904+9;
+  int v14960=v12283+2;
+  int v14961=v14062+0;
+  int v14962=v13752+8;
+  int v14963=v6968+9;
+  int v14964=v2278+5;
+  int v14965=v3096+2;
+  int v14966=v2706+8;
+  int v14967=v290+4;
+  int v14968=v3676+8;
+  int v14969=v2691+4;
+  int v14970=v12690+0;
+  int v14971=v9891+6;
+  int v14972=v4021+8;
+  int v14973=v5103+5;
+  int v14974=v10292+1;
+  int v14975=v1411+7;
+  int v14976=v2311+2;
+  int v14977=v4913+4;
+  int v14978=v526+2;
+  int v14979=v7930+8;
+  int v14980=v4977+1;
+  int v14981=v2818+0;
+  int v14982=v4787+5;
+  int v14983=v4103+7;
+  int v14984=v1926+9;
+  int v14985=v5065+6;
+  int v14986=v11333+8;
+  int v14987=v4990+0;
+  int v14988=v13700+7;
+  int v14989=v1842+9;
+  int v14990=v6246+7;
+  int v14991=v5671+0;
+  int v14992=v9795+0;
+  int v14993=v2110+6;
+  int v14994=v12718+1;
+  int v14995=v9903+4;
+  int v14996=v1277+6;
+  int v14997=v4295+8;
+  int v14998=v11148+4;
+  int v14999=v11543+3;
+  int v15000=v6014+5;
+  int v15001=v11129+7;
+  int v15002=v10864+7;
+  int v15003=v2660+1;
+  int v15004=v12394+2;
+  int v15005=v9916+4;
+  int v15006=v14301+8;
+  int v15007=v1260+7;
+  int v15008=v1470+8;
+  int v15009=v2102+3;
+  int v15010=v6850+7;
+  int v15011=v3943+9;
+  int v15012=v11462+2;
+  int v15013=v7494+2;
+  int v15014=v12938+4;
+  int v15015=v76+7;
+  int v15016=v8453+8;
+  int v15017=v4128+3;
+  int v15018=v12347+4;
+  int v15019=v12107+8;
+  int v15020=v13300+8;
+  int v15021=v1273+8;
+  int v15022=v3418+3;
+  int v15023=v14150+3;
+  int v15024=v2238+5;
+  int v15025=v1961+6;
+  int v15026=v662+4;
+  int v15027=v753+4;
+  int v15028=v3695+4;
+  int v15029=v5085+3;
+  int v15030=v10267+4;
+  int v15031=v9722+3;
+  int v15032=v10297+6;
+  int v15033=v430+5;
+  int v15034=v1740+0;
+  int v15035=v2652+8;
+  int v15036=v7047+7;
+  int v15037=v8016+6;
+  int v15038=v10206+9;
+  int v15039=v9349+7;
+  int v15040=v5625+9;
+  int v15041=v11550+0;
+  int v15042=v9115+2;
+  int v15043=v11498+0;
+  int v15044=v5907+6;
+  int v15045=v14669+9;
+  int v15046=v14195+9;
+  int v15047=v11557+9;
+  int v15048=v8074+6;
+  int v15049=v5934+6;
+  int v15050=v1063+0;
+  int v15051=v12186+2;
+  int v15052=v6424+4;
+  int v15053=v3868+0;
+  int v15054=v4559+9;
+  int v15055=v5830+0;
+  int v15056=v2861+9;
+  int v15057=v6961+9;
+  int v15058=v6675+8;
+  int v15059=v1394+0;
+  int v15060=v14192+8;
+  int v15061=v2968+1;
+  int v15062=v12191+7;
+  int v15063=v3789+4;
+  int v15064=v15055+2;
+  int v15065=v1284+3;
+  int v15066=v13917+7;
+  int v15067=v466+7;
+  int v15068=v13320+1;
+  int v15069=v2574+0;
+  int v15070=v2170+0;
+  int v15071=v8939+8;
+  int v15072=v13051+4;
+  int v15073=v1747+3;
+  int v15074=v281+0;
+  int v15075=v8012+3;
+  int v15076=v6318+4;
+  int v15077=v11055+2;
+  int v15078=v12732+2;
+  int v15079=v9561+2;
+  int v15080=v8405+8;
+  int v15081=v13687+2;
+  int v15082=v2388+9;
+  int v15083=v6071+2;
+  int v15084=v14195+3;
+  int v15085=v14098+8;
+  int v15086=v7891+9;
+  int v15087=v14606+8;
+  int v15088=v5807+6;
+  int v15089=v12959+1;
+  int v15090=v9878+7;
+  int v15091=v7036+5;
+  int v15092=v5317+8;
+  int v15093=v7100+0;
+  int v15094=v6737+2;
+  int v15095=v9138+4;
+  int v15096=v12273+4;
+  int v15097=v5736+8;
+  int v15098=v4929+7;
+  int v15099=v5596+2;
+  int v15100=v11353+2;
+  int v15101=v9444+4;
+  int v15102=v2807+5;
+  int v15103=v12213+1;
+  int v15104=v9896+3;
+  int v15105=v8057+4;
+  int v15106=v1801+9;
+  int v15107=v7656+0;
+  int v15108=v2182+4;
+  int v15109=v9165+0;
+  int v15110=v2768+7;
+  int v15111=v8641+0;
+  int v15112=v3894+8;
+  int v15113=v677+4;
+  int v15114=v14234+7;
+  int v15115=v5177+2;
+  int v15116=v8921+5;
+  int v15117=v6407+7;
+  int v15118=v2683+5;
+  int v15119=v12199+3;
+  int v15120=v3842+0;
+  int v15121=v950+7;
+  int v15122=v6062+2;
+  int v15123=v1215+4;
+  int v15124=v6967+8;
+  int v15125=v14482+1;
+  int v15126=v4320+3;
+  int v15127=v3386+7;
+  int v15128=v3300+4;
+  int v15129=v13903+8;
+  int v15130=v14640+2;
+  int v15131=v5829+4;
+  int v15132=v6826+0;
+  int v15133=v1906+0;
+  int v15134=v1700+8;
+  int v15135=v14784+3;
+  int v15136=v14688+0;
+  int v15137=v698+2;
+  int v15138=v4533+4;
+  int v15139=v14364+6;
+  int v15140=v5458+5;
+  int v15141=v8835+6;
+  int v15142=v6279+0;
+  int v15143=v5285+8;
+  int v15144=v1986+0;
+  int v15145=v6833+6;
+  int v15146=v1438+4;
+  int v15147=v13758+2;
+  int v15148=v41+8;
+  int v15149=v6194+1;
+  int v15150=v1+9;
+  int v15151=v4688+0;
+  int v15152=v1315+7;
+  int v15153=v2175+3;
+  int v15154=v3774+2;
+  int v15155=v496+8;
+  int v15156=v13004+6;
+  int v15157=v1155+3;
+  int v15158=v9673+2;
+  int v15159=v8728+9;
+  int v15160=v11029+3;
+  int v15161=v15048+3;
+  int v15162=v12394+6;
+  int v15163=v6998+5;
+  int v15164=v13544+4;
+  int v15165=v11010+4;
+  int v15166=v7722+7;
+  int v15167=v9288+5;
+  int v15168=v13795+8;
+  int v15169=v14623+3;
+  int v15170=v9225+3;
+  int v15171=v4963+0;
+  int v15172=v503+1;
+  int v15173=v4100+7;
+  int v15174=v4589+4;
+  int v15175=v2349+6;
+  int v15176=v8381+4;
+  int v15177=v15054+7;
+  int v15178=v7939+0;
+  int v15179=v4974+0;
+  int v15180=v13915+3;
+  int v15181=v11976+1;
+  int v15182=v7829+5;
+  int v15183=v8430+1;
+  int v15184=v8475+9;
+  int v15185=v13032+4;
+  int v15186=v3673+3;
+  int v15187=v4532+4;
+  int v15188=v6447+2;
+  int v15189=v14796+6;
+  int v15190=v9271+1;
+  int v15191=v8779+1;
+  int v15192=v8952+1;
+  int v15193=v12364+8;
+  int v15194=v12605+7;
+  int v15195=v14569+3;
+  int v15196=v13261+0;
+  int v15197=v7632+4;
+  int v15198=v12119+4;
+  int v15199=v7490+2;
+  int v15200=v6478+1;
+  int v15201=v8456+3;
+  int v15202=v4562+2;
+  int v15203=v5650+1;
+  int v15204=v865+3;
+  int v15205=v4395+7;
+  int v15206=v10244+8;
+  int v15207=v8390+7;
+  int v15208=v9649+7;
+  int v15209=v7085+9;
+  int v15210=v10704+0;
+  int v15211=v9378+6;
+  int v15212=v7337+5;
+  int v15213=v5277+8;
+  int v15214=v2546+0;
+  int v15215=v1906+1;
+  int v15216=v1203+1;
+  int v15217=v4367+7;
+  int v15218=v7309+7;
+  int v15219=v926+0;
+  int v15220=v8434+2;
+  int v15221=v7085+5;
+  int v15222=v13350+3;
+  int v15223=v10731+1;
+  int v15224=v4812+1;
+  int v15225=v6217+3;
+  int v15226=v8948+9;
+  int v15227=v3560+5;
+  int v15228=v4087+8;
+  int v15229=v9619+1;
+  int v15230=v9443+9;
+  int v15231=v11811+7;
+  int v15232=v9948+8;
+  int v15233=v6499+1;
+  int v15234=v8589+2;
+  int v15235=v10006+6;
+  int v15236=v15036+8;
+  int v15237=v7952+1;
+  int v15238=v11661+8;
+  int v15239=v1715+8;
+  int v15240=v7325+6;
+  int v15241=v779+8;
+  int v15242=v4184+0;
+  int v15243=v8567+2;
+  int v15244=v12037+4;
+  int v15245=v1321+6;
+  int v15246=v6847+3;
+  int v15247=v7752+1;
+  int v15248=v11425+8;
+  int v15249=v14041+8;
+  int v15250=v3865+8;
+  int v15251=v11214+9;
+  int v15252=v13355+0;
+  int v15253=v859+5;
+  int v15254=v3578+3;
+  int v15255=v14031+9;
+  int v15256=v1049+8;
+  int v15257=v11362+4;
+  int v15258=v946+8;
+  int v15259=v11667+1;
+  int v15260=v5789+8;
+  int v15261=v1640+4;
+  int v15262=v14540+2;
+  int v15263=v1073+7;
+  int v15264=v14183+4;
+  int v15265=v529+1;
+  int v15266=v5415+3;
+  int v15267=v4287+0;
+  int v15268=v2489+4;
+  int v15269=v11425+2;
+  int v15270=v2539+7;
+  int v15271=v12182+3;
+  int v15272=v9271+0;
+  int v15273=v6140+0;
+  int v15274=v4684+0;
+  int v15275=v10620+8;
+  int v15276=v3233+3;
+  int v15277=v10365+2;
+  int v15278=v7805+9;
+  int v15279=v13052+6;
+  int v15280=v5337+6;
+  int v15281=v3702+4;
+  int v15282=v8709+1;
+  int v15283=v4733+8;
+  int v15284=v11304+2;
+  int v15285=v4608+0;
+  int v15286=v3962+2;
+  int v15287=v731+9;
+  int v15288=v13003+9;
+  int v15289=v8605+3;
+  int v15290=v2106+8;
+  int v15291=v9034+6;
+  int v15292=v2355+3;
+  int v15293=v6995+4;
+  int v15294=v10500+7;
+  int v15295=v9333+0;
+  int v15296=v1189+4;
+  int v15297=v14054+5;
+  int v15298=v54+5;
+  int v15299=v8293+5;
+  int v15300=v7828+8;
+  int v15301=v5754+0;
+  int v15302=v1021+4;
+  int v15303=v11069+6;
+  int v15304=v11780+2;
+  int v15305=v14391+7;
+  int v15306=v634+6;
+  int v15307=v11003+3;
+  int v15308=v4792+4;
+  int v15309=v2090+6;
+  int v15310=v11550+9;
+  int v15311=v14710+3;
+  int v15312=v4959+2;
+  int v15313=v8989+6;
+  int v15314=v7985+2;
+  int v15315=v10613+3;
+  int v15316=v4049+2;
+  int v15317=v8497+5;
+  int v15318=v5527+4;
+  int v15319=v10377+9;
+  int v15320=v2062+9;
+  int v15321=v10314+8;
+  int v15322=v2479+5;
+  int v15323=v820+7;
+  int v15324=v10215+1;
+  int v15325=v13998+5;
+  int v15326=v10150+9;
+  int v15327=v7542+8;
+  int v15328=v10829+4;
+  int v15329=v5889+5;
+  int v15330=v2072+2;
+  int v15331=v3155+3;
+  int v15332=v7398+5;
+  int v15333=v5525+2;
+  int v15334=v5884+7;
+  int v15335=v7244+8;
+  int v15336=v7437+7;
+  int v15337=v1094+4;
+  int v15338=v592+5;
+  int v15339=v4360+5;
+  int v15340=v4687+8;
+  int v15341=v2044+6;
+  int v15342=v14466+3;
+  int v15343=v4723+8;
+  int v15344=v1554+0;
+  int v15345=v6158+1;
+  int v15346=v7185+0;
+  int v15347=v2450+4;
+  int v15348=v7020+2;
+  int v15349=v9382+7;
+  int v15350=v6104+5;
+  int v15351=v1124+7;
+  int v15352=v4987+6;
+  int v15353=v4168+2;
+  int v15354=v5786+8;
+  int v15355=v1885+1;
+  int v15356=v1345+7;
+  int v15357=v4359+9;
+  int v15358=v2020+8;
+  int v15359=v10086+4;
+  int v15360=v12083+4;
+  int v15361=v3891+7;
+  int v15362=v4634+3;
+  int v15363=v14544+8;
+  int v15364=v415+6;
+  int v15365=v13717+1;
+  int v15366=v11434+2;
+  int v15367=v13001+0;
+  int v15368=v13099+2;
+  int v15369=v15281+1;
+  int v15370=v9007+5;
+  int v15371=v1090+7;
+  int v15372=v1344+9;
+  int v15373=v14507+5;
+  int v15374=v8408+3;
+  int v15375=v9788+2;
+  int v15376=v14754+3;
+  int v15377=v3403+4;
+  int v15378=v356+2;
+  int v15379=v13698+6;
+  int v15380=v12372+4;
+  int v15381=v575+4;
+  int v15382=v5032+3;
+  int v15383=v2188+3;
+  int v15384=v14769+2;
+  int v15385=v1311+1;
+  int v15386=v3807+4;
+  int v15387=v2265+8;
+  int v15388=v7068+6;
+  int v15389=v33+2;
+  int v15390=v11579+3;
+  int v15391=v5486+7;
+  int v15392=v10792+7;
+  int v15393=v11113+5;
+  int v15394=v4115+6;
+  int v15395=v5494+3;
+  int v15396=v5342+0;
+  int v15397=v3644+8;
+  int v15398=v8832+7;
+  int v15399=v8337+6;
+  int v15400=v5476+8;
+  int v15401=v6117+1;
+  int v15402=v2736+3;
+  int v15403=v13706+3;
+  int v15404=v10239+3;
+  int v15405=v4337+5;
+  int v15406=v4531+0;
+  int v15407=v5574+4;
+  int v15408=v9596+6;
+  int v15409=v10716+9;
+  int v15410=v12299+6;
+  int v15411=v1370+7;
+  int v15412=v927+7;
+  int v15413=v3887+4;
+  int v15414=v9462+4;
+  int v15415=v10845+2;
+  int v15416=v4823+7;
+  int v15417=v2130+4;
+  int v15418=v7880+0;
+  int v15419=v13453+7;
+  int v15420=v8876+3;
+  int v15421=v6728+8;
+  int v15422=v8157+6;
+  int v15423=v2598+2;
+  int v15424=v4957+4;
+  int v15425=v10508+2;
+  int v15426=v7911+5;
+  int v15427=v11903+5;
+  int v15428=v3317+3;
+  int v15429=v10621+5;
+  int v15430=v6792+6;
+  int v15431=v7635+8;
+  int v15432=v8974+5;
+  int v15433=v1123+1;
+  int v15434=v718+4;
+  int v15435=v10324+2;
+  int v15436=v7421+3;
+  int v15437=v6777+4;
+  int v15438=v10687+8;
+  int v15439=v5879+2;
+  int v15440=v2426+2;
+  int v15441=v5329+2;
+  int v15442=v4321+6;
+  int v15443=v3499+4;
+  int v15444=v1+8;
+  int v15445=v885+3;
+  int v15446=v15047+1;
+  int v15447=v3355+7;
+  int v15448=v14942+2;
+  int v15449=v9655+3;
+  int v15450=v9385+5;
+  int v15451=v11853+4;
+  int v15452=v816+6;
+  int v15453=v13555+3;
+  int v15454=v12654+8;
+  int v15455=v10596+0;
+  int v15456=v14623+2;
+  int v15457=v5418+9;
+  int v15458=v5874+2;
+  int v15459=v13844+5;
+  int v15460=v6124+4;
+  int v15461=v1504+2;
+  int v15462=v8424+0;
+  int v15463=v11544+0;
+  int v15464=v6386+2;
+  int v15465=v9807+1;
+  int v15466=v9903+6;
+  int v15467=v13537+3;
+  int v15468=v10143+4;
+  int v15469=v8732+4;
+  int v15470=v2077+0;
+  int v15471=v2405+1;
+  int v15472=v1415+1;
+  int v15473=v9245+0;
+  int v15474=v5017+9;
+  int v15475=v14840+7;
+  int v15476=v1919+2;
+  int v15477=v1020+7;
+  int v15478=v3252+2;
+  int v15479=v3930+4;
+  int v15480=v2562+1;
+  int v15481=v11749+7;
+  int v15482=v7968+9;
+  int v15483=v5664+3;
+  int v15484=v10100+6;
+  int v15485=v6105+7;
+  int v15486=v9301+8;
+  int v15487=v13888+1;
+  int v15488=v7899+5;
+  int v15489=v11701+5;
+  int v15490=v7113+8;
+  int v15491=v8734+0;
+  int v15492=v12995+9;
+  int v15493=v7233+8;
+  int v15494=v4427+6;
+  int v15495=v2898+9;
+  int v15496=v1785+6;
+  int v15497=v1885+2;
+  int v15498=v15443+0;
+  int v15499=v7466+0;
+  int v15500=v14021+2;
+  int v15501=v13106+6;
+  int v15502=v10109+8;
+  int v15503=v10573+0;
+  int v15504=v10489+5;
+  int v15505=v984+7;
+  int v15506=v12808+4;
+  int v15507=v1270+8;
+  int v15508=v8414+0;
+  int v15509=v14392+6;
+  int v15510=v12151+0;
+  int v15511=v3395+3;
+  int v15512=v5331+9;
+  int v15513=v4758+8;
+  int v15514=v11557+2;
+  int v15515=v5117+4;
+  int v15516=v11753+1;
+  int v15517=v15458+3;
+  int v15518=v2960+6;
+  int v15519=v5952+5;
+  int v15520=v10076+5;
+  int v15521=v10819+1;
+  int v15522=v14354+7;
+  int v15523=v13240+8;
+  int v15524=v13556+5;
+  int v15525=v3227+3;
+  int v15526=v3833+0;
+  int v15527=v13172+1;
+  int v15528=v5315+1;
+  int v15529=v12279+2;
+  int v15530=v10348+2;
+  int v15531=v12317+6;
+  int v15532=v2896+1;
+  int v15533=v483+9;
+  int v15534=v2889+5;
+  int v15535=v12776+8;
+  int v15536=v3494+5;
+  int v15537=v6436+3;
+  int v15538=v14861+6;
+  int v15539=v10645+5;
+  int v15540=v6516+3;
+  int v15541=v12856+1;
+  int v15542=v4449+1;
+  int v15543=v14020+1;
+  int v15544=v2925+0;
+  int v15545=v10092+8;
+  int v15546=v2641+1;
+  int v15547=v9143+0;
+  int v15548=v6685+4;
+  int v15549=v3308+2;
+  int v15550=v2201+3;
+  int v15551=v4787+2;
+  int v15552=v4809+8;
+  int v15553=v5173+3;
+  int v15554=v6325+3;
+  int v15555=v4536+9;
+  int v15556=v7615+7;
+  int v15557=v6009+4;
+  int v15558=v14975+3;
+  int v15559=v4339+0;
+  int v15560=v1309+7;
+  int v15561=v402+6;
+  int v15562=v3437+9;
+  int v15563=v1802+5;
+  int v15564=v15286+7;
+  int v15565=v7275+6;
+  int v15566=v7981+3;
+  int v15567=v36+0;
+  int v15568=v1361+9;
+  int v15569=v13577+1;
+  int v15570=v1570+2;
+  int v15571=v5672+0;
+  int v15572=v10657+8;
+  int v15573=v1438+8;
+  int v15574=v3122+3;
+  int v15575=v15293+7;
+  int v15576=v9318+0;
+  int v15577=v13839+2;
+  int v15578=v11892+6;
+  int v15579=v2707+5;
+  int v15580=v14578+3;
+  int v15581=v9688+4;
+  int v15582=v12606+7;
+  int v15583=v5346+3;
+  int v15584=v10314+6;
+  int v15585=v14556+2;
+  int v15586=v12352+8;
+  int v15587=v1834+0;
+  int v15588=v1620+8;
+  int v15589=v11598+7;
+  int v15590=v9189+0;
+  int v15591=v5676+4;
+  int v15592=v9921+5;
+  int v15593=v11076+7;
+  int v15594=v4046+8;
+  int v15595=v14556+2;
+  int v15596=v13951+9;
+  int v15597=v11215+7;
+  int v15598=v3917+6;
+  int v15599=v14122+2;
+  int v15600=v15180+5;
+  int v15601=v3772+8;
+  int v15602=v686+2;
+  int v15603=v10263+9;
+  int v15604=v10579+8;
+  int v15605=v15321+7;
+  int v15606=v7609+4;
+  int v15607=v8256+5;
+  int v15608=v10599+3;
+  int v15609=v9437+3;
+  int v15610=v13803+5;
+  int v15611=v3981+8;
+  int v15612=v7683+4;
+  int v15613=v5473+7;
+  int v15614=v8225+5;
+  int v15615=v9663+7;
+  int v15616=v13347+2;
+  int v15617=v1261+5;
+  int v15618=v8945+1;
+  int v15619=v7532+5;
+  int v15620=v12143+9;
+  int v15621=v7926+4;
+  int v15622=v13244+5;
+  int v15623=v4984+7;
+  int v15624=v3185+7;
+  int v15625=v7660+9;
+  int v15626=v14167+9;
+  int v15627=v5493+0;
+  int v15628=v10661+2;
+  int v15629=v11199+2;
+  int v15630=v3673+0;
+  int v15631=v3200+6;
+  int v15632=v7096+0;
+  int v15633=v2445+2;
+  int v15634=v6637+9;
+  int v15635=v4358+2;
+  int v15636=v13764+3;
+  int v15637=v13148+7;
+  int v15638=v10420+0;
+  int v15639=v11879+2;
+  int v15640=v7593+4;
+  int v15641=v14514+7;
+  int v15642=v921+0;
+  int v15643=v14993+4;
+  int v15644=v5649+2;
+  int v15645=v1533+9;
+  int v15646=v2468+7;
+  int v15647=v14504+8;
+  int v15648=v4568+4;
+  int v15649=v9697+5;
+  int v15650=v8134+1;
+  int v15651=v15364+7;
+  int v15652=v6795+4;
+  int v15653=v14921+9;
+  int v15654=v5312+7;
+  int v15655=v6111+1;
+  int v15656=v11837+4;
+  int v15657=v5934+4;
+  int v15658=v10336+4;
+  int v15659=v5475+5;
+  int v15660=v10338+9;
+  int v15661=v4254+2;
+  int v15662=v405+8;
+  int v15663=v7352+8;
+  int v15664=v6657+8;
+  int v15665=v13951+1;
+  int v15666=v15374+2;
+  int v15667=v9685+6;
+  int v15668=v7597+0;
+  int v15669=v2409+7;
+  int v15670=v8490+8;
+  int v15671=v3537+1;
+  int v15672=v1387+4;
+  int v15673=v6816+7;
+  int v15674=v13867+4;
+  int v15675=v398+1;
+  int v15676=v6941+8;
+  int v15677=v8306+0;
+  int v15678=v6893+8;
+  int v15679=v13942+0;
+  int v15680=v3081+9;
+  int v15681=v10718+9;
+  int v15682=v10539+3;
+  int v15683=v6172+8;
+  int v15684=v7197+3;
+  int v15685=v2025+0;
+  int v15686=v12910+0;
+  int v15687=v4544+9;
+  int v15688=v6241+7;
+  int v15689=v8227+8;
+  int v15690=v4365+0;
+  int v15691=v9835+5;
+  int v15692=v14562+6;
+  int v15693=v10920+5;
+  int v15694=v3297+8;
+  int v15695=v4276+8;
+  int v15696=v2453+4;
+  int v15697=v7326+7;
+  int v15698=v7114+1;
+  int v15699=v4354+4;
+  int v15700=v2071+4;
+  int v15701=v6022+3;
+  int v15702=v5243+0;
+  int v15703=v7396+3;
+  int v15704=v7753+9;
+  int v15705=v6901+2;
+  int v15706=v6170+8;
+  int v15707=v8520+6;
+  int v15708=v167+6;
+  int v15709=v881+1;
+  int v15710=v6979+4;
+  int v15711=v14672+9;
+  int v15712=v3061+1;
+  int v15713=v13322+3;
+  int v15714=v5487+8;
+  int v15715=v1739+2;
+  int v15716=v11721+8;
+  int v15717=v6740+7;
+  int v15718=v3380+6;
+  int v15719=v15213+7;
+  int v15720=v19+5;
+  int v15721=v11566+4;
+  int v15722=v7055+0;
+  int v15723=v12371+3;
+  int v15724=v2577+2;
+  int v15725=v13171+1;
+  int v15726=v11317+6;
+  int v15727=v10806+1;
+  int v15728=v141+3;
+  int v15729=v7137+8;
+  int v15730=v12956+3;
+  int v15731=v9963+6;
+  int v15732=v2675+6;
+  int v15733=v12721+9;
+  int v15734=v8542+0;
+  int v15735=v6867+8;
+  int v15736=v8038+0;
+  int v15737=v11710+9;
+  int v15738=v8564+9;
+  int v15739=v11362+8;
+  int v15740=v7500+9;
+  int v15741=v10908+7;
+  int v15742=v8459+9;
+  int v15743=v6150+7;
+  int v15744=v12923+2;
+  int v15745=v10411+8;
+  int v15746=v8257+3;
+  int v15747=v1392+9;
+  int v15748=v11807+4;
+  int v15749=v10096+8;
+  int v15750=v621+1;
+  int v15751=v9313+5;
+  int v15752=v11595+1;
+  int v15753=v2366+0;
+  int v15754=v1322+6;
+  int v15755=v17+2;
+  int v15756=v5543+6;
+  int v15757=v7060+4;
+  int v15758=v14103+3;
+  int v15759=v8434+0;
+  int v15760=v14050+9;
+  int v15761=v785+4;
+  int v15762=v5604+2;
+  int v15763=v14807+2;
+  int v15764=v14099+0;
+  int v15765=v6210+9;
+  int v15766=v9816+4;
+  int v15767=v1918+2;
+  int v15768=v15474+7;
+  int v15769=v8513+6;
+  int v15770=v4447+5;
+  int v15771=v13028+5;
+  int v15772=v14652+5;
+  int v15773=v5841+9;
+  int v15774=v15296+3;
+  int v15775=v1111+7;
+  int v15776=v116+6;
+  int v15777=v13966+2;
+  int v15778=v4144+3;
+  int v15779=v2663+6;
+  int v15780=v2919+8;
+  int v15781=v5435+4;
+  int v15782=v2076+4;
+  int v15783=v11316+0;
+  int v15784=v8801+9;
+  int v15785=v14617+1;
+  int v15786=v4870+2;
+  int v15787=v2009+5;
+  int v15788=v14522+9;
+  int v15789=v12595+3;
+  int v15790=v10227+1;
+  int v15791=v1051+3;
+  int v15792=v11642+1;
+  int v15793=v15148+3;
+  int v15794=v6248+8;
+  int v15795=v4085+2;
+  int v15796=v12051+3;
+  int v15797=v5079+1;
+  int v15798=v13909+5;
+  int v15799=v11617+9;
+  int v15800=v9166+2;
+  int v15801=v5924+7;
+  int v15802=v7285+4;
+  int v15803=v3467+4;
+  int v15804=v9953+6;
+  int v15805=v13734+0;
+  int v15806=v63+7;
+  int v15807=v3189+6;
+  int v15808=v1371+9;
+  int v15809=v8711+4;
+  int v15810=v2202+4;
+  int v15811=v12801+4;
+  int v15812=v9819+4;
+  int v15813=v7445+6;
+  int v15814=v830+1;
+  int v15815=v15202+5;
+  int v15816=v9996+1;
+  int v15817=v1366+3;
+  int v15818=v9309+3;
+  int v15819=v5281+0;
+  int v15820=v9169+0;
+  int v15821=v14957+3;
+  int v15822=v12736+7;
+  int v15823=v11759+4;
+  int v15824=v7273+0;
+  int v15825=v12900+0;
+  int v15826=v10250+8;
+  int v15827=v14534+0;
+  int v15828=v3667+4;
+  int v15829=v4608+6;
+  int v15830=v4732+1;
+  int v15831=v1066+9;
+  int v15832=v14693+8;
+  int v15833=v3162+9;
+  int v15834=v13095+5;
+  int v15835=v15191+1;
+  int v15836=v3512+6;
+  int v15837=v12660+1;
+  int v15838=v2341+7;
+  int v15839=v5745+9;
+  int v15840=v13064+9;
+  int v15841=v2809+6;
+  int v15842=v6940+4;
+  int v15843=v6737+3;
+  int v15844=v6122+5;
+  int v15845=v11534+5;
+  int v15846=v7491+4;
+  int v15847=v4076+6;
+  int v15848=v11488+8;
+  int v15849=v1769+9;
+  int v15850=v12322+9;
+  int v15851=v11221+9;
+  int v15852=v7910+9;
+  int v15853=v5241+7;
+  int v15854=v1038+3;
+  int v15855=v4658+3;
+  int v15856=v12788+8;
+  int v15857=v9652+8;
+  int v15858=v1162+4;
+  int v15859=v5259+2;
+  int v15860=v11471+1;
+  int v15861=v164+5;
+  int v15862=v8769+3;
+  int v15863=v844+5;
+  int v15864=v3356+1;
+  int v15865=v11289+2;
+  int v15866=v8364+7;
+  int v15867=v13038+4;
+  int v15868=v5515+3;
+  int v15869=v10736+9;
+  int v15870=v13731+4;
+  int v15871=v12901+8;
+  int v15872=v10607+2;
+  int v15873=v9953+0;
+  int v15874=v7052+0;
+  int v15875=v8473+2;
+  int v15876=v5543+1;
+  int v15877=v12980+9;
+  int v15878=v5756+0;
+  int v15879=v726+6;
+  int v15880=v14607+7;
+  int v15881=v3929+3;
+  int v15882=v2904+1;
+  int v15883=v8919+8;
+  int v15884=v4787+8;
+  int v15885=v9626+0;
+  int v15886=v14097+7;
+  int v15887=v1620+2;
+  int v15888=v15225+5;
+  int v15889=v10024+5;
+  int v15890=v14371+9;
+  int v15891=v1690+4;
+  int v15892=v1+2;
+  int v15893=v10439+9;
+  int v15894=v1515+0;
+  int v15895=v13418+8;
+  int v15896=v2915+4;
+  int v15897=v14672+0;
+  int v15898=v12723+5;
+  int v15899=v6854+9;
+  int v15900=v7530+2;
+  int v15901=v15881+0;
+  int v15902=v1807+3;
+  int v15903=v13896+6;
+  int v15904=v13606+2;
+  int v15905=v8226+6;
+  int v15906=v2915+8;
+  int v15907=v917+6;
+  int v15908=v2668+0;
+  int v15909=v3912+1;
+  int v15910=v11708+7;
+  int v15911=v6955+4;
+  int v15912=v9433+7;
+  int v15913=v12277+2;
+  int v15914=v11862+3;
+  int v15915=v4990+1;
+  int v15916=v8162+6;
+  int v15917=v5204+0;
+  int v15918=v13861+6;
+  int v15919=v5822+5;
+  int v15920=v12314+3;
+  int v15921=v13716+2;
+  int v15922=v3730+6;
+  int v15923=v15246+8;
+  int v15924=v1724+6;
+  int v15925=v15515+5;
+  int v15926=v14270+3;
+  int v15927=v15395+2;
+  int v15928=v12858+4;
+  int v15929=v9935+2;
+  int v15930=v5369+0;
+  int v15931=v1705+8;
+  int v15932=v1903+2;
+  int v15933=v8885+2;
+  int v15934=v9370+8;
+  int v15935=v7598+7;
+  int v15936=v12894+9;
+  int v15937=v4795+9;
+  int v15938=v5049+3;
+  int v15939=v3387+1;
+  int v15940=v1857+2;
+  int v15941=v2188+0;
+  int v15942=v10911+2;
+  int v15943=v3361+4;
+  int v15944=v12910+7;
+  int v15945=v11725+2;
+  int v15946=v14443+1;
+  int v15947=v4083+4;
+  int v15948=v348+9;
+  int v15949=v14230+2;
+  int v15950=v5285+7;
+  int v15951=v1450+0;
+  int v15952=v15393+5;
+  int v15953=v4267+1;
+  int v15954=v3729+1;
+  int v15955=v9673+9;
+  int v15956=v14753+4;
+  int v15957=v9827+0;
+  int v15958=v1286+4;
+  int v15959=v11486+0;
+  int v15960=v9662+4;
+  int v15961=v4105+6;
+  int v15962=v9142+4;
+  int v15963=v1847+0;
+  int v15964=v1172+3;
+  int v15965=v3635+0;
+  int v15966=v7339+0;
+  int v15967=v2685+8;
+  int v15968=v11912+5;
+  int v15969=v4699+9;
+  int v15970=v9799+2;
+  int v15971=v13494+1;
+  int v15972=v9633+4;
+  int v15973=v10910+8;
+  int v15974=v91+8;
+  int v15975=v2101+3;
+  int v15976=v3537+0;
+  int v15977=v12858+9;
+  int v15978=v11161+7;
+  int v15979=v7053+6;
+  int v15980=v11168+3;
+  int v15981=v12139+9;
+  int v15982=v451+2;
+  int v15983=v5881+5;
+  int v15984=v6955+0;
+  int v15985=v9658+6;
+  int v15986=v3538+4;
+  int v15987=v4511+1;
+  int v15988=v6339+4;
+  int v15989=v10618+3;
+  int v15990=v15692+4;
+  int v15991=v7281+1;
+  int v15992=v4581+7;
+  int v15993=v7974+1;
+  int v15994=v8882+5;
+  int v15995=v2111+8;
+  int v15996=v12679+3;
+  int v15997=v1563+6;
+  int v15998=v2475+4;
+  int v15999=v9967+4;
+  int v16000=v8113+6;
+  int v16001=v8352+6;
+  int v16002=v1963+1;
+  int v16003=v1293+1;
+  int v16004=v5715+4;
+  int v16005=v11958+2;
+  int v16006=v2679+4;
+  int v16007=v10961+7;
+  int v16008=v8703+6;
+  int v16009=v13097+5;
+  int v16010=v1245+8;
+  int v16011=v11937+6;
+  int v16012=v1140+2;
+  int v16013=v10353+3;
+  int v16014=v434+4;
+  int v16015=v7329+0;
+  int v16016=v7186+7;
+  int v16017=v8764+6;
+  int v16018=v372+8;
+  int v16019=v8178+5;
+  int v16020=v11132+8;
+  int v16021=v7226+3;
+  int v16022=v12153+2;
+  int v16023=v2632+6;
+  int v16024=v5446+6;
+  int v16025=v4468+9;
+  int v16026=v2422+7;
+  int v16027=v11248+3;
+  int v16028=v7077+3;
+  int v16029=v9027+9;
+  int v16030=v3684+4;
+  int v16031=v15819+5;
+  int v16032=v6566+1;
+  int v16033=v13468+4;
+  int v16034=v11864+5;
+  int v16035=v8227+6;
+  int v16036=v202+8;
+  int v16037=v13149+5;
+  int v16038=v8312+5;
+  int v16039=v6610+8;
+  int v16040=v8742+8;
+  int v16041=v11466+3;
+  int v16042=v13002+1;
+  int v16043=v3245+3;
+  int v16044=v15477+1;
+  int v16045=v8480+9;
+  int v16046=v4929+1;
+  int v16047=v767+2;
+  int v16048=v2172+4;
+  int v16049=v12800+5;
+  int v16050=v15600+2;
+  int v16051=v9661+4;
+  int v16052=v13638+3;
+  int v16053=v1329+0;
+  int v16054=v1366+8;
+  int v16055=v6399+1;
+  int v16056=v875+4;
+  int v16057=v14387+1;
+  int v16058=v13130+0;
+  int v16059=v13683+5;
+  int v16060=v12977+1;
+  int v16061=v2931+2;
+  int v16062=v1527+4;
+  int v16063=v9937+0;
+  int v16064=v7954+9;
+  int v16065=v8186+4;
+  int v16066=v8562+4;
+  int v16067=v382+6;
+  int v16068=v13946+5;
+  int v16069=v14720+9;
+  int v16070=v2122+5;
+  int v16071=v4849+4;
+  int v16072=v720+7;
+  int v16073=v15203+3;
+  int v16074=v2941+4;
+  int v16075=v13452+0;
+  int v16076=v3072+9;
+  int v16077=v10345+9;
+  int v16078=v13483+2;
+  int v16079=v10612+7;
+  int v16080=v2063+4;
+  int v16081=v13803+6;
+  int v16082=v11693+8;
+  int v16083=v8096+9;
+  int v16084=v3877+5;
+  int v16085=v10857+8;
+  int v16086=v2125+7;
+  int v16087=v1104+5;
+  int v16088=v7762+7;
+  int v16089=v11074+6;
+  int v16090=v10303+2;
+  int v16091=v4670+6;
+  int v16092=v7272+5;
+  int v16093=v4664+6;
+  int v16094=v10334+5;
+  int v16095=v8983+8;
+  int v16096=v2844+5;
+  int v16097=v9152+5;
+  int v16098=v7058+3;
+  int v16099=v4849+4;
+  int v16100=v8800+7;
+  int v16101=v8881+6;
+  int v16102=v14244+4;
+  int v16103=v12173+1;
+  int v16104=v264+8;
+  int v16105=v10841+5;
+  int v16106=v12043+9;
+  int v16107=v2739+5;
+  int v16108=v13378+9;
+  int v16109=v8013+3;
+  int v16110=v2738+9;
+  int v16111=v6006+0;
+  int v16112=v14271+2;
+  int v16113=v3026+1;
+  int v16114=v3154+1;
+  int v16115=v4327+5;
+  int v16116=v8386+3;
+  int v16117=v11153+7;
+  int v16118=v6107+3;
+  int v16119=v6460+2;
+  int v16120=v12758+3;
+  int v16121=v15999+0;
+  int v16122=v10613+6;
+  int v16123=v6858+6;
+  int v16124=v11833+5;
+  int v16125=v3743+3;
+  int v16126=v13405+3;
+  int v16127=v10644+2;
+  int v16128=v14349+8;
+  int v16129=v15753+2;
+  int v16130=v14658+4;
+  int v16131=v4025+6;
+  int v16132=v7894+4;
+  int v16133=v5872+1;
+  int v16134=v16041+6;
+  int v16135=v7888+6;
+  int v16136=v6946+9;
+  int v16137=v12464+8;
+  int v16138=v4669+0;
+  int v16139=v3534+0;
+  int v16140=v8364+4;
+  int v16141=v13406+6;
+  int v16142=v13552+6;
+  int v16143=v7140+9;
+  int v16144=v15693+5;
+  int v16145=v222+2;
+  int v16146=v10850+3;
+  int v16147=v15661+3;
+  int v16148=v15298+0;
+  int v16149=v4283+5;
+  int v16150=v14680+6;
+  int v16151=v1423+4;
+  int v16152=v931+7;
+  int v16153=v2942+5;
+  int v16154=v15895+0;
+  int v16155=v13412+3;
+  int v16156=v13691+2;
+  int v16157=v4735+5;
+  int v16158=v2786+4;
+  int v16159=v1110+8;
+  int v16160=v14697+4;
+  int v16161=v4172+3;
+  int v16162=v4498+1;
+  int v16163=v10925+5;
+  int v16164=v7084+2;
+  int v16165=v14771+1;
+  int v16166=v4440+4;
+  int v16167=v13350+6;
+  int v16168=v4073+4;
+  int v16169=v11852+4;
+  int v16170=v2939+5;
+  int v16171=v1989+2;
+  int v16172=v1148+8;
+  int v16173=v4568+9;
+  int v16174=v13357+7;
+  int v16175=v11566+0;
+  int v16176=v13979+7;
+  int v16177=v14388+4;
+  int v16178=v3177+5;
+  int v16179=v15001+9;
+  int v16180=v9842+0;
+  int v16181=v9300+4;
+  int v16182=v5205+9;
+  int v16183=v4390+0;
+  int v16184=v7120+0;
+  int v16185=v13462+0;
+  int v16186=v13473+8;
+  int v16187=v9152+9;
+  int v16188=v11584+9;
+  int v16189=v5174+1;
+  int v16190=v7822+1;
+  int v16191=v3240+3;
+  int v16192=v13267+4;
+  int v16193=v14837+8;
+  int v16194=v8590+3;
+  int v16195=v3621+4;
+  int v16196=v9027+3;
+  int v16197=v3026+2;
+  int v16198=v11167+8;
+  int v16199=v2842+0;
+  int v16200=v13922+8;
+  int v16201=v5357+6;
+  int v16202=v11138+2;
+  int v16203=v10217+9;
+  int v16204=v11375+4;
+  int v16205=v7754+8;
+  int v16206=v2096+7;
+  int v16207=v6588+9;
+  int v16208=v12805+5;
+  int v16209=v12665+0;
+  int v16210=v9063+1;
+  int v16211=v2375+6;
+  int v16212=v13935+7;
+  int v16213=v12277+7;
+  int v16214=v14021+1;
+  int v16215=v2118+5;
+  int v16216=v14061+3;
+  int v16217=v13490+4;
+  int v16218=v14840+6;
+  int v16219=v4308+4;
+  int v16220=v16133+2;
+  int v16221=v5498+5;
+  int v16222=v3179+6;
+  int v16223=v14173+7;
+  int v16224=v14668+7;
+  int v16225=v3042+6;
+  int v16226=v12075+4;
+  int v16227=v10266+3;
+  int v16228=v9547+8;
+  int v16229=v3009+1;
+  int v16230=v7893+8;
+  int v16231=v14180+4;
+  int v16232=v14588+1;
+  int v16233=v15708+9;
+  int v16234=v5846+0;
+  int v16235=v4948+5;
+  int v16236=v4348+3;
+  int v16237=v9572+1;
+  int v16238=v4828+6;
+  int v16239=v11028+5;
+  int v16240=v7688+4;
+  int v16241=v3428+3;
+  int v16242=v14272+3;
+  int v16243=v7514+9;
+  int v16244=v15130+0;
+  int v16245=v134+8;
+  int v16246=v6002+3;
+  int v16247=v6159+6;
+  int v16248=v8413+1;
+  int v16249=v5621+7;
+  int v16250=v10521+1;
+  int v16251=v15621+6;
+  int v16252=v10012+4;
+  int v16253=v4398+2;
+  int v16254=v9720+2;
+  int v16255=v13055+9;
+  int v16256=v14324+1;
+  int v16257=v6027+5;
+  int v16258=v8843+0;
+  int v16259=v4974+3;
+  int v16260=v3340+8;
+  int v16261=v7058+2;
+  int v16262=v8680+9;
+  int v16263=v3748+4;
+  int v16264=v16251+5;
+  int v16265=v6179+5;
+  int v16266=v1396+4;
+  int v16267=v5246+3;
+  int v16268=v13944+7;
+  int v16269=v3686+2;
+  int v16270=v2618+4;
+  int v16271=v6936+8;
+  int v16272=v5679+5;
+  int v16273=v11438+9;
+  int v16274=v678+1;
+  int v16275=v9448+2;
+  int v16276=v8636+9;
+  int v16277=v14949+1;
+  int v16278=v10684+5;
+  int v16279=v12453+9;
+  int v16280=v9285+6;
+  int v16281=v12055+6;
+  int v16282=v8619+7;
+  int v16283=v4995+3;
+  int v16284=v5178+3;
+  int v16285=v3773+2;
+  int v16286=v313+0;
+  int v16287=v5920+9;
+  int v16288=v7976+8;
+  int v16289=v10585+1;
+  int v16290=v9670+8;
+  int v16291=v12494+7;
+  int v16292=v227+5;
+  int v16293=v7467+3;
+  int v16294=v13840+7;
+  int v16295=v11975+5;
+  int v16296=v4873+7;
+  int v16297=v5862+0;
+  int v16298=v11182+6;
+  int v16299=v5911+0;
+  int v16300=v16097+2;
+  int v16301=v14068+0;
+  int v16302=v11296+7;
+  int v16303=v4152+7;
+  int v16304=v1490+1;
+  int v16305=v8040+2;
+  int v16306=v9397+6;
+  int v16307=v9209+0;
+  int v16308=v4784+6;
+  int v16309=v11634+6;
+  int v16310=v6988+4;
+  int v16311=v12775+2;
+  int v16312=v1236+9;
+  int v16313=v11188+3;
+  int v16314=v16104+8;
+  int v16315=v3309+8;
+  int v16316=v10626+9;
+  int v16317=v9563+4;
+  int v16318=v13640+7;
+  int v16319=v12276+4;
+  int v16320=v2466+0;
+  int v16321=v2764+3;
+  int v16322=v1300+0;
+  int v16323=v3669+2;
+  int v16324=v1335+2;
+  int v16325=v9407+5;
+  int v16326=v2573+9;
+  int v16327=v2053+7;
+  int v16328=v1726+8;
+  int v16329=v14575+2;
+  int v16330=v10583+6;
+  int v16331=v6460+6;
+  int v16332=v12068+2;
+  int v16333=v11878+4;
+  int v16334=v7046+9;
+  int v16335=v12838+2;
+  int v16336=v14663+3;
+  int v16337=v16176+2;
+  int v16338=v14156+4;
+  int v16339=v14758+0;
+  int v16340=v4286+4;
+  int v16341=v15630+6;
+  int v16342=v2270+1;
+  int v16343=v14034+3;
+  int v16344=v675+8;
+  int v16345=v15660+3;
+  int v16346=v4934+9;
+  int v16347=v9811+1;
+  int v16348=v10499+1;
+  int v16349=v9137+0;
+  int v16350=v3766+6;
+  int v16351=v2894+6;
+  int v16352=v7646+7;
+  int v16353=v9088+4;
+  int v16354=v10412+0;
+  int v16355=v2207+6;
+  int v16356=v5331+6;
+  int v16357=v1703+0;
+  int v16358=v12827+0;
+  int v16359=v14842+2;
+  int v16360=v14447+2;
+  int v16361=v13429+8;
+  int v16362=v10123+6;
+  int v16363=v5085+9;
+  int v16364=v8493+5;
+  int v16365=v8595+9;
+  int v16366=v4963+6;
+  int v16367=v6017+1;
+  int v16368=v8403+0;
+  int v16369=v12209+3;
+  int v16370=v11035+1;
+  int v16371=v4490+5;
+  int v16372=v8568+3;
+  int v16373=v8720+8;
+  int v16374=v8254+6;
+  int v16375=v15957+0;
+  int v16376=v11254+0;
+  int v16377=v1689+6;
+  int v16378=v12212+4;
+  int v16379=v10893+0;
+  int v16380=v1773+7;
+  int v16381=v8980+1;
+  int v16382=v5892+8;
+  int v16383=v4603+3;
+  int v16384=v12019+1;
+  int v16385=v3026+5;
+  int v16386=v6100+0;
+  int v16387=v13902+9;
+  int v16388=v7550+4;
+  int v16389=v7634+9;
+  int v16390=v13311+3;
+  int v16391=v4833+2;
+  int v16392=v14354+7;
+  int v16393=v11212+0;
+  int v16394=v14779+4;
+  int v16395=v241+8;
+  int v16396=v15154+8;
+  int v16397=v5566+7;
+  int v16398=v2850+5;
+  int v16399=v8574+2;
+  int v16400=v5386+3;
+  int v16401=v15584+8;
+  int v16402=v6348+1;
+  int v16403=v10466+3;
+  int v16404=v15265+3;
+  int v16405=v9223+7;
+  int v16406=v11209+0;
+  int v16407=v5488+6;
+  int v16408=v2321+6;
+  int v16409=v190+0;
+  int v16410=v8071+1;
+  int v16411=v13843+2;
+  int v16412=v447+0;
+  int v16413=v470+7;
+  int v16414=v5211+7;
+  int v16415=v13807+2;
+  int v16416=v2967+0;
+  int v16417=v1436+2;
+  int v16418=v11149+0;
+  int v16419=v13431+5;
+  int v16420=v12677+1;
+  int v16421=v6218+5;
+  int v16422=v380+0;
+  int v16423=v6749+9;
+  int v16424=v9753+0;
+  int v16425=v1077+6;
+  int v16426=v11103+2;
+  int v16427=v9158+3;
+  int v16428=v6997+6;
+  int v16429=v13953+6;
+  int v16430=v7346+5;
+  int v16431=v2524+8;
+  int v16432=v6955+4;
+  int v16433=v13907+4;
+  int v16434=v2228+5;
+  int v16435=v2921+2;
+  int v16436=v2542+9;
+  int v16437=v10887+6;
+  int v16438=v15503+9;
+  int v16439=v9891+9;
+  int v16440=v9869+7;
+  int v16441=v1432+4;
+  int v16442=v14738+3;
+  int v16443=v10938+0;
+  int v16444=v2629+5;
+  int v16445=v10467+4;
+  int v16446=v13883+7;
+  int v16447=v12402+9;
+  int v16448=v1246+7;
+  int v16449=v13583+6;
+  int v16450=v6712+4;
+  int v16451=v16352+7;
+  int v16452=v14126+7;
+  int v16453=v1984+1;
+  int v16454=v16129+7;
+  int v16455=v7391+8;
+  int v16456=v412+4;
+  int v16457=v754+7;
+  int v16458=v7340+1;
+  int v16459=v5686+0;
+  int v16460=v14020+0;
+  int v16461=v11306+2;
+  int v16462=v4211+4;
+  int v16463=v4966+5;
+  int v16464=v16423+1;
+  int v16465=v6426+5;
+  int v16466=v3130+3;
+  int v16467=v2439+4;
+  int v16468=v9342+5;
+  int v16469=v12154+9;
+  int v16470=v11830+8;
+  int v16471=v7193+5;
+  int v16472=v442+1;
+  int v16473=v13335+7;
+  int v16474=v9603+2;
+  int v16475=v10120+6;
+  int v16476=v14098+5;
+  int v16477=v9940+2;
+  int v16478=v430+5;
+  int v16479=v14145+0;
+  int v16480=v7737+3;
+  int v16481=v13623+0;
+  int v16482=v4611+6;
+  int v16483=v2964+6;
+  int v16484=v3958+8;
+  int v16485=v5415+2;
+  int v16486=v6633+0;
+  int v16487=v12856+2;
+  int v16488=v8449+7;
+  int v16489=v136+8;
+  int v16490=v13815+8;
+  int v16491=v2581+2;
+  int v16492=v4391+9;
+  int v16493=v12651+6;
+  int v16494=v12569+7;
+  int v16495=v11973+0;
+  int v16496=v4986+0;
+  int v16497=v2438+1;
+  int v16498=v10715+8;
+  int v16499=v8417+7;
+  int v16500=v5090+6;
+  int v16501=v8316+2;
+  int v16502=v6488+9;
+  int v16503=v1762+4;
+  int v16504=v12933+5;
+  int v16505=v7748+4;
+  int v16506=v5241+9;
+  int v16507=v643+4;
+  int v16508=v6870+0;
+  int v16509=v11412+6;
+  int v16510=v180+7;
+  int v16511=v6102+3;
+  int v16512=v13114+4;
+  int v16513=v13315+3;
+  int v16514=v6936+7;
+  int v16515=v1808+8;
+  int v16516=v10022+4;
+  int v16517=v4057+5;
+  int v16518=v10527+6;
+  int v16519=v7329+4;
+  int v16520=v3639+8;
+  int v16521=v3543+4;
+  int v16522=v10705+9;
+  int v16523=v10272+7;
+  int v16524=v10896+7;
+  int v16525=v9545+0;
+  int v16526=v12920+2;
+  int v16527=v1769+1;
+  int v16528=v13328+2;
+  int v16529=v14292+0;
+  int v16530=v6687+8;
+  int v16531=v6094+4;
+  int v16532=v3633+2;
+  int v16533=v145+6;
+  int v16534=v7708+1;
+  int v16535=v6191+2;
+  int v16536=v9267+4;
+  int v16537=v15427+9;
+  int v16538=v974+4;
+  int v16539=v6729+9;
+  int v16540=v10765+0;
+  int v16541=v9031+8;
+  int v16542=v5027+3;
+  int v16543=v15655+1;
+  int v16544=v1647+2;
+  int v16545=v13533+7;
+  int v16546=v16434+4;
+  int v16547=v7675+9;
+  int v16548=v1392+5;
+  int v16549=v5253+9;
+  int v16550=v10826+7;
+  int v16551=v7406+4;
+  int v16552=v12224+9;
+  int v16553=v15645+4;
+  int v16554=v6450+6;
+  int v16555=v15395+2;
+  int v16556=v13850+1;
+  int v16557=v13290+6;
+  int v16558=v10687+4;
+  int v16559=v7445+0;
+  int v16560=v7570+4;
+  int v16561=v2168+8;
+  int v16562=v688+3;
+  int v16563=v7202+2;
+  int v16564=v8870+1;
+  int v16565=v7120+2;
+  int v16566=v8476+9;
+  int v16567=v11012+5;
+  int v16568=v4550+4;
+  int v16569=v15980+6;
+  int v16570=v6079+9;
+  int v16571=v1286+0;
+  int v16572=v5283+9;
+  int v16573=v7797+0;
+  int v16574=v1873+9;
+  int v16575=v15989+4;
+  int v16576=v8836+7;
+  int v16577=v7945+6;
+  int v16578=v12668+1;
+  int v16579=v2145+3;
+  int v16580=v3324+7;
+  int v16581=v15451+7;
+  int v16582=v1306+7;
+  int v16583=v3282+0;
+  int v16584=v10708+3;
+  int v16585=v1880+0;
+  int v16586=v737+7;
+  int v16587=v14223+1;
+  int v16588=v12528+5;
+  int v16589=v8404+7;
+  int v16590=v5651+6;
+  int v16591=v9881+0;
+  int v16592=v10088+0;
+  int v16593=v12310+1;
+  int v16594=v10395+5;
+  int v16595=v10874+8;
+  int v16596=v2663+4;
+  int v16597=v2558+4;
+  int v16598=v5487+0;
+  int v16599=v8026+8;
+  int v16600=v4790+4;
+  int v16601=v9510+1;
+  int v16602=v3696+7;
+  int v16603=v1425+7;
+  int v16604=v12260+4;
+  int v16605=v8057+6;
+  int v16606=v7821+2;
+  int v16607=v10106+9;
+  int v16608=v3812+8;
+  int v16609=v2148+2;
+  int v16610=v717+8;
+  int v16611=v9105+6;
+  int v16612=v15429+9;
+  int v16613=v4343+5;
+  int v16614=v6917+4;
+  int v16615=v13151+3;
+  int v16616=v3068+5;
+  int v16617=v5870+5;
+  int v16618=v14592+6;
+  int v16619=v6251+5;
+  int v16620=v8159+5;
+  int v16621=v8093+7;
+  int v16622=v2678+5;
+  int v16623=v2821+7;
+  int v16624=v2632+4;
+  int v16625=v10441+6;
+  int v16626=v9135+0;
+  int v16627=v3639+2;
+  int v16628=v16491+0;
+  int v16629=v6502+0;
+  int v16630=v2122+7;
+  int v16631=v12496+5;
+  int v16632=v680+6;
+  int v16633=v13462+5;
+  int v16634=v720+5;
+  int v16635=v7130+3;
+  int v16636=v8064+5;
+  int v16637=v7354+4;
+  int v16638=v13477+4;
+  int v16639=v2146+6;
+  int v16640=v5144+5;
+  int v16641=v13115+3;
+  int v16642=v16063+0;
+  int v16643=v8411+1;
+  int v16644=v9017+6;
+  int v16645=v12526+2;
+  int v16646=v953+4;
+  int v16647=v14822+0;
+  int v16648=v5828+8;
+  int v16649=v4691+2;
+  int v16650=v2055+4;
+  int v16651=v3734+5;
+  int v16652=v5003+6;
+  int v16653=v1048+2;
+  int v16654=v12364+9;
+  int v16655=v1340+8;
+  int v16656=v15765+1;
+  int v16657=v15521+8;
+  int v16658=v15539+9;
+  int v16659=v16486+7;
+  int v16660=v2976+2;
+  int v16661=v1039+7;
+  int v16662=v7059+6;
+  int v16663=v5165+3;
+  int v16664=v3962+0;
+  int v16665=v14130+3;
+  int v16666=v4057+9;
+  int v16667=v8662+2;
+  int v16668=v12188+7;
+  int v16669=v5363+0;
+  int v16670=v4291+0;
+  int v16671=v13097+0;
+  int v16672=v7942+3;
+  int v16673=v5767+5;
+  int v16674=v5524+2;
+  int v16675=v785+9;
+  int v16676=v5701+7;
+  int v16677=v4965+3;
+  int v16678=v16269+2;
+  int v16679=v5587+7;
+  int v16680=v9176+5;
+  int v16681=v2561+7;
+  int v16682=v9372+3;
+  int v16683=v9484+1;
+  int v16684=v543+7;
+  int v16685=v6869+9;
+  int v16686=v15929+8;
+  int v16687=v7910+8;
+  int v16688=v7585+1;
+  int v16689=v3657+1;
+  int v16690=v383+0;
+  int v16691=v5914+0;
+  int v16692=v5666+0;
+  int v16693=v13954+7;
+  int v16694=v2765+4;
+  int v16695=v10575+6;
+  int v16696=v3342+8;
+  int v16697=v2015+0;
+  int v16698=v1619+6;
+  int v16699=v11977+8;
+  int v16700=v12913+8;
+  int v16701=v1184+6;
+  int v16702=v1111+9;
+  int v16703=v13585+1;
+  int v16704=v9076+4;
+  int v16705=v3870+4;
+  int v16706=v2084+5;
+  int v16707=v16020+5;
+  int v16708=v1264+9;
+  int v16709=v7973+3;
+  int v16710=v15134+9;
+  int v16711=v9596+9;
+  int v16712=v3025+9;
+  int v16713=v4028+9;
+  int v16714=v7995+8;
+  int v16715=v3042+7;
+  int v16716=v5899+4;
+  int v16717=v6527+3;
+  int v16718=v1274+1;
+  int v16719=v879+7;
+  int v16720=v11373+7;
+  int v16721=v6112+4;
+  int v16722=v12381+1;
+  int v16723=v3012+3;
+  int v16724=v9440+5;
+  int v16725=v6119+8;
+  int v16726=v14509+4;
+  int v16727=v13070+6;
+  int v16728=v3092+9;
+  int v16729=v6143+9;
+  int v16730=v7772+8;
+  int v16731=v3617+8;
+  int v16732=v10763+7;
+  int v16733=v10142+6;
+  int v16734=v12351+3;
+  int v16735=v3716+6;
+  int v16736=v11941+1;
+  int v16737=v9402+2;
+  int v16738=v10757+4;
+  int v16739=v2426+8;
+  int v16740=v2168+6;
+  int v16741=v1831+3;
+  int v16742=v5770+5;
+  int v16743=v2372+2;
+  int v16744=v2727+6;
+  int v16745=v1041+3;
+  int v16746=v5127+9;
+  int v16747=v9814+0;
+  int v16748=v7178+8;
+  int v16749=v13412+7;
+  int v16750=v12778+8;
+  int v16751=v3865+8;
+  int v16752=v9271+7;
+  int v16753=v524+2;
+  int v16754=v9085+9;
+  int v16755=v575+1;
+  int v16756=v1766+0;
+  int v16757=v4709+8;
+  int v16758=v14478+6;
+  int v16759=v3973+6;
+  int v16760=v6587+7;
+  int v16761=v16077+3;
+  int v16762=v8459+6;
+  int v16763=v5541+0;
+  int v16764=v7814+6;
+  int v16765=v5257+8;
+  int v16766=v13518+7;
+  int v16767=v14248+7;
+  int v16768=v2554+2;
+  int v16769=v39+1;
+  int v16770=v5409+8;
+  int v16771=v13733+3;
+  int v16772=v7798+5;
+  int v16773=v13908+1;
+  int v16774=v14583+6;
+  int v16775=v14286+9;
+  int v16776=v1513+9;
+  int v16777=v7817+6;
+  int v16778=v9298+9;
+  int v16779=v3352+7;
+  int v16780=v9558+9;
+  int v16781=v1246+9;
+  int v16782=v11938+9;
+  int v16783=v11320+5;
+  int v16784=v1419+3;
+  int v16785=v1150+8;
+  int v16786=v5271+8;
+  int v16787=v11126+3;
+  int v16788=v13437+3;
+  int v16789=v3479+8;
+  int v16790=v826+4;
+  int v16791=v13137+2;
+  int v16792=v2945+7;
+  int v16793=v14424+1;
+  int v16794=v1325+7;
+  int v16795=v5205+8;
+  int v16796=v11876+0;
+  int v16797=v15075+0;
+  int v16798=v16020+2;
+  int v16799=v1620+5;
+  int v16800=v6195+9;
+  int v16801=v16587+1;
+  int v16802=v2505+8;
+  int v16803=v14118+3;
+  int v16804=v8862+8;
+  int v16805=v10691+9;
+  int v16806=v7507+6;
+  int v16807=v16170+5;
+  int v16808=v905+5;
+  int v16809=v5818+0;
+  int v16810=v11621+1;
+  int v16811=v3750+0;
+  int v16812=v3720+1;
+  int v16813=v15997+0;
+  int v16814=v7418+4;
+  int v16815=v12792+0;
+  int v16816=v14371+2;
+  int v16817=v8222+8;
+  int v16818=v8615+0;
+  int v16819=v7162+1;
+  int v16820=v9679+5;
+  int v16821=v6755+9;
+  int v16822=v1772+5;
+  int v16823=v6178+2;
+  int v16824=v4672+1;
+  int v16825=v15506+7;
+  int v16826=v4288+9;
+  int v16827=v4216+7;
+  int v16828=v1290+9;
+  int v16829=v9840+4;
+  int v16830=v16236+0;
+  int v16831=v1816+0;
+  int v16832=v1645+0;
+  int v16833=v1405+5;
+  int v16834=v11630+4;
+  int v16835=v9406+1;
+  int v16836=v5514+7;
+  int v16837=v2014+0;
+  int v16838=v12712+2;
+  int v16839=v13997+6;
+  int v16840=v1786+1;
+  int v16841=v12869+1;
+  int v16842=v1700+3;
+  int v16843=v5872+4;
+  int v16844=v15507+4;
+  int v16845=v4174+6;
+  int v16846=v4977+8;
+  int v16847=v12065+8;
+  int v16848=v16393+4;
+  int v16849=v4758+3;
+  int v16850=v15994+5;
+  int v16851=v5918+8;
+  int v16852=v9103+6;
+  int v16853=v7274+2;
+  int v16854=v2780+3;
+  int v16855=v5481+9;
+  int v16856=v6193+0;
+  int v16857=v7216+2;
+  int v16858=v1113+3;
+  int v16859=v3967+3;
+  int v16860=v2545+0;
+  int v16861=v8876+3;
+  int v16862=v15810+2;
+  int v16863=v13121+2;
+  int v16864=v2147+7;
+  int v16865=v5167+3;
+  int v16866=v7766+8;
+  int v16867=v12799+7;
+  int v16868=v4353+0;
+  int v16869=v2046+5;
+  int v16870=v6094+6;
+  int v16871=v462+4;
+  int v16872=v12196+1;
+  int v16873=v10144+5;
+  int v16874=v9601+1;
+  int v16875=v5964+4;
+  int v16876=v2376+6;
+  int v16877=v1788+6;
+  int v16878=v12725+3;
+  int v16879=v14174+7;
+  int v16880=v6067+8;
+  int v16881=v14225+4;
+  int v16882=v14485+1;
+  int v16883=v12162+8;
+  int v16884=v196+1;
+  int v16885=v8700+8;
+  int v16886=v12428+8;
+  int v16887=v14285+7;
+  int v16888=v3196+7;
+  int v16889=v13291+4;
+  int v16890=v7426+4;
+  int v16891=v9869+2;
+  int v16892=v3518+0;
+  int v16893=v6443+1;
+  int v16894=v12536+9;
+  int v16895=v2738+9;
+  int v16896=v16753+3;
+  int v16897=v9192+7;
+  int v16898=v8466+2;
+  int v16899=v16734+8;
+  int v16900=v12629+6;
+  int v16901=v10035+0;
+  int v16902=v11988+3;
+  int v16903=v1295+3;
+  int v16904=v9582+8;
+  int v16905=v8389+3;
+  int v16906=v7623+0;
+  int v16907=v8719+2;
+  int v16908=v10846+3;
+  int v16909=v1337+4;
+  int v16910=v15036+6;
+  int v16911=v4421+2;
+  int v16912=v2341+8;
+  int v16913=v12615+8;
+  int v16914=v10124+9;
+  int v16915=v6895+6;
+  int v16916=v7845+3;
+  int v16917=v9218+3;
+  int v16918=v2715+0;
+  int v16919=v15898+0;
+  int v16920=v11805+0;
+  int v16921=v5293+4;
+  int v16922=v4258+1;
+  int v16923=v997+3;
+  int v16924=v15546+6;
+  int v16925=v14529+9;
+  int v16926=v2669+3;
+  int v16927=v10315+3;
+  int v16928=v14348+8;
+  int v16929=v9751+0;
+  int v16930=v11657+4;
+  int v16931=v3342+7;
+  int v16932=v12946+9;
+  int v16933=v13850+3;
+  int v16934=v13047+7;
+  int v16935=v9291+6;
+  int v16936=v4916+6;
+  int v16937=v6700+1;
+  int v16938=v2515+2;
+  int v16939=v11528+6;
+  int v16940=v10128+9;
+  int v16941=v8160+9;
+  int v16942=v12588+1;
+  int v16943=v12681+3;
+  int v16944=v6083+6;
+  int v16945=v13338+3;
+  int v16946=v15969+9;
+  int v16947=v11234+4;
+  int v16948=v4653+2;
+  int v16949=v4658+4;
+  int v16950=v12587+7;
+  int v16951=v16807+2;
+  int v16952=v6081+0;
+  int v16953=v2028+2;
+  int v16954=v10556+2;
+  int v16955=v9947+4;
+  int v16956=v13963+0;
+  int v16957=v4795+7;
+  int v16958=v1378+5;
+  int v16959=v14078+7;
+  int v16960=v3725+8;
+  int v16961=v1849+9;
+  int v16962=v14816+8;
+  int v16963=v857+1;
+  int v16964=v13391+0;
+  int v16965=v13778+1;
+  int v16966=v1874+9;
+  int v16967=v14383+7;
+  int v16968=v3712+4;
+  int v16969=v9139+8;
+  int v16970=v13116+6;
+  int v16971=v8263+4;
+  int v16972=v8692+8;
+  int v16973=v14771+4;
+  int v16974=v15722+2;
+  int v16975=v5994+9;
+  int v16976=v10190+0;
+  int v16977=v6438+1;
+  int v16978=v4282+0;
+  int v16979=v4711+5;
+  int v16980=v13969+4;
+  int v16981=v9327+1;
+  int v16982=v15544+2;
+  int v16983=v3287+5;
+  int v16984=v4682+5;
+  int v16985=v9210+7;
+  int v16986=v12121+2;
+  int v16987=v2982+1;
+  int v16988=v15763+4;
+  int v16989=v16166+9;
+  int v16990=v8371+4;
+  int v16991=v11911+8;
+  int v16992=v14022+1;
+  int v16993=v1098+5;
+  int v16994=v7219+4;
+  int v16995=v4914+3;
+  int v16996=v12746+3;
+  int v16997=v9663+4;
+  int v16998=v1313+2;
+  int v16999=v10946+5;
+  int v17000=v7116+8;
+  int v17001=v3629+8;
+  int v17002=v11945+5;
+  int v17003=v9632+4;
+  int v17004=v1733+3;
+  int v17005=v9996+3;
+  int v17006=v14118+2;
+  int v17007=v11094+9;
+  int v17008=v3957+3;
+  int v17009=v10457+3;
+  int v17010=v15592+8;
+  int v17011=v1135+5;
+  int v17012=v1907+3;
+  int v17013=v6710+8;
+  int v17014=v16611+5;
+  int v17015=v15752+7;
+  int v17016=v3166+2;
+  int v17017=v6657+8;
+  int v17018=v4591+1;
+  int v17019=v15811+5;
+  int v17020=v14412+9;
+  int v17021=v4007+3;
+  int v17022=v9954+4;
+  int v17023=v4185+2;
+  int v17024=v6826+8;
+  int v17025=v1885+1;
+  int v17026=v7772+8;
+  int v17027=v8588+4;
+  int v17028=v15207+7;
+  int v17029=v14430+7;
+  int v17030=v1976+9;
+  int v17031=v11274+3;
+  int v17032=v3510+6;
+  int v17033=v10562+2;
+  int v17034=v5647+8;
+  int v17035=v15129+9;
+  int v17036=v4925+7;
+  int v17037=v1747+3;
+  int v17038=v5061+3;
+  int v17039=v5402+1;
+  int v17040=v10742+3;
+  int v17041=v14490+2;
+  int v17042=v7883+7;
+  int v17043=v15520+4;
+  int v17044=v6111+1;
+  int v17045=v458+2;
+  int v17046=v10879+0;
+  int v17047=v18+5;
+  int v17048=v6180+1;
+  int v17049=v8958+5;
+  int v17050=v357+6;
+  int v17051=v2831+5;
+  int v17052=v5834+8;
+  int v17053=v4269+3;
+  int v17054=v9840+5;
+  int v17055=v11419+8;
+  int v17056=v10089+8;
+  int v17057=v14717+8;
+  int v17058=v10890+6;
+  int v17059=v13535+4;
+  int v17060=v4569+1;
+  int v17061=v505+0;
+  int v17062=v929+1;
+  int v17063=v7590+1;
+  int v17064=v3058+2;
+  int v17065=v2846+1;
+  int v17066=v10368+6;
+  int v17067=v11756+2;
+  int v17068=v2180+0;
+  int v17069=v9320+0;
+  int v17070=v7031+7;
+  int v17071=v14844+1;
+  int v17072=v7611+6;
+  int v17073=v16796+0;
+  int v17074=v1408+7;
+  int v17075=v1146+4;
+  int v17076=v12886+2;
+  int v17077=v16524+6;
+  int v17078=v11756+6;
+  int v17079=v14951+8;
+  int v17080=v9463+1;
+  int v17081=v6610+0;
+  int v17082=v1579+2;
+  int v17083=v7006+4;
+  int v17084=v13962+5;
+  int v17085=v12189+2;
+  int v17086=v1014+1;
+  int v17087=v395+4;
+  int v17088=v8723+3;
+  int v17089=v2280+8;
+  int v17090=v13416+0;
+  int v17091=v2590+2;
+  int v17092=v14809+2;
+  int v17093=v1815+2;
+  int v17094=v3902+7;
+  int v17095=v15908+0;
+  int v17096=v11733+7;
+  int v17097=v5646+4;
+  int v17098=v6170+8;
+  int v17099=v3733+8;
+  int v17100=v1833+4;
+  int v17101=v14576+2;
+  int v17102=v4288+5;
+  int v17103=v7433+2;
+  int v17104=v15951+3;
+  int v17105=v10246+5;
+  int v17106=v3703+3;
+  int v17107=v11405+9;
+  int v17108=v9728+1;
+  int v17109=v12753+5;
+  int v17110=v10535+4;
+  int v17111=v15401+2;
+  int v17112=v12395+9;
+  int v17113=v11910+7;
+  int v17114=v15937+7;
+  int v17115=v2005+1;
+  int v17116=v8804+3;
+  int v17117=v6774+4;
+  int v17118=v1338+3;
+  int v17119=v5853+0;
+  int v17120=v17043+2;
+  int v17121=v6689+6;
+  int v17122=v2425+4;
+  int v17123=v12397+9;
+  int v17124=v4429+3;
+  int v17125=v10117+6;
+  int v17126=v7731+4;
+  int v17127=v12989+2;
+  int v17128=v447+0;
+  int v17129=v10300+5;
+  int v17130=v3783+7;
+  int v17131=v7100+2;
+  int v17132=v503+2;
+  int v17133=v6672+1;
+  int v17134=v1961+0;
+  int v17135=v7652+7;
+  int v17136=v16074+4;
+  int v17137=v7068+6;
+  int v17138=v3966+4;
+  int v17139=v12426+5;
+  int v17140=v5193+3;
+  int v17141=v14878+0;
+  int v17142=v14012+4;
+  int v17143=v7907+5;
+  int v17144=v8799+4;
+  int v17145=v4494+7;
+  int v17146=v1174+8;
+  int v17147=v9869+3;
+  int v17148=v7207+1;
+  int v17149=v3151+4;
+  int v17150=v469+3;
+  int v17151=v2789+4;
+  int v17152=v11253+9;
+  int v17153=v12957+4;
+  int v17154=v13080+3;
+  int v17155=v7667+2;
+  int v17156=v9770+0;
+  int v17157=v9706+4;
+  int v17158=v9872+3;
+  int v17159=v3965+1;
+  int v17160=v15175+2;
+  int v17161=v14759+7;
+  int v17162=v3564+4;
+  int v17163=v2608+4;
+  int v17164=v129+4;
+  int v17165=v2742+1;
+  int v17166=v7647+9;
+  int v17167=v13110+8;
+  int v17168=v2976+5;
+  int v17169=v7674+0;
+  int v17170=v860+9;
+  int v17171=v743+9;
+  int v17172=v14451+1;
+  int v17173=v147+5;
+  int v17174=v11766+6;
+  int v17175=v5480+5;
+  int v17176=v2201+2;
+  int v17177=v7468+6;
+  int v17178=v13335+6;
+  int v17179=v1648+4;
+  int v17180=v8897+2;
+  int v17181=v3144+5;
+  int v17182=v4353+1;
+  int v17183=v14727+3;
+  int v17184=v8576+0;
+  int v17185=v16285+9;
+  int v17186=v5207+1;
+  int v17187=v5523+5;
+  int v17188=v1119+8;
+  int v17189=v9814+6;
+  int v17190=v3447+2;
+  int v17191=v6164+9;
+  int v17192=v16420+5;
+  int v17193=v2314+9;
+  int v17194=v8626+4;
+  int v17195=v12416+6;
+  int v17196=v10699+1;
+  int v17197=v14895+2;
+  int v17198=v7950+3;
+  int v17199=v10494+6;
+  int v17200=v14023+2;
+  int v17201=v15075+9;
+  int v17202=v3178+7;
+  int v17203=v4723+1;
+  int v17204=v12819+5;
+  int v17205=v15708+0;
+  int v17206=v343+0;
+  int v17207=v6845+5;
+  int v17208=v15926+7;
+  int v17209=v14486+3;
+  int v17210=v13161+9;
+  int v17211=v13556+1;
+  int v17212=v17053+5;
+  int v17213=v17006+8;
+  int v17214=v8111+8;
+  int v17215=v4611+5;
+  int v17216=v1438+8;
+  int v17217=v3320+0;
+  int v17218=v1533+8;
+  int v17219=v5261+1;
+  int v17220=v1833+9;
+  int v17221=v6192+2;
+  int v17222=v16422+9;
+  int v17223=v163+4;
+  int v17224=v14352+0;
+  int v17225=v15992+5;
+  int v17226=v3689+0;
+  int v17227=v5882+8;
+  int v17228=v5148+1;
+  int v17229=v14697+8;
+  int v17230=v8284+1;
+  int v17231=v5790+0;
+  int v17232=v17056+0;
+  int v17233=v10916+2;
+  int v17234=v11034+8;
+  int v17235=v12702+5;
+  int v17236=v15946+8;
+  int v17237=v11802+1;
+  int v17238=v4782+7;
+  int v17239=v1469+9;
+  int v17240=v12329+3;
+  int v17241=v15294+5;
+  int v17242=v14928+5;
+  int v17243=v14574+6;
+  int v17244=v4581+9;
+  int v17245=v11085+5;
+  int v17246=v8074+2;
+  int v17247=v4432+4;
+  int v17248=v658+6;
+  int v17249=v3377+9;
+  int v17250=v15575+9;
+  int v17251=v12903+9;
+  int v17252=v10015+7;
+  int v17253=v8810+6;
+  int v17254=v3716+9;
+  int v17255=v5956+6;
+  int v17256=v6790+3;
+  int v17257=v17038+0;
+  int v17258=v4901+0;
+  int v17259=v6591+0;
+  int v17260=v14580+2;
+  int v17261=v9752+2;
+  int v17262=v12915+8;
+  int v17263=v3499+9;
+  int v17264=v779+8;
+  int v17265=v4028+7;
+  int v17266=v11696+1;
+  int v17267=v8387+4;
+  int v17268=v12665+2;
+  int v17269=v3302+7;
+  int v17270=v16368+7;
+  int v17271=v14932+2;
+  int v17272=v4827+5;
+  int v17273=v8998+6;
+  int v17274=v13484+5;
+  int v17275=v8321+6;
+  int v17276=v10492+9;
+  int v17277=v11412+6;
+  int v17278=v10188+1;
+  int v17279=v438+4;
+  int v17280=v15167+6;
+  int v17281=v14374+7;
+  int v17282=v2254+6;
+  int v17283=v6883+3;
+  int v17284=v15490+1;
+  int v17285=v11530+0;
+  int v17286=v9503+2;
+  int v17287=v10489+7;
+  int v17288=v16549+5;
+  int v17289=v7532+3;
+  int v17290=v4814+0;
+  int v17291=v1259+0;
+  int v17292=v16396+5;
+  int v17293=v12624+6;
+  int v17294=v2835+4;
+  int v17295=v11027+5;
+  int v17296=v327+0;
+  int v17297=v15833+8;
+  int v17298=v13696+0;
+  int v17299=v5340+1;
+  int v17300=v12177+9;
+  int v17301=v17016+1;
+  int v17302=v15611+8;
+  int v17303=v6688+7;
+  int v17304=v16234+2;
+  int v17305=v1006+4;
+  int v17306=v5902+4;
+  int v17307=v10059+4;
+  int v17308=v8402+2;
+  int v17309=v2073+5;
+  int v17310=v14457+4;
+  int v17311=v15341+6;
+  int v17312=v15881+6;
+  int v17313=v12061+8;
+  int v17314=v16771+2;
+  int v17315=v11085+6;
+  int v17316=v15251+1;
+  int v17317=v7681+4;
+  int v17318=v13153+5;
+  int v17319=v13606+9;
+  int v17320=v17210+9;
+  int v17321=v12805+1;
+  int v17322=v10211+5;
+  int v17323=v4901+4;
+  int v17324=v13414+5;
+  int v17325=v10966+1;
+  int v17326=v927+7;
+  int v17327=v14447+8;
+  int v17328=v1265+2;
+  int v17329=v2804+3;
+  int v17330=v3173+9;
+  int v17331=v16935+0;
+  int v17332=v7996+1;
+  int v17333=v11506+6;
+  int v17334=v13094+7;
+  int v17335=v7766+1;
+  int v17336=v3987+9;
+  int v17337=v13312+6;
+  int v17338=v14551+4;
+  int v17339=v6268+2;
+  int v17340=v3589+1;
+  int v17341=v2426+8;
+  int v17342=v5344+4;
+  int v17343=v2307+4;
+  int v17344=v2988+8;
+  int v17345=v1960+9;
+  int v17346=v11823+4;
+  int v17347=v15356+4;
+  int v17348=v9966+8;
+  int v17349=v5048+2;
+  int v17350=v1539+5;
+  int v17351=v2324+1;
+  int v17352=v14699+2;
+  int v17353=v3847+7;
+  int v17354=v7646+8;
+  int v17355=v15062+5;
+  int v17356=v8759+1;
+  int v17357=v1345+0;
+  int v17358=v13497+0;
+  int v17359=v12875+5;
+  int v17360=v10498+8;
+  int v17361=v1144+7;
+  int v17362=v16447+8;
+  int v17363=v12095+0;
+  int v17364=v8224+0;
+  int v17365=v15698+4;
+  int v17366=v6313+4;
+  int v17367=v6333+3;
+  int v17368=v10514+3;
+  int v17369=v7745+2;
+  int v17370=v11654+1;
+  int v17371=v6169+6;
+  int v17372=v13155+9;
+  int v17373=v5317+2;
+  int v17374=v6581+3;
+  int v17375=v16243+6;
+  int v17376=v905+8;
+  int v17377=v7463+5;
+  int v17378=v10438+9;
+  int v17379=v5762+4;
+  int v17380=v10407+3;
+  int v17381=v15948+8;
+  int v17382=v6768+4;
+  int v17383=v7993+0;
+  int v17384=v6194+8;
+  int v17385=v4831+1;
+  int v17386=v1670+9;
+  int v17387=v4433+4;
+  int v17388=v5499+4;
+  int v17389=v5882+5;
+  int v17390=v6268+4;
+  int v17391=v4735+1;
+  int v17392=v10612+4;
+  int v17393=v3648+7;
+  int v17394=v9777+6;
+  int v17395=v3948+6;
+  int v17396=v8450+7;
+  int v17397=v15729+6;
+  int v17398=v1082+6;
+  int v17399=v4241+1;
+  int v17400=v11879+8;
+  int v17401=v16227+5;
+  int v17402=v1867+8;
+  int v17403=v4845+5;
+  int v17404=v11050+6;
+  int v17405=v385+2;
+  int v17406=v559+5;
+  int v17407=v11572+9;
+  int v17408=v7833+5;
+  int v17409=v10743+8;
+  int v17410=v1118+0;
+  int v17411=v6693+5;
+  int v17412=v1892+0;
+  int v17413=v6898+0;
+  int v17414=v11881+3;
+  int v17415=v1876+2;
+  int v17416=v838+0;
+  int v17417=v9182+5;
+  int v17418=v14766+9;
+  int v17419=v6191+9;
+  int v17420=v16483+8;
+  int v17421=v10933+2;
+  int v17422=v13366+2;
+  int v17423=v6852+7;
+  int v17424=v7085+8;
+  int v17425=v12621+3;
+  int v17426=v8853+2;
+  int v17427=v16989+1;
+  int v17428=v6620+7;
+  int v17429=v8281+7;
+  int v17430=v13394+7;
+  int v17431=v4652+9;
+  int v17432=v2099+7;
+  int v17433=v354+4;
+  int v17434=v14460+3;
+  int v17435=v10664+9;
+  int v17436=v14232+9;
+  int v17437=v16386+5;
+  int v17438=v16371+0;
+  int v17439=v1482+1;
+  int v17440=v13432+5;
+  int v17441=v17197+5;
+  int v17442=v7987+5;
+  int v17443=v9569+6;
+  int v17444=v13286+6;
+  int v17445=v9656+9;
+  int v17446=v8199+2;
+  int v17447=v3399+5;
+  int v17448=v1902+5;
+  int v17449=v16715+6;
+  int v17450=v1609+4;
+  int v17451=v16168+0;
+  int v17452=v13562+9;
+  int v17453=v10411+4;
+  int v17454=v8802+0;
+  int v17455=v13775+9;
+  int v17456=v1395+7;
+  int v17457=v13443+4;
+  int v17458=v9027+3;
+  int v17459=v8746+6;
+  int v17460=v7009+9;
+  int v17461=v16271+6;
+  int v17462=v12346+4;
+  int v17463=v11504+9;
+  int v17464=v3554+5;
+  int v17465=v1108+4;
+  int v17466=v13226+0;
+  int v17467=v14426+8;
+  int v17468=v7832+1;
+  int v17469=v3098+1;
+  int v17470=v12117+0;
+  int v17471=v6027+4;
+  int v17472=v3293+4;
+  int v17473=v12698+4;
+  int v17474=v8098+4;
+  int v17475=v5405+5;
+  int v17476=v8204+4;
+  int v17477=v14226+1;
+  int v17478=v2903+2;
+  int v17479=v2056+3;
+  int v17480=v17263+3;
+  int v17481=v13989+3;
+  int v17482=v10336+4;
+  int v17483=v1668+5;
+  int v17484=v12502+3;
+  int v17485=v3561+4;
+  int v17486=v15050+5;
+  int v17487=v1337+6;
+  int v17488=v6232+8;
+  int v17489=v13982+2;
+  int v17490=v10708+2;
+  int v17491=v9990+7;
+  int v17492=v12825+9;
+  int v17493=v4505+7;
+  int v17494=v10247+3;
+  int v17495=v5979+9;
+  int v17496=v8553+9;
+  int v17497=v8771+2;
+  int v17498=v1609+1;
+  int v17499=v7889+8;
+  int v17500=v11770+1;
+  int v17501=v2649+5;
+  int v17502=v6278+4;
+  int v17503=v9571+5;
+  int v17504=v4607+0;
+  int v17505=v8570+3;
+  int v17506=v443+4;
+  int v17507=v985+9;
+  int v17508=v5406+6;
+  int v17509=v15448+1;
+  int v17510=v9767+7;
+  int v17511=v9934+6;
+  int v17512=v4059+4;
+  int v17513=v6482+6;
+  int v17514=v4832+2;
+  int v17515=v1971+2;
+  int v17516=v12348+1;
+  int v17517=v1228+4;
+  int v17518=v5365+5;
+  int v17519=v14740+2;
+  int v17520=v2191+8;
+  int v17521=v14504+7;
+  int v17522=v6723+2;
+  int v17523=v6593+6;
+  int v17524=v15237+2;
+  int v17525=v8050+8;
+  int v17526=v12316+8;
+  int v17527=v11863+4;
+  int v17528=v9360+5;
+  int v17529=v9866+1;
+  int v17530=v14271+9;
+  int v17531=v2165+4;
+  int v17532=v14346+6;
+  int v17533=v13764+7;
+  int v17534=v7122+9;
+  int v17535=v9679+3;
+  int v17536=v16689+1;
+  int v17537=v10447+0;
+  int v17538=v8939+7;
+  int v17539=v13216+1;
+  int v17540=v7075+7;
+  int v17541=v4028+4;
+  int v17542=v16534+6;
+  int v17543=v3467+2;
+  int v17544=v8532+3;
+  int v17545=v7034+3;
+  int v17546=v12972+9;
+  int v17547=v6819+7;
+  int v17548=v6003+0;
+  int v17549=v11586+1;
+  int v17550=v7775+2;
+  int v17551=v17258+6;
+  int v17552=v949+1;
+  int v17553=v15438+4;
+  int v17554=v1102+9;
+  int v17555=v8245+9;
+  int v17556=v12929+9;
+  int v17557=v10457+6;
+  int v17558=v14569+2;
+  int v17559=v1930+3;
+  int v17560=v5145+9;
+  int v17561=v9336+8;
+  int v17562=v17283+6;
+  int v17563=v9025+2;
+  int v17564=v3004+8;
+  int v17565=v12992+6;
+  int v17566=v8367+7;
+  int v17567=v3376+3;
+  int v17568=v13735+0;
+  int v17569=v16237+7;
+  int v17570=v5958+3;
+  int v17571=v6519+4;
+  int v17572=v6854+3;
+  int v17573=v8448+8;
+  int v17574=v11098+5;
+  int v17575=v2220+6;
+  int v17576=v4271+9;
+  int v17577=v17080+8;
+  int v17578=v9362+2;
+  int v17579=v8916+6;
+  int v17580=v858+0;
+  int v17581=v4036+3;
+  int v17582=v1758+3;
+  int v17583=v13679+3;
+  int v17584=v12057+5;
+  int v17585=v9164+7;
+  int v17586=v4377+8;
+  int v17587=v2331+0;
+  int v17588=v7056+8;
+  int v17589=v8755+4;
+  int v17590=v13328+5;
+  int v17591=v3115+3;
+  int v17592=v2329+1;
+  int v17593=v16246+0;
+  int v17594=v12791+1;
+  int v17595=v12848+9;
+  int v17596=v1992+8;
+  int v17597=v15595+3;
+  int v17598=v7041+0;
+  int v17599=v7507+0;
+  int v17600=v2928+5;
+  int v17601=v7849+9;
+  int v17602=v15347+2;
+  int v17603=v11525+6;
+  int v17604=v10700+8;
+  int v17605=v8756+8;
+  int v17606=v14660+0;
+  int v17607=v11722+8;
+  int v17608=v2211+8;
+  int v17609=v11846+2;
+  int v17610=v17314+0;
+  int v17611=v7850+4;
+  int v17612=v14077+7;
+  int v17613=v17066+3;
+  int v17614=v9114+3;
+  int v17615=v3282+7;
+  int v17616=v3958+6;
+  int v17617=v223+7;
+  int v17618=v8332+5;
+  int v17619=v236+2;
+  int v17620=v4862+8;
+  int v17621=v13900+6;
+  int v17622=v11345+9;
+  int v17623=v12920+5;
+  int v17624=v3027+4;
+  int v17625=v6013+2;
+  int v17626=v16696+1;
+  int v17627=v12012+6;
+  int v17628=v15598+8;
+  int v17629=v14147+2;
+  int v17630=v9183+8;
+  int v17631=v6279+7;
+  int v17632=v13307+0;
+  int v17633=v14418+5;
+  int v17634=v9847+0;
+  int v17635=v10865+3;
+  int v17636=v1878+3;
+  int v17637=v1812+7;
+  int v17638=v12308+5;
+  int v17639=v12095+1;
+  int v17640=v15619+4;
+  int v17641=v5938+4;
+  int v17642=v13059+6;
+  int v17643=v4661+9;
+  int v17644=v15193+0;
+  int v17645=v1838+1;
+  int v17646=v457+1;
+  int v17647=v11171+5;
+  int v17648=v13879+4;
+  int v17649=v12687+8;
+  int v17650=v12780+3;
+  int v17651=v8725+6;
+  int v17652=v1436+6;
+  int v17653=v9233+3;
+  int v17654=v5723+5;
+  int v17655=v9019+3;
+  int v17656=v13540+9;
+  int v17657=v12041+4;
+  int v17658=v7125+7;
+  int v17659=v904+6;
+  int v17660=v3778+2;
+  int v17661=v1298+3;
+  int v17662=v12714+8;
+  int v17663=v12022+3;
+  int v17664=v12374+4;
+  int v17665=v7642+0;
+  int v17666=v483+3;
+  int v17667=v9586+7;
+  int v17668=v11167+6;
+  int v17669=v15587+9;
+  int v17670=v6016+0;
+  int v17671=v162+6;
+  int v17672=v10327+7;
+  int v17673=v992+4;
+  int v17674=v8530+0;
+  int v17675=v12800+0;
+  int v17676=v11236+3;
+  int v17677=v15687+6;
+  int v17678=v8432+0;
+  int v17679=v11021+7;
+  int v17680=v9010+2;
+  int v17681=v7658+0;
+  int v17682=v6655+8;
+  int v17683=v7845+4;
+  int v17684=v114+1;
+  int v17685=v7190+6;
+  int v17686=v12504+7;
+  int v17687=v5979+0;
+  int v17688=v9905+3;
+  int v17689=v10721+4;
+  int v17690=v8077+5;
+  int v17691=v5539+8;
+  int v17692=v16105+2;
+  int v17693=v10285+5;
+  int v17694=v11808+1;
+  int v17695=v11693+9;
+  int v17696=v16874+6;
+  int v17697=v4461+1;
+  int v17698=v1803+3;
+  int v17699=v6589+7;
+  int v17700=v14840+6;
+  int v17701=v7597+4;
+  int v17702=v12984+9;
+  int v17703=v12419+9;
+  int v17704=v7864+7;
+  int v17705=v13638+0;
+  int v17706=v1593+2;
+  int v17707=v15041+7;
+  int v17708=v8147+7;
+  int v17709=v14574+5;
+  int v17710=v6680+6;
+  int v17711=v1776+0;
+  int v17712=v1198+4;
+  int v17713=v6274+7;
+  int v17714=v15113+9;
+  int v17715=v7373+8;
+  int v17716=v7687+5;
+  int v17717=v9878+0;
+  int v17718=v2549+2;
+  int v17719=v2469+1;
+  int v17720=v15931+7;
+  int v17721=v11629+6;
+  int v17722=v12843+3;
+  int v17723=v8175+4;
+  int v17724=v7983+1;
+  int v17725=v6197+3;
+  int v17726=v16579+4;
+  int v17727=v10719+4;
+  int v17728=v13250+3;
+  int v17729=v6746+1;
+  int v17730=v17708+9;
+  int v17731=v1336+5;
+  int v17732=v5204+4;
+  int v17733=v1917+3;
+  int v17734=v1740+2;
+  int v17735=v15057+2;
+  int v17736=v2778+3;
+  int v17737=v15150+4;
+  int v17738=v2705+2;
+  int v17739=v7955+9;
+  int v17740=v14480+0;
+  int v17741=v2386+3;
+  int v17742=v17358+9;
+  int v17743=v4028+8;
+  int v17744=v10142+1;
+  int v17745=v6367+8;
+  int v17746=v6070+5;
+  int v17747=v6534+4;
+  int v17748=v6365+1;
+  int v17749=v3731+9;
+  int v17750=v681+2;
+  int v17751=v3059+4;
+  int v17752=v8094+5;
+  int v17753=v2927+8;
+  int v17754=v10666+8;
+  int v17755=v5060+7;
+  int v17756=v8081+8;
+  int v17757=v12702+7;
+  int v17758=v7238+8;
+  int v17759=v2677+3;
+  int v17760=v6052+9;
+  int v17761=v10490+8;
+  int v17762=v17484+9;
+  int v17763=v7492+1;
+  int v17764=v6436+6;
+  int v17765=v4701+6;
+  int v17766=v13240+0;
+  int v17767=v2564+2;
+  int v17768=v3458+8;
+  int v17769=v13319+5;
+  int v17770=v2869+2;
+  int v17771=v4964+9;
+  int v17772=v7485+1;
+  int v17773=v2042+5;
+  int v17774=v17715+7;
+  int v17775=v1847+3;
+  int v17776=v12102+8;
+  int v17777=v8716+2;
+  int v17778=v6721+5;
+  int v17779=v15796+0;
+  int v17780=v7505+9;
+  int v17781=v6976+3;
+  int v17782=v14903+0;
+  int v17783=v2994+0;
+  int v17784=v4221+6;
+  int v17785=v13366+1;
+  int v17786=v818+8;
+  int v17787=v14774+8;
+  int v17788=v2308+1;
+  int v17789=v16533+0;
+  int v17790=v12554+0;
+  int v17791=v15175+2;
+  int v17792=v117+9;
+  int v17793=v2759+5;
+  int v17794=v17123+2;
+  int v17795=v11843+4;
+  int v17796=v1215+8;
+  int v17797=v11676+5;
+  int v17798=v9758+0;
+  int v17799=v17249+0;
+  int v17800=v13025+5;
+  int v17801=v1635+7;
+  int v17802=v2610+8;
+  int v17803=v12672+4;
+  int v17804=v13859+3;
+  int v17805=v671+0;
+  int v17806=v12069+5;
+  int v17807=v13269+1;
+  int v17808=v16902+0;
+  int v17809=v16779+6;
+  int v17810=v10659+1;
+  int v17811=v14326+2;
+  int v17812=v361+0;
+  int v17813=v15867+5;
+  int v17814=v15663+2;
+  int v17815=v16331+2;
+  int v17816=v4256+4;
+  int v17817=v3239+1;
+  int v17818=v15764+0;
+  int v17819=v7008+6;
+  int v17820=v15688+3;
+  int v17821=v1850+8;
+  int v17822=v707+7;
+  int v17823=v8957+9;
+  int v17824=v10650+7;
+  int v17825=v1421+5;
+  int v17826=v5207+6;
+  int v17827=v3290+2;
+  int v17828=v17276+6;
+  int v17829=v17734+1;
+  int v17830=v12690+9;
+  int v17831=v16612+8;
+  int v17832=v17672+4;
+  int v17833=v1501+4;
+  int v17834=v13659+2;
+  int v17835=v15502+8;
+  int v17836=v6760+4;
+  int v17837=v14549+3;
+  int v17838=v15081+5;
+  int v17839=v10498+2;
+  int v17840=v10827+7;
+  int v17841=v4126+3;
+  int v17842=v5833+3;
+  int v17843=v15153+1;
+  int v17844=v9013+4;
+  int v17845=v15489+9;
+  int v17846=v5324+2;
+  int v17847=v13850+3;
+  int v17848=v6159+4;
+  int v17849=v17021+9;
+  int v17850=v3211+8;
+  int v17851=v5842+7;
+  int v17852=v11015+5;
+  int v17853=v735+1;
+  int v17854=v13803+2;
+  int v17855=v5520+2;
+  int v17856=v3027+2;
+  int v17857=v9908+8;
+  int v17858=v11953+6;
+  int v17859=v17321+2;
+  int v17860=v14904+8;
+  int v17861=v3737+2;
+  int v17862=v9184+3;
+  int v17863=v15324+6;
+  int v17864=v1396+6;
+  int v17865=v6201+6;
+  int v17866=v9478+1;
+  int v17867=v2149+1;
+  int v17868=v13826+8;
+  int v17869=v8347+6;
+  int v17870=v5211+9;
+  int v17871=v158+9;
+  int v17872=v9475+6;
+  int v17873=v9404+6;
+  int v17874=v3423+2;
+  int v17875=v16509+3;
+  int v17876=v9416+7;
+  int v17877=v6120+0;
+  int v17878=v16561+1;
+  int v17879=v15516+2;
+  int v17880=v4239+2;
+  int v17881=v7875+7;
+  int v17882=v1682+0;
+  int v17883=v7531+5;
+  int v17884=v10465+6;
+  int v17885=v2861+5;
+  int v17886=v8780+0;
+  int v17887=v15900+4;
+  int v17888=v14976+5;
+  int v17889=v6047+0;
+  int v17890=v2250+0;
+  int v17891=v6877+3;
+  int v17892=v2892+5;
+  int v17893=v3554+3;
+  int v17894=v13731+9;
+  int v17895=v1594+2;
+  int v17896=v10857+0;
+  int v17897=v13573+6;
+  int v17898=v11392+3;
+  int v17899=v589+9;
+  int v17900=v16120+7;
+  int v17901=v8857+2;
+  int v17902=v11867+0;
+  int v17903=v12691+7;
+  int v17904=v11753+2;
+  int v17905=v11355+9;
+  int v17906=v11012+7;
+  int v17907=v4624+8;
+  int v17908=v16582+3;
+  int v17909=v10079+5;
+  int v17910=v8341+8;
+  int v17911=v8559+4;
+  int v17912=v7362+6;
+  int v17913=v10601+8;
+  int v17914=v13685+4;
+  int v17915=v14735+9;
+  int v17916=v2865+7;
+  int v17917=v6618+3;
+  int v17918=v17788+9;
+  int v17919=v6716+2;
+  int v17920=v1056+9;
+  int v17921=v5702+6;
+  int v17922=v5663+1;
+  int v17923=v10417+8;
+  int v17924=v11400+4;
+  int v17925=v5268+2;
+  int v17926=v7523+7;
+  int v17927=v14454+8;
+  int v17928=v5810+6;
+  int v17929=v4405+6;
+  int v17930=v2433+7;
+  int v17931=v1429+0;
+  int v17932=v10597+5;
+  int v17933=v6424+6;
+  int v17934=v7188+0;
+  int v17935=v11715+4;
+  int v17936=v628+7;
+  int v17937=v14140+4;
+  int v17938=v6746+9;
+  int v17939=v10527+4;
+  int v17940=v1080+1;
+  int v17941=v16548+0;
+  int v17942=v6775+2;
+  int v17943=v16001+5;
+  int v17944=v2907+4;
+  int v17945=v1297+1;
+  int v17946=v13232+9;
+  int v17947=v8621+0;
+  int v17948=v8511+6;
+  int v17949=v5883+1;
+  int v17950=v5858+0;
+  int v17951=v13672+0;
+  int v17952=v11821+8;
+  int v17953=v3802+4;
+  int v17954=v7924+0;
+  int v17955=v13859+8;
+  int v17956=v6917+2;
+  int v17957=v4129+0;
+  int v17958=v5918+8;
+  int v17959=v14721+6;
+  int v17960=v2744+6;
+  int v17961=v7572+1;
+  int v17962=v14738+6;
+  int v17963=v9194+0;
+  int v17964=v11309+1;
+  int v17965=v15226+2;
+  int v17966=v5253+6;
+  int v17967=v2242+1;
+  int v17968=v4589+8;
+  int v17969=v13748+0;
+  int v17970=v12914+3;
+  int v17971=v1127+8;
+  int v17972=v15197+6;
+  int v17973=v3204+2;
+  int v17974=v5588+7;
+  int v17975=v2050+6;
+  int v17976=v5593+0;
+  int v17977=v10094+6;
+  int v17978=v15208+5;
+  int v17979=v13724+6;
+  int v17980=v9681+0;
+  int v17981=v6824+6;
+  int v17982=v1446+1;
+  int v17983=v17203+1;
+  int v17984=v14786+6;
+  int v17985=v1413+3;
+  int v17986=v8889+5;
+  int v17987=v12586+3;
+  int v17988=v3597+8;
+  int v17989=v11364+9;
+  int v17990=v1842+1;
+  int v17991=v850+8;
+  int v17992=v5737+9;
+  int v17993=v9508+9;
+  int v17994=v1843+2;
+  int v17995=v16991+6;
+  int v17996=v10573+6;
+  int v17997=v11524+2;
+  int v17998=v17336+0;
+  int v17999=v11813+3;
+  int v18000=v152+9;
+  int v18001=v13480+0;
+  int v18002=v12567+8;
+  int v18003=v17574+2;
+  int v18004=v7784+5;
+  int v18005=v12560+9;
+  int v18006=v16174+3;
+  int v18007=v15272+0;
+  int v18008=v401+3;
+  int v18009=v2573+5;
+  int v18010=v12035+4;
+  int v18011=v1859+2;
+  int v18012=v1372+9;
+  int v18013=v13457+0;
+  int v18014=v8823+0;
+  int v18015=v11920+4;
+  int v18016=v9399+4;
+  int v18017=v7033+7;
+  int v18018=v15793+4;
+  int v18019=v5216+8;
+  int v18020=v1728+5;
+  int v18021=v10520+3;
+  int v18022=v3923+1;
+  int v18023=v8333+5;
+  int v18024=v1849+8;
+  int v18025=v17758+0;
+  int v18026=v13976+7;
+  int v18027=v13827+6;
+  int v18028=v8954+4;
+  int v18029=v6636+5;
+  int v18030=v12229+9;
+  int v18031=v16633+1;
+  int v18032=v12440+0;
+  int v18033=v3791+9;
+  int v18034=v9047+7;
+  int v18035=v15241+8;
+  int v18036=v1008+7;
+  int v18037=v9480+7;
+  int v18038=v5511+6;
+  int v18039=v17280+4;
+  int v18040=v287+2;
+  int v18041=v17174+9;
+  int v18042=v13080+3;
+  int v18043=v290+8;
+  int v18044=v6152+0;
+  int v18045=v4453+7;
+  int v18046=v5212+9;
+  int v18047=v14513+5;
+  int v18048=v7042+9;
+  int v18049=v422+8;
+  int v18050=v15049+0;
+  int v18051=v13613+6;
+  int v18052=v13549+3;
+  int v18053=v14878+3;
+  int v18054=v12621+9;
+  int v18055=v12898+2;
+  int v18056=v13979+2;
+  int v18057=v4691+4;
+  int v18058=v12238+0;
+  int v18059=v17322+1;
+  int v18060=v9996+0;
+  int v18061=v7432+0;
+  int v18062=v7427+7;
+  int v18063=v8644+1;
+  int v18064=v12160+0;
+  int v18065=v11179+2;
+  int v18066=v11937+5;
+  int v18067=v14926+2;
+  int v18068=v5855+4;
+  int v18069=v11171+5;
+  int v18070=v7250+2;
+  int v18071=v6979+3;
+  int v18072=v13502+4;
+  int v18073=v2970+1;
+  int v18074=v17367+0;
+  int v18075=v6481+0;
+  int v18076=v6412+4;
+  int v18077=v4314+3;
+  int v18078=v13468+0;
+  int v18079=v11452+3;
+  int v18080=v8217+2;
+  int v18081=v12209+2;
+  int v18082=v10758+0;
+  int v18083=v16399+9;
+  int v18084=v3531+9;
+  int v18085=v10272+8;
+  int v18086=v14348+5;
+  int v18087=v91+5;
+  int v18088=v17769+0;
+  int v18089=v4216+8;
+  int v18090=v682+3;
+  int v18091=v1671+1;
+  int v18092=v4953+8;
+  int v18093=v3368+2;
+  int v18094=v6446+3;
+  int v18095=v15477+5;
+  int v18096=v1773+9;
+  int v18097=v3526+4;
+  int v18098=v6009+2;
+  int v18099=v12859+9;
+  int v18100=v9071+8;
+  int v18101=v15170+3;
+  int v18102=v2124+4;
+  int v18103=v13163+8;
+  int v18104=v16900+2;
+  int v18105=v2024+7;
+  int v18106=v11264+0;
+  int v18107=v4072+9;
+  int v18108=v2603+5;
+  int v18109=v17162+6;
+  int v18110=v7265+6;
+  int v18111=v3458+0;
+  int v18112=v6029+2;
+  int v18113=v6392+6;
+  int v18114=v9860+5;
+  int v18115=v14604+3;
+  int v18116=v5910+5;
+  int v18117=v1233+6;
+  int v18118=v9217+3;
+  int v18119=v2925+9;
+  int v18120=v234+9;
+  int v18121=v9583+2;
+  int v18122=v10681+1;
+  int v18123=v13678+0;
+  int v18124=v14257+1;
+  int v18125=v8235+0;
+  int v18126=v4623+1;
+  int v18127=v12851+4;
+  int v18128=v8783+2;
+  int v18129=v6873+1;
+  int v18130=v7413+6;
+  int v18131=v16918+8;
+  int v18132=v12727+1;
+  int v18133=v16561+3;
+  int v18134=v1412+0;
+  int v18135=v7104+5;
+  int v18136=v2466+0;
+  int v18137=v14029+9;
+  int v18138=v12445+9;
+  int v18139=v6238+9;
+  int v18140=v7396+0;
+  int v18141=v4058+5;
+  int v18142=v5565+3;
+  int v18143=v9933+7;
+  int v18144=v7663+0;
+  int v18145=v2750+1;
+  int v18146=v5785+7;
+  int v18147=v2643+0;
+  int v18148=v12062+8;
+  int v18149=v3635+2;
+  int v18150=v3788+8;
+  int v18151=v12175+8;
+  int v18152=v5938+5;
+  int v18153=v10690+0;
+  int v18154=v14693+0;
+  int v18155=v13559+9;
+  int v18156=v6087+1;
+  int v18157=v6333+6;
+  int v18158=v5388+1;
+  int v18159=v11412+5;
+  int v18160=v9536+8;
+  int v18161=v2768+5;
+  int v18162=v9134+3;
+  int v18163=v724+1;
+  int v18164=v9018+4;
+  int v18165=v11269+3;
+  int v18166=v14502+2;
+  int v18167=v1191+7;
+  int v18168=v4209+9;
+  int v18169=v1498+8;
+  int v18170=v10808+5;
+  int v18171=v11656+0;
+  int v18172=v7349+8;
+  int v18173=v10386+3;
+  int v18174=v1367+0;
+  int v18175=v8937+0;
+  int v18176=v2797+7;
+  int v18177=v8857+3;
+  int v18178=v7398+6;
+  int v18179=v5883+9;
+  int v18180=v11898+7;
+  int v18181=v3934+2;
+  int v18182=v11396+3;
+  int v18183=v5762+3;
+  int v18184=v2765+7;
+  int v18185=v11617+3;
+  int v18186=v2854+0;
+  int v18187=v723+1;
+  int v18188=v15054+9;
+  int v18189=v10524+6;
+  int v18190=v1844+4;
+  int v18191=v8555+7;
+  int v18192=v11803+0;
+  int v18193=v15550+1;
+  int v18194=v7756+0;
+  int v18195=v9008+6;
+  int v18196=v8171+3;
+  int v18197=v269+3;
+  int v18198=v9696+8;
+  int v18199=v8994+8;
+  int v18200=v13462+8;
+  int v18201=v11463+5;
+  int v18202=v8424+2;
+  int v18203=v8110+2;
+  int v18204=v5908+8;
+  int v18205=v6333+2;
+  int v18206=v13618+6;
+  int v18207=v15558+7;
+  int v18208=v3894+6;
+  int v18209=v4254+5;
+  int v18210=v17171+7;
+  int v18211=v16359+6;
+  int v18212=v5938+1;
+  int v18213=v2905+7;
+  int v18214=v11896+3;
+  int v18215=v4789+6;
+  int v18216=v5533+9;
+  int v18217=v16150+3;
+  int v18218=v2140+7;
+  int v18219=v2391+6;
+  int v18220=v5621+7;
+  int v18221=v5495+5;
+  int v18222=v8870+1;
+  int v18223=v3437+2;
+  int v18224=v1591+8;
+  int v18225=v8149+1;
+  int v18226=v17246+8;
+  int v18227=v16821+8;
+  int v18228=v5016+1;
+  int v18229=v16058+8;
+  int v18230=v7294+5;
+  int v18231=v11863+8;
+  int v18232=v4464+9;
+  int v18233=v15316+5;
+  int v18234=v6005+0;
+  int v18235=v14112+4;
+  int v18236=v3024+0;
+  int v18237=v15049+7;
+  int v18238=v897+3;
+  int v18239=v89+8;
+  int v18240=v11731+4;
+  int v18241=v1735+9;
+  int v18242=v5510+0;
+  int v18243=v17341+6;
+  int v18244=v15299+6;
+  int v18245=v5632+6;
+  int v18246=v3582+3;
+  int v18247=v1833+1;
+  int v18248=v16760+5;
+  int v18249=v17131+2;
+  int v18250=v4528+1;
+  int v18251=v7561+8;
+  int v18252=v11830+8;
+  int v18253=v128+4;
+  int v18254=v14143+2;
+  int v18255=v16458+9;
+  int v18256=v15883+4;
+  int v18257=v15165+0;
+  int v18258=v6101+0;
+  int v18259=v16559+0;
+  int v18260=v2169+1;
+  int v18261=v15198+5;
+  int v18262=v134+1;
+  int v18263=v12436+7;
+  int v18264=v9814+1;
+  int v18265=v11871+7;
+  int v18266=v18209+2;
+  int v18267=v2097+6;
+  int v18268=v5858+9;
+  int v18269=v15225+6;
+  int v18270=v9117+2;
+  int v18271=v4089+2;
+  int v18272=v10638+9;
+  int v18273=v6383+5;
+  int v18274=v15012+0;
+  int v18275=v13503+0;
+  int v18276=v10773+8;
+  int v18277=v16272+8;
+  int v18278=v667+1;
+  int v18279=v4855+8;
+  int v18280=v2070+9;
+  int v18281=v18243+0;
+  int v18282=v8695+0;
+  int v18283=v17500+2;
+  int v18284=v7681+2;
+  int v18285=v17695+6;
+  int v18286=v1251+6;
+  int v18287=v9055+5;
+  int v18288=v603+6;
+  int v18289=v7922+9;
+  int v18290=v5694+9;
+  int v18291=v9602+9;
+  int v18292=v10108+8;
+  int v18293=v11314+7;
+  int v18294=v10657+7;
+  int v18295=v13143+0;
+  int v18296=v17477+9;
+  int v18297=v9229+0;
+  int v18298=v12289+6;
+  int v18299=v17840+5;
+  int v18300=v1675+7;
+  int v18301=v9738+2;
+  int v18302=v5257+6;
+  int v18303=v6592+9;
+  int v18304=v4814+2;
+  int v18305=v10513+1;
+  int v18306=v5822+4;
+  int v18307=v10906+3;
+  int v18308=v9138+3;
+  int v18309=v6196+4;
+  int v18310=v9769+4;
+  int v18311=v10977+1;
+  int v18312=v13496+7;
+  int v18313=v1003+0;
+  int v18314=v14064+3;
+  int v18315=v13289+3;
+  int v18316=v9509+9;
+  int v18317=v12040+7;
+  int v18318=v8730+8;
+  int v18319=v1740+0;
+  int v18320=v11609+0;
+  int v18321=v4762+4;
+  int v18322=v6440+5;
+  int v18323=v726+2;
+  int v18324=v17250+2;
+  int v18325=v11169+1;
+  int v18326=v16384+8;
+  int v18327=v13003+5;
+  int v18328=v15919+1;
+  int v18329=v3409+8;
+  int v18330=v13386+0;
+  int v18331=v3953+1;
+  int v18332=v14261+3;
+  int v18333=v9721+6;
+  int v18334=v3203+8;
+  int v18335=v3419+9;
+  int v18336=v9530+2;
+  int v18337=v7464+1;
+  int v18338=v7058+4;
+  int v18339=v16217+5;
+  int v18340=v10678+3;
+  int v18341=v52+8;
+  int v18342=v9704+1;
+  int v18343=v13566+4;
+  int v18344=v3275+9;
+  int v18345=v16292+5;
+  int v18346=v11075+5;
+  int v18347=v9580+3;
+  int v18348=v8388+8;
+  int v18349=v7052+8;
+  int v18350=v15754+7;
+  int v18351=v897+5;
+  int v18352=v8150+3;
+  int v18353=v11299+5;
+  int v18354=v6095+3;
+  int v18355=v9264+8;
+  int v18356=v12538+0;
+  int v18357=v8156+1;
+  int v18358=v9542+4;
+  int v18359=v11136+3;
+  int v18360=v17967+3;
+  int v18361=v7179+6;
+  int v18362=v1015+7;
+  int v18363=v9599+9;
+  int v18364=v4275+3;
+  int v18365=v1579+0;
+  int v18366=v1682+2;
+  int v18367=v14921+6;
+  int v18368=v14803+8;
+  int v18369=v1529+8;
+  int v18370=v4318+7;
+  int v18371=v14341+6;
+  int v18372=v6431+7;
+  int v18373=v2777+6;
+  int v18374=v14468+5;
+  int v18375=v6918+4;
+  int v18376=v16701+8;
+  int v18377=v12118+4;
+  int v18378=v517+9;
+  int v18379=v1265+6;
+  int v18380=v14772+5;
+  int v18381=v8891+1;
+  int v18382=v5744+3;
+  int v18383=v5698+9;
+  int v18384=v15216+7;
+  int v18385=v2772+2;
+  int v18386=v11494+0;
+  int v18387=v11975+2;
+  int v18388=v3552+9;
+  int v18389=v299+0;
+  int v18390=v2433+3;
+  int v18391=v15499+6;
+  int v18392=v11778+5;
+  int v18393=v15560+5;
+  int v18394=v11477+0;
+  int v18395=v225+3;
+  int v18396=v8560+8;
+  int v18397=v13164+2;
+  int v18398=v10594+5;
+  int v18399=v4816+9;
+  int v18400=v3932+4;
+  int v18401=v2057+1;
+  int v18402=v13740+1;
+  int v18403=v1109+1;
+  int v18404=v11260+2;
+  int v18405=v10858+1;
+  int v18406=v8806+8;
+  int v18407=v10659+4;
+  int v18408=v5468+9;
+  int v18409=v544+1;
+  int v18410=v18261+6;
+  int v18411=v7464+3;
+  int v18412=v16687+9;
+  int v18413=v14737+5;
+  int v18414=v11658+5;
+  int v18415=v13558+1;
+  int v18416=v1060+5;
+  int v18417=v7588+5;
+  int v18418=v3993+5;
+  int v18419=v17324+0;
+  int v18420=v11558+1;
+  int v18421=v15447+7;
+  int v18422=v5522+8;
+  int v18423=v8673+7;
+  int v18424=v1143+1;
+  int v18425=v2036+3;
+  int v18426=v16664+7;
+  int v18427=v10129+4;
+  int v18428=v1356+0;
+  int v18429=v9479+2;
+  int v18430=v14256+5;
+  int v18431=v4638+4;
+  int v18432=v8117+1;
+  int v18433=v3169+6;
+  int v18434=v3389+5;
+  int v18435=v4129+9;
+  int v18436=v18195+5;
+  int v18437=v2402+3;
+  int v18438=v18239+7;
+  int v18439=v3280+1;
+  int v18440=v13750+2;
+  int v18441=v8196+1;
+  int v18442=v9293+0;
+  int v18443=v14888+8;
+  int v18444=v14707+8;
+  int v18445=v12407+9;
+  int v18446=v598+5;
+  int v18447=v3250+6;
+  int v18448=v2588+0;
+  int v18449=v10355+9;
+  int v18450=v1118+9;
+  int v18451=v13181+7;
+  int v18452=v8318+7;
+  int v18453=v1827+3;
+  int v18454=v15224+4;
+  int v18455=v1565+3;
+  int v18456=v4664+4;
+  int v18457=v12091+3;
+  int v18458=v705+7;
+  int v18459=v18295+5;
+  int v18460=v18362+9;
+  int v18461=v4455+5;
+  int v18462=v7488+7;
+  int v18463=v1973+9;
+  int v18464=v9179+8;
+  int v18465=v11611+0;
+  int v18466=v2763+2;
+  int v18467=v3134+8;
+  int v18468=v16347+9;
+  int v18469=v15584+8;
+  int v18470=v2616+5;
+  int v18471=v16896+7;
+  int v18472=v4540+5;
+  int v18473=v18410+6;
+  int v18474=v1755+7;
+  int v18475=v17516+6;
+  int v18476=v8407+6;
+  int v18477=v16521+6;
+  int v18478=v5270+3;
+  int v18479=v15899+7;
+  int v18480=v947+8;
+  int v18481=v4218+8;
+  int v18482=v9795+0;
+  int v18483=v8511+3;
+  int v18484=v6486+9;
+  int v18485=v11465+2;
+  int v18486=v11312+3;
+  int v18487=v4671+3;
+  int v18488=v17615+5;
+  int v18489=v481+7;
+  int v18490=v3515+7;
+  int v18491=v9390+9;
+  int v18492=v6233+9;
+  int v18493=v9020+4;
+  int v18494=v8531+6;
+  int v18495=v2339+2;
+  int v18496=v1772+3;
+  int v18497=v17674+0;
+  int v18498=v453+9;
+  int v18499=v6270+0;
+  int v18500=v1291+5;
+  int v18501=v2668+9;
+  int v18502=v10895+9;
+  int v18503=v5656+5;
+  int v18504=v2608+8;
+  int v18505=v17641+0;
+  int v18506=v13515+1;
+  int v18507=v15441+2;
+  int v18508=v16677+9;
+  int v18509=v7410+2;
+  int v18510=v16975+4;
+  int v18511=v1791+9;
+  int v18512=v9951+3;
+  int v18513=v16619+7;
+  int v18514=v8997+6;
+  int v18515=v14161+9;
+  int v18516=v17948+9;
+  int v18517=v6681+7;
+  int v18518=v3268+7;
+  int v18519=v13927+9;
+  int v18520=v404+4;
+  int v18521=v6048+3;
+  int v18522=v3270+6;
+  int v18523=v2363+3;
+  int v18524=v8213+5;
+  int v18525=v12098+0;
+  int v18526=v2267+9;
+  int v18527=v7793+1;
+  int v18528=v7488+5;
+  int v18529=v16661+1;
+  int v18530=v15550+3;
+  int v18531=v2469+0;
+  int v18532=v18355+1;
+  int v18533=v15973+9;
+  int v18534=v6491+7;
+  int v18535=v1694+7;
+  int v18536=v8975+4;
+  int v18537=v18026+7;
+  int v18538=v11215+1;
+  int v18539=v16457+1;
+  int v18540=v513+3;
+  int v18541=v4742+7;
+  int v18542=v15269+1;
+  int v18543=v17021+1;
+  int v18544=v132+8;
+  int v18545=v13172+8;
+  int v18546=v3844+6;
+  int v18547=v8557+6;
+  int v18548=v12623+2;
+  int v18549=v1195+2;
+  int v18550=v6856+3;
+  int v18551=v1048+9;
+  int v18552=v10092+9;
+  int v18553=v368+3;
+  int v18554=v3362+5;
+  int v18555=v1633+5;
+  int v18556=v9906+4;
+  int v18557=v1913+1;
+  int v18558=v5586+0;
+  int v18559=v13101+8;
+  int v18560=v6736+2;
+  int v18561=v16617+5;
+  int v18562=v16457+7;
+  int v18563=v10543+8;
+  int v18564=v5558+7;
+  int v18565=v17691+7;
+  int v18566=v4616+3;
+  int v18567=v6074+9;
+  int v18568=v18527+0;
+  int v18569=v16340+9;
+  int v18570=v17897+5;
+  int v18571=v16971+6;
+  int v18572=v17009+8;
+  int v18573=v131+5;
+  int v18574=v1206+8;
+  int v18575=v993+8;
+  int v18576=v15128+0;
+  int v18577=v2198+3;
+  int v18578=v17163+0;
+  int v18579=v7149+8;
+  int v18580=v1321+6;
+  int v18581=v13218+5;
+  int v18582=v11181+5;
+  int v18583=v1998+5;
+  int v18584=v2708+6;
+  int v18585=v592+4;
+  int v18586=v15719+1;
+  int v18587=v9450+7;
+  int v18588=v6691+4;
+  int v18589=v9097+4;
+  int v18590=v4301+6;
+  int v18591=v6409+5;
+  int v18592=v18450+6;
+  int v18593=v17124+5;
+  int v18594=v9684+5;
+  int v18595=v11567+4;
+  int v18596=v4263+3;
+  int v18597=v12572+2;
+  int v18598=v12262+5;
+  int v18599=v14844+6;
+  int v18600=v11434+1;
+  int v18601=v17277+6;
+  int v18602=v6574+6;
+  int v18603=v14588+3;
+  int v18604=v13187+6;
+  int v18605=v6412+3;
+  int v18606=v1623+2;
+  int v18607=v15534+6;
+  int v18608=v15306+3;
+  int v18609=v5846+6;
+  int v18610=v6178+7;
+  int v18611=v8278+4;
+  int v18612=v11676+9;
+  int v18613=v4160+9;
+  int v18614=v16332+2;
+  int v18615=v11591+4;
+  int v18616=v10469+8;
+  int v18617=v9770+2;
+  int v18618=v17807+6;
+  int v18619=v8728+2;
+  int v18620=v1298+5;
+  int v18621=v15528+5;
+  int v18622=v7517+1;
+  int v18623=v13275+1;
+  int v18624=v12124+2;
+  int v18625=v16667+4;
+  int v18626=v4997+9;
+  int v18627=v10195+1;
+  int v18628=v13330+4;
+  int v18629=v15302+5;
+  int v18630=v15620+3;
+  int v18631=v5946+2;
+  int v18632=v10354+0;
+  int v18633=v17889+8;
+  int v18634=v9544+1;
+  int v18635=v18348+7;
+  int v18636=v6220+8;
+  int v18637=v17949+7;
+  int v18638=v3146+5;
+  int v18639=v15200+2;
+  int v18640=v15819+6;
+  int v18641=v4582+1;
+  int v18642=v1616+3;
+  int v18643=v819+5;
+  int v18644=v18394+3;
+  int v18645=v7454+6;
+  int v18646=v1735+8;
+  int v18647=v10578+2;
+  int v18648=v5439+5;
+  int v18649=v2065+3;
+  int v18650=v12158+8;
+  int v18651=v16211+9;
+  int v18652=v9793+4;
+  int v18653=v3854+4;
+  int v18654=v8933+0;
+  int v18655=v9065+8;
+  int v18656=v14911+2;
+  int v18657=v11512+9;
+  int v18658=v10542+5;
+  int v18659=v3765+0;
+  int v18660=v10063+0;
+  int v18661=v4593+3;
+  int v18662=v14245+0;
+  int v18663=v1327+1;
+  int v18664=v14110+2;
+  int v18665=v9622+3;
+  int v18666=v2051+0;
+  int v18667=v2557+2;
+  int v18668=v3922+7;
+  int v18669=v16658+6;
+  int v18670=v10810+8;
+  int v18671=v5476+6;
+  int v18672=v13641+0;
+  int v18673=v17795+4;
+  int v18674=v5515+6;
+  int v18675=v10874+9;
+  int v18676=v1540+7;
+  int v18677=v15086+8;
+  int v18678=v2159+9;
+  int v18679=v1271+5;
+  int v18680=v9729+6;
+  int v18681=v1836+2;
+  int v18682=v18507+6;
+  int v18683=v15681+2;
+  int v18684=v15397+7;
+  int v18685=v12482+1;
+  int v18686=v2962+6;
+  int v18687=v18554+7;
+  int v18688=v6253+4;
+  int v18689=v7079+2;
+  int v18690=v5142+6;
+  int v18691=v16015+8;
+  int v18692=v14077+4;
+  int v18693=v864+0;
+  int v18694=v11321+1;
+  int v18695=v1348+1;
+  int v18696=v17075+0;
+  int v18697=v13220+8;
+  int v18698=v8146+7;
+  int v18699=v11396+3;
+  int v18700=v8485+8;
+  int v18701=v13358+1;
+  int v18702=v4871+7;
+  int v18703=v6896+3;
+  int v18704=v3998+0;
+  int v18705=v12660+7;
+  int v18706=v18053+1;
+  int v18707=v3428+1;
+  int v18708=v1723+4;
+  int v18709=v6618+4;
+  int v18710=v15534+1;
+  int v18711=v10367+3;
+  int v18712=v9736+0;
+  int v18713=v11456+9;
+  int v18714=v9203+0;
+  int v18715=v824+0;
+  int v18716=v9863+9;
+  int v18717=v14826+1;
+  int v18718=v9347+9;
+  int v18719=v11200+1;
+  int v18720=v14772+7;
+  int v18721=v4613+1;
+  int v18722=v16300+4;
+  int v18723=v18079+3;
+  int v18724=v14804+4;
+  int v18725=v14092+1;
+  int v18726=v5634+5;
+  int v18727=v8397+3;
+  int v18728=v16269+4;
+  int v18729=v13509+4;
+  int v18730=v17553+7;
+  int v18731=v17421+8;
+  int v18732=v15068+7;
+  int v18733=v10828+6;
+  int v18734=v3664+8;
+  int v18735=v5383+9;
+  int v18736=v5046+3;
+  int v18737=v11292+5;
+  int v18738=v5428+1;
+  int v18739=v11134+4;
+  int v18740=v3151+3;
+  int v18741=v2565+1;
+  int v18742=v548+7;
+  int v18743=v4292+9;
+  int v18744=v7773+1;
+  int v18745=v13852+8;
+  int v18746=v8989+1;
+  int v18747=v15536+3;
+  int v18748=v2063+9;
+  int v18749=v910+9;
+  int v18750=v15102+8;
+  int v18751=v15695+4;
+  int v18752=v66+9;
+  int v18753=v7274+5;
+  int v18754=v11013+4;
+  int v18755=v12523+3;
+  int v18756=v4472+9;
+  int v18757=v1990+7;
+  int v18758=v2335+8;
+  int v18759=v6236+7;
+  int v18760=v17125+2;
+  int v18761=v124+2;
+  int v18762=v12368+7;
+  int v18763=v12411+3;
+  int v18764=v17830+7;
+  int v18765=v2960+8;
+  int v18766=v4424+1;
+  int v18767=v2173+4;
+  int v18768=v3592+9;
+  int v18769=v2579+3;
+  int v18770=v17431+1;
+  int v18771=v2409+0;
+  int v18772=v11070+4;
+  int v18773=v5301+3;
+  int v18774=v13017+2;
+  int v18775=v14560+1;
+  int v18776=v2641+3;
+  int v18777=v18025+4;
+  int v18778=v15382+8;
+  int v18779=v14084+9;
+  int v18780=v6386+3;
+  int v18781=v18482+8;
+  int v18782=v8053+0;
+  int v18783=v8298+7;
+  int v18784=v9250+0;
+  int v18785=v4055+0;
+  int v18786=v17546+5;
+  int v18787=v830+3;
+  int v18788=v13266+9;
+  int v18789=v2872+4;
+  int v18790=v3827+9;
+  int v18791=v4795+7;
+  int v18792=v1467+9;
+  int v18793=v5291+3;
+  int v18794=v6485+3;
+  int v18795=v12707+2;
+  int v18796=v8020+2;
+  int v18797=v17655+0;
+  int v18798=v4807+7;
+  int v18799=v18788+8;
+  int v18800=v13803+4;
+  int v18801=v5+2;
+  int v18802=v16693+5;
+  int v18803=v4725+9;
+  int v18804=v13424+9;
+  int v18805=v1615+2;
+  int v18806=v5427+1;
+  int v18807=v13512+8;
+  int v18808=v7147+0;
+  int v18809=v12364+3;
+  int v18810=v5714+3;
+  int v18811=v7856+2;
+  int v18812=v12233+4;
+  int v18813=v8568+4;
+  int v18814=v10024+8;
+  int v18815=v5592+2;
+  int v18816=v14716+5;
+  int v18817=v13251+4;
+  int v18818=v17692+3;
+  int v18819=v9782+1;
+  int v18820=v18326+4;
+  int v18821=v1276+7;
+  int v18822=v14616+5;
+  int v18823=v14312+0;
+  int v18824=v492+1;
+  int v18825=v5179+9;
+  int v18826=v13299+2;
+  int v18827=v9296+9;
+  int v18828=v4593+5;
+  int v18829=v10257+2;
+  int v18830=v14953+8;
+  int v18831=v17426+7;
+  int v18832=v15715+8;
+  int v18833=v6942+1;
+  int v18834=v2110+7;
+  int v18835=v14892+1;
+  int v18836=v13356+2;
+  int v18837=v12772+8;
+  int v18838=v15190+7;
+  int v18839=v8812+0;
+  int v18840=v3137+4;
+  int v18841=v17484+6;
+  int v18842=v6134+1;
+  int v18843=v16939+0;
+  int v18844=v1419+7;
+  int v18845=v2392+1;
+  int v18846=v6323+7;
+  int v18847=v7400+1;
+  int v18848=v17305+0;
+  int v18849=v11625+0;
+  int v18850=v5678+1;
+  int v18851=v15915+1;
+  int v18852=v6484+3;
+  int v18853=v16683+0;
+  int v18854=v2609+1;
+  int v18855=v4169+4;
+  int v18856=v598+0;
+  int v18857=v11690+0;
+  int v18858=v16020+9;
+  int v18859=v9896+4;
+  int v18860=v15469+4;
+  int v18861=v3104+9;
+  int v18862=v17785+7;
+  int v18863=v14565+5;
+  int v18864=v9073+8;
+  int v18865=v8727+9;
+  int v18866=v6630+5;
+  int v18867=v11786+6;
+  int v18868=v13687+9;
+  int v18869=v4768+2;
+  int v18870=v3709+9;
+  int v18871=v4931+7;
+  int v18872=v4420+3;
+  int v18873=v12896+0;
+  int v18874=v17497+8;
+  int v18875=v11344+8;
+  int v18876=v15656+0;
+  int v18877=v13804+8;
+  int v18878=v15918+1;
+  int v18879=v3652+7;
+  int v18880=v11230+9;
+  int v18881=v17764+3;
+  int v18882=v8598+6;
+  int v18883=v962+9;
+  int v18884=v3957+2;
+  int v18885=v17103+9;
+  int v18886=v14581+3;
+  int v18887=v15000+8;
+  int v18888=v2425+6;
+  int v18889=v4146+0;
+  int v18890=v11876+9;
+  int v18891=v3680+3;
+  int v18892=v1160+2;
+  int v18893=v7022+7;
+  int v18894=v18432+2;
+  int v18895=v12043+6;
+  int v18896=v2744+8;
+  int v18897=v10620+4;
+  int v18898=v12907+3;
+  int v18899=v12202+1;
+  int v18900=v274+1;
+  int v18901=v8832+8;
+  int v18902=v11284+1;
+  int v18903=v17381+0;
+  int v18904=v8566+1;
+  int v18905=v8569+6;
+  int v18906=v677+2;
+  int v18907=v2153+5;
+  int v18908=v8599+3;
+  int v18909=v13326+4;
+  int v18910=v15577+3;
+  int v18911=v4320+4;
+  int v18912=v5454+3;
+  int v18913=v3399+2;
+  int v18914=v16991+3;
+  int v18915=v10039+1;
+  int v18916=v11278+0;
+  int v18917=v18305+1;
+  int v18918=v13188+3;
+  int v18919=v4984+4;
+  int v18920=v7166+9;
+  int v18921=v7504+5;
+  int v18922=v12720+7;
+  int v18923=v2324+4;
+  int v18924=v12280+9;
+  int v18925=v8567+2;
+  int v18926=v13873+7;
+  int v18927=v17024+5;
+  int v18928=v10678+7;
+  int v18929=v15737+0;
+  int v18930=v13011+4;
+  int v18931=v17889+1;
+  int v18932=v235+3;
+  int v18933=v6357+4;
+  int v18934=v14963+5;
+  int v18935=v11715+3;
+  int v18936=v11431+8;
+  int v18937=v18593+3;
+  int v18938=v10311+2;
+  int v18939=v264+9;
+  int v18940=v16906+3;
+  int v18941=v358+0;
+  int v18942=v9816+4;
+  int v18943=v18127+7;
+  int v18944=v10508+7;
+  int v18945=v4211+9;
+  int v18946=v11780+7;
+  int v18947=v1857+0;
+  int v18948=v4182+6;
+  int v18949=v7004+7;
+  int v18950=v11337+9;
+  int v18951=v8917+1;
+  int v18952=v7411+4;
+  int v18953=v10654+2;
+  int v18954=v15311+6;
+  int v18955=v16985+0;
+  int v18956=v12146+9;
+  int v18957=v13821+4;
+  int v18958=v29+3;
+  int v18959=v2017+2;
+  int v18960=v15959+0;
+  int v18961=v6647+2;
+  int v18962=v16212+4;
+  int v18963=v94+5;
+  int v18964=v17652+6;
+  int v18965=v17692+5;
+  int v18966=v1474+0;
+  int v18967=v11339+7;
+  int v18968=v3803+2;
+  int v18969=v8988+2;
+  int v18970=v17571+1;
+  int v18971=v2815+2;
+  int v18972=v11254+0;
+  int v18973=v14972+2;
+  int v18974=v9157+7;
+  int v18975=v14857+2;
+  int v18976=v1527+8;
+  int v18977=v7242+8;
+  int v18978=v12588+7;
+  int v18979=v17261+5;
+  int v18980=v17820+3;
+  int v18981=v17834+5;
+  int v18982=v2559+6;
+  int v18983=v16810+0;
+  int v18984=v8853+9;
+  int v18985=v14269+3;
+  int v18986=v10888+1;
+  int v18987=v4469+7;
+  int v18988=v6018+2;
+  int v18989=v13717+9;
+  int v18990=v9382+2;
+  int v18991=v2186+1;
+  int v18992=v13367+7;
+  int v18993=v5174+2;
+  int v18994=v6227+3;
+  int v18995=v9072+5;
+  int v18996=v10879+0;
+  int v18997=v18682+7;
+  int v18998=v8191+5;
+  int v18999=v13297+6;
+  int v19000=v4415+0;
+  int v19001=v4523+4;
+  int v19002=v13079+6;
+  int v19003=v18124+2;
+  int v19004=v14701+4;
+  int v19005=v10141+2;
+  int v19006=v6732+2;
+  int v19007=v12633+8;
+  int v19008=v7501+1;
+  int v19009=v9668+7;
+  int v19010=v17269+8;
+  int v19011=v17440+4;
+  int v19012=v1241+7;
+  int v19013=v16320+5;
+  int v19014=v5248+8;
+  int v19015=v10165+9;
+  int v19016=v8158+2;
+  int v19017=v15296+5;
+  int v19018=v17992+8;
+  int v19019=v17290+6;
+  int v19020=v5638+6;
+  int v19021=v16549+5;
+  int v19022=v9466+8;
+  int v19023=v2530+9;
+  int v19024=v2942+8;
+  int v19025=v17771+6;
+  int v19026=v5479+3;
+  int v19027=v2119+3;
+  int v19028=v17095+5;
+  int v19029=v1897+0;
+  int v19030=v17878+9;
+  int v19031=v18518+5;
+  int v19032=v6932+5;
+  int v19033=v2409+3;
+  int v19034=v1739+6;
+  int v19035=v1731+8;
+  int v19036=v2520+0;
+  int v19037=v13686+3;
+  int v19038=v2829+7;
+  int v19039=v11368+6;
+  int v19040=v15467+2;
+  int v19041=v9459+7;
+  int v19042=v12778+9;
+  int v19043=v12801+7;
+  int v19044=v17540+2;
+  int v19045=v13904+2;
+  int v19046=v9274+7;
+  int v19047=v4282+1;
+  int v19048=v624+5;
+  int v19049=v2232+3;
+  int v19050=v7947+5;
+  int v19051=v7995+8;
+  int v19052=v16740+7;
+  int v19053=v14965+6;
+  int v19054=v18907+1;
+  int v19055=v2609+3;
+  int v19056=v8549+4;
+  int v19057=v17057+0;
+  int v19058=v12364+3;
+  int v19059=v9383+9;
+  int v19060=v5356+1;
+  int v19061=v1646+0;
+  int v19062=v8305+7;
+  int v19063=v6887+1;
+  int v19064=v2201+3;
+  int v19065=v8920+7;
+  int v19066=v2004+5;
+  int v19067=v2163+7;
+  int v19068=v1231+2;
+  int v19069=v3072+0;
+  int v19070=v10723+3;
+  int v19071=v7436+6;
+  int v19072=v9931+5;
+  int v19073=v10816+5;
+  int v19074=v16537+7;
+  int v19075=v12202+5;
+  int v19076=v12237+5;
+  int v19077=v2808+8;
+  int v19078=v12603+6;
+  int v19079=v12360+8;
+  int v19080=v11544+7;
+  int v19081=v8802+4;
+  int v19082=v13103+7;
+  int v19083=v15127+8;
+  int v19084=v17855+2;
+  int v19085=v7406+7;
+  int v19086=v2329+1;
+  int v19087=v12836+5;
+  int v19088=v15967+6;
+  int v19089=v11264+1;
+  int v19090=v5960+0;
+  int v19091=v13674+4;
+  int v19092=v5599+8;
+  int v19093=v1742+5;
+  int v19094=v13478+6;
+  int v19095=v9209+5;
+  int v19096=v3429+7;
+  int v19097=v10523+2;
+  int v19098=v18406+3;
+  int v19099=v1861+6;
+  int v19100=v14640+2;
+  int v19101=v248+8;
+  int v19102=v16130+4;
+  int v19103=v15627+3;
+  int v19104=v14948+4;
+  int v19105=v1671+3;
+  int v19106=v18911+8;
+  int v19107=v855+7;
+  int v19108=v13624+2;
+  int v19109=v8965+4;
+  int v19110=v6610+1;
+  int v19111=v16362+2;
+  int v19112=v5692+2;
+  int v19113=v2219+0;
+  int v19114=v18338+8;
+  int v19115=v3796+4;
+  int v19116=v13547+7;
+  int v19117=v11375+4;
+  int v19118=v5705+0;
+  int v19119=v11126+6;
+  int v19120=v14002+5;
+  int v19121=v171+5;
+  int v19122=v3115+3;
+  int v19123=v298+5;
+  int v19124=v7605+2;
+  int v19125=v8310+6;
+  int v19126=v6022+3;
+  int v19127=v684+6;
+  int v19128=v13131+1;
+  int v19129=v18844+3;
+  int v19130=v2760+9;
+  int v19131=v8492+2;
+  int v19132=v8945+9;
+  int v19133=v13178+4;
+  int v19134=v8110+1;
+  int v19135=v6718+7;
+  int v19136=v1871+2;
+  int v19137=v4587+2;
+  int v19138=v15460+2;
+  int v19139=v13538+1;
+  int v19140=v14778+5;
+  int v19141=v556+0;
+  int v19142=v5629+0;
+  int v19143=v6535+6;
+  int v19144=v8806+6;
+  int v19145=v10631+9;
+  int v19146=v18833+7;
+  int v19147=v15300+5;
+  int v19148=v18735+2;
+  int v19149=v10916+1;
+  int v19150=v13487+3;
+  int v19151=v11573+6;
+  int v19152=v17549+5;
+  int v19153=v5716+1;
+  int v19154=v1216+5;
+  int v19155=v19138+4;
+  int v19156=v6669+3;
+  int v19157=v18037+8;
+  int v19158=v2595+2;
+  int v19159=v2397+2;
+  int v19160=v2030+6;
+  int v19161=v4149+0;
+  int v19162=v8791+4;
+  int v19163=v1943+8;
+  int v19164=v16213+8;
+  int v19165=v9890+6;
+  int v19166=v3805+7;
+  int v19167=v2847+6;
+  int v19168=v13215+2;
+  int v19169=v2904+4;
+  int v19170=v16538+3;
+  int v19171=v8087+0;
+  int v19172=v2406+3;
+  int v19173=v9439+3;
+  int v19174=v6003+7;
+  int v19175=v4263+5;
+  int v19176=v13849+1;
+  int v19177=v9749+3;
+  int v19178=v15248+8;
+  int v19179=v16800+1;
+  int v19180=v17713+6;
+  int v19181=v14697+1;
+  int v19182=v10400+8;
+  int v19183=v9702+2;
+  int v19184=v146+3;
+  int v19185=v3415+0;
+  int v19186=v9810+4;
+  int v19187=v17070+8;
+  int v19188=v15624+5;
+  int v19189=v9415+2;
+  int v19190=v2368+2;
+  int v19191=v5410+3;
+  int v19192=v17878+8;
+  int v19193=v16168+6;
+  int v19194=v18116+9;
+  int v19195=v18764+3;
+  int v19196=v5184+2;
+  int v19197=v11897+9;
+  int v19198=v17357+9;
+  int v19199=v12647+2;
+  int v19200=v7303+0;
+  int v19201=v3124+6;
+  int v19202=v6503+3;
+  int v19203=v3585+6;
+  int v19204=v2278+9;
+  int v19205=v12323+3;
+  int v19206=v15011+9;
+  int v19207=v6542+2;
+  int v19208=v18443+5;
+  int v19209=v7823+6;
+  int v19210=v16280+4;
+  int v19211=v6165+7;
+  int v19212=v142+8;
+  int v19213=v18333+9;
+  int v19214=v10466+8;
+  int v19215=v10596+7;
+  int v19216=v2702+9;
+  int v19217=v18037+6;
+  int v19218=v17089+6;
+  int v19219=v1052+2;
+  int v19220=v12392+1;
+  int v19221=v3025+4;
+  int v19222=v16831+0;
+  int v19223=v14708+8;
+  int v19224=v10665+9;
+  int v19225=v6686+7;
+  int v19226=v14470+9;
+  int v19227=v18364+6;
+  int v19228=v14340+9;
+  int v19229=v15071+2;
+  int v19230=v15686+2;
+  int v19231=v1396+7;
+  int v19232=v17049+1;
+  int v19233=v5872+0;
+  int v19234=v7112+2;
+  int v19235=v6456+3;
+  int v19236=v10870+6;
+  int v19237=v1117+5;
+  int v19238=v11303+1;
+  int v19239=v2973+9;
+  int v19240=v16578+6;
+  int v19241=v5951+0;
+  int v19242=v4342+3;
+  int v19243=v8014+7;
+  int v19244=v9620+7;
+  int v19245=v19149+8;
+  int v19246=v14434+0;
+  int v19247=v9383+9;
+  int v19248=v18748+9;
+  int v19249=v16413+7;
+  int v19250=v13589+3;
+  int v19251=v2263+5;
+  int v19252=v10786+3;
+  int v19253=v7007+4;
+  int v19254=v6489+3;
+  int v19255=v7979+9;
+  int v19256=v14541+6;
+  int v19257=v1892+4;
+  int v19258=v2839+2;
+  int v19259=v11292+0;
+  int v19260=v16721+6;
+  int v19261=v17924+8;
+  int v19262=v9439+2;
+  int v19263=v9692+6;
+  int v19264=v18306+5;
+  int v19265=v2850+7;
+  int v19266=v6176+0;
+  int v19267=v11142+1;
+  int v19268=v8294+7;
+  int v19269=v2244+9;
+  int v19270=v805+3;
+  int v19271=v15673+7;
+  int v19272=v15914+2;
+  int v19273=v3507+5;
+  int v19274=v13861+0;
+  int v19275=v6015+1;
+  int v19276=v127+7;
+  int v19277=v2562+8;
+  int v19278=v8972+5;
+  int v19279=v17403+4;
+  int v19280=v4839+6;
+  int v19281=v3007+1;
+  int v19282=v4688+4;
+  int v19283=v12492+1;
+  int v19284=v15458+0;
+  int v19285=v1612+7;
+  int v19286=v5914+9;
+  int v19287=v10721+6;
+  int v19288=v9282+2;
+  int v19289=v5220+5;
+  int v19290=v8491+1;
+  int v19291=v5604+8;
+  int v19292=v12958+0;
+  int v19293=v14668+8;
+  int v19294=v11326+9;
+  int v19295=v1542+4;
+  int v19296=v5777+8;
+  int v19297=v1320+9;
+  int v19298=v18571+0;
+  int v19299=v17454+7;
+  int v19300=v6883+2;
+  int v19301=v19094+1;
+  int v19302=v3217+4;
+  int v19303=v7347+9;
+  int v19304=v13187+9;
+  int v19305=v10414+5;
+  int v19306=v17631+1;
+  int v19307=v7546+5;
+  int v19308=v14131+2;
+  int v19309=v648+0;
+  int v19310=v6331+6;
+  int v19311=v17235+0;
+  int v19312=v4728+7;
+  int v19313=v4985+4;
+  int v19314=v1509+3;
+  int v19315=v5982+9;
+  int v19316=v9627+1;
+  int v19317=v4419+2;
+  int v19318=v2089+4;
+  int v19319=v2954+9;
+  int v19320=v18291+4;
+  int v19321=v8769+3;
+  int v19322=v10457+3;
+  int v19323=v9196+1;
+  int v19324=v9510+8;
+  int v19325=v3277+4;
+  int v19326=v13758+9;
+  int v19327=v6381+7;
+  int v19328=v3633+7;
+  int v19329=v13953+1;
+  int v19330=v2992+5;
+  int v19331=v10788+1;
+  int v19332=v13453+5;
+  int v19333=v12144+6;
+  int v19334=v13654+1;
+  int v19335=v13916+2;
+  int v19336=v4015+5;
+  int v19337=v17772+3;
+  int v19338=v12627+7;
+  int v19339=v5785+4;
+  int v19340=v1851+7;
+  int v19341=v16461+7;
+  int v19342=v2869+0;
+  int v19343=v6401+4;
+  int v19344=v5429+7;
+  int v19345=v2864+3;
+  int v19346=v18276+0;
+  int v19347=v8259+2;
+  int v19348=v196+8;
+  int v19349=v3689+8;
+  int v19350=v9925+9;
+  int v19351=v14460+3;
+  int v19352=v12510+7;
+  int v19353=v10763+7;
+  int v19354=v4489+5;
+  int v19355=v2353+7;
+  int v19356=v2764+1;
+  int v19357=v13652+2;
+  int v19358=v1018+5;
+  int v19359=v13198+3;
+  int v19360=v3083+7;
+  int v19361=v8141+8;
+  int v19362=v4647+4;
+  int v19363=v17872+6;
+  int v19364=v15244+7;
+  int v19365=v5668+8;
+  int v19366=v8371+8;
+  int v19367=v2343+8;
+  int v19368=v6082+6;
+  int v19369=v12345+1;
+  int v19370=v17632+3;
+  int v19371=v7661+6;
+  int v19372=v9300+5;
+  int v19373=v16692+6;
+  int v19374=v17048+8;
+  int v19375=v2174+6;
+  int v19376=v3073+3;
+  int v19377=v9256+6;
+  int v19378=v6271+7;
+  int v19379=v14447+2;
+  int v19380=v476+7;
+  int v19381=v10647+3;
+  int v19382=v10423+9;
+  int v19383=v12020+0;
+  int v19384=v11960+9;
+  int v19385=v6772+8;
+  int v19386=v2288+8;
+  int v19387=v1159+1;
+  int v19388=v10842+5;
+  int v19389=v17615+9;
+  int v19390=v13462+0;
+  int v19391=v6643+3;
+  int v19392=v294+2;
+  int v19393=v3926+8;
+  int v19394=v133+5;
+  int v19395=v13837+0;
+  int v19396=v18772+8;
+  int v19397=v5862+8;
+  int v19398=v821+8;
+  int v19399=v10629+2;
+  int v19400=v3738+9;
+  int v19401=v14997+4;
+  int v19402=v5333+8;
+  int v19403=v11204+7;
+  int v19404=v14471+4;
+  int v19405=v19097+7;
+  int v19406=v17076+7;
+  int v19407=v6769+8;
+  int v19408=v15024+6;
+  int v19409=v11452+4;
+  int v19410=v10228+0;
+  int v19411=v9405+2;
+  int v19412=v12985+6;
+  int v19413=v18889+1;
+  int v19414=v6934+0;
+  int v19415=v5178+6;
+  int v19416=v1981+3;
+  int v19417=v13777+2;
+  int v19418=v2854+6;
+  int v19419=v11037+5;
+  int v19420=v6626+7;
+  int v19421=v10462+2;
+  int v19422=v16910+9;
+  int v19423=v7326+1;
+  int v19424=v10280+1;
+  int v19425=v8527+7;
+  int v19426=v5689+5;
+  int v19427=v4337+1;
+  int v19428=v9055+9;
+  int v19429=v14729+3;
+  int v19430=v13947+7;
+  int v19431=v5928+2;
+  int v19432=v16311+3;
+  int v19433=v363+2;
+  int v19434=v1324+3;
+  int v19435=v19012+6;
+  int v19436=v4549+9;
+  int v19437=v215+5;
+  int v19438=v18213+4;
+  int v19439=v6721+7;
+  int v19440=v13618+6;
+  int v19441=v10731+7;
+  int v19442=v14775+0;
+  int v19443=v18802+5;
+  int v19444=v12071+6;
+  int v19445=v18934+5;
+  int v19446=v9151+1;
+  int v19447=v799+3;
+  int v19448=v16573+8;
+  int v19449=v10054+4;
+  int v19450=v12050+8;
+  int v19451=v4084+1;
+  int v19452=v14575+3;
+  int v19453=v18595+1;
+  int v19454=v18895+0;
+  int v19455=v15928+9;
+  int v19456=v15318+5;
+  int v19457=v14169+5;
+  int v19458=v9783+0;
+  int v19459=v18464+0;
+  int v19460=v2601+9;
+  int v19461=v5051+0;
+  int v19462=v4067+6;
+  int v19463=v14264+6;
+  int v19464=v18371+5;
+  int v19465=v2649+0;
+  int v19466=v7570+8;
+  int v19467=v12675+7;
+  int v19468=v16178+0;
+  int v19469=v18080+2;
+  int v19470=v12134+9;
+  int v19471=v15635+0;
+  int v19472=v4599+7;
+  int v19473=v7548+6;
+  int v19474=v5506+2;
+  int v19475=v15712+1;
+  int v19476=v16902+7;
+  int v19477=v18436+4;
+  int v19478=v11326+6;
+  int v19479=v146+5;
+  int v19480=v13992+2;
+  int v19481=v12639+1;
+  int v19482=v15557+4;
+  int v19483=v14910+3;
+  int v19484=v14325+7;
+  int v19485=v15443+7;
+  int v19486=v1495+2;
+  int v19487=v12351+8;
+  int v19488=v3729+0;
+  int v19489=v374+0;
+  int v19490=v7597+4;
+  int v19491=v3434+6;
+  int v19492=v6260+6;
+  int v19493=v12933+6;
+  int v19494=v4220+9;
+  int v19495=v8164+2;
+  int v19496=v13732+0;
+  int v19497=v15219+1;
+  int v19498=v811+7;
+  int v19499=v17611+9;
+  int v19500=v10863+7;
+  int v19501=v1126+5;
+  int v19502=v2584+3;
+  int v19503=v1857+9;
+  int v19504=v16043+4;
+  int v19505=v8667+2;
+  int v19506=v3471+5;
+  int v19507=v7022+6;
+  int v19508=v10806+6;
+  int v19509=v9182+0;
+  int v19510=v11044+5;
+  int v19511=v16638+6;
+  int v19512=v3795+1;
+  int v19513=v33+7;
+  int v19514=v3340+8;
+  int v19515=v15228+4;
+  int v19516=v3872+3;
+  int v19517=v17514+8;
+  int v19518=v17395+6;
+  int v19519=v9019+5;
+  int v19520=v5016+0;
+  int v19521=v13415+2;
+  int v19522=v4567+9;
+  int v19523=v70+9;
+  int v19524=v6367+5;
+  int v19525=v10262+1;
+  int v19526=v6661+0;
+  int v19527=v13882+6;
+  int v19528=v11238+6;
+  int v19529=v11001+2;
+  int v19530=v4704+6;
+  int v19531=v3337+7;
+  int v19532=v3840+0;
+  int v19533=v13785+1;
+  int v19534=v5868+9;
+  int v19535=v18475+7;
+  int v19536=v11962+1;
+  int v19537=v7730+0;
+  int v19538=v19537+9;
+  int v19539=v11950+3;
+  int v19540=v13458+5;
+  int v19541=v5857+7;
+  int v19542=v14883+4;
+  int v19543=v1486+1;
+  int v19544=v5643+0;
+  int v19545=v17633+9;
+  int v19546=v12825+9;
+  int v19547=v1206+3;
+  int v19548=v7814+4;
+  int v19549=v18739+3;
+  int v19550=v1747+5;
+  int v19551=v7575+7;
+  int v19552=v8427+1;
+  int v19553=v12384+6;
+  int v19554=v10476+0;
+  int v19555=v9351+0;
+  int v19556=v11222+5;
+  int v19557=v15587+5;
+  int v19558=v2823+1;
+  int v19559=v15439+5;
+  int v19560=v3485+1;
+  int v19561=v18250+6;
+  int v19562=v15305+7;
+  int v19563=v5175+7;
+  int v19564=v16147+1;
+  int v19565=v5928+0;
+  int v19566=v11913+1;
+  int v19567=v16278+4;
+  int v19568=v9771+9;
+  int v19569=v5602+9;
+  int v19570=v2279+6;
+  int v19571=v15206+9;
+  int v19572=v1046+8;
+  int v19573=v2617+8;
+  int v19574=v10450+3;
+  int v19575=v17133+0;
+  int v19576=v2664+7;
+  int v19577=v391+3;
+  int v19578=v7645+9;
+  int v19579=v18217+3;
+  int v19580=v7684+3;
+  int v19581=v12430+6;
+  int v19582=v18046+2;
+  int v19583=v8606+6;
+  int v19584=v18213+4;
+  int v19585=v7393+2;
+  int v19586=v14889+1;
+  int v19587=v14400+4;
+  int v19588=v9147+2;
+  int v19589=v14426+1;
+  int v19590=v12311+7;
+  int v19591=v17124+5;
+  int v19592=v1744+0;
+  int v19593=v10528+5;
+  int v19594=v19216+0;
+  int v19595=v970+6;
+  int v19596=v8811+4;
+  int v19597=v4741+8;
+  int v19598=v13519+5;
+  int v19599=v10497+4;
+  int v19600=v15416+9;
+  int v19601=v16416+1;
+  int v19602=v13528+9;
+  int v19603=v13052+6;
+  int v19604=v5445+0;
+  int v19605=v15333+4;
+  int v19606=v7106+7;
+  int v19607=v612+6;
+  int v19608=v10611+7;
+  int v19609=v2689+3;
+  int v19610=v3492+9;
+  int v19611=v9060+2;
+  int v19612=v2049+3;
+  int v19613=v12322+7;
+  int v19614=v14337+1;
+  int v19615=v3894+3;
+  int v19616=v8450+0;
+  int v19617=v14214+8;
+  int v19618=v1429+9;
+  int v19619=v4907+9;
+  int v19620=v12791+2;
+  int v19621=v5938+6;
+  int v19622=v5765+1;
+  int v19623=v13171+6;
+  int v19624=v3504+7;
+  int v19625=v8895+1;
+  int v19626=v7454+3;
+  int v19627=v10167+3;
+  int v19628=v11547+0;
+  int v19629=v8535+9;
+  int v19630=v9743+8;
+  int v19631=v4637+5;
+  int v19632=v5782+4;
+  int v19633=v1960+3;
+  int v19634=v8699+6;
+  int v19635=v12266+9;
+  int v19636=v14784+4;
+  int v19637=v13195+4;
+  int v19638=v8675+9;
+  int v19639=v11195+1;
+  int v19640=v10426+5;
+  int v19641=v10444+6;
+  int v19642=v13314+3;
+  int v19643=v14999+7;
+  int v19644=v13523+9;
+  int v19645=v17268+8;
+  int v19646=v18837+0;
+  int v19647=v11865+5;
+  int v19648=v11480+7;
+  int v19649=v6058+2;
+  int v19650=v8003+0;
+  int v19651=v11887+6;
+  int v19652=v19232+0;
+  int v19653=v19614+2;
+  int v19654=v6998+8;
+  int v19655=v7552+5;
+  int v19656=v10297+4;
+  int v19657=v6509+6;
+  int v19658=v14581+3;
+  int v19659=v14243+6;
+  int v19660=v9677+2;
+  int v19661=v5572+8;
+  int v19662=v6265+1;
+  int v19663=v12231+1;
+  int v19664=v3511+4;
+  int v19665=v4413+4;
+  int v19666=v15611+2;
+  int v19667=v16416+0;
+  int v19668=v8024+9;
+  int v19669=v432+0;
+  int v19670=v17640+8;
+  int v19671=v16853+9;
+  int v19672=v14273+4;
+  int v19673=v6405+7;
+  int v19674=v16182+1;
+  int v19675=v6326+7;
+  int v19676=v4244+3;
+  int v19677=v18231+7;
+  int v19678=v16754+5;
+  int v19679=v14852+0;
+  int v19680=v17856+8;
+  int v19681=v15382+9;
+  int v19682=v2413+0;
+  int v19683=v1784+9;
+  int v19684=v16667+1;
+  int v19685=v7167+6;
+  int v19686=v17682+5;
+  int v19687=v19332+3;
+  int v19688=v7629+2;
+  int v19689=v2445+4;
+  int v19690=v15138+1;
+  int v19691=v11163+6;
+  int v19692=v2770+2;
+  int v19693=v15496+3;
+  int v19694=v6635+0;
+  int v19695=v11512+2;
+  int v19696=v5742+2;
+  int v19697=v1039+6;
+  int v19698=v1983+6;
+  int v19699=v13671+1;
+  int v19700=v7969+7;
+  int v19701=v16491+4;
+  int v19702=v11872+4;
+  int v19703=v16263+0;
+  int v19704=v17985+4;
+  int v19705=v2159+4;
+  int v19706=v6458+9;
+  int v19707=v18480+7;
+  int v19708=v14373+2;
+  int v19709=v18606+3;
+  int v19710=v2172+2;
+  int v19711=v14052+2;
+  int v19712=v750+8;
+  int v19713=v13665+7;
+  int v19714=v10979+9;
+  int v19715=v8110+6;
+  int v19716=v14395+5;
+  int v19717=v4296+2;
+  int v19718=v11417+1;
+  int v19719=v15337+0;
+  int v19720=v8856+5;
+  int v19721=v15613+2;
+  int v19722=v18332+7;
+  int v19723=v14594+1;
+  int v19724=v6540+8;
+  int v19725=v15064+9;
+  int v19726=v3450+5;
+  int v19727=v11211+4;
+  int v19728=v1003+1;
+  int v19729=v6845+6;
+  int v19730=v9627+3;
+  int v19731=v4976+7;
+  int v19732=v1046+3;
+  int v19733=v1770+9;
+  int v19734=v9110+6;
+  int v19735=v17060+2;
+  int v19736=v19029+9;
+  int v19737=v15808+4;
+  int v19738=v8153+1;
+  int v19739=v5449+6;
+  int v19740=v10230+1;
+  int v19741=v16289+1;
+  int v19742=v13047+1;
+  int v19743=v7088+1;
+  int v19744=v18773+5;
+  int v19745=v9827+0;
+  int v19746=v3025+6;
+  int v19747=v3716+6;
+  int v19748=v5928+7;
+  int v19749=v11606+2;
+  int v19750=v4540+5;
+  int v19751=v7009+9;
+  int v19752=v18183+4;
+  int v19753=v11987+0;
+  int v19754=v17338+9;
+  int v19755=v15584+8;
+  int v19756=v2064+8;
+  int v19757=v11734+7;
+  int v19758=v2999+7;
+  int v19759=v5016+0;
+  int v19760=v7771+5;
+  int v19761=v18169+4;
+  int v19762=v3021+4;
+  int v19763=v7384+0;
+  int v19764=v18485+1;
+  int v19765=v4549+0;
+  int v19766=v135+6;
+  int v19767=v12803+7;
+  int v19768=v15097+3;
+  int v19769=v3989+1;
+  int v19770=v12244+9;
+  int v19771=v14105+5;
+  int v19772=v10421+8;
+  int v19773=v7072+9;
+  int v19774=v16968+3;
+  int v19775=v3606+5;
+  int v19776=v16325+6;
+  int v19777=v15317+3;
+  int v19778=v13676+0;
+  int v19779=v2051+6;
+  int v19780=v16926+4;
+  int v19781=v19749+5;
+  int v19782=v8166+9;
+  int v19783=v17125+9;
+  int v19784=v697+8;
+  int v19785=v3876+0;
+  int v19786=v11952+7;
+  int v19787=v13300+1;
+  int v19788=v10795+2;
+  int v19789=v10903+0;
+  int v19790=v402+1;
+  int v19791=v5241+0;
+  int v19792=v923+6;
+  int v19793=v10440+8;
+  int v19794=v6636+3;
+  int v19795=v5973+6;
+  int v19796=v6305+0;
+  int v19797=v18478+3;
+  int v19798=v6683+8;
+  int v19799=v3764+0;
+  int v19800=v11171+8;
+  int v19801=v13281+7;
+  int v19802=v6050+5;
+  int v19803=v3910+6;
+  int v19804=v5669+7;
+  int v19805=v3888+3;
+  int v19806=v3499+2;
+  int v19807=v6987+2;
+  int v19808=v15919+5;
+  int v19809=v401+6;
+  int v19810=v804+1;
+  int v19811=v8862+5;
+  int v19812=v15610+9;
+  int v19813=v4025+8;
+  int v19814=v19727+8;
+  int v19815=v5805+0;
+  int v19816=v3546+3;
+  int v19817=v14113+2;
+  int v19818=v11442+5;
+  int v19819=v6940+5;
+  int v19820=v12144+7;
+  int v19821=v17203+5;
+  int v19822=v2221+8;
+  int v19823=v16601+7;
+  int v19824=v1877+8;
+  int v19825=v19192+4;
+  int v19826=v4268+9;
+  int v19827=v17976+7;
+  int v19828=v1715+9;
+  int v19829=v7742+3;
+  int v19830=v4756+4;
+  int v19831=v5317+1;
+  int v19832=v6318+1;
+  int v19833=v14305+8;
+  int v19834=v1006+4;
+  int v19835=v16022+2;
+  int v19836=v1760+9;
+  int v19837=v16168+8;
+  int v19838=v19096+9;
+  int v19839=v16653+8;
+  int v19840=v4510+8;
+  int v19841=v3195+1;
+  int v19842=v3083+0;
+  int v19843=v5523+1;
+  int v19844=v7800+2;
+  int v19845=v3928+0;
+  int v19846=v16891+3;
+  int v19847=v11608+7;
+  int v19848=v9586+2;
+  int v19849=v16900+4;
+  int v19850=v3078+6;
+  int v19851=v18857+2;
+  int v19852=v11744+7;
+  int v19853=v16250+2;
+  int v19854=v12061+3;
+  int v19855=v19373+8;
+  int v19856=v17137+4;
+  int v19857=v4750+0;
+  int v19858=v9356+0;
+  int v19859=v9120+6;
+  int v19860=v5396+8;
+  int v19861=v14685+8;
+  int v19862=v4195+8;
+  int v19863=v2803+3;
+  int v19864=v14746+6;
+  int v19865=v113+0;
+  int v19866=v8769+3;
+  int v19867=v10691+3;
+  int v19868=v8118+1;
+  int v19869=v10655+9;
+  int v19870=v10102+2;
+  int v19871=v6633+2;
+  int v19872=v10304+5;
+  int v19873=v18400+6;
+  int v19874=v4358+3;
+  int v19875=v2423+4;
+  int v19876=v18539+3;
+  int v19877=v5497+6;
+  int v19878=v3068+0;
+  int v19879=v8987+4;
+  int v19880=v19723+6;
+  int v19881=v9129+8;
+  int v19882=v558+9;
+  int v19883=v2936+2;
+  int v19884=v16532+5;
+  int v19885=v3654+1;
+  int v19886=v3471+4;
+  int v19887=v17053+2;
+  int v19888=v118+4;
+  int v19889=v2817+0;
+  int v19890=v3947+3;
+  int v19891=v7008+9;
+  int v19892=v17797+7;
+  int v19893=v974+6;
+  int v19894=v5570+5;
+  int v19895=v18471+6;
+  int v19896=v15534+4;
+  int v19897=v8224+3;
+  int v19898=v13756+3;
+  int v19899=v19414+8;
+  int v19900=v16413+3;
+  int v19901=v19085+1;
+  int v19902=v5429+9;
+  int v19903=v1420+5;
+  int v19904=v10717+6;
+  int v19905=v5508+1;
+  int v19906=v664+3;
+  int v19907=v13613+5;
+  int v19908=v2134+2;
+  int v19909=v17714+7;
+  int v19910=v19441+5;
+  int v19911=v9866+5;
+  int v19912=v7601+8;
+  int v19913=v8533+2;
+  int v19914=v14250+4;
+  int v19915=v18804+2;
+  int v19916=v4012+0;
+  int v19917=v7039+4;
+  int v19918=v11959+4;
+  int v19919=v4191+0;
+  int v19920=v10248+2;
+  int v19921=v16514+6;
+  int v19922=v8254+8;
+  int v19923=v9288+0;
+  int v19924=v13365+7;
+  int v19925=v16366+6;
+  int v19926=v18900+3;
+  int v19927=v6242+5;
+  int v19928=v17904+4;
+  int v19929=v458+9;
+  int v19930=v12286+4;
+  int v19931=v296+8;
+  int v19932=v18904+7;
+  int v19933=v3896+2;
+  int v19934=v10364+1;
+  int v19935=v11375+3;
+  int v19936=v5501+9;
+  int v19937=v5182+1;
+  int v19938=v8435+3;
+  int v19939=v17273+2;
+  int v19940=v11839+6;
+  int v19941=v1803+5;
+  int v19942=v14870+0;
+  int v19943=v15145+4;
+  int v19944=v3146+2;
+  int v19945=v9890+7;
+  int v19946=v17423+5;
+  int v19947=v14580+4;
+  int v19948=v14878+3;
+  int v19949=v7346+7;
+  int v19950=v19326+4;
+  int v19951=v900+3;
+  int v19952=v17963+5;
+  int v19953=v5046+6;
+  int v19954=v13225+9;
+  int v19955=v2549+9;
+  int v19956=v1057+2;
+  int v19957=v4207+5;
+  int v19958=v3866+4;
+  int v19959=v10477+9;
+  int v19960=v9354+7;
+  int v19961=v4169+2;
+  int v19962=v645+6;
+  int v19963=v12127+0;
+  int v19964=v9063+3;
+  int v19965=v7293+2;
+  int v19966=v18192+0;
+  int v19967=v16180+8;
+  int v19968=v9158+0;
+  int v19969=v15165+6;
+  int v19970=v7132+4;
+  int v19971=v4590+3;
+  int v19972=v17385+3;
+  int v19973=v19868+3;
+  int v19974=v11921+0;
+  int v19975=v2381+7;
+  int v19976=v14696+1;
+  int v19977=v4035+7;
+  int v19978=v19431+0;
+  int v19979=v274+4;
+  int v19980=v4359+6;
+  int v19981=v5596+8;
+  int v19982=v2265+4;
+  int v19983=v12858+9;
+  int v19984=v9390+5;
+  int v19985=v16096+1;
+  int v19986=v8608+4;
+  int v19987=v7359+4;
+  int v19988=v17811+8;
+  int v19989=v11000+7;
+  int v19990=v2317+7;
+  int v19991=v12133+1;
+  int v19992=v10175+6;
+  int v19993=v7581+7;
+  int v19994=v19662+3;
+  int v19995=v6936+2;
+  int v19996=v16322+0;
+  int v19997=v13912+8;
+  int v19998=v13807+8;
+  int v19999=v9260+8;
+  int *p=&v0;
+  v9967=v10299*v18763-*p;
+  v11411=v9850*v9922-*p;
+  v2722=v8789*v14143-*p;
+  v8291=v18084*v6336-*p;
+  v17729=v19883*v17435-*p;
+  v18347=v905*v14094-*p;
+  v15102=v1443*v12980-*p;
+  v19157=v5172*v10979-*p;
+  v8085=v12650*v14503-*p;
+  v5093=v8895*v8434-*p;
+  v13720=v8839*v7714-*p;
+  v3456=v11390*v19777-*p;
+  v19865=v1994*v4527-*p;
+  v17733=v267*v8651-*p;
+  v5613=v15158*v4465-*p;
+  v17860=v14213*v19840-*p;
+  v5640=v7997*v1720-*p;
+  v10790=v3714*v16579-*p;
+  v17240=v5303*v14723-*p;
+  v16191=v13640*v9631-*p;
+  v12617=v18624*v17771-*p;
+  v2527=v1936*v5624-*p;
+  v10203=v17723*v11691-*p;
+  v17806=v18729*v1171-*p;
+  v5034=v11817*v12763-*p;
+  v1904=v17233*v9773-*p;
+  v16218=v17926*v7574-*p;
+  v4455=v8727*v16586-*p;
+  v15309=v10640*v13815-*p;
+  v14599=v15044*v6003-*p;
+  v13128=v15437*v12409-*p;
+  v17287=v9642*v12754-*p;
+  v1444=v6978*v10132-*p;
+  v6885=v10539*v10111-*p;
+  v8078=v9503*v17488-*p;
+  v10046=v13851*v5117-*p;
+  v13376=v16669*v3522-*p;
+  v1651=v7167*v2876-*p;
+  v17704=v6498*v16764-*p;
+  v9921=v15984*v3977-*p;
+  v16606=v4907*v18862-*p;
+  v7463=v14820*v19861-*p;
+  v15812=v10196*v18488-*p;
+  v1507=v6402*v15378-*p;
+  v9586=v17228*v7171-*p;
+  v5630=v14518*v12716-*p;
+  v16060=v12359*v19361-*p;
+  v15716=v10639*v13173-*p;
+  v14549=v2888*v15689-*p;
+  v1894=v11125*v13720-*p;
+  v18740=v5976*v5712-*p;
+  v5200=v18284*v138-*p;
+  v6489=v12098*v2681-*p;
+  v6714=v4586*v4113-*p;
+  v19256=v16852*v14881-*p;
+  v5621=v19866*v12801-*p;
+  v13094=v10053*v5384-*p;
+  v1393=v13016*v18529-*p;
+  v12767=v9454*v17971-*p;
+  v2865=v19484*v14867-*p;
+  v2073=v12201*v18994-*p;
+  v3008=v12315*v2545-*p;
+  v7503=v1675*v8106-*p;
+  v13031=v3850*v9499-*p;
+  v3469=v3890*v16138-*p;
+  v18082=v4014*v15535-*p;
+  v10632=v15981*v19360-*p;
+  v4944=v2702*v3755-*p;
+  v18053=v7783*v7626-*p;
+  v11195=v7412*v18146-*p;
+  v5019=v6950*v19481-*p;
+  v16168=v3335*v17685-*p;
+  v13130=v11792*v6691-*p;
+  v12631=v9876*v19700-*p;
+  v621=v14739*v18497-*p;
+  v264=v4768*v6341-*p;
+  v15822=v15629*v18038-*p;
+  v4664=v9433*v15672-*p;
+  v13150=v7378*v6963-*p;
+  v13822=v17421*v2247-*p;
+  v2778=v14961*v6843-*p;
+  v2122=v7548*v7413-*p;
+  v5069=v6202*v16586-*p;
+  v10063=v14426*v15692-*p;
+  v9434=v15521*v5567-*p;
+  v4604=v6064*v14253-*p;
+  v13834=v13699*v4080-*p;
+  v1998=v2306*v5401-*p;
+  v17910=v4099*v15399-*p;
+  v15926=v17267*v1173-*p;
+  v9837=v1497*v456-*p;
+  v16146=v17957*v1241-*p;
+  v19658=v11353*v12710-*p;
+  v12895=v10825*v18794-*p;
+  v3882=v14982*v601-*p;
+  v16643=v5490*v9665-*p;
+  v18215=v10312*v6510-*p;
+  v9517=v10860*v13150-*p;
+  v5043=v14397*v3416-*p;
+  v18466=v17139*v1219-*p;
+  v9130=v1760*v4828-*p;
+  v6675=v5020*v7202-*p;
+  v11247=v15126*v11405-*p;
+  v10049=v2927*v3844-*p;
+  v11953=v13814*v16615-*p;
+  v7577=v1645*v5945-*p;
+  v17871=v12607*v13654-*p;
+  v16267=v7896*v10506-*p;
+  v19339=v19704*v2653-*p;
+  v10262=v10821*v9703-*p;
+  v19384=v10963*v891-*p;
+  v3396=v10245*v14328-*p;
+  v14538=v5283*v18681-*p;
+  v7250=v1711*v6450-*p;
+  v1281=v17612*v18401-*p;
+  v12526=v6918*v8967-*p;
+  v319=v698*v10239-*p;
+  v6426=v15702*v8738-*p;
+  v15363=v11126*v15894-*p;
+  v15207=v16027*v19472-*p;
+  v11941=v11015*v7763-*p;
+  v1358=v5266*v13729-*p;
+  v16714=v2083*v8013-*p;
+  v14142=v15468*v16729-*p;
+  v784=v6474*v7134-*p;
+  v2430=v7078*v16514-*p;
+  v11152=v7332*v10575-*p;
+  v9645=v11709*v11265-*p;
+  v6595=v5173*v9962-*p;
+  v14211=v15262*v14912-*p;
+  v19156=v11374*v6579-*p;
+  v8855=v6019*v17242-*p;
+  v17407=v2312*v1695-*p;
+  v15869=v19566*v1023-*p;
+  v17359=v7436*v10704-*p;
+  v16545=v10141*v108-*p;
+  v14054=v11970*v14221-*p;
+  v16075=v10535*v15206-*p;
+  v6345=v9529*v18363-*p;
+  v5193=v14410*v447-*p;
+  v11918=v16823*v18539-*p;
+  v19541=v6919*v4968-*p;
+  v17241=v13056*v2008-*p;
+  v3544=v17220*v57-*p;
+  v14934=v6453*v14738-*p;
+  v3495=v1164*v9690-*p;
+  v13627=v19119*v5141-*p;
+  v8822=v773*v3969-*p;
+  v6530=v10547*v19104-*p;
+  v19251=v13744*v225-*p;
+  v7836=v14885*v13973-*p;
+  v5784=v1627*v5023-*p;
+  v14800=v9414*v16293-*p;
+  v12321=v15356*v7291-*p;
+  v2231=v9096*v8119-*p;
+  v19582=v4530*v1074-*p;
+  v16927=v4791*v12087-*p;
+  v15413=v5366*v11615-*p;
+  v13574=v18788*v1941-*p;
+  v15387=v10526*v8967-*p;
+  v14589=v10280*v10024-*p;
+  v6228=v10392*v13388-*p;
+  v6251=v16605*v832-*p;
+  v4875=v14701*v113-*p;
+  v17543=v18812*v14851-*p;
+  v12500=v11683*v3563-*p;
+  v5125=v2556*v19784-*p;
+  v4974=v18591*v1436-*p;
+  v7554=v8979*v19438-*p;
+  v68=v2581*v4474-*p;
+  v2968=v1630*v10598-*p;
+  v2761=v3682*v3322-*p;
+  v16484=v145*v11095-*p;
+  v8051=v8263*v12883-*p;
+  v19111=v4521*v18244-*p;
+  v18172=v4899*v4229-*p;
+  v6653=v15189*v8462-*p;
+  v9040=v7162*v8757-*p;
+  v7756=v14820*v2487-*p;
+  v8690=v11286*v17166-*p;
+  v5087=v11597*v4050-*p;
+  v9205=v13900*v19843-*p;
+  v14913=v4047*v2369-*p;
+  v10290=v10034*v17929-*p;
+  v7248=v11504*v14568-*p;
+  v712=v15033*v403-*p;
+  v1966=v10775*v11607-*p;
+  v16311=v19465*v6357-*p;
+  v19185=v5156*v11685-*p;
+  v10691=v7071*v19801-*p;
+  v19305=v7971*v14504-*p;
+  v16865=v10495*v2886-*p;
+  v5830=v18460*v10790-*p;
+  v16256=v8072*v2598-*p;
+  v2344=v18382*v15099-*p;
+  v956=v19172*v7611-*p;
+  v5110=v10812*v14979-*p;
+  v3901=v7779*v17563-*p;
+  v13859=v15186*v1427-*p;
+  v5138=v9025*v1592-*p;
+  v3828=v17893*v6535-*p;
+  v17161=v5391*v3955-*p;
+  v8233=v10709*v12822-*p;
+  v9118=v18022*v14932-*p;
+  v12222=v8359*v3205-*p;
+  v8732=v17177*v3358-*p;
+  v11103=v7586*v6209-*p;
+  v841=v2174*v671-*p;
+  v5887=v10959*v4232-*p;
+  v9874=v2643*v7523-*p;
+  v13763=v354*v5707-*p;
+  v13225=v19410*v1213-*p;
+  v11250=v2982*v12758-*p;
+  v7532=v7431*v13310-*p;
+  v4664=v19681*v1005-*p;
+  v14388=v4110*v7569-*p;
+  v6320=v7548*v6324-*p;
+  v3245=v1563*v2651-*p;
+  v11192=v12774*v5339-*p;
+  v9802=v7913*v17703-*p;
+  v1959=v15770*v8508-*p;
+  v15805=v14466*v19566-*p;
+  v12052=v16095*v7780-*p;
+  v8704=v6368*v5492-*p;
+  v440=v3107*v14479-*p;
+  v3119=v2596*v14976-*p;
+  v12868=v3302*v8722-*p;
+  v6598=v12942*v18254-*p;
+  v18704=v9210*v3024-*p;
+  v5070=v2662*v93-*p;
+  v2082=v9466*v18038-*p;
+  v6605=v2408*v2000-*p;
+  v10228=v5379*v11400-*p;
+  v4175=v17079*v3855-*p;
+  v19861=v5060*v8886-*p;
+  v5577=v15466*v10487-*p;
+  v11314=v10345*v11689-*p;
+  v437=v1525*v4395-*p;
+  v15235=v18271*v1419-*p;
+  v10622=v3224*v9768-*p;
+  v1993=v1432*v18881-*p;
+  v11688=v12106*v13414-*p;
+  v4833=v19462*v19743-*p;
+  v1416=v64*v9219-*p;
+  v15575=v785*v2440-*p;
+  v16426=v5734*v13371-*p;
+  v13828=v6965*v9438-*p;
+  v16765=v14098*v6868-*p;
+  v13781=v10322*v9312-*p;
+  v2277=v16960*v17706-*p;
+  v4100=v18369*v4396-*p;
+  v14424=v16316*v8246-*p;
+  v3427=v17345*v13235-*p;
+  v17587=v6830*v16757-*p;
+  v19525=v156*v8151-*p;
+  v16539=v11830*v1351-*p;
+  v1790=v4748*v8210-*p;
+  v1806=v11150*v9146-*p;
+  v12535=v4410*v18881-*p;
+  v17709=v7381*v14056-*p;
+  v15018=v9118*v10903-*p;
+  v13593=v17604*v16613-*p;
+  v10610=v15328*v12560-*p;
+  v10539=v6544*v862-*p;
+  v7498=v7438*v19951-*p;
+  v15856=v3906*v19700-*p;
+  v18581=v18277*v9787-*p;
+  v9914=v18169*v19010-*p;
+  v13656=v17975*v19281-*p;
+  v1447=v8883*v19875-*p;
+  v8891=v10200*v18338-*p;
+  v9172=v17784*v6911-*p;
+  v1732=v18879*v3804-*p;
+  v16928=v10802*v14368-*p;
+  v18065=v2923*v724-*p;
+  v13823=v17599*v17445-*p;
+  v6667=v4368*v14495-*p;
+  v8597=v9579*v10242-*p;
+  v7120=v121*v12182-*p;
+  v11937=v3486*v4359-*p;
+  v16689=v17464*v13761-*p;
+  v7910=v1596*v3804-*p;
+  v18202=v17793*v6059-*p;
+  v12197=v13132*v16410-*p;
+  v12268=v9023*v1137-*p;
+  v5280=v2557*v6322-*p;
+  v4843=v1571*v4011-*p;
+  v13928=v8715*v18734-*p;
+  v11625=v16307*v6137-*p;
+  v8906=v12474*v11720-*p;
+  v10255=v18883*v18130-*p;
+  v5433=v11474*v12607-*p;
+  v8359=v7743*v1255-*p;
+  v7257=v5869*v16777-*p;
+  v12890=v1235*v10051-*p;
+  v19634=v10160*v16065-*p;
+  v2500=v13260*v14785-*p;
+  v13576=v19775*v15215-*p;
+  v7418=v10741*v67-*p;
+  v9594=v6762*v15902-*p;
+  v8940=v4761*v19694-*p;
+  v14059=v13689*v2112-*p;
+  v15809=v18225*v19391-*p;
+  v6389=v8715*v13082-*p;
+  v18147=v15474*v14480-*p;
+  v19221=v2148*v16632-*p;
+  v1473=v13495*v4820-*p;
+  v1131=v4214*v10883-*p;
+  v7368=v15730*v10779-*p;
+  v4561=v4140*v3958-*p;
+  v2836=v13937*v15815-*p;
+  v19608=v7237*v4592-*p;
+  v4690=v3259*v12726-*p;
+  v11211=v7203*v6103-*p;
+  v18617=v8350*v11154-*p;
+  v19514=v19605*v1609-*p;
+  v16108=v3501*v2480-*p;
+  v7507=v9443*v6629-*p;
+  v19779=v11017*v12409-*p;
+  v548=v10396*v12650-*p;
+  v17213=v12*v13536-*p;
+  v2859=v13018*v7030-*p;
+  v934=v4404*v10745-*p;
+  v9376=v5950*v776-*p;
+  v4920=v4729*v11898-*p;
+  v8093=v6468*v1193-*p;
+  v11011=v1676*v7083-*p;
+  v12379=v11989*v18261-*p;
+  v19524=v1932*v18619-*p;
+  v19699=v10268*v3415-*p;
+  v16291=v522*v9622-*p;
+  v3844=v8008*v4926-*p;
+  v6189=v10747*v5781-*p;
+  v12400=v11931*v1736-*p;
+  v9859=v6648*v6750-*p;
+  v16201=v5375*v19744-*p;
+  v19124=v12651*v12547-*p;
+  v682=v10087*v14045-*p;
+  v14775=v3539*v5495-*p;
+  v15152=v16006*v11234-*p;
+  v11846=v10317*v1097-*p;
+  v4424=v15596*v8990-*p;
+  v6875=v16216*v14942-*p;
+  v13557=v8884*v10275-*p;
+  v9839=v18234*v12747-*p;
+  v2149=v17607*v3213-*p;
+  v13192=v3810*v18870-*p;
+  v5225=v11152*v4828-*p;
+  v1419=v19289*v4932-*p;
+  v14588=v6671*v13059-*p;
+  v14824=v14029*v19126-*p;
+  v16969=v12153*v19440-*p;
+  v14846=v16876*v17772-*p;
+  v17037=v12157*v19272-*p;
+  v1243=v7112*v15960-*p;
+  v13316=v1122*v1253-*p;
+  v1947=v2031*v7352-*p;
+  v12783=v6642*v10027-*p;
+  v3552=v13098*v1700-*p;
+  v19744=v672*v7154-*p;
+  v18155=v3609*v1327-*p;
+  v11458=v15982*v16018-*p;
+  v6134=v4326*v19009-*p;
+  v6033=v13385*v1491-*p;
+  v6582=v8327*v4780-*p;
+  v12813=v13803*v6779-*p;
+  v6640=v14057*v16114-*p;
+  v14091=v2467*v14149-*p;
+  v14833=v14202*v3166-*p;
+  v7556=v7225*v16906-*p;
+  v17736=v12922*v19647-*p;
+  v18919=v16115*v315-*p;
+  v7735=v789*v521-*p;
+  v9817=v17968*v16481-*p;
+  v14573=v4132*v13908-*p;
+  v16760=v5133*v5369-*p;
+  v11865=v8628*v7621-*p;
+  v606=v16586*v14112-*p;
+  v5391=v4219*v19454-*p;
+  v13233=v328*v925-*p;
+  v435=v9304*v7749-*p;
+  v10673=v19831*v9797-*p;
+  v2707=v10496*v7330-*p;
+  v1147=v3970*v5338-*p;
+  v8259=v7794*v4000-*p;
+  v1983=v2334*v13246-*p;
+  v9512=v18616*v16827-*p;
+  v7190=v7973*v6350-*p;
+  v15385=v17187*v5828-*p;
+  v2149=v18750*v1675-*p;
+  v111=v16955*v1375-*p;
+  v16177=v489*v1860-*p;
+  v17900=v5662*v8249-*p;
+  v701=v8282*v6999-*p;
+  v19349=v13065*v15225-*p;
+  v16918=v7252*v13044-*p;
+  v7687=v6242*v8012-*p;
+  v19272=v10710*v12743-*p;
+  v2808=v1970*v12910-*p;
+  v16639=v13544*v2820-*p;
+  v14728=v16500*v6598-*p;
+  v7689=v9296*v16869-*p;
+  v11152=v3025*v1914-*p;
+  v13173=v5722*v19585-*p;
+  v2828=v2303*v13046-*p;
+  v2915=v13656*v4181-*p;
+  v9109=v7498*v12511-*p;
+  v13022=v3364*v17168-*p;
+  v6792=v19919*v16193-*p;
+  v19632=v1244*v6726-*p;
+  v13585=v8975*v18601-*p;
+  v2271=v3938*v5457-*p;
+  v16525=v9675*v562-*p;
+  v6722=v2393*v1179-*p;
+  v4872=v7176*v8314-*p;
+  v5280=v12583*v3148-*p;
+  v19170=v11799*v760-*p;
+  v2681=v16900*v2904-*p;
+  v6585=v10479*v3671-*p;
+  v18334=v539*v5245-*p;
+  v1094=v5679*v2364-*p;
+  v11591=v4293*v16429-*p;
+  v17894=v9276*v8497-*p;
+  v12360=v7453*v7240-*p;
+  v12698=v4215*v6674-*p;
+  v15959=v17528*v12914-*p;
+  v2198=v2339*v1910-*p;
+  v15848=v13466*v165-*p;
+  v3449=v7363*v18444-*p;
+  v12833=v7030*v9531-*p;
+  v16858=v2102*v8504-*p;
+  v2593=v5375*v6717-*p;
+  v2098=v1785*v17298-*p;
+  v6805=v11497*v3816-*p;
+  v13930=v16084*v16733-*p;
+  v17946=v2202*v13136-*p;
+  v1836=v14451*v10863-*p;
+  v4363=v7572*v9967-*p;
+  v2438=v6721*v6491-*p;
+  v1338=v3427*v4516-*p;
+  v16523=v11397*v19624-*p;
+  v13248=v6120*v17031-*p;
+  v8638=v10061*v16715-*p;
+  v18288=v9969*v1217-*p;
+  v12767=v11217*v17818-*p;
+  v14684=v14892*v14594-*p;
+  v15129=v16222*v19265-*p;
+  v6928=v15240*v16711-*p;
+  v8863=v16085*v19357-*p;
+  v15101=v368*v13368-*p;
+  v12419=v19193*v2889-*p;
+  v7032=v4468*v6937-*p;
+  v4672=v2659*v15655-*p;
+  v574=v8528*v17486-*p;
+  v4538=v8605*v9117-*p;
+  v17755=v3960*v4902-*p;
+  v18388=v15320*v3119-*p;
+  v8815=v10236*v19427-*p;
+  v13467=v9257*v18870-*p;
+  v3489=v925*v4233-*p;
+  v19656=v7155*v2438-*p;
+  v5151=v16524*v18493-*p;
+  v4965=v13808*v2040-*p;
+  v17947=v3094*v685-*p;
+  v17692=v15264*v8835-*p;
+  v8665=v17353*v18366-*p;
+  v18626=v8941*v3973-*p;
+  v9608=v18727*v15955-*p;
+  v17915=v11694*v10811-*p;
+  v19886=v16890*v16829-*p;
+  v13988=v15299*v16769-*p;
+  v225=v1157*v8710-*p;
+  v6106=v15630*v4516-*p;
+  v796=v17014*v16871-*p;
+  v14156=v14597*v4588-*p;
+  v10650=v15299*v6953-*p;
+  v11565=v13962*v16004-*p;
+  v6201=v12342*v16147-*p;
+  v653=v7700*v6039-*p;
+  v16169=v18771*v10538-*p;
+  v15581=v16823*v17884-*p;
+  v12299=v15390*v14084-*p;
+  v6011=v14842*v759-*p;
+  v10393=v5995*v10817-*p;
+  v14574=v1918*v17911-*p;
+  v15740=v10315*v8607-*p;
+  v13535=v3877*v5704-*p;
+  v2509=v7373*v12395-*p;
+  v13018=v6106*v2352-*p;
+  v4358=v9408*v5736-*p;
+  v18212=v6536*v1627-*p;
+  v15456=v15746*v9736-*p;
+  v17575=v3621*v8704-*p;
+  v11129=v4661*v8695-*p;
+  v14915=v10771*v12454-*p;
+  v14293=v7323*v7336-*p;
+  v7225=v6405*v17625-*p;
+  v16055=v6757*v235-*p;
+  v15282=v4839*v5814-*p;
+  v4882=v14168*v19991-*p;
+  v371=v18329*v9936-*p;
+  v11047=v7618*v2964-*p;
+  v3082=v11954*v13103-*p;
+  v7682=v9560*v8062-*p;
+  v637=v8431*v3740-*p;
+  v370=v13305*v421-*p;
+  v19056=v3062*v8101-*p;
+  v15047=v3920*v13761-*p;
+  v15638=v13804*v19796-*p;
+  v13927=v15882*v7608-*p;
+  v5418=v7387*v12799-*p;
+  v10725=v13252*v12456-*p;
+  v10445=v8059*v1535-*p;
+  v15809=v11023*v13742-*p;
+  v12461=v3583*v14252-*p;
+  v10294=v17846*v9493-*p;
+  v3198=v9644*v1393-*p;
+  v9415=v17693*v1134-*p;
+  v7512=v3281*v11784-*p;
+  v10533=v604*v17319-*p;
+  v4790=v6787*v3197-*p;
+  v14751=v12324*v8666-*p;
+  v15823=v3158*v11847-*p;
+  v14284=v15039*v15420-*p;
+  v6440=v6257*v3438-*p;
+  v12002=v5730*v15601-*p;
+  v16191=v4114*v2616-*p;
+  v9068=v886*v18042-*p;
+  v3602=v13393*v2860-*p;
+  v17017=v17580*v10828-*p;
+  v8408=v1469*v19868-*p;
+  v17733=v8725*v13837-*p;
+  v2821=v2888*v13886-*p;
+  v17018=v5912*v1058-*p;
+  v9810=v19163*v6362-*p;
+  v8632=v1305*v16771-*p;
+  v6470=v10749*v2724-*p;
+  v1869=v9068*v9853-*p;
+  v817=v16577*v4259-*p;
+  v16574=v12266*v2407-*p;
+  v10901=v3488*v9587-*p;
+  v14521=v5111*v4161-*p;
+  v15642=v18209*v1014-*p;
+  v11175=v4482*v2248-*p;
+  v13464=v18822*v12162-*p;
+  v6967=v18640*v4880-*p;
+  v17458=v3858*v1049-*p;
+  v10080=v5138*v8996-*p;
+  v37=v18524*v8886-*p;
+  v17094=v509*v17664-*p;
+  v17849=v9916*v6670-*p;
+  v4158=v18519*v357-*p;
+  v6608=v14167*v2874-*p;
+  v11541=v9022*v1842-*p;
+  v3398=v12871*v12670-*p;
+  v18555=v17678*v17498-*p;
+  v3895=v19281*v11135-*p;
+  v4275=v10578*v19454-*p;
+  v18987=v14241*v8946-*p;
+  v15329=v1486*v18809-*p;
+  v16208=v12935*v898-*p;
+  v2511=v4170*v10555-*p;
+  v16200=v19188*v837-*p;
+  v12849=v12677*v9788-*p;
+  v10970=v16271*v19920-*p;
+  v12932=v6581*v8967-*p;
+  v15931=v8918*v4287-*p;
+  v12827=v11445*v9714-*p;
+  v3093=v10449*v17981-*p;
+  v17681=v12324*v12941-*p;
+  v6661=v1985*v10625-*p;
+  v14371=v14315*v5069-*p;
+  v5214=v4062*v4151-*p;
+  v2027=v15429*v12498-*p;
+  v2992=v533*v5853-*p;
+  v4403=v17664*v15579-*p;
+  v3286=v1868*v4651-*p;
+  v19891=v15743*v1011-*p;
+  v11019=v3787*v1813-*p;
+  v18669=v15031*v11287-*p;
+  v18686=v10848*v5769-*p;
+  v15627=v716*v130-*p;
+  v4845=v7264*v18524-*p;
+  v1435=v7262*v2983-*p;
+  v18040=v7292*v2204-*p;
+  v18778=v15289*v4268-*p;
+  v13082=v17854*v13797-*p;
+  v1458=v9109*v7489-*p;
+  v15000=v19929*v449-*p;
+  v4568=v19106*v7730-*p;
+  v2471=v3190*v14711-*p;
+  v14254=v11009*v1033-*p;
+  v15601=v14316*v1831-*p;
+  v17704=v12563*v8081-*p;
+  v2824=v11270*v2949-*p;
+  v7112=v8162*v6536-*p;
+  v2959=v6115*v13465-*p;
+  v16351=v10678*v2785-*p;
+  v4849=v10030*v7342-*p;
+  v12471=v17703*v14514-*p;
+  v19407=v13164*v2499-*p;
+  v16341=v4495*v17465-*p;
+  v19680=v12247*v19980-*p;
+  v16027=v1701*v8671-*p;
+  v3678=v17574*v1928-*p;
+  v2993=v3272*v10683-*p;
+  v1364=v3918*v3947-*p;
+  v1470=v10715*v13371-*p;
+  v8278=v13305*v5249-*p;
+  v9805=v1301*v17106-*p;
+  v15410=v11335*v13399-*p;
+  v16311=v1953*v13817-*p;
+  v5736=v1637*v14709-*p;
+  v5950=v15145*v857-*p;
+  v9153=v664*v5933-*p;
+  v1307=v10303*v8065-*p;
+  v5242=v10729*v18790-*p;
+  v9040=v3102*v4396-*p;
+  v3133=v3010*v1824-*p;
+  v17093=v1244*v12545-*p;
+  v13642=v16756*v14504-*p;
+  v2553=v7883*v12628-*p;
+  v3946=v11374*v18261-*p;
+  v9272=v18475*v2480-*p;
+  v10869=v18102*v7555-*p;
+  v16433=v10469*v5483-*p;
+  v15815=v14652*v16499-*p;
+  v19078=v3170*v17119-*p;
+  v10198=v14608*v8598-*p;
+  v4371=v4146*v8931-*p;
+  v11954=v11840*v5019-*p;
+  v18040=v7066*v5860-*p;
+  v18409=v8678*v10313-*p;
+  v13915=v12573*v10316-*p;
+  v5619=v15237*v11935-*p;
+  v12781=v1551*v17587-*p;
+  v7099=v4510*v18343-*p;
+  v10339=v9497*v7593-*p;
+  v1542=v7081*v1400-*p;
+  v15811=v16409*v19875-*p;
+  v10866=v9373*v6082-*p;
+  v19075=v523*v10396-*p;
+  v7861=v18805*v12219-*p;
+  v5217=v1093*v2372-*p;
+  v15686=v14575*v10835-*p;
+  v16199=v14377*v12572-*p;
+  v6058=v10819*v2058-*p;
+  v15690=v3894*v17942-*p;
+  v4104=v3954*v12315-*p;
+  v10916=v9408*v8635-*p;
+  v12433=v9457*v18545-*p;
+  v2562=v4983*v8647-*p;
+  v6944=v11520*v9845-*p;
+  v3429=v19764*v3539-*p;
+  v17192=v13135*v12501-*p;
+  v13733=v11357*v694-*p;
+  v3625=v16628*v9712-*p;
+  v13611=v10293*v8106-*p;
+  v5553=v5148*v14374-*p;
+  v15982=v12649*v11586-*p;
+  v7571=v16953*v2168-*p;
+  v19421=v17108*v10985-*p;
+  v12536=v3424*v13069-*p;
+  v13607=v10849*v4327-*p;
+  v13240=v15288*v18449-*p;
+  v13906=v14858*v9178-*p;
+  v3355=v10649*v19363-*p;
+  v13003=v1397*v14866-*p;
+  v7217=v10920*v13880-*p;
+  v18147=v17612*v19768-*p;
+  v15846=v13390*v4049-*p;
+  v2357=v18633*v4397-*p;
+  v1978=v18553*v11613-*p;
+  v16856=v3521*v9911-*p;
+  v13133=v19471*v16767-*p;
+  v12730=v3771*v16109-*p;
+  v4159=v16373*v17398-*p;
+  v16541=v848*v1598-*p;
+  v4262=v18667*v12660-*p;
+  v7635=v4971*v7182-*p;
+  v8943=v720*v9751-*p;
+  v16841=v16732*v9139-*p;
+  v16809=v13521*v18454-*p;
+  v716=v18071*v8425-*p;
+  v16456=v11751*v6367-*p;
+  v12352=v11116*v4470-*p;
+  v13975=v15789*v1193-*p;
+  v13547=v16514*v18620-*p;
+  v13501=v14682*v17141-*p;
+  v10182=v10641*v7035-*p;
+  v17896=v4638*v7352-*p;
+  v5107=v3192*v12754-*p;
+  v18524=v19853*v9803-*p;
+  v10940=v6989*v4230-*p;
+  v3102=v2683*v14414-*p;
+  v9234=v6879*v11279-*p;
+  v98=v16325*v18334-*p;
+  v12489=v13408*v2374-*p;
+  v12226=v6950*v16269-*p;
+  v1581=v8459*v5026-*p;
+  v19794=v19300*v4966-*p;
+  v10191=v14312*v3719-*p;
+  v2074=v1908*v3140-*p;
+  v19282=v5312*v7337-*p;
+  v16229=v18023*v2211-*p;
+  v3021=v11494*v7300-*p;
+  v5491=v18986*v5663-*p;
+  v11231=v10577*v8715-*p;
+  v282=v18840*v13228-*p;
+  v8939=v18661*v19050-*p;
+  v8366=v7040*v6040-*p;
+  v9273=v8495*v15958-*p;
+  v14239=v7628*v996-*p;
+  v9909=v11621*v10713-*p;
+  v8406=v10180*v17036-*p;
+  v18499=v6555*v14930-*p;
+  v10689=v18425*v9719-*p;
+  v12074=v12608*v1328-*p;
+  v15736=v11883*v8158-*p;
+  v18884=v14873*v14075-*p;
+  v7500=v301*v10584-*p;
+  v1828=v12809*v13972-*p;
+  v6905=v9794*v9634-*p;
+  v4631=v15132*v8604-*p;
+  v16539=v14570*v9499-*p;
+  v604=v1871*v14942-*p;
+  v4615=v4632*v9527-*p;
+  v12649=v11934*v12192-*p;
+  v1640=v13417*v9586-*p;
+  v18482=v12899*v14724-*p;
+  v9674=v371*v10942-*p;
+  v10554=v6804*v1396-*p;
+  v7303=v8068*v19785-*p;
+  v14501=v15198*v12459-*p;
+  v3993=v1315*v13680-*p;
+  v12727=v17241*v15774-*p;
+  v8482=v8137*v11269-*p;
+  v1820=v3325*v9825-*p;
+  v11448=v361*v6617-*p;
+  v6624=v15861*v15753-*p;
+  v5663=v2052*v17704-*p;
+  v1054=v1226*v9455-*p;
+  v19443=v2244*v9145-*p;
+  v7716=v17535*v3002-*p;
+  v12640=v16013*v15478-*p;
+  v10552=v19657*v2503-*p;
+  v11077=v5085*v13353-*p;
+  v8644=v8025*v14665-*p;
+  v3329=v9163*v9649-*p;
+  v8396=v10002*v18934-*p;
+  v10334=v10206*v8425-*p;
+  v5186=v796*v442-*p;
+  v14769=v7820*v15608-*p;
+  v16392=v1527*v7995-*p;
+  v1336=v13659*v7966-*p;
+  v13453=v11708*v958-*p;
+  v9672=v12367*v11676-*p;
+  v3264=v324*v15154-*p;
+  v15398=v994*v19618-*p;
+  v6378=v2356*v2476-*p;
+  v13723=v5760*v11644-*p;
+  v6613=v12340*v3131-*p;
+  v12016=v4881*v15267-*p;
+  v14215=v7992*v2601-*p;
+  v16265=v685*v2163-*p;
+  v9492=v9472*v3395-*p;
+  v2989=v19255*v8529-*p;
+  v9489=v4088*v6717-*p;
+  v9858=v14735*v12295-*p;
+  v11221=v15272*v5356-*p;
+  v18204=v2545*v8361-*p;
+  v2271=v8395*v1896-*p;
+  v15735=v16903*v3754-*p;
+  v2257=v19637*v2934-*p;
+  v18537=v7049*v18018-*p;
+  v180=v8512*v7485-*p;
+  v13886=v1345*v18298-*p;
+  v2940=v19126*v4906-*p;
+  v13589=v12078*v8829-*p;
+  v1870=v2483*v18593-*p;
+  v16561=v4014*v7754-*p;
+  v13122=v4496*v13645-*p;
+  v8310=v10385*v4532-*p;
+  v7364=v3635*v6767-*p;
+  v7634=v6492*v9316-*p;
+  v16410=v6884*v17638-*p;
+  v9167=v458*v2976-*p;
+  v12866=v8393*v17211-*p;
+  v202=v16190*v10290-*p;
+  v6349=v8129*v8023-*p;
+  v6723=v8803*v1335-*p;
+  v2294=v13821*v6695-*p;
+  v6758=v11476*v664-*p;
+  v6609=v4442*v13191-*p;
+  v16505=v13836*v5232-*p;
+  v19773=v19854*v14118-*p;
+  v2600=v7212*v13070-*p;
+  v18754=v7445*v3017-*p;
+  v6748=v16162*v13398-*p;
+  v13938=v4703*v13476-*p;
+  v2412=v6758*v10743-*p;
+  v15831=v9609*v19847-*p;
+  v11718=v1498*v6182-*p;
+  v9303=v16021*v9459-*p;
+  v2440=v17163*v4932-*p;
+  v10873=v13635*v11061-*p;
+  v7761=v15570*v7413-*p;
+  v2906=v14976*v7416-*p;
+  v4793=v4008*v18901-*p;
+  v6748=v6085*v8360-*p;
+  v14027=v3395*v5651-*p;
+  v15013=v2950*v7231-*p;
+  v8460=v14668*v1039-*p;
+  v14314=v4427*v6272-*p;
+  v5451=v16711*v18674-*p;
+  v11333=v18975*v2838-*p;
+  v18705=v6164*v11022-*p;
+  v929=v12785*v12900-*p;
+  v12607=v16271*v28-*p;
+  v17944=v10700*v2430-*p;
+  v14871=v13971*v11607-*p;
+  v8215=v3170*v1065-*p;
+  v19301=v1419*v10909-*p;
+  v6310=v14240*v780-*p;
+  v1792=v2151*v12609-*p;
+  v4981=v8010*v8608-*p;
+  v17072=v19198*v13380-*p;
+  v16379=v10321*v15831-*p;
+  v6499=v10037*v2157-*p;
+  v13914=v10677*v901-*p;
+  v369=v10578*v12103-*p;
+  v13858=v9785*v5268-*p;
+  v5353=v5120*v12262-*p;
+  v907=v7919*v16601-*p;
+  v442=v5702*v8774-*p;
+  v16318=v4583*v11266-*p;
+  v18071=v12214*v11393-*p;
+  v3306=v13172*v2018-*p;
+  v1112=v18396*v10521-*p;
+  v2466=v3250*v18451-*p;
+  v17585=v12095*v4758-*p;
+  v15167=v3904*v8770-*p;
+  v8394=v7498*v2446-*p;
+  v19667=v1010*v14794-*p;
+  v6303=v10403*v8422-*p;
+  v3911=v5998*v5619-*p;
+  v2958=v7680*v1769-*p;
+  v16623=v4145*v16042-*p;
+  v14523=v2181*v2955-*p;
+  v4280=v9242*v18103-*p;
+  v11724=v10296*v1665-*p;
+  v9328=v19798*v5514-*p;
+  v19026=v2977*v7714-*p;
+  v6409=v18271*v16861-*p;
+  v3671=v19090*v8071-*p;
+  v4668=v1254*v1358-*p;
+  v7066=v13020*v18024-*p;
+  v4121=v4940*v14555-*p;
+  v18712=v2117*v15717-*p;
+  v15641=v6504*v2109-*p;
+  v10220=v16224*v17193-*p;
+  v4279=v18781*v484-*p;
+  v19839=v15600*v11453-*p;
+  v11222=v1744*v9421-*p;
+  v12275=v16738*v9564-*p;
+  v10721=v9306*v13300-*p;
+  v13742=v14223*v14331-*p;
+  v8264=v16659*v18893-*p;
+  v10726=v10880*v17966-*p;
+  v1480=v13499*v17669-*p;
+  v10728=v10430*v7530-*p;
+  v1457=v5201*v5853-*p;
+  v2076=v9068*v11887-*p;
+  v472=v18535*v12439-*p;
+  v6350=v6739*v13766-*p;
+  v14510=v10610*v2065-*p;
+  v2535=v11520*v4051-*p;
+  v12948=v7446*v19477-*p;
+  v5217=v19385*v19268-*p;
+  v3858=v4110*v7527-*p;
+  v7508=v14634*v14464-*p;
+  v7504=v17796*v13151-*p;
+  v7966=v7672*v4570-*p;
+  v14184=v527*v3298-*p;
+  v15242=v9869*v2127-*p;
+  v11634=v4546*v3604-*p;
+  v15=v10013*v3013-*p;
+  v17815=v17569*v18043-*p;
+  v18319=v16388*v3789-*p;
+  v19389=v17121*v14888-*p;
+  v13096=v7090*v16320-*p;
+  v15817=v9210*v2971-*p;
+  v9572=v830*v2065-*p;
+  v1326=v2565*v15492-*p;
+  v16717=v4487*v14185-*p;
+  v3869=v16751*v1899-*p;
+  v19751=v8845*v16404-*p;
+  v7432=v8769*v2262-*p;
+  v1957=v13821*v11759-*p;
+  v19399=v5913*v4398-*p;
+  v15281=v3983*v17567-*p;
+  v14674=v13311*v3278-*p;
+  v1031=v12104*v18949-*p;
+  v16332=v17852*v11279-*p;
+  v9518=v840*v1835-*p;
+  v9338=v8696*v11528-*p;
+  v9117=v342*v3627-*p;
+  v10680=v14597*v10330-*p;
+  v1362=v13016*v18557-*p;
+  v12172=v17894*v499-*p;
+  v18198=v18258*v7072-*p;
+  v3061=v17352*v16511-*p;
+  v11530=v8013*v14877-*p;
+  v18311=v3646*v14745-*p;
+  v19280=v7163*v427-*p;
+  v5123=v17059*v5143-*p;
+  v19322=v13415*v8610-*p;
+  v1264=v1917*v7245-*p;
+  v1783=v7581*v13424-*p;
+  v1827=v5830*v6002-*p;
+  v10544=v3051*v16533-*p;
+  v2594=v17102*v3232-*p;
+  v12894=v17469*v12679-*p;
+  v12351=v9402*v10908-*p;
+  v3259=v5143*v11627-*p;
+  v17784=v28*v3341-*p;
+  v15510=v4899*v17224-*p;
+  v8375=v16100*v11228-*p;
+  v3536=v16425*v16747-*p;
+  v14445=v18750*v7210-*p;
+  v19940=v2523*v1511-*p;
+  v19892=v1431*v19668-*p;
+  v18000=v3605*v11445-*p;
+  v19398=v7303*v3842-*p;
+  v5537=v13006*v12477-*p;
+  v8596=v15158*v3519-*p;
+  v6217=v15433*v10695-*p;
+  v6455=v6582*v951-*p;
+  v14977=v11856*v9956-*p;
+  v9283=v10432*v8749-*p;
+  v4507=v10183*v1979-*p;
+  v17682=v3522*v6829-*p;
+  v8958=v2094*v10078-*p;
+  v10055=v15716*v5910-*p;
+  v290=v2391*v13784-*p;
+  v2084=v9416*v10530-*p;
+  v18990=v18867*v14449-*p;
+  v9157=v8341*v12302-*p;
+  v6567=v4807*v17621-*p;
+  v14362=v10470*v5596-*p;
+  v1295=v6869*v8092-*p;
+  v6385=v11438*v15519-*p;
+  v4054=v5407*v12001-*p;
+  v12994=v2943*v5052-*p;
+  v8342=v8667*v8946-*p;
+  v12589=v13625*v10883-*p;
+  v3695=v3111*v2909-*p;
+  v5536=v567*v11652-*p;
+  v19481=v4952*v13522-*p;
+  v9801=v4250*v13570-*p;
+  v10136=v2545*v17889-*p;
+  v17617=v10060*v19761-*p;
+  v11625=v6147*v14337-*p;
+  v14380=v12120*v971-*p;
+  v19444=v1415*v6249-*p;
+  v7990=v14810*v5652-*p;
+  v4496=v7141*v8034-*p;
+  v10839=v3525*v3519-*p;
+  v1970=v5903*v11302-*p;
+  v6269=v3377*v17714-*p;
+  v9376=v721*v2567-*p;
+  v12309=v10586*v15609-*p;
+  v5385=v11206*v16085-*p;
+  v3714=v8515*v11366-*p;
+  v8109=v18393*v9326-*p;
+  v14517=v886*v9217-*p;
+  v16969=v11448*v7709-*p;
+  v14228=v11711*v11036-*p;
+  v5541=v6515*v2913-*p;
+  v10142=v14282*v10322-*p;
+  v11679=v13641*v11258-*p;
+  v10284=v9866*v9431-*p;
+  v6427=v14654*v2245-*p;
+  v839=v19924*v18329-*p;
+  v1490=v16189*v6661-*p;
+  v2322=v10064*v15073-*p;
+  v19524=v4876*v8124-*p;
+  v17772=v11538*v18101-*p;
+  v6316=v3190*v18772-*p;
+  v715=v10801*v7543-*p;
+  v18807=v8706*v2692-*p;
+  v2669=v1946*v5097-*p;
+  v11192=v3294*v3431-*p;
+  v10567=v14744*v15583-*p;
+  v10240=v3640*v14737-*p;
+  v7670=v5503*v8804-*p;
+  v10440=v15196*v9937-*p;
+  v492=v2896*v1302-*p;
+  v18306=v11016*v3385-*p;
+  v10654=v17330*v7158-*p;
+  v15671=v7344*v17067-*p;
+  v16203=v18412*v2380-*p;
+  v1778=v15025*v7363-*p;
+  v7530=v8990*v14024-*p;
+  v11731=v9196*v7438-*p;
+  v4343=v9551*v9433-*p;
+  v9053=v16040*v15234-*p;
+  v16826=v17500*v4889-*p;
+  v4670=v14771*v18696-*p;
+  v16065=v8224*v19887-*p;
+  v7040=v13338*v3558-*p;
+  v135=v9337*v15834-*p;
+  v5815=v6339*v4323-*p;
+  v6608=v2594*v14159-*p;
+  v11268=v743*v14401-*p;
+  v7602=v3445*v15161-*p;
+  v18648=v13628*v12190-*p;
+  v15317=v14645*v8127-*p;
+  v3881=v8787*v1666-*p;
+  v6813=v8156*v8544-*p;
+  v6344=v2357*v14443-*p;
+  v14053=v13946*v13210-*p;
+  v9312=v4330*v7799-*p;
+  v4870=v9676*v19714-*p;
+  v7077=v12881*v2363-*p;
+  v10833=v13281*v16385-*p;
+  v863=v6712*v17219-*p;
+  v14438=v14267*v3845-*p;
+  v814=v11556*v17476-*p;
+  v19318=v11949*v19017-*p;
+  v7677=v19483*v13603-*p;
+  v1513=v4293*v6815-*p;
+  v1958=v19872*v14764-*p;
+  v17457=v6116*v7241-*p;
+  v5077=v11777*v13686-*p;
+  v15225=v12953*v12580-*p;
+  v5241=v8545*v11596-*p;
+  v15607=v12432*v7275-*p;
+  v19262=v11071*v16762-*p;
+  v14102=v8037*v14496-*p;
+  v3399=v7050*v14304-*p;
+  v17040=v2031*v16590-*p;
+  v2907=v14159*v14660-*p;
+  v6631=v11709*v15283-*p;
+  v19021=v19110*v10472-*p;
+  v19085=v8561*v14111-*p;
+  v7460=v19000*v4459-*p;
+  v6461=v7726*v8918-*p;
+  v1680=v16439*v18349-*p;
+  v1629=v11071*v11891-*p;
+  v9833=v7046*v4388-*p;
+  v16108=v15350*v4716-*p;
+  v7429=v8407*v3057-*p;
+  v170=v5908*v13842-*p;
+  v2681=v5798*v7623-*p;
+  v15954=v14930*v1091-*p;
+  v5216=v1182*v17950-*p;
+  v12311=v9891*v926-*p;
+  v5080=v17961*v6678-*p;
+  v7425=v1269*v2161-*p;
+  v1790=v19622*v11302-*p;
+  v3508=v9237*v16983-*p;
+  v17517=v14605*v17105-*p;
+  v7161=v13256*v5821-*p;
+  v311=v11675*v15533-*p;
+  v10121=v8439*v9050-*p;
+  v18027=v19903*v687-*p;
+  v14835=v3016*v17699-*p;
+  v19271=v16706*v17305-*p;
+  v15040=v13101*v16512-*p;
+  v14162=v16051*v16181-*p;
+  v7550=v4234*v4179-*p;
+  v8092=v7975*v10215-*p;
+  v8986=v16607*v9014-*p;
+  v5822=v16457*v18545-*p;
+  v1974=v16288*v18450-*p;
+  v2118=v17078*v14192-*p;
+  v9549=v11091*v2495-*p;
+  v12583=v7002*v12371-*p;
+  v11646=v11324*v17377-*p;
+  v18918=v19770*v6311-*p;
+  v6180=v2305*v11596-*p;
+  v8325=v6945*v2753-*p;
+  v10290=v6135*v18177-*p;
+  v5712=v1486*v9203-*p;
+  v10453=v15365*v16203-*p;
+  v19584=v9473*v8072-*p;
+  v4609=v1514*v1978-*p;
+  v5669=v18520*v202-*p;
+  v8131=v10427*v19614-*p;
+  v1651=v15990*v8545-*p;
+  v7131=v1436*v9140-*p;
+  v12967=v5880*v939-*p;
+  v10816=v15876*v7743-*p;
+  v12005=v6364*v2416-*p;
+  v19624=v12546*v17631-*p;
+  v5661=v9911*v14136-*p;
+  v2291=v4426*v12485-*p;
+  v14377=v4555*v2736-*p;
+  v18986=v13194*v3795-*p;
+  v11216=v13462*v7604-*p;
+  v15890=v11260*v3561-*p;
+  v13438=v42*v15678-*p;
+  v3117=v13613*v1899-*p;
+  v14681=v4329*v17204-*p;
+  v2058=v4666*v17495-*p;
+  v1551=v13229*v16377-*p;
+  v16289=v5675*v3892-*p;
+  v19561=v6180*v7352-*p;
+  v8941=v11099*v14394-*p;
+  v12663=v15761*v13649-*p;
+  v4656=v7642*v8866-*p;
+  v8792=v6922*v18067-*p;
+  v17573=v9919*v19472-*p;
+  v16304=v11385*v3130-*p;
+  v9400=v3999*v12981-*p;
+  v15646=v7109*v15616-*p;
+  v13606=v8372*v172-*p;
+  v4632=v19161*v17328-*p;
+  v9091=v8847*v17104-*p;
+  v19480=v9915*v9708-*p;
+  v6909=v3856*v17032-*p;
+  v5028=v16055*v716-*p;
+  v17218=v313*v4814-*p;
+  v4491=v3008*v4034-*p;
+  v4441=v15911*v11945-*p;
+  v5320=v9914*v6299-*p;
+  v14108=v2426*v19633-*p;
+  v10004=v14949*v17517-*p;
+  v10991=v8372*v1959-*p;
+  v4724=v18198*v7654-*p;
+  v19504=v7114*v12483-*p;
+  v13555=v11274*v4143-*p;
+  v4377=v8317*v5535-*p;
+  v1643=v2276*v7035-*p;
+  v1822=v16285*v19509-*p;
+  v15146=v6412*v11341-*p;
+  v7926=v13575*v851-*p;
+  v8780=v10585*v9816-*p;
+  v9132=v17334*v7510-*p;
+  v19619=v12525*v19929-*p;
+  v14914=v2565*v798-*p;
+  v7203=v3466*v397-*p;
+  v1825=v13408*v8205-*p;
+  v8357=v17556*v317-*p;
+  v285=v5002*v5113-*p;
+  v1701=v13427*v13965-*p;
+  v9596=v1090*v13429-*p;
+  v11883=v6011*v8751-*p;
+  v13679=v1913*v18185-*p;
+  v12458=v13508*v45-*p;
+  v13438=v11568*v221-*p;
+  v16410=v16281*v18935-*p;
+  v6119=v1114*v3816-*p;
+  v4258=v3213*v1330-*p;
+  v18712=v5655*v6046-*p;
+  v9314=v14406*v16919-*p;
+  v3760=v10672*v12703-*p;
+  v17359=v18476*v5670-*p;
+  v15191=v18898*v11712-*p;
+  v18257=v10630*v11617-*p;
+  v17688=v2305*v15378-*p;
+  v2741=v15450*v1904-*p;
+  v12383=v9939*v5938-*p;
+  v2771=v10253*v1722-*p;
+  v3258=v19442*v4494-*p;
+  v15342=v12535*v10337-*p;
+  v1144=v5711*v1486-*p;
+  v17147=v10425*v1433-*p;
+  v17816=v8751*v2720-*p;
+  v17538=v18139*v5824-*p;
+  v2965=v16569*v5747-*p;
+  v262=v9679*v10542-*p;
+  v15948=v1294*v1585-*p;
+  v1827=v12948*v2741-*p;
+  v9893=v11460*v9571-*p;
+  v8988=v16659*v4591-*p;
+  v4828=v1937*v16895-*p;
+  v1345=v18160*v9111-*p;
+  v4852=v18556*v11283-*p;
+  v12028=v12797*v4779-*p;
+  v7425=v16697*v8596-*p;
+  v8945=v5525*v1322-*p;
+  v1025=v8857*v19914-*p;
+  v18544=v7651*v11579-*p;
+  v5972=v9895*v10610-*p;
+  v18716=v9329*v18015-*p;
+  v9695=v17018*v4042-*p;
+  v9590=v7287*v1598-*p;
+  v17428=v10031*v12120-*p;
+  v915=v18797*v9523-*p;
+  v6959=v17834*v19984-*p;
+  v3281=v5517*v13807-*p;
+  v18143=v13880*v15289-*p;
+  v7506=v1799*v17913-*p;
+  v11160=v19291*v17527-*p;
+  v316=v18475*v4074-*p;
+  v8378=v3858*v3532-*p;
+  v14001=v2424*v2108-*p;
+  v11908=v3521*v287-*p;
+  v17576=v19531*v6426-*p;
+  v17005=v19912*v12592-*p;
+  v9092=v3779*v18225-*p;
+  v15317=v12020*v4091-*p;
+  v3876=v18858*v9788-*p;
+  v5721=v3790*v12483-*p;
+  v7551=v11882*v4743-*p;
+  v5932=v5078*v6346-*p;
+  v7243=v9090*v18437-*p;
+  v10891=v15041*v9493-*p;
+  v11896=v997*v8433-*p;
+  v16333=v5916*v11949-*p;
+  v1722=v10244*v16372-*p;
+  v6291=v16509*v1525-*p;
+  v7551=v6203*v73-*p;
+  v16788=v18891*v14982-*p;
+  v11352=v8402*v4962-*p;
+  v12329=v36*v15939-*p;
+  v9718=v19142*v2641-*p;
+  v4435=v6023*v10258-*p;
+  v19777=v8763*v5081-*p;
+  v12887=v14216*v9009-*p;
+  v2640=v3223*v217-*p;
+  v16122=v15036*v19159-*p;
+  v2280=v13939*v17204-*p;
+  v19721=v19719*v9067-*p;
+  v2881=v11100*v18968-*p;
+  v6055=v4310*v7530-*p;
+  v2207=v3655*v3678-*p;
+  v11438=v16258*v1037-*p;
+  v953=v1116*v7426-*p;
+  v8960=v9976*v7830-*p;
+  v6859=v9888*v7364-*p;
+  v10573=v13464*v7533-*p;
+  v18593=v6165*v16828-*p;
+  v10793=v17063*v14451-*p;
+  v4400=v10648*v1660-*p;
+  v9781=v1484*v8033-*p;
+  v5146=v9329*v12100-*p;
+  v14004=v18242*v11369-*p;
+  v15694=v798*v9255-*p;
+  v1632=v9680*v1135-*p;
+  v6602=v16174*v16207-*p;
+  v15316=v8563*v18586-*p;
+  v10549=v9230*v7596-*p;
+  v4881=v3398*v5336-*p;
+  v4485=v18279*v14376-*p;
+  v1455=v14621*v10629-*p;
+  v12725=v600*v1728-*p;
+  v14033=v10148*v5543-*p;
+  v18458=v10479*v5589-*p;
+  v15639=v6554*v9840-*p;
+  v12687=v3892*v12958-*p;
+  v4192=v15497*v7389-*p;
+  v11631=v19870*v475-*p;
+  v17225=v12955*v13851-*p;
+  v7183=v152*v13091-*p;
+  v19524=v14150*v9946-*p;
+  v900=v14516*v1998-*p;
+  v6632=v3457*v2549-*p;
+  v8432=v5624*v17386-*p;
+  v15812=v3117*v4147-*p;
+  v15945=v11416*v128-*p;
+  v18611=v11487*v15936-*p;
+  v5325=v7166*v7794-*p;
+  v12425=v15936*v16644-*p;
+  v13115=v1342*v3489-*p;
+  v15149=v5339*v13609-*p;
+  v1311=v18279*v1243-*p;
+  v12755=v13044*v11625-*p;
+  v7637=v19776*v7673-*p;
+  v5018=v5483*v14850-*p;
+  v6655=v11928*v6560-*p;
+  v16953=v10371*v18118-*p;
+  v8190=v19551*v6625-*p;
+  v3122=v8711*v17239-*p;
+  v4063=v13656*v1049-*p;
+  v5958=v9285*v19394-*p;
+  v12215=v19213*v7927-*p;
+  v15914=v17724*v15510-*p;
+  v9566=v15398*v19821-*p;
+  v7776=v11207*v16185-*p;
+  v15215=v9407*v16197-*p;
+  v1997=v9196*v10636-*p;
+  v4445=v19158*v19391-*p;
+  v5042=v5604*v4215-*p;
+  v8876=v1049*v5585-*p;
+  v14515=v660*v6506-*p;
+  v6866=v5080*v15066-*p;
+  v10535=v13951*v8573-*p;
+  v12158=v11520*v713-*p;
+  v17798=v1779*v8922-*p;
+  v13640=v14624*v1913-*p;
+  v13549=v8473*v4291-*p;
+  v15218=v18889*v16172-*p;
+  v1884=v18147*v15434-*p;
+  v7889=v16066*v10334-*p;
+  v17795=v12192*v8960-*p;
+  v3839=v5958*v12942-*p;
+  v10598=v13617*v13178-*p;
+  v12675=v1079*v19113-*p;
+  v14521=v12978*v10554-*p;
+  v5943=v351*v6837-*p;
+  v18671=v4623*v8558-*p;
+  v834=v8863*v4148-*p;
+  v2364=v1747*v7671-*p;
+  v1178=v3734*v19312-*p;
+  v19702=v7999*v5550-*p;
+  v2030=v1818*v19053-*p;
+  v16035=v3668*v19812-*p;
+  v13239=v11978*v1189-*p;
+  v9428=v15625*v11078-*p;
+  v5071=v17688*v14780-*p;
+  v1988=v16958*v8359-*p;
+  v9909=v4590*v6185-*p;
+  v7298=v9900*v17989-*p;
+  v12372=v1410*v17776-*p;
+  v19544=v10277*v17434-*p;
+  v4475=v9858*v16764-*p;
+  v9616=v10540*v13846-*p;
+  v10627=v9261*v4543-*p;
+  v1067=v5878*v6674-*p;
+  v8713=v14707*v1374-*p;
+  v4195=v9102*v8989-*p;
+  v322=v16494*v12983-*p;
+  v16681=v4129*v3768-*p;
+  v8721=v6900*v6033-*p;
+  v11529=v695*v6964-*p;
+  v14182=v17580*v13723-*p;
+  v11017=v17757*v3603-*p;
+  v3901=v6178*v19838-*p;
+  v7169=v2804*v8926-*p;
+  v6863=v7442*v10361-*p;
+  v9898=v12486*v17868-*p;
+  v2422=v1066*v1909-*p;
+  v7626=v17282*v18647-*p;
+  v10170=v11655*v9525-*p;
+  v10606=v12630*v9932-*p;
+  v17010=v8465*v16478-*p;
+  v17173=v11343*v13572-*p;
+  v13850=v3459*v5264-*p;
+  v6865=v13066*v16495-*p;
+  v9401=v6372*v7790-*p;
+  v2495=v1688*v7155-*p;
+  v824=v9410*v9107-*p;
+  v652=v8919*v12854-*p;
+  v16121=v845*v119-*p;
+  v15660=v16166*v2231-*p;
+  v7565=v5218*v13007-*p;
+  v19729=v5413*v5389-*p;
+  v3348=v16123*v19854-*p;
+  v18948=v18431*v13809-*p;
+  v6214=v18274*v9458-*p;
+  v1256=v205*v15205-*p;
+  v1101=v5626*v4299-*p;
+  v10613=v1929*v439-*p;
+  v13082=v19247*v14904-*p;
+  v14608=v6568*v4852-*p;
+  v7131=v3848*v16511-*p;
+  v2506=v14546*v8050-*p;
+  v6903=v8998*v17447-*p;
+  v15635=v5614*v12407-*p;
+  v507=v15210*v17047-*p;
+  v9207=v1800*v19667-*p;
+  v11952=v10026*v7374-*p;
+  v4849=v12860*v5758-*p;
+  v11451=v5784*v498-*p;
+  v5725=v4015*v11124-*p;
+  v2831=v4537*v9599-*p;
+  v12750=v16264*v12794-*p;
+  v9288=v4672*v8581-*p;
+  v12489=v8527*v13731-*p;
+  v19516=v12788*v15876-*p;
+  v10518=v14549*v11973-*p;
+  v15724=v16526*v16937-*p;
+  v17561=v8368*v10988-*p;
+  v15208=v17463*v13983-*p;
+  v4822=v3071*v11462-*p;
+  v4266=v4437*v1488-*p;
+  v15697=v2197*v9580-*p;
+  v11309=v4261*v5676-*p;
+  v3959=v3112*v2558-*p;
+  v18965=v16845*v17314-*p;
+  v8121=v3359*v8390-*p;
+  v17056=v9369*v7620-*p;
+  v15915=v433*v19244-*p;
+  v15354=v14989*v6869-*p;
+  v18255=v1955*v8406-*p;
+  v8974=v17588*v11006-*p;
+  v11362=v4754*v14997-*p;
+  v12707=v7012*v9275-*p;
+  v12576=v12010*v5861-*p;
+  v13014=v16113*v7012-*p;
+  v11290=v7068*v10383-*p;
+  v17456=v2790*v6636-*p;
+  v11696=v16949*v4841-*p;
+  v12914=v8817*v1405-*p;
+  v8239=v2467*v11949-*p;
+  v5356=v3064*v12783-*p;
+  v6726=v14455*v14661-*p;
+  v4967=v2555*v10536-*p;
+  v16336=v1069*v1219-*p;
+  v6590=v12153*v17205-*p;
+  v10108=v3266*v15940-*p;
+  v19725=v19895*v6796-*p;
+  v7011=v16398*v16844-*p;
+  v6655=v13484*v15932-*p;
+  v6144=v5895*v11753-*p;
+  v8226=v16345*v18541-*p;
+  v11543=v7342*v14448-*p;
+  v8467=v1022*v6750-*p;
+  v4260=v18101*v18022-*p;
+  v10373=v19928*v13484-*p;
+  v3409=v17774*v12460-*p;
+  v10762=v14129*v4547-*p;
+  v205=v13619*v12950-*p;
+  v1606=v3125*v10738-*p;
+  v18328=v17273*v10162-*p;
+  v13786=v6081*v14823-*p;
+  v3872=v8563*v529-*p;
+  v8985=v15907*v4641-*p;
+  v5900=v15645*v5897-*p;
+  v18110=v4889*v10123-*p;
+  v18614=v5240*v15124-*p;
+  v11886=v7217*v2640-*p;
+  v2328=v12396*v2766-*p;
+  v11993=v7081*v7064-*p;
+  v12518=v19354*v8525-*p;
+  v2363=v5014*v13399-*p;
+  v288=v6914*v10723-*p;
+  v526=v18811*v3853-*p;
+  v7263=v1999*v10890-*p;
+  v19820=v15258*v4480-*p;
+  v10940=v11036*v9183-*p;
+  v17678=v2566*v18772-*p;
+  v14694=v11306*v17340-*p;
+  v3589=v13665*v8150-*p;
+  v509=v18004*v14021-*p;
+  v1228=v2130*v8612-*p;
+  v7117=v15847*v106-*p;
+  v7109=v19585*v17859-*p;
+  v8523=v16042*v3471-*p;
+  v8338=v18192*v2229-*p;
+  v19631=v15276*v5989-*p;
+  v15279=v13826*v18806-*p;
+  v1751=v12653*v8803-*p;
+  v6680=v13487*v8576-*p;
+  v1480=v981*v17458-*p;
+  v11472=v7691*v18074-*p;
+  v5663=v16981*v18195-*p;
+  v2254=v8606*v1171-*p;
+  v1145=v14960*v2863-*p;
+  v4759=v8731*v12917-*p;
+  v5816=v18581*v17468-*p;
+  v13233=v4876*v3339-*p;
+  v2382=v1586*v16395-*p;
+  v17043=v12565*v11101-*p;
+  v11390=v9479*v4406-*p;
+  v15729=v14462*v19552-*p;
+  v4553=v15739*v721-*p;
+  v3883=v15423*v13583-*p;
+  v10508=v16691*v13423-*p;
+  v19540=v5489*v9749-*p;
+  v14618=v13695*v6724-*p;
+  v16738=v10138*v2847-*p;
+  v17155=v5380*v4700-*p;
+  v18083=v4542*v7390-*p;
+  v17806=v12821*v13607-*p;
+  v17560=v9159*v17951-*p;
+  v6252=v8318*v18008-*p;
+  v16889=v15823*v8362-*p;
+  v2705=v17158*v14861-*p;
+  v1155=v18121*v15121-*p;
+  v3222=v16879*v7455-*p;
+  v6477=v1526*v4562-*p;
+  v19311=v1950*v4922-*p;
+  v2642=v3072*v15732-*p;
+  v16962=v2247*v6023-*p;
+  v6494=v12320*v1401-*p;
+  v1773=v7828*v18870-*p;
+  v13471=v9606*v14702-*p;
+  v18906=v17357*v4-*p;
+  v18942=v14287*v4461-*p;
+  v5132=v10*v625-*p;
+  v17345=v18119*v16912-*p;
+  v7444=v106*v9235-*p;
+  v13936=v17945*v19475-*p;
+  v6391=v10735*v17650-*p;
+  v16718=v19239*v12419-*p;
+  v19090=v17055*v2462-*p;
+  v4232=v957*v10065-*p;
+  v7872=v4750*v8314-*p;
+  v14876=v2245*v17090-*p;
+  v12463=v5848*v2290-*p;
+  v4926=v15598*v3081-*p;
+  v7947=v12897*v4904-*p;
+  v10449=v605*v15906-*p;
+  v8799=v17012*v669-*p;
+  v6668=v19574*v17376-*p;
+  v15283=v16459*v5232-*p;
+  v6075=v1147*v4634-*p;
+  v3809=v6805*v6574-*p;
+  v10819=v1287*v11247-*p;
+  v735=v9898*v19371-*p;
+  v18793=v8026*v496-*p;
+  v19967=v14231*v17858-*p;
+  v8233=v15603*v18651-*p;
+  v13183=v12601*v18283-*p;
+  v16890=v3486*v13372-*p;
+  v14035=v19298*v16557-*p;
+  v544=v10677*v16271-*p;
+  v12944=v3726*v19043-*p;
+  v18487=v344*v5842-*p;
+  v7176=v15536*v16499-*p;
+  v11288=v19542*v17901-*p;
+  v13234=v16816*v18527-*p;
+  v6762=v16639*v9782-*p;
+  v191=v3693*v183-*p;
+  v2443=v855*v19824-*p;
+  v10401=v9348*v9420-*p;
+  v2924=v17618*v9276-*p;
+  v8296=v23*v1780-*p;
+  v7992=v17598*v15486-*p;
+  v18606=v15949*v18893-*p;
+  v9504=v1549*v14812-*p;
+  v3683=v19055*v9465-*p;
+  v16324=v8240*v14100-*p;
+  v5951=v15427*v15332-*p;
+  v3033=v7244*v3904-*p;
+  v17162=v13025*v2723-*p;
+  v2582=v11572*v4125-*p;
+  v16043=v10626*v16222-*p;
+  v5435=v615*v12440-*p;
+  v16547=v12556*v383-*p;
+  v14373=v7195*v6843-*p;
+  v7846=v14021*v694-*p;
+  v11954=v12054*v4369-*p;
+  v616=v19937*v10016-*p;
+  v869=v12336*v14681-*p;
+  v13266=v17797*v6017-*p;
+  v13181=v19793*v7452-*p;
+  v1058=v17501*v1804-*p;
+  v8557=v7191*v2193-*p;
+  v11940=v7093*v14462-*p;
+  v14118=v4736*v15949-*p;
+  v18887=v6165*v5964-*p;
+  v3807=v14848*v6350-*p;
+  v19247=v1061*v18643-*p;
+  v1219=v1600*v10904-*p;
+  v1364=v10560*v15019-*p;
+  v15729=v1019*v7627-*p;
+  v11789=v1472*v398-*p;
+  v17330=v14799*v5146-*p;
+  v19263=v5514*v11965-*p;
+  v17150=v17197*v15714-*p;
+  v7570=v19812*v9491-*p;
+  v13663=v14182*v4832-*p;
+  v8016=v17487*v8360-*p;
+  v18495=v12156*v726-*p;
+  v16015=v5024*v11152-*p;
+  v12411=v12167*v2976-*p;
+  v16444=v9839*v12941-*p;
+  v3460=v13663*v4486-*p;
+  v13703=v5893*v9664-*p;
+  v14371=v9962*v12081-*p;
+  v10684=v2549*v8137-*p;
+  v17629=v16140*v14829-*p;
+  v12706=v2421*v11727-*p;
+  v9877=v1889*v2426-*p;
+  v6763=v3414*v9297-*p;
+  v428=v6455*v6621-*p;
+  v16957=v19989*v2964-*p;
+  v13656=v17143*v15927-*p;
+  v6695=v18473*v3821-*p;
+  v15174=v5450*v4398-*p;
+  v12020=v3113*v9958-*p;
+  v2677=v3545*v4837-*p;
+  v11439=v10085*v5947-*p;
+  v4007=v599*v14890-*p;
+  v2417=v15052*v549-*p;
+  v18072=v774*v16226-*p;
+  v14389=v2385*v19203-*p;
+  v15738=v10778*v5372-*p;
+  v2500=v13490*v19934-*p;
+  v1060=v5810*v7516-*p;
+  v17436=v16308*v19232-*p;
+  v11954=v17275*v11354-*p;
+  v17455=v989*v10091-*p;
+  v15705=v17698*v8529-*p;
+  v9615=v13849*v10612-*p;
+  v9290=v11718*v15575-*p;
+  v2161=v8039*v11153-*p;
+  v15852=v4558*v12818-*p;
+  v19396=v17814*v10685-*p;
+  v14466=v15737*v3040-*p;
+  v9427=v5322*v10424-*p;
+  v3062=v623*v19782-*p;
+  v11201=v9238*v9119-*p;
+  v9270=v18558*v2026-*p;
+  v16202=v1574*v17764-*p;
+  v17075=v15501*v3323-*p;
+  v7030=v4563*v17271-*p;
+  v3341=v12639*v1724-*p;
+  v4345=v6737*v6836-*p;
+  v17325=v4270*v5655-*p;
+  v11362=v672*v3556-*p;
+  v7172=v8530*v19808-*p;
+  v3216=v13658*v6321-*p;
+  v9593=v1410*v12115-*p;
+  v1166=v13825*v1613-*p;
+  v12909=v15924*v12734-*p;
+  v16726=v12665*v16850-*p;
+  v17452=v12234*v19200-*p;
+  v9655=v10096*v6865-*p;
+  v18635=v18669*v13432-*p;
+  v17414=v4222*v11209-*p;
+  v1500=v8816*v16103-*p;
+  v227=v2323*v15039-*p;
+  v11996=v11762*v15978-*p;
+  v9963=v9525*v13554-*p;
+  v4611=v17009*v14837-*p;
+  v11390=v5684*v17234-*p;
+  v16237=v15026*v3633-*p;
+  v4622=v8592*v430-*p;
+  v14085=v15948*v11076-*p;
+  v9829=v17866*v2679-*p;
+  v3520=v11657*v11423-*p;
+  v19712=v6045*v10148-*p;
+  v16400=v1706*v333-*p;
+  v2559=v8551*v10815-*p;
+  v4747=v17526*v1452-*p;
+  v10956=v458*v17803-*p;
+  v10439=v8456*v4003-*p;
+  v6177=v18636*v17799-*p;
+  v18325=v6496*v6414-*p;
+  v17793=v1483*v12148-*p;
+  v12770=v6446*v15562-*p;
+  v973=v9083*v9469-*p;
+  v17986=v3541*v18303-*p;
+  v324=v4710*v4424-*p;
+  v2753=v1034*v12247-*p;
+  v17474=v4872*v2713-*p;
+  v11370=v14454*v16005-*p;
+  v6961=v3133*v906-*p;
+  v16187=v8318*v9923-*p;
+  v10600=v3079*v5082-*p;
+  v6497=v14611*v14976-*p;
+  v16351=v424*v12611-*p;
+  v8275=v11502*v6684-*p;
+  v7700=v5173*v6977-*p;
+  v6217=v13319*v4471-*p;
+  v2481=v17350*v12141-*p;
+  v13349=v13629*v19840-*p;
+  v13346=v13857*v13325-*p;
+  v4646=v11801*v6374-*p;
+  v1875=v17764*v14960-*p;
+  v7917=v3839*v12380-*p;
+  v13968=v19712*v13737-*p;
+  v18598=v15221*v16612-*p;
+  v1217=v15410*v12200-*p;
+  v4423=v6454*v11829-*p;
+  v16133=v3586*v963-*p;
+  v7858=v2694*v14062-*p;
+  v14168=v16928*v6940-*p;
+  v19541=v18019*v13051-*p;
+  v3922=v4761*v4971-*p;
+  v11908=v8971*v2605-*p;
+  v18043=v4970*v7832-*p;
+  v12642=v7849*v15121-*p;
+  v4864=v4873*v11924-*p;
+  v1344=v5276*v47-*p;
+  v15853=v9207*v13888-*p;
+  v2978=v1597*v1369-*p;
+  v14804=v17505*v7131-*p;
+  v5770=v399*v3448-*p;
+  v1829=v4536*v13339-*p;
+  v124=v7105*v13577-*p;
+  v8258=v17645*v8811-*p;
+  v15539=v11702*v14576-*p;
+  v13401=v15048*v9407-*p;
+  v17812=v9293*v13296-*p;
+  v5091=v7386*v7698-*p;
+  v12201=v2641*v12105-*p;
+  v19897=v15767*v10230-*p;
+  v7771=v17410*v10552-*p;
+  v6394=v6803*v9140-*p;
+  v8619=v19719*v7686-*p;
+  v12549=v13689*v6553-*p;
+  v14541=v15210*v7690-*p;
+  v11933=v3289*v19913-*p;
+  v16716=v15573*v18560-*p;
+  v4943=v6192*v15326-*p;
+  v3206=v17643*v13166-*p;
+  v11823=v12539*v823-*p;
+  v12703=v3977*v6689-*p;
+  v3000=v14734*v16620-*p;
+  v7323=v3390*v14648-*p;
+  v4525=v12151*v3043-*p;
+  v10180=v15383*v4247-*p;
+  v16791=v14490*v955-*p;
+  v6778=v7136*v7458-*p;
+  v13889=v14981*v2467-*p;
+  v6795=v10202*v2669-*p;
+  v16483=v16164*v10360-*p;
+  v7020=v7277*v17171-*p;
+  v9235=v15680*v7325-*p;
+  v6215=v349*v4621-*p;
+  v10131=v14406*v19644-*p;
+  v5335=v12929*v7527-*p;
+  v48=v709*v7177-*p;
+  v19582=v16809*v9904-*p;
+  v1842=v17328*v9804-*p;
+  v16361=v10033*v19040-*p;
+  v12951=v1630*v13161-*p;
+  v5469=v15764*v11048-*p;
+  v1287=v1676*v14599-*p;
+  v2036=v18608*v10620-*p;
+  v7141=v1508*v3539-*p;
+  v12691=v9795*v1703-*p;
+  v3762=v3278*v14464-*p;
+  v8093=v7319*v14662-*p;
+  v9899=v9988*v16381-*p;
+  v7252=v7135*v4559-*p;
+  v10510=v10085*v8124-*p;
+  v18894=v18618*v8657-*p;
+  v19216=v1371*v871-*p;
+  v14640=v8678*v54-*p;
+  v3263=v19679*v14858-*p;
+  v15321=v7317*v12152-*p;
+  v2009=v9393*v10762-*p;
+  v4734=v7766*v9447-*p;
+  v13303=v8346*v15518-*p;
+  v13561=v13314*v306-*p;
+  v5547=v5808*v15707-*p;
+  v19241=v1036*v16896-*p;
+  v5847=v2190*v11025-*p;
+  v9395=v1626*v1138-*p;
+  v16403=v1771*v13816-*p;
+  v6687=v18551*v17943-*p;
+  v7666=v1329*v19159-*p;
+  v5358=v6229*v3018-*p;
+  v18297=v7370*v14727-*p;
+  v5225=v19156*v5854-*p;
+  v3210=v12424*v9645-*p;
+  v16712=v11023*v16014-*p;
+  v19556=v8032*v6310-*p;
+  v4854=v11455*v6557-*p;
+  v3118=v16373*v9476-*p;
+  v18798=v15837*v7280-*p;
+  v9904=v7281*v5347-*p;
+  v5728=v16306*v7117-*p;
+  v7847=v18061*v9744-*p;
+  v3955=v4876*v3584-*p;
+  v12532=v14764*v13434-*p;
+  v314=v8706*v17530-*p;
+  v14863=v7761*v4099-*p;
+  v7383=v1675*v16581-*p;
+  v19554=v5205*v4216-*p;
+  v591=v12472*v10222-*p;
+  v481=v9640*v630-*p;
+  v202=v16136*v7924-*p;
+  v4597=v4712*v6904-*p;
+  v1813=v5674*v9626-*p;
+  v12393=v11726*v3795-*p;
+  v3118=v13319*v11161-*p;
+  v1694=v9606*v4209-*p;
+  v19063=v15420*v2087-*p;
+  v5087=v16385*v8649-*p;
+  v3329=v13125*v16267-*p;
+  v16831=v17638*v8504-*p;
+  v13382=v14054*v4772-*p;
+  v509=v1403*v5748-*p;
+  v12468=v5108*v13603-*p;
+  v19312=v19474*v9302-*p;
+  v18060=v2381*v18977-*p;
+  v2329=v14766*v14455-*p;
+  v8456=v5013*v14704-*p;
+  v2402=v7653*v16057-*p;
+  v774=v11507*v8591-*p;
+  v16790=v10941*v13861-*p;
+  v14585=v13510*v13564-*p;
+  v11740=v11435*v19003-*p;
+  v11970=v4822*v15421-*p;
+  v7776=v17516*v12124-*p;
+  v18706=v683*v13242-*p;
+  v3694=v15541*v17386-*p;
+  v13428=v405*v7987-*p;
+  v15537=v6645*v9319-*p;
+  v2506=v5686*v15781-*p;
+  v4425=v14363*v597-*p;
+  v15900=v11469*v16330-*p;
+  v9153=v15873*v6495-*p;
+  v14955=v5928*v9560-*p;
+  v11188=v16219*v5061-*p;
+  v14907=v14999*v10027-*p;
+  v6486=v2060*v8709-*p;
+  v10665=v232*v8668-*p;
+  v16036=v19798*v8533-*p;
+  v19416=v13703*v17832-*p;
+  v12363=v16401*v15194-*p;
+  v2407=v9106*v19340-*p;
+  v8220=v19126*v5277-*p;
+  v18533=v14644*v7708-*p;
+  v650=v16658*v4997-*p;
+  v7186=v10516*v10222-*p;
+  v15257=v17979*v18425-*p;
+  v4247=v11937*v5306-*p;
+  v15461=v9749*v5164-*p;
+  v9386=v9978*v12144-*p;
+  v14703=v18788*v7940-*p;
+  v15100=v12353*v11908-*p;
+  v3900=v18935*v11394-*p;
+  v8181=v11049*v15513-*p;
+  v5585=v11186*v16935-*p;
+  v11293=v10515*v18284-*p;
+  v16094=v9895*v9918-*p;
+  v6776=v13705*v8481-*p;
+  v9894=v15406*v14156-*p;
+  v17472=v13417*v12664-*p;
+  v15880=v13414*v7001-*p;
+  v14149=v7102*v1325-*p;
+  v6437=v694*v103-*p;
+  v18035=v14698*v16923-*p;
+  v1544=v16678*v17759-*p;
+  v3596=v13058*v17885-*p;
+  v18649=v3146*v8558-*p;
+  v9128=v18195*v4305-*p;
+  v3544=v11593*v15109-*p;
+  v17720=v1118*v6129-*p;
+  v19168=v5237*v547-*p;
+  v1433=v1530*v13249-*p;
+  v5400=v14268*v18863-*p;
+  v9414=v6396*v12668-*p;
+  v1092=v6472*v10621-*p;
+  v16937=v16417*v448-*p;
+  v19193=v12156*v2033-*p;
+  v19620=v17827*v11381-*p;
+  v12728=v16295*v11356-*p;
+  v11004=v14934*v9996-*p;
+  v12109=v12002*v16563-*p;
+  v18987=v17540*v11354-*p;
+  v16291=v11402*v9309-*p;
+  v16695=v2964*v2559-*p;
+  v1430=v5904*v6082-*p;
+  v8526=v2046*v12855-*p;
+  v12769=v14955*v8409-*p;
+  v19895=v7125*v12426-*p;
+  v14071=v4641*v15829-*p;
+  v14481=v10348*v17377-*p;
+  v1812=v10638*v13082-*p;
+  v1891=v7393*v19406-*p;
+  v3804=v2584*v12824-*p;
+  v2103=v8939*v1497-*p;
+  v3002=v19198*v6054-*p;
+  v8370=v7759*v6477-*p;
+  v2484=v6231*v1267-*p;
+  v6756=v6570*v10876-*p;
+  v13330=v7138*v5717-*p;
+  v4816=v1149*v14689-*p;
+  v2697=v14381*v14390-*p;
+  v10952=v19224*v6154-*p;
+  v18201=v15421*v15415-*p;
+  v5686=v4381*v11283-*p;
+  v12195=v4195*v10629-*p;
+  v18372=v13750*v11658-*p;
+  v2105=v6139*v10734-*p;
+  v19456=v7124*v18826-*p;
+  v17967=v5542*v7486-*p;
+  v17971=v5797*v5818-*p;
+  v9980=v18387*v16223-*p;
+  v11058=v6990*v2738-*p;
+  v100=v19023*v5654-*p;
+  v8146=v342*v17114-*p;
+  v19247=v4739*v2228-*p;
+  v2238=v2058*v12574-*p;
+  v16534=v13372*v17405-*p;
+  v6782=v1398*v9698-*p;
+  v14713=v5111*v1404-*p;
+  v19223=v12494*v3863-*p;
+  v15148=v1990*v19225-*p;
+  v8832=v17860*v5052-*p;
+  v15936=v15492*v11433-*p;
+  v8793=v18111*v3395-*p;
+  v560=v110*v19893-*p;
+  v16162=v7752*v3603-*p;
+  v13210=v8659*v3338-*p;
+  v12228=v5111*v11612-*p;
+  v3823=v3030*v6071-*p;
+  v19926=v1603*v17287-*p;
+  v19187=v10206*v13861-*p;
+  v2971=v2830*v15852-*p;
+  v5277=v5949*v4405-*p;
+  v16927=v2171*v9625-*p;
+  v14947=v17053*v3712-*p;
+  v8036=v8368*v9205-*p;
+  v3003=v18130*v7744-*p;
+  v9463=v1151*v12107-*p;
+  v9705=v9636*v15807-*p;
+  v6510=v14673*v3723-*p;
+  v9497=v13302*v19964-*p;
+  v8511=v9928*v4638-*p;
+  v15207=v10316*v240-*p;
+  v13246=v13129*v6216-*p;
+  v5855=v12552*v1242-*p;
+  v1889=v248*v16495-*p;
+  v9145=v9120*v3633-*p;
+  v5369=v13190*v8410-*p;
+  v15661=v263*v14961-*p;
+  v1197=v14192*v12459-*p;
+  v6599=v7464*v14248-*p;
+  v18033=v19836*v15725-*p;
+  v11256=v13094*v17435-*p;
+  v3346=v17896*v14884-*p;
+  v17395=v13751*v12334-*p;
+  v6290=v9178*v7626-*p;
+  v8033=v6507*v10626-*p;
+  v11861=v4890*v19349-*p;
+  v13970=v5454*v14658-*p;
+  v1699=v14270*v17628-*p;
+  v2912=v3431*v13955-*p;
+  v14764=v5071*v12833-*p;
+  v19984=v12180*v885-*p;
+  v62=v13038*v18748-*p;
+  v18732=v19052*v16774-*p;
+  v4611=v13116*v15477-*p;
+  v1899=v11696*v3218-*p;
+  v18424=v13646*v6274-*p;
+  v3447=v14262*v17101-*p;
+  v11193=v16039*v3402-*p;
+  v9508=v1207*v9668-*p;
+  v1506=v9351*v4970-*p;
+  v5750=v9622*v6418-*p;
+  v17873=v19177*v8360-*p;
+  v186=v3560*v17179-*p;
+  v1466=v6855*v19522-*p;
+  v9131=v6886*v6591-*p;
+  v1279=v10760*v17699-*p;
+  v4658=v4315*v4315-*p;
+  v837=v18110*v359-*p;
+  v2031=v7456*v164-*p;
+  v17483=v18393*v7884-*p;
+  v6634=v59*v14898-*p;
+  v18283=v1644*v7152-*p;
+  v17992=v7892*v17919-*p;
+  v9006=v13228*v6735-*p;
+  v13371=v1039*v15683-*p;
+  v933=v12595*v4157-*p;
+  v16683=v15900*v14715-*p;
+  v7057=v12703*v13651-*p;
+  v564=v7550*v15492-*p;
+  v1793=v10982*v14286-*p;
+  v11132=v13965*v2947-*p;
+  v7163=v9815*v13170-*p;
+  v14200=v11706*v3054-*p;
+  v7502=v3683*v2388-*p;
+  v9005=v16396*v17569-*p;
+  v14611=v13110*v16168-*p;
+  v4931=v5147*v16986-*p;
+  v10986=v16982*v10180-*p;
+  v2021=v674*v5749-*p;
+  v17230=v6431*v14341-*p;
+  v13307=v15820*v19026-*p;
+  v657=v9865*v11042-*p;
+  v8626=v13221*v17925-*p;
+  v3110=v5445*v10697-*p;
+  v10147=v18875*v6524-*p;
+  v2842=v10096*v17-*p;
+  v19262=v11702*v14006-*p;
+  v4398=v2589*v6213-*p;
+  v5399=v19269*v10330-*p;
+  v11375=v12791*v18384-*p;
+  v11764=v204*v12856-*p;
+  v12725=v3366*v17875-*p;
+  v10009=v10383*v17187-*p;
+  v11012=v18554*v2337-*p;
+  v18346=v1642*v5941-*p;
+  v16063=v19750*v15471-*p;
+  v7424=v5215*v4580-*p;
+  v10247=v1729*v18523-*p;
+  v8556=v2254*v6517-*p;
+  v3329=v12679*v17023-*p;
+  v9795=v11130*v14913-*p;
+  v3728=v8753*v19916-*p;
+  v14432=v1834*v3124-*p;
+  v6745=v16886*v14786-*p;
+  v13555=v16617*v5320-*p;
+  v1243=v17991*v14642-*p;
+  v16066=v1657*v10489-*p;
+  v5639=v8044*v5134-*p;
+  v5001=v10619*v19570-*p;
+  v16801=v15814*v5355-*p;
+  v15297=v19178*v14111-*p;
+  v18559=v16190*v13057-*p;
+  v13907=v4552*v4936-*p;
+  v11913=v1566*v16997-*p;
+  v1837=v9319*v4744-*p;
+  v15716=v3739*v3848-*p;
+  v15620=v14191*v3894-*p;
+  v18744=v15184*v5338-*p;
+  v5546=v19985*v6942-*p;
+  v18933=v10999*v10937-*p;
+  v17702=v14855*v9659-*p;
+  v2886=v2607*v10844-*p;
+  v2365=v14549*v15500-*p;
+  v1521=v4557*v5513-*p;
+  v11151=v17753*v4137-*p;
+  v17372=v1402*v13702-*p;
+  v7266=v8993*v8152-*p;
+  v7305=v17213*v1385-*p;
+  v10113=v201*v376-*p;
+  v7174=v16526*v16294-*p;
+  v10472=v19320*v17538-*p;
+  v6497=v12302*v5364-*p;
+  v19644=v10590*v6040-*p;
+  v12425=v8784*v13304-*p;
+  v1049=v14880*v10686-*p;
+  v15018=v11876*v11531-*p;
+  v2519=v19596*v18962-*p;
+  v4130=v2300*v12617-*p;
+  v5299=v11404*v16007-*p;
+  v3153=v19648*v3297-*p;
+  v7674=v13955*v7665-*p;
+  v18777=v14019*v4852-*p;
+  v6468=v9896*v15047-*p;
+  v6300=v11826*v19425-*p;
+  v13452=v6627*v5068-*p;
+  v14570=v51*v16663-*p;
+  v2429=v7730*v14564-*p;
+  v5985=v9413*v6213-*p;
+  v2274=v8988*v6722-*p;
+  v14868=v17728*v18978-*p;
+  v12786=v10655*v1502-*p;
+  v5934=v12460*v6423-*p;
+  v640=v11081*v9839-*p;
+  v14742=v19637*v4356-*p;
+  v10997=v3317*v19377-*p;
+  v1099=v5092*v14194-*p;
+  v7865=v8477*v18154-*p;
+  v2042=v12563*v640-*p;
+  v14172=v10262*v7269-*p;
+  v19314=v2062*v10124-*p;
+  v10606=v13892*v11439-*p;
+  v13404=v3266*v7235-*p;
+  v12009=v4906*v19202-*p;
+  v12055=v10008*v4027-*p;
+  v17699=v3004*v3977-*p;
+  v976=v11709*v2093-*p;
+  v19555=v15725*v11663-*p;
+  v12782=v16131*v16214-*p;
+  v17706=v4094*v10932-*p;
+  v17387=v18557*v10116-*p;
+  v1048=v8998*v12443-*p;
+  v8250=v12400*v12704-*p;
+  v9108=v18800*v6751-*p;
+  v7367=v252*v10235-*p;
+  v3929=v12593*v3259-*p;
+  v19352=v7302*v14366-*p;
+  v11343=v15888*v7412-*p;
+  v8927=v17328*v11404-*p;
+  v19635=v10046*v4354-*p;
+  v13116=v7345*v12930-*p;
+  v19146=v15870*v4452-*p;
+  v8225=v7845*v699-*p;
+  v15355=v17429*v17699-*p;
+  v4700=v10827*v17660-*p;
+  v7389=v18495*v2354-*p;
+  v2460=v13020*v19515-*p;
+  v14486=v8746*v3244-*p;
+  v19128=v7285*v4959-*p;
+  v8284=v19174*v4407-*p;
+  v11796=v5259*v7894-*p;
+  v3265=v17957*v17368-*p;
+  v6616=v12830*v19049-*p;
+  v12359=v4263*v16780-*p;
+  v5671=v16568*v6680-*p;
+  v18596=v11904*v13165-*p;
+  v2740=v11213*v3665-*p;
+  v4495=v6998*v18984-*p;
+  v18974=v19042*v9067-*p;
+  v9234=v19051*v16856-*p;
+  v11537=v12168*v876-*p;
+  v12504=v6840*v15759-*p;
+  v16312=v10543*v7523-*p;
+  v10581=v964*v11166-*p;
+  v1570=v19469*v1171-*p;
+  v7270=v4862*v6764-*p;
+  v15009=v5163*v18670-*p;
+  v4753=v7040*v7188-*p;
+  v3980=v18801*v15774-*p;
+  v1493=v11682*v420-*p;
+  v19055=v7146*v15340-*p;
+  v2650=v16243*v3129-*p;
+  v15712=v18527*v13225-*p;
+  v132=v2572*v12988-*p;
+  v18634=v9399*v3480-*p;
+  v6848=v4627*v10680-*p;
+  v1168=v13104*v11269-*p;
+  v11051=v15528*v1807-*p;
+  v18561=v11917*v18726-*p;
+  v11659=v17728*v5066-*p;
+  v11507=v18753*v6219-*p;
+  v5955=v5178*v8576-*p;
+  v16532=v6306*v12419-*p;
+  v18533=v9161*v17383-*p;
+  v19545=v9888*v14984-*p;
+  v5039=v8747*v14174-*p;
+  v16609=v2804*v9997-*p;
+  v16094=v10412*v11900-*p;
+  v2036=v17364*v13998-*p;
+  v7087=v9077*v15536-*p;
+  v19625=v12665*v7463-*p;
+  v491=v12656*v549-*p;
+  v9690=v10534*v11089-*p;
+  v15505=v1013*v2021-*p;
+  v10243=v11962*v17690-*p;
+  v17956=v11559*v3143-*p;
+  v799=v8892*v13844-*p;
+  v10651=v9477*v8124-*p;
+  v13673=v8343*v13717-*p;
+  v8181=v17804*v179-*p;
+  v1616=v18718*v15752-*p;
+  v7928=v13939*v1811-*p;
+  v14523=v9622*v3599-*p;
+  v2591=v18460*v7927-*p;
+  v5216=v15707*v1204-*p;
+  v17751=v525*v5596-*p;
+  v6934=v10014*v19767-*p;
+  v6276=v11011*v19841-*p;
+  v18595=v15305*v6371-*p;
+  v15401=v13564*v19486-*p;
+  v11691=v10295*v10239-*p;
+  v274=v388*v12609-*p;
+  v7836=v17238*v6152-*p;
+  v19498=v10005*v9381-*p;
+  v1059=v15000*v16202-*p;
+  v14466=v9054*v11101-*p;
+  v1670=v15075*v9313-*p;
+  v19537=v14168*v1774-*p;
+  v14100=v16881*v9385-*p;
+  v15947=v4616*v1076-*p;
+  v12859=v14283*v15791-*p;
+  v19678=v543*v17718-*p;
+  v3462=v5813*v11006-*p;
+  v8437=v5324*v16634-*p;
+  v8699=v2105*v19130-*p;
+  v1567=v121*v8759-*p;
+  v14641=v14038*v11698-*p;
+  v17203=v11979*v11355-*p;
+  v19514=v8140*v19989-*p;
+  v4163=v1385*v2719-*p;
+  v15087=v16285*v229-*p;
+  v5849=v1833*v15642-*p;
+  v15043=v6169*v13282-*p;
+  v5877=v10896*v19857-*p;
+  v3697=v19036*v4955-*p;
+  v14991=v12622*v16717-*p;
+  v1626=v5236*v16275-*p;
+  v4343=v4884*v4473-*p;
+  v2644=v19548*v9364-*p;
+  v2342=v10426*v15255-*p;
+  v13787=v16549*v4628-*p;
+  v12065=v11502*v8907-*p;
+  v15932=v5737*v17333-*p;
+  v10498=v15891*v6245-*p;
+  v9784=v7276*v19907-*p;
+  v8522=v16668*v8650-*p;
+  v2379=v19316*v10143-*p;
+  v13250=v10427*v13714-*p;
+  v6321=v7994*v7824-*p;
+  v2258=v14663*v18392-*p;
+  v14584=v15641*v5715-*p;
+  v19378=v13670*v17587-*p;
+  v19893=v6854*v15801-*p;
+  v11493=v4527*v4604-*p;
+  v8534=v8158*v16030-*p;
+  v621=v3687*v14860-*p;
+  v8221=v3731*v15331-*p;
+  v13801=v2458*v1900-*p;
+  v16810=v33*v11619-*p;
+  v17415=v8849*v6659-*p;
+  v15730=v820*v16906-*p;
+  v895=v9013*v13316-*p;
+  v13114=v13547*v2831-*p;
+  v8460=v4553*v13578-*p;
+  v4222=v18970*v13983-*p;
+  v4004=v9401*v16802-*p;
+  v10530=v9003*v10213-*p;
+  v11260=v12160*v12249-*p;
+  v6064=v16609*v13555-*p;
+  v13137=v2194*v15230-*p;
+  v11103=v682*v18995-*p;
+  v6165=v12374*v12357-*p;
+  v2496=v14490*v16088-*p;
+  v18945=v5429*v1303-*p;
+  v2178=v14655*v9542-*p;
+  v5290=v17893*v8235-*p;
+  v6926=v10240*v14286-*p;
+  v6623=v8149*v4461-*p;
+  v16609=v8863*v6842-*p;
+  v15706=v17173*v6796-*p;
+  v12444=v12203*v15887-*p;
+  v15442=v2121*v19350-*p;
+  v832=v9588*v14220-*p;
+  v15347=v15835*v9179-*p;
+  v885=v15462*v3011-*p;
+  v5293=v13580*v16003-*p;
+  v17257=v14647*v5784-*p;
+  v2006=v9732*v13760-*p;
+  v17746=v7717*v6599-*p;
+  v10472=v11586*v17969-*p;
+  v10543=v10675*v16827-*p;
+  v10275=v15629*v7535-*p;
+  v9305=v17708*v10699-*p;
+  v4749=v8308*v14890-*p;
+  v11375=v14024*v15022-*p;
+  v1203=v15452*v15835-*p;
+  v15360=v14798*v1341-*p;
+  v8850=v5227*v9708-*p;
+  v5661=v12875*v10415-*p;
+  v8419=v4083*v14193-*p;
+  v8270=v10063*v10566-*p;
+  v16307=v12336*v4256-*p;
+  v18118=v9855*v18325-*p;
+  v16512=v17276*v3582-*p;
+  v18601=v14837*v6859-*p;
+  v12123=v17172*v1757-*p;
+  v4399=v1270*v10211-*p;
+  v9687=v18688*v13049-*p;
+  v3816=v203*v9091-*p;
+  v7833=v9186*v2290-*p;
+  v14699=v3310*v5894-*p;
+  v7735=v1211*v13206-*p;
+  v19178=v12182*v79-*p;
+  v16644=v13362*v6557-*p;
+  v6682=v14910*v951-*p;
+  v16774=v11729*v5754-*p;
+  v9397=v2617*v5692-*p;
+  v8552=v5246*v8800-*p;
+  v11524=v11651*v14926-*p;
+  v15728=v4346*v17792-*p;
+  v98=v7561*v14489-*p;
+  v1379=v13980*v15455-*p;
+  v12053=v3692*v3094-*p;
+  v6024=v18586*v9123-*p;
+  v13423=v7081*v14687-*p;
+  v1649=v17089*v5458-*p;
+  v17623=v14999*v1431-*p;
+  v7795=v7082*v13527-*p;
+  v4511=v738*v4474-*p;
+  v13598=v13962*v1967-*p;
+  v4323=v19056*v15400-*p;
+  v14155=v6182*v14544-*p;
+  v6755=v17287*v2601-*p;
+  v14875=v15269*v4016-*p;
+  v18993=v9649*v483-*p;
+  v1162=v10167*v12636-*p;
+  v844=v13539*v19353-*p;
+  v9372=v160*v9812-*p;
+  v11604=v12226*v1099-*p;
+  v19030=v3527*v5455-*p;
+  v7921=v19237*v19087-*p;
+  v6372=v9682*v9629-*p;
+  v17674=v11617*v2636-*p;
+  v1622=v19927*v10681-*p;
+  v15593=v14659*v10055-*p;
+  v18667=v17372*v10757-*p;
+  v14944=v13433*v3822-*p;
+  v15329=v16470*v6712-*p;
+  v5170=v6705*v6194-*p;
+  v17975=v11559*v749-*p;
+  v13199=v6182*v16036-*p;
+  v18698=v19001*v7293-*p;
+  v10332=v402*v11156-*p;
+  v939=v15705*v18746-*p;
+  v12150=v13967*v1727-*p;
+  v19863=v6308*v7748-*p;
+  v15977=v8377*v11266-*p;
+  v2848=v4102*v6871-*p;
+  v2762=v2871*v14022-*p;
+  v19082=v14135*v10776-*p;
+  v7001=v16467*v18473-*p;
+  v7989=v6754*v13360-*p;
+  v15103=v14765*v17576-*p;
+  v10344=v9763*v5438-*p;
+  v16835=v15268*v14061-*p;
+  v12702=v5581*v19664-*p;
+  v3309=v7801*v6143-*p;
+  v2561=v9848*v16732-*p;
+  v18316=v15291*v17976-*p;
+  v9927=v6661*v4528-*p;
+  v8310=v14236*v13006-*p;
+  v6328=v2052*v305-*p;
+  v17397=v7480*v4886-*p;
+  v19732=v9565*v19363-*p;
+  v19068=v105*v2152-*p;
+  v11376=v974*v7549-*p;
+  v8421=v12170*v18292-*p;
+  v17809=v16498*v10471-*p;
+  v17652=v4894*v4712-*p;
+  v14202=v1066*v3394-*p;
+  v7248=v12990*v5463-*p;
+  v6335=v14332*v16447-*p;
+  v19315=v2502*v1324-*p;
+  v10481=v9796*v4356-*p;
+  v5442=v12207*v13468-*p;
+  v10485=v5716*v14553-*p;
+  v19149=v5932*v2641-*p;
+  v5048=v6875*v15843-*p;
+  v18634=v7195*v13162-*p;
+  v1200=v13932*v3769-*p;
+  v4207=v13673*v6128-*p;
+  v9854=v3582*v19297-*p;
+  v15006=v15378*v12492-*p;
+  v19754=v11378*v19928-*p;
+  v12092=v10502*v12692-*p;
+  v17153=v6923*v11485-*p;
+  v1479=v7181*v1178-*p;
+  v13142=v5440*v19873-*p;
+  v1229=v8373*v10128-*p;
+  v10219=v6839*v8051-*p;
+  v6119=v19532*v8444-*p;
+  v19475=v16656*v1864-*p;
+  v4258=v13789*v1129-*p;
+  v5842=v16285*v8693-*p;
+  v15900=v11840*v10748-*p;
+  v12047=v11317*v8824-*p;
+  v613=v18663*v756-*p;
+  v3927=v7964*v6942-*p;
+  v3897=v9889*v1514-*p;
+  v8490=v12979*v1156-*p;
+  v19025=v5298*v12375-*p;
+  v5032=v5071*v13522-*p;
+  v11634=v13133*v3789-*p;
+  v10153=v4886*v3476-*p;
+  v19751=v19153*v18457-*p;
+  v13962=v19028*v18972-*p;
+  v3325=v12541*v15565-*p;
+  v6904=v10653*v1284-*p;
+  v5321=v14970*v2451-*p;
+  v2521=v12382*v3173-*p;
+  v18947=v10397*v14033-*p;
+  v16922=v11577*v3354-*p;
+  v15402=v17585*v13519-*p;
+  v16308=v1908*v18360-*p;
+  v5986=v2868*v6055-*p;
+  v18354=v11476*v16984-*p;
+  v6109=v5576*v3993-*p;
+  v5424=v6826*v4116-*p;
+  v6951=v11058*v1529-*p;
+  v11338=v13128*v4158-*p;
+  v12339=v1997*v2038-*p;
+  v3131=v7469*v10959-*p;
+  v7145=v15843*v3214-*p;
+  v13827=v19926*v4760-*p;
+  v13320=v2214*v8742-*p;
+  v12996=v9377*v1707-*p;
+  v14930=v4227*v15466-*p;
+  v17975=v421*v3244-*p;
+  v8375=v2643*v2677-*p;
+  v17664=v16372*v5612-*p;
+  v4727=v1479*v8398-*p;
+  v10276=v13370*v5287-*p;
+  v2471=v3386*v12323-*p;
+  v12201=v11222*v6973-*p;
+  v6881=v13891*v776-*p;
+  v19221=v15438*v8139-*p;
+  v3029=v10463*v3624-*p;
+  v13214=v7284*v6913-*p;
+  v15813=v11217*v6196-*p;
+  v8962=v11583*v10907-*p;
+  v9385=v10152*v13114-*p;
+  v14899=v14862*v3217-*p;
+  v52=v3254*v10524-*p;
+  v6413=v5631*v13928-*p;
+  v19454=v12667*v5650-*p;
+  v14240=v19332*v19906-*p;
+  v15980=v15738*v14876-*p;
+  v5375=v7873*v12620-*p;
+  v18710=v8371*v11915-*p;
+  v19176=v16900*v18040-*p;
+  v481=v7176*v12508-*p;
+  v12060=v3419*v1446-*p;
+  v14234=v14258*v19507-*p;
+  v8744=v3735*v15537-*p;
+  v5335=v9052*v13448-*p;
+  v8035=v17145*v8452-*p;
+  v17841=v10461*v19995-*p;
+  v12090=v2293*v12810-*p;
+  v6874=v16304*v3288-*p;
+  v17561=v9186*v10003-*p;
+  v12667=v8093*v12337-*p;
+  v9146=v19969*v1570-*p;
+  v9021=v4652*v8427-*p;
+  v16684=v17288*v17671-*p;
+  v12305=v427*v12973-*p;
+  v5796=v14096*v12381-*p;
+  v7523=v18866*v4535-*p;
+  v6211=v5203*v18773-*p;
+  v17345=v10999*v18615-*p;
+  v12113=v9890*v15709-*p;
+  v10711=v17503*v5897-*p;
+  v4251=v10341*v17623-*p;
+  v19116=v5357*v18693-*p;
+  v19341=v13018*v17399-*p;
+  v15593=v3808*v8157-*p;
+  v17686=v15228*v5461-*p;
+  v10647=v4572*v12079-*p;
+  v3194=v13646*v14977-*p;
+  v10405=v3231*v13183-*p;
+  v6814=v12792*v15839-*p;
+  v7613=v7928*v6248-*p;
+  v7989=v17284*v13852-*p;
+  v15120=v5507*v18786-*p;
+  v19059=v4047*v9879-*p;
+  v16250=v19877*v5791-*p;
+  v18778=v1107*v452-*p;
+  v13055=v3081*v10212-*p;
+  v13441=v9967*v5530-*p;
+  v15413=v4251*v12554-*p;
+  v11885=v16358*v7578-*p;
+  v17752=v15381*v11536-*p;
+  v1365=v8452*v4927-*p;
+  v10832=v10160*v3063-*p;
+  v15008=v19746*v17346-*p;
+  v13603=v7741*v7979-*p;
+  v963=v18469*v4586-*p;
+  v7498=v6178*v10093-*p;
+  v19213=v5821*v61-*p;
+  v18818=v16379*v4684-*p;
+  v3995=v16641*v18791-*p;
+  v19695=v1294*v4908-*p;
+  v15255=v12941*v4165-*p;
+  v19008=v14759*v1698-*p;
+  v14679=v4419*v14059-*p;
+  v13329=v15807*v2303-*p;
+  v15069=v847*v161-*p;
+  v17017=v9462*v10112-*p;
+  v2730=v15273*v8777-*p;
+  v12975=v8821*v6636-*p;
+  v7725=v17258*v11944-*p;
+  v6918=v2175*v1902-*p;
+  v7404=v2247*v13869-*p;
+  v6055=v11744*v18993-*p;
+  v4960=v8105*v9396-*p;
+  v14320=v10349*v13600-*p;
+  v19109=v15281*v7803-*p;
+  v19759=v7930*v7861-*p;
+  v12576=v9728*v9726-*p;
+  v18887=v18428*v18713-*p;
+  v7274=v4331*v2710-*p;
+  v5329=v7806*v14524-*p;
+  v9355=v14871*v6655-*p;
+  v19017=v15036*v12409-*p;
+  v10024=v12092*v7444-*p;
+  v12093=v16277*v8403-*p;
+  v142=v1868*v6547-*p;
+  v3175=v529*v6925-*p;
+  v12156=v10382*v15817-*p;
+  v19206=v7471*v8528-*p;
+  v5892=v17434*v12865-*p;
+  v3620=v2566*v671-*p;
+  v10492=v7509*v5069-*p;
+  v8941=v2475*v18633-*p;
+  v1536=v6067*v14548-*p;
+  v13195=v19556*v16558-*p;
+  v12954=v6300*v1741-*p;
+  v11076=v18789*v11579-*p;
+  v2542=v6663*v14425-*p;
+  v12872=v14859*v7281-*p;
+  v9938=v1236*v11731-*p;
+  v4983=v18137*v17236-*p;
+  v2928=v17024*v4156-*p;
+  v14760=v17445*v19430-*p;
+  v5367=v17202*v11780-*p;
+  v12318=v9675*v16015-*p;
+  v2260=v216*v14056-*p;
+  v2267=v2280*v17223-*p;
+  v5443=v2495*v14367-*p;
+  v18177=v17623*v8706-*p;
+  v1508=v10269*v12854-*p;
+  v18174=v19670*v1971-*p;
+  v4227=v13155*v1285-*p;
+  v19652=v1442*v5607-*p;
+  v5332=v18732*v17796-*p;
+  v10532=v7945*v3738-*p;
+  v10074=v17196*v18259-*p;
+  v13488=v10520*v15257-*p;
+  v3569=v6886*v9240-*p;
+  v3840=v948*v14332-*p;
+  v5910=v17880*v1396-*p;
+  v40=v15472*v1912-*p;
+  v732=v16463*v341-*p;
+  v10511=v14395*v348-*p;
+  v4419=v2313*v17441-*p;
+  v4311=v17870*v11002-*p;
+  v2513=v4995*v421-*p;
+  v9715=v15472*v19015-*p;
+  v17642=v19882*v2803-*p;
+  v63=v11272*v13078-*p;
+  v12801=v5978*v9783-*p;
+  v578=v17862*v16703-*p;
+  v16182=v5594*v7808-*p;
+  v16571=v11628*v12353-*p;
+  v17205=v9199*v10031-*p;
+  v11153=v15831*v12733-*p;
+  v6741=v9400*v14220-*p;
+  v12148=v13240*v12814-*p;
+  v11998=v235*v3993-*p;
+  v13769=v4422*v19916-*p;
+  v7652=v1179*v7107-*p;
+  v11659=v6811*v16852-*p;
+  v2235=v5384*v2144-*p;
+  v2663=v5905*v15587-*p;
+  v3751=v8695*v17320-*p;
+  v11644=v4875*v19687-*p;
+  v1219=v2978*v9384-*p;
+  v2683=v15856*v9350-*p;
+  v2310=v16384*v3350-*p;
+  v5382=v2055*v10678-*p;
+  v12477=v1258*v4652-*p;
+  v11241=v2319*v12740-*p;
+  v19892=v2167*v16561-*p;
+  v14296=v14367*v11547-*p;
+  v6111=v13121*v9460-*p;
+  v15684=v15971*v7812-*p;
+  v3932=v18632*v11257-*p;
+  v7073=v3566*v6147-*p;
+  v4695=v7707*v12238-*p;
+  v19699=v11284*v1485-*p;
+  v2036=v13061*v6776-*p;
+  v9911=v7848*v4786-*p;
+  v15698=v5641*v11785-*p;
+  v10044=v18688*v14503-*p;
+  v19914=v19321*v14091-*p;
+  v3598=v19784*v15120-*p;
+  v14109=v13412*v15766-*p;
+  v72=v15134*v15286-*p;
+  v15201=v285*v14950-*p;
+  v9086=v9666*v10077-*p;
+  v7698=v477*v15121-*p;
+  v10286=v13633*v13965-*p;
+  v11408=v7847*v1296-*p;
+  v15552=v928*v8488-*p;
+  v3515=v16092*v9868-*p;
+  v16398=v15080*v413-*p;
+  v12894=v14167*v4727-*p;
+  v54=v13506*v12541-*p;
+  v14796=v564*v11878-*p;
+  v3990=v5108*v16191-*p;
+  v12394=v18048*v12063-*p;
+  v16821=v6360*v16609-*p;
+  v13244=v12548*v5408-*p;
+  v17269=v7604*v6095-*p;
+  v13151=v1318*v18659-*p;
+  v12991=v5096*v2242-*p;
+  v6859=v15295*v12886-*p;
+  v5057=v8955*v2612-*p;
+  v454=v18374*v17307-*p;
+  v13433=v9728*v16143-*p;
+  v14677=v6083*v3036-*p;
+  v14129=v5745*v14654-*p;
+  v1180=v5319*v13186-*p;
+  v2619=v16367*v1915-*p;
+  v9847=v11760*v11362-*p;
+  v14387=v3549*v57-*p;
+  v1940=v13675*v5615-*p;
+  v4267=v4001*v2699-*p;
+  v13802=v608*v1481-*p;
+  v1917=v6993*v6715-*p;
+  v8822=v6892*v3086-*p;
+  v298=v19595*v12334-*p;
+  v4173=v19740*v3817-*p;
+  v17113=v6299*v10555-*p;
+  v13770=v18230*v17672-*p;
+  v14614=v18108*v10716-*p;
+  v6028=v9041*v13594-*p;
+  v6446=v4325*v8683-*p;
+  v9117=v19819*v8483-*p;
+  v977=v10558*v18932-*p;
+  v9954=v12017*v13600-*p;
+  v16246=v1919*v5180-*p;
+  v969=v16906*v1865-*p;
+  v7218=v5837*v17060-*p;
+  v3461=v14864*v754-*p;
+  v8921=v15885*v6101-*p;
+  v2938=v3180*v12684-*p;
+  v18806=v3963*v9255-*p;
+  v1660=v2097*v731-*p;
+  v9343=v11957*v6258-*p;
+  v17059=v14612*v883-*p;
+  v16341=v3413*v16833-*p;
+  v6108=v49*v6413-*p;
+  v621=v18541*v10886-*p;
+  v7587=v17912*v1343-*p;
+  v12777=v6435*v2271-*p;
+  v3720=v13043*v17729-*p;
+  v7849=v17988*v5793-*p;
+  v4508=v6136*v12671-*p;
+  v10560=v6790*v8412-*p;
+  v17493=v1075*v8188-*p;
+  v7294=v16515*v9010-*p;
+  v13255=v6308*v2371-*p;
+  v406=v3090*v13811-*p;
+  v8887=v5687*v1880-*p;
+  v11061=v1748*v12286-*p;
+  v8860=v13223*v7996-*p;
+  v4393=v9671*v17020-*p;
+  v18652=v17947*v18077-*p;
+  v14827=v651*v8134-*p;
+  v1050=v4092*v13435-*p;
+  v3012=v15168*v3161-*p;
+  v8856=v17160*v11374-*p;
+  v8689=v9887*v18677-*p;
+  v7553=v11082*v831-*p;
+  v10518=v19892*v10643-*p;
+  v13007=v19450*v17288-*p;
+  v19581=v17152*v13783-*p;
+  v16898=v872*v3023-*p;
+  v4132=v1020*v7509-*p;
+  v11690=v4520*v7700-*p;
+  v49=v5138*v6956-*p;
+  v7040=v8701*v13667-*p;
+  v3954=v12803*v14049-*p;
+  v1436=v6631*v8427-*p;
+  v12661=v17914*v13184-*p;
+  v728=v8370*v18638-*p;
+  v4354=v2073*v16499-*p;
+  v2653=v11888*v11645-*p;
+  v8329=v1824*v14891-*p;
+  v11540=v19637*v15793-*p;
+  v13461=v8228*v11097-*p;
+  v6780=v28*v5977-*p;
+  v2403=v16972*v2037-*p;
+  v3934=v16154*v17862-*p;
+  v18950=v4073*v16383-*p;
+  v16394=v17675*v11548-*p;
+  v19940=v9899*v9376-*p;
+  v738=v12092*v9629-*p;
+  v16166=v1756*v110-*p;
+  v12849=v14953*v18670-*p;
+  v1464=v671*v10028-*p;
+  v16720=v12341*v8844-*p;
+  v10969=v5696*v7166-*p;
+  v4935=v920*v259-*p;
+  v10867=v17632*v8839-*p;
+  v6380=v1105*v1805-*p;
+  v15752=v6890*v13364-*p;
+  v19455=v19995*v7089-*p;
+  v7692=v15328*v10997-*p;
+  v8837=v6514*v6771-*p;
+  v19761=v6140*v1447-*p;
+  v5583=v779*v8654-*p;
+  v6852=v2619*v13477-*p;
+  v5250=v1911*v19414-*p;
+  v10178=v10787*v11818-*p;
+  v12568=v10417*v6953-*p;
+  v8847=v7078*v15843-*p;
+  v14171=v8743*v8797-*p;
+  v5763=v16586*v5166-*p;
+  v15479=v16586*v2580-*p;
+  v16097=v12567*v14924-*p;
+  v19012=v5811*v3995-*p;
+  v7984=v3179*v15637-*p;
+  v19355=v19720*v4350-*p;
+  v1885=v12755*v5032-*p;
+  v8087=v2149*v2461-*p;
+  v15741=v4931*v16006-*p;
+  v3952=v10327*v5799-*p;
+  v2372=v19731*v13103-*p;
+  v18933=v6255*v8717-*p;
+  v1931=v16252*v3753-*p;
+  v8479=v8290*v7630-*p;
+  v2026=v2745*v1495-*p;
+  v16785=v5010*v8936-*p;
+  v5728=v12994*v11160-*p;
+  v8846=v1118*v4063-*p;
+  v13499=v10985*v9177-*p;
+  v12947=v16583*v15474-*p;
+  v16480=v7394*v9938-*p;
+  v13856=v19291*v14200-*p;
+  v3235=v14485*v421-*p;
+  v5279=v4838*v7143-*p;
+  v18431=v9831*v17734-*p;
+  v10663=v10346*v16576-*p;
+  v5882=v19709*v18266-*p;
+  v14512=v7774*v14326-*p;
+  v13999=v17624*v7455-*p;
+  v5749=v12899*v11930-*p;
+  v8683=v2722*v1090-*p;
+  v2354=v19691*v1776-*p;
+  v15389=v12514*v1290-*p;
+  v16220=v19420*v11025-*p;
+  v15746=v9573*v10410-*p;
+  v14455=v17115*v14876-*p;
+  v639=v15120*v13998-*p;
+  v7577=v8272*v12019-*p;
+  v13541=v10461*v4175-*p;
+  v9174=v11840*v6649-*p;
+  v401=v4713*v5654-*p;
+  v15659=v5988*v2662-*p;
+  v17479=v13938*v2854-*p;
+  v15797=v1899*v6073-*p;
+  v11001=v17459*v13019-*p;
+  v7638=v9831*v10108-*p;
+  v17222=v2759*v277-*p;
+  v15143=v11425*v10246-*p;
+  v11528=v1385*v2078-*p;
+  v9173=v10757*v1363-*p;
+  v16702=v6260*v15208-*p;
+  v11252=v19049*v3062-*p;
+  v16052=v3396*v13739-*p;
+  v17719=v15022*v19299-*p;
+  v12892=v1288*v6922-*p;
+  v3894=v17545*v14021-*p;
+  v15872=v1880*v201-*p;
+  v2583=v2822*v6611-*p;
+  v1359=v10084*v9896-*p;
+  v6622=v1416*v12443-*p;
+  v805=v7759*v11248-*p;
+  v18133=v14297*v17553-*p;
+  v8208=v17871*v1724-*p;
+  v11818=v9847*v2690-*p;
+  v4555=v18871*v6978-*p;
+  v13633=v19333*v6934-*p;
+  v16960=v2425*v11712-*p;
+  v14625=v9025*v13783-*p;
+  v11005=v17903*v6559-*p;
+  v19905=v10618*v10572-*p;
+  v15247=v1714*v13483-*p;
+  v3911=v5331*v5653-*p;
+  v15270=v8526*v19998-*p;
+  v16145=v16539*v10511-*p;
+  v8568=v19737*v1399-*p;
+  v4885=v3072*v13507-*p;
+  v13486=v12600*v15518-*p;
+  v4952=v5714*v7890-*p;
+  v5778=v4415*v13534-*p;
+  v18573=v14026*v7812-*p;
+  v8501=v10058*v19207-*p;
+  v5459=v9300*v19377-*p;
+  v7073=v7273*v10952-*p;
+  v15949=v3484*v15610-*p;
+  v18551=v14801*v2814-*p;
+  v3054=v6867*v3087-*p;
+  v11459=v4495*v14987-*p;
+  v13204=v11536*v5396-*p;
+  v9357=v11854*v12916-*p;
+  v301=v5097*v13006-*p;
+  v15635=v17656*v15188-*p;
+  v14138=v96*v577-*p;
+  v18484=v16867*v14674-*p;
+  v3618=v2649*v11958-*p;
+  v7628=v10184*v10903-*p;
+  v8426=v13558*v681-*p;
+  v4744=v188*v3700-*p;
+  v3141=v6457*v2575-*p;
+  v3538=v15950*v2279-*p;
+  v9615=v9407*v14882-*p;
+  v19132=v10703*v1255-*p;
+  v15152=v3736*v9022-*p;
+  v16496=v7821*v19240-*p;
+  v8473=v8955*v1726-*p;
+  v897=v8514*v5608-*p;
+  v8056=v10320*v8494-*p;
+  v18293=v18244*v3117-*p;
+  v14758=v5150*v2940-*p;
+  v17305=v8051*v5-*p;
+  v13357=v10578*v18081-*p;
+  v2432=v16933*v16555-*p;
+  v5546=v6520*v2415-*p;
+  v4280=v12928*v12332-*p;
+  v11374=v6718*v9653-*p;
+  v19001=v18237*v10097-*p;
+  v1996=v10980*v5612-*p;
+  v11656=v18502*v4956-*p;
+  v9810=v16277*v7114-*p;
+  v10369=v19476*v7914-*p;
+  v7457=v714*v14029-*p;
+  v17663=v13150*v7832-*p;
+  v9379=v5773*v4418-*p;
+  v9997=v3699*v9427-*p;
+  v19475=v4696*v4187-*p;
+  v13949=v8448*v1739-*p;
+  v9763=v11053*v201-*p;
+  v12868=v1934*v2101-*p;
+  v631=v17702*v9237-*p;
+  v11273=v7022*v2041-*p;
+  v16223=v12557*v2004-*p;
+  v10447=v2854*v447-*p;
+  v14768=v19115*v8952-*p;
+  v5352=v8677*v8258-*p;
+  v2603=v13187*v5277-*p;
+  v18137=v18725*v8794-*p;
+  v3061=v15120*v11984-*p;
+  v9345=v16451*v16217-*p;
+  v6289=v3217*v1931-*p;
+  v15187=v14061*v10934-*p;
+  v14305=v10219*v11861-*p;
+  v7477=v6237*v2827-*p;
+  v10709=v2635*v13738-*p;
+  v10817=v9241*v16109-*p;
+  v17868=v9280*v12192-*p;
+  v8613=v13501*v9155-*p;
+  v16640=v13778*v19311-*p;
+  v12207=v16586*v8642-*p;
+  v15316=v4605*v14011-*p;
+  v14131=v5217*v18068-*p;
+  v11837=v487*v18827-*p;
+  v1356=v15460*v1563-*p;
+  v15391=v16834*v4602-*p;
+  v14786=v6244*v3502-*p;
+  v10180=v6961*v15281-*p;
+  v534=v13666*v2415-*p;
+  v4295=v8133*v10626-*p;
+  v2645=v10566*v17375-*p;
+  v4661=v4547*v19891-*p;
+  v12415=v8146*v941-*p;
+  v12873=v2561*v5467-*p;
+  v1136=v12560*v17005-*p;
+  v6484=v9835*v16760-*p;
+  v5965=v16618*v14576-*p;
+  v13534=v780*v3439-*p;
+  v19600=v11223*v13938-*p;
+  v14191=v6144*v3092-*p;
+  v2010=v10392*v14580-*p;
+  v5500=v3212*v13981-*p;
+  v17527=v13488*v12688-*p;
+  v15568=v9686*v17369-*p;
+  v13658=v6128*v2187-*p;
+  v5941=v5269*v878-*p;
+  v9466=v11622*v17633-*p;
+  v3096=v13368*v1402-*p;
+  v17394=v9793*v4550-*p;
+  v10052=v16485*v11908-*p;
+  v15116=v16157*v5569-*p;
+  v14327=v5126*v690-*p;
+  v5848=v16776*v12009-*p;
+  v14154=v8591*v16137-*p;
+  v2461=v2305*v550-*p;
+  v6669=v10916*v16402-*p;
+  v11606=v15770*v3548-*p;
+  v2469=v7179*v1149-*p;
+  v495=v8697*v7802-*p;
+  v6989=v9251*v9631-*p;
+  v13275=v14908*v719-*p;
+  v19566=v3280*v3949-*p;
+  v19885=v3788*v4480-*p;
+  v13460=v4241*v11851-*p;
+  v2651=v16066*v10271-*p;
+  v15271=v17479*v17392-*p;
+  v19109=v471*v11941-*p;
+  v900=v7324*v6870-*p;
+  v13890=v12219*v1335-*p;
+  v8813=v17234*v8907-*p;
+  v5326=v19870*v16847-*p;
+  v296=v8667*v1156-*p;
+  v2618=v14360*v6171-*p;
+  v11458=v4434*v10224-*p;
+  v18939=v12961*v14021-*p;
+  v14445=v466*v5725-*p;
+  v15235=v13214*v11155-*p;
+  v14317=v18129*v6353-*p;
+  v7678=v11414*v576-*p;
+  v7199=v2342*v2629-*p;
+  v6443=v19475*v9020-*p;
+  v1055=v7361*v6459-*p;
+  v3661=v3612*v6392-*p;
+  v7452=v10825*v15962-*p;
+  v824=v17902*v3882-*p;
+  v8259=v12264*v16510-*p;
+  v8743=v13611*v12912-*p;
+  v14103=v15088*v9952-*p;
+  v13534=v9064*v16265-*p;
+  v3737=v2114*v12691-*p;
+  v12610=v6405*v13961-*p;
+  v2193=v8179*v14938-*p;
+  v10203=v5822*v19581-*p;
+  v17187=v2517*v12387-*p;
+  v6297=v14309*v7936-*p;
+  v14102=v17293*v8106-*p;
+  v19607=v17457*v14351-*p;
+  v17026=v12096*v15441-*p;
+  v16784=v11616*v9047-*p;
+  v7018=v219*v6327-*p;
+  v9600=v3864*v2762-*p;
+  v18708=v10543*v12-*p;
+  v9837=v17099*v3477-*p;
+  v9889=v18982*v4607-*p;
+  v2466=v6737*v9122-*p;
+  v7432=v19607*v19982-*p;
+  v2723=v10514*v18859-*p;
+  v13767=v15772*v7966-*p;
+  v5401=v19455*v16878-*p;
+  v16480=v2957*v13821-*p;
+  v10524=v18225*v2292-*p;
+  v8097=v5878*v2017-*p;
+  v14479=v1155*v5044-*p;
+  v18370=v2062*v11134-*p;
+  v14000=v100*v17493-*p;
+  v17907=v11157*v4729-*p;
+  v10402=v8901*v12359-*p;
+  v12010=v19283*v8443-*p;
+  v5269=v9515*v9273-*p;
+  v7035=v4021*v8307-*p;
+  v14586=v13282*v7320-*p;
+  v12527=v3834*v11986-*p;
+  v16147=v3217*v12081-*p;
+  v15485=v3807*v6276-*p;
+  v1189=v16486*v10352-*p;
+  v10450=v9553*v2793-*p;
+  v3385=v11455*v3389-*p;
+  v13211=v8912*v18889-*p;
+  v14245=v8355*v9336-*p;
+  v14099=v10341*v131-*p;
+  v9610=v6467*v6833-*p;
+  v2077=v6238*v14243-*p;
+  v16440=v2064*v8800-*p;
+  v6936=v17259*v11049-*p;
+  v17037=v12969*v3800-*p;
+  v17496=v890*v636-*p;
+  v427=v4538*v17213-*p;
+  v11766=v5348*v17723-*p;
+  v17051=v13661*v6792-*p;
+  v15591=v11782*v18029-*p;
+  v5400=v1095*v16058-*p;
+  v14103=v1062*v12638-*p;
+  v17727=v15897*v9776-*p;
+  v2619=v10713*v12640-*p;
+  v12538=v9514*v16262-*p;
+  v2470=v17961*v162-*p;
+  v19551=v8231*v11617-*p;
+  v2176=v118*v16229-*p;
+  v13586=v1581*v11301-*p;
+  v12176=v15020*v8046-*p;
+  v5369=v4859*v169-*p;
+  v4113=v3235*v11807-*p;
+  v17163=v3530*v7242-*p;
+  v13213=v9152*v12532-*p;
+  v8073=v16793*v13227-*p;
+  v1720=v2980*v10655-*p;
+  v953=v12174*v6224-*p;
+  v3455=v9282*v12286-*p;
+  v3707=v10664*v6062-*p;
+  v4160=v18965*v7643-*p;
+  v11382=v13307*v6245-*p;
+  v10067=v19850*v8824-*p;
+  v18360=v15620*v9022-*p;
+  v9750=v15311*v485-*p;
+  v11253=v6757*v19894-*p;
+  v5493=v10235*v1980-*p;
+  v14640=v14781*v5803-*p;
+  v19858=v3540*v13820-*p;
+  v2512=v1756*v13850-*p;
+  v12699=v2818*v8188-*p;
+  v2526=v2633*v4091-*p;
+  v16325=v5925*v337-*p;
+  v9036=v2356*v17722-*p;
+  v16190=v12357*v5853-*p;
+  v6951=v7185*v14807-*p;
+  v18079=v7219*v17933-*p;
+  v17647=v5109*v16471-*p;
+  v16051=v7099*v16438-*p;
+  v18073=v15627*v1407-*p;
+  v522=v2144*v17084-*p;
+  v13106=v1260*v6518-*p;
+  v12818=v18328*v35-*p;
+  v4341=v6335*v14704-*p;
+  v16325=v10508*v3181-*p;
+  v3049=v16827*v18215-*p;
+  v14492=v1666*v1585-*p;
+  v1686=v7333*v10810-*p;
+  v328=v18797*v12183-*p;
+  v646=v11977*v14045-*p;
+  v9237=v2677*v9796-*p;
+  v9607=v15569*v5687-*p;
+  v6194=v1047*v16585-*p;
+  v5902=v16961*v12329-*p;
+  v8724=v8833*v18419-*p;
+  v16320=v16329*v18752-*p;
+  v6127=v1041*v3869-*p;
+  v4125=v15422*v2363-*p;
+  v14605=v9437*v12152-*p;
+  v6654=v1584*v2744-*p;
+  v15595=v8247*v6270-*p;
+  v1693=v3103*v984-*p;
+  v8865=v448*v2776-*p;
+  v3721=v5342*v2807-*p;
+  v1511=v13667*v17424-*p;
+  v15534=v6059*v17119-*p;
+  v394=v17869*v12983-*p;
+  v5326=v3681*v9904-*p;
+  v18761=v15637*v13991-*p;
+  v10443=v17707*v9932-*p;
+  v9239=v9152*v493-*p;
+  v10955=v19425*v9387-*p;
+  v7641=v19228*v15959-*p;
+  v2997=v15029*v2780-*p;
+  v679=v10944*v15385-*p;
+  v12966=v12081*v5496-*p;
+  v10244=v13833*v10289-*p;
+  v4982=v16340*v15409-*p;
+  v11456=v3191*v16490-*p;
+  v14088=v14932*v5666-*p;
+  v12183=v2625*v2352-*p;
+  v3976=v15673*v15191-*p;
+  v16271=v4166*v17725-*p;
+  v8358=v9204*v19542-*p;
+  v17024=v9712*v427-*p;
+  v9420=v19024*v9843-*p;
+  v3491=v11362*v2694-*p;
+  v10404=v17322*v14419-*p;
+  v1261=v19924*v2821-*p;
+  v19921=v11980*v11632-*p;
+  v6449=v11496*v17820-*p;
+  v8651=v15434*v2662-*p;
+  v7181=v12198*v8763-*p;
+  v18649=v16787*v1435-*p;
+  v13484=v19095*v16161-*p;
+  v3282=v1529*v17285-*p;
+  v15368=v11440*v13148-*p;
+  v16806=v7341*v10251-*p;
+  v12805=v4732*v19115-*p;
+  v18161=v8187*v11890-*p;
+  v5011=v14978*v4151-*p;
+  v1360=v10206*v5253-*p;
+  v16104=v18768*v19454-*p;
+  v4996=v13845*v1175-*p;
+  v18593=v17173*v4720-*p;
+  v17720=v17978*v17299-*p;
+  v9101=v12961*v5429-*p;
+  v19178=v17053*v4883-*p;
+  v6991=v6386*v7691-*p;
+  v3141=v12163*v833-*p;
+  v7861=v18726*v12328-*p;
+  v261=v18387*v11214-*p;
+  v17104=v16049*v3183-*p;
+  v6697=v16400*v19848-*p;
+  v675=v79*v2900-*p;
+  v19267=v9743*v16144-*p;
+  v11987=v7671*v2856-*p;
+  v17536=v10946*v9770-*p;
+  v8090=v4946*v13274-*p;
+  v6610=v18376*v491-*p;
+  v9593=v10403*v6338-*p;
+  v1800=v10459*v18614-*p;
+  v1323=v12615*v4231-*p;
+  v11293=v4188*v18702-*p;
+  v16991=v4329*v4198-*p;
+  v14396=v3805*v2666-*p;
+  v10358=v19957*v4143-*p;
+  v18053=v13086*v15935-*p;
+  v11737=v9804*v4350-*p;
+  v14887=v633*v1852-*p;
+  v13019=v4922*v16017-*p;
+  v19030=v16183*v13973-*p;
+  v12580=v12200*v15538-*p;
+  v18100=v10289*v7538-*p;
+  v18743=v5440*v19556-*p;
+  v180=v18151*v2608-*p;
+  v6881=v1866*v18478-*p;
+  v575=v11115*v7928-*p;
+  v17326=v5418*v13490-*p;
+  v11717=v19077*v14126-*p;
+  v5873=v11236*v1082-*p;
+  v12756=v12591*v13173-*p;
+  v12409=v3438*v17918-*p;
+  v11329=v2322*v7209-*p;
+  v13643=v15946*v4067-*p;
+  v13086=v18982*v3075-*p;
+  v10701=v14085*v12728-*p;
+  v12857=v18737*v419-*p;
+  v3832=v14915*v10568-*p;
+  v15029=v14776*v12380-*p;
+  v16387=v4429*v15057-*p;
+  v7747=v2266*v19281-*p;
+  v14638=v15572*v18344-*p;
+  v11796=v13909*v14895-*p;
+  v8202=v17840*v16070-*p;
+  v19161=v8285*v7370-*p;
+  v5787=v17703*v94-*p;
+  v9208=v4322*v7134-*p;
+  v15047=v15873*v8746-*p;
+  v12723=v17259*v11666-*p;
+  v3779=v4475*v10848-*p;
+  v6704=v12385*v15025-*p;
+  v15589=v11923*v18987-*p;
+  v1623=v2111*v18977-*p;
+  v8521=v16322*v2321-*p;
+  v1652=v615*v42-*p;
+  v1204=v14032*v19847-*p;
+  v1688=v10294*v7028-*p;
+  v12003=v14811*v17711-*p;
+  v9974=v16049*v12622-*p;
+  v593=v8686*v10519-*p;
+  v4105=v9609*v10778-*p;
+  v1872=v2586*v5441-*p;
+  v12976=v3364*v15215-*p;
+  v18836=v15752*v5166-*p;
+  v1684=v17074*v8033-*p;
+  v12901=v17314*v18131-*p;
+  v17384=v17912*v5683-*p;
+  v5754=v5962*v3788-*p;
+  v4760=v853*v17138-*p;
+  v2844=v7333*v13721-*p;
+  v1891=v1895*v7133-*p;
+  v18063=v15271*v2760-*p;
+  v8427=v6630*v1701-*p;
+  v3698=v5173*v16235-*p;
+  v14907=v7961*v3433-*p;
+  v2063=v1499*v8528-*p;
+  v6562=v19058*v3424-*p;
+  v10977=v3048*v5907-*p;
+  v15981=v5776*v12414-*p;
+  v16017=v13539*v7720-*p;
+  v1871=v2635*v14012-*p;
+  v9326=v16625*v3098-*p;
+  v492=v1321*v3569-*p;
+  v4207=v8336*v6135-*p;
+  v16097=v10346*v10584-*p;
+  v6114=v19192*v298-*p;
+  v19359=v2282*v1154-*p;
+  v5887=v8111*v14554-*p;
+  v2457=v12760*v2650-*p;
+  v15173=v15833*v1464-*p;
+  v15536=v14057*v13320-*p;
+  v19585=v1629*v17067-*p;
+  v13791=v5219*v12575-*p;
+  v18016=v4398*v5465-*p;
+  v6827=v14686*v11306-*p;
+  v9369=v2068*v17230-*p;
+  v271=v17214*v2150-*p;
+  v2765=v19176*v11785-*p;
+  v16531=v1759*v2687-*p;
+  v16084=v5193*v6264-*p;
+  v7783=v1065*v7992-*p;
+  v18490=v6377*v15682-*p;
+  v3324=v7139*v18907-*p;
+  v7921=v3961*v5017-*p;
+  v15285=v14448*v5914-*p;
+  v13442=v2269*v19017-*p;
+  v3931=v2871*v5795-*p;
+  v11636=v18677*v12527-*p;
+  v4838=v10573*v7125-*p;
+  v2246=v16690*v11577-*p;
+  v10356=v18092*v1780-*p;
+  v10029=v6957*v1843-*p;
+  v14626=v1034*v15085-*p;
+  v3006=v14306*v3769-*p;
+  v10957=v19425*v18068-*p;
+  v4843=v10219*v998-*p;
+  v3906=v4837*v11759-*p;
+  v12409=v861*v10287-*p;
+  v5061=v4185*v9221-*p;
+  v8844=v11359*v1952-*p;
+  v11681=v8783*v6316-*p;
+  v2200=v3283*v12281-*p;
+  v9379=v6684*v15147-*p;
+  v12859=v16348*v15813-*p;
+  v10572=v17742*v6953-*p;
+  v13400=v12444*v624-*p;
+  v13099=v19508*v18285-*p;
+  v9662=v19391*v13605-*p;
+  v8441=v12310*v6949-*p;
+  v9442=v5071*v5756-*p;
+  v9360=v10352*v13520-*p;
+  v8620=v4746*v6208-*p;
+  v15253=v7280*v15985-*p;
+  v143=v14264*v16741-*p;
+  v12380=v8104*v7668-*p;
+  v1561=v13413*v2337-*p;
+  v9943=v18831*v10039-*p;
+  v11948=v1017*v4752-*p;
+  v15556=v14220*v11157-*p;
+  v17145=v17535*v14970-*p;
+  v8707=v9396*v6297-*p;
+  v13774=v5769*v4582-*p;
+  v19215=v9240*v7524-*p;
+  v13394=v7327*v14924-*p;
+  v18338=v9253*v15362-*p;
+  v4509=v8273*v6959-*p;
+  v7375=v12382*v582-*p;
+  v12564=v4870*v15434-*p;
+  v7056=v10739*v4850-*p;
+  v16723=v18027*v2501-*p;
+  v5291=v12723*v8010-*p;
+  v15385=v13058*v528-*p;
+  v7185=v6291*v17030-*p;
+  v6404=v16362*v9211-*p;
+  v18732=v11936*v12027-*p;
+  v5430=v856*v15166-*p;
+  v11735=v18698*v10265-*p;
+  v14721=v19737*v18597-*p;
+  v6901=v8673*v14952-*p;
+  v18676=v11302*v2228-*p;
+  v11743=v18507*v8939-*p;
+  v16374=v17030*v17816-*p;
+  v3516=v4145*v2585-*p;
+  v19046=v15432*v17971-*p;
+  v4500=v15206*v6193-*p;
+  v3022=v4944*v4851-*p;
+  v15833=v15016*v9293-*p;
+  v15889=v14844*v11936-*p;
+  v9802=v12800*v3158-*p;
+  v601=v17022*v17-*p;
+  v17533=v11033*v9879-*p;
+  v8208=v7900*v4422-*p;
+  v17869=v18913*v15672-*p;
+  v3446=v7920*v10896-*p;
+  v1499=v13414*v13638-*p;
+  v18806=v9582*v9100-*p;
+  v16044=v18691*v1320-*p;
+  v9591=v16190*v17721-*p;
+  v17525=v17113*v1939-*p;
+  v8032=v7780*v2127-*p;
+  v4392=v17231*v15355-*p;
+  v1318=v1480*v1474-*p;
+  v8242=v5662*v2764-*p;
+  v14153=v509*v17685-*p;
+  v15384=v13553*v10453-*p;
+  v1642=v8888*v12238-*p;
+  v4808=v12619*v5533-*p;
+  v8689=v14083*v12779-*p;
+  v17651=v15260*v4146-*p;
+  v18349=v15994*v14849-*p;
+  v11582=v6835*v13381-*p;
+  v16392=v18689*v4725-*p;
+  v9392=v8619*v12388-*p;
+  v18738=v1340*v5488-*p;
+  v3193=v8313*v2333-*p;
+  v641=v18123*v9122-*p;
+  v331=v5056*v11627-*p;
+  v16689=v12076*v6381-*p;
+  v8751=v16373*v17578-*p;
+  v6006=v10503*v5086-*p;
+  v18914=v2680*v18402-*p;
+  v18638=v244*v18051-*p;
+  v12126=v7171*v19112-*p;
+  v6918=v15726*v11158-*p;
+  v3446=v8452*v2633-*p;
+  v5745=v11619*v418-*p;
+  v9178=v19129*v14135-*p;
+  v18849=v16909*v10152-*p;
+  v3735=v1280*v11255-*p;
+  v10978=v7032*v9263-*p;
+  v15081=v15653*v10218-*p;
+  v16997=v9760*v12389-*p;
+  v11873=v15923*v15357-*p;
+  v8901=v19425*v2054-*p;
+  v8174=v19000*v15486-*p;
+  v5345=v830*v10195-*p;
+  v17516=v14676*v7643-*p;
+  v9035=v3720*v10511-*p;
+  v8282=v19414*v13347-*p;
+  v7867=v2438*v6758-*p;
+  v9669=v7250*v17257-*p;
+  v2729=v141*v15090-*p;
+  v3994=v13555*v9925-*p;
+  v7448=v4841*v7554-*p;
+  v13779=v15321*v6646-*p;
+  v10456=v17143*v6083-*p;
+  v11792=v1417*v6010-*p;
+  v9544=v350*v10159-*p;
+  v3543=v3122*v15909-*p;
+  v19949=v16762*v9497-*p;
+  v6578=v12264*v2823-*p;
+  v19572=v3503*v11374-*p;
+  v3778=v5687*v16695-*p;
+  v10927=v13513*v14388-*p;
+  v12784=v12076*v5779-*p;
+  v15056=v5453*v17749-*p;
+  v4823=v7849*v15546-*p;
+  v12306=v10971*v13084-*p;
+  v8487=v1753*v1527-*p;
+  v19632=v17461*v8788-*p;
+  v4077=v18376*v2741-*p;
+  v15104=v19846*v5099-*p;
+  v3449=v7375*v10916-*p;
+  v12553=v5633*v11934-*p;
+  v16103=v823*v8373-*p;
+  v12253=v15111*v5336-*p;
+  v3215=v19741*v9062-*p;
+  v13603=v4073*v5868-*p;
+  v13821=v14622*v6438-*p;
+  v12550=v19358*v10198-*p;
+  v16771=v13267*v15566-*p;
+  v12896=v11450*v1193-*p;
+  v5224=v12935*v1653-*p;
+  v17391=v1149*v14023-*p;
+  v11757=v11824*v6226-*p;
+  v308=v7837*v16658-*p;
+  v19579=v2140*v8550-*p;
+  v18314=v3616*v16040-*p;
+  v4526=v18375*v2345-*p;
+  v53=v2756*v13220-*p;
+  v9457=v1363*v18534-*p;
+  v15592=v13889*v12100-*p;
+  v18812=v6645*v9194-*p;
+  v18944=v2847*v7599-*p;
+  v13432=v9564*v6015-*p;
+  v7838=v8220*v4018-*p;
+  v6957=v17165*v9529-*p;
+  v7188=v2938*v18880-*p;
+  v1105=v3484*v3365-*p;
+  v17989=v19499*v5708-*p;
+  v13537=v10842*v13401-*p;
+  v19530=v3496*v3686-*p;
+  v6882=v9667*v14003-*p;
+  v8606=v19870*v7894-*p;
+  v1210=v6836*v3119-*p;
+  v14409=v6101*v7351-*p;
+  v7788=v1623*v758-*p;
+  v19295=v12531*v16159-*p;
+  v11443=v18807*v4499-*p;
+  v2983=v5079*v447-*p;
+  v10864=v5495*v19956-*p;
+  v7261=v4329*v8065-*p;
+  v6790=v14729*v9623-*p;
+  v11603=v9759*v13215-*p;
+  v14872=v3237*v5146-*p;
+  v5655=v3595*v18507-*p;
+  v2775=v12*v3738-*p;
+  v308=v5996*v11235-*p;
+  v5058=v4403*v17905-*p;
+  v15270=v19763*v17821-*p;
+  v1348=v8217*v14060-*p;
+  v195=v977*v1569-*p;
+  v10265=v13372*v4292-*p;
+  v1158=v12060*v2904-*p;
+  v18778=v7979*v1309-*p;
+  v3668=v19219*v5137-*p;
+  v4303=v19767*v18452-*p;
+  v18726=v9295*v11347-*p;
+  v11488=v17714*v11575-*p;
+  v17431=v11449*v5346-*p;
+  v15579=v7654*v121-*p;
+  v6464=v1885*v3080-*p;
+  v9692=v3781*v16289-*p;
+  v6752=v17978*v10011-*p;
+  v13259=v19438*v12267-*p;
+  v19807=v4654*v12242-*p;
+  v11778=v7874*v3986-*p;
+  v3239=v9637*v15187-*p;
+  v1544=v15282*v2749-*p;
+  v8568=v2532*v7711-*p;
+  v13461=v2529*v4115-*p;
+  v18743=v3266*v13805-*p;
+  v9943=v14916*v1426-*p;
+  v2361=v15314*v8156-*p;
+  v4613=v6031*v18007-*p;
+  v7613=v11923*v852-*p;
+  v9975=v11752*v5630-*p;
+  v10161=v19572*v7263-*p;
+  v1699=v4356*v10913-*p;
+  v1620=v764*v13079-*p;
+  v19389=v10283*v2959-*p;
+  v18607=v11980*v16396-*p;
+  v999=v17951*v1680-*p;
+  v2326=v12769*v17398-*p;
+  v7835=v8780*v3380-*p;
+  v14272=v5883*v14007-*p;
+  v12032=v13897*v15304-*p;
+  v8106=v16919*v18231-*p;
+  v14344=v19900*v19741-*p;
+  v15991=v6102*v19303-*p;
+  v6818=v15702*v1803-*p;
+  v14403=v3718*v384-*p;
+  v12229=v4823*v7882-*p;
+  v15061=v10326*v4010-*p;
+  v15631=v1031*v981-*p;
+  v6306=v25*v4661-*p;
+  v12309=v16904*v1027-*p;
+  v10391=v3469*v16998-*p;
+  v18283=v9453*v19763-*p;
+  v13780=v12333*v3880-*p;
+  v16452=v19154*v13340-*p;
+  v5442=v12987*v4017-*p;
+  v19994=v9692*v9864-*p;
+  v16778=v8812*v11068-*p;
+  v16992=v2839*v14298-*p;
+  v15338=v7723*v16336-*p;
+  v15967=v12458*v13742-*p;
+  v13470=v15720*v14763-*p;
+  v17717=v3107*v1556-*p;
+  v4944=v523*v7095-*p;
+  v6136=v13856*v19070-*p;
+  v4114=v8877*v15036-*p;
+  v8855=v783*v14416-*p;
+  v5389=v6488*v18746-*p;
+  v13453=v10066*v3767-*p;
+  v15013=v4238*v11823-*p;
+  v2934=v9871*v18871-*p;
+  v17496=v13055*v12859-*p;
+  v9043=v13921*v8704-*p;
+  v5493=v2418*v12187-*p;
+  v14258=v1305*v13102-*p;
+  v2668=v3173*v14523-*p;
+  v6010=v18331*v12350-*p;
+  v8600=v2096*v16814-*p;
+  v2720=v12484*v3782-*p;
+  v13094=v18992*v1646-*p;
+  v4357=v17499*v121-*p;
+  v14879=v14165*v995-*p;
+  v16826=v12907*v15047-*p;
+  v5746=v13800*v4168-*p;
+  v1776=v685*v7552-*p;
+  v16569=v5267*v3125-*p;
+  v8062=v9835*v2920-*p;
+  v16314=v4667*v8002-*p;
+  v1540=v8723*v12675-*p;
+  v10657=v3844*v18330-*p;
+  v5591=v355*v19889-*p;
+  v19471=v3068*v365-*p;
+  v8787=v19363*v4070-*p;
+  v7846=v17469*v9105-*p;
+  v11350=v10111*v3050-*p;
+  v7489=v11865*v12754-*p;
+  v8103=v13527*v8206-*p;
+  v6021=v19715*v17034-*p;
+  v7810=v15801*v3452-*p;
+  v5873=v13699*v13298-*p;
+  v13741=v10040*v13405-*p;
+  v8808=v18472*v8521-*p;
+  v18468=v3165*v14414-*p;
+  v9895=v12863*v11400-*p;
+  v8601=v10441*v17639-*p;
+  v13985=v5005*v5904-*p;
+  v16608=v12132*v14406-*p;
+  v14254=v14429*v4746-*p;
+  v8891=v5320*v14473-*p;
+  v13745=v14668*v19879-*p;
+  v10405=v18797*v4090-*p;
+  v15128=v19610*v10759-*p;
+  v17994=v3249*v15936-*p;
+  v11616=v5440*v386-*p;
+  v14429=v9531*v18409-*p;
+  v1816=v9367*v11786-*p;
+  v8076=v4922*v18101-*p;
+  v2853=v11550*v6614-*p;
+  v1461=v16994*v141-*p;
+  v8045=v2633*v650-*p;
+  v3131=v3975*v3419-*p;
+  v4095=v1614*v13407-*p;
+  v5365=v15278*v14054-*p;
+  v2517=v7862*v17203-*p;
+  v2008=v3365*v16865-*p;
+  v2738=v19378*v17935-*p;
+  v8154=v8994*v18204-*p;
+  v17566=v19357*v11255-*p;
+  v9531=v8832*v14860-*p;
+  v14493=v13934*v2731-*p;
+  v7059=v11084*v2771-*p;
+  v18232=v1096*v7919-*p;
+  v14496=v520*v11361-*p;
+  v10431=v12045*v8330-*p;
+  v9375=v4156*v3170-*p;
+  v9942=v9119*v12114-*p;
+  v12490=v19970*v16156-*p;
+  v3814=v19961*v10660-*p;
+  v8702=v18928*v5261-*p;
+  v8502=v14559*v2053-*p;
+  v7076=v12356*v12766-*p;
+  v8405=v2508*v1206-*p;
+  v8091=v7485*v10410-*p;
+  v16488=v6299*v8158-*p;
+  v2841=v12961*v2538-*p;
+  v13695=v6592*v18655-*p;
+  v10170=v4411*v17700-*p;
+  v16811=v14660*v3265-*p;
+  v7994=v12036*v12166-*p;
+  v8663=v3759*v1683-*p;
+  v3945=v6442*v13369-*p;
+  v14163=v12494*v905-*p;
+  v9857=v2076*v17056-*p;
+  v451=v8939*v8978-*p;
+  v11640=v10728*v5269-*p;
+  v2265=v18078*v14653-*p;
+  v15300=v2166*v9914-*p;
+  v15937=v9316*v8475-*p;
+  v3873=v15247*v17344-*p;
+  v11808=v8970*v7312-*p;
+  v15495=v8986*v14023-*p;
+  v1974=v8976*v2713-*p;
+  v8343=v15648*v10569-*p;
+  v16911=v12031*v10661-*p;
+  v12602=v10813*v4970-*p;
+  v10594=v5658*v19243-*p;
+  v12936=v11592*v15256-*p;
+  v5805=v11832*v11790-*p;
+  v10751=v6886*v8151-*p;
+  v12781=v12856*v17414-*p;
+  v18989=v3330*v16664-*p;
+  v14481=v9338*v19262-*p;
+  v8640=v2286*v16172-*p;
+  v17469=v18041*v5843-*p;
+  v18145=v12721*v15610-*p;
+  v8728=v1771*v365-*p;
+  v9552=v4108*v16725-*p;
+  v11109=v13965*v16701-*p;
+  v17253=v15005*v3256-*p;
+  v13872=v736*v14421-*p;
+  v18995=v977*v1632-*p;
+  v4008=v8210*v5816-*p;
+  v12904=v7789*v12812-*p;
+  v4505=v8141*v17605-*p;
+  v1888=v1635*v211-*p;
+  v14985=v14844*v18026-*p;
+  v512=v1750*v16576-*p;
+  v4177=v8477*v1329-*p;
+  v17606=v3126*v10991-*p;
+  v13690=v1885*v8081-*p;
+  v4440=v5228*v10198-*p;
+  v19957=v6920*v4294-*p;
+  v13811=v18616*v16444-*p;
+  v15965=v11747*v8742-*p;
+  v15403=v18616*v5671-*p;
+  v12561=v18893*v6608-*p;
+  v18641=v16340*v18640-*p;
+  v6567=v13132*v4661-*p;
+  v15635=v9201*v17921-*p;
+  v8040=v5741*v405-*p;
+  v5725=v3504*v12604-*p;
+  v17088=v5567*v13896-*p;
+  v6646=v16771*v19649-*p;
+  v4675=v119*v6645-*p;
+  v8832=v19033*v9416-*p;
+  v1506=v296*v12688-*p;
+  v8048=v2135*v19490-*p;
+  v11625=v7607*v4792-*p;
+  v1720=v13873*v11865-*p;
+  v3398=v10492*v5652-*p;
+  v7096=v891*v12007-*p;
+  v13296=v13935*v12169-*p;
+  v4879=v11733*v5526-*p;
+  v3447=v14908*v8098-*p;
+  v81=v19885*v14535-*p;
+  v18877=v2701*v12382-*p;
+  v9399=v17477*v18531-*p;
+  v19358=v18384*v10066-*p;
+  v2300=v3407*v9268-*p;
+  v15623=v5073*v17060-*p;
+  v10918=v8598*v8518-*p;
+  v15963=v5168*v6815-*p;
+  v12346=v7234*v2711-*p;
+  v10987=v16943*v14391-*p;
+  v15119=v11243*v2217-*p;
+  v2881=v15710*v16731-*p;
+  v9808=v19221*v10763-*p;
+  v7123=v2097*v14779-*p;
+  v9941=v5544*v9024-*p;
+  v657=v17774*v5259-*p;
+  v16966=v9410*v3105-*p;
+  v9543=v17747*v11224-*p;
+  v12586=v16616*v11411-*p;
+  v9039=v5284*v13950-*p;
+  v11073=v431*v2090-*p;
+  v9481=v11306*v3745-*p;
+  v5219=v1420*v14037-*p;
+  v8326=v15408*v3566-*p;
+  v1127=v3380*v2040-*p;
+  v15851=v1789*v7114-*p;
+  v7706=v12304*v475-*p;
+  v12151=v19427*v8567-*p;
+  v4692=v1378*v10105-*p;
+  v9207=v5047*v12612-*p;
+  v18817=v2224*v9570-*p;
+  v19124=v3296*v7353-*p;
+  v15487=v14020*v19547-*p;
+  v12666=v18864*v4878-*p;
+  v11083=v6190*v17242-*p;
+  v3968=v2244*v17484-*p;
+  v13131=v12039*v14369-*p;
+  v12611=v8058*v17256-*p;
+  v4836=v4597*v2294-*p;
+  v19519=v13457*v17693-*p;
+  v7418=v1121*v15651-*p;
+  v15854=v5899*v9209-*p;
+  v9535=v12815*v15528-*p;
+  v3288=v1412*v12957-*p;
+  v17639=v2281*v1636-*p;
+  v13373=v10133*v272-*p;
+  v8437=v17869*v3591-*p;
+  v6263=v8437*v14915-*p;
+  v4615=v416*v4522-*p;
+  v7430=v3596*v11841-*p;
+  v13877=v10002*v2340-*p;
+  v13060=v18271*v3624-*p;
+  v10957=v7216*v16255-*p;
+  v3964=v17795*v2877-*p;
+  v16652=v6549*v8744-*p;
+  v65=v18469*v9359-*p;
+  v4976=v13190*v3619-*p;
+  v18542=v18796*v17326-*p;
+  v5194=v10362*v836-*p;
+  v13136=v17990*v16214-*p;
+  v6190=v15436*v17141-*p;
+  v12093=v2067*v13569-*p;
+  v12695=v5992*v3956-*p;
+  v12843=v5953*v6174-*p;
+  v3755=v15916*v19705-*p;
+  v6398=v19926*v16004-*p;
+  v13110=v5913*v18045-*p;
+  v9111=v8685*v19092-*p;
+  v5517=v18502*v865-*p;
+  v4457=v586*v4667-*p;
+  v17911=v14137*v2863-*p;
+  v4652=v12455*v15965-*p;
+  v13321=v2373*v5202-*p;
+  v5587=v10550*v12748-*p;
+  v11790=v11061*v7011-*p;
+  v880=v1825*v5456-*p;
+  v2308=v17001*v3284-*p;
+  v853=v7485*v286-*p;
+  v2615=v11657*v15669-*p;
+  v16531=v19732*v2229-*p;
+  v4351=v1936*v3136-*p;
+  v16780=v9283*v18825-*p;
+  v2573=v7505*v5221-*p;
+  v6467=v1812*v16592-*p;
+  v15146=v6602*v8204-*p;
+  v16245=v4603*v7152-*p;
+  v14374=v9385*v4306-*p;
+  v13706=v17545*v14123-*p;
+  v8102=v11590*v3046-*p;
+  v4088=v6467*v3341-*p;
+  v8474=v1882*v17853-*p;
+  v11905=v3160*v4289-*p;
+  v16302=v18991*v998-*p;
+  v9733=v15963*v7896-*p;
+  v11931=v8898*v9169-*p;
+  v8878=v9810*v19135-*p;
+  v2327=v1854*v7392-*p;
+  v17021=v56*v18909-*p;
+  v13556=v4599*v5118-*p;
+  v8558=v15872*v18627-*p;
+  v14907=v13336*v12176-*p;
+  v8545=v7764*v10666-*p;
+  v6606=v17228*v17786-*p;
+  v5214=v10279*v13824-*p;
+  v1503=v12853*v18625-*p;
+  v17484=v12029*v4734-*p;
+  v5237=v10156*v2860-*p;
+  v10098=v5048*v6809-*p;
+  v16103=v258*v493-*p;
+  v16255=v3444*v19077-*p;
+  v12990=v12751*v11368-*p;
+  v1548=v9430*v3827-*p;
+  v6306=v7355*v4079-*p;
+  v12383=v12435*v10264-*p;
+  v16682=v3417*v15128-*p;
+  v4736=v5915*v12205-*p;
+  v169=v6576*v3655-*p;
+  v11761=v15360*v19770-*p;
+  v17633=v4574*v6980-*p;
+  v19397=v17033*v2656-*p;
+  v2076=v9739*v2068-*p;
+  v1591=v2321*v6086-*p;
+  v5027=v8415*v19713-*p;
+  v6257=v2244*v14859-*p;
+  v11618=v6258*v2806-*p;
+  v1987=v13754*v10343-*p;
+  v12304=v10592*v7391-*p;
+  v4352=v3780*v18858-*p;
+  v18388=v3640*v1994-*p;
+  v16005=v4653*v13536-*p;
+  v2996=v9505*v8403-*p;
+  v1651=v18424*v1969-*p;
+  v2271=v10374*v1647-*p;
+  v7603=v14776*v898-*p;
+  v17004=v1751*v363-*p;
+  v8945=v12265*v6023-*p;
+  v15775=v6028*v16291-*p;
+  v11199=v6167*v9759-*p;
+  v18548=v5071*v14421-*p;
+  v15929=v10790*v18371-*p;
+  v19696=v2600*v15281-*p;
+  v5596=v6206*v17701-*p;
+  v12998=v4318*v17903-*p;
+  v12190=v13012*v1110-*p;
+  v5207=v9930*v4437-*p;
+  v8054=v477*v5627-*p;
+  v7581=v18488*v16479-*p;
+  v3615=v12291*v18857-*p;
+  v5785=v16280*v16804-*p;
+  v14352=v3755*v4352-*p;
+  v11698=v19462*v13529-*p;
+  v3402=v6159*v2120-*p;
+  v7336=v19985*v19451-*p;
+  v13172=v16242*v9289-*p;
+  v6908=v3658*v10484-*p;
+  v469=v14644*v7374-*p;
+  v6165=v18942*v7791-*p;
+  v12283=v5143*v15998-*p;
+  v15249=v11066*v6665-*p;
+  v17540=v17954*v6595-*p;
+  v104=v12830*v1152-*p;
+  v5455=v10757*v11065-*p;
+  v5671=v17627*v18289-*p;
+  v8270=v8381*v9528-*p;
+  v13898=v4769*v18660-*p;
+  v8914=v18168*v12347-*p;
+  v1927=v6717*v13311-*p;
+  v4812=v9474*v2474-*p;
+  v1407=v14003*v8206-*p;
+  v19446=v13708*v15488-*p;
+  v19577=v6542*v5635-*p;
+  v7246=v17422*v12029-*p;
+  v9275=v2447*v6353-*p;
+  v10518=v14500*v2819-*p;
+  v3041=v919*v17909-*p;
+  v8776=v139*v8310-*p;
+  v13853=v1812*v4951-*p;
+  v11184=v6990*v17412-*p;
+  v14465=v3551*v15894-*p;
+  v12971=v4893*v17121-*p;
+  v8765=v10126*v3262-*p;
+  v15836=v9737*v17044-*p;
+  v17715=v11499*v7003-*p;
+  v210=v12925*v1931-*p;
+  v12580=v16629*v17077-*p;
+  v8486=v2255*v13237-*p;
+  v2016=v6006*v17470-*p;
+  v19409=v17178*v11243-*p;
+  v9254=v9460*v6649-*p;
+  v10537=v11593*v10989-*p;
+  v8176=v16378*v7562-*p;
+  v18786=v17930*v19282-*p;
+  v5046=v10749*v14916-*p;
+  v15920=v680*v4307-*p;
+  v14861=v19847*v15519-*p;
+  v18876=v17224*v2171-*p;
+  v19597=v12315*v5171-*p;
+  v5048=v18337*v18078-*p;
+  v18058=v15763*v11847-*p;
+  v1584=v8342*v8421-*p;
+  v11856=v8942*v10889-*p;
+  v10417=v12207*v10475-*p;
+  v1907=v2267*v6317-*p;
+  v12131=v13145*v293-*p;
+  v16052=v18233*v12619-*p;
+  v11770=v6885*v12986-*p;
+  v2394=v1786*v6851-*p;
+  v8632=v15474*v7610-*p;
+  v9365=v6999*v5675-*p;
+  v8931=v2489*v12320-*p;
+  v19976=v15599*v9734-*p;
+  v2963=v2497*v12363-*p;
+  v18976=v6983*v15440-*p;
+  v2764=v12460*v16101-*p;
+  v10752=v13959*v18828-*p;
+  v7620=v10593*v6577-*p;
+  v18874=v16574*v5942-*p;
+  v3172=v15420*v7121-*p;
+  v11845=v17317*v3294-*p;
+  v19371=v17267*v19474-*p;
+  v10499=v14620*v4631-*p;
+  v19070=v15459*v9257-*p;
+  v7384=v11574*v5742-*p;
+  v13813=v18972*v9817-*p;
+  v292=v4719*v3363-*p;
+  v8691=v1045*v8822-*p;
+  v2694=v2057*v4525-*p;
+  v2829=v18770*v6594-*p;
+  v3822=v631*v4-*p;
+  v18958=v16863*v18901-*p;
+  v1554=v7391*v12653-*p;
+  v11834=v4755*v9648-*p;
+  v7334=v3833*v9601-*p;
+  v4252=v3646*v18306-*p;
+  v19362=v2194*v1514-*p;
+  v18477=v15650*v6147-*p;
+  v10093=v13386*v2027-*p;
+  v3296=v7685*v1279-*p;
+  v7632=v6211*v12781-*p;
+  v8370=v7988*v8075-*p;
+  v12580=v18497*v17512-*p;
+  v10607=v9787*v3957-*p;
+  v10829=v16453*v13980-*p;
+  v10502=v14133*v1335-*p;
+  v1423=v11824*v16916-*p;
+  v11106=v3611*v1155-*p;
+  v19765=v12512*v15946-*p;
+  v6011=v5616*v9941-*p;
+  v5863=v17758*v13946-*p;
+  v9499=v11259*v5445-*p;
+  v15878=v5002*v6147-*p;
+  v15983=v9681*v13567-*p;
+  v6171=v16284*v9836-*p;
+  v15593=v5412*v5855-*p;
+  v18182=v2892*v8670-*p;
+  v13557=v9146*v13575-*p;
+  v1220=v13822*v17475-*p;
+  v3140=v1124*v19998-*p;
+  v17249=v12437*v10031-*p;
+  v1436=v6513*v17348-*p;
+  v17246=v989*v8606-*p;
+  v16621=v14855*v17812-*p;
+  v1933=v658*v13181-*p;
+  v18999=v15463*v12143-*p;
+  v10331=v6347*v11921-*p;
+  v16127=v18692*v11989-*p;
+  v192=v4807*v1005-*p;
+  v19360=v3836*v11442-*p;
+  v18391=v6557*v774-*p;
+  v6893=v12664*v10965-*p;
+  v11385=v3746*v8211-*p;
+  v5406=v18981*v2538-*p;
+  v9185=v19088*v12246-*p;
+  v6067=v3317*v5085-*p;
+  v12957=v17856*v1606-*p;
+  v1930=v3349*v14672-*p;
+  v17424=v5130*v11589-*p;
+  v16597=v5633*v13487-*p;
+  v18961=v3816*v10168-*p;
+  v11736=v17079*v11674-*p;
+  v16804=v13715*v11865-*p;
+  v4316=v10900*v19226-*p;
+  v15381=v10612*v2434-*p;
+  v7074=v6274*v15394-*p;
+  v3797=v3273*v15572-*p;
+  v7703=v16262*v10614-*p;
+  v1677=v14365*v10055-*p;
+  v8134=v4378*v18730-*p;
+  v9529=v16677*v9043-*p;
+  v10602=v4800*v18457-*p;
+  v1290=v10973*v8046-*p;
+  v14187=v12712*v12197-*p;
+  v13331=v18734*v1351-*p;
+  v703=v18443*v3141-*p;
+  v6744=v449*v1933-*p;
+  v2636=v19895*v11464-*p;
+  v16793=v6587*v1524-*p;
+  v180=v5329*v9664-*p;
+  v1304=v14417*v13917-*p;
+  v8748=v19129*v19872-*p;
+  v2711=v7798*v1120-*p;
+  v3735=v5370*v2862-*p;
+  v6493=v16406*v6574-*p;
+  v17780=v12124*v8512-*p;
+  v10838=v12119*v16510-*p;
+  v11584=v7757*v16992-*p;
+  v12846=v9491*v9986-*p;
+  v11515=v12473*v2883-*p;
+  v10423=v17746*v3229-*p;
+  v17679=v10807*v17543-*p;
+  v2961=v2769*v1893-*p;
+  v3972=v18070*v6587-*p;
+  v19919=v4623*v18573-*p;
+  v4469=v475*v3569-*p;
+  v8518=v14073*v19919-*p;
+  v11809=v17781*v17920-*p;
+  v7019=v7257*v6150-*p;
+  v5429=v6829*v10017-*p;
+  v16629=v17768*v1278-*p;
+  v12349=v16957*v18306-*p;
+  v61=v10615*v5591-*p;
+  v12308=v19531*v1919-*p;
+  v1017=v10102*v3269-*p;
+  v8159=v966*v11356-*p;
+  v10974=v3861*v3523-*p;
+  v17639=v15524*v8657-*p;
+  v11105=v9538*v12799-*p;
+  v4126=v3669*v19059-*p;
+  v12961=v4643*v11349-*p;
+  v6039=v227*v10633-*p;
+  v6991=v19728*v3078-*p;
+  v16116=v11439*v15665-*p;
+  v10593=v15442*v19715-*p;
+  v4036=v8627*v3903-*p;
+  v16762=v16491*v5778-*p;
+  v769=v1987*v19793-*p;
+  v7945=v1439*v5748-*p;
+  v11499=v3951*v10575-*p;
+  v7462=v9291*v9530-*p;
+  v14151=v989*v18018-*p;
+  v3837=v12029*v3889-*p;
+  v10417=v9405*v15242-*p;
+  v15859=v553*v6643-*p;
+  v18949=v13720*v8291-*p;
+  v8430=v10644*v3180-*p;
+  v14942=v7884*v3102-*p;
+  v12004=v3779*v14641-*p;
+  v16317=v15010*v17589-*p;
+  v10623=v11703*v9680-*p;
+  v9109=v10485*v14503-*p;
+  v8439=v12898*v11623-*p;
+  v15054=v16904*v6069-*p;
+  v8365=v9982*v15963-*p;
+  v3376=v17465*v12465-*p;
+  v4032=v11816*v5396-*p;
+  v9370=v10869*v10291-*p;
+  v19359=v5372*v3603-*p;
+  v14879=v3527*v12494-*p;
+  v2213=v3334*v16685-*p;
+  v8770=v17272*v397-*p;
+  v15826=v14498*v14171-*p;
+  v14236=v7610*v15412-*p;
+  v8598=v16736*v7833-*p;
+  v18442=v2690*v18594-*p;
+  v9898=v13377*v17923-*p;
+  v594=v8591*v2852-*p;
+  v19260=v11283*v2198-*p;
+  v13532=v19830*v17074-*p;
+  v16100=v10796*v494-*p;
+  v19806=v9608*v8832-*p;
+  v7378=v9755*v10940-*p;
+  v14209=v8550*v19970-*p;
+  v3770=v14982*v6102-*p;
+  v13080=v9822*v6477-*p;
+  v16016=v5948*v11934-*p;
+  v1281=v13287*v14713-*p;
+  v11546=v6269*v13710-*p;
+  v3475=v1895*v5510-*p;
+  v14649=v6616*v12987-*p;
+  v17042=v17234*v1977-*p;
+  v4464=v4665*v4892-*p;
+  v3985=v6242*v16463-*p;
+  v12956=v15703*v12384-*p;
+  v4056=v5818*v5923-*p;
+  v16457=v4863*v2335-*p;
+  v19165=v19603*v4881-*p;
+  v18047=v19348*v15993-*p;
+  v17077=v19193*v2349-*p;
+  v14338=v14524*v19668-*p;
+  v7934=v7342*v9669-*p;
+  v3371=v3190*v12334-*p;
+  v131=v19891*v15471-*p;
+  v13550=v18688*v8316-*p;
+  v8447=v16065*v5858-*p;
+  v11223=v3036*v4474-*p;
+  v4172=v19626*v19118-*p;
+  v5059=v9232*v7325-*p;
+  v6007=v18951*v2577-*p;
+  v3298=v10847*v12702-*p;
+  v17349=v19285*v2328-*p;
+  v16251=v4863*v2060-*p;
+  v13104=v9963*v2792-*p;
+  v19533=v425*v6187-*p;
+  v4328=v12365*v15237-*p;
+  v6873=v11106*v18265-*p;
+  v2525=v11462*v18846-*p;
+  v5471=v2885*v13473-*p;
+  v1164=v15907*v19352-*p;
+  v11520=v9407*v16447-*p;
+  v12669=v13078*v15575-*p;
+  v7844=v5669*v15204-*p;
+  v15143=v7525*v930-*p;
+  v13077=v14061*v16073-*p;
+  v7469=v1328*v18922-*p;
+  v9857=v15616*v4932-*p;
+  v11980=v643*v14612-*p;
+  v13155=v1279*v9512-*p;
+  v15612=v11377*v8702-*p;
+  v8652=v15654*v12069-*p;
+  v1278=v1886*v6792-*p;
+  v19761=v6323*v15774-*p;
+  v4761=v9930*v18084-*p;
+  v7592=v12361*v12764-*p;
+  v18130=v2092*v18076-*p;
+  v3267=v11470*v4009-*p;
+  v2968=v6374*v5870-*p;
+  v5671=v1712*v5340-*p;
+  v5600=v11449*v238-*p;
+  v8716=v17381*v10706-*p;
+  v15845=v14740*v11255-*p;
+  v3548=v7999*v13312-*p;
+  v7388=v8926*v8973-*p;
+  v5106=v7801*v3243-*p;
+  v6004=v1608*v2519-*p;
+  v7093=v8566*v2973-*p;
+  v13079=v15937*v14741-*p;
+  v12944=v17686*v11588-*p;
+  v7932=v18705*v4017-*p;
+  v9909=v13585*v2432-*p;
+  v7220=v6750*v16290-*p;
+  v10224=v18539*v13168-*p;
+  v5106=v10724*v3139-*p;
+  v1027=v19533*v13305-*p;
+  v12484=v6361*v7270-*p;
+  v2671=v1265*v1004-*p;
+  v12441=v15392*v6334-*p;
+  v6928=v16736*v12371-*p;
+  v2559=v7035*v6385-*p;
+  v15773=v3141*v12653-*p;
+  v13190=v6621*v2799-*p;
+  v1831=v18009*v8663-*p;
+  v7663=v19642*v5920-*p;
+  v10987=v18935*v6499-*p;
+  v10633=v13522*v17603-*p;
+  v8029=v18983*v18142-*p;
+  v12077=v14194*v14839-*p;
+  v18066=v17229*v10333-*p;
+  v4466=v3227*v10499-*p;
+  v9425=v3807*v634-*p;
+  v14665=v15587*v5472-*p;
+  v15375=v17035*v14955-*p;
+  v9006=v4379*v18228-*p;
+  v18056=v6616*v17928-*p;
+  v2723=v13312*v16549-*p;
+  v6343=v17853*v2704-*p;
+  v18221=v15186*v7442-*p;
+  v2359=v4460*v11629-*p;
+  v13991=v9041*v1646-*p;
+  v15511=v5987*v2809-*p;
+  v17682=v18101*v11469-*p;
+  v14877=v13077*v7980-*p;
+  v17995=v11884*v7120-*p;
+  v7646=v15666*v16197-*p;
+  v19930=v8035*v17216-*p;
+  v7618=v12078*v18588-*p;
+  v19889=v6289*v16993-*p;
+  v13702=v18724*v9168-*p;
+  v10327=v2984*v9362-*p;
+  v9249=v13950*v1595-*p;
+  v19438=v17720*v18548-*p;
+  v5111=v7001*v15784-*p;
+  v3775=v12402*v13454-*p;
+  v1446=v4487*v9708-*p;
+  v13836=v13303*v14705-*p;
+  v18558=v7782*v14254-*p;
+  v19050=v14705*v16274-*p;
+  v7989=v13114*v300-*p;
+  v17388=v7031*v21-*p;
+  v18068=v4656*v1134-*p;
+  v3478=v1496*v13818-*p;
+  v13193=v6607*v3654-*p;
+  v712=v14723*v16517-*p;
+  v10229=v4392*v17398-*p;
+  v13187=v7198*v7836-*p;
+  v14161=v10626*v9445-*p;
+  v8780=v3064*v7150-*p;
+  v18838=v9717*v6812-*p;
+  v5922=v5273*v16814-*p;
+  v13920=v12455*v10259-*p;
+  v13991=v2578*v7840-*p;
+  v18945=v4771*v11155-*p;
+  v5667=v7093*v1047-*p;
+  v12031=v940*v5583-*p;
+  v7538=v734*v10984-*p;
+  v1578=v19785*v16832-*p;
+  v5551=v9703*v6778-*p;
+  v4943=v9779*v5490-*p;
+  v13134=v2557*v11348-*p;
+  v16474=v10488*v7347-*p;
+  v16508=v15458*v8857-*p;
+  v4572=v15554*v9020-*p;
+  v4779=v12008*v11386-*p;
+  v4533=v16015*v2276-*p;
+  v1668=v1207*v7474-*p;
+  v19431=v17936*v8767-*p;
+  v735=v1176*v10331-*p;
+  v10174=v19452*v17473-*p;
+  v2594=v1079*v13604-*p;
+  v834=v10515*v1943-*p;
+  v939=v3329*v17904-*p;
+  v18468=v12158*v16475-*p;
+  v14116=v17238*v1911-*p;
+  v14647=v9687*v3497-*p;
+  v3413=v5703*v17161-*p;
+  v10206=v11409*v4449-*p;
+  v8892=v18860*v16706-*p;
+  v18384=v7746*v12172-*p;
+  v9126=v14689*v9090-*p;
+  v19522=v1717*v19097-*p;
+  v11823=v10861*v16588-*p;
+  v9930=v9663*v7263-*p;
+  v1398=v2729*v13036-*p;
+  v11630=v15985*v3525-*p;
+  v11711=v10833*v14713-*p;
+  v10683=v49*v1325-*p;
+  v4420=v5785*v19180-*p;
+  v10859=v16040*v10168-*p;
+  v19845=v8741*v5624-*p;
+  v7075=v4184*v4099-*p;
+  v13809=v319*v19659-*p;
+  v11999=v1224*v7721-*p;
+  v4947=v15898*v15164-*p;
+  v8978=v2445*v12528-*p;
+  v1131=v7973*v6011-*p;
+  v15682=v19460*v14604-*p;
+  v2310=v19844*v17371-*p;
+  v12221=v19529*v8568-*p;
+  v2894=v6306*v12838-*p;
+  v11544=v2373*v16407-*p;
+  v18432=v13638*v5399-*p;
+  v7618=v7839*v3122-*p;
+  v4502=v12295*v8092-*p;
+  v6883=v723*v11129-*p;
+  v11207=v2190*v14975-*p;
+  v8394=v17126*v18613-*p;
+  v7065=v16624*v9728-*p;
+  v6261=v1753*v4738-*p;
+  v5753=v330*v2760-*p;
+  v6315=v7526*v16511-*p;
+  v5894=v6801*v6846-*p;
+  v250=v11899*v7335-*p;
+  v14939=v10779*v11922-*p;
+  v618=v12374*v5706-*p;
+  v19651=v16396*v12046-*p;
+  v12774=v12901*v16664-*p;
+  v19647=v5937*v12946-*p;
+  v19817=v19193*v14286-*p;
+  v1279=v9644*v18068-*p;
+  v4465=v179*v14814-*p;
+  v11557=v19572*v8782-*p;
+  v3861=v5274*v8809-*p;
+  v8093=v18356*v12352-*p;
+  v5168=v4904*v18838-*p;
+  v3296=v6463*v1701-*p;
+  v1316=v16086*v5685-*p;
+  v493=v17997*v10805-*p;
+  v571=v10529*v10073-*p;
+  v15797=v16666*v6447-*p;
+  v5598=v1283*v18503-*p;
+  v15707=v4353*v11810-*p;
+  v17708=v8657*v12607-*p;
+  v16451=v10368*v1667-*p;
+  v11511=v15522*v13684-*p;
+  v1395=v7655*v10773-*p;
+  v11170=v3656*v12230-*p;
+  v15073=v9340*v5527-*p;
+  v1029=v12304*v9756-*p;
+  v15051=v5951*v12177-*p;
+  v14220=v9675*v4749-*p;
+  v1028=v12235*v12868-*p;
+  v12048=v5469*v15543-*p;
+  v10705=v10893*v4562-*p;
+  v12706=v8854*v5516-*p;
+  v9127=v9708*v10058-*p;
+  v7654=v18689*v10928-*p;
+  v14882=v8175*v12542-*p;
+  v368=v11491*v12970-*p;
+  v10222=v13206*v3838-*p;
+  v5399=v560*v18788-*p;
+  v16213=v15943*v3898-*p;
+  v11532=v2008*v9910-*p;
+  v9053=v19692*v19552-*p;
+  v16710=v2656*v7308-*p;
+  v14275=v4410*v17564-*p;
+  v7112=v5561*v15982-*p;
+  v1700=v10960*v13643-*p;
+  v665=v9509*v19695-*p;
+  v5608=v19160*v17542-*p;
+  v13973=v9570*v9700-*p;
+  v2905=v18696*v11025-*p;
+  v15541=v9531*v5692-*p;
+  v12156=v1969*v17901-*p;
+  v12901=v14883*v14398-*p;
+  v10426=v3322*v1283-*p;
+  v16234=v12660*v18757-*p;
+  v16559=v11322*v16087-*p;
+  v9317=v17971*v5364-*p;
+  v10693=v3738*v989-*p;
+  v12716=v13882*v14602-*p;
+  v9096=v6298*v17489-*p;
+  v1006=v12948*v4665-*p;
+  v5653=v472*v19312-*p;
+  v15098=v10903*v1253-*p;
+  v1161=v3904*v15223-*p;
+  v3577=v7046*v15943-*p;
+  v5253=v18723*v18424-*p;
+  v12985=v15349*v16936-*p;
+  v11178=v12518*v9969-*p;
+  v1672=v11789*v12334-*p;
+  v6057=v6891*v10881-*p;
+  v6889=v3568*v3637-*p;
+  v19408=v6195*v2927-*p;
+  v13144=v6068*v14623-*p;
+  v15697=v19458*v12597-*p;
+  v14196=v12678*v3640-*p;
+  v15222=v14198*v7003-*p;
+  v3611=v15581*v7096-*p;
+  v2622=v10860*v2174-*p;
+  v16356=v14383*v15665-*p;
+  v16724=v12691*v7965-*p;
+  v11043=v4276*v17266-*p;
+  v14114=v8040*v13469-*p;
+  v17678=v6782*v281-*p;
+  v19802=v98*v12564-*p;
+  v7438=v9097*v17197-*p;
+  v17992=v16295*v9249-*p;
+  v9227=v5597*v4800-*p;
+  v581=v3405*v1455-*p;
+  v3760=v9801*v13020-*p;
+  v6921=v10914*v16419-*p;
+  v1336=v12418*v887-*p;
+  v4915=v7152*v18859-*p;
+  v1979=v17086*v890-*p;
+  v9619=v8962*v17555-*p;
+  v9899=v2842*v7330-*p;
+  v823=v14482*v8189-*p;
+  v10496=v12225*v3959-*p;
+  v16679=v224*v14616-*p;
+  v7627=v7342*v11865-*p;
+  v913=v17073*v19836-*p;
+  v2612=v17400*v1386-*p;
+  v4578=v11537*v18771-*p;
+  v88=v17316*v16255-*p;
+  v11616=v679*v3088-*p;
+  v5600=v11606*v15334-*p;
+  v8817=v9193*v8154-*p;
+  v2596=v8104*v9426-*p;
+  v5804=v3774*v6064-*p;
+  v17479=v14568*v3306-*p;
+  v18737=v15778*v8013-*p;
+  v18176=v8077*v19176-*p;
+  v11287=v13041*v12842-*p;
+  v11101=v4061*v16996-*p;
+  v1787=v18845*v3397-*p;
+  v6536=v7836*v6256-*p;
+  v13733=v14146*v6200-*p;
+  v17960=v10221*v3896-*p;
+  v9800=v1513*v19646-*p;
+  v5227=v1069*v10814-*p;
+  v3566=v19064*v4336-*p;
+  v12551=v7267*v12426-*p;
+  v16371=v3241*v11917-*p;
+  v8512=v18893*v3748-*p;
+  v13033=v5222*v17634-*p;
+  v4921=v9823*v581-*p;
+  v17789=v15471*v2571-*p;
+  v4943=v16611*v19214-*p;
+  v11703=v9217*v18179-*p;
+  v7809=v979*v6003-*p;
+  v6328=v2457*v5305-*p;
+  v18717=v1087*v16371-*p;
+  v15204=v16638*v13211-*p;
+  v15553=v5504*v19768-*p;
+  v15204=v17518*v16396-*p;
+  v7025=v2393*v3996-*p;
+  v871=v15649*v10808-*p;
+  v17733=v3042*v14352-*p;
+  v10955=v2803*v15383-*p;
+  v18486=v9518*v14259-*p;
+  v12435=v8541*v2949-*p;
+  v9523=v4567*v7942-*p;
+  v198=v1469*v12889-*p;
+  v8431=v16283*v18969-*p;
+  v12013=v13319*v1654-*p;
+  v17641=v19004*v808-*p;
+  v6367=v15571*v17261-*p;
+  v18624=v10027*v3283-*p;
+  v8854=v1860*v11055-*p;
+  v13092=v14408*v6620-*p;
+  v781=v19585*v9666-*p;
+  v8962=v6135*v7067-*p;
+  v14568=v4501*v17504-*p;
+  v8281=v8865*v2443-*p;
+  v11573=v8610*v4711-*p;
+  v16335=v2865*v5902-*p;
+  v1700=v10136*v3635-*p;
+  v19472=v7275*v17324-*p;
+  v10278=v14957*v1753-*p;
+  v278=v18012*v14841-*p;
+  v4131=v9558*v6694-*p;
+  v10456=v7269*v306-*p;
+  v12679=v6016*v17271-*p;
+  v15734=v15064*v19234-*p;
+  v8133=v10901*v16976-*p;
+  v5457=v5495*v16641-*p;
+  v12119=v5822*v4141-*p;
+  v16980=v7169*v4819-*p;
+  v7492=v19869*v14515-*p;
+  v18056=v15477*v6608-*p;
+  v8510=v10796*v19724-*p;
+  v4880=v11062*v13658-*p;
+  v1779=v252*v4323-*p;
+  v4671=v13629*v1565-*p;
+  v5162=v13015*v5207-*p;
+  v4378=v17554*v15539-*p;
+  v18453=v4095*v13234-*p;
+  v10657=v19499*v17218-*p;
+  v16427=v6846*v6623-*p;
+  v10693=v13626*v19665-*p;
+  v19685=v260*v19240-*p;
+  v6200=v9140*v2664-*p;
+  v3690=v14489*v1986-*p;
+  v13863=v6449*v10556-*p;
+  v11620=v3703*v3124-*p;
+  v3625=v3852*v17504-*p;
+  v17208=v11772*v164-*p;
+  v13675=v19261*v8165-*p;
+  v7470=v16484*v5720-*p;
+  v19584=v5739*v9918-*p;
+  v13242=v16732*v7053-*p;
+  v8665=v11322*v2253-*p;
+  v3257=v15868*v17433-*p;
+  v14036=v8926*v14525-*p;
+  v7265=v8729*v11383-*p;
+  v16214=v18741*v1035-*p;
+  v7811=v8281*v7816-*p;
+  v12059=v3356*v5281-*p;
+  v5054=v9731*v19436-*p;
+  v7024=v6889*v9267-*p;
+  v7259=v11499*v9006-*p;
+  v12300=v2755*v8113-*p;
+  v13837=v4028*v13774-*p;
+  v6063=v12158*v6695-*p;
+  v3715=v16871*v10191-*p;
+  v4317=v6714*v460-*p;
+  v10331=v13859*v19682-*p;
+  v15344=v7778*v15212-*p;
+  v10717=v4884*v17515-*p;
+  v11960=v15141*v10883-*p;
+  v16814=v16534*v18416-*p;
+  v11970=v1398*v15784-*p;
+  v3433=v11537*v18317-*p;
+  v16344=v704*v15034-*p;
+  v17904=v5051*v12943-*p;
+  v16915=v9288*v6775-*p;
+  v19948=v8543*v12346-*p;
+  v19088=v4824*v4203-*p;
+  v15317=v19104*v1560-*p;
+  v6186=v4043*v14214-*p;
+  v5186=v16176*v10317-*p;
+  v17527=v17645*v15622-*p;
+  v14499=v9920*v9936-*p;
+  v1973=v2968*v1617-*p;
+  v13136=v9977*v18321-*p;
+  v11559=v17797*v4093-*p;
+  v4287=v16356*v5695-*p;
+  v6562=v12680*v6685-*p;
+  v3033=v4918*v636-*p;
+  v13277=v9132*v13698-*p;
+  v1953=v3534*v12030-*p;
+  v3080=v1814*v4738-*p;
+  v4962=v6597*v815-*p;
+  v7329=v7746*v422-*p;
+  v4370=v17284*v2621-*p;
+  v1365=v12530*v11472-*p;
+  v1384=v17974*v10259-*p;
+  v17677=v19151*v12731-*p;
+  v18753=v13058*v5220-*p;
+  v18690=v8174*v12975-*p;
+  v13706=v3459*v15903-*p;
+  v18340=v2535*v11827-*p;
+  v19778=v19262*v19282-*p;
+  v3121=v13046*v19425-*p;
+  v19887=v10484*v16681-*p;
+  v3465=v19557*v4705-*p;
+  v16884=v14457*v7198-*p;
+  v4482=v11104*v19516-*p;
+  v11542=v15416*v851-*p;
+  v16582=v13962*v7772-*p;
+  v5733=v5359*v10769-*p;
+  v16225=v7044*v6255-*p;
+  v8229=v9743*v6353-*p;
+  v9126=v16982*v15145-*p;
+  v10253=v12175*v7022-*p;
+  v8041=v19663*v15829-*p;
+  v4409=v897*v4704-*p;
+  v15653=v13638*v17901-*p;
+  v12670=v12690*v14199-*p;
+  v6003=v19010*v18126-*p;
+  v1027=v5571*v7351-*p;
+  v2163=v16437*v7164-*p;
+  v10508=v14870*v8674-*p;
+  v8557=v15682*v931-*p;
+  v13390=v9192*v7623-*p;
+  v4108=v11686*v5178-*p;
+  v3760=v19456*v19429-*p;
+  v15706=v16342*v377-*p;
+  v5710=v16788*v12220-*p;
+  v9803=v4076*v18140-*p;
+  v13752=v8140*v14399-*p;
+  v8969=v17094*v18911-*p;
+  v5320=v7655*v9774-*p;
+  v9442=v13909*v10593-*p;
+  v12025=v11608*v13141-*p;
+  v19784=v2057*v993-*p;
+  v5395=v6130*v11686-*p;
+  v5436=v5651*v18233-*p;
+  v7408=v19902*v4692-*p;
+  v19595=v4493*v10424-*p;
+  v8169=v3017*v6657-*p;
+  v19052=v600*v8068-*p;
+  v5234=v6917*v7702-*p;
+  v6317=v13583*v9751-*p;
+  v9665=v18635*v8008-*p;
+  v2653=v18713*v6533-*p;
+  v17698=v2691*v12930-*p;
+  v17818=v11765*v10227-*p;
+  v13233=v4146*v7329-*p;
+  v8304=v3380*v2308-*p;
+  v10861=v2826*v6653-*p;
+  v13127=v15872*v8459-*p;
+  v13185=v18440*v4310-*p;
+  v6032=v8651*v17974-*p;
+  v16784=v8962*v15440-*p;
+  v9344=v5299*v9913-*p;
+  v15419=v9803*v14144-*p;
+  v15690=v15274*v12189-*p;
+  v6056=v3265*v3637-*p;
+  v18681=v7789*v9769-*p;
+  v9825=v10243*v18752-*p;
+  v8333=v16042*v1003-*p;
+  v6350=v12580*v13562-*p;
+  v7035=v11779*v1473-*p;
+  v6765=v1133*v12812-*p;
+  v9185=v2553*v5168-*p;
+  v7700=v15983*v9728-*p;
+  v295=v5022*v11141-*p;
+  v14148=v15804*v12917-*p;
+  v10948=v11084*v1129-*p;
+  v12808=v8384*v11251-*p;
+  v6950=v9070*v6400-*p;
+  v10950=v2028*v13184-*p;
+  v13614=v9231*v16064-*p;
+  v17999=v6452*v10205-*p;
+  v19562=v3736*v5956-*p;
+  v15102=v12267*v7202-*p;
+  v5215=v5382*v5650-*p;
+  v18039=v1058*v13474-*p;
+  v6349=v9430*v2266-*p;
+  v6215=v3592*v14223-*p;
+  v2843=v9515*v15336-*p;
+  v1699=v5063*v8038-*p;
+  v14222=v16823*v10838-*p;
+  v13931=v876*v10828-*p;
+  v12787=v18296*v6659-*p;
+  v17740=v8184*v19774-*p;
+  v846=v17559*v2259-*p;
+  v6135=v12726*v14487-*p;
+  v4152=v10604*v9111-*p;
+  v8234=v17618*v19291-*p;
+  v8991=v16201*v14150-*p;
+  v7502=v3366*v5408-*p;
+  v11000=v3511*v9002-*p;
+  v15562=v10883*v7565-*p;
+  v11924=v17411*v12864-*p;
+  v4109=v9517*v6807-*p;
+  v13989=v10507*v3372-*p;
+  v6325=v3212*v4299-*p;
+  v3883=v9008*v10360-*p;
+  v2163=v15470*v12238-*p;
+  v300=v5809*v4486-*p;
+  v11373=v10603*v19874-*p;
+  v14791=v14986*v14325-*p;
+  v6973=v11913*v14224-*p;
+  v3149=v2323*v12650-*p;
+  v17832=v3460*v3242-*p;
+  v14235=v2978*v19046-*p;
+  v5280=v8664*v11547-*p;
+  v9496=v18656*v14753-*p;
+  v1701=v12468*v17640-*p;
+  v12745=v7630*v1651-*p;
+  v9387=v7282*v15767-*p;
+  v117=v7253*v1082-*p;
+  v7152=v11827*v11573-*p;
+  v14875=v15356*v16760-*p;
+  v19182=v3445*v14728-*p;
+  v16673=v15249*v19744-*p;
+  v14026=v8045*v9902-*p;
+  v6387=v8547*v16623-*p;
+  v16303=v9493*v2121-*p;
+  v6973=v18646*v17361-*p;
+  v10058=v19185*v1855-*p;
+  v2172=v16182*v3716-*p;
+  v3128=v10857*v14154-*p;
+  v19735=v17678*v6950-*p;
+  v19246=v1579*v15527-*p;
+  v1294=v13856*v5206-*p;
+  v16094=v17343*v19465-*p;
+  v7024=v4304*v17043-*p;
+  v6129=v7965*v13722-*p;
+  v18071=v113*v19625-*p;
+  v8569=v824*v16884-*p;
+  v3630=v18552*v2640-*p;
+  v7516=v19474*v15354-*p;
+  v11360=v8360*v2637-*p;
+  v18475=v8620*v12689-*p;
+  v4774=v10980*v8234-*p;
+  v12404=v372*v19465-*p;
+  v12799=v13579*v13192-*p;
+  v15939=v12520*v9692-*p;
+  v15735=v13199*v18966-*p;
+  v16821=v3696*v1440-*p;
+  v4788=v16358*v14731-*p;
+  v4662=v12528*v14795-*p;
+  v3085=v3181*v2058-*p;
+  v16372=v5582*v8471-*p;
+  v5392=v17968*v13498-*p;
+  v1578=v5232*v8785-*p;
+  v11961=v14696*v4118-*p;
+  v11494=v16277*v8761-*p;
+  v13236=v19080*v14211-*p;
+  v4954=v18198*v19851-*p;
+  v6989=v958*v5322-*p;
+  v14130=v11861*v7136-*p;
+  v6382=v11233*v7332-*p;
+  v10999=v8260*v5599-*p;
+  v12881=v2663*v1487-*p;
+  v16023=v18675*v1728-*p;
+  v2180=v3759*v5681-*p;
+  v16040=v2292*v3080-*p;
+  v16074=v10495*v4261-*p;
+  v17828=v6864*v411-*p;
+  v19498=v12982*v10177-*p;
+  v16747=v12521*v17496-*p;
+  v18444=v16891*v14640-*p;
+  v14055=v7998*v18127-*p;
+  v7387=v12074*v18137-*p;
+  v17040=v2296*v3953-*p;
+  v3127=v4607*v16225-*p;
+  v14604=v12310*v744-*p;
+  v8058=v1018*v747-*p;
+  v7856=v15169*v5957-*p;
+  v16992=v16720*v9167-*p;
+  v3964=v681*v9325-*p;
+  v11253=v17326*v13813-*p;
+  v2136=v17795*v3925-*p;
+  v636=v5727*v15071-*p;
+  v19116=v17059*v5889-*p;
+  v10768=v19725*v6877-*p;
+  v14633=v15867*v7794-*p;
+  v8683=v7199*v217-*p;
+  v16751=v1427*v9499-*p;
+  v10402=v16465*v16004-*p;
+  v18688=v14650*v11481-*p;
+  v340=v2156*v6465-*p;
+  v17972=v19812*v17898-*p;
+  v19510=v5894*v13318-*p;
+  v14608=v6180*v6226-*p;
+  v160=v17805*v7164-*p;
+  v931=v2966*v4062-*p;
+  v1005=v5369*v18623-*p;
+  v8620=v1452*v6237-*p;
+  v2083=v4740*v1366-*p;
+  v868=v6929*v9406-*p;
+  v552=v11744*v1147-*p;
+  v11446=v18192*v9658-*p;
+  v387=v7697*v313-*p;
+  v13908=v19066*v1084-*p;
+  v1919=v14317*v4587-*p;
+  v9236=v18434*v17024-*p;
+  v19819=v15524*v17274-*p;
+  v19258=v1873*v7188-*p;
+  v19081=v14059*v7517-*p;
+  v3615=v6625*v6919-*p;
+  v11114=v17614*v16890-*p;
+  v13122=v15230*v11677-*p;
+  v7853=v19575*v19863-*p;
+  v18526=v10245*v2857-*p;
+  v1065=v12878*v10890-*p;
+  v8778=v4081*v2820-*p;
+  v14095=v4846*v1262-*p;
+  v5628=v18251*v11253-*p;
+  v5873=v4510*v18529-*p;
+  v19563=v6625*v19452-*p;
+  v7930=v18753*v9293-*p;
+  v9226=v18254*v19085-*p;
+  v3738=v16215*v3658-*p;
+  v3647=v10043*v10454-*p;
+  v11201=v18138*v18082-*p;
+  v17426=v19637*v10127-*p;
+  v6475=v7597*v18631-*p;
+  v5589=v8547*v3525-*p;
+  v6177=v7545*v7341-*p;
+  v15377=v5131*v16679-*p;
+  v12963=v3490*v9691-*p;
+  v14899=v14574*v10320-*p;
+  v8907=v11400*v11679-*p;
+  v16030=v15720*v11985-*p;
+  v3014=v13118*v12678-*p;
+  v15714=v6314*v2162-*p;
+  v2475=v11869*v9119-*p;
+  v2452=v3750*v9571-*p;
+  v11416=v7350*v5625-*p;
+  v17133=v13661*v5519-*p;
+  v19504=v18871*v14862-*p;
+  v13388=v15719*v17264-*p;
+  v13969=v1135*v2238-*p;
+  v13540=v10858*v13132-*p;
+  v7231=v11570*v17708-*p;
+  v11588=v7652*v10810-*p;
+  v10895=v7351*v88-*p;
+  v8198=v16034*v12976-*p;
+  v15578=v7038*v6912-*p;
+  v6517=v5234*v6570-*p;
+  v14853=v4480*v19346-*p;
+  v1178=v18314*v18074-*p;
+  v7645=v13191*v18533-*p;
+  v19501=v5221*v18860-*p;
+  v4970=v11375*v15894-*p;
+  v13455=v12071*v7492-*p;
+  v2074=v11062*v6942-*p;
+  v4207=v14881*v16700-*p;
+  v2521=v17004*v718-*p;
+  v15829=v9101*v1662-*p;
+  v5969=v1874*v3029-*p;
+  v19120=v14901*v4937-*p;
+  v8583=v5367*v2488-*p;
+  v16371=v7759*v18680-*p;
+  v1203=v15370*v8240-*p;
+  v11188=v6939*v14120-*p;
+  v2709=v8772*v13943-*p;
+  v6376=v6607*v18650-*p;
+  v5559=v12758*v8482-*p;
+  v16458=v12193*v9705-*p;
+  v5969=v801*v15145-*p;
+  v16237=v18116*v18643-*p;
+  v7078=v6243*v5864-*p;
+  v6809=v5178*v10150-*p;
+  v6190=v6893*v9937-*p;
+  v18135=v12883*v8562-*p;
+  v11397=v9029*v10317-*p;
+  v1914=v11223*v1324-*p;
+  v8587=v9873*v13658-*p;
+  v13329=v18126*v1738-*p;
+  v19759=v16670*v14305-*p;
+  v14149=v8550*v9674-*p;
+  v7736=v13387*v15443-*p;
+  v14614=v3566*v7032-*p;
+  v18264=v10943*v5638-*p;
+  v11471=v15114*v14721-*p;
+  v17946=v19707*v11558-*p;
+  v4388=v3494*v8371-*p;
+  v4410=v15075*v19687-*p;
+  v3772=v7170*v10873-*p;
+  v19659=v3674*v2641-*p;
+  v13460=v14839*v6563-*p;
+  v15979=v5966*v19971-*p;
+  v16220=v8353*v2210-*p;
+  v13839=v8511*v5616-*p;
+  v8089=v444*v3281-*p;
+  v2390=v5520*v11629-*p;
+  v19028=v15597*v14567-*p;
+  v1969=v6618*v16981-*p;
+  v64=v7582*v13033-*p;
+  v15410=v15513*v15190-*p;
+  v10302=v13155*v16473-*p;
+  v18723=v12249*v7182-*p;
+  v3276=v5600*v1702-*p;
+  v7591=v12678*v10055-*p;
+  v7457=v4107*v11887-*p;
+  v12846=v1761*v5851-*p;
+  v4360=v5015*v8494-*p;
+  v1049=v3210*v11704-*p;
+  v13491=v10898*v13030-*p;
+  v19161=v18997*v3192-*p;
+  v11144=v18555*v18313-*p;
+  v709=v14130*v5939-*p;
+  v7889=v8935*v1146-*p;
+  v12746=v15491*v7700-*p;
+  v16828=v12986*v16807-*p;
+  v16476=v843*v10056-*p;
+  v16985=v15705*v12327-*p;
+  v6324=v6688*v1947-*p;
+  v8275=v12519*v6495-*p;
+  v6325=v2884*v13317-*p;
+  v11524=v15232*v14826-*p;
+  v19920=v643*v18450-*p;
+  v19952=v12264*v13516-*p;
+  v5274=v8630*v12729-*p;
+  v14607=v47*v1473-*p;
+  v898=v9908*v10166-*p;
+  v15775=v246*v3363-*p;
+  v16972=v15006*v2081-*p;
+  v4478=v18719*v1870-*p;
+  v19060=v9402*v10220-*p;
+  v19392=v9870*v8325-*p;
+  v2849=v12495*v6174-*p;
+  v141=v11915*v4299-*p;
+  v5090=v7265*v10897-*p;
+  v14526=v5149*v14393-*p;
+  v2114=v11225*v19278-*p;
+  v16793=v14211*v12626-*p;
+  v2186=v3743*v13302-*p;
+  v19078=v14845*v1842-*p;
+  v10987=v8651*v15896-*p;
+  v18443=v545*v1831-*p;
+  v17252=v15003*v13506-*p;
+  v8199=v17431*v15024-*p;
+  v3553=v6384*v18305-*p;
+  v2100=v10635*v8587-*p;
+  v7903=v10969*v7110-*p;
+  v1545=v13456*v1006-*p;
+  v17985=v11820*v10592-*p;
+  v6716=v4152*v16678-*p;
+  v12025=v8831*v4321-*p;
+  v14006=v13736*v4700-*p;
+  v2696=v11650*v8180-*p;
+  v10987=v16539*v15443-*p;
+  v4479=v10181*v5169-*p;
+  v15319=v1587*v5367-*p;
+  v18269=v11312*v2939-*p;
+  v12279=v2789*v14448-*p;
+  v3765=v15704*v1304-*p;
+  v7448=v18491*v14947-*p;
+  v8574=v16538*v7995-*p;
+  v6900=v7226*v12225-*p;
+  v6858=v13786*v875-*p;
+  v15557=v18915*v5845-*p;
+  v1885=v15643*v17537-*p;
+  v12881=v2939*v15800-*p;
+  v7439=v16749*v4174-*p;
+  v15526=v13202*v4448-*p;
+  v10312=v11422*v16320-*p;
+  v13096=v11012*v19740-*p;
+  v8028=v14659*v172-*p;
+  v16735=v2884*v19534-*p;
+  v9605=v14841*v7145-*p;
+  v16793=v18078*v19031-*p;
+  v18952=v14594*v2458-*p;
+  v16926=v13053*v15816-*p;
+  v19519=v12356*v14006-*p;
+  v564=v6462*v18273-*p;
+  v8949=v14818*v14144-*p;
+  v9665=v12956*v19547-*p;
+  v8100=v8609*v7438-*p;
+  v18371=v14443*v2108-*p;
+  v3306=v2268*v18081-*p;
+  v9703=v13747*v18128-*p;
+  v1035=v14036*v17979-*p;
+  v13795=v19667*v9186-*p;
+  v6575=v3326*v12913-*p;
+  v2183=v4204*v6997-*p;
+  v2417=v13594*v14257-*p;
+  v12893=v2366*v3474-*p;
+  v10197=v14639*v15794-*p;
+  v13764=v10049*v10664-*p;
+  v16728=v1788*v14633-*p;
+  v11666=v19825*v2790-*p;
+  v901=v14395*v14440-*p;
+  v11924=v6785*v17767-*p;
+  v9014=v13276*v18512-*p;
+  v10580=v10319*v586-*p;
+  v18495=v9761*v12999-*p;
+  v19786=v4134*v9232-*p;
+  v16797=v13776*v8885-*p;
+  v14371=v11605*v8449-*p;
+  v6618=v3397*v2164-*p;
+  v9795=v11120*v19543-*p;
+  v6474=v4170*v14627-*p;
+  v3701=v16135*v1019-*p;
+  v13241=v8336*v1447-*p;
+  v12063=v368*v16224-*p;
+  v7877=v7936*v19062-*p;
+  v19778=v17807*v2708-*p;
+  v6946=v775*v13433-*p;
+  v17776=v14430*v13321-*p;
+  v7237=v12608*v15747-*p;
+  v11928=v10509*v11159-*p;
+  v10127=v16289*v10098-*p;
+  v3336=v17186*v6123-*p;
+  v8127=v4943*v7106-*p;
+  v14986=v19470*v17704-*p;
+  v14247=v13062*v14510-*p;
+  v11477=v15317*v16086-*p;
+  v19686=v10592*v13170-*p;
+  v11824=v17128*v5517-*p;
+  v426=v15210*v6904-*p;
+  v3711=v11864*v8843-*p;
+  v10742=v13715*v1260-*p;
+  v16233=v5966*v15784-*p;
+  v16566=v11772*v10742-*p;
+  v1464=v3289*v4924-*p;
+  v18797=v6533*v18771-*p;
+  v12948=v18005*v4087-*p;
+  v15007=v3004*v8688-*p;
+  v17707=v3402*v2040-*p;
+  v2369=v2342*v3155-*p;
+  v18376=v10854*v16030-*p;
+  v8551=v10894*v2645-*p;
+  v15692=v3516*v13367-*p;
+  v9588=v18579*v7518-*p;
+  v1442=v19061*v18890-*p;
+  v5772=v12663*v8545-*p;
+  v18455=v5820*v7200-*p;
+  v2034=v9639*v18291-*p;
+  v19984=v11186*v11732-*p;
+  v12897=v11067*v15629-*p;
+  v11567=v572*v9997-*p;
+  v6823=v10862*v4517-*p;
+  v7631=v3397*v6054-*p;
+  v8768=v13150*v6849-*p;
+  v1345=v4760*v555-*p;
+  v6205=v3244*v16585-*p;
+  v7685=v16415*v13801-*p;
+  v16509=v18844*v17511-*p;
+  v2575=v16269*v14544-*p;
+  v1957=v10621*v13513-*p;
+  v7862=v662*v17569-*p;
+  v7359=v17861*v7148-*p;
+  v9176=v5447*v14526-*p;
+  v14035=v5685*v2572-*p;
+  v12958=v2100*v9690-*p;
+  v5349=v16367*v18188-*p;
+  v16942=v17466*v6137-*p;
+  v5813=v2456*v16488-*p;
+  v1105=v11814*v1708-*p;
+  v9535=v18674*v17599-*p;
+  v19953=v16093*v10430-*p;
+  v19303=v1030*v14978-*p;
+  v6777=v18103*v6015-*p;
+  v10512=v4584*v18624-*p;
+  v6525=v8294*v12437-*p;
+  v7249=v4419*v14265-*p;
+  v3006=v14580*v9915-*p;
+  v19967=v12183*v17445-*p;
+  v5854=v9363*v18699-*p;
+  v2664=v10706*v7846-*p;
+  v658=v13323*v13418-*p;
+  v12050=v9835*v181-*p;
+  v18114=v15376*v18720-*p;
+  v2414=v17793*v12918-*p;
+  v5558=v18753*v6410-*p;
+  v3462=v15567*v15849-*p;
+  v7596=v868*v13675-*p;
+  v9122=v11191*v10209-*p;
+  v13274=v7373*v11026-*p;
+  v13385=v8092*v18483-*p;
+  v1180=v16349*v14830-*p;
+  v12877=v10964*v14428-*p;
+  v8879=v15547*v8924-*p;
+  v2794=v16203*v18278-*p;
+  v18725=v5292*v4906-*p;
+  v11002=v1799*v663-*p;
+  v17440=v6344*v8925-*p;
+  v18245=v17098*v4929-*p;
+  v13216=v412*v18440-*p;
+  v7989=v15201*v17458-*p;
+  v9239=v17943*v11331-*p;
+  v343=v885*v10172-*p;
+  v14437=v14439*v1270-*p;
+  v19934=v5101*v9001-*p;
+  v14487=v543*v18561-*p;
+  v5151=v15765*v2931-*p;
+  v9955=v19168*v7491-*p;
+  v5255=v3006*v19907-*p;
+  v4011=v3962*v6556-*p;
+  v6298=v7392*v14973-*p;
+  v9927=v10158*v7448-*p;
+  v13540=v18405*v1988-*p;
+  v1586=v3859*v17341-*p;
+  v5290=v3796*v11467-*p;
+  v4739=v758*v17453-*p;
+  v1824=v4019*v1761-*p;
+  v5853=v1511*v9996-*p;
+  v169=v3966*v18968-*p;
+  v18793=v13505*v18216-*p;
+  v2275=v17783*v19360-*p;
+  v7051=v17980*v14375-*p;
+  v30=v10575*v12869-*p;
+  v1732=v4522*v601-*p;
+  v11919=v14922*v8725-*p;
+  v8965=v10813*v17802-*p;
+  v1428=v1212*v2440-*p;
+  v1712=v6299*v1897-*p;
+  v5521=v12393*v11696-*p;
+  v2598=v17722*v10656-*p;
+  v7053=v14109*v1097-*p;
+  v395=v13141*v13899-*p;
+  v4450=v818*v3163-*p;
+  v11531=v11543*v15385-*p;
+  v4688=v1720*v16812-*p;
+  v18684=v7034*v546-*p;
+  v6532=v10199*v9437-*p;
+  v11196=v6038*v3027-*p;
+  v4178=v991*v19928-*p;
+  v13407=v15677*v11908-*p;
+  v10764=v1593*v1985-*p;
+  v9173=v9053*v1701-*p;
+  v4254=v7255*v11061-*p;
+  v7355=v19211*v4394-*p;
+  v12132=v10993*v17013-*p;
+  v8945=v4832*v9268-*p;
+  v9295=v16307*v15976-*p;
+  v15421=v6430*v3639-*p;
+  v2818=v643*v2105-*p;
+  v19422=v1650*v16335-*p;
+  v12915=v1156*v15688-*p;
+  v9523=v7664*v13432-*p;
+  v6713=v9851*v9819-*p;
+  v19954=v9135*v5533-*p;
+  v13214=v10531*v1836-*p;
+  v16911=v11908*v709-*p;
+  v11218=v7138*v12646-*p;
+  v16759=v7248*v18825-*p;
+  v14910=v17610*v12811-*p;
+  v11119=v3643*v19232-*p;
+  v716=v13601*v18666-*p;
+  v12551=v7014*v515-*p;
+  v3407=v16928*v1817-*p;
+  v3459=v14593*v9925-*p;
+  v17216=v28*v1434-*p;
+  v19284=v5730*v10458-*p;
+  v2151=v19407*v7013-*p;
+  v15123=v10865*v1449-*p;
+  v13167=v14480*v10815-*p;
+  v3608=v8408*v10204-*p;
+  v10550=v5161*v1665-*p;
+  v9153=v4580*v125-*p;
+  v15501=v15730*v13652-*p;
+  v13478=v18923*v9257-*p;
+  v13062=v19576*v7365-*p;
+  v3875=v9356*v19760-*p;
+  v13116=v3938*v4494-*p;
+  v19039=v9130*v5786-*p;
+  v19917=v19450*v17506-*p;
+  v7892=v18392*v8937-*p;
+  v5944=v17135*v19332-*p;
+  v1102=v260*v8609-*p;
+  v7127=v10737*v11080-*p;
+  v6835=v3964*v7683-*p;
+  v8241=v18788*v11739-*p;
+  v17595=v14452*v3460-*p;
+  v19635=v19515*v10767-*p;
+  v11496=v13043*v9623-*p;
+  v11086=v9269*v18448-*p;
+  v5505=v6921*v1727-*p;
+  v19368=v14627*v15596-*p;
+  v17687=v7817*v1501-*p;
+  v3000=v17543*v19327-*p;
+  v7099=v16578*v8762-*p;
+  v12524=v6155*v16352-*p;
+  v8854=v16183*v4130-*p;
+  v13025=v2831*v1023-*p;
+  v14884=v9463*v989-*p;
+  v19607=v17329*v12187-*p;
+  v17211=v2285*v246-*p;
+  v358=v378*v8557-*p;
+  v5707=v17710*v604-*p;
+  v7354=v7785*v14826-*p;
+  v210=v18363*v1563-*p;
+  v4135=v4785*v3523-*p;
+  v5449=v896*v4425-*p;
+  v9841=v9561*v133-*p;
+  v10178=v24*v2490-*p;
+  v18593=v19343*v6050-*p;
+  v6998=v4404*v10112-*p;
+  v3178=v16675*v7947-*p;
+  v6791=v7812*v18301-*p;
+  v3108=v6858*v17093-*p;
+  v16548=v962*v17778-*p;
+  v13275=v18056*v2411-*p;
+  v430=v7701*v11137-*p;
+  v19993=v528*v16915-*p;
+  v223=v19402*v9957-*p;
+  v11175=v16512*v7566-*p;
+  v17092=v7078*v10360-*p;
+  v2157=v628*v12975-*p;
+  v17802=v7288*v3302-*p;
+  v217=v15502*v7040-*p;
+  v15085=v2964*v11820-*p;
+  v6544=v2351*v16390-*p;
+  v17840=v17922*v2741-*p;
+  v9714=v6951*v9131-*p;
+  v15243=v13430*v11654-*p;
+  v8711=v17773*v10645-*p;
+  v9034=v12436*v10862-*p;
+  v257=v10945*v19694-*p;
+  v17102=v16471*v5069-*p;
+  v11045=v18969*v5119-*p;
+  v12958=v17332*v10704-*p;
+  v12967=v3668*v789-*p;
+  v17619=v8117*v13537-*p;
+  v9576=v2042*v10396-*p;
+  v6714=v3005*v6571-*p;
+  v12905=v1165*v16762-*p;
+  v7651=v16117*v4059-*p;
+  v9884=v16314*v481-*p;
+  v4695=v10260*v4160-*p;
+  v18437=v10786*v2769-*p;
+  v275=v16322*v19883-*p;
+  v2339=v6015*v16315-*p;
+  v18757=v10789*v3331-*p;
+  v956=v13000*v1881-*p;
+  v17538=v3316*v1622-*p;
+  v16274=v3558*v18108-*p;
+  v11201=v4069*v10185-*p;
+  v18008=v4824*v15261-*p;
+  v15265=v14339*v19513-*p;
+  v15337=v15900*v19194-*p;
+  v6924=v7104*v19368-*p;
+  v19942=v19731*v6175-*p;
+  v11160=v12252*v315-*p;
+  v9766=v11825*v521-*p;
+  v3045=v12093*v7386-*p;
+  v2858=v18303*v12832-*p;
+  v5132=v17745*v13877-*p;
+  v1629=v4396*v19853-*p;
+  v5300=v18566*v11016-*p;
+  v208=v14668*v13338-*p;
+  v7236=v5213*v8909-*p;
+  v14005=v4257*v2233-*p;
+  v11682=v98*v16404-*p;
+  v18679=v5203*v19501-*p;
+  v5695=v12136*v13649-*p;
+  v19470=v1235*v11459-*p;
+  v4079=v17344*v3623-*p;
+  v14056=v18727*v9890-*p;
+  v11345=v17709*v2655-*p;
+  v6069=v712*v17800-*p;
+  v19492=v6390*v3073-*p;
+  v10501=v5305*v4923-*p;
+  v14771=v13823*v15567-*p;
+  v13583=v12837*v3599-*p;
+  v1743=v17079*v14971-*p;
+  v1172=v16685*v12607-*p;
+  v4877=v5299*v7785-*p;
+  v15998=v2271*v6245-*p;
+  v18949=v17881*v13784-*p;
+  v17555=v6711*v11852-*p;
+  v3114=v726*v5823-*p;
+  v5195=v17907*v15728-*p;
+  v19075=v11592*v18092-*p;
+  v16984=v17657*v17746-*p;
+  v1848=v7635*v1226-*p;
+  v8469=v1372*v17985-*p;
+  v7372=v7159*v1103-*p;
+  v17079=v8087*v8449-*p;
+  v18307=v5379*v17760-*p;
+  v2363=v16526*v5667-*p;
+  v13891=v15560*v1891-*p;
+  v12513=v7852*v13702-*p;
+  v323=v15952*v3238-*p;
+  v12115=v605*v5958-*p;
+  v19784=v9489*v7142-*p;
+  v19918=v1882*v8800-*p;
+  v18897=v14836*v8057-*p;
+  v4518=v13203*v13202-*p;
+  v13090=v8413*v8285-*p;
+  v9727=v17917*v18151-*p;
+  v13605=v1450*v4390-*p;
+  v11365=v2144*v16508-*p;
+  v17015=v10311*v8503-*p;
+  v787=v16936*v141-*p;
+  v17481=v13797*v15608-*p;
+  v18335=v2111*v2778-*p;
+  v14371=v11045*v19257-*p;
+  v14757=v2323*v14586-*p;
+  v7082=v7764*v1601-*p;
+  v3405=v9684*v6607-*p;
+  v11888=v15550*v10145-*p;
+  v16167=v15890*v11642-*p;
+  v6618=v3778*v6483-*p;
+  v8461=v16198*v18075-*p;
+  v15156=v15161*v15048-*p;
+  v2132=v10445*v18504-*p;
+  v3413=v1017*v11058-*p;
+  v9134=v3799*v4004-*p;
+  v16924=v5096*v18812-*p;
+  v18280=v18012*v19592-*p;
+  v17918=v16443*v19727-*p;
+  v3906=v16124*v7587-*p;
+  v17708=v9841*v15852-*p;
+  v19531=v2158*v15603-*p;
+  v17461=v1383*v662-*p;
+  v5062=v14748*v7595-*p;
+  v17309=v16963*v3275-*p;
+  v7406=v15732*v5412-*p;
+  v14567=v12885*v12221-*p;
+  v7627=v6984*v2086-*p;
+  v14398=v5838*v16042-*p;
+  v9505=v7019*v3597-*p;
+  v9915=v15507*v11203-*p;
+  v643=v11839*v8479-*p;
+  v14533=v16314*v13517-*p;
+  v8817=v11654*v8128-*p;
+  v18651=v16620*v18292-*p;
+  v1023=v13108*v2825-*p;
+  v2228=v476*v5259-*p;
+  v5407=v5655*v15401-*p;
+  v18525=v14489*v450-*p;
+  v8655=v6598*v10660-*p;
+  v17886=v9433*v16150-*p;
+  v7295=v1010*v2335-*p;
+  v13344=v13196*v8007-*p;
+  v19124=v6720*v4793-*p;
+  v13275=v1553*v5146-*p;
+  v8323=v6692*v1182-*p;
+  v7445=v2079*v15701-*p;
+  v17418=v18485*v16741-*p;
+  v4754=v1919*v13546-*p;
+  v10801=v14169*v5319-*p;
+  v6581=v1578*v3758-*p;
+  v9342=v13537*v1620-*p;
+  v15279=v13013*v17938-*p;
+  v12807=v8978*v12555-*p;
+  v2712=v8793*v12900-*p;
+  v16491=v12445*v5378-*p;
+  v18085=v18408*v7568-*p;
+  v19695=v17629*v13903-*p;
+  v19938=v15574*v16898-*p;
+  v19142=v3531*v9695-*p;
+  v3243=v8371*v759-*p;
+  v2181=v11127*v8417-*p;
+  v19078=v13711*v6257-*p;
+  v9076=v17727*v11594-*p;
+  v14545=v13551*v13022-*p;
+  v12179=v12302*v13733-*p;
+  v2361=v5445*v13236-*p;
+  v3767=v15114*v18468-*p;
+  v12843=v1688*v6552-*p;
+  v8290=v9822*v14525-*p;
+  v3404=v15560*v4996-*p;
+  v14976=v4298*v14537-*p;
+  v8928=v7137*v15223-*p;
+  v8950=v18279*v13605-*p;
+  v3555=v8810*v18500-*p;
+  v8146=v11143*v7809-*p;
+  v18293=v1628*v3798-*p;
+  v885=v13084*v14578-*p;
+  v5549=v12865*v4768-*p;
+  v1112=v8793*v17927-*p;
+  v9609=v18830*v5258-*p;
+  v14144=v10727*v2248-*p;
+  v8553=v19126*v16178-*p;
+  v6369=v6086*v6814-*p;
+  v2805=v3826*v17054-*p;
+  v15123=v15826*v18670-*p;
+  v14675=v1250*v2233-*p;
+  v7652=v9687*v8108-*p;
+  v15510=v6857*v461-*p;
+  v19670=v15054*v19613-*p;
+  v17995=v9976*v16183-*p;
+  v11563=v12254*v495-*p;
+  v9205=v11905*v19664-*p;
+  v17649=v10897*v5318-*p;
+  v13635=v10627*v3733-*p;
+  v13499=v7362*v11294-*p;
+  v18415=v10394*v2978-*p;
+  v12433=v15029*v12646-*p;
+  v14496=v16236*v15168-*p;
+  v2855=v18179*v9723-*p;
+  v8665=v19969*v8607-*p;
+  v16589=v6005*v15045-*p;
+  v12238=v14215*v16657-*p;
+  v17404=v8277*v16220-*p;
+  v16313=v9449*v4014-*p;
+  v10035=v14908*v12774-*p;
+  v5664=v7543*v4726-*p;
+  v9988=v15382*v5997-*p;
+  v18312=v4841*v15097-*p;
+  v8333=v5859*v10258-*p;
+  v3477=v14122*v15748-*p;
+  v3528=v12743*v5298-*p;
+  v2872=v8272*v13753-*p;
+  v5560=v1091*v489-*p;
+  v15245=v6406*v17453-*p;
+  v1351=v19180*v12750-*p;
+  v4327=v12463*v5669-*p;
+  v3035=v9854*v5414-*p;
+  v14473=v6137*v18623-*p;
+  v11014=v4615*v18255-*p;
+  v15665=v5004*v3401-*p;
+  v6318=v16567*v5066-*p;
+  v9304=v1001*v13733-*p;
+  v19352=v2212*v11673-*p;
+  v4314=v9502*v5714-*p;
+  v11772=v8539*v13990-*p;
+  v3017=v13582*v11315-*p;
+  v17446=v3292*v13442-*p;
+  v10230=v2317*v17961-*p;
+  v9828=v10430*v1856-*p;
+  v17981=v9687*v12444-*p;
+  v9155=v567*v19428-*p;
+  v15997=v17218*v6719-*p;
+  v7870=v563*v16957-*p;
+  v5884=v4539*v2337-*p;
+  v2374=v3335*v17797-*p;
+  v14545=v18819*v7256-*p;
+  v6777=v12265*v19215-*p;
+  v16018=v18845*v8755-*p;
+  v16148=v4794*v352-*p;
+  v3700=v931*v13248-*p;
+  v16037=v6420*v17801-*p;
+  v1339=v4624*v8177-*p;
+  v17250=v1160*v2512-*p;
+  v17225=v300*v12093-*p;
+  v5284=v16641*v9470-*p;
+  v10144=v5233*v12657-*p;
+  v11536=v17448*v6528-*p;
+  v13265=v462*v12312-*p;
+  v11364=v14920*v18353-*p;
+  v1930=v4251*v5176-*p;
+  v14793=v16857*v19270-*p;
+  v450=v13562*v669-*p;
+  v7837=v14990*v11572-*p;
+  v3562=v14540*v16789-*p;
+  v11447=v3169*v9726-*p;
+  v5268=v11254*v868-*p;
+  v10492=v14183*v4194-*p;
+  v12353=v12844*v11820-*p;
+  v5662=v6146*v15445-*p;
+  v9826=v15065*v9826-*p;
+  v6777=v7912*v8868-*p;
+  v13488=v13825*v14292-*p;
+  v11095=v2573*v19050-*p;
+  v1172=v13532*v6001-*p;
+  v16447=v10113*v15682-*p;
+  v13675=v9130*v8272-*p;
+  v15840=v19763*v18514-*p;
+  v9595=v7755*v8034-*p;
+  v12164=v2661*v9247-*p;
+  v13940=v231*v16683-*p;
+  v13267=v3594*v3435-*p;
+  v250=v9765*v8887-*p;
+  v19700=v16258*v6063-*p;
+  v7092=v276*v12591-*p;
+  v2348=v13534*v14717-*p;
+  v600=v14945*v12335-*p;
+  v6607=v348*v14608-*p;
+  v13625=v11405*v8096-*p;
+  v2369=v15102*v9349-*p;
+  v13358=v16103*v1211-*p;
+  v9677=v16126*v17138-*p;
+  v5418=v3102*v12122-*p;
+  v8216=v18772*v10012-*p;
+  v15638=v17706*v15862-*p;
+  v15801=v8032*v1078-*p;
+  v181=v16526*v8767-*p;
+  v4250=v15408*v4195-*p;
+  v3781=v14869*v17317-*p;
+  v7207=v7101*v15038-*p;
+  v9972=v3955*v18520-*p;
+  v9492=v16210*v11144-*p;
+  v9197=v15995*v18334-*p;
+  v4647=v14760*v18041-*p;
+  v18348=v3007*v17610-*p;
+  v8612=v16763*v4400-*p;
+  v9726=v11999*v3671-*p;
+  v13830=v8472*v15961-*p;
+  v376=v17495*v10301-*p;
+  v11569=v4047*v7498-*p;
+  v16136=v843*v913-*p;
+  v18110=v10139*v17056-*p;
+  v546=v11247*v9903-*p;
+  v5050=v102*v13876-*p;
+  v3174=v15509*v1710-*p;
+  v14457=v14994*v1369-*p;
+  v6323=v5311*v18269-*p;
+  v2048=v4006*v7714-*p;
+  v3626=v11787*v11097-*p;
+  v1118=v19117*v6521-*p;
+  v18404=v1471*v13268-*p;
+  v11749=v4729*v9964-*p;
+  v19351=v17306*v2773-*p;
+  v13207=v17844*v7711-*p;
+  v11151=v8536*v11502-*p;
+  v10688=v13382*v98-*p;
+  v17752=v10116*v15929-*p;
+  v16803=v9612*v9006-*p;
+  v19390=v19377*v6192-*p;
+  v17242=v16161*v7221-*p;
+  v1120=v15608*v2370-*p;
+  v7452=v8379*v6163-*p;
+  v4289=v4689*v1028-*p;
+  v7605=v2397*v4051-*p;
+  v2952=v991*v1171-*p;
+  v14060=v5655*v1591-*p;
+  v11871=v16429*v15996-*p;
+  v15260=v2492*v4792-*p;
+  v10700=v1988*v11059-*p;
+  v2=v7206*v7653-*p;
+  v12353=v10689*v16774-*p;
+  v798=v2554*v6405-*p;
+  v2274=v15461*v6148-*p;
+  v11636=v10685*v6703-*p;
+  v2493=v8298*v15581-*p;
+  v5707=v9773*v5603-*p;
+  v350=v8792*v14186-*p;
+  v13280=v10439*v14535-*p;
+  v10584=v19269*v6474-*p;
+  v1272=v2440*v9164-*p;
+  v14445=v16936*v7196-*p;
+  v9442=v14809*v12807-*p;
+  v6792=v492*v13293-*p;
+  v13257=v18698*v12101-*p;
+  v19499=v13194*v16260-*p;
+  v7056=v12036*v1267-*p;
+  v2022=v17499*v17220-*p;
+  v14749=v18347*v14375-*p;
+  v5900=v4331*v10469-*p;
+  v6494=v18698*v16723-*p;
+  v8805=v733*v19899-*p;
+  v13306=v2900*v2899-*p;
+  v13335=v16234*v5063-*p;
+  v14987=v8541*v18427-*p;
+  v15631=v3981*v15558-*p;
+  v12437=v15892*v10445-*p;
+  v18586=v10921*v10173-*p;
+  v13660=v15173*v9256-*p;
+  v16722=v9048*v10484-*p;
+  v19144=v13260*v18729-*p;
+  v5294=v18622*v16245-*p;
+  v7617=v4977*v18355-*p;
+  v6993=v3718*v2144-*p;
+  v12078=v10185*v869-*p;
+  v2382=v5877*v8563-*p;
+  v16337=v18230*v9553-*p;
+  v8721=v15582*v2478-*p;
+  v3376=v188*v12928-*p;
+  v12105=v5324*v12443-*p;
+  v14981=v5148*v12786-*p;
+  v3910=v1953*v17198-*p;
+  v16572=v898*v18435-*p;
+  v16301=v2402*v2801-*p;
+  v6706=v5354*v10455-*p;
+  v5833=v9794*v10713-*p;
+  v17820=v16161*v15466-*p;
+  v7930=v3827*v15283-*p;
+  v13910=v13201*v18136-*p;
+  v7226=v12533*v16019-*p;
+  v18537=v10972*v7693-*p;
+  v19819=v17602*v13047-*p;
+  v17729=v11883*v2108-*p;
+  v18272=v8653*v6399-*p;
+  v10047=v12146*v8114-*p;
+  v13474=v8471*v9075-*p;
+  v7099=v1052*v9763-*p;
+  v17600=v2853*v1151-*p;
+  v10941=v7285*v1635-*p;
+  v12406=v15098*v6082-*p;
+  v12319=v945*v8740-*p;
+  v7436=v19509*v8720-*p;
+  v9662=v3046*v13244-*p;
+  v9495=v13303*v16148-*p;
+  v14836=v13178*v9002-*p;
+  v8282=v9786*v8817-*p;
+  v19459=v10230*v13578-*p;
+  v2815=v19005*v4728-*p;
+  v754=v15196*v14333-*p;
+  v9715=v18251*v3355-*p;
+  v16468=v1352*v511-*p;
+  v16221=v15835*v4366-*p;
+  v14242=v9200*v19197-*p;
+  v14356=v7443*v3561-*p;
+  v16980=v10642*v4830-*p;
+  v6997=v18551*v7820-*p;
+  v17763=v14174*v12503-*p;
+  v5866=v15756*v17631-*p;
+  v12784=v5546*v3688-*p;
+  v6481=v642*v8038-*p;
+  v18145=v19978*v18717-*p;
+  v2944=v12655*v16595-*p;
+  v15374=v12700*v12353-*p;
+  v17787=v3059*v18188-*p;
+  v6002=v3618*v15291-*p;
+  v17283=v3298*v1814-*p;
+  v7509=v6537*v5416-*p;
+  v13231=v3621*v19468-*p;
+  v529=v12401*v9751-*p;
+  v8133=v17263*v532-*p;
+  v6781=v12528*v12718-*p;
+  v4953=v507*v17912-*p;
+  v18723=v14741*v17303-*p;
+  v18135=v2506*v5198-*p;
+  v10088=v4251*v18491-*p;
+  v9680=v14435*v1339-*p;
+  v1818=v11423*v17239-*p;
+  v18469=v15921*v9905-*p;
+  v1314=v9506*v11437-*p;
+  v2326=v9739*v9037-*p;
+  v1532=v17060*v16560-*p;
+  v5094=v698*v1678-*p;
+  v18954=v792*v7370-*p;
+  v11528=v6388*v4094-*p;
+  v1618=v769*v12004-*p;
+  v1440=v6373*v5529-*p;
+  v12596=v1727*v14686-*p;
+  v9925=v16154*v4994-*p;
+  v6557=v17498*v11012-*p;
+  v7634=v12064*v5551-*p;
+  v12118=v11139*v5634-*p;
+  v3108=v3943*v4373-*p;
+  v19654=v18926*v14652-*p;
+  v13582=v14664*v19190-*p;
+  v18226=v17114*v10610-*p;
+  v3213=v10743*v12582-*p;
+  v10303=v13691*v2525-*p;
+  v13635=v17677*v4347-*p;
+  v525=v1191*v5841-*p;
+  v4519=v4908*v18929-*p;
+  v11831=v5050*v4821-*p;
+  v7760=v18644*v2631-*p;
+  v1627=v9368*v2316-*p;
+  v2184=v12608*v15137-*p;
+  v13143=v8189*v13943-*p;
+  v14016=v6272*v15190-*p;
+  v12607=v14321*v11789-*p;
+  v10012=v14072*v6686-*p;
+  v8545=v4703*v19842-*p;
+  v17635=v12179*v8190-*p;
+  v1446=v14762*v18641-*p;
+  v9530=v7646*v2226-*p;
+  v10712=v5912*v15924-*p;
+  v8320=v3665*v10410-*p;
+  v232=v3935*v17088-*p;
+  v19901=v227*v8424-*p;
+  v5113=v8629*v8008-*p;
+  v8708=v17248*v15804-*p;
+  v7982=v6665*v8676-*p;
+  v4560=v10016*v17416-*p;
+  v8368=v6143*v17002-*p;
+  v3343=v9807*v13669-*p;
+  v10653=v11070*v19420-*p;
+  v8985=v3893*v6584-*p;
+  v18178=v8365*v2354-*p;
+  v5743=v11804*v1064-*p;
+  v7975=v7909*v1545-*p;
+  v8183=v18334*v2188-*p;
+  v15631=v6223*v14599-*p;
+  v18775=v4866*v16026-*p;
+  v17658=v14774*v4661-*p;
+  v10112=v5289*v17067-*p;
+  v16771=v12828*v11320-*p;
+  v6790=v14449*v3219-*p;
+  v15839=v17834*v8949-*p;
+  v9891=v12848*v5430-*p;
+  v3455=v13212*v2507-*p;
+  v5051=v11472*v6438-*p;
+  v14665=v7450*v7100-*p;
+  v14215=v8615*v16946-*p;
+  v5366=v15711*v1845-*p;
+  v4931=v15106*v9181-*p;
+  v6445=v10250*v3648-*p;
+  v11158=v4366*v2063-*p;
+  v13700=v5636*v4381-*p;
+  v12107=v3197*v15991-*p;
+  v14694=v19676*v4483-*p;
+  v6043=v2182*v13440-*p;
+  v12553=v19097*v16642-*p;
+  v14694=v10006*v2339-*p;
+  v286=v5646*v1605-*p;
+  v7670=v8198*v18009-*p;
+  v13746=v16859*v13919-*p;
+  v12917=v7022*v11387-*p;
+  v6644=v14869*v3776-*p;
+  v4437=v1743*v8608-*p;
+  v11935=v15182*v19751-*p;
+  v1875=v9917*v2692-*p;
+  v3100=v11285*v12862-*p;
+  v1326=v467*v3727-*p;
+  v7742=v5877*v12473-*p;
+  v11612=v13827*v9434-*p;
+  v16623=v19447*v9551-*p;
+  v14210=v537*v5411-*p;
+  v1600=v3175*v17800-*p;
+  v15125=v7833*v7145-*p;
+  v2917=v3386*v12692-*p;
+  v11784=v16301*v11044-*p;
+  v3883=v14266*v5-*p;
+  v5321=v1173*v3293-*p;
+  v10014=v16273*v858-*p;
+  v18769=v3150*v12023-*p;
+  v3395=v19207*v1299-*p;
+  v4547=v471*v12462-*p;
+  v15176=v7244*v8800-*p;
+  v16498=v16821*v12152-*p;
+  v11150=v9742*v16580-*p;
+  v6182=v16547*v3435-*p;
+  v18492=v3376*v2652-*p;
+  v19038=v18311*v19810-*p;
+  v17772=v18471*v12590-*p;
+  v19343=v1305*v13170-*p;
+  v7578=v2041*v14884-*p;
+  v351=v9749*v10424-*p;
+  v9998=v19038*v11144-*p;
+  v6344=v5104*v944-*p;
+  v12487=v5003*v14532-*p;
+  v1892=v10918*v18149-*p;
+  v17788=v16496*v10400-*p;
+  v17509=v16305*v15921-*p;
+  v3335=v2258*v14192-*p;
+  v4739=v1830*v12109-*p;
+  v3826=v8790*v10505-*p;
+  v12055=v9491*v8420-*p;
+  v68=v7833*v2616-*p;
+  v18131=v16943*v17878-*p;
+  v8400=v182*v14700-*p;
+  v14019=v19886*v18632-*p;
+  v3531=v15709*v761-*p;
+  v1225=v13818*v5140-*p;
+  v12944=v4042*v10209-*p;
+  v10007=v12599*v8070-*p;
+  v15453=v7062*v7308-*p;
+  v12662=v16086*v12465-*p;
+  v16220=v12332*v12833-*p;
+  v17062=v5794*v4496-*p;
+  v13385=v14420*v744-*p;
+  v5517=v4464*v15757-*p;
+  v18987=v15942*v1613-*p;
+  v8717=v5327*v152-*p;
+  v15078=v7002*v9057-*p;
+  v6277=v2639*v6853-*p;
+  v16266=v19878*v11454-*p;
+  v10683=v16188*v4796-*p;
+  v8482=v18479*v4331-*p;
+  v13495=v13259*v17584-*p;
+  v1087=v17484*v2996-*p;
+  v18585=v1128*v854-*p;
+  v13789=v6564*v16243-*p;
+  v7911=v18703*v15260-*p;
+  v6770=v18668*v5361-*p;
+  v12090=v18838*v16255-*p;
+  v15514=v15299*v2333-*p;
+  v9339=v12848*v12852-*p;
+  v146=v9182*v3396-*p;
+  v10841=v4260*v14005-*p;
+  v1774=v3578*v12487-*p;
+  v15142=v14794*v194-*p;
+  v9145=v13718*v2643-*p;
+  v14086=v18885*v13691-*p;
+  v13918=v13494*v18841-*p;
+  v10536=v2916*v4105-*p;
+  v8896=v15452*v8776-*p;
+  v14147=v19967*v3587-*p;
+  v16566=v4615*v11181-*p;
+  v4573=v15044*v10301-*p;
+  v12867=v18703*v16762-*p;
+  v7044=v5029*v18483-*p;
+  v9971=v4455*v377-*p;
+  v7163=v18960*v6849-*p;
+  v5737=v10812*v12575-*p;
+  v697=v17860*v11797-*p;
+  v9724=v19987*v12224-*p;
+  v415=v12928*v15886-*p;
+  v13615=v8112*v17831-*p;
+  v14699=v5108*v7130-*p;
+  v15984=v3954*v9147-*p;
+  v13959=v8516*v18430-*p;
+  v17577=v7950*v7036-*p;
+  v9579=v516*v11832-*p;
+  v17978=v6911*v15475-*p;
+  v6173=v8374*v16106-*p;
+  v5342=v19258*v19749-*p;
+  v3688=v16830*v19329-*p;
+  v19374=v12024*v2199-*p;
+  v17455=v7869*v12162-*p;
+  v3422=v12180*v4910-*p;
+  v19971=v15844*v4417-*p;
+  v12545=v11453*v5023-*p;
+  v14402=v6315*v3104-*p;
+  v12103=v4646*v12618-*p;
+  v15026=v8452*v16592-*p;
+  v12909=v3359*v5501-*p;
+  v4693=v15012*v5670-*p;
+  v2939=v4369*v1100-*p;
+  v9662=v11839*v7702-*p;
+  v2847=v10620*v4183-*p;
+  v14303=v9107*v19259-*p;
+  v15600=v13600*v3319-*p;
+  v156=v19769*v2489-*p;
+  v6856=v12825*v12757-*p;
+  v18461=v16854*v18042-*p;
+  v17966=v9231*v10568-*p;
+  v12898=v10248*v6664-*p;
+  v10199=v6025*v3904-*p;
+  v3542=v12459*v9382-*p;
+  v2097=v2994*v12175-*p;
+  v8315=v4343*v12039-*p;
+  v6211=v18548*v11657-*p;
+  v14641=v4733*v9612-*p;
+  v7915=v11689*v9056-*p;
+  v6805=v14227*v205-*p;
+  v3196=v12179*v12556-*p;
+  v15053=v12282*v2196-*p;
+  v2502=v5813*v9235-*p;
+  v11160=v13136*v7783-*p;
+  v6897=v14900*v19261-*p;
+  v11009=v3825*v8847-*p;
+  v2916=v5478*v4895-*p;
+  v16230=v3311*v18596-*p;
+  v19377=v13579*v9137-*p;
+  v7854=v913*v15379-*p;
+  v16567=v603*v15558-*p;
+  v7182=v4317*v9975-*p;
+  v18934=v2739*v13403-*p;
+  v6053=v4110*v13903-*p;
+  v6381=v16910*v8869-*p;
+  v11024=v2920*v11536-*p;
+  v1436=v8194*v13770-*p;
+  v16598=v9835*v11852-*p;
+  v11608=v13602*v9095-*p;
+  v13548=v1992*v1296-*p;
+  v17850=v18136*v4212-*p;
+  v15455=v8033*v11670-*p;
+  v9929=v13508*v10523-*p;
+  v7045=v10326*v15733-*p;
+  v16459=v3482*v15855-*p;
+  v154=v1638*v16295-*p;
+  v16829=v1331*v9118-*p;
+  v17332=v5496*v4029-*p;
+  v9584=v13568*v342-*p;
+  v8781=v18332*v11004-*p;
+  v1497=v18703*v12268-*p;
+  v11657=v13018*v18073-*p;
+  v17368=v298*v18479-*p;
+  v19221=v3200*v88-*p;
+  v17823=v3801*v14762-*p;
+  v15319=v2690*v16826-*p;
+  v12731=v18298*v1937-*p;
+  v12700=v1617*v14214-*p;
+  v5722=v8067*v5954-*p;
+  v9578=v8538*v4844-*p;
+  v3917=v14532*v2982-*p;
+  v13021=v2569*v9692-*p;
+  v3067=v8355*v13493-*p;
+  v1097=v5556*v5660-*p;
+  v3410=v6363*v15344-*p;
+  v2863=v14606*v1905-*p;
+  v19362=v366*v470-*p;
+  v8602=v1686*v12504-*p;
+  v11351=v1975*v2163-*p;
+  v17830=v14645*v3228-*p;
+  v10580=v18350*v11159-*p;
+  v5568=v16367*v12651-*p;
+  v16504=v19509*v15135-*p;
+  v11440=v2966*v10283-*p;
+  v8491=v12694*v4651-*p;
+  v164=v16939*v16550-*p;
+  v1099=v11726*v3683-*p;
+  v18250=v3622*v7924-*p;
+  v53=v11186*v8012-*p;
+  v15902=v15335*v9552-*p;
+  v13588=v19168*v5151-*p;
+  v18560=v14299*v19426-*p;
+  v15507=v18575*v7215-*p;
+  v19763=v14527*v5569-*p;
+  v14110=v1852*v11038-*p;
+  v15121=v3854*v3960-*p;
+  v10008=v8685*v18913-*p;
+  v5388=v13245*v16214-*p;
+  v86=v10004*v2029-*p;
+  v11498=v19622*v10515-*p;
+  v785=v12968*v19605-*p;
+  v1902=v8773*v18592-*p;
+  v13632=v1863*v15013-*p;
+  v10551=v4106*v15916-*p;
+  v7523=v13610*v6860-*p;
+  v17515=v2328*v19295-*p;
+  v19338=v16379*v884-*p;
+  v7109=v5594*v9181-*p;
+  v4475=v5430*v2054-*p;
+  v2748=v2814*v18106-*p;
+  v13412=v6818*v10194-*p;
+  v8165=v11639*v730-*p;
+  v2856=v19159*v2180-*p;
+  v5060=v13533*v19902-*p;
+  v7260=v16305*v10786-*p;
+  v3808=v5566*v10702-*p;
+  v17148=v3082*v12561-*p;
+  v7690=v13431*v16245-*p;
+  v6404=v18994*v3076-*p;
+  v18019=v18514*v6220-*p;
+  v1823=v1324*v13615-*p;
+  v1076=v19635*v16263-*p;
+  v2334=v13520*v9947-*p;
+  v1850=v2250*v15504-*p;
+  v15324=v5168*v19808-*p;
+  v5690=v2010*v10512-*p;
+  v11284=v17031*v9809-*p;
+  v1319=v7998*v9427-*p;
+  v1884=v13919*v4583-*p;
+  v8777=v9181*v8358-*p;
+  v12051=v13061*v15487-*p;
+  v1782=v13161*v18334-*p;
+  v4657=v13592*v18249-*p;
+  v10282=v14060*v5298-*p;
+  v18963=v2464*v18265-*p;
+  v3592=v364*v7547-*p;
+  v6050=v1432*v1687-*p;
+  v19910=v2021*v15187-*p;
+  v4642=v7383*v9264-*p;
+  v13396=v11920*v11282-*p;
+  v11018=v14213*v16259-*p;
+  v12817=v7358*v909-*p;
+  v14458=v18256*v13601-*p;
+  v13421=v4518*v8939-*p;
+  v6506=v5994*v17320-*p;
+  v15515=v13485*v2873-*p;
+  v16829=v10601*v12488-*p;
+  v7831=v3674*v19476-*p;
+  v19575=v15588*v9700-*p;
+  v6479=v4682*v2810-*p;
+  v13182=v11253*v3956-*p;
+  v11176=v4894*v19096-*p;
+  v13830=v14945*v9325-*p;
+  v13975=v3396*v15414-*p;
+  v14081=v16420*v8654-*p;
+  v12369=v4983*v17009-*p;
+  v17359=v17819*v19707-*p;
+  v3467=v5637*v1319-*p;
+  v18485=v4750*v16256-*p;
+  v11347=v14999*v1688-*p;
+  v13405=v16685*v4911-*p;
+  v18620=v14953*v10238-*p;
+  v10674=v5260*v13275-*p;
+  v16798=v8103*v18959-*p;
+  v8427=v9258*v4959-*p;
+  v2167=v18287*v19841-*p;
+  v15525=v19564*v1625-*p;
+  v19141=v9371*v6835-*p;
+  v7639=v18714*v6729-*p;
+  v9133=v4481*v18585-*p;
+  v17416=v10949*v19353-*p;
+  v17593=v18849*v1565-*p;
+  v14978=v2796*v4575-*p;
+  v13308=v6735*v12290-*p;
+  v19929=v16177*v19709-*p;
+  v14464=v3394*v14969-*p;
+  v14793=v7892*v11564-*p;
+  v17904=v3054*v1635-*p;
+  v6494=v2747*v19533-*p;
+  v8916=v9054*v14101-*p;
+  v14300=v15959*v2718-*p;
+  v14492=v14756*v6291-*p;
+  v10137=v10817*v12721-*p;
+  v7533=v10398*v18436-*p;
+  v19559=v1937*v15367-*p;
+  v3424=v19968*v11678-*p;
+  v15715=v17938*v5826-*p;
+  v409=v17272*v7828-*p;
+  v1529=v16050*v6369-*p;
+  v18931=v5863*v4066-*p;
+  v9876=v5874*v12805-*p;
+  v2324=v4453*v18579-*p;
+  v14360=v12323*v9889-*p;
+  v168=v2778*v15736-*p;
+  v8473=v19093*v6358-*p;
+  v4120=v17609*v17430-*p;
+  v212=v9570*v12710-*p;
+  v4300=v746*v3887-*p;
+  v13743=v8563*v16401-*p;
+  v8987=v10002*v14476-*p;
+  v12244=v6592*v13862-*p;
+  v1605=v2303*v821-*p;
+  v11939=v13808*v11652-*p;
+  v7840=v2327*v5819-*p;
+  v16662=v6493*v13998-*p;
+  v10305=v13164*v11918-*p;
+  v997=v15054*v14539-*p;
+  v9559=v19463*v13356-*p;
+  v12307=v13187*v19573-*p;
+  v9704=v17657*v4088-*p;
+  v10201=v14457*v4923-*p;
+  v5542=v5919*v5454-*p;
+  v15913=v5113*v17719-*p;
+  v16841=v9444*v12595-*p;
+  v19761=v12215*v1571-*p;
+  v12164=v19201*v1840-*p;
+  v7217=v1798*v10253-*p;
+  v788=v16548*v15362-*p;
+  v13099=v4865*v3997-*p;
+  v194=v5518*v5448-*p;
+  v12110=v69*v18738-*p;
+  v18025=v10791*v2984-*p;
+  v6166=v12495*v8874-*p;
+  v12528=v13133*v18505-*p;
+  v12959=v13443*v13772-*p;
+  v9491=v4021*v10412-*p;
+  v17757=v11072*v1751-*p;
+  v388=v1754*v11080-*p;
+  v9208=v5918*v19070-*p;
+  v11365=v16859*v16032-*p;
+  v14916=v10717*v13283-*p;
+  v4347=v7760*v410-*p;
+  v65=v290*v19834-*p;
+  v10552=v12856*v8435-*p;
+  v3974=v4012*v9214-*p;
+  v18141=v5694*v1759-*p;
+  v12106=v14082*v17672-*p;
+  v9199=v19947*v6549-*p;
+  v12773=v3370*v10753-*p;
+  v14477=v16393*v14294-*p;
+  v16989=v12330*v16178-*p;
+  v16406=v18647*v3964-*p;
+  v10642=v18510*v14521-*p;
+  v11848=v8697*v18790-*p;
+  v10928=v12342*v7589-*p;
+  v19910=v2903*v19624-*p;
+  v10709=v10504*v12700-*p;
+  v8294=v16036*v9247-*p;
+  v7666=v17360*v4358-*p;
+  v312=v17927*v1896-*p;
+  v15599=v17426*v10808-*p;
+  v10644=v18928*v8931-*p;
+  v14913=v17538*v4020-*p;
+  v3020=v9179*v7541-*p;
+  v3764=v8018*v12553-*p;
+  v5863=v4839*v13634-*p;
+  v12989=v5794*v4876-*p;
+  v12090=v14956*v12431-*p;
+  v6003=v1744*v13688-*p;
+  v7885=v10479*v3110-*p;
+  v9015=v1580*v13876-*p;
+  v7365=v2040*v11024-*p;
+  v19820=v17365*v6166-*p;
+  v4962=v16113*v12705-*p;
+  v11275=v4133*v10945-*p;
+  v3976=v15823*v6582-*p;
+  v1562=v7610*v16259-*p;
+  v6758=v14984*v3570-*p;
+  v1805=v7273*v5639-*p;
+  v11360=v10339*v6580-*p;
+  v2979=v7575*v5193-*p;
+  v14057=v17418*v13100-*p;
+  v12812=v8101*v17903-*p;
+  v15183=v5435*v14976-*p;
+  v11845=v10638*v9642-*p;
+  v507=v14836*v19376-*p;
+  v9680=v6565*v251-*p;
+  v634=v1894*v1513-*p;
+  v2446=v11445*v17543-*p;
+  v9887=v16589*v178-*p;
+  v9531=v6863*v5446-*p;
+  v14335=v13015*v6222-*p;
+  v14664=v7978*v4120-*p;
+  v19143=v1039*v14210-*p;
+  v17850=v16073*v11661-*p;
+  v17161=v1107*v6595-*p;
+  v3577=v18394*v3224-*p;
+  v9848=v19635*v8899-*p;
+  v16864=v10865*v17030-*p;
+  v17765=v12316*v6761-*p;
+  v2657=v4818*v8401-*p;
+  v10176=v17453*v11934-*p;
+  v277=v11199*v2818-*p;
+  v9593=v11931*v2613-*p;
+  v10886=v10588*v10807-*p;
+  v3749=v9792*v6342-*p;
+  v10593=v4602*v10903-*p;
+  v11140=v7918*v17984-*p;
+  v10189=v10903*v3604-*p;
+  v1460=v4534*v4632-*p;
+  v10926=v5473*v19973-*p;
+  v8060=v1604*v5037-*p;
+  v13388=v3381*v8012-*p;
+  v12838=v13232*v17943-*p;
+  v1304=v8921*v12191-*p;
+  v1531=v19459*v1877-*p;
+  v8242=v571*v9152-*p;
+  v10592=v7917*v14414-*p;
+  v10155=v5333*v12073-*p;
+  v3175=v1735*v9378-*p;
+  v2201=v3458*v14149-*p;
+  v15800=v16352*v12947-*p;
+  v7272=v881*v12059-*p;
+  v133=v13786*v4522-*p;
+  v10840=v17887*v7361-*p;
+  v16541=v16284*v8304-*p;
+  v10669=v8030*v738-*p;
+  v13309=v3148*v5110-*p;
+  v13346=v496*v8750-*p;
+  v4242=v9459*v15646-*p;
+  v2908=v19549*v18985-*p;
+  v11161=v15309*v1619-*p;
+  v8842=v10857*v4922-*p;
+  v9835=v7890*v13102-*p;
+  v16757=v10269*v8684-*p;
+  v6874=v4049*v817-*p;
+  v10181=v3853*v4192-*p;
+  v1693=v14357*v14790-*p;
+  v19364=v37*v7086-*p;
+  v181=v19110*v16096-*p;
+  v10695=v899*v9295-*p;
+  v16085=v19966*v9075-*p;
+  v6484=v7810*v442-*p;
+  v4318=v8635*v15314-*p;
+  v6924=v1004*v9049-*p;
+  v101=v12923*v18085-*p;
+  v11476=v5179*v12142-*p;
+  v552=v18937*v940-*p;
+  v7890=v10069*v4658-*p;
+  v12950=v14555*v6515-*p;
+  v4444=v4490*v18681-*p;
+  v5807=v2283*v6267-*p;
+  v4840=v19514*v2365-*p;
+  v708=v11571*v19596-*p;
+  v5862=v10486*v19928-*p;
+  v2780=v7914*v16609-*p;
+  v6372=v2497*v16785-*p;
+  v16481=v9523*v11397-*p;
+  v19314=v12127*v15928-*p;
+  v1369=v3486*v14376-*p;
+  v2843=v10753*v7721-*p;
+  v15064=v19900*v13090-*p;
+  v2455=v9680*v4904-*p;
+  v6220=v7023*v11349-*p;
+  v11613=v4349*v8378-*p;
+  v14677=v12025*v7272-*p;
+  v16560=v2838*v15300-*p;
+  v7666=v3721*v14841-*p;
+  v10769=v2543*v1669-*p;
+  v13553=v11240*v9735-*p;
+  v16617=v15068*v1778-*p;
+  v3578=v12363*v11225-*p;
+  v11633=v18065*v18342-*p;
+  v6831=v18483*v932-*p;
+  v5495=v2312*v14206-*p;
+  v14708=v18765*v3759-*p;
+  v10351=v1704*v13321-*p;
+  v721=v13342*v19136-*p;
+  v12921=v17262*v13840-*p;
+  v6529=v3501*v16206-*p;
+  v8578=v19779*v7414-*p;
+  v6292=v9977*v8265-*p;
+  v14958=v9798*v3122-*p;
+  v5972=v3723*v14825-*p;
+  v1695=v9507*v15519-*p;
+  v777=v16780*v17403-*p;
+  v3931=v17588*v15306-*p;
+  v448=v17175*v8901-*p;
+  v19065=v3911*v3027-*p;
+  v12418=v13281*v2030-*p;
+  v2237=v18675*v16721-*p;
+  v19009=v2825*v19828-*p;
+  v1888=v12189*v247-*p;
+  v13872=v2005*v18870-*p;
+  v15276=v474*v11653-*p;
+  v8824=v5661*v17176-*p;
+  v3110=v5536*v19842-*p;
+  v19321=v645*v2454-*p;
+  v3788=v15669*v14787-*p;
+  v2620=v13061*v4833-*p;
+  v18373=v15191*v8788-*p;
+  v11553=v19751*v13674-*p;
+  v18592=v1870*v11296-*p;
+  v1170=v16568*v2260-*p;
+  v5738=v14959*v3126-*p;
+  v9525=v14635*v10191-*p;
+  v4850=v933*v231-*p;
+  v6404=v12988*v8151-*p;
+  v7681=v12625*v8008-*p;
+  v8751=v10422*v11740-*p;
+  v17158=v13515*v17071-*p;
+  v19642=v11385*v5431-*p;
+  v10607=v12351*v19671-*p;
+  v15745=v15784*v369-*p;
+  v11669=v11073*v6225-*p;
+  v7644=v7259*v16147-*p;
+  v12087=v19229*v7307-*p;
+  v13164=v12626*v9699-*p;
+  v12301=v18267*v18337-*p;
+  v18954=v16036*v18831-*p;
+  v10241=v10585*v8123-*p;
+  v5192=v15559*v7849-*p;
+  v14066=v17823*v18732-*p;
+  v9558=v18855*v2398-*p;
+  v3643=v14989*v14429-*p;
+  v19728=v1221*v6595-*p;
+  v13588=v5101*v17181-*p;
+  v13067=v4631*v16107-*p;
+  v15261=v18044*v17539-*p;
+  v3427=v4099*v1369-*p;
+  v16271=v14709*v14540-*p;
+  v17706=v17988*v6438-*p;
+  v18892=v13309*v5248-*p;
+  v10578=v18032*v7455-*p;
+  v1598=v10786*v9523-*p;
+  v7736=v3048*v8256-*p;
+  v16084=v19218*v8766-*p;
+  v8902=v14375*v3872-*p;
+  v5216=v3823*v10021-*p;
+  v6704=v3132*v11661-*p;
+  v3914=v15561*v17212-*p;
+  v8069=v3615*v10094-*p;
+  v13935=v7426*v7546-*p;
+  v11114=v798*v5334-*p;
+  v18574=v4127*v9801-*p;
+  v15667=v2334*v19111-*p;
+  v19620=v12668*v4076-*p;
+  v3702=v5941*v1055-*p;
+  v18936=v18971*v19352-*p;
+  v15132=v6598*v17917-*p;
+  v1320=v8980*v15686-*p;
+  v15079=v10280*v11545-*p;
+  v5489=v10809*v16376-*p;
+  v5303=v8518*v9933-*p;
+  v3132=v15611*v17381-*p;
+  v5971=v18362*v9698-*p;
+  v17252=v4337*v8379-*p;
+  v11908=v17108*v15374-*p;
+  v17996=v10214*v9692-*p;
+  v14463=v15078*v6425-*p;
+  v947=v3358*v9637-*p;
+  v13386=v15413*v6481-*p;
+  v638=v305*v15816-*p;
+  v903=v9624*v9723-*p;
+  v16292=v958*v14215-*p;
+  v12566=v1414*v4634-*p;
+  v2817=v14207*v16018-*p;
+  v14699=v13180*v937-*p;
+  v9249=v11869*v18006-*p;
+  v7335=v1176*v18923-*p;
+  v10446=v7289*v11047-*p;
+  v16597=v12767*v16240-*p;
+  v5744=v9668*v7531-*p;
+  v2410=v13037*v3295-*p;
+  v5982=v10618*v2740-*p;
+  v7483=v16642*v10048-*p;
+  v9378=v19554*v3044-*p;
+  v201=v11779*v10086-*p;
+  v10115=v14995*v15155-*p;
+  v2457=v9451*v7742-*p;
+  v6780=v18590*v1819-*p;
+  v2396=v16506*v13169-*p;
+  v1862=v3689*v12642-*p;
+  v10885=v5193*v6524-*p;
+  v13110=v818*v15760-*p;
+  v18659=v18084*v19853-*p;
+  v1674=v6465*v16147-*p;
+  v817=v17241*v12605-*p;
+  v15614=v17339*v3671-*p;
+  v7996=v13977*v10407-*p;
+  v5628=v10410*v5578-*p;
+  v8841=v3221*v9923-*p;
+  v1250=v17890*v607-*p;
+  v7562=v10489*v8827-*p;
+  v4203=v11898*v11881-*p;
+  v17114=v19823*v19891-*p;
+  v14459=v6607*v12759-*p;
+  v7708=v4744*v18528-*p;
+  v9241=v521*v5696-*p;
+  v10862=v12691*v4536-*p;
+  v10181=v4021*v7779-*p;
+  v9981=v5384*v19218-*p;
+  v11125=v19715*v9907-*p;
+  v4787=v7719*v5509-*p;
+  v19156=v7625*v10244-*p;
+  v13484=v5123*v11259-*p;
+  v3610=v18554*v13380-*p;
+  v7033=v12240*v2994-*p;
+  v10288=v18457*v15260-*p;
+  v6468=v10432*v1001-*p;
+  v10791=v9616*v14471-*p;
+  v10444=v19157*v18842-*p;
+  v4557=v5298*v15343-*p;
+  v9039=v1386*v1187-*p;
+  v4886=v19715*v5397-*p;
+  v18792=v14530*v12453-*p;
+  v7462=v9058*v9970-*p;
+  v14416=v11568*v5274-*p;
+  v8765=v7170*v6406-*p;
+  v17677=v16674*v6616-*p;
+  v56=v169*v482-*p;
+  v18296=v9046*v15678-*p;
+  v3999=v16625*v4536-*p;
+  v11631=v4568*v3614-*p;
+  v7868=v1660*v2218-*p;
+  v2593=v2987*v3129-*p;
+  v19218=v15560*v9062-*p;
+  v1832=v10213*v4973-*p;
+  v2092=v10849*v634-*p;
+  v11544=v9993*v6753-*p;
+  v8780=v9160*v13802-*p;
+  v206=v17710*v6826-*p;
+  v164=v14530*v10484-*p;
+  v3689=v7074*v9123-*p;
+  v912=v4589*v7914-*p;
+  v13612=v5265*v12676-*p;
+  v14674=v14436*v3874-*p;
+  v18748=v16967*v14185-*p;
+  v2803=v18664*v7332-*p;
+  v1167=v3768*v8456-*p;
+  v12426=v18869*v9745-*p;
+  v13252=v7779*v3150-*p;
+  v4650=v4126*v9380-*p;
+  v19908=v12000*v12663-*p;
+  v10560=v3815*v13373-*p;
+  v7460=v18318*v11722-*p;
+  v14051=v6707*v5598-*p;
+  v11233=v217*v15385-*p;
+  v6832=v10209*v4208-*p;
+  v16172=v10768*v5059-*p;
+  v11238=v19195*v17447-*p;
+  v3658=v7590*v16788-*p;
+  v5419=v19296*v13822-*p;
+  v8175=v2478*v10420-*p;
+  v15658=v9727*v16340-*p;
+  v11191=v15490*v5195-*p;
+  v7068=v1955*v14879-*p;
+  v12231=v16499*v1617-*p;
+  v2768=v16527*v2586-*p;
+  v19544=v6644*v5211-*p;
+  v19908=v7538*v17656-*p;
+  v4045=v7944*v15431-*p;
+  v15459=v10860*v2999-*p;
+  v8672=v4333*v8942-*p;
+  v16578=v16352*v17782-*p;
+  v7234=v6454*v3523-*p;
+  v8786=v14122*v7207-*p;
+  v8361=v8070*v16417-*p;
+  v2719=v14089*v16282-*p;
+  v3867=v3647*v2203-*p;
+  v8325=v5196*v270-*p;
+  v19311=v14317*v13847-*p;
+  v9638=v19536*v10638-*p;
+  v1090=v14247*v12445-*p;
+  v13598=v15260*v5142-*p;
+  v1738=v11739*v9931-*p;
+  v10269=v11821*v17791-*p;
+  v3773=v13621*v5536-*p;
+  v15128=v8174*v1166-*p;
+  v2587=v10983*v14982-*p;
+  v19686=v3154*v11637-*p;
+  v16550=v14913*v10398-*p;
+  v1562=v18882*v14296-*p;
+  v5391=v1435*v14163-*p;
+  v16152=v11879*v13607-*p;
+  v5887=v12540*v591-*p;
+  v11729=v17489*v17009-*p;
+  v6495=v14155*v9463-*p;
+  v19793=v12285*v6439-*p;
+  v14573=v12296*v15123-*p;
+  v18262=v19917*v9381-*p;
+  v4982=v10302*v9363-*p;
+  v56=v4529*v12672-*p;
+  v5721=v18306*v11627-*p;
+  v4234=v5675*v8854-*p;
+  v10540=v9773*v9885-*p;
+  v1262=v7786*v4264-*p;
+  v50=v11361*v15207-*p;
+  v6751=v18996*v1018-*p;
+  v4093=v18829*v11768-*p;
+  v1067=v11819*v16122-*p;
+  v17766=v16385*v2337-*p;
+  v9343=v14804*v2702-*p;
+  v2827=v14338*v8719-*p;
+  v8738=v4599*v8411-*p;
+  v19564=v5719*v19463-*p;
+  v17098=v18993*v10719-*p;
+  v18942=v6218*v11613-*p;
+  v18067=v16621*v4267-*p;
+  v2144=v17758*v3608-*p;
+  v11950=v16118*v10711-*p;
+  v13904=v3086*v3494-*p;
+  v1169=v4552*v15964-*p;
+  v5487=v4738*v295-*p;
+  v9578=v4481*v7825-*p;
+  v10226=v14442*v18502-*p;
+  v5419=v11973*v16570-*p;
+  v13716=v7913*v11439-*p;
+  v11441=v249*v124-*p;
+  v1868=v10701*v4302-*p;
+  v7727=v10634*v1463-*p;
+  v2932=v19511*v16601-*p;
+  v19586=v14918*v1127-*p;
+  v2582=v7971*v17975-*p;
+  v9804=v15987*v18031-*p;
+  v16577=v5040*v13796-*p;
+  v8762=v19178*v7599-*p;
+  v5700=v18410*v18069-*p;
+  v374=v866*v19958-*p;
+  v9453=v4245*v13666-*p;
+  v15939=v15103*v1546-*p;
+  v360=v15988*v2967-*p;
+  v2844=v19032*v7860-*p;
+  v5085=v13454*v7933-*p;
+  v18251=v18136*v12461-*p;
+  v8682=v10157*v5709-*p;
+  v12988=v19320*v10102-*p;
+  v16095=v11932*v6472-*p;
+  v3515=v15550*v8848-*p;
+  v17144=v4273*v6426-*p;
+  v8993=v17671*v11352-*p;
+  v8381=v12199*v12941-*p;
+  v18571=v3833*v15482-*p;
+  v14272=v6210*v13141-*p;
+  v7328=v3286*v9001-*p;
+  v19153=v19674*v17250-*p;
+  v15480=v12323*v14656-*p;
+  v118=v15388*v1939-*p;
+  v11157=v6102*v12601-*p;
+  v4501=v2660*v15743-*p;
+  v8628=v3042*v8554-*p;
+  v2878=v17536*v7583-*p;
+  v1376=v4656*v15428-*p;
+  v5677=v2923*v5421-*p;
+  v8697=v6190*v16486-*p;
+  v17078=v13577*v11645-*p;
+  v13007=v17554*v18232-*p;
+  v3036=v10169*v17665-*p;
+  v19236=v16635*v17646-*p;
+  v5432=v347*v8728-*p;
+  v13683=v9373*v5713-*p;
+  v6001=v17376*v925-*p;
+  v10662=v19403*v18452-*p;
+  v2423=v15619*v5803-*p;
+  v7534=v19732*v13638-*p;
+  v9807=v3913*v4566-*p;
+  v9495=v5402*v14692-*p;
+  v19027=v19939*v9308-*p;
+  v12411=v17066*v14120-*p;
+  v16930=v11101*v13551-*p;
+  v16159=v14097*v13230-*p;
+  v6639=v12743*v4536-*p;
+  v3468=v17645*v12707-*p;
+  v4986=v10413*v5307-*p;
+  v5262=v14168*v5941-*p;
+  v19006=v12991*v1360-*p;
+  v1331=v7353*v12989-*p;
+  v12298=v4799*v19457-*p;
+  v1458=v16650*v16777-*p;
+  v17934=v6347*v6087-*p;
+  v11662=v5132*v11383-*p;
+  v2414=v11577*v6949-*p;
+  v10747=v16792*v14340-*p;
+  v3430=v2526*v12592-*p;
+  v12751=v3234*v3003-*p;
+  v6572=v15987*v10248-*p;
+  v9048=v19328*v7397-*p;
+  v7460=v8465*v9760-*p;
+  v5305=v6915*v6856-*p;
+  v14813=v16555*v245-*p;
+  v6126=v11554*v5048-*p;
+  v12261=v13619*v4227-*p;
+  v19929=v15120*v9984-*p;
+  v2175=v19793*v10531-*p;
+  v6918=v16599*v5867-*p;
+  v16460=v4907*v10473-*p;
+  v14899=v7796*v2207-*p;
+  v15400=v18318*v7339-*p;
+  v16535=v5324*v4618-*p;
+  v10506=v1593*v6541-*p;
+  v261=v18905*v12289-*p;
+  v13762=v11243*v17116-*p;
+  v13852=v2136*v14542-*p;
+  v2869=v14818*v16872-*p;
+  v8520=v5754*v3806-*p;
+  v8385=v10141*v17195-*p;
+  v12405=v7524*v10324-*p;
+  v18951=v1005*v3500-*p;
+  v10988=v11903*v3918-*p;
+  v908=v10749*v4328-*p;
+  v12195=v1790*v7619-*p;
+  v17409=v7122*v17756-*p;
+  v4852=v5093*v4248-*p;
+  v10716=v19304*v2269-*p;
+  v15841=v11396*v10551-*p;
+  v9299=v16926*v3869-*p;
+  v19292=v2288*v16473-*p;
+  v6028=v5546*v604-*p;
+  v17713=v8178*v5865-*p;
+  v13852=v12001*v8550-*p;
+  v3659=v6487*v5969-*p;
+  v12668=v49*v17902-*p;
+  v4711=v13978*v3284-*p;
+  v14667=v9854*v17452-*p;
+  v16582=v1400*v14205-*p;
+  v4915=v4002*v9566-*p;
+  v11181=v820*v19058-*p;
+  v5407=v19444*v3770-*p;
+  v13877=v13879*v14312-*p;
+  v11705=v421*v6085-*p;
+  v14769=v8401*v192-*p;
+  v17754=v17536*v1396-*p;
+  v708=v7090*v8745-*p;
+  v556=v9190*v8263-*p;
+  v13668=v3828*v16051-*p;
+  v2883=v14309*v17562-*p;
+  v17356=v11089*v7243-*p;
+  v15527=v19022*v13675-*p;
+  v6755=v456*v13022-*p;
+  v16242=v8094*v7988-*p;
+  v4065=v4023*v5310-*p;
+  v17391=v10683*v3914-*p;
+  v8018=v5032*v5432-*p;
+  v3343=v6554*v13443-*p;
+  v2759=v16235*v17890-*p;
+  v13751=v8315*v2979-*p;
+  v1510=v6420*v17639-*p;
+  v14378=v5364*v975-*p;
+  v6915=v17328*v16544-*p;
+  v9381=v383*v79-*p;
+  v14717=v13382*v3219-*p;
+  v559=v3512*v9423-*p;
+  v9870=v3027*v18701-*p;
+  v10406=v9579*v10151-*p;
+  v11394=v18356*v18142-*p;
+  v9279=v17828*v5241-*p;
+  v6449=v360*v16395-*p;
+  v13859=v14972*v5310-*p;
+  v15817=v11259*v3426-*p;
+  v10079=v2378*v325-*p;
+  v12204=v9767*v7079-*p;
+  v13956=v8225*v8107-*p;
+  v17825=v1475*v6692-*p;
+  v10189=v6249*v3363-*p;
+  v5855=v782*v8569-*p;
+  v649=v13155*v15902-*p;
+  v16238=v10124*v12751-*p;
+  v14837=v8852*v13325-*p;
+  v2969=v15862*v14446-*p;
+  v7385=v16215*v9088-*p;
+  v1993=v17765*v15399-*p;
+  v5063=v1195*v3873-*p;
+  v5511=v5274*v13556-*p;
+  v12501=v1095*v12722-*p;
+  v10545=v13562*v9765-*p;
+  v4210=v13672*v4502-*p;
+  v3115=v2825*v10776-*p;
+  v7583=v1567*v2124-*p;
+  v8790=v17819*v12087-*p;
+  v10680=v3379*v18078-*p;
+  v11350=v359*v176-*p;
+  v4647=v19609*v3105-*p;
+  v11607=v2174*v14182-*p;
+  v9093=v14233*v2877-*p;
+  v7154=v4489*v14761-*p;
+  v4260=v3845*v5145-*p;
+  v17443=v1630*v10708-*p;
+  v7102=v17089*v6014-*p;
+  v5881=v9424*v13481-*p;
+  v4059=v12673*v12250-*p;
+  v11680=v7002*v5154-*p;
+  v10358=v10224*v13053-*p;
+  v12168=v2027*v5770-*p;
+  v7753=v6575*v14005-*p;
+  v7872=v13904*v13791-*p;
+  v16991=v12894*v19009-*p;
+  v9987=v7483*v13621-*p;
+  v17112=v1142*v2031-*p;
+  v8877=v4707*v5249-*p;
+  v19534=v7965*v9210-*p;
+  v15672=v12522*v7342-*p;
+  v11495=v6501*v15704-*p;
+  v4265=v13789*v14043-*p;
+  v11374=v14616*v12346-*p;
+  v7841=v2326*v12689-*p;
+  v16799=v3736*v7012-*p;
+  v2136=v2894*v9334-*p;
+  v7325=v7279*v120-*p;
+  v14473=v1614*v3244-*p;
+  v9316=v8985*v11641-*p;
+  v17771=v504*v10848-*p;
+  v18277=v14535*v1156-*p;
+  v5603=v4790*v2331-*p;
+  v3381=v19008*v14452-*p;
+  v1009=v17646*v16254-*p;
+  v11969=v9306*v11519-*p;
+  v1870=v12215*v16135-*p;
+  v7048=v2027*v11604-*p;
+  v16041=v2178*v11877-*p;
+  v14498=v2860*v6233-*p;
+  v12915=v1007*v3213-*p;
+  v7377=v4271*v17011-*p;
+  v16586=v15693*v3341-*p;
+  v15343=v15758*v14695-*p;
+  v15079=v2826*v2190-*p;
+  v10731=v12304*v5853-*p;
+  v13071=v15525*v19762-*p;
+  v2928=v14437*v14669-*p;
+  v5042=v19815*v17502-*p;
+  v168=v6390*v19363-*p;
+  v14569=v2627*v14708-*p;
+  v16766=v19308*v15451-*p;
+  v17460=v18727*v13181-*p;
+  v11568=v341*v1245-*p;
+  v14179=v15406*v3313-*p;
+  v1636=v396*v6729-*p;
+  v16402=v4888*v12165-*p;
+  v17292=v11799*v31-*p;
+  v10622=v11118*v18921-*p;
+  v2089=v4927*v15757-*p;
+  v7304=v15295*v830-*p;
+  v7603=v17278*v868-*p;
+  v18937=v8244*v8953-*p;
+  v2788=v13367*v13405-*p;
+  v14085=v13030*v9089-*p;
+  v7300=v19461*v6949-*p;
+  v12459=v8017*v17460-*p;
+  v6656=v14326*v15647-*p;
+  v16925=v4768*v6475-*p;
+  v14551=v19846*v7595-*p;
+  v13771=v17452*v11010-*p;
+  v3185=v17648*v10537-*p;
+  v4827=v15989*v15610-*p;
+  v15657=v10956*v12535-*p;
+  v8521=v1997*v6859-*p;
+  v5429=v3581*v12137-*p;
+  v283=v19138*v12546-*p;
+  v6660=v2515*v18231-*p;
+  v152=v17897*v6055-*p;
+  v13557=v16959*v15374-*p;
+  v18838=v19984*v1772-*p;
+  v18680=v14436*v2313-*p;
+  v18799=v16315*v7903-*p;
+  v324=v11862*v14650-*p;
+  v671=v407*v15455-*p;
+  v10377=v5446*v11401-*p;
+  v6582=v17785*v6167-*p;
+  v9679=v6839*v18363-*p;
+  v18250=v17464*v15786-*p;
+  v3919=v17671*v18049-*p;
+  v1290=v2254*v17066-*p;
+  v17869=v3311*v18265-*p;
+  v7215=v6137*v1608-*p;
+  v8992=v16650*v1691-*p;
+  v9076=v4519*v2217-*p;
+  v16714=v10981*v9216-*p;
+  v10359=v14194*v9569-*p;
+  v19953=v3332*v15449-*p;
+  v2698=v4666*v3324-*p;
+  v6465=v11355*v1449-*p;
+  v1855=v13446*v15325-*p;
+  v11667=v18478*v3786-*p;
+  v107=v10765*v18507-*p;
+  v1394=v12175*v12654-*p;
+  v16544=v15061*v11478-*p;
+  v6057=v15882*v11204-*p;
+  v13049=v8134*v11091-*p;
+  v1432=v8664*v16564-*p;
+  v18243=v8421*v7347-*p;
+  v6373=v4455*v15646-*p;
+  v888=v19175*v16350-*p;
+  v5552=v8037*v858-*p;
+  v9870=v18856*v9639-*p;
+  v14091=v13687*v12146-*p;
+  v8114=v5447*v18178-*p;
+  v11952=v12588*v602-*p;
+  v15598=v6739*v18771-*p;
+  v8877=v19511*v18967-*p;
+  v18507=v19015*v19970-*p;
+  v19502=v3243*v9560-*p;
+  v3093=v15206*v18298-*p;
+  v10066=v425*v9322-*p;
+  v17809=v62*v7987-*p;
+  v16266=v882*v5971-*p;
+  v3943=v14984*v6690-*p;
+  v5235=v14965*v13614-*p;
+  v9558=v9084*v6999-*p;
+  v9407=v8584*v861-*p;
+  v18814=v14447*v18742-*p;
+  v2748=v10772*v10553-*p;
+  v9040=v9094*v3908-*p;
+  v15397=v18167*v7834-*p;
+  v404=v3368*v723-*p;
+  v5449=v7426*v17193-*p;
+  v16500=v3132*v18238-*p;
+  v1890=v5213*v2816-*p;
+  v11351=v3148*v18564-*p;
+  v19383=v11852*v7821-*p;
+  v2866=v13382*v9643-*p;
+  v782=v15118*v2574-*p;
+  v7629=v4017*v13904-*p;
+  v1901=v13718*v1994-*p;
+  v9768=v1037*v2688-*p;
+  v4220=v1831*v13992-*p;
+  v6202=v6469*v12857-*p;
+  v19559=v14650*v14520-*p;
+  v9176=v19596*v14536-*p;
+  v1315=v1798*v1474-*p;
+  v17144=v9565*v17079-*p;
+  v15524=v2455*v2298-*p;
+  v10714=v10823*v11838-*p;
+  v17327=v18176*v9118-*p;
+  v11532=v6641*v10245-*p;
+  v8967=v10214*v12767-*p;
+  v12935=v11226*v19404-*p;
+  v711=v2660*v14156-*p;
+  v13878=v18660*v17228-*p;
+  v18991=v4303*v1985-*p;
+  v4039=v405*v18615-*p;
+  v16052=v11219*v13490-*p;
+  v7899=v4349*v9449-*p;
+  v18344=v18820*v16537-*p;
+  v8049=v10899*v12337-*p;
+  v5619=v11432*v8296-*p;
+  v10049=v12729*v19637-*p;
+  v19418=v13376*v11233-*p;
+  v9668=v16858*v15911-*p;
+  v9764=v13572*v19018-*p;
+  v13798=v5391*v6647-*p;
+  v12820=v5425*v1369-*p;
+  v15190=v3893*v4643-*p;
+  v11354=v19627*v19743-*p;
+  v1879=v16750*v3025-*p;
+  v8555=v5815*v13348-*p;
+  v13408=v1869*v13929-*p;
+  v9575=v1615*v4334-*p;
+  v15982=v297*v5255-*p;
+  v2064=v10365*v17506-*p;
+  v18907=v9701*v4451-*p;
+  v8891=v5877*v14091-*p;
+  v16342=v15418*v689-*p;
+  v14675=v12288*v19531-*p;
+  v12051=v6837*v19291-*p;
+  v13119=v18863*v17502-*p;
+  v3935=v17141*v3366-*p;
+  v939=v695*v6476-*p;
+  v665=v17824*v3271-*p;
+  v17528=v9688*v5820-*p;
+  v18238=v17900*v16593-*p;
+  v13986=v5361*v5862-*p;
+  v9153=v1802*v5946-*p;
+  v18382=v11725*v13131-*p;
+  v15097=v14990*v5547-*p;
+  v2802=v8682*v10393-*p;
+  v3853=v17553*v17857-*p;
+  v5148=v14221*v2093-*p;
+  v17708=v9566*v12008-*p;
+  v3013=v13373*v122-*p;
+  v19124=v6678*v10800-*p;
+  v5078=v3325*v15433-*p;
+  v11223=v18099*v10793-*p;
+  v7319=v732*v11404-*p;
+  v1098=v4484*v16727-*p;
+  v3724=v13259*v11962-*p;
+  v6633=v8871*v2655-*p;
+  v1067=v7437*v5718-*p;
+  v12993=v327*v6682-*p;
+  v2306=v4793*v16510-*p;
+  v13951=v5616*v1388-*p;
+  v13027=v12883*v13442-*p;
+  v14869=v18746*v204-*p;
+  v14540=v11056*v10308-*p;
+  v18561=v12622*v15990-*p;
+  v17504=v2732*v12800-*p;
+  v12705=v9978*v10589-*p;
+  v18177=v19667*v19222-*p;
+  v8234=v12357*v18302-*p;
+  v16414=v3397*v4585-*p;
+  v7750=v3201*v4034-*p;
+  v3970=v10214*v17580-*p;
+  v1630=v17151*v2769-*p;
+  v11404=v537*v2982-*p;
+  v14461=v3631*v14974-*p;
+  v3300=v14321*v478-*p;
+  v3740=v11567*v16266-*p;
+  v17068=v2788*v3464-*p;
+  v5956=v14706*v16394-*p;
+  v3770=v4241*v16501-*p;
+  v9914=v18057*v11379-*p;
+  v13716=v10551*v15235-*p;
+  v1407=v12238*v12331-*p;
+  v19395=v213*v3587-*p;
+  v13827=v10556*v19128-*p;
+  v11847=v15316*v17537-*p;
+  v18288=v3010*v19697-*p;
+  v11203=v14889*v5000-*p;
+  v4792=v3527*v3579-*p;
+  v18597=v11669*v6082-*p;
+  v13210=v15750*v2472-*p;
+  v16273=v6010*v60-*p;
+  v16053=v10486*v12585-*p;
+  v10095=v16065*v5341-*p;
+  v7841=v3918*v8546-*p;
+  v6441=v9956*v10310-*p;
+  v2482=v3895*v10927-*p;
+  v4770=v17712*v8381-*p;
+  v18007=v8626*v14701-*p;
+  v12188=v5769*v13099-*p;
+  v8321=v19124*v10123-*p;
+  v7933=v18522*v6778-*p;
+  v15439=v5847*v8710-*p;
+  v858=v3102*v2017-*p;
+  v18225=v16729*v3815-*p;
+  v17932=v15996*v4284-*p;
+  v4307=v17879*v17241-*p;
+  v11177=v8913*v19265-*p;
+  v13552=v3802*v12778-*p;
+  v2874=v17635*v19944-*p;
+  v11503=v4194*v2038-*p;
+  v6904=v9760*v19909-*p;
+  v19918=v2706*v17092-*p;
+  v8870=v11731*v11650-*p;
+  v2887=v7571*v7817-*p;
+  v6485=v2823*v8067-*p;
+  v3812=v19906*v16310-*p;
+  v10999=v14289*v4375-*p;
+  v11772=v19790*v7103-*p;
+  v14003=v5933*v14228-*p;
+  v11204=v16851*v9604-*p;
+  v19202=v6917*v7919-*p;
+  v13424=v12579*v14282-*p;
+  v3909=v19800*v10689-*p;
+  v16149=v10*v8897-*p;
+  v9330=v3231*v3019-*p;
+  v2413=v16250*v5836-*p;
+  v12452=v1124*v15545-*p;
+  v9951=v11366*v13794-*p;
+  v9004=v11629*v15303-*p;
+  v14832=v173*v18917-*p;
+  v1587=v11533*v325-*p;
+  v7135=v11910*v16571-*p;
+  v10336=v2080*v18423-*p;
+  v6518=v16723*v12355-*p;
+  v17962=v7444*v4840-*p;
+  v7884=v1646*v15505-*p;
+  v5995=v3971*v10597-*p;
+  v1031=v16885*v7311-*p;
+  v6532=v17395*v18343-*p;
+  v10264=v2393*v6875-*p;
+  v3115=v3633*v5297-*p;
+  v118=v11512*v12035-*p;
+  v274=v3758*v16586-*p;
+  v6218=v18676*v7034-*p;
+  v4412=v5838*v10825-*p;
+  v15772=v3245*v8866-*p;
+  v12874=v19584*v9909-*p;
+  v7393=v14242*v12418-*p;
+  v5825=v17731*v3502-*p;
+  v19562=v1067*v2107-*p;
+  v6662=v7129*v2552-*p;
+  v6934=v14372*v14207-*p;
+  v7755=v19452*v1891-*p;
+  v14854=v17390*v9032-*p;
+  v6471=v14829*v13580-*p;
+  v1331=v2704*v1934-*p;
+  v17268=v12864*v18556-*p;
+  v9649=v17238*v5169-*p;
+  v9781=v9941*v8159-*p;
+  v8862=v14077*v3130-*p;
+  v5814=v15819*v19993-*p;
+  v8413=v6900*v18430-*p;
+  v15860=v10969*v15596-*p;
+  v7253=v8019*v3942-*p;
+  v16304=v9387*v16744-*p;
+  v11057=v3478*v2610-*p;
+  v628=v13487*v12255-*p;
+  v7355=v19524*v15925-*p;
+  v3718=v13340*v16275-*p;
+  v8397=v11873*v10776-*p;
+  v7553=v11212*v7742-*p;
+  v6878=v1144*v9200-*p;
+  v13653=v6071*v5076-*p;
+  v3175=v19494*v16581-*p;
+  v923=v7886*v15489-*p;
+  v5390=v16135*v1964-*p;
+  v11456=v1466*v1158-*p;
+  v1640=v10941*v18278-*p;
+  v15815=v14552*v2273-*p;
+  v321=v8902*v14019-*p;
+  v6208=v10774*v1545-*p;
+  v18742=v2802*v19077-*p;
+  v11265=v8284*v2819-*p;
+  v10145=v6338*v4031-*p;
+  v5078=v6079*v12562-*p;
+  v16163=v3208*v3402-*p;
+  v8339=v15781*v16581-*p;
+  v2624=v627*v14170-*p;
+  v15712=v4542*v13306-*p;
+  v1959=v16277*v4797-*p;
+  v18168=v7840*v15809-*p;
+  v13055=v2088*v11978-*p;
+  v2312=v7567*v6226-*p;
+  v11304=v12840*v8165-*p;
+  v16783=v4069*v3133-*p;
+  v11515=v15960*v5859-*p;
+  v14026=v3810*v3151-*p;
+  v14177=v6239*v2261-*p;
+  v14551=v14873*v13986-*p;
+  v7494=v13326*v19082-*p;
+  v17624=v1718*v1152-*p;
+  v14126=v828*v18041-*p;
+  v15236=v15078*v17447-*p;
+  v9119=v12842*v17622-*p;
+  v1457=v11494*v4380-*p;
+  v6094=v2674*v4449-*p;
+  v19641=v14235*v2371-*p;
+  v18804=v3161*v15373-*p;
+  v3796=v14413*v12667-*p;
+  v6062=v15264*v14607-*p;
+  v906=v19159*v12676-*p;
+  v4791=v17296*v16857-*p;
+  v8971=v12251*v3607-*p;
+  v14228=v11973*v8998-*p;
+  v18275=v13600*v6056-*p;
+  v19518=v16451*v2856-*p;
+  v9576=v12810*v12434-*p;
+  v2007=v6511*v11337-*p;
+  v7554=v3069*v13012-*p;
+  v5149=v10155*v5202-*p;
+  v8066=v10584*v4331-*p;
+  v18018=v4116*v16289-*p;
+  v19155=v14688*v2301-*p;
+  v9391=v475*v3447-*p;
+  v3879=v7155*v8016-*p;
+  v17433=v12618*v10436-*p;
+  v18916=v14951*v5100-*p;
+  v4154=v18049*v7554-*p;
+  v13487=v4033*v15750-*p;
+  v16362=v8767*v9839-*p;
+  v9903=v1708*v3671-*p;
+  v4970=v18343*v18493-*p;
+  v4714=v8692*v13410-*p;
+  v4244=v750*v4138-*p;
+  v9021=v4441*v9233-*p;
+  v10047=v7864*v9577-*p;
+  v5362=v19769*v18356-*p;
+  v2922=v12067*v174-*p;
+  v12338=v6955*v10927-*p;
+  v3635=v7503*v1845-*p;
+  v12440=v11521*v425-*p;
+  v6328=v4401*v9612-*p;
+  v4987=v17839*v17677-*p;
+  v17746=v358*v4472-*p;
+  v4018=v19596*v4047-*p;
+  v197=v14372*v3593-*p;
+  v16333=v4214*v13831-*p;
+  v5837=v8031*v3963-*p;
+  v8172=v719*v4619-*p;
+  v19109=v11898*v10940-*p;
+  v1703=v2979*v1567-*p;
+  v4674=v11692*v3107-*p;
+  v3198=v13507*v16631-*p;
+  v17380=v6185*v12555-*p;
+  v11479=v8975*v456-*p;
+  v758=v4358*v9183-*p;
+  v16541=v3067*v59-*p;
+  v10883=v16313*v6578-*p;
+  v4027=v9807*v2684-*p;
+  v3233=v8400*v19586-*p;
+  v779=v11429*v6084-*p;
+  v17800=v7665*v13741-*p;
+  v14456=v18790*v7444-*p;
+  v666=v10767*v2684-*p;
+  v1720=v16295*v15291-*p;
+  v12526=v16623*v617-*p;
+  v6779=v10799*v8916-*p;
+  v787=v16748*v8914-*p;
+  v14439=v3300*v19207-*p;
+  v8808=v14521*v11412-*p;
+  v7687=v11162*v9528-*p;
+  v4218=v3353*v8875-*p;
+  v10621=v7907*v3662-*p;
+  v2969=v13102*v16689-*p;
+  v7077=v2783*v3321-*p;
+  v15851=v15165*v10686-*p;
+  v10966=v12666*v9626-*p;
+  v10993=v17404*v14943-*p;
+  v13952=v137*v7450-*p;
+  v1013=v11474*v5529-*p;
+  v597=v9252*v18832-*p;
+  v4554=v2881*v12388-*p;
+  v16122=v12849*v4545-*p;
+  v13493=v9455*v17738-*p;
+  v13841=v12682*v1958-*p;
+  v3926=v1280*v6347-*p;
+  v8136=v12635*v2722-*p;
+  v10643=v11929*v16064-*p;
+  v15879=v14349*v7389-*p;
+  v11975=v5818*v18501-*p;
+  v6419=v11081*v4502-*p;
+  v2578=v8974*v16517-*p;
+  v6854=v16336*v14336-*p;
+  v5386=v12740*v14397-*p;
+  v9170=v7442*v9102-*p;
+  v7358=v16259*v14839-*p;
+  v17790=v7748*v4849-*p;
+  v951=v1926*v3980-*p;
+  v19068=v8605*v4622-*p;
+  v11411=v6424*v17235-*p;
+  v7887=v3029*v7270-*p;
+  v1684=v18779*v11692-*p;
+  v8858=v15646*v10382-*p;
+  v3122=v4977*v12612-*p;
+  v13896=v6702*v15662-*p;
+  v5880=v442*v17001-*p;
+  v14337=v3344*v4105-*p;
+  v2935=v290*v5256-*p;
+  v169=v331*v17453-*p;
+  v9401=v8576*v2685-*p;
+  v9318=v19784*v5566-*p;
+  v9761=v2483*v2797-*p;
+  v4651=v15487*v3309-*p;
+  v17280=v17691*v8099-*p;
+  v11855=v6738*v6215-*p;
+  v14004=v4573*v19569-*p;
+  v4805=v10807*v11978-*p;
+  v11010=v3845*v18929-*p;
+  v8408=v17356*v10813-*p;
+  v608=v16952*v8317-*p;
+  v3808=v17448*v12402-*p;
+  v12953=v11127*v17535-*p;
+  v12662=v19899*v1294-*p;
+  v2318=v13840*v4042-*p;
+  v11333=v8882*v16692-*p;
+  v12805=v6710*v13713-*p;
+  v12455=v6969*v18534-*p;
+  v15029=v5241*v16459-*p;
+  v6790=v89*v14268-*p;
+  v11773=v462*v19562-*p;
+  v19974=v19018*v2780-*p;
+  v6566=v7718*v7593-*p;
+  v18871=v12603*v1642-*p;
+  v12757=v14959*v3452-*p;
+  v13362=v9139*v8294-*p;
+  v13596=v11286*v11699-*p;
+  v11106=v10021*v7626-*p;
+  v16212=v6848*v3840-*p;
+  v9137=v6610*v11011-*p;
+  v9233=v15720*v8397-*p;
+  v11809=v8425*v3128-*p;
+  v148=v2708*v13850-*p;
+  v14062=v15260*v3262-*p;
+  v832=v6223*v1425-*p;
+  v8442=v1008*v9053-*p;
+  v3244=v3431*v11748-*p;
+  v3878=v17277*v3406-*p;
+  v18438=v16698*v17794-*p;
+  v11121=v12538*v2938-*p;
+  v13121=v250*v5610-*p;
+  v16977=v12059*v7816-*p;
+  v18445=v13882*v11400-*p;
+  v17288=v1052*v16480-*p;
+  v620=v19013*v571-*p;
+  v4017=v7489*v3602-*p;
+  v7431=v11881*v9668-*p;
+  v9699=v2157*v10049-*p;
+  v18732=v1220*v17149-*p;
+  v17256=v3893*v13230-*p;
+  v12205=v6398*v5353-*p;
+  v910=v7400*v3197-*p;
+  v9994=v7223*v18285-*p;
+  v2004=v19749*v9814-*p;
+  v11960=v10015*v15963-*p;
+  v19095=v6418*v2164-*p;
+  v322=v7083*v17655-*p;
+  v7387=v17928*v6923-*p;
+  v16=v10309*v8874-*p;
+  v17758=v258*v7124-*p;
+  v14637=v8790*v11190-*p;
+  v9420=v18272*v11690-*p;
+  v15470=v14096*v19090-*p;
+  v636=v10210*v17052-*p;
+  v5441=v18121*v13870-*p;
+  v18869=v13936*v6336-*p;
+  v5379=v7973*v15413-*p;
+  v7927=v17199*v16602-*p;
+  v5214=v617*v17805-*p;
+  v12708=v4372*v7768-*p;
+  v2762=v11312*v11648-*p;
+  v9682=v12689*v3197-*p;
+  v6460=v6155*v2657-*p;
+  v11765=v18685*v5946-*p;
+  v12737=v19778*v16965-*p;
+  v3380=v3263*v4577-*p;
+  v13752=v3588*v12769-*p;
+  v10813=v4434*v3150-*p;
+  v11089=v8558*v5200-*p;
+  v11404=v19007*v10190-*p;
+  v17993=v2747*v9686-*p;
+  v6837=v13049*v794-*p;
+  v2122=v11467*v7291-*p;
+  v13495=v9017*v3597-*p;
+  v3271=v19597*v3810-*p;
+  v12812=v17099*v8489-*p;
+  v19391=v17498*v15317-*p;
+  v17768=v5187*v2678-*p;
+  v11482=v13380*v19199-*p;
+  v17036=v1874*v19686-*p;
+  v17180=v16342*v9284-*p;
+  v17836=v6741*v14626-*p;
+  v13225=v10209*v3757-*p;
+  v15319=v10428*v1816-*p;
+  v18889=v10903*v5281-*p;
+  v15347=v11637*v280-*p;
+  v4897=v936*v5554-*p;
+  v11045=v19269*v7215-*p;
+  v19997=v14626*v16552-*p;
+  v4944=v18203*v7826-*p;
+  v4315=v13554*v10860-*p;
+  v1853=v8453*v11787-*p;
+  v1220=v411*v18431-*p;
+  v14694=v17102*v13191-*p;
+  v11006=v13248*v7612-*p;
+  v14208=v3698*v1632-*p;
+  v8985=v12123*v3382-*p;
+  v8982=v18534*v0-*p;
+  v7580=v17317*v12817-*p;
+  v9915=v10585*v4196-*p;
+  v1418=v19172*v2956-*p;
+  v16919=v16041*v6929-*p;
+  v7858=v7311*v1809-*p;
+  v2779=v4837*v6469-*p;
+  v4575=v4069*v15087-*p;
+  v8301=v12344*v15956-*p;
+  v2887=v4982*v18471-*p;
+  v2130=v19492*v8244-*p;
+  v13617=v14019*v6080-*p;
+  v19171=v1010*v11920-*p;
+  v5529=v3722*v2144-*p;
+  v13258=v7003*v10407-*p;
+  v18755=v15925*v3529-*p;
+  v5181=v2996*v18622-*p;
+  v19390=v3445*v18870-*p;
+  v883=v16140*v9788-*p;
+  v9107=v18688*v10243-*p;
+  v5978=v6549*v4584-*p;
+  v7564=v8042*v2943-*p;
+  v5628=v6399*v13028-*p;
+  v15138=v15354*v8382-*p;
+  v2293=v19088*v859-*p;
+  v17060=v2368*v5130-*p;
+  v9743=v11881*v3148-*p;
+  v3152=v6004*v9143-*p;
+  v10761=v7774*v5533-*p;
+  v14827=v17329*v4158-*p;
+  v8269=v3382*v4547-*p;
+  v293=v12754*v10494-*p;
+  v18184=v10105*v11526-*p;
+  v6539=v17994*v3473-*p;
+  v14852=v17147*v294-*p;
+  v464=v19501*v2575-*p;
+  v10148=v19795*v12684-*p;
+  v7168=v10571*v19681-*p;
+  v3231=v5332*v7586-*p;
+  v19921=v12214*v1398-*p;
+  v9335=v17956*v16699-*p;
+  v13900=v15448*v440-*p;
+  v14329=v16894*v19167-*p;
+  v12434=v9769*v3986-*p;
+  v18141=v10656*v17142-*p;
+  v10513=v2001*v18930-*p;
+  v7783=v16620*v6355-*p;
+  v12954=v15104*v15321-*p;
+  v1006=v5306*v284-*p;
+  v12566=v7740*v14851-*p;
+  v18483=v16925*v2451-*p;
+  v7298=v2907*v9041-*p;
+  v3707=v18674*v16424-*p;
+  v19979=v5128*v1356-*p;
+  v714=v8851*v10613-*p;
+  v15942=v18341*v3124-*p;
+  v7171=v6040*v11044-*p;
+  v8032=v18210*v17204-*p;
+  v15890=v11392*v2809-*p;
+  v9901=v11545*v18271-*p;
+  v7693=v13200*v18395-*p;
+  v4728=v15895*v15876-*p;
+  v15738=v12590*v13301-*p;
+  v1578=v19667*v18698-*p;
+  v11321=v6384*v19182-*p;
+  v12818=v9644*v14306-*p;
+  v1019=v13100*v11890-*p;
+  v9998=v11630*v18846-*p;
+  v19508=v12375*v1204-*p;
+  v12839=v19364*v10232-*p;
+  v14231=v7819*v14979-*p;
+  v5681=v170*v16853-*p;
+  v7706=v9579*v8923-*p;
+  v13551=v2427*v11810-*p;
+  v17594=v4629*v6172-*p;
+  v17249=v15461*v19056-*p;
+  v14300=v15891*v13108-*p;
+  v19008=v5292*v15542-*p;
+  v13450=v7458*v6832-*p;
+  v19501=v2078*v16656-*p;
+  v14457=v18389*v19179-*p;
+  v16086=v5206*v5780-*p;
+  v6895=v9824*v14914-*p;
+  v7967=v5208*v819-*p;
+  v3471=v13952*v7350-*p;
+  v3500=v9619*v493-*p;
+  v17783=v10167*v10684-*p;
+  v13147=v14294*v8156-*p;
+  v8908=v8522*v3976-*p;
+  v11002=v3066*v15441-*p;
+  v8299=v5394*v14979-*p;
+  v7117=v10492*v15651-*p;
+  v19413=v2588*v15060-*p;
+  v6051=v14016*v7106-*p;
+  v6503=v15194*v8991-*p;
+  v10207=v10272*v15734-*p;
+  v19381=v16961*v248-*p;
+  v19642=v15164*v2600-*p;
+  v16447=v6168*v525-*p;
+  v6600=v7265*v1382-*p;
+  v5638=v19971*v11187-*p;
+  v17998=v15054*v6053-*p;
+  v17334=v17734*v8006-*p;
+  v65=v5831*v12358-*p;
+  v16779=v13408*v16182-*p;
+  v18151=v8621*v8271-*p;
+  v7873=v12998*v11643-*p;
+  v7401=v13868*v6619-*p;
+  v17273=v18623*v12430-*p;
+  v12040=v15386*v8022-*p;
+  v15790=v17624*v7369-*p;
+  v6071=v8382*v12205-*p;
+  v18651=v8934*v18378-*p;
+  v17609=v13022*v16262-*p;
+  v6549=v18185*v7925-*p;
+  v11639=v12842*v1904-*p;
+  v16311=v8317*v13400-*p;
+  v8408=v19519*v12146-*p;
+  v14663=v16339*v14339-*p;
+  v6225=v3677*v13313-*p;
+  v14730=v12315*v7619-*p;
+  v15316=v1441*v10217-*p;
+  v10204=v8144*v3947-*p;
+  v18312=v11211*v2233-*p;
+  v1141=v15402*v15351-*p;
+  v19718=v11748*v14694-*p;
+  v8924=v4446*v14600-*p;
+  v1164=v11154*v7769-*p;
+  v11764=v13761*v7998-*p;
+  v13941=v8551*v10077-*p;
+  v15426=v16635*v6269-*p;
+  v9230=v4632*v7151-*p;
+  v10480=v1701*v1131-*p;
+  v7905=v4079*v4787-*p;
+  v10633=v3113*v17567-*p;
+  v13201=v18760*v13053-*p;
+  v12983=v722*v18118-*p;
+  v11276=v16707*v8597-*p;
+  v9063=v603*v11084-*p;
+  v11597=v5841*v11244-*p;
+  v18391=v939*v452-*p;
+  v13157=v17055*v2051-*p;
+  v3882=v8668*v9924-*p;
+  v8996=v13295*v1469-*p;
+  v1535=v8175*v16953-*p;
+  v9345=v11787*v16933-*p;
+  v10942=v12046*v13302-*p;
+  v6089=v4568*v9640-*p;
+  v9661=v8342*v10940-*p;
+  v19728=v6173*v19273-*p;
+  v14553=v6477*v11892-*p;
+  v18581=v5851*v6768-*p;
+  v2433=v10010*v15715-*p;
+  v19556=v18571*v573-*p;
+  v3934=v12846*v9468-*p;
+  v4515=v17791*v15035-*p;
+  v11911=v11899*v17488-*p;
+  v19860=v4277*v6519-*p;
+  v18220=v9848*v6914-*p;
+  v4362=v11470*v11843-*p;
+  v7810=v18577*v2308-*p;
+  v7011=v5399*v8640-*p;
+  v2393=v1766*v2311-*p;
+  v11913=v13807*v1400-*p;
+  v2012=v17744*v8504-*p;
+  v16878=v15183*v11527-*p;
+  v6620=v15024*v3139-*p;
+  v3834=v2300*v13559-*p;
+  v16400=v386*v5457-*p;
+  v3653=v6208*v13190-*p;
+  v4606=v8382*v18165-*p;
+  v15036=v1178*v4651-*p;
+  v19742=v16794*v8089-*p;
+  v2883=v6224*v4053-*p;
+  v9806=v9654*v2563-*p;
+  v2161=v18075*v15226-*p;
+  v14316=v15986*v9999-*p;
+  v11779=v10356*v7573-*p;
+  v2752=v18504*v1192-*p;
+  v17299=v5124*v9581-*p;
+  v5035=v3637*v10942-*p;
+  v9374=v13227*v4376-*p;
+  v19696=v10039*v17786-*p;
+  v12943=v14592*v154-*p;
+  v2672=v11264*v11610-*p;
+  v11169=v10696*v2671-*p;
+  v6701=v17513*v11654-*p;
+  v11430=v12736*v5756-*p;
+  v5256=v19628*v19117-*p;
+  v7691=v16722*v17614-*p;
+  v18454=v6283*v10100-*p;
+  v5729=v17316*v5806-*p;
+  v14314=v7711*v12814-*p;
+  v7415=v282*v16130-*p;
+  v5871=v632*v15526-*p;
+  v15114=v13746*v3914-*p;
+  v16418=v3459*v14550-*p;
+  v12538=v13166*v11488-*p;
+  v5375=v3420*v17778-*p;
+  v10820=v5277*v14361-*p;
+  v16403=v2876*v2205-*p;
+  v16779=v10162*v13634-*p;
+  v4811=v97*v11471-*p;
+  v2684=v15394*v19971-*p;
+  v10584=v525*v4526-*p;
+  v7800=v3116*v18891-*p;
+  v19401=v14014*v4660-*p;
+  v15179=v18215*v14876-*p;
+  v16301=v8643*v11655-*p;
+  v17613=v16117*v18632-*p;
+  v12384=v3852*v10693-*p;
+  v4836=v14167*v5332-*p;
+  v17572=v18528*v18600-*p;
+  v15116=v16936*v13215-*p;
+  v4496=v2437*v13495-*p;
+  v11044=v200*v7651-*p;
+  v15098=v3120*v18230-*p;
+  v5286=v15336*v2130-*p;
+  v16160=v13790*v13369-*p;
+  v16809=v2488*v2655-*p;
+  v17748=v6368*v7200-*p;
+  v17997=v6333*v6620-*p;
+  v10059=v17006*v8966-*p;
+  v13512=v5001*v13599-*p;
+  v17922=v18709*v16656-*p;
+  v8161=v19553*v6007-*p;
+  v1210=v17664*v5417-*p;
+  v16826=v19915*v1167-*p;
+  v7842=v15982*v15390-*p;
+  v12983=v7254*v7161-*p;
+  v4644=v13825*v3047-*p;
+  v7581=v6028*v6715-*p;
+  v6682=v939*v11907-*p;
+  v12750=v11419*v2878-*p;
+  v2803=v216*v16351-*p;
+  v16984=v8744*v19871-*p;
+  v14986=v4915*v13166-*p;
+  v3001=v3213*v8551-*p;
+  v2029=v1896*v12059-*p;
+  v10185=v5318*v312-*p;
+  v2109=v5089*v8668-*p;
+  v10011=v1838*v18536-*p;
+  v14376=v16404*v5943-*p;
+  v2668=v1135*v565-*p;
+  v9158=v3045*v1399-*p;
+  v13601=v11077*v10839-*p;
+  v8613=v10897*v4838-*p;
+  v18798=v10224*v5986-*p;
+  v13007=v486*v1999-*p;
+  v14268=v18269*v9661-*p;
+  v18585=v12815*v3362-*p;
+  v9218=v11384*v3023-*p;
+  v8673=v7110*v3457-*p;
+  v12630=v8269*v17383-*p;
+  v12270=v8094*v14155-*p;
+  v19492=v4079*v3086-*p;
+  v6070=v2354*v17955-*p;
+  v1236=v772*v15490-*p;
+  v4331=v11452*v1195-*p;
+  v9000=v12525*v9644-*p;
+  v12994=v1884*v13776-*p;
+  v11449=v18413*v1729-*p;
+  v19848=v9112*v12699-*p;
+  v6880=v6222*v4079-*p;
+  v1250=v12628*v15582-*p;
+  v17761=v15024*v19131-*p;
+  v272=v8729*v2262-*p;
+  v17653=v16219*v728-*p;
+  v17426=v18438*v2696-*p;
+  v3281=v7001*v1808-*p;
+  v19183=v18098*v14334-*p;
+  v404=v4826*v13515-*p;
+  v9684=v4077*v3602-*p;
+  v18926=v8649*v134-*p;
+  v9943=v6099*v565-*p;
+  v4133=v19590*v5463-*p;
+  v18685=v8126*v12061-*p;
+  v401=v5562*v5968-*p;
+  v14659=v18358*v5803-*p;
+  v3397=v3578*v363-*p;
+  v764=v18418*v4091-*p;
+  v8576=v7168*v12279-*p;
+  v19736=v15487*v6240-*p;
+  v19125=v17127*v10231-*p;
+  v12537=v13632*v14803-*p;
+  v1270=v15133*v15429-*p;
+  v4729=v871*v1676-*p;
+  v1252=v6565*v2862-*p;
+  v7667=v8615*v11895-*p;
+  v13802=v6279*v15753-*p;
+  v8517=v441*v2387-*p;
+  v5273=v827*v5142-*p;
+  v13157=v14299*v19794-*p;
+  v13141=v14603*v15775-*p;
+  v18929=v18734*v17687-*p;
+  v10669=v14691*v19684-*p;
+  v16471=v8521*v10597-*p;
+  v13885=v3389*v7985-*p;
+  v19144=v9918*v2277-*p;
+  v16185=v7236*v10388-*p;
+  v8444=v2072*v2651-*p;
+  v10775=v9207*v815-*p;
+  v17583=v6871*v15021-*p;
+  v17854=v4653*v19998-*p;
+  v7247=v5918*v8114-*p;
+  v11254=v14587*v12879-*p;
+  v10742=v2045*v17081-*p;
+  v3464=v17341*v19345-*p;
+  v10659=v2458*v12548-*p;
+  v921=v17498*v12657-*p;
+  v4396=v15509*v13917-*p;
+  v11382=v14175*v7767-*p;
+  v2065=v18384*v9475-*p;
+  v9770=v3603*v13444-*p;
+  v3984=v15828*v9480-*p;
+  v17538=v2026*v19796-*p;
+  v13110=v17164*v10086-*p;
+  v6149=v1188*v2-*p;
+  v18783=v188*v14390-*p;
+  v16166=v6896*v1522-*p;
+  v81=v7971*v12743-*p;
+  v1842=v19227*v10559-*p;
+  v8811=v1647*v15753-*p;
+  v4788=v6457*v906-*p;
+  v491=v3006*v530-*p;
+  v8556=v13095*v819-*p;
+  v15892=v4206*v5212-*p;
+  v6799=v14407*v2453-*p;
+  v15488=v5603*v19416-*p;
+  v18539=v11849*v6879-*p;
+  v10327=v19422*v6846-*p;
+  v14434=v400*v16187-*p;
+  v1028=v8795*v5522-*p;
+  v18985=v9188*v13231-*p;
+  v18261=v14682*v7185-*p;
+  v8036=v7948*v2482-*p;
+  v6333=v4767*v3702-*p;
+  v14358=v18922*v14290-*p;
+  v4650=v12703*v12640-*p;
+  v1689=v16875*v2331-*p;
+  v13850=v7909*v1233-*p;
+  v15699=v2817*v13462-*p;
+  v13617=v10282*v4466-*p;
+  v9189=v7918*v19592-*p;
+  v8782=v16123*v18356-*p;
+  v7316=v18274*v1080-*p;
+  v14490=v12178*v15127-*p;
+  v16787=v14448*v5875-*p;
+  v11258=v16357*v6841-*p;
+  v4025=v2568*v8312-*p;
+  v16624=v12636*v5248-*p;
+  v6799=v11493*v13367-*p;
+  v7200=v1716*v18636-*p;
+  v6671=v17698*v11958-*p;
+  v4824=v14370*v19541-*p;
+  v8598=v11730*v14176-*p;
+  v263=v16680*v14863-*p;
+  v7150=v11699*v493-*p;
+  v13400=v18487*v16780-*p;
+  v2933=v12260*v3560-*p;
+  v843=v2743*v11828-*p;
+  v16326=v7033*v4122-*p;
+  v18317=v16657*v8045-*p;
+  v8526=v16154*v4202-*p;
+  v3533=v4899*v16233-*p;
+  v4126=v1632*v5435-*p;
+  v9304=v1781*v14805-*p;
+  v6285=v19267*v14785-*p;
+  v12935=v15197*v10432-*p;
+  v10446=v16972*v15766-*p;
+  v3494=v16868*v9926-*p;
+  v4249=v15685*v2375-*p;
+  v13670=v12075*v1609-*p;
+  v9358=v2927*v1264-*p;
+  v3861=v17305*v6886-*p;
+  v10092=v15018*v2866-*p;
+  v14224=v17191*v243-*p;
+  v7456=v19529*v14309-*p;
+  v3845=v16636*v2579-*p;
+  v14833=v16158*v483-*p;
+  v3471=v755*v18401-*p;
+  v15168=v14892*v3188-*p;
+  v19321=v7369*v16153-*p;
+  v4017=v8483*v13224-*p;
+  v15248=v15866*v17037-*p;
+  v2051=v14161*v12046-*p;
+  v8815=v354*v17050-*p;
+  v19837=v5127*v138-*p;
+  v17340=v8466*v15188-*p;
+  v12809=v18854*v10164-*p;
+  v14294=v8614*v19258-*p;
+  v4754=v11193*v16184-*p;
+  v7060=v17037*v11019-*p;
+  v12906=v19664*v378-*p;
+  v19608=v6031*v14480-*p;
+  v3951=v13308*v4654-*p;
+  v9341=v14960*v10099-*p;
+  v12416=v969*v5887-*p;
+  v17567=v9226*v1678-*p;
+  v939=v19030*v6762-*p;
+  v14561=v16005*v1069-*p;
+  v15550=v8366*v13191-*p;
+  v5986=v7888*v7161-*p;
+  v7471=v423*v152-*p;
+  v10504=v17571*v19569-*p;
+  v6949=v13715*v13987-*p;
+  v17330=v14939*v14986-*p;
+  v15097=v16222*v2563-*p;
+  v14615=v19960*v13968-*p;
+  v481=v534*v14441-*p;
+  v13483=v10452*v17030-*p;
+  v5611=v2105*v16078-*p;
+  v18974=v8715*v4934-*p;
+  v5975=v17704*v9296-*p;
+  v17485=v11955*v18644-*p;
+  v10179=v4466*v14537-*p;
+  v18976=v15547*v3033-*p;
+  v6776=v16627*v15681-*p;
+  v10541=v12616*v19982-*p;
+  v14490=v10102*v10371-*p;
+  v3705=v15057*v1919-*p;
+  v16738=v10164*v14947-*p;
+  v19807=v1863*v2577-*p;
+  v13919=v18184*v13277-*p;
+  v85=v10778*v1200-*p;
+  v3827=v15447*v5167-*p;
+  v5307=v7596*v19351-*p;
+  v2872=v17906*v4285-*p;
+  v3672=v3157*v13593-*p;
+  v9859=v2693*v3844-*p;
+  v5829=v10740*v3693-*p;
+  v14294=v17244*v2868-*p;
+  v11055=v17817*v14086-*p;
+  v7536=v11380*v17954-*p;
+  v2856=v5953*v9246-*p;
+  v8831=v16102*v5977-*p;
+  v19420=v15188*v17874-*p;
+  v19223=v19554*v13062-*p;
+  v12314=v1106*v9263-*p;
+  v5007=v8575*v17799-*p;
+  v15638=v952*v10743-*p;
+  v12991=v18957*v14172-*p;
+  v9638=v6616*v17139-*p;
+  v17609=v16978*v9998-*p;
+  v4493=v19030*v426-*p;
+  v11485=v4730*v19925-*p;
+  v5121=v18183*v11151-*p;
+  v7910=v15994*v3609-*p;
+  v7108=v10687*v17104-*p;
+  v12867=v19662*v9365-*p;
+  v15168=v12245*v16471-*p;
+  v18907=v3528*v12234-*p;
+  v6260=v14976*v16487-*p;
+  v8238=v19554*v15140-*p;
+  v8543=v16515*v19393-*p;
+  v2968=v8956*v5715-*p;
+  v14187=v17875*v3246-*p;
+  v18280=v7837*v14727-*p;
+  v1600=v7192*v11228-*p;
+  v5385=v9227*v9701-*p;
+  v17082=v3968*v734-*p;
+  v19163=v4637*v7476-*p;
+  v10685=v17199*v6116-*p;
+  v14029=v18943*v7354-*p;
+  v6385=v16485*v8468-*p;
+  v2111=v11677*v3626-*p;
+  v7820=v13547*v6022-*p;
+  v16562=v7090*v7699-*p;
+  v9454=v14203*v1598-*p;
+  v9755=v15178*v4544-*p;
+  v18906=v692*v8750-*p;
+  v17091=v738*v18546-*p;
+  v15067=v16142*v16966-*p;
+  v804=v7687*v15298-*p;
+  v19583=v18243*v14328-*p;
+  v2012=v18479*v2184-*p;
+  v150=v18398*v13579-*p;
+  v1233=v9144*v15129-*p;
+  v15253=v6912*v5378-*p;
+  v15936=v14017*v5084-*p;
+  v11094=v15623*v10175-*p;
+  v14157=v2275*v12555-*p;
+  v17431=v11377*v11656-*p;
+  v9154=v12091*v15225-*p;
+  v9313=v355*v18936-*p;
+  v5256=v16244*v2740-*p;
+  v17534=v1681*v5224-*p;
+  v891=v7388*v1503-*p;
+  v12488=v5319*v6619-*p;
+  v4323=v17495*v9477-*p;
+  v1326=v16607*v1885-*p;
+  v7783=v6288*v4237-*p;
+  v15315=v4925*v196-*p;
+  v16977=v13899*v3474-*p;
+  v979=v11631*v10930-*p;
+  v4182=v10670*v4140-*p;
+  v10834=v15960*v2930-*p;
+  v13531=v8902*v16977-*p;
+  v8380=v6332*v15209-*p;
+  v6472=v8233*v15078-*p;
+  v13245=v5270*v9808-*p;
+  v3612=v11973*v5482-*p;
+  v18461=v1339*v14742-*p;
+  v2203=v1626*v19813-*p;
+  v1821=v6997*v10656-*p;
+  v58=v5273*v984-*p;
+  v14244=v10570*v17094-*p;
+  v11562=v3608*v5631-*p;
+  v2118=v16463*v18247-*p;
+  v13408=v13351*v18432-*p;
+  v10034=v1395*v1033-*p;
+  v11070=v6148*v16417-*p;
+  v1019=v16703*v3503-*p;
+  v16697=v12501*v17580-*p;
+  v12405=v367*v5111-*p;
+  v14986=v5581*v3643-*p;
+  v7315=v18737*v12540-*p;
+  v6117=v6981*v19871-*p;
+  v10339=v929*v6942-*p;
+  v16647=v18221*v6424-*p;
+  v13337=v2483*v3529-*p;
+  v3989=v10859*v12301-*p;
+  v6615=v9256*v5085-*p;
+  v2783=v7410*v16739-*p;
+  v8100=v2211*v8494-*p;
+  v12064=v10129*v894-*p;
+  v5071=v1833*v12018-*p;
+  v6491=v16355*v11769-*p;
+  v10095=v12442*v18946-*p;
+  v9813=v18414*v3851-*p;
+  v17815=v3478*v15365-*p;
+  v7465=v1979*v3902-*p;
+  v13133=v1256*v12080-*p;
+  v1355=v14186*v4461-*p;
+  v9362=v6228*v18997-*p;
+  v16336=v10833*v18964-*p;
+  v11779=v19188*v14364-*p;
+  v19674=v3223*v13954-*p;
+  v10200=v5981*v3291-*p;
+  v8608=v11105*v19981-*p;
+  v9398=v6656*v12893-*p;
+  v13603=v4872*v12598-*p;
+  v19761=v13380*v7982-*p;
+  v17135=v1138*v3755-*p;
+  v2066=v5016*v19447-*p;
+  v12877=v11271*v4250-*p;
+  v1126=v14082*v11294-*p;
+  v10369=v15111*v1026-*p;
+  v5716=v1241*v1884-*p;
+  v3151=v12759*v4641-*p;
+  v9692=v15601*v4579-*p;
+  v5085=v1127*v1067-*p;
+  v6131=v14334*v6267-*p;
+  v7695=v1931*v9712-*p;
+  v15150=v17650*v15669-*p;
+  v2815=v12019*v8474-*p;
+  v8566=v16020*v8831-*p;
+  v9671=v7911*v1812-*p;
+  v15994=v16902*v17984-*p;
+  v5035=v11698*v3640-*p;
+  v19523=v6438*v4960-*p;
+  v16897=v7767*v19675-*p;
+  v4025=v16402*v13043-*p;
+  v19984=v6429*v8938-*p;
+  v13163=v16029*v19383-*p;
+  v17784=v867*v3678-*p;
+  v1321=v17134*v11811-*p;
+  v12072=v14948*v17107-*p;
+  v337=v2099*v13436-*p;
+  v11055=v11700*v13533-*p;
+  v2572=v1796*v19231-*p;
+  v2272=v1590*v8473-*p;
+  v16966=v5947*v13906-*p;
+  v12853=v14639*v13620-*p;
+  v13723=v5995*v8403-*p;
+  v17097=v10120*v7060-*p;
+  v17981=v15682*v1010-*p;
+  v12182=v1314*v2204-*p;
+  v6735=v19558*v336-*p;
+  v8844=v19240*v7170-*p;
+  v14047=v11915*v12737-*p;
+  v9788=v12390*v932-*p;
+  v6680=v17910*v3173-*p;
+  v5786=v2258*v1512-*p;
+  v14269=v15240*v14872-*p;
+  v10055=v1917*v17504-*p;
+  v7449=v13431*v14553-*p;
+  v5728=v14130*v124-*p;
+  v5910=v10762*v9957-*p;
+  v14847=v13042*v14729-*p;
+  v6912=v17968*v11209-*p;
+  v8599=v17967*v15691-*p;
+  v4850=v6044*v4754-*p;
+  v15711=v14250*v4515-*p;
+  v19670=v3261*v12425-*p;
+  v11100=v8876*v13366-*p;
+  v7713=v16857*v14161-*p;
+  v9353=v12798*v15907-*p;
+  v12574=v19658*v1072-*p;
+  v4409=v9182*v116-*p;
+  v19668=v10934*v1248-*p;
+  v5598=v1225*v12939-*p;
+  v5737=v8415*v18909-*p;
+  v14028=v2372*v2288-*p;
+  v17305=v9860*v16402-*p;
+  v17896=v15544*v5211-*p;
+  v7662=v5198*v17314-*p;
+  v1121=v18732*v9978-*p;
+  v13263=v16061*v6000-*p;
+  v18355=v26*v16275-*p;
+  v10469=v16857*v7320-*p;
+  v10528=v18512*v7010-*p;
+  v11036=v5788*v11163-*p;
+  v6113=v13247*v6461-*p;
+  v13075=v10511*v10029-*p;
+  v4059=v19746*v16577-*p;
+  v7580=v1771*v15674-*p;
+  v14147=v12923*v11294-*p;
+  v15877=v838*v11501-*p;
+  v14646=v791*v1348-*p;
+  v7091=v14875*v10774-*p;
+  v8759=v16053*v11977-*p;
+  v6322=v15744*v11987-*p;
+  v5458=v3938*v1129-*p;
+  v1878=v7195*v14749-*p;
+  v6565=v2971*v11602-*p;
+  v12614=v11381*v18063-*p;
+  v12703=v19932*v18493-*p;
+  v13012=v568*v7010-*p;
+  v4147=v10367*v6506-*p;
+  v5748=v1831*v7403-*p;
+  v18695=v14228*v9813-*p;
+  v18603=v17455*v11798-*p;
+  v6892=v5907*v18342-*p;
+  v11436=v18598*v417-*p;
+  v1438=v5286*v2392-*p;
+  v4655=v13533*v9204-*p;
+  v19547=v4243*v3316-*p;
+  v4832=v8008*v9456-*p;
+  v432=v1736*v3229-*p;
+  v2929=v17044*v5833-*p;
+  v11894=v10282*v5664-*p;
+  v16922=v19356*v7636-*p;
+  v5832=v4970*v8186-*p;
+  v18108=v5041*v17921-*p;
+  v19054=v3308*v8655-*p;
+  v14131=v10513*v8076-*p;
+  v2748=v14834*v19385-*p;
+  v6876=v19593*v5097-*p;
+  v3611=v18937*v9381-*p;
+  v15578=v14566*v15457-*p;
+  v11232=v19738*v17428-*p;
+  v6613=v18722*v14899-*p;
+  v4680=v18406*v7642-*p;
+  v7338=v10319*v10824-*p;
+  v10704=v15012*v10819-*p;
+  v1319=v4153*v11706-*p;
+  v18879=v747*v6260-*p;
+  v4511=v3534*v7644-*p;
+  v4622=v14660*v18182-*p;
+  v18334=v13559*v16996-*p;
+  v5325=v2519*v13041-*p;
+  v4701=v7157*v3311-*p;
+  v6499=v15133*v14245-*p;
+  v16757=v17783*v7182-*p;
+  v6729=v11484*v17672-*p;
+  v12371=v870*v17872-*p;
+  v18189=v4208*v12973-*p;
+  v17889=v13137*v8446-*p;
+  v1812=v10974*v14161-*p;
+  v3840=v10204*v2609-*p;
+  v13453=v18627*v7090-*p;
+  v16467=v11573*v1201-*p;
+  v6547=v19585*v15806-*p;
+  v5400=v9617*v12237-*p;
+  v7228=v5498*v15042-*p;
+  v915=v8260*v19604-*p;
+  v4767=v1390*v8039-*p;
+  v8173=v2650*v16802-*p;
+  v4305=v11935*v15139-*p;
+  v9088=v7112*v2308-*p;
+  v17892=v11524*v3006-*p;
+  v10154=v15539*v10573-*p;
+  v17619=v1140*v15596-*p;
+  v2204=v5826*v3662-*p;
+  v18858=v4191*v1367-*p;
+  v15534=v17734*v1478-*p;
+  v18855=v12411*v13645-*p;
+  v19846=v14869*v4421-*p;
+  v5758=v16042*v17568-*p;
+  v17696=v13642*v2644-*p;
+  v6029=v5766*v15060-*p;
+  v9581=v10909*v7728-*p;
+  v16617=v11985*v13534-*p;
+  v7163=v195*v12622-*p;
+  v10568=v3280*v970-*p;
+  v18135=v9959*v2864-*p;
+  v9872=v1400*v5442-*p;
+  v6385=v17058*v2179-*p;
+  v11811=v1815*v11792-*p;
+  v13787=v12759*v10728-*p;
+  v12375=v14837*v6151-*p;
+  v16955=v12930*v6331-*p;
+  v465=v4256*v19357-*p;
+  v3639=v14338*v18314-*p;
+  v1151=v507*v6246-*p;
+  v6445=v13820*v5876-*p;
+  v1003=v3524*v11697-*p;
+  v14995=v15081*v3779-*p;
+  v6619=v5196*v18812-*p;
+  v4907=v7644*v8878-*p;
+  v9645=v7392*v16914-*p;
+  v12837=v14761*v8350-*p;
+  v4085=v8107*v5548-*p;
+  v5830=v14716*v17357-*p;
+  v18544=v10661*v3586-*p;
+  v15735=v337*v19627-*p;
+  v11697=v7921*v14004-*p;
+  v6386=v19913*v3297-*p;
+  v18313=v10355*v10211-*p;
+  v5196=v8182*v9458-*p;
+  v8633=v12893*v7849-*p;
+  v1931=v16316*v16798-*p;
+  v11745=v8827*v13989-*p;
+  v16821=v15616*v12029-*p;
+  v11596=v19885*v13280-*p;
+  v19812=v16458*v509-*p;
+  v1406=v8509*v19144-*p;
+  v17549=v12972*v9482-*p;
+  v11572=v4396*v14823-*p;
+  v9380=v2287*v8647-*p;
+  v7113=v8224*v6951-*p;
+  v16790=v19646*v6683-*p;
+  v19291=v12195*v16788-*p;
+  v9727=v3992*v1463-*p;
+  v19667=v13621*v13540-*p;
+  v19892=v14096*v10039-*p;
+  v10525=v18348*v14917-*p;
+  v1122=v16768*v8032-*p;
+  v16939=v18106*v5199-*p;
+  v2279=v17784*v17967-*p;
+  v15459=v16070*v6223-*p;
+  v8519=v14797*v13779-*p;
+  v124=v16997*v7574-*p;
+  v6772=v15675*v9672-*p;
+  v12397=v10970*v3035-*p;
+  v13461=v3079*v8665-*p;
+  v19021=v17408*v15509-*p;
+  v2786=v991*v13670-*p;
+  v8350=v6456*v17493-*p;
+  v4221=v9226*v12502-*p;
+  v15143=v8475*v14258-*p;
+  v944=v7387*v19073-*p;
+  v9174=v1500*v17291-*p;
+  v5908=v13767*v7939-*p;
+  v2429=v14530*v1312-*p;
+  v19510=v17611*v18566-*p;
+  v16964=v15722*v3952-*p;
+  v4197=v14562*v5402-*p;
+  v19829=v15339*v11434-*p;
+  v7056=v6560*v11305-*p;
+  v3877=v4625*v345-*p;
+  v17638=v18615*v13518-*p;
+  v13783=v16938*v13646-*p;
+  v16406=v16495*v4793-*p;
+  v18657=v19258*v10679-*p;
+  v10460=v13487*v9671-*p;
+  v18245=v8263*v12876-*p;
+  v3116=v19832*v15506-*p;
+  v19267=v12252*v2186-*p;
+  v17035=v4831*v16193-*p;
+  v3465=v2983*v4300-*p;
+  v5166=v16723*v18412-*p;
+  v17070=v14603*v14249-*p;
+  v6520=v16376*v19530-*p;
+  v10563=v14097*v2925-*p;
+  v2956=v7384*v5100-*p;
+  v702=v4036*v16178-*p;
+  v11360=v649*v17122-*p;
+  v5191=v1784*v12426-*p;
+  v3135=v8794*v19311-*p;
+  v11895=v9679*v9044-*p;
+  v19787=v19925*v1938-*p;
+  v13456=v8895*v8092-*p;
+  v11349=v7093*v14192-*p;
+  v18867=v8059*v17145-*p;
+  v13973=v5724*v15717-*p;
+  v3764=v10916*v18486-*p;
+  v1455=v520*v105-*p;
+  v16926=v4160*v18702-*p;
+  v6435=v4236*v19776-*p;
+  v14119=v19695*v3846-*p;
+  v19139=v6720*v13254-*p;
+  v14646=v16115*v7709-*p;
+  v18750=v7798*v19351-*p;
+  v10370=v11094*v15598-*p;
+  v6692=v13271*v4287-*p;
+  v9420=v5121*v596-*p;
+  v17864=v1658*v854-*p;
+  v12153=v13224*v4135-*p;
+  v14736=v19280*v16408-*p;
+  v15613=v16561*v5522-*p;
+  v4765=v6392*v14788-*p;
+  v18422=v2808*v11739-*p;
+  v4599=v11309*v16005-*p;
+  v5535=v18856*v12215-*p;
+  v17517=v2859*v6918-*p;
+  v4638=v178*v6466-*p;
+  v7752=v215*v19257-*p;
+  v7344=v2179*v3775-*p;
+  v11017=v12651*v15085-*p;
+  v6990=v7050*v10431-*p;
+  v8658=v1079*v15350-*p;
+  v12195=v18624*v8832-*p;
+  v16527=v2498*v16414-*p;
+  v18287=v16803*v1123-*p;
+  v7733=v5886*v17932-*p;
+  v16041=v11721*v1968-*p;
+  v3460=v14745*v17664-*p;
+  v7554=v7522*v688-*p;
+  v9916=v388*v3214-*p;
+  v16288=v15760*v8800-*p;
+  v16002=v7620*v744-*p;
+  v17396=v16680*v2504-*p;
+  v6719=v6530*v6045-*p;
+  v6757=v19386*v9605-*p;
+  v2774=v5335*v3388-*p;
+  v18731=v1526*v9430-*p;
+  v9127=v14158*v1446-*p;
+  v14712=v3116*v19857-*p;
+  v7781=v11584*v7647-*p;
+  v16570=v18030*v8920-*p;
+  v2476=v14626*v9989-*p;
+  v15068=v14957*v8156-*p;
+  v14720=v8648*v11751-*p;
+  v4056=v1863*v12291-*p;
+  v16025=v5649*v5567-*p;
+  v13530=v10525*v12112-*p;
+  v15092=v771*v8995-*p;
+  v14723=v12033*v12697-*p;
+  v2576=v14436*v11995-*p;
+  v2184=v4315*v17797-*p;
+  v3424=v6852*v19053-*p;
+  v8570=v9350*v14724-*p;
+  v17310=v17913*v5126-*p;
+  v15705=v6138*v4470-*p;
+  v6806=v1*v4652-*p;
+  v8231=v13790*v12556-*p;
+  v3466=v7246*v13545-*p;
+  v11128=v9204*v13443-*p;
+  v6399=v1033*v17950-*p;
+  v995=v3621*v13131-*p;
+  v17168=v10714*v13256-*p;
+  v3675=v8567*v13714-*p;
+  v13027=v12912*v1500-*p;
+  v5380=v17694*v7828-*p;
+  v11230=v14865*v2301-*p;
+  v12099=v2215*v5156-*p;
+  v141=v5014*v7032-*p;
+  v19729=v16277*v10037-*p;
+  v5505=v11067*v6342-*p;
+  v15762=v18408*v1140-*p;
+  v19295=v1223*v15899-*p;
+  v14447=v4174*v11929-*p;
+  v11124=v17509*v3359-*p;
+  v18935=v5779*v3251-*p;
+  v353=v9958*v15162-*p;
+  v8667=v616*v8572-*p;
+  v2035=v7559*v13562-*p;
+  v2719=v562*v10798-*p;
+  v15485=v9344*v7666-*p;
+  v15357=v19289*v10609-*p;
+  v13120=v14971*v10251-*p;
+  v12563=v17020*v13359-*p;
+  v12688=v4540*v2176-*p;
+  v10099=v17630*v17839-*p;
+  v19034=v1590*v1263-*p;
+  v4479=v2209*v11109-*p;
+  v6797=v19691*v11421-*p;
+  v14553=v6038*v7274-*p;
+  v6012=v19285*v9774-*p;
+  v711=v9548*v8649-*p;
+  v7077=v736*v15062-*p;
+  v19131=v4351*v12430-*p;
+  v3025=v10069*v13719-*p;
+  v8777=v15874*v2036-*p;
+  v13803=v8525*v8605-*p;
+  v18661=v4183*v2962-*p;
+  v11522=v18492*v11616-*p;
+  v954=v6619*v15863-*p;
+  v16491=v12415*v11226-*p;
+  v3226=v13541*v10632-*p;
+  v8584=v7934*v8380-*p;
+  v10572=v19253*v6054-*p;
+  v15057=v15046*v2952-*p;
+  v9527=v5853*v1350-*p;
+  v17228=v6255*v8431-*p;
+  v19955=v13672*v4032-*p;
+  v6662=v14246*v15859-*p;
+  v18968=v6419*v13410-*p;
+  v9955=v15169*v16186-*p;
+  v15355=v3622*v12430-*p;
+  v506=v14898*v19648-*p;
+  v10059=v17523*v4083-*p;
+  v14935=v15191*v7750-*p;
+  v2506=v13930*v11068-*p;
+  v19352=v14762*v8-*p;
+  v1348=v7726*v3863-*p;
+  v11699=v8227*v12322-*p;
+  v3451=v3077*v10989-*p;
+  v2239=v16719*v14576-*p;
+  v12540=v16537*v19137-*p;
+  v3368=v12049*v17392-*p;
+  v14418=v12134*v17071-*p;
+  v7752=v10526*v17065-*p;
+  v5257=v9504*v608-*p;
+  v8373=v4153*v558-*p;
+  v18717=v11808*v1659-*p;
+  v9029=v14782*v7408-*p;
+  v3017=v9238*v7698-*p;
+  v13893=v12435*v18967-*p;
+  v16017=v5819*v507-*p;
+  v19729=v16843*v4516-*p;
+  v7722=v2759*v187-*p;
+  v1957=v5176*v11562-*p;
+  v16631=v375*v5549-*p;
+  v4938=v2707*v4536-*p;
+  v17707=v12547*v11007-*p;
+  v7191=v12786*v19312-*p;
+  v9771=v17626*v17558-*p;
+  v8480=v9044*v10512-*p;
+  v14319=v848*v3150-*p;
+  v11008=v7961*v1345-*p;
+  v10982=v100*v5427-*p;
+  v17957=v5189*v14342-*p;
+  v5761=v2851*v497-*p;
+  v7644=v17106*v4057-*p;
+  v10103=v15224*v9999-*p;
+  v19130=v8945*v15749-*p;
+  v19656=v15270*v13415-*p;
+  v9251=v14805*v8475-*p;
+  v7405=v17744*v7035-*p;
+  v7071=v8101*v5102-*p;
+  v17985=v15802*v16145-*p;
+  v18510=v5635*v7487-*p;
+  v4047=v17440*v14502-*p;
+  v15647=v13582*v7479-*p;
+  v19860=v10618*v1313-*p;
+  v7926=v8685*v15540-*p;
+  v10813=v18389*v11931-*p;
+  v12835=v19295*v6762-*p;
+  v14246=v10773*v2482-*p;
+  v16034=v12382*v643-*p;
+  v15418=v15660*v15798-*p;
+  v6222=v5344*v6886-*p;
+  v1449=v1527*v19866-*p;
+  v19722=v15695*v19387-*p;
+  v15799=v1959*v9708-*p;
+  v8589=v5233*v2876-*p;
+  v15162=v11931*v13170-*p;
+  v542=v301*v14435-*p;
+  v15671=v18751*v17830-*p;
+  v14432=v17877*v14766-*p;
+  v620=v15391*v14636-*p;
+  v7451=v11137*v3353-*p;
+  v11956=v15223*v12926-*p;
+  v1668=v12469*v15182-*p;
+  v12392=v3312*v11407-*p;
+  v6543=v5238*v17436-*p;
+  v4418=v13714*v8895-*p;
+  v4335=v2689*v3571-*p;
+  v19645=v6586*v12762-*p;
+  v7884=v3212*v6750-*p;
+  v6277=v17119*v16875-*p;
+  v5474=v152*v5647-*p;
+  v1838=v3626*v5496-*p;
+  v1277=v12232*v11547-*p;
+  v2289=v12673*v369-*p;
+  v4984=v9694*v4832-*p;
+  v15998=v18447*v11711-*p;
+  v3798=v4157*v7399-*p;
+  v8859=v2991*v1006-*p;
+  v6756=v12816*v12728-*p;
+  v19508=v13280*v19785-*p;
+  v8767=v8240*v16837-*p;
+  v8690=v8256*v4457-*p;
+  v14292=v4944*v15543-*p;
+  v15451=v18328*v5608-*p;
+  v9617=v19316*v8231-*p;
+  v13534=v8613*v2887-*p;
+  v16790=v127*v1258-*p;
+  v8779=v13068*v5538-*p;
+  v2110=v905*v15364-*p;
+  v1906=v16633*v14154-*p;
+  v10887=v16197*v4932-*p;
+  v19773=v19910*v657-*p;
+  v2035=v6852*v2135-*p;
+  v816=v17724*v11221-*p;
+  v16967=v3001*v13891-*p;
+  v6904=v19696*v1519-*p;
+  v1105=v2166*v350-*p;
+  v16913=v11356*v16099-*p;
+  v3645=v11992*v9477-*p;
+  v9005=v71*v1772-*p;
+  v18037=v1270*v17629-*p;
+  v15996=v19886*v13221-*p;
+  v5259=v1625*v12973-*p;
+  v16290=v10805*v9663-*p;
+  v3674=v8208*v6854-*p;
+  v18294=v1761*v16980-*p;
+  v1229=v14921*v12538-*p;
+  v170=v15451*v16366-*p;
+  v5172=v19044*v15615-*p;
+  v7113=v19990*v11-*p;
+  v19445=v11650*v4877-*p;
+  v15119=v7599*v4522-*p;
+  v1179=v3136*v3185-*p;
+  v8460=v12271*v9758-*p;
+  v904=v14840*v11954-*p;
+  v10374=v15294*v6747-*p;
+  v11220=v17935*v7444-*p;
+  v11072=v658*v13212-*p;
+  v956=v2538*v4303-*p;
+  v8217=v12838*v15086-*p;
+  v1488=v12395*v7227-*p;
+  v9060=v14813*v13493-*p;
+  v12893=v18522*v18111-*p;
+  v17661=v19292*v15189-*p;
+  v14261=v19311*v5239-*p;
+  v12274=v11251*v346-*p;
+  v17296=v14933*v5050-*p;
+  v11517=v19302*v6034-*p;
+  v15472=v4869*v10333-*p;
+  v9813=v6456*v13284-*p;
+  v10373=v4377*v9085-*p;
+  v19361=v12065*v13239-*p;
+  v11749=v8670*v19645-*p;
+  v5574=v15442*v19068-*p;
+  v9766=v19659*v12649-*p;
+  v3213=v9373*v4187-*p;
+  v7503=v18101*v12763-*p;
+  v8103=v14310*v10212-*p;
+  v10103=v16749*v10545-*p;
+  v16727=v12737*v16863-*p;
+  v14535=v8116*v17459-*p;
+  v9200=v6530*v18345-*p;
+  v7060=v14095*v10731-*p;
+  v5905=v16707*v19597-*p;
+  v5589=v5091*v8196-*p;
+  v5527=v1220*v1144-*p;
+  v17236=v11168*v14543-*p;
+  v6506=v18809*v6763-*p;
+  v13931=v8898*v10042-*p;
+  v15947=v19897*v13891-*p;
+  v8149=v3161*v4500-*p;
+  v4564=v18873*v8693-*p;
+  v5816=v10574*v15694-*p;
+  v1987=v19662*v16449-*p;
+  v13727=v1084*v18304-*p;
+  v7301=v9585*v8040-*p;
+  v3028=v408*v3208-*p;
+  v18004=v8534*v16242-*p;
+  v10067=v8550*v4638-*p;
+  v16081=v14775*v1344-*p;
+  v6831=v5035*v15448-*p;
+  v13837=v2278*v13673-*p;
+  v19609=v4054*v17096-*p;
+  v8081=v14816*v12611-*p;
+  v729=v17448*v11730-*p;
+  v10960=v9350*v17232-*p;
+  v18291=v10132*v3929-*p;
+  v18294=v12785*v8570-*p;
+  v18962=v14992*v10586-*p;
+  v1443=v10124*v12854-*p;
+  v9246=v781*v17596-*p;
+  v11621=v19604*v7701-*p;
+  v13629=v18074*v8887-*p;
+  v2443=v10857*v16384-*p;
+  v12149=v11293*v8783-*p;
+  v10165=v17183*v15063-*p;
+  v2585=v8350*v19218-*p;
+  v17477=v14101*v16577-*p;
+  v6335=v9750*v6560-*p;
+  v19337=v15393*v16851-*p;
+  v14851=v12850*v5095-*p;
+  v11516=v12684*v19440-*p;
+  v12504=v5821*v18542-*p;
+  v17377=v8950*v7106-*p;
+  v4844=v19897*v919-*p;
+  v4001=v1160*v3682-*p;
+  v14871=v4297*v13294-*p;
+  v11578=v18493*v14410-*p;
+  v1509=v10116*v11050-*p;
+  v9899=v6825*v10301-*p;
+  v10555=v18869*v10201-*p;
+  v2976=v10698*v10642-*p;
+  v8566=v7330*v10144-*p;
+  v18830=v2088*v11115-*p;
+  v19696=v6950*v11962-*p;
+  v1710=v13639*v14213-*p;
+  v5927=v6272*v9228-*p;
+  v5776=v12483*v6697-*p;
+  v8096=v13386*v8656-*p;
+  v14838=v19728*v3012-*p;
+  v2293=v3475*v5441-*p;
+  v8006=v8455*v16398-*p;
+  v2640=v10706*v10912-*p;
+  v19144=v15137*v5025-*p;
+  v17555=v966*v17765-*p;
+  v18199=v15034*v9698-*p;
+  v8674=v14359*v12380-*p;
+  v10420=v4741*v12287-*p;
+  v8045=v18047*v10109-*p;
+  v18897=v19249*v186-*p;
+  v9627=v11156*v3595-*p;
+  v11001=v10975*v2013-*p;
+  v18751=v13612*v6305-*p;
+  v379=v4910*v1201-*p;
+  v8639=v14750*v13443-*p;
+  v19700=v15493*v16976-*p;
+  v7234=v2293*v6260-*p;
+  v13933=v11453*v2831-*p;
+  v3275=v1938*v4701-*p;
+  v1532=v10599*v3742-*p;
+  v7548=v5842*v14319-*p;
+  v17086=v7598*v13049-*p;
+  v10508=v6208*v9538-*p;
+  v3937=v5762*v18327-*p;
+  v2267=v12708*v13579-*p;
+  v16173=v4390*v19071-*p;
+  v18004=v7721*v11147-*p;
+  v7703=v5936*v6832-*p;
+  v14002=v11681*v1104-*p;
+  v17026=v12367*v10999-*p;
+  v11925=v11751*v5773-*p;
+  v14903=v2970*v2440-*p;
+  v2892=v6782*v11935-*p;
+  v879=v9249*v16652-*p;
+  v17393=v15495*v2754-*p;
+  v13369=v9246*v8531-*p;
+  v16335=v1299*v13694-*p;
+  v18898=v9673*v13216-*p;
+  v8098=v8920*v10726-*p;
+  v9095=v686*v4019-*p;
+  v18552=v12854*v17351-*p;
+  v14056=v13500*v18375-*p;
+  v26=v17464*v901-*p;
+  v16851=v5243*v9314-*p;
+  v15851=v334*v424-*p;
+  v6475=v9518*v8330-*p;
+  v10253=v18351*v12219-*p;
+  v13207=v8288*v14704-*p;
+  v18649=v1575*v6783-*p;
+  v13406=v17949*v85-*p;
+  v7315=v10750*v12319-*p;
+  v19255=v9043*v3848-*p;
+  v2243=v7772*v1829-*p;
+  v3164=v8249*v672-*p;
+  v197=v15409*v6116-*p;
+  v19707=v1720*v3354-*p;
+  v4522=v17706*v5354-*p;
+  v6720=v15632*v19942-*p;
+  v5244=v9924*v5069-*p;
+  v4866=v18585*v2448-*p;
+  v1706=v17973*v15074-*p;
+  v11866=v6514*v11956-*p;
+  v11666=v10096*v12611-*p;
+  v6263=v3764*v4316-*p;
+  v11676=v7318*v16864-*p;
+  v17990=v2662*v18014-*p;
+  v18834=v19674*v1385-*p;
+  v8034=v8624*v10582-*p;
+  v13024=v14798*v14313-*p;
+  v5803=v18212*v134-*p;
+  v11413=v6040*v12828-*p;
+  v4320=v10025*v2311-*p;
+  v11856=v13577*v16484-*p;
+  v18798=v18609*v6852-*p;
+  v12162=v6567*v6382-*p;
+  v2049=v14947*v11709-*p;
+  v7967=v269*v8380-*p;
+  v12777=v2642*v120-*p;
+  v17071=v16151*v19849-*p;
+  v3584=v8594*v18098-*p;
+  v15461=v12227*v7256-*p;
+  v14297=v12981*v13575-*p;
+  v4298=v577*v10147-*p;
+  v13710=v18157*v7871-*p;
+  v16088=v5665*v7345-*p;
+  v8981=v5056*v968-*p;
+  v10693=v16293*v3852-*p;
+  v5919=v16917*v5356-*p;
+  v4373=v6079*v5242-*p;
+  v8714=v8067*v9278-*p;
+  v1337=v15173*v18282-*p;
+  v15314=v14158*v12059-*p;
+  v16675=v2116*v14564-*p;
+  v1023=v15434*v8895-*p;
+  v624=v4395*v17990-*p;
+  v9632=v2076*v16523-*p;
+  v9667=v17053*v2505-*p;
+  v11718=v16031*v6126-*p;
+  v3165=v4600*v6453-*p;
+  v3244=v8922*v16835-*p;
+  v7378=v9435*v13564-*p;
+  v4381=v5383*v16057-*p;
+  v6241=v9502*v19668-*p;
+  v12625=v18995*v1265-*p;
+  v15043=v7822*v15309-*p;
+  v16006=v18284*v12941-*p;
+  v2303=v4651*v12138-*p;
+  v4463=v2843*v14178-*p;
+  v12789=v2843*v379-*p;
+  v9083=v10482*v6508-*p;
+  v1791=v1541*v16788-*p;
+  v3992=v4591*v15180-*p;
+  v15897=v8037*v19426-*p;
+  v3447=v15668*v10409-*p;
+  v705=v4835*v15314-*p;
+  v19598=v3922*v1157-*p;
+  v11686=v15821*v1177-*p;
+  v6381=v15506*v12286-*p;
+  v16461=v2464*v6324-*p;
+  v13931=v4208*v13255-*p;
+  v90=v16918*v4151-*p;
+  v4066=v2918*v4817-*p;
+  v8174=v3386*v4832-*p;
+  v2879=v3028*v13360-*p;
+  v10132=v17879*v16701-*p;
+  v10047=v6107*v17085-*p;
+  v8138=v13259*v4757-*p;
+  v12494=v8523*v16440-*p;
+  v13157=v4584*v5734-*p;
+  v1920=v19577*v7182-*p;
+  v10736=v51*v10844-*p;
+  v8595=v9447*v18426-*p;
+  v9486=v18719*v12989-*p;
+  v19559=v8815*v440-*p;
+  v9420=v15471*v3894-*p;
+  v5378=v4753*v10842-*p;
+  v644=v12925*v8982-*p;
+  v15418=v19944*v8658-*p;
+  v15572=v6258*v9981-*p;
+  v13911=v14819*v14518-*p;
+  v14053=v14097*v12523-*p;
+  v14189=v9830*v16-*p;
+  v6919=v3516*v1444-*p;
+  v3252=v11216*v1536-*p;
+  v6709=v6763*v5520-*p;
+  v589=v7053*v15617-*p;
+  v181=v17275*v18439-*p;
+  v5020=v11260*v639-*p;
+  v164=v1311*v17441-*p;
+  v9015=v11814*v13708-*p;
+  v10626=v19834*v19789-*p;
+  v7751=v4839*v761-*p;
+  v13939=v6054*v12399-*p;
+  v16949=v17143*v8800-*p;
+  v7486=v4695*v19928-*p;
+  v4009=v17426*v10121-*p;
+  v3278=v14335*v16023-*p;
+  v16136=v11653*v665-*p;
+  v17339=v15070*v17731-*p;
+  v3274=v2377*v3910-*p;
+  v8917=v17945*v16637-*p;
+  v9286=v9223*v16973-*p;
+  v9448=v791*v16580-*p;
+  v15759=v19699*v12986-*p;
+  v9334=v9669*v4673-*p;
+  v10461=v7373*v253-*p;
+  v5892=v6332*v15559-*p;
+  v2489=v17*v18398-*p;
+  v16149=v4942*v1309-*p;
+  v3937=v1280*v12773-*p;
+  v7826=v9709*v9191-*p;
+  v17619=v19653*v1189-*p;
+  v6913=v5620*v6165-*p;
+  v12965=v9433*v14142-*p;
+  v2596=v194*v6317-*p;
+  v16408=v19628*v15139-*p;
+  v267=v5895*v13272-*p;
+  v12818=v2267*v7304-*p;
+  v19357=v17198*v2314-*p;
+  v1184=v17100*v10730-*p;
+  v10923=v13392*v9556-*p;
+  v2924=v4849*v12784-*p;
+  v7284=v9840*v13067-*p;
+  v9058=v8282*v10952-*p;
+  v8860=v1531*v17974-*p;
+  v3796=v16868*v15576-*p;
+  v19618=v8562*v8007-*p;
+  v17989=v3359*v6482-*p;
+  v953=v8126*v390-*p;
+  v6494=v5909*v8800-*p;
+  v1284=v19616*v16358-*p;
+  v16808=v8715*v14175-*p;
+  v15620=v1425*v17283-*p;
+  v2255=v13092*v9792-*p;
+  v9470=v1520*v10720-*p;
+  v4999=v9688*v13173-*p;
+  v16378=v259*v2549-*p;
+  v263=v4406*v1846-*p;
+  v1184=v12559*v7859-*p;
+  v12403=v18013*v2007-*p;
+  v3506=v9802*v1502-*p;
+  v1187=v18712*v5798-*p;
+  v7=v4975*v19773-*p;
+  v9865=v7839*v15642-*p;
+  v14=v5434*v2575-*p;
+  v2171=v13215*v3495-*p;
+  v76=v6065*v8184-*p;
+  v15379=v12534*v15366-*p;
+  v2354=v9654*v19721-*p;
+  v72=v10470*v11220-*p;
+  v10626=v9487*v6669-*p;
+  v17435=v7000*v14675-*p;
+  v13715=v56*v5505-*p;
+  v12989=v16025*v7426-*p;
+  v6811=v1489*v4557-*p;
+  v5494=v7110*v14139-*p;
+  v6820=v3026*v9206-*p;
+  v17268=v18773*v411-*p;
+  v2364=v866*v19331-*p;
+  v5681=v3307*v4962-*p;
+  v3793=v3338*v2602-*p;
+  v1140=v17048*v1794-*p;
+  v10222=v19716*v2688-*p;
+  v19405=v656*v7930-*p;
+  v11622=v3017*v17293-*p;
+  v4993=v18010*v8981-*p;
+  v7214=v874*v17126-*p;
+  v17055=v17785*v7628-*p;
+  v5112=v9960*v8445-*p;
+  v18130=v13242*v1289-*p;
+  v19459=v2399*v11193-*p;
+  v6244=v4540*v18370-*p;
+  v15740=v18501*v12169-*p;
+  v1031=v3739*v1015-*p;
+  v8567=v5195*v15495-*p;
+  v18236=v16336*v13365-*p;
+  v11972=v15223*v3356-*p;
+  v2064=v4580*v13130-*p;
+  v17003=v5861*v16049-*p;
+  v14659=v11383*v19930-*p;
+  v15178=v1980*v13565-*p;
+  v4800=v10974*v11182-*p;
+  v3501=v16735*v17285-*p;
+  v17905=v10739*v6962-*p;
+  v2990=v12537*v8129-*p;
+  v15889=v14309*v10158-*p;
+  v16542=v10540*v2093-*p;
+  v2980=v14435*v799-*p;
+  v4433=v6636*v5318-*p;
+  v636=v233*v10931-*p;
+  v2826=v15456*v19330-*p;
+  v26=v7661*v7505-*p;
+  v28=v6330*v18575-*p;
+  v2718=v3568*v10866-*p;
+  v13675=v14921*v296-*p;
+  v4387=v2970*v19460-*p;
+  v15362=v6059*v17893-*p;
+  v3123=v4415*v17280-*p;
+  v12404=v7529*v16754-*p;
+  v2600=v7116*v18910-*p;
+  v19383=v15323*v5275-*p;
+  v3210=v503*v12883-*p;
+  v6785=v7706*v4470-*p;
+  v10103=v15467*v4552-*p;
+  v14627=v1973*v11153-*p;
+  v13907=v11648*v5640-*p;
+  v6405=v6165*v14616-*p;
+  v18012=v11646*v8484-*p;
+  v15808=v603*v3564-*p;
+  v15364=v1667*v13788-*p;
+  v8331=v18922*v5713-*p;
+  v1707=v10567*v13047-*p;
+  v5419=v56*v1641-*p;
+  v6532=v2409*v13435-*p;
+  v5952=v8648*v4358-*p;
+  v13081=v4698*v3449-*p;
+  v12581=v3108*v14556-*p;
+  v14774=v12658*v14743-*p;
+  v8085=v9827*v19813-*p;
+  v18736=v8536*v9745-*p;
+  v11920=v4935*v14427-*p;
+  v14277=v9696*v15746-*p;
+  v6231=v9987*v1715-*p;
+  v15475=v6504*v6670-*p;
+  v2698=v967*v12982-*p;
+  v12045=v646*v15203-*p;
+  v19804=v2885*v12890-*p;
+  v12098=v8423*v5478-*p;
+  v11035=v2408*v15515-*p;
+  v6873=v5756*v2347-*p;
+  v13883=v18575*v536-*p;
+  v15275=v19718*v12648-*p;
+  v6494=v8198*v3115-*p;
+  v5934=v15655*v15265-*p;
+  v14208=v12695*v19568-*p;
+  v7470=v15670*v18625-*p;
+  v3955=v10438*v18048-*p;
+  v16535=v9071*v3683-*p;
+  v3409=v5345*v17449-*p;
+  v9459=v8295*v7541-*p;
+  v4682=v16899*v422-*p;
+  v7471=v17047*v17215-*p;
+  v5909=v3884*v17830-*p;
+  v11420=v19820*v6825-*p;
+  v18573=v16089*v13909-*p;
+  v11101=v3070*v4940-*p;
+  v16131=v15298*v12414-*p;
+  v4109=v7323*v19376-*p;
+  v8591=v19838*v201-*p;
+  v3581=v2824*v8305-*p;
+  v18157=v534*v4545-*p;
+  v15048=v9822*v4161-*p;
+  v17598=v13493*v10908-*p;
+  v1094=v14009*v7914-*p;
+  v15824=v4481*v4954-*p;
+  v4610=v5726*v17080-*p;
+  v19309=v17463*v5617-*p;
+  v11558=v13531*v5990-*p;
+  v4819=v9943*v14589-*p;
+  v16106=v11985*v17611-*p;
+  v7132=v1614*v665-*p;
+  v11979=v2576*v12516-*p;
+  v19343=v919*v7109-*p;
+  v13597=v16710*v8533-*p;
+  v308=v7805*v8333-*p;
+  v14636=v15833*v13914-*p;
+  v8475=v12036*v2912-*p;
+  v12575=v1718*v11969-*p;
+  v2046=v18005*v12142-*p;
+  v18386=v16158*v6883-*p;
+  v8419=v17278*v2200-*p;
+  v13971=v16552*v2070-*p;
+  v2822=v2360*v15493-*p;
+  v2581=v18606*v15397-*p;
+  v1813=v11303*v13219-*p;
+  v782=v17840*v1101-*p;
+  v2647=v6969*v19116-*p;
+  v5303=v11370*v14576-*p;
+  v10107=v17323*v1554-*p;
+  v6839=v15335*v11727-*p;
+  v2735=v15210*v1552-*p;
+  v7724=v2889*v1511-*p;
+  v2985=v12949*v15524-*p;
+  v14011=v17655*v2525-*p;
+  v19125=v1269*v11635-*p;
+  v7994=v789*v5702-*p;
+  v13975=v13325*v12522-*p;
+  v5739=v17555*v1397-*p;
+  v8885=v8323*v1870-*p;
+  v16533=v17597*v6927-*p;
+  v4535=v6673*v4336-*p;
+  v4098=v19204*v17896-*p;
+  v12576=v8830*v3031-*p;
+  v13863=v3505*v8046-*p;
+  v9969=v3894*v15738-*p;
+  v14508=v12861*v9467-*p;
+  v13975=v5155*v4453-*p;
+  v13395=v15746*v5841-*p;
+  v12839=v13845*v8799-*p;
+  v14515=v6156*v15224-*p;
+  v8103=v18566*v16876-*p;
+  v15196=v15451*v4443-*p;
+  v1826=v4188*v10685-*p;
+  v12073=v3466*v8097-*p;
+  v3125=v9819*v14877-*p;
+  v6241=v4732*v8079-*p;
+  v10426=v16178*v4936-*p;
+  v18752=v17217*v4898-*p;
+  v6438=v15921*v17325-*p;
+  v8941=v3190*v11392-*p;
+  v3803=v2094*v370-*p;
+  v35=v12631*v6475-*p;
+  v12111=v9168*v18416-*p;
+  v6553=v11302*v7346-*p;
+  v18694=v5388*v181-*p;
+  v14524=v4166*v18516-*p;
+  v13748=v18212*v15296-*p;
+  v14982=v4638*v13904-*p;
+  v8884=v15608*v12098-*p;
+  v14596=v15453*v10021-*p;
+  v8203=v3325*v8977-*p;
+  v14054=v14876*v16010-*p;
+  v15650=v19502*v16278-*p;
+  v17337=v17628*v18244-*p;
+  v14179=v14056*v18604-*p;
+  v4188=v19569*v7437-*p;
+  v2828=v15032*v7940-*p;
+  v268=v14527*v19723-*p;
+  v314=v3222*v12478-*p;
+  v3020=v3308*v13614-*p;
+  v14034=v2963*v12334-*p;
+  v8006=v6074*v5728-*p;
+  v2604=v11257*v16384-*p;
+  v1065=v1771*v2731-*p;
+  v7974=v2594*v19786-*p;
+  v14120=v16652*v6653-*p;
+  v16719=v14186*v19711-*p;
+  v9433=v4653*v4041-*p;
+  v11198=v7221*v8844-*p;
+  v10007=v712*v16711-*p;
+  v15931=v3985*v15108-*p;
+  v13966=v8517*v19600-*p;
+  v11608=v17371*v9054-*p;
+  v6092=v1208*v922-*p;
+  v16344=v12642*v11746-*p;
+  v12255=v3540*v4734-*p;
+  v15744=v8596*v15084-*p;
+  v2336=v8307*v11267-*p;
+  v8043=v14522*v272-*p;
+  v991=v13028*v4662-*p;
+  v8844=v15339*v11109-*p;
+  v5762=v5680*v4960-*p;
+  v11531=v3127*v11007-*p;
+  v1630=v1751*v4070-*p;
+  v19116=v1531*v3967-*p;
+  v7716=v7199*v18140-*p;
+  v4965=v8058*v10146-*p;
+  v19857=v511*v5398-*p;
+  v1701=v6754*v9367-*p;
+  v3721=v10312*v16494-*p;
+  v8509=v14094*v18863-*p;
+  v18034=v11919*v841-*p;
+  v14955=v12716*v8099-*p;
+  v9254=v4925*v15551-*p;
+  v14259=v8514*v4913-*p;
+  v4050=v2029*v8841-*p;
+  v14860=v11863*v8067-*p;
+  v18522=v1838*v14381-*p;
+  v15069=v11718*v13243-*p;
+  v17909=v15100*v9006-*p;
+  v997=v3504*v7883-*p;
+  v17792=v6022*v9515-*p;
+  v1989=v15191*v18168-*p;
+  v8675=v14331*v8125-*p;
+  v9725=v10313*v441-*p;
+  v16971=v6009*v12350-*p;
+  v17906=v14146*v19929-*p;
+  v2326=v3418*v19239-*p;
+  v12207=v3394*v15865-*p;
+  v2974=v4699*v14292-*p;
+  v3721=v6719*v15724-*p;
+  v2837=v16453*v7142-*p;
+  v2288=v1230*v11384-*p;
+  v14921=v2275*v12550-*p;
+  v18593=v9547*v6940-*p;
+  v14095=v14647*v9736-*p;
+  v4519=v266*v6869-*p;
+  v13053=v19896*v19887-*p;
+  v1276=v8480*v5705-*p;
+  v5612=v6348*v13921-*p;
+  v17870=v5678*v15468-*p;
+  v6582=v2698*v12889-*p;
+  v8364=v13899*v3768-*p;
+  v7848=v11139*v13546-*p;
+  v9762=v2015*v983-*p;
+  v11315=v3053*v19312-*p;
+  v15636=v9730*v13790-*p;
+  v9565=v1310*v19415-*p;
+  v6756=v5528*v7613-*p;
+  v18286=v17756*v4461-*p;
+  v13013=v4540*v9217-*p;
+  v7542=v10881*v19939-*p;
+  v8290=v2736*v3439-*p;
+  v9065=v6990*v2604-*p;
+  v15594=v2471*v8029-*p;
+  v8149=v9439*v10426-*p;
+  v19738=v16597*v1192-*p;
+  v18630=v19570*v17093-*p;
+  v25=v6478*v6376-*p;
+  v4906=v16330*v1080-*p;
+  v1363=v15830*v17587-*p;
+  v18988=v6291*v14955-*p;
+  v15394=v1921*v10380-*p;
+  v11701=v12336*v1151-*p;
+  v2864=v223*v12347-*p;
+  v1816=v14658*v13594-*p;
+  v611=v10691*v18319-*p;
+  v1169=v8921*v8819-*p;
+  v6278=v13981*v13061-*p;
+  v11360=v11922*v8351-*p;
+  v8508=v15795*v19371-*p;
+  v9269=v1036*v16437-*p;
+  v10396=v9931*v15611-*p;
+  v3225=v3256*v6502-*p;
+  v18998=v10745*v15215-*p;
+  v7920=v3917*v18695-*p;
+  v3755=v2224*v4809-*p;
+  v10971=v819*v1610-*p;
+  v9061=v16794*v783-*p;
+  v9667=v6300*v7820-*p;
+  v17390=v4157*v5137-*p;
+  v11113=v4250*v15142-*p;
+  v3442=v8107*v18825-*p;
+  v15489=v9223*v3639-*p;
+  v15704=v15708*v13565-*p;
+  v4391=v19971*v1636-*p;
+  v8181=v8801*v16558-*p;
+  v504=v9916*v6725-*p;
+  v19324=v7904*v12138-*p;
+  v7712=v10836*v14361-*p;
+  v5725=v1827*v10596-*p;
+  v2000=v3694*v1513-*p;
+  v3663=v18377*v19873-*p;
+  v17281=v10913*v7243-*p;
+  v12606=v16012*v5837-*p;
+  v19507=v3492*v6557-*p;
+  v13329=v17142*v15044-*p;
+  v14140=v13108*v8216-*p;
+  v6859=v1630*v2535-*p;
+  v10905=v12841*v3716-*p;
+  v12704=v19195*v10348-*p;
+  v16592=v18164*v11292-*p;
+  v18561=v5461*v11996-*p;
+  v8676=v16155*v1718-*p;
+  v14232=v445*v16565-*p;
+  v1437=v9936*v19272-*p;
+  v17320=v19991*v8633-*p;
+  v1409=v14971*v19905-*p;
+  v15458=v5138*v1136-*p;
+  v3611=v19111*v9381-*p;
+  v3073=v19335*v8681-*p;
+  v13237=v970*v10566-*p;
+  v257=v5271*v97-*p;
+  v16692=v1389*v16069-*p;
+  v9363=v3531*v11697-*p;
+  v4464=v10782*v7842-*p;
+  v2625=v6018*v16027-*p;
+  v654=v14927*v13706-*p;
+  v15680=v1654*v920-*p;
+  v18000=v19782*v18798-*p;
+  v7165=v12177*v6552-*p;
+  v647=v9582*v156-*p;
+  v17852=v5125*v12485-*p;
+  v95=v607*v13504-*p;
+  v5615=v349*v19461-*p;
+  v14737=v4756*v2014-*p;
+  v17121=v13472*v16705-*p;
+  v14962=v18037*v12778-*p;
+  v8607=v15875*v18843-*p;
+  v6395=v12711*v16620-*p;
+  v1651=v17591*v859-*p;
+  v845=v1649*v5678-*p;
+  v17327=v12984*v6976-*p;
+  v14830=v1274*v12713-*p;
+  v5469=v328*v6864-*p;
+  v1824=v18143*v15575-*p;
+  v18129=v1884*v10269-*p;
+  v14591=v6280*v13830-*p;
+  v16622=v1598*v13139-*p;
+  v11744=v14127*v17002-*p;
+  v206=v3352*v3333-*p;
+  v413=v17513*v7653-*p;
+  v15480=v5492*v17025-*p;
+  v2854=v9328*v56-*p;
+  v2024=v8907*v18157-*p;
+  v9607=v12970*v5010-*p;
+  v14645=v1460*v4259-*p;
+  v17580=v18478*v13478-*p;
+  v2762=v17130*v9474-*p;
+  v13207=v18783*v12735-*p;
+  v11230=v13251*v17074-*p;
+  v1300=v15582*v16558-*p;
+  v9271=v2671*v16442-*p;
+  v15204=v10877*v3391-*p;
+  v3289=v10563*v2221-*p;
+  v4680=v8728*v15918-*p;
+  v11949=v13258*v2374-*p;
+  v11213=v2949*v2554-*p;
+  v16121=v1610*v16900-*p;
+  v2792=v5297*v14960-*p;
+  v8926=v2347*v4022-*p;
+  v2888=v6942*v16682-*p;
+  v19825=v9868*v8785-*p;
+  v8223=v12077*v8991-*p;
+  v8312=v4776*v6780-*p;
+  v1693=v17457*v11750-*p;
+  v1983=v8641*v1805-*p;
+  v13295=v14443*v14022-*p;
+  v18419=v17167*v6120-*p;
+  v6013=v10869*v5421-*p;
+  v14885=v12874*v5202-*p;
+  v4790=v9143*v12156-*p;
+  v15586=v8933*v15211-*p;
+  v3226=v17117*v13725-*p;
+  v3417=v12787*v12398-*p;
+  v18835=v15393*v9114-*p;
+  v15695=v12726*v16780-*p;
+  v10656=v17402*v9544-*p;
+  v1741=v17382*v16472-*p;
+  v14406=v2186*v6825-*p;
+  v2559=v2562*v4388-*p;
+  v19544=v2175*v19219-*p;
+  v13031=v13766*v17261-*p;
+  v17533=v1170*v6382-*p;
+  v16376=v5316*v5927-*p;
+  v647=v7219*v10836-*p;
+  v8126=v14790*v5703-*p;
+  v7242=v10216*v9008-*p;
+  v4241=v7474*v17759-*p;
+  v3076=v14090*v18729-*p;
+  v15976=v3674*v15726-*p;
+  v19750=v16321*v8833-*p;
+  v1184=v458*v5233-*p;
+  v11500=v15481*v6722-*p;
+  v1840=v9448*v9692-*p;
+  v12867=v3132*v15769-*p;
+  v3915=v11664*v141-*p;
+  v18115=v14773*v12628-*p;
+  v1187=v1700*v16670-*p;
+  v13908=v4737*v16800-*p;
+  v1331=v12658*v17334-*p;
+  v18538=v16154*v332-*p;
+  v18431=v10783*v12459-*p;
+  v11815=v11231*v15934-*p;
+  v14114=v19642*v15100-*p;
+  v11638=v1190*v18136-*p;
+  v3643=v17943*v3485-*p;
+  v11044=v4412*v4919-*p;
+  v12313=v7978*v10030-*p;
+  v14699=v18830*v16526-*p;
+  v15267=v13583*v6391-*p;
+  v7593=v19237*v3227-*p;
+  v9095=v5036*v12601-*p;
+  v6538=v12342*v3593-*p;
+  v1922=v17076*v12587-*p;
+  v11910=v5538*v14718-*p;
+  v1974=v11643*v5501-*p;
+  v8669=v7366*v14122-*p;
+  v17904=v11887*v9390-*p;
+  v16843=v5666*v13133-*p;
+  v16147=v3273*v1606-*p;
+  v9692=v8345*v5010-*p;
+  v7020=v11001*v17349-*p;
+  v12737=v7948*v12747-*p;
+  v9077=v270*v6156-*p;
+  v9914=v10816*v17947-*p;
+  v7787=v5542*v3779-*p;
+  v16643=v9366*v3637-*p;
+  v8391=v3822*v7993-*p;
+  v12512=v5860*v19995-*p;
+  v5432=v17205*v1126-*p;
+  v17116=v8696*v1881-*p;
+  v1258=v17263*v19369-*p;
+  v1268=v274*v5672-*p;
+  v13909=v19982*v7533-*p;
+  v2632=v1410*v18397-*p;
+  v16904=v7333*v9620-*p;
+  v5661=v800*v4161-*p;
+  v5191=v10791*v14276-*p;
+  v18969=v12017*v669-*p;
+  v625=v8524*v9009-*p;
+  v18420=v4481*v19015-*p;
+  v4750=v13073*v1631-*p;
+  v9429=v3681*v6158-*p;
+  v18312=v8114*v11367-*p;
+  v15009=v2205*v14691-*p;
+  v13620=v19026*v16108-*p;
+  v12375=v1987*v11389-*p;
+  v9151=v9247*v19292-*p;
+  v3829=v18584*v3267-*p;
+  v1934=v11171*v3819-*p;
+  v16303=v2008*v7828-*p;
+  v1732=v11434*v8214-*p;
+  v14619=v13405*v13884-*p;
+  v1518=v1248*v1523-*p;
+  v17654=v16922*v14791-*p;
+  v2336=v5052*v2978-*p;
+  v19965=v19247*v14023-*p;
+  v4075=v11866*v19458-*p;
+  v12442=v9406*v17314-*p;
+  v5500=v11760*v9580-*p;
+  v15830=v1348*v9013-*p;
+  v2702=v14294*v18258-*p;
+  v10627=v10876*v11568-*p;
+  v1921=v10720*v7144-*p;
+  v15706=v4698*v1940-*p;
+  v12970=v14466*v5070-*p;
+  v2169=v0*v3539-*p;
+  v14690=v12433*v10460-*p;
+  v7976=v4319*v13191-*p;
+  v5129=v1236*v308-*p;
+  v19056=v2305*v14570-*p;
+  v10142=v437*v4991-*p;
+  v7127=v11818*v6226-*p;
+  v18892=v2028*v15235-*p;
+  v19094=v6917*v11355-*p;
+  v2639=v13489*v1045-*p;
+  v1296=v6272*v19715-*p;
+  v11651=v363*v17640-*p;
+  v9546=v18529*v16718-*p;
+  v2126=v4824*v12100-*p;
+  v3800=v15043*v17576-*p;
+  v6701=v13874*v9854-*p;
+  v19789=v2627*v17436-*p;
+  v14123=v3522*v4416-*p;
+  v6236=v15254*v7703-*p;
+  v19565=v13874*v7735-*p;
+  v15954=v11480*v2694-*p;
+  v1225=v4872*v7434-*p;
+  v323=v19680*v2108-*p;
+  v9854=v1143*v18061-*p;
+  v16841=v7412*v11391-*p;
+  v19154=v1309*v7460-*p;
+  v2786=v18578*v6612-*p;
+  v13921=v10713*v7310-*p;
+  v8411=v17746*v13373-*p;
+  v3690=v18158*v3056-*p;
+  v10008=v13019*v10824-*p;
+  v1635=v4705*v3111-*p;
+  v19513=v8623*v11005-*p;
+  v12375=v7762*v18741-*p;
+  v13336=v1730*v8294-*p;
+  v7380=v502*v16397-*p;
+  v14697=v1797*v9565-*p;
+  v19703=v4624*v5896-*p;
+  v9995=v12676*v12568-*p;
+  v16932=v9409*v6801-*p;
+  v7383=v16687*v6428-*p;
+  v9931=v11591*v14858-*p;
+  v15688=v14003*v11418-*p;
+  v15401=v19621*v1244-*p;
+  v17203=v323*v9665-*p;
+  v9214=v15789*v10219-*p;
+  v12563=v19749*v6884-*p;
+  v7854=v8123*v12955-*p;
+  v5258=v18209*v17125-*p;
+  v11081=v15042*v4048-*p;
+  v19251=v11214*v12870-*p;
+  v6052=v17679*v9495-*p;
+  v17788=v17049*v288-*p;
+  v7314=v9530*v6924-*p;
+  v6194=v1754*v14440-*p;
+  v13429=v14105*v5430-*p;
+  v15566=v12681*v9602-*p;
+  v5828=v5544*v13210-*p;
+  v2206=v649*v4100-*p;
+  v1730=v12442*v10135-*p;
+  v13811=v16476*v17790-*p;
+  v271=v301*v3673-*p;
+  v5690=v13848*v2806-*p;
+  v17470=v4630*v3064-*p;
+  v2653=v6028*v13699-*p;
+  v2638=v13847*v6977-*p;
+  v9524=v4920*v9294-*p;
+  v19184=v8605*v10450-*p;
+  v11248=v8653*v709-*p;
+  v19669=v9078*v5501-*p;
+  v12629=v6456*v4684-*p;
+  v16055=v7485*v1557-*p;
+  v10111=v5576*v18797-*p;
+  v17752=v13285*v18948-*p;
+  v7636=v1233*v15078-*p;
+  v2459=v15485*v1377-*p;
+  v12998=v3981*v15143-*p;
+  v15358=v4290*v19518-*p;
+  v18024=v12040*v2618-*p;
+  v16510=v11191*v16817-*p;
+  v13995=v16320*v18066-*p;
+  v18944=v15084*v15226-*p;
+  v8590=v7737*v6401-*p;
+  v5405=v18316*v660-*p;
+  v17110=v14044*v8326-*p;
+  v10855=v15114*v2241-*p;
+  v7666=v1557*v6861-*p;
+  v5757=v2214*v18315-*p;
+  v18587=v2802*v17168-*p;
+  v12171=v17181*v18127-*p;
+  v17309=v3764*v12442-*p;
+  v7556=v9073*v17582-*p;
+  v608=v8408*v683-*p;
+  v9318=v18111*v1770-*p;
+  v18434=v9369*v10086-*p;
+  v9076=v9559*v12785-*p;
+  v810=v4660*v12333-*p;
+  v1674=v6745*v3857-*p;
+  v19853=v18258*v17803-*p;
+  v1575=v10570*v12345-*p;
+  v15619=v11717*v1198-*p;
+  v10275=v15861*v15978-*p;
+  v13527=v5802*v3611-*p;
+  v17669=v6846*v8154-*p;
+  v2113=v12405*v5934-*p;
+  v16092=v16127*v16698-*p;
+  v2137=v16244*v4864-*p;
+  v5684=v9145*v13083-*p;
+  v1183=v19940*v11359-*p;
+  v2784=v17238*v5814-*p;
+  v13275=v18897*v18298-*p;
+  v80=v7580*v13292-*p;
+  v17136=v4821*v11181-*p;
+  v592=v4545*v4936-*p;
+  v14796=v13392*v2174-*p;
+  v1490=v11823*v9055-*p;
+  v3275=v3660*v2988-*p;
+  v13683=v8734*v17417-*p;
+  v2272=v585*v13041-*p;
+  v12796=v14588*v3581-*p;
+  v12046=v3353*v6912-*p;
+  v4701=v17231*v8854-*p;
+  v2223=v11403*v2325-*p;
+  v3270=v7889*v9417-*p;
+  v447=v4971*v2078-*p;
+  v14244=v560*v9111-*p;
+  v8515=v15250*v4359-*p;
+  v1584=v13231*v18795-*p;
+  v18153=v8210*v9293-*p;
+  v15379=v4105*v1328-*p;
+  v12086=v14020*v13479-*p;
+  v15437=v16552*v16575-*p;
+  v13783=v13850*v2547-*p;
+  v7864=v10567*v12054-*p;
+  v10524=v13251*v7206-*p;
+  v1952=v3896*v16910-*p;
+  v14107=v14380*v29-*p;
+  v7533=v13268*v1772-*p;
+  v5397=v3540*v10689-*p;
+  v2690=v771*v18930-*p;
+  v12489=v14257*v15237-*p;
+  v16336=v3267*v6809-*p;
+  v4644=v18249*v11320-*p;
+  v11253=v6760*v10808-*p;
+  v12778=v8686*v6531-*p;
+  v15071=v6325*v16478-*p;
+  v3207=v16968*v19257-*p;
+  v16003=v18044*v17289-*p;
+  v4463=v2853*v10047-*p;
+  v6418=v12141*v11947-*p;
+  v6363=v17501*v766-*p;
+  v2697=v18228*v9760-*p;
+  v19430=v8565*v6871-*p;
+  v18130=v17387*v8477-*p;
+  v12219=v7442*v422-*p;
+  v12895=v15160*v6155-*p;
+  v10785=v4251*v17192-*p;
+  v16369=v6649*v5051-*p;
+  v19078=v16272*v18091-*p;
+  v3561=v3486*v883-*p;
+  v15455=v14675*v16661-*p;
+  v9812=v8573*v5867-*p;
+  v16905=v1628*v504-*p;
+  v19787=v5921*v1086-*p;
+  v5827=v5048*v2730-*p;
+  v15940=v1011*v16853-*p;
+  v7848=v19389*v10713-*p;
+  v11021=v17922*v13606-*p;
+  v15654=v14727*v791-*p;
+  v6388=v16839*v12972-*p;
+  v3329=v11838*v5861-*p;
+  v9519=v10396*v10655-*p;
+  v7109=v17827*v17280-*p;
+  v19911=v16029*v18895-*p;
+  v12572=v5573*v3176-*p;
+  v16026=v16451*v13283-*p;
+  v14768=v10213*v3941-*p;
+  v5305=v13944*v5709-*p;
+  v9897=v18672*v10233-*p;
+  v17080=v11190*v5463-*p;
+  v15980=v9015*v9963-*p;
+  v9124=v18840*v14124-*p;
+  v4016=v17192*v3633-*p;
+  v2828=v4135*v18962-*p;
+  v479=v7030*v8811-*p;
+  v12931=v14913*v12158-*p;
+  v10239=v6640*v4250-*p;
+  v1223=v16904*v10065-*p;
+  v1968=v10520*v3003-*p;
+  v19353=v6488*v10293-*p;
+  v16446=v9576*v14553-*p;
+  v14049=v7464*v10891-*p;
+  v16035=v17018*v17723-*p;
+  v16676=v8356*v1343-*p;
+  v12323=v17922*v9634-*p;
+  v9037=v2675*v15965-*p;
+  v1157=v13073*v2646-*p;
+  v16932=v14960*v17771-*p;
+  v19978=v7629*v11488-*p;
+  v16378=v6261*v1407-*p;
+  v7024=v14483*v9881-*p;
+  v17903=v15205*v10826-*p;
+  v1004=v11729*v12536-*p;
+  v16653=v11990*v14881-*p;
+  v14575=v17043*v9301-*p;
+  v8572=v13392*v2882-*p;
+  v9771=v4313*v334-*p;
+  v3203=v4524*v17537-*p;
+  v12120=v3250*v8549-*p;
+  v14229=v873*v18457-*p;
+  v18129=v9165*v13531-*p;
+  v1489=v3536*v4694-*p;
+  v17060=v679*v16146-*p;
+  v13026=v19056*v19437-*p;
+  v10608=v1350*v1587-*p;
+  v18994=v9339*v6712-*p;
+  v10847=v12191*v15199-*p;
+  v5522=v9497*v16034-*p;
+  v1780=v19882*v3389-*p;
+  v7716=v6336*v10026-*p;
+  v4822=v16412*v18814-*p;
+  v1347=v11991*v13535-*p;
+  v7126=v4476*v2217-*p;
+  v12988=v19767*v19178-*p;
+  v12537=v12402*v12822-*p;
+  v6979=v10545*v9249-*p;
+  v13989=v17133*v12161-*p;
+  v7945=v9068*v10499-*p;
+  v10088=v8351*v7857-*p;
+  v17752=v10846*v7524-*p;
+  v1733=v13868*v16705-*p;
+  v19646=v14201*v291-*p;
+  v17877=v5418*v5724-*p;
+  v18611=v5147*v19007-*p;
+  v13147=v19257*v16316-*p;
+  v7040=v1674*v1778-*p;
+  v4617=v3621*v12591-*p;
+  v1269=v17120*v3124-*p;
+  v5434=v6265*v16089-*p;
+  v2500=v16571*v6768-*p;
+  v6191=v11296*v8662-*p;
+  v18262=v14306*v5316-*p;
+  v14416=v7121*v5394-*p;
+  v8591=v14631*v13741-*p;
+  v6590=v19572*v19767-*p;
+  v13806=v17295*v16803-*p;
+  v11610=v18460*v5492-*p;
+  v6768=v16997*v12842-*p;
+  v1050=v9586*v2306-*p;
+  v18540=v13214*v17393-*p;
+  v6340=v17505*v4261-*p;
+  v9652=v4049*v9608-*p;
+  v11685=v2736*v10298-*p;
+  v10845=v10757*v6380-*p;
+  v16831=v15399*v13496-*p;
+  v14750=v16387*v15492-*p;
+  v7140=v5762*v13052-*p;
+  v5727=v8457*v5195-*p;
+  v19120=v13217*v18702-*p;
+  v19917=v18813*v18250-*p;
+  v16363=v7303*v9699-*p;
+  v6962=v11274*v7471-*p;
+  v16006=v393*v17106-*p;
+  v10703=v8077*v3947-*p;
+  v12624=v8640*v17301-*p;
+  v18259=v11391*v9429-*p;
+  v3624=v616*v2410-*p;
+  v16171=v10734*v14232-*p;
+  v6782=v13039*v13397-*p;
+  v12128=v10249*v6113-*p;
+  v10367=v11340*v5946-*p;
+  v18782=v16683*v10553-*p;
+  v5612=v18623*v13324-*p;
+  v7441=v5162*v10556-*p;
+  v1896=v7801*v15414-*p;
+  v8319=v2231*v3663-*p;
+  v15269=v8697*v109-*p;
+  v9449=v12187*v12660-*p;
+  v11593=v12360*v6269-*p;
+  v16566=v16115*v12042-*p;
+  v19325=v6379*v8783-*p;
+  v7=v12943*v17726-*p;
+  v945=v13641*v8213-*p;
+  v15865=v13526*v14930-*p;
+  v18907=v19310*v19782-*p;
+  v6838=v2359*v6020-*p;
+  v12129=v13902*v18432-*p;
+  v13825=v1723*v8872-*p;
+  v16287=v10752*v15526-*p;
+  v3867=v11160*v1546-*p;
+  v10085=v17068*v10757-*p;
+  v1833=v19859*v1845-*p;
+  v6891=v16923*v14824-*p;
+  v653=v13515*v17561-*p;
+  v11214=v13323*v4719-*p;
+  v16672=v9637*v12321-*p;
+  v7833=v1241*v15124-*p;
+  v9277=v14883*v18903-*p;
+  v16004=v14965*v2337-*p;
+  v9145=v17007*v15865-*p;
+  v13803=v8152*v246-*p;
+  v9570=v1019*v15059-*p;
+  v18511=v11060*v1915-*p;
+  v14807=v11742*v14450-*p;
+  v1549=v15158*v8697-*p;
+  v15563=v11618*v18019-*p;
+  v3339=v1640*v9860-*p;
+  v13286=v2386*v15441-*p;
+  v1943=v13232*v8778-*p;
+  v1507=v9923*v2068-*p;
+  v8263=v5769*v7466-*p;
+  v624=v15*v6163-*p;
+  v12685=v19466*v11372-*p;
+  v19468=v19662*v8463-*p;
+  v7921=v3657*v2118-*p;
+  v66=v2218*v14423-*p;
+  v9198=v17700*v2170-*p;
+  v782=v2858*v4060-*p;
+  v2888=v15586*v19184-*p;
+  v15897=v5097*v5702-*p;
+  v12371=v18369*v8456-*p;
+  v13547=v5338*v13410-*p;
+  v3945=v3357*v9618-*p;
+  v19451=v16525*v1535-*p;
+  v12647=v1407*v4038-*p;
+  v1884=v4799*v12904-*p;
+  v15012=v17410*v3920-*p;
+  v3709=v14270*v4965-*p;
+  v1815=v443*v14085-*p;
+  v16323=v2500*v11418-*p;
+  v19633=v3892*v17287-*p;
+  v4265=v5222*v14316-*p;
+  v19493=v11165*v11831-*p;
+  v19562=v7227*v17536-*p;
+  v13482=v14360*v15731-*p;
+  v13403=v2920*v1127-*p;
+  v11174=v11544*v5390-*p;
+  v7779=v10740*v2749-*p;
+  v3900=v9090*v4683-*p;
+  v3660=v16921*v11162-*p;
+  v14631=v19926*v8590-*p;
+  v13712=v1886*v6490-*p;
+  v19387=v2250*v7104-*p;
+  v7583=v203*v16532-*p;
+  v15516=v15568*v10184-*p;
+  v17398=v14156*v16263-*p;
+  v11307=v15440*v5744-*p;
+  v18265=v4831*v19940-*p;
+  v7054=v17590*v2557-*p;
+  v11337=v9117*v9459-*p;
+  v2676=v5202*v7199-*p;
+  v15111=v9915*v4211-*p;
+  v2515=v15473*v13269-*p;
+  v125=v17578*v13246-*p;
+  v3610=v18850*v14542-*p;
+  v3671=v13458*v11408-*p;
+  v2568=v19241*v12377-*p;
+  v12832=v9389*v9621-*p;
+  v831=v2127*v3619-*p;
+  v4131=v5624*v2736-*p;
+  v6107=v12641*v2252-*p;
+  v13178=v19734*v18500-*p;
+  v15813=v14256*v8182-*p;
+  v11161=v17003*v10222-*p;
+  v8867=v6611*v18691-*p;
+  v8709=v3266*v15781-*p;
+  v7755=v12560*v14113-*p;
+  v400=v5043*v692-*p;
+  v14721=v16436*v17750-*p;
+  v6861=v17701*v375-*p;
+  v18249=v997*v15823-*p;
+  v13927=v18161*v1688-*p;
+  v17700=v8718*v12347-*p;
+  v9689=v396*v13345-*p;
+  v2293=v10510*v2179-*p;
+  v7476=v19205*v6550-*p;
+  v5212=v9128*v13181-*p;
+  v16213=v13821*v15093-*p;
+  v6939=v4726*v15533-*p;
+  v6122=v14007*v5076-*p;
+  v15920=v13763*v8531-*p;
+  v14657=v12113*v17707-*p;
+  v11305=v10835*v9320-*p;
+  v3701=v18281*v16839-*p;
+  v2314=v8227*v7645-*p;
+  v10679=v14232*v11578-*p;
+  v1113=v14401*v4752-*p;
+  v1685=v15916*v18831-*p;
+  v19016=v12039*v8770-*p;
+  v15642=v15589*v17803-*p;
+  v19934=v8979*v19011-*p;
+  v13755=v19591*v2451-*p;
+  v977=v18511*v13509-*p;
+  v9919=v6677*v16350-*p;
+  v7910=v5546*v8827-*p;
+  v784=v17494*v14901-*p;
+  v11745=v4620*v7419-*p;
+  v18353=v16893*v4259-*p;
+  v18841=v18736*v10177-*p;
+  v11508=v12232*v5456-*p;
+  v11277=v6830*v14365-*p;
+  v12955=v18911*v14805-*p;
+  v11728=v13766*v17392-*p;
+  v7331=v3932*v7410-*p;
+  v15845=v6018*v11518-*p;
+  v11892=v6288*v12513-*p;
+  v6657=v14971*v1519-*p;
+  v11177=v17583*v10015-*p;
+  v9948=v10177*v2729-*p;
+  v9747=v4002*v11037-*p;
+  v1674=v3922*v1730-*p;
+  v18450=v16056*v4740-*p;
+  v17488=v10727*v17549-*p;
+  v4444=v11948*v19080-*p;
+  v14779=v8204*v1342-*p;
+  v14196=v17116*v12775-*p;
+  v10043=v6371*v19275-*p;
+  v12832=v6735*v13038-*p;
+  v14463=v7125*v4878-*p;
+  v8827=v1113*v4312-*p;
+  v6007=v8514*v12213-*p;
+  v15549=v3738*v3965-*p;
+  v9004=v15285*v18826-*p;
+  v4249=v8277*v1248-*p;
+  v10464=v6434*v1475-*p;
+  v9464=v19190*v346-*p;
+  v9964=v18127*v18469-*p;
+  v1098=v10252*v16930-*p;
+  v10887=v13655*v15717-*p;
+  v18670=v2024*v7766-*p;
+  v11346=v10771*v2595-*p;
+  v9851=v6867*v10669-*p;
+  v13852=v7176*v6405-*p;
+  v17760=v10372*v3198-*p;
+  v7003=v9612*v7891-*p;
+  v15506=v5742*v14681-*p;
+  v15625=v16488*v11295-*p;
+  v6448=v13719*v3559-*p;
+  v18130=v6213*v494-*p;
+  v5600=v3093*v8947-*p;
+  v3804=v17727*v14356-*p;
+  v19574=v3325*v10531-*p;
+  v2965=v16312*v2279-*p;
+  v11591=v17862*v8358-*p;
+  v8990=v4735*v9432-*p;
+  v4188=v19860*v10021-*p;
+  v5504=v2879*v4899-*p;
+  v18872=v9656*v4066-*p;
+  v19025=v18860*v19011-*p;
+  v4956=v3081*v9496-*p;
+  v16453=v18949*v12743-*p;
+  v11401=v5576*v19626-*p;
+  v4424=v4893*v16588-*p;
+  v4291=v12965*v7908-*p;
+  v17465=v16527*v12718-*p;
+  v14419=v11115*v11498-*p;
+  v5014=v12456*v17489-*p;
+  v5371=v8402*v14624-*p;
+  v18461=v8760*v6021-*p;
+  v1795=v3291*v16470-*p;
+  v9301=v18053*v3222-*p;
+  v9142=v6226*v8528-*p;
+  v1152=v744*v13379-*p;
+  v2596=v12365*v5881-*p;
+  v13522=v17633*v13198-*p;
+  v11437=v18907*v18435-*p;
+  v10973=v12328*v137-*p;
+  v4403=v16516*v4130-*p;
+  v1762=v4131*v18643-*p;
+  v18894=v16144*v11382-*p;
+  v2388=v13625*v19278-*p;
+  v10746=v1350*v18875-*p;
+  v8483=v18572*v14602-*p;
+  v11872=v7739*v5494-*p;
+  v3525=v10227*v18123-*p;
+  v5126=v14136*v1747-*p;
+  v19939=v14410*v10506-*p;
+  v7123=v19631*v14357-*p;
+  v93=v12406*v11971-*p;
+  v10893=v12157*v16246-*p;
+  v2845=v8761*v11397-*p;
+  v950=v287*v10696-*p;
+  v10076=v14663*v4197-*p;
+  v10016=v2509*v2207-*p;
+  v16208=v14814*v13233-*p;
+  v1183=v2148*v8759-*p;
+  v12802=v14843*v4694-*p;
+  v11901=v10582*v17158-*p;
+  v13097=v7727*v2445-*p;
+  v4555=v9910*v18137-*p;
+  v1072=v3139*v3196-*p;
+  v16802=v1936*v4895-*p;
+  v10085=v12237*v17387-*p;
+  v18409=v13977*v12411-*p;
+  v19233=v3480*v15358-*p;
+  v6585=v6915*v7844-*p;
+  v3142=v10463*v18734-*p;
+  v6907=v9439*v10926-*p;
+  v14806=v15382*v3733-*p;
+  v8576=v6365*v5743-*p;
+  v798=v15018*v16393-*p;
+  v18926=v7244*v17372-*p;
+  v8891=v10791*v3772-*p;
+  v19959=v11223*v707-*p;
+  v16313=v11341*v10525-*p;
+  v1721=v12967*v16601-*p;
+  v18770=v10337*v14911-*p;
+  v1179=v11310*v4610-*p;
+  v6019=v3372*v18453-*p;
+  v15352=v2082*v17818-*p;
+  v3256=v19024*v16899-*p;
+  v3768=v17171*v17205-*p;
+  v3716=v19032*v15688-*p;
+  v18940=v2099*v18347-*p;
+  v11311=v5681*v9132-*p;
+  v11796=v1206*v186-*p;
+  v14066=v17643*v17138-*p;
+  v17103=v19030*v6828-*p;
+  v12197=v795*v15342-*p;
+  v10343=v1359*v1841-*p;
+  v17384=v376*v13067-*p;
+  v738=v5206*v13399-*p;
+  v17094=v12522*v5308-*p;
+  v996=v11088*v9270-*p;
+  v19731=v18443*v717-*p;
+  v14342=v3210*v4426-*p;
+  v19770=v19701*v19755-*p;
+  v14984=v793*v18145-*p;
+  v2031=v18979*v16916-*p;
+  v19371=v7504*v8073-*p;
+  v1358=v10353*v4850-*p;
+  v6678=v13328*v14955-*p;
+  v1416=v12261*v14069-*p;
+  v16905=v6786*v15536-*p;
+  v10961=v12781*v19891-*p;
+  v2538=v13967*v19842-*p;
+  v11356=v1592*v12929-*p;
+  v13386=v8469*v19411-*p;
+  v5219=v9483*v16218-*p;
+  v10189=v16012*v18932-*p;
+  v3117=v19637*v18705-*p;
+  v3958=v12210*v3523-*p;
+  v4546=v6534*v16993-*p;
+  v2990=v4240*v10021-*p;
+  v16607=v6877*v14682-*p;
+  v8937=v16645*v17238-*p;
+  v14370=v2971*v10267-*p;
+  v11919=v12551*v17887-*p;
+  v2279=v7441*v1770-*p;
+  v753=v8062*v4844-*p;
+  v6826=v837*v6948-*p;
+  v113=v15523*v9907-*p;
+  v4661=v1550*v19281-*p;
+  v3916=v10421*v1702-*p;
+  v11502=v19557*v10930-*p;
+  v3141=v2345*v9733-*p;
+  v17701=v4487*v11177-*p;
+  v15772=v16735*v11258-*p;
+  v11111=v17510*v17873-*p;
+  v10909=v14198*v18730-*p;
+  v11201=v5442*v4774-*p;
+  v16871=v17248*v16013-*p;
+  v10771=v11796*v16988-*p;
+  v4834=v5089*v7702-*p;
+  v14197=v7350*v1287-*p;
+  v12927=v19145*v3022-*p;
+  v19491=v7078*v14686-*p;
+  v13979=v5323*v17754-*p;
+  v19189=v4798*v11502-*p;
+  v16519=v18327*v10741-*p;
+  v1479=v17891*v4225-*p;
+  v6314=v16397*v685-*p;
+  v5849=v11325*v14863-*p;
+  v12162=v287*v11268-*p;
+  v18506=v16731*v9093-*p;
+  v9041=v16765*v12102-*p;
+  v14252=v12407*v12513-*p;
+  v1922=v3422*v7792-*p;
+  v2355=v11000*v17652-*p;
+  v16548=v1420*v12899-*p;
+  v3456=v1126*v11382-*p;
+  v19859=v5023*v7569-*p;
+  v4409=v10032*v13111-*p;
+  v9550=v10458*v10752-*p;
+  v19961=v16627*v12887-*p;
+  v19602=v6395*v4721-*p;
+  v13029=v17089*v5485-*p;
+  v12047=v16080*v10212-*p;
+  v340=v16344*v7575-*p;
+  v17436=v11872*v3087-*p;
+  v10246=v18317*v17952-*p;
+  v16159=v17034*v19588-*p;
+  v1412=v6706*v15777-*p;
+  v17481=v15811*v18124-*p;
+  v14335=v13009*v1909-*p;
+  v19852=v2779*v8383-*p;
+  v6502=v19833*v3925-*p;
+  v18380=v8118*v13328-*p;
+  v17525=v7022*v420-*p;
+  v7613=v13061*v12154-*p;
+  v3508=v16201*v11870-*p;
+  v1645=v12613*v1736-*p;
+  v10811=v18561*v302-*p;
+  v8145=v6877*v11942-*p;
+  v19190=v5072*v1062-*p;
+  v7150=v12391*v14962-*p;
+  v8012=v14245*v3896-*p;
+  v4589=v10655*v272-*p;
+  v5256=v9153*v3512-*p;
+  v125=v4096*v16158-*p;
+  v6450=v19216*v9476-*p;
+  v7410=v4021*v15072-*p;
+  v6290=v12012*v13152-*p;
+  v13067=v5532*v6949-*p;
+  v324=v7322*v16952-*p;
+  v3323=v9019*v7677-*p;
+  v17918=v313*v3592-*p;
+  v15767=v5183*v11824-*p;
+  v15246=v7738*v6660-*p;
+  v14401=v8213*v361-*p;
+  v4270=v11907*v11345-*p;
+  v9291=v8702*v12488-*p;
+  v18443=v5846*v17731-*p;
+  v8074=v12817*v8512-*p;
+  v4488=v638*v5590-*p;
+  v10716=v19485*v19769-*p;
+  v6991=v15533*v10512-*p;
+  v11585=v15846*v17616-*p;
+  v14517=v10853*v5513-*p;
+  v6648=v258*v4296-*p;
+  v18508=v2546*v7846-*p;
+  v7691=v2462*v675-*p;
+  v6851=v6854*v6123-*p;
+  v2662=v12881*v6231-*p;
+  v19589=v17974*v16342-*p;
+  v7453=v16076*v11676-*p;
+  v10542=v19496*v12357-*p;
+  v9370=v13153*v1984-*p;
+  v12510=v18075*v18273-*p;
+  v1996=v18271*v1630-*p;
+  v19653=v19605*v14093-*p;
+  v771=v19284*v8302-*p;
+  v6057=v13789*v5066-*p;
+  v5719=v13927*v6567-*p;
+  v5402=v7507*v19537-*p;
+  v12548=v10198*v532-*p;
+  v5752=v14203*v7766-*p;
+  v17816=v11159*v1217-*p;
+  v6214=v17808*v13341-*p;
+  v12191=v24*v6547-*p;
+  v8600=v3355*v4861-*p;
+  v18397=v9881*v17849-*p;
+  v1728=v13441*v5500-*p;
+  v9337=v633*v3104-*p;
+  v16297=v18595*v11422-*p;
+  v10570=v4767*v13885-*p;
+  v3582=v15931*v2217-*p;
+  v2461=v3505*v2455-*p;
+  v15525=v18813*v18706-*p;
+  v863=v12254*v9350-*p;
+  v5812=v3477*v3284-*p;
+  v2832=v14145*v2305-*p;
+  v5889=v2971*v2773-*p;
+  v14403=v12768*v8749-*p;
+  v5664=v7230*v16206-*p;
+  v4368=v213*v6841-*p;
+  v18228=v9905*v14803-*p;
+  v13809=v15114*v11176-*p;
+  v5163=v5301*v19707-*p;
+  v6440=v12161*v15543-*p;
+  v10270=v3897*v18580-*p;
+  v8283=v10508*v11336-*p;
+  v15808=v18911*v15204-*p;
+  v2863=v3612*v19234-*p;
+  v7860=v2917*v17950-*p;
+  v8276=v5498*v820-*p;
+  v1348=v13886*v3995-*p;
+  v15063=v8111*v15504-*p;
+  v7467=v10246*v8127-*p;
+  v2951=v9772*v19130-*p;
+  v6941=v15996*v11777-*p;
+  v2352=v12494*v17933-*p;
+  v19643=v5298*v8789-*p;
+  v14737=v18855*v2331-*p;
+  v13372=v2052*v7513-*p;
+  v8273=v11958*v9542-*p;
+  v13608=v690*v16830-*p;
+  v3030=v3013*v9009-*p;
+  v19309=v10139*v18386-*p;
+  v11427=v16753*v16386-*p;
+  v17801=v3037*v702-*p;
+  v12447=v15241*v9697-*p;
+  v17051=v420*v19993-*p;
+  v6420=v4966*v4752-*p;
+  v555=v10903*v1191-*p;
+  v8164=v9608*v2852-*p;
+  v9487=v5318*v7616-*p;
+  v15866=v16222*v7583-*p;
+  v15071=v4785*v17478-*p;
+  v6721=v10362*v14511-*p;
+  v13986=v5954*v19311-*p;
+  v466=v8209*v17523-*p;
+  v5830=v11092*v17679-*p;
+  v4315=v12681*v19981-*p;
+  v8283=v3633*v4881-*p;
+  v2810=v6495*v15258-*p;
+  v18949=v11347*v4503-*p;
+  v9949=v8617*v15041-*p;
+  v19413=v5444*v47-*p;
+  v12567=v14019*v13254-*p;
+  v13805=v14590*v11249-*p;
+  v13446=v2546*v6478-*p;
+  v248=v2952*v10538-*p;
+  v307=v11268*v5566-*p;
+  v15285=v1776*v3078-*p;
+  v18499=v16233*v11344-*p;
+  v6404=v19860*v150-*p;
+  v18317=v17479*v15961-*p;
+  v429=v19085*v7702-*p;
+  v141=v6998*v3620-*p;
+  v8174=v2173*v125-*p;
+  v5726=v4943*v10361-*p;
+  v2341=v9136*v10713-*p;
+  v18528=v2095*v13784-*p;
+  v17677=v2293*v11999-*p;
+  v14475=v15712*v13688-*p;
+  v11700=v12996*v4399-*p;
+  v9472=v8014*v14065-*p;
+  v950=v17746*v8151-*p;
+  v2826=v10147*v19066-*p;
+  v6244=v2248*v3012-*p;
+  v4032=v4140*v857-*p;
+  v8984=v16112*v14409-*p;
+  v17462=v7799*v1469-*p;
+  v11925=v17501*v8077-*p;
+  v10660=v18127*v14673-*p;
+  v8912=v18677*v17339-*p;
+  v5621=v8954*v4289-*p;
+  v10335=v10134*v13010-*p;
+  v10591=v2958*v12504-*p;
+  v654=v8563*v774-*p;
+  v5419=v970*v15420-*p;
+  v13076=v12121*v1649-*p;
+  v1801=v6681*v13217-*p;
+  v7589=v8279*v8062-*p;
+  v19997=v171*v17757-*p;
+  v2283=v2116*v7118-*p;
+  v2173=v5344*v8703-*p;
+  v14923=v14841*v2648-*p;
+  v6792=v5539*v18819-*p;
+  v19823=v16274*v4081-*p;
+  v8012=v2641*v13433-*p;
+  v9212=v2595*v1987-*p;
+  v19930=v17318*v4204-*p;
+  v7014=v2743*v13460-*p;
+  v15572=v13073*v19790-*p;
+  v9116=v10964*v18496-*p;
+  v16246=v5177*v12514-*p;
+  v10020=v3804*v7316-*p;
+  v14593=v7786*v12250-*p;
+  v9589=v17705*v2152-*p;
+  v12418=v9004*v1292-*p;
+  v12102=v15279*v9720-*p;
+  v14375=v8241*v3803-*p;
+  v360=v7746*v14529-*p;
+  v15857=v9902*v10471-*p;
+  v17316=v18610*v14017-*p;
+  v6553=v3348*v3526-*p;
+  v490=v13218*v17305-*p;
+  v14704=v5613*v85-*p;
+  v6488=v3352*v124-*p;
+  v2578=v16214*v15368-*p;
+  v13174=v5526*v11508-*p;
+  v18654=v473*v17259-*p;
+  v7118=v18384*v19525-*p;
+  v13397=v4314*v10931-*p;
+  v8102=v18617*v16621-*p;
+  v13708=v2960*v16070-*p;
+  v18664=v19346*v1593-*p;
+  v7507=v10044*v18223-*p;
+  v12733=v7671*v14736-*p;
+  v14769=v13097*v6772-*p;
+  v2499=v8288*v17837-*p;
+  v5581=v8328*v2605-*p;
+  v12560=v6211*v4847-*p;
+  v17635=v8878*v1891-*p;
+  v9177=v1805*v10351-*p;
+  v18505=v18815*v18370-*p;
+  v14805=v4345*v3859-*p;
+  v4388=v8728*v6549-*p;
+  v15314=v8706*v14216-*p;
+  v14400=v3964*v9158-*p;
+  v17525=v18712*v4479-*p;
+  v16990=v17989*v6606-*p;
+  v1424=v1733*v7468-*p;
+  v18501=v12884*v13782-*p;
+  v13998=v1148*v2066-*p;
+  v9932=v294*v14470-*p;
+  v17488=v2374*v12905-*p;
+  v5996=v15316*v15879-*p;
+  v9727=v1484*v4401-*p;
+  v11293=v5547*v15638-*p;
+  v19796=v10301*v12916-*p;
+  v4189=v11932*v17716-*p;
+  v8225=v8980*v17781-*p;
+  v4591=v11550*v12537-*p;
+  v1357=v8551*v8267-*p;
+  v4603=v1814*v3177-*p;
+  v678=v13245*v17428-*p;
+  v12717=v8139*v12165-*p;
+  v8346=v19699*v9057-*p;
+  v1366=v10994*v211-*p;
+  v18188=v14264*v17831-*p;
+  v5474=v7164*v3358-*p;
+  v17577=v19135*v47-*p;
+  v260=v9317*v1373-*p;
+  v17528=v15645*v3036-*p;
+  v14186=v10507*v6575-*p;
+  v172=v6627*v19908-*p;
+  v9395=v7698*v8386-*p;
+  v17187=v4652*v16324-*p;
+  v11110=v15609*v10807-*p;
+  v560=v13446*v7648-*p;
+  v4157=v1809*v798-*p;
+  v12968=v2182*v16359-*p;
+  v17819=v12878*v14942-*p;
+  v19565=v13099*v17200-*p;
+  v6373=v16785*v11200-*p;
+  v17799=v12323*v4422-*p;
+  v2800=v7016*v17581-*p;
+  v5193=v17162*v14631-*p;
+  v16334=v12155*v1955-*p;
+  v8000=v7417*v3386-*p;
+  v5427=v17355*v17579-*p;
+  v11307=v14458*v9751-*p;
+  v2342=v9242*v9004-*p;
+  v3667=v10421*v11546-*p;
+  v1067=v11040*v17336-*p;
+  v7449=v9721*v2763-*p;
+  v19827=v1090*v17324-*p;
+  v18227=v17508*v7866-*p;
+  v7198=v8941*v1852-*p;
+  v14869=v5900*v10718-*p;
+  v14489=v9874*v15106-*p;
+  v12495=v18826*v9258-*p;
+  v17931=v16358*v13068-*p;
+  v13824=v15920*v5341-*p;
+  v11955=v11313*v8488-*p;
+  v12970=v11562*v6033-*p;
+  v15397=v18009*v7917-*p;
+  v3533=v11451*v11466-*p;
+  v14683=v1853*v4547-*p;
+  v14456=v5799*v4089-*p;
+  v6078=v16180*v1218-*p;
+  v6238=v10618*v17513-*p;
+  v6497=v14415*v2579-*p;
+  v188=v12066*v9475-*p;
+  v11833=v18150*v7657-*p;
+  v16174=v19611*v18243-*p;
+  v12860=v3531*v6044-*p;
+  v18559=v19365*v8004-*p;
+  v2718=v16141*v1545-*p;
+  v1927=v5151*v14937-*p;
+  v11219=v17826*v11162-*p;
+  v19288=v12018*v7956-*p;
+  v19664=v6483*v2774-*p;
+  v2657=v8915*v9346-*p;
+  v9850=v3173*v5435-*p;
+  v3308=v10277*v2525-*p;
+  v3545=v10237*v15004-*p;
+  v6365=v8678*v16852-*p;
+  v13050=v15051*v11340-*p;
+  v8783=v3795*v13485-*p;
+  v9713=v16529*v5045-*p;
+  v19054=v15148*v3269-*p;
+  v10846=v12545*v18280-*p;
+  v6512=v2723*v9951-*p;
+  v9198=v18292*v18434-*p;
+  v17617=v4755*v4529-*p;
+  v14092=v11134*v10162-*p;
+  v1022=v18353*v15875-*p;
+  v1427=v7452*v4408-*p;
+  v12934=v11905*v19649-*p;
+  v3589=v1580*v12875-*p;
+  v1394=v16217*v9066-*p;
+  v18486=v16504*v13283-*p;
+  v12343=v7028*v6816-*p;
+  v13520=v5588*v15616-*p;
+  v1105=v12446*v15440-*p;
+  v15583=v6623*v13845-*p;
+  v7044=v14309*v15124-*p;
+  v7540=v12709*v13165-*p;
+  v1493=v11996*v16483-*p;
+  v540=v13732*v17467-*p;
+  v5490=v10168*v4589-*p;
+  v16744=v4259*v11843-*p;
+  v18043=v10649*v400-*p;
+  v15229=v11755*v18421-*p;
+  v19303=v4052*v14846-*p;
+  v4312=v18211*v11100-*p;
+  v18444=v16825*v4366-*p;
+  v2225=v11948*v16663-*p;
+  v4823=v15513*v12177-*p;
+  v9288=v8671*v1382-*p;
+  v8686=v8683*v3110-*p;
+  v13296=v14441*v6503-*p;
+  v6586=v8293*v7956-*p;
+  v17696=v17707*v18843-*p;
+  v16043=v10374*v14192-*p;
+  v6731=v7029*v12631-*p;
+  v12159=v15412*v14867-*p;
+  v18408=v17098*v3718-*p;
+  v14407=v10043*v12851-*p;
+  v5790=v19601*v8561-*p;
+  v3362=v10441*v14771-*p;
+  v17023=v9460*v4429-*p;
+  v13797=v7338*v4936-*p;
+  v13585=v10890*v10226-*p;
+  v16192=v4896*v10090-*p;
+  v6861=v18470*v11338-*p;
+  v9619=v17114*v14911-*p;
+  v18843=v4455*v13583-*p;
+  v194=v12779*v11183-*p;
+  v8052=v4437*v999-*p;
+  v13537=v12043*v1333-*p;
+  v10921=v14414*v16563-*p;
+  v659=v15245*v9052-*p;
+  v6930=v9716*v15118-*p;
+  v18340=v91*v4679-*p;
+  v17263=v1799*v3637-*p;
+  v4861=v7629*v2948-*p;
+  v2878=v12287*v15821-*p;
+  v11004=v18380*v7166-*p;
+  v4141=v14936*v11960-*p;
+  v4518=v16693*v12925-*p;
+  v8942=v19282*v5509-*p;
+  v13801=v11764*v17252-*p;
+  v2400=v5518*v12452-*p;
+  v14928=v15751*v9687-*p;
+  v799=v9151*v12587-*p;
+  v15902=v10754*v15996-*p;
+  v214=v8730*v7947-*p;
+  v19961=v5751*v18578-*p;
+  v8195=v11816*v6937-*p;
+  v14340=v5413*v5453-*p;
+  v4418=v5212*v19177-*p;
+  v7428=v15110*v8801-*p;
+  v4363=v14126*v15960-*p;
+  v18145=v3612*v1683-*p;
+  v3485=v35*v9361-*p;
+  v3125=v12035*v11946-*p;
+  v16751=v2452*v4328-*p;
+  v13196=v13246*v16669-*p;
+  v15143=v9501*v2865-*p;
+  v17179=v12988*v10148-*p;
+  v19568=v12224*v15811-*p;
+  v17054=v7112*v472-*p;
+  v3795=v14780*v5774-*p;
+  v13831=v17920*v2621-*p;
+  v11683=v9654*v15592-*p;
+  v2441=v14465*v5278-*p;
+  v7790=v3484*v16088-*p;
+  v1805=v15855*v17924-*p;
+  v5557=v10788*v12288-*p;
+  v4979=v10760*v116-*p;
+  v19039=v10817*v9633-*p;
+  v12570=v14049*v18815-*p;
+  v623=v13639*v10914-*p;
+  v8757=v4406*v6028-*p;
+  v18049=v10415*v15237-*p;
+  v1096=v18940*v17488-*p;
+  v17228=v8773*v15990-*p;
+  v17066=v14876*v9732-*p;
+  v2187=v15541*v14154-*p;
+  v18051=v6561*v3956-*p;
+  v8280=v19273*v49-*p;
+  v254=v13425*v18790-*p;
+  v7881=v9206*v6254-*p;
+  v8269=v4170*v10374-*p;
+  v9096=v7020*v18312-*p;
+  v19701=v10962*v7396-*p;
+  v3755=v18868*v9091-*p;
+  v7326=v16144*v16117-*p;
+  v18686=v17470*v15972-*p;
+  v9442=v14183*v10473-*p;
+  v12780=v13565*v8436-*p;
+  v16290=v9773*v14856-*p;
+  v10961=v8780*v19282-*p;
+  v14605=v12476*v12005-*p;
+  v11912=v8112*v2122-*p;
+  v11530=v10188*v12062-*p;
+  v13980=v2938*v14813-*p;
+  v19023=v14661*v15973-*p;
+  v18228=v4716*v5922-*p;
+  v17069=v13154*v5102-*p;
+  v12055=v3507*v14321-*p;
+  v3902=v4774*v7865-*p;
+  v1633=v574*v6053-*p;
+  v18627=v8018*v1470-*p;
+  v17472=v9623*v7118-*p;
+  v11579=v12106*v8330-*p;
+  v14902=v5569*v9041-*p;
+  v9750=v4260*v5180-*p;
+  v10705=v6898*v3132-*p;
+  v17628=v4841*v1212-*p;
+  v9311=v2776*v1920-*p;
+  v12554=v16004*v10260-*p;
+  v1722=v12606*v3137-*p;
+  v17624=v9149*v4638-*p;
+  v791=v11706*v15829-*p;
+  v11254=v7421*v11486-*p;
+  v14432=v16401*v17117-*p;
+  v8350=v11628*v7871-*p;
+  v1883=v13758*v2377-*p;
+  v4150=v11627*v1457-*p;
+  v9198=v14334*v14075-*p;
+  v4713=v11070*v8216-*p;
+  v17766=v17454*v6195-*p;
+  v6501=v10037*v15331-*p;
+  v18973=v11772*v5264-*p;
+  v9248=v16005*v4926-*p;
+  v8104=v7130*v3561-*p;
+  v11300=v19566*v8699-*p;
+  v7555=v19559*v12444-*p;
+  v6441=v2149*v17169-*p;
+  v7667=v7156*v18852-*p;
+  v892=v17604*v15094-*p;
+  v19390=v3415*v5081-*p;
+  v13671=v10676*v19847-*p;
+  v3686=v11797*v13858-*p;
+  v6014=v15736*v19383-*p;
+  v9244=v16149*v3407-*p;
+  v14159=v14190*v13260-*p;
+  v14660=v14506*v1005-*p;
+  v3917=v18413*v11966-*p;
+  v18527=v8737*v7954-*p;
+  v3571=v4728*v17561-*p;
+  v14034=v1810*v1657-*p;
+  v8881=v11532*v15254-*p;
+  v3089=v12037*v18387-*p;
+  v15404=v3060*v16827-*p;
+  v6947=v8188*v10887-*p;
+  v11125=v5177*v2672-*p;
+  v5135=v8616*v6475-*p;
+  v5446=v5522*v2272-*p;
+  v10036=v3126*v12605-*p;
+  v1761=v14551*v9924-*p;
+  v4954=v16268*v15621-*p;
+  v17946=v1034*v3059-*p;
+  v1476=v19923*v7773-*p;
+  v19249=v1096*v4786-*p;
+  v10441=v11268*v13527-*p;
+  v6429=v19065*v18238-*p;
+  v19195=v9244*v13286-*p;
+  v10557=v15281*v11573-*p;
+  v4928=v6592*v19351-*p;
+  v9412=v2804*v17762-*p;
+  v15348=v18364*v2151-*p;
+  v16225=v9955*v15774-*p;
+  v7150=v32*v4702-*p;
+  v10813=v15539*v12344-*p;
+  v19701=v18688*v13853-*p;
+  v13960=v7395*v8184-*p;
+  v6115=v15353*v16485-*p;
+  v14311=v19093*v8003-*p;
+  v10998=v17077*v8676-*p;
+  v6267=v18927*v19263-*p;
+  v10263=v11405*v2229-*p;
+  v10567=v6259*v4606-*p;
+  v840=v1427*v13240-*p;
+  v5313=v6661*v13694-*p;
+  v3412=v16682*v3813-*p;
+  v704=v18560*v14987-*p;
+  v12898=v5806*v9607-*p;
+  v18100=v15175*v8403-*p;
+  v3189=v2875*v1488-*p;
+  v13712=v6995*v17579-*p;
+  v437=v5667*v16364-*p;
+  v11735=v7136*v2638-*p;
+  v15999=v11880*v3796-*p;
+  v18317=v162*v18004-*p;
+  v13967=v10523*v12666-*p;
+  v19535=v3443*v2928-*p;
+  v4415=v8287*v15794-*p;
+  v4970=v19213*v7527-*p;
+  v6593=v10400*v7060-*p;
+  v13132=v16856*v6602-*p;
+  v15287=v16077*v6316-*p;
+  v8138=v14543*v1148-*p;
+  v7326=v5959*v14263-*p;
+  v5613=v12472*v5626-*p;
+  v2944=v1847*v3175-*p;
+  v8023=v14430*v12406-*p;
+  v19508=v554*v16795-*p;
+  v6377=v18231*v7826-*p;
+  v18646=v1989*v17229-*p;
+  v18515=v14944*v3717-*p;
+  v19040=v1694*v5360-*p;
+  v5034=v2155*v13567-*p;
+  v5719=v6850*v10650-*p;
+  v16212=v19871*v18065-*p;
+  v2962=v12325*v4598-*p;
+  v7286=v18731*v19558-*p;
+  v11140=v3410*v6258-*p;
+  v1049=v6237*v7521-*p;
+  v3208=v6101*v7587-*p;
+  v919=v3702*v2612-*p;
+  v16279=v13834*v10051-*p;
+  v7421=v16871*v11259-*p;
+  v18377=v15035*v6162-*p;
+  v4213=v9929*v18273-*p;
+  v4823=v14303*v3801-*p;
+  v6605=v15905*v8586-*p;
+  v1479=v15756*v15901-*p;
+  v1507=v213*v9215-*p;
+  v7274=v14601*v18863-*p;
+  v12207=v18260*v14579-*p;
+  v10855=v3583*v1816-*p;
+  v8319=v1129*v9991-*p;
+  v8037=v5090*v10817-*p;
+  v687=v19921*v6952-*p;
+  v8473=v12127*v4493-*p;
+  v15349=v1186*v9852-*p;
+  v526=v16441*v15794-*p;
+  v8417=v13548*v13833-*p;
+  v10079=v4270*v5212-*p;
+  v15748=v15376*v15156-*p;
+  v12847=v3755*v13510-*p;
+  v13423=v9416*v10279-*p;
+  v4100=v1668*v7275-*p;
+  v544=v5022*v1778-*p;
+  v18242=v16055*v1733-*p;
+  v18105=v14404*v4547-*p;
+  v17932=v15406*v9304-*p;
+  v2449=v339*v10617-*p;
+  v14663=v13186*v13550-*p;
+  v15226=v7823*v4407-*p;
+  v3495=v13591*v6523-*p;
+  v12118=v5564*v15711-*p;
+  v19252=v13921*v9387-*p;
+  v13202=v8755*v5009-*p;
+  v15833=v5924*v117-*p;
+  v10761=v19603*v2615-*p;
+  v14964=v10228*v9351-*p;
+  v11858=v9655*v8017-*p;
+  v14895=v13526*v6728-*p;
+  v13931=v5181*v19946-*p;
+  v4001=v13108*v597-*p;
+  v17663=v8705*v9023-*p;
+  v663=v11167*v12609-*p;
+  v2676=v2074*v6888-*p;
+  v11192=v11302*v17099-*p;
+  v17806=v7619*v8919-*p;
+  v5806=v9258*v7930-*p;
+  v565=v19967*v4308-*p;
+  v17436=v4071*v11076-*p;
+  v11295=v10066*v10086-*p;
+  v5208=v3030*v17818-*p;
+  v9288=v14703*v546-*p;
+  v14750=v12022*v4976-*p;
+  v12642=v15004*v3998-*p;
+  v10962=v1042*v17460-*p;
+  v4058=v9060*v4590-*p;
+  v18670=v16647*v635-*p;
+  v2408=v5772*v5475-*p;
+  v9191=v10799*v4815-*p;
+  v16676=v4148*v18469-*p;
+  v5250=v5476*v17456-*p;
+  v9749=v13234*v19689-*p;
+  v17080=v4906*v3022-*p;
+  v7105=v13545*v7493-*p;
+  v15882=v17456*v5487-*p;
+  v17892=v9007*v3203-*p;
+  v7263=v16789*v1375-*p;
+  v14981=v11018*v8552-*p;
+  v15769=v8612*v5046-*p;
+  v2037=v15458*v1816-*p;
+  v8071=v4606*v10234-*p;
+  v16956=v12289*v15729-*p;
+  v18547=v5921*v12499-*p;
+  v66=v7438*v5696-*p;
+  v3504=v12173*v18918-*p;
+  v13950=v2233*v15557-*p;
+  v15917=v11416*v7602-*p;
+  v1757=v13903*v16059-*p;
+  v619=v16498*v15093-*p;
+  v17007=v3597*v7452-*p;
+  v1251=v7429*v154-*p;
+  v6324=v18185*v19039-*p;
+  v16414=v4152*v14079-*p;
+  v1278=v8357*v1670-*p;
+  v10274=v6128*v4754-*p;
+  v4654=v2057*v5888-*p;
+  v2510=v18677*v19454-*p;
+  v9360=v1711*v4302-*p;
+  v10062=v2373*v14484-*p;
+  v9733=v16682*v19884-*p;
+  v7298=v14277*v3921-*p;
+  v19556=v10359*v566-*p;
+  v3672=v17422*v9553-*p;
+  v15232=v16302*v7061-*p;
+  v9368=v481*v8483-*p;
+  v5914=v3145*v483-*p;
+  v9089=v16962*v8043-*p;
+  v11320=v19650*v15178-*p;
+  v6074=v13518*v409-*p;
+  v8268=v9424*v4771-*p;
+  v19737=v7982*v2884-*p;
+  v17608=v6263*v7898-*p;
+  v7475=v19123*v1788-*p;
+  v1191=v17405*v2381-*p;
+  v10961=v14066*v1173-*p;
+  v7253=v18686*v1740-*p;
+  v10582=v4384*v6850-*p;
+  v18620=v10937*v13937-*p;
+  v7753=v8728*v11185-*p;
+  v4517=v5625*v263-*p;
+  v16200=v16119*v10979-*p;
+  v1831=v15068*v9599-*p;
+  v12959=v108*v14179-*p;
+  v13899=v13707*v2129-*p;
+  v13149=v58*v13602-*p;
+  v1045=v19168*v12145-*p;
+  v1287=v16810*v6011-*p;
+  v14347=v19125*v12319-*p;
+  v19438=v19751*v11193-*p;
+  v7728=v418*v12026-*p;
+  v10715=v14517*v8270-*p;
+  v10964=v17720*v15509-*p;
+  v9529=v12769*v19092-*p;
+  v6131=v8157*v14792-*p;
+  v9345=v8812*v15-*p;
+  v15062=v3626*v15711-*p;
+  v18513=v5183*v566-*p;
+  v3383=v5500*v15017-*p;
+  v793=v1396*v18497-*p;
+  v10383=v17582*v882-*p;
+  v11585=v18238*v40-*p;
+  v10560=v4297*v1252-*p;
+  v6640=v18174*v18715-*p;
+  v6446=v14144*v17089-*p;
+  v7137=v502*v13576-*p;
+  v15855=v2314*v8440-*p;
+  v18712=v16904*v11769-*p;
+  v8889=v18588*v8941-*p;
+  v7522=v18008*v9388-*p;
+  v13829=v9213*v19340-*p;
+  v7348=v18414*v13243-*p;
+  v2490=v14856*v9459-*p;
+  v14024=v1985*v16224-*p;
+  v7907=v6194*v2140-*p;
+  v120=v19393*v3147-*p;
+  v6812=v17790*v17460-*p;
+  v5315=v11596*v11493-*p;
+  v6999=v18867*v15112-*p;
+  v8287=v4417*v13159-*p;
+  v9629=v6383*v17197-*p;
+  v9027=v3711*v14942-*p;
+  v15262=v13677*v15376-*p;
+  v10562=v14367*v11840-*p;
+  v18554=v94*v5502-*p;
+  v2715=v19313*v1702-*p;
+  v15702=v2220*v16135-*p;
+  v18564=v5987*v5521-*p;
+  v8930=v511*v15241-*p;
+  v6264=v7713*v291-*p;
+  v5056=v18866*v16961-*p;
+  v19349=v16299*v5295-*p;
+  v10058=v15210*v4938-*p;
+  v5973=v10272*v9543-*p;
+  v8051=v9505*v13291-*p;
+  v14812=v17838*v625-*p;
+  v1170=v135*v3172-*p;
+  v3269=v11854*v3160-*p;
+  v9874=v11390*v13237-*p;
+  v12832=v8597*v7294-*p;
+  v19348=v1509*v4205-*p;
+  v4892=v6076*v12180-*p;
+  v3252=v17282*v16636-*p;
+  v7638=v19535*v12252-*p;
+  v1072=v7714*v2997-*p;
+  v18524=v5960*v16306-*p;
+  v5421=v8799*v7634-*p;
+  v2891=v7504*v15860-*p;
+  v7380=v16304*v7176-*p;
+  v18513=v14409*v9578-*p;
+  v9362=v18403*v16931-*p;
+  v1885=v11750*v13986-*p;
+  v18762=v2977*v6902-*p;
+  v14297=v18173*v19832-*p;
+  v2228=v6632*v17960-*p;
+  v11790=v6253*v8174-*p;
+  v19336=v10802*v11040-*p;
+  v14075=v12053*v12559-*p;
+  v8159=v15675*v15898-*p;
+  v1174=v16667*v9419-*p;
+  v9854=v15754*v6229-*p;
+  v12884=v18705*v5840-*p;
+  v8782=v1764*v6040-*p;
+  v18432=v15788*v1855-*p;
+  v13909=v13294*v5842-*p;
+  v4884=v19128*v15904-*p;
+  v7190=v5311*v8722-*p;
+  v17436=v623*v13838-*p;
+  v14874=v7915*v17990-*p;
+  v1121=v9974*v6604-*p;
+  v3774=v1665*v3508-*p;
+  v8578=v18741*v1881-*p;
+  v16090=v1987*v16105-*p;
+  v14280=v7769*v2813-*p;
+  v17406=v3563*v6118-*p;
+  v1616=v10695*v12766-*p;
+  v15349=v13178*v2147-*p;
+  v5992=v9258*v17578-*p;
+  v4590=v5884*v6404-*p;
+  v16665=v2559*v13285-*p;
+  v4542=v2877*v12295-*p;
+  v7695=v4568*v4274-*p;
+  v14667=v4815*v17214-*p;
+  v18224=v8646*v1544-*p;
+  v17715=v13671*v6977-*p;
+  v18170=v6273*v17457-*p;
+  v17826=v8012*v14911-*p;
+  v8114=v16123*v2558-*p;
+  v5856=v1502*v17918-*p;
+  v8420=v12614*v11013-*p;
+  v19805=v5948*v9221-*p;
+  v2324=v12772*v9503-*p;
+  v10792=v14722*v8613-*p;
+  v8126=v10932*v11223-*p;
+  v7244=v2961*v6305-*p;
+  v4674=v1460*v15611-*p;
+  v18249=v8940*v263-*p;
+  v236=v6517*v2698-*p;
+  v2500=v16458*v6982-*p;
+  v15528=v2675*v11310-*p;
+  v15910=v13909*v17427-*p;
+  v3337=v18568*v17500-*p;
+  v3226=v16429*v60-*p;
+  v11813=v2596*v3561-*p;
+  v15830=v12504*v411-*p;
+  v19964=v11394*v10425-*p;
+  v5241=v12267*v4799-*p;
+  v15607=v4925*v2732-*p;
+  v1859=v15334*v2450-*p;
+  v5922=v4055*v18069-*p;
+  v3185=v13670*v12576-*p;
+  v4974=v6405*v4450-*p;
+  v18117=v8020*v2192-*p;
+  v15999=v16199*v7255-*p;
+  v8172=v14689*v5716-*p;
+  v10657=v16944*v10795-*p;
+  v7911=v13595*v15633-*p;
+  v13361=v15314*v10014-*p;
+  v13961=v19601*v9367-*p;
+  v3190=v787*v7459-*p;
+  v7390=v866*v18159-*p;
+  v11434=v2096*v1548-*p;
+  v2476=v14086*v11193-*p;
+  v5435=v4224*v15296-*p;
+  v16663=v11751*v10104-*p;
+  v3780=v11096*v1939-*p;
+  v7186=v16217*v12223-*p;
+  v16609=v12973*v2977-*p;
+  v10807=v5245*v9657-*p;
+  v9039=v9005*v3489-*p;
+  v8183=v5909*v12959-*p;
+  v18316=v12529*v17347-*p;
+  v735=v1418*v9027-*p;
+  v7169=v3668*v10491-*p;
+  v14205=v2919*v1426-*p;
+  v3724=v10870*v4808-*p;
+  v6188=v19865*v3022-*p;
+  v15122=v18029*v1794-*p;
+  v17040=v16368*v9322-*p;
+  v10321=v7229*v11381-*p;
+  v18652=v1326*v3444-*p;
+  v5532=v15902*v7080-*p;
+  v316=v13461*v11784-*p;
+  v6609=v17667*v19703-*p;
+  v10846=v9878*v13052-*p;
+  v6480=v5516*v15720-*p;
+  v18767=v16115*v3380-*p;
+  v10407=v7197*v11605-*p;
+  v16833=v16143*v15521-*p;
+  v12045=v14510*v4680-*p;
+  v9470=v1800*v614-*p;
+  v4832=v9122*v9306-*p;
+  v5660=v16820*v9779-*p;
+  v12387=v17237*v19564-*p;
+  v15906=v5666*v15854-*p;
+  v6471=v6309*v8599-*p;
+  v9620=v9688*v5099-*p;
+  v3343=v14850*v13866-*p;
+  v16423=v14166*v3851-*p;
+  v17044=v2148*v340-*p;
+  v6380=v17500*v16433-*p;
+  v16935=v6686*v10180-*p;
+  v7091=v8012*v12432-*p;
+  v17381=v5515*v1238-*p;
+  v14131=v2525*v7477-*p;
+  v7396=v9160*v10505-*p;
+  v19791=v13017*v17276-*p;
+  v3099=v1454*v11103-*p;
+  v2408=v1880*v11401-*p;
+  v6907=v10516*v11127-*p;
+  v1107=v14032*v12715-*p;
+  v6829=v11483*v15307-*p;
+  v17535=v4004*v16407-*p;
+  v8253=v8577*v10823-*p;
+  v9622=v18877*v6933-*p;
+  v6920=v5372*v11059-*p;
+  v5011=v14779*v12550-*p;
+  v8177=v12197*v13667-*p;
+  v15990=v5051*v376-*p;
+  v522=v19091*v11980-*p;
+  v13270=v16829*v2182-*p;
+  v18183=v15551*v13046-*p;
+  v6696=v8118*v1081-*p;
+  v8607=v11981*v3703-*p;
+  v16891=v10378*v14814-*p;
+  v15824=v9510*v6449-*p;
+  v11362=v275*v6712-*p;
+  v6378=v13160*v7620-*p;
+  v2546=v15620*v15286-*p;
+  v14244=v9698*v17690-*p;
+  v10655=v4985*v19196-*p;
+  v455=v3109*v9234-*p;
+  v12442=v2127*v10026-*p;
+  v5766=v17645*v1742-*p;
+  v16086=v1117*v9896-*p;
+  v3834=v2585*v7281-*p;
+  v9768=v12642*v5520-*p;
+  v14598=v4032*v2937-*p;
+  v9323=v7313*v5934-*p;
+  v18951=v14900*v4026-*p;
+  v4411=v16484*v896-*p;
+  v8019=v10195*v3608-*p;
+  v10849=v16305*v6973-*p;
+  v15106=v13728*v2989-*p;
+  v5791=v7250*v13638-*p;
+  v16206=v7007*v9681-*p;
+  v17761=v13924*v15876-*p;
+  v4427=v9320*v11158-*p;
+  v7936=v14452*v10175-*p;
+  v17028=v19925*v18959-*p;
+  v6481=v9466*v4030-*p;
+  v7833=v11251*v7603-*p;
+  v2518=v14330*v14536-*p;
+  v8734=v16547*v10171-*p;
+  v2780=v10187*v6330-*p;
+  v17207=v11212*v6489-*p;
+  v5867=v9812*v12327-*p;
+  v14299=v15624*v8772-*p;
+  v1285=v2247*v7330-*p;
+  v9740=v8773*v9059-*p;
+  v9185=v17279*v13453-*p;
+  v8836=v16253*v288-*p;
+  v19643=v14662*v5835-*p;
+  v18220=v14157*v19684-*p;
+  v7903=v17062*v10295-*p;
+  v2106=v836*v16595-*p;
+  v1161=v2052*v19457-*p;
+  v11386=v3692*v17371-*p;
+  v8984=v9156*v10787-*p;
+  v406=v5945*v4032-*p;
+  v16445=v2997*v19820-*p;
+  v12447=v620*v7386-*p;
+  v18154=v11819*v8578-*p;
+  v11570=v40*v1726-*p;
+  v8827=v8471*v2668-*p;
+  v19300=v3497*v17221-*p;
+  v4633=v10097*v13733-*p;
+  v15287=v7078*v15501-*p;
+  v12475=v511*v18648-*p;
+  v19209=v13007*v14024-*p;
+  v8708=v15665*v7898-*p;
+  v18481=v19525*v8186-*p;
+  v12625=v15779*v6717-*p;
+  v5734=v13882*v527-*p;
+  v10329=v8329*v9098-*p;
+  v5921=v10783*v12958-*p;
+  v8545=v13958*v7353-*p;
+  v3950=v18910*v13470-*p;
+  v8879=v11557*v7865-*p;
+  v13921=v11538*v13382-*p;
+  v8494=v15034*v18176-*p;
+  v1537=v13953*v12109-*p;
+  v17961=v3860*v10877-*p;
+  v3126=v13403*v19270-*p;
+  v11527=v19436*v12318-*p;
+  v15364=v2531*v9843-*p;
+  v5834=v13822*v8951-*p;
+  v19040=v13745*v12664-*p;
+  v8425=v4663*v14780-*p;
+  v3794=v6967*v11133-*p;
+  v8420=v15827*v18240-*p;
+  v8674=v13724*v13852-*p;
+  v5917=v12966*v6035-*p;
+  v13016=v19822*v16613-*p;
+  v16243=v18334*v10891-*p;
+  v11713=v10991*v13846-*p;
+  v8082=v19372*v13997-*p;
+  v12551=v16599*v3530-*p;
+  v12620=v571*v16339-*p;
+  v15459=v18689*v13235-*p;
+  v12158=v16430*v867-*p;
+  v14004=v1821*v2406-*p;
+  v3363=v7585*v17118-*p;
+  v3672=v13312*v19311-*p;
+  v19800=v19527*v14587-*p;
+  v15267=v9579*v10182-*p;
+  v10303=v13261*v10339-*p;
+  v9968=v10188*v2281-*p;
+  v3723=v16743*v16019-*p;
+  v10929=v13762*v17365-*p;
+  v15334=v19031*v10531-*p;
+  v9195=v13736*v4681-*p;
+  v7513=v2758*v4137-*p;
+  v4550=v11798*v2811-*p;
+  v12993=v6551*v6060-*p;
+  v19461=v18430*v16270-*p;
+  v11065=v14463*v6830-*p;
+  v4135=v11822*v5400-*p;
+  v6022=v12904*v11301-*p;
+  v8986=v10054*v17264-*p;
+  v5822=v19980*v19669-*p;
+  v812=v17335*v17160-*p;
+  v17484=v12316*v13185-*p;
+  v4828=v110*v7555-*p;
+  v13042=v5524*v7873-*p;
+  v9045=v4221*v9216-*p;
+  v1456=v6261*v16622-*p;
+  v3148=v16774*v8064-*p;
+  v10486=v14669*v2735-*p;
+  v16113=v2926*v3434-*p;
+  v14035=v16443*v14597-*p;
+  v2116=v3366*v14008-*p;
+  v14525=v917*v11339-*p;
+  v14608=v11995*v3581-*p;
+  v12910=v13908*v5171-*p;
+  v18407=v14744*v3960-*p;
+  v17574=v5249*v2632-*p;
+  v4121=v6389*v12106-*p;
+  v222=v5504*v5467-*p;
+  v6620=v10535*v6000-*p;
+  v5948=v4463*v13687-*p;
+  v14341=v5356*v12082-*p;
+  v16466=v6440*v19041-*p;
+  v19229=v16734*v15983-*p;
+  v17958=v15983*v1934-*p;
+  v1822=v8085*v19532-*p;
+  v15809=v13625*v4441-*p;
+  v5473=v19367*v10203-*p;
+  v8208=v11450*v13834-*p;
+  v10931=v7151*v3828-*p;
+  v10972=v14983*v19008-*p;
+  v17341=v4665*v823-*p;
+  v1797=v13165*v5210-*p;
+  v6762=v3542*v6515-*p;
+  v4967=v9367*v1890-*p;
+  v18711=v16833*v18346-*p;
+  v13713=v2655*v3738-*p;
+  v13975=v2589*v16507-*p;
+  v4259=v1615*v19463-*p;
+  v12405=v4551*v17157-*p;
+  v6084=v1942*v15480-*p;
+  v16511=v10336*v7268-*p;
+  v9302=v6598*v19723-*p;
+  v15509=v8999*v15066-*p;
+  v14850=v8888*v13845-*p;
+  v11288=v9669*v13460-*p;
+  v13289=v13570*v16625-*p;
+  v2697=v5755*v18130-*p;
+  v12743=v18943*v1457-*p;
+  v1031=v19097*v4020-*p;
+  v9698=v15264*v6737-*p;
+  v16367=v8768*v6268-*p;
+  v10627=v1272*v7921-*p;
+  v16977=v7934*v1247-*p;
+  v8032=v16259*v7763-*p;
+  v17067=v18103*v19489-*p;
+  v9258=v16010*v13262-*p;
+  v15337=v4180*v3620-*p;
+  v10240=v11932*v8698-*p;
+  v13611=v9387*v1022-*p;
+  v8691=v10675*v1669-*p;
+  v13654=v2003*v19326-*p;
+  v3389=v17143*v13124-*p;
+  v2855=v1374*v15020-*p;
+  v7999=v826*v16710-*p;
+  v8671=v13400*v6434-*p;
+  v441=v256*v18210-*p;
+  v4593=v7966*v5747-*p;
+  v12763=v2412*v7633-*p;
+  v11203=v15115*v5512-*p;
+  v6653=v6043*v6154-*p;
+  v9896=v17291*v13399-*p;
+  v11959=v19113*v2426-*p;
+  v19541=v8054*v12178-*p;
+  v2020=v11079*v1255-*p;
+  v13152=v11938*v3464-*p;
+  v15601=v14966*v8202-*p;
+  v4334=v1378*v9769-*p;
+  v12788=v2891*v3054-*p;
+  v14684=v2399*v10125-*p;
+  v14950=v4720*v280-*p;
+  v13692=v7989*v16074-*p;
+  v1407=v11400*v16309-*p;
+  v6345=v19595*v16475-*p;
+  v8986=v6388*v10091-*p;
+  v9893=v17917*v1972-*p;
+  v8556=v8767*v19206-*p;
+  v13901=v767*v1710-*p;
+  v16193=v3819*v19537-*p;
+  v3459=v2542*v5585-*p;
+  v17541=v13252*v18329-*p;
+  v6220=v1538*v13792-*p;
+  v4529=v6743*v15030-*p;
+  v8632=v1967*v9466-*p;
+  v3400=v16910*v7346-*p;
+  v3027=v15149*v15886-*p;
+  v10434=v13464*v5554-*p;
+  v3114=v14140*v2600-*p;
+  v13098=v7844*v7553-*p;
+  v10353=v1276*v8183-*p;
+  v19419=v3110*v11372-*p;
+  v145=v4818*v16749-*p;
+  v17696=v19027*v8594-*p;
+  v4620=v9222*v16552-*p;
+  v10997=v11293*v17928-*p;
+  v6498=v6544*v19336-*p;
+  v6860=v2007*v2228-*p;
+  v10876=v7018*v2863-*p;
+  v3811=v19460*v17402-*p;
+  v18914=v9433*v14554-*p;
+  v16143=v10459*v7505-*p;
+  v9314=v16371*v18084-*p;
+  v15224=v15915*v3277-*p;
+  v17967=v7044*v8483-*p;
+  v14119=v15615*v9129-*p;
+  v7881=v11080*v17540-*p;
+  v16997=v16004*v17979-*p;
+  v16457=v16650*v3682-*p;
+  v13545=v5957*v19366-*p;
+  v8399=v13267*v19906-*p;
+  v19929=v8110*v1791-*p;
+  v17115=v2542*v7374-*p;
+  v19714=v19244*v5591-*p;
+  v12193=v17650*v11310-*p;
+  v10175=v3657*v12227-*p;
+  v16165=v18996*v8329-*p;
+  v9972=v16477*v12638-*p;
+  v7624=v8891*v16596-*p;
+  v10568=v10493*v3504-*p;
+  v13107=v19046*v10440-*p;
+  v18654=v7639*v4033-*p;
+  v8813=v11046*v18929-*p;
+  v15781=v18261*v3951-*p;
+  v18996=v1446*v12280-*p;
+  v3850=v229*v4112-*p;
+  v19031=v2664*v517-*p;
+  v5663=v10280*v2448-*p;
+  v1240=v5364*v857-*p;
+  v16560=v15342*v2785-*p;
+  v13043=v19102*v6246-*p;
+  v425=v15687*v18603-*p;
+  v8674=v11050*v63-*p;
+  v16423=v7149*v16732-*p;
+  v4149=v12458*v13723-*p;
+  v814=v11935*v4612-*p;
+  v12831=v10637*v2505-*p;
+  v15587=v2731*v4892-*p;
+  v14317=v4956*v10696-*p;
+  v14322=v2421*v11971-*p;
+  v17639=v7288*v17709-*p;
+  v13130=v16465*v9483-*p;
+  v1959=v9141*v6628-*p;
+  v4480=v11076*v17329-*p;
+  v16947=v3284*v583-*p;
+  v522=v14677*v4520-*p;
+  v3484=v6947*v10242-*p;
+  v18360=v3417*v17417-*p;
+  v13693=v13638*v2878-*p;
+  v11376=v12729*v9157-*p;
+  v8720=v1149*v14698-*p;
+  v9338=v474*v11011-*p;
+  v14662=v2567*v6523-*p;
+  v14315=v13770*v11907-*p;
+  v16363=v6962*v9865-*p;
+  v11065=v18073*v6303-*p;
+  v4359=v16919*v5519-*p;
+  v17084=v14036*v9433-*p;
+  v7588=v16154*v2804-*p;
+  v11328=v19048*v10194-*p;
+  v8676=v18161*v4600-*p;
+  v17504=v7352*v19600-*p;
+  v2949=v9361*v18006-*p;
+  v14727=v16657*v16922-*p;
+  v672=v6981*v13466-*p;
+  v3283=v17421*v19679-*p;
+  v6300=v16787*v7925-*p;
+  v1889=v6745*v5545-*p;
+  v4713=v6629*v13019-*p;
+  v19404=v17928*v7537-*p;
+  v17909=v8759*v12057-*p;
+  v14199=v7132*v18878-*p;
+  v4854=v3267*v5596-*p;
+  v3367=v662*v12170-*p;
+  v6790=v1366*v5392-*p;
+  v17273=v8220*v18161-*p;
+  v309=v18463*v5306-*p;
+  v17829=v13441*v7508-*p;
+  v12164=v9034*v15569-*p;
+  v4312=v8289*v1695-*p;
+  v6584=v2613*v11760-*p;
+  v6610=v3257*v14199-*p;
+  v7881=v292*v10157-*p;
+  v6822=v5349*v11377-*p;
+  v5545=v3777*v1200-*p;
+  v19503=v16341*v7622-*p;
+  v17701=v9*v11071-*p;
+  v16252=v9544*v17261-*p;
+  v15351=v15850*v3461-*p;
+  v10945=v15771*v11092-*p;
+  v12351=v6401*v18126-*p;
+  v635=v3568*v16691-*p;
+  v19407=v1828*v19327-*p;
+  v8429=v12453*v15636-*p;
+  v811=v15167*v3176-*p;
+  v12309=v15194*v18753-*p;
+  v8286=v3391*v11308-*p;
+  v12327=v9053*v837-*p;
+  v14746=v17563*v4021-*p;
+  v5091=v1747*v19867-*p;
+  v7720=v11958*v17875-*p;
+  v5118=v16309*v17782-*p;
+  v16453=v13322*v4983-*p;
+  v13555=v13197*v9604-*p;
+  v10499=v8421*v17517-*p;
+  v1095=v19806*v3556-*p;
+  v19308=v7756*v6640-*p;
+  v2886=v4625*v5768-*p;
+  v12916=v11086*v18521-*p;
+  v11852=v3580*v4531-*p;
+  v19740=v13659*v11634-*p;
+  v15747=v510*v15808-*p;
+  v1014=v755*v11916-*p;
+  v5498=v6040*v5604-*p;
+  v15129=v2399*v5219-*p;
+  v13575=v3493*v6047-*p;
+  v13887=v19282*v2547-*p;
+  v1643=v8373*v10441-*p;
+  v11116=v19228*v16213-*p;
+  v8603=v18087*v12633-*p;
+  v11182=v13999*v14639-*p;
+  v11121=v12560*v18957-*p;
+  v2496=v19062*v14264-*p;
+  v12957=v17139*v16888-*p;
+  v12594=v12676*v11373-*p;
+  v13636=v17340*v14164-*p;
+  v1337=v11063*v463-*p;
+  v17341=v8350*v9606-*p;
+  v4636=v14027*v19717-*p;
+  v13585=v18838*v19139-*p;
+  v6659=v2441*v11925-*p;
+  v13871=v15867*v17250-*p;
+  v9802=v16649*v10181-*p;
+  v3474=v6156*v16422-*p;
+  v298=v18991*v14715-*p;
+  v6761=v3643*v12911-*p;
+  v3104=v9683*v9670-*p;
+  v7616=v7572*v10897-*p;
+  v11547=v5847*v12540-*p;
+  v18104=v12816*v1309-*p;
+  v8129=v6032*v6450-*p;
+  v5853=v15991*v6576-*p;
+  v13633=v14613*v2285-*p;
+  v17051=v2287*v817-*p;
+  v18761=v18633*v17354-*p;
+  v14040=v4286*v8241-*p;
+  v5216=v9464*v15704-*p;
+  v11769=v3643*v10085-*p;
+  v12445=v11383*v15404-*p;
+  v15092=v13270*v7557-*p;
+  v7979=v9967*v1886-*p;
+  v7851=v17315*v15164-*p;
+  v11135=v5017*v12051-*p;
+  v10047=v10630*v17056-*p;
+  v1752=v10348*v17728-*p;
+  v13352=v11375*v11678-*p;
+  v14423=v17861*v2219-*p;
+  v15971=v16084*v10470-*p;
+  v9954=v18668*v11730-*p;
+  v14589=v16946*v17432-*p;
+  v12161=v18672*v17241-*p;
+  v7397=v811*v18407-*p;
+  v432=v12544*v7170-*p;
+  v18613=v3107*v19014-*p;
+  v16274=v808*v15846-*p;
+  v17233=v19156*v16555-*p;
+  v8095=v17377*v14945-*p;
+  v19011=v11662*v8968-*p;
+  v8556=v396*v16746-*p;
+  v19143=v4638*v1942-*p;
+  v2792=v17052*v5679-*p;
+  v13214=v16584*v1701-*p;
+  v10380=v13665*v11852-*p;
+  v8177=v3062*v6661-*p;
+  v6388=v1813*v17891-*p;
+  v6214=v8394*v19113-*p;
+  v1310=v17906*v13217-*p;
+  v19220=v18780*v5027-*p;
+  v6602=v11571*v7162-*p;
+  v262=v2994*v4583-*p;
+  v3560=v11411*v17186-*p;
+  v10257=v588*v11186-*p;
+  v8713=v15594*v10498-*p;
+  v15427=v145*v8461-*p;
+  v1744=v16789*v6141-*p;
+  v15576=v5844*v8107-*p;
+  v2822=v1357*v7063-*p;
+  v17220=v3318*v6667-*p;
+  v6642=v9602*v15634-*p;
+  v6285=v7869*v7088-*p;
+  v10457=v12838*v12471-*p;
+  v1537=v5766*v1598-*p;
+  v19268=v17088*v6004-*p;
+  v7938=v16559*v8744-*p;
+  v11279=v13502*v5879-*p;
+  v908=v6407*v3811-*p;
+  v3566=v10509*v9836-*p;
+  v9009=v12177*v10808-*p;
+  v12361=v10465*v8020-*p;
+  v16369=v6565*v18728-*p;
+  v4478=v11574*v236-*p;
+  v13424=v17544*v15853-*p;
+  v15794=v12070*v12135-*p;
+  v6806=v2356*v10912-*p;
+  v7323=v1147*v18095-*p;
+  v9496=v10183*v9275-*p;
+  v12214=v2238*v1244-*p;
+  v5321=v9854*v8276-*p;
+  v3948=v4302*v5525-*p;
+  v6585=v17078*v5454-*p;
+  v6214=v17710*v4560-*p;
+  v12180=v18501*v10858-*p;
+  v2636=v10204*v7811-*p;
+  v2250=v14435*v6846-*p;
+  v10862=v9158*v17905-*p;
+  v13215=v3299*v18186-*p;
+  v6884=v2047*v4276-*p;
+  v12115=v1617*v5020-*p;
+  v12588=v12182*v18541-*p;
+  v7119=v6715*v7084-*p;
+  v8602=v16896*v4809-*p;
+  v18407=v2844*v18054-*p;
+  v11127=v718*v3569-*p;
+  v3558=v6269*v3511-*p;
+  v19484=v8401*v19626-*p;
+  v10045=v18228*v3956-*p;
+  v19418=v14490*v3002-*p;
+  v11869=v15771*v518-*p;
+  v10418=v2272*v401-*p;
+  v1448=v19995*v7850-*p;
+  v13442=v17548*v152-*p;
+  v16451=v8*v4802-*p;
+  v11953=v12724*v18722-*p;
+  v14681=v10435*v11129-*p;
+  v16338=v19527*v1340-*p;
+  v9368=v5730*v268-*p;
+  v16007=v13650*v3492-*p;
+  v12168=v19345*v1513-*p;
+  v19824=v1843*v16975-*p;
+  v19209=v14759*v14243-*p;
+  v665=v4443*v2159-*p;
+  v16467=v4894*v15589-*p;
+  v15382=v12767*v7674-*p;
+  v12054=v12267*v13773-*p;
+  v5342=v5305*v1665-*p;
+  v6376=v819*v10837-*p;
+  v19043=v16352*v6150-*p;
+  v13022=v1866*v10110-*p;
+  v12521=v5404*v10345-*p;
+  v2031=v63*v4604-*p;
+  v17631=v2810*v15947-*p;
+  v16361=v8701*v18150-*p;
+  v17190=v8762*v2474-*p;
+  v11468=v17049*v3241-*p;
+  v17502=v925*v3718-*p;
+  v5241=v7718*v7208-*p;
+  v18661=v175*v6733-*p;
+  v19456=v466*v8480-*p;
+  v1447=v14080*v15729-*p;
+  v13463=v18998*v10397-*p;
+  v405=v19684*v9273-*p;
+  v10691=v15759*v3912-*p;
+  v11413=v8712*v10869-*p;
+  v9005=v13481*v4586-*p;
+  v11759=v3162*v7478-*p;
+  v5232=v17094*v5618-*p;
+  v17646=v13905*v13566-*p;
+  v4298=v11556*v8093-*p;
+  v18387=v16807*v9528-*p;
+  v19069=v7627*v18644-*p;
+  v5266=v26*v19726-*p;
+  v6248=v4303*v18951-*p;
+  v10764=v15758*v1422-*p;
+  v640=v2750*v11819-*p;
+  v1025=v15251*v5129-*p;
+  v9721=v11461*v2494-*p;
+  v19375=v8242*v5145-*p;
+  v14914=v13616*v5595-*p;
+  v9274=v1090*v11577-*p;
+  v11618=v9129*v8518-*p;
+  v15840=v1391*v2796-*p;
+  v14624=v15912*v1062-*p;
+  v6299=v1886*v1454-*p;
+  v6214=v6066*v10035-*p;
+  v3145=v17539*v12712-*p;
+  v10530=v12021*v1225-*p;
+  v3351=v17550*v3488-*p;
+  v9170=v537*v767-*p;
+  v16591=v18459*v9885-*p;
+  v15515=v1316*v7349-*p;
+  v5117=v10902*v17254-*p;
+  v5116=v7067*v16404-*p;
+  v4141=v13692*v11507-*p;
+  v4350=v161*v8418-*p;
+  v8552=v19154*v13124-*p;
+  v166=v12288*v19546-*p;
+  v6173=v18856*v9051-*p;
+  v11929=v10039*v12758-*p;
+  v5420=v10908*v14063-*p;
+  v11529=v11318*v14037-*p;
+  v18319=v1219*v9634-*p;
+  v18088=v3723*v8268-*p;
+  v18235=v16404*v17778-*p;
+  v4550=v7173*v12929-*p;
+  v10675=v5060*v1627-*p;
+  v4689=v3865*v18684-*p;
+  v14183=v10768*v19930-*p;
+  v8726=v18564*v7187-*p;
+  v18926=v16751*v3091-*p;
+  v7391=v13157*v18793-*p;
+  v6922=v12504*v10470-*p;
+  v8108=v14584*v2909-*p;
+  v15371=v4785*v8256-*p;
+  v8213=v18818*v13519-*p;
+  v16470=v13625*v131-*p;
+  v2397=v10801*v2418-*p;
+  v8905=v4721*v8588-*p;
+  v5430=v8217*v11615-*p;
+  v10332=v19434*v9778-*p;
+  v15832=v16212*v2232-*p;
+  v2922=v4120*v3264-*p;
+  v4355=v14098*v11841-*p;
+  v8899=v10872*v2393-*p;
+  v19790=v3846*v4585-*p;
+  v19880=v6033*v17307-*p;
+  v6939=v1232*v3886-*p;
+  v7768=v10480*v8183-*p;
+  v3268=v4065*v17277-*p;
+  v3107=v15741*v19456-*p;
+  v14420=v7497*v10966-*p;
+  v14376=v4672*v13886-*p;
+  v287=v16044*v6873-*p;
+  v9898=v3786*v6240-*p;
+  v15756=v9019*v13323-*p;
+  v3382=v18823*v5253-*p;
+  v6176=v11769*v2408-*p;
+  v6222=v14848*v11129-*p;
+  v9522=v6603*v6244-*p;
+  v2392=v9262*v16499-*p;
+  v17405=v217*v14176-*p;
+  v6462=v16036*v18345-*p;
+  v9955=v3036*v13618-*p;
+  v14488=v9564*v12536-*p;
+  v191=v18808*v19293-*p;
+  v18868=v6727*v7564-*p;
+  v10619=v17206*v3992-*p;
+  v17589=v18069*v97-*p;
+  v19860=v8828*v19174-*p;
+  v12576=v7841*v4958-*p;
+  v18733=v14414*v7374-*p;
+  v10805=v4952*v16711-*p;
+  v7453=v7762*v14091-*p;
+  v8460=v17324*v5549-*p;
+  v1020=v5169*v10407-*p;
+  v8570=v3605*v1219-*p;
+  v12864=v16343*v17955-*p;
+  v3716=v8733*v4958-*p;
+  v17368=v7100*v7625-*p;
+  v9697=v2810*v14246-*p;
+  v11228=v13019*v12752-*p;
+  v18681=v16369*v10881-*p;
+  v2409=v15935*v6503-*p;
+  v18211=v14007*v3938-*p;
+  v18988=v3355*v9645-*p;
+  v14451=v16182*v10211-*p;
+  v6001=v2702*v7030-*p;
+  v19171=v18510*v9965-*p;
+  v15052=v11417*v8395-*p;
+  v4447=v18430*v15868-*p;
+  v7760=v7664*v5894-*p;
+  v17439=v18460*v6425-*p;
+  v3720=v16285*v5390-*p;
+  v18484=v17849*v1317-*p;
+  v2892=v16347*v14557-*p;
+  v5305=v6915*v2488-*p;
+  v7100=v10515*v7978-*p;
+  v10364=v506*v6030-*p;
+  v6955=v18014*v15261-*p;
+  v17563=v7339*v1765-*p;
+  v7281=v11759*v10180-*p;
+  v209=v19266*v11523-*p;
+  v11647=v6796*v10725-*p;
+  v3103=v653*v13867-*p;
+  v6141=v11592*v5292-*p;
+  v9953=v9455*v15656-*p;
+  v4224=v16259*v2027-*p;
+  v12361=v17841*v10826-*p;
+  v15492=v9115*v12393-*p;
+  v7475=v19148*v19710-*p;
+  v3401=v7859*v7732-*p;
+  v4479=v5905*v1018-*p;
+  v6818=v5200*v8591-*p;
+  v17106=v2444*v16572-*p;
+  v18537=v7764*v2704-*p;
+  v8152=v10520*v13426-*p;
+  v4472=v18406*v5953-*p;
+  v2866=v13577*v10664-*p;
+  v12284=v12238*v3709-*p;
+  v10292=v11052*v2328-*p;
+  v2557=v4874*v14108-*p;
+  v1230=v3338*v10491-*p;
+  v11205=v17893*v7379-*p;
+  v7901=v4508*v10773-*p;
+  v3494=v3259*v8081-*p;
+  v3599=v4138*v7272-*p;
+  v551=v2576*v13158-*p;
+  v19728=v12050*v1906-*p;
+  v15777=v11380*v9497-*p;
+  v5411=v4332*v10003-*p;
+  v3211=v17515*v16869-*p;
+  v15647=v19843*v17612-*p;
+  v7657=v1030*v6003-*p;
+  v11591=v18424*v9573-*p;
+  v16944=v11917*v13946-*p;
+  v18126=v19066*v12088-*p;
+  v15327=v16929*v14420-*p;
+  v83=v16582*v1039-*p;
+  v327=v13824*v15584-*p;
+  v17908=v1412*v2976-*p;
+  v4189=v16824*v2941-*p;
+  v14731=v15623*v275-*p;
+  v41=v13993*v17078-*p;
+  v5650=v16839*v14039-*p;
+  v8617=v12916*v3609-*p;
+  v18951=v7386*v16198-*p;
+  v9018=v12824*v17689-*p;
+  v11503=v12636*v10343-*p;
+  v12674=v9288*v7029-*p;
+  v16963=v13803*v18914-*p;
+  v2506=v3221*v4276-*p;
+  v12342=v9779*v6469-*p;
+  v6940=v19361*v9047-*p;
+  v17081=v2968*v15294-*p;
+  v7929=v8202*v9040-*p;
+  v10646=v1889*v5858-*p;
+  v12303=v16001*v2497-*p;
+  v4376=v8310*v9964-*p;
+  v18408=v7240*v445-*p;
+  v217=v16839*v15203-*p;
+  v16363=v4933*v11028-*p;
+  v6453=v16435*v161-*p;
+  v3480=v8166*v16556-*p;
+  v11391=v11187*v15246-*p;
+  v19632=v8685*v11677-*p;
+  v11566=v18274*v7826-*p;
+  v2367=v4486*v16362-*p;
+  v16494=v601*v10910-*p;
+  v5970=v183*v17354-*p;
+  v19127=v11227*v1293-*p;
+  v15277=v10132*v13725-*p;
+  v1582=v17334*v3165-*p;
+  v713=v14458*v7370-*p;
+  v12490=v14844*v624-*p;
+  v15258=v8969*v17112-*p;
+  v12350=v14802*v17832-*p;
+  v2846=v5027*v2902-*p;
+  v4642=v7750*v2775-*p;
+  v10488=v5783*v19737-*p;
+  v15088=v13719*v6386-*p;
+  v15821=v9311*v2917-*p;
+  v6193=v16951*v12892-*p;
+  v19262=v4571*v3736-*p;
+  v4622=v11131*v9298-*p;
+  v19278=v4996*v104-*p;
+  v9502=v19643*v13819-*p;
+  v4523=v5064*v9774-*p;
+  v9864=v19378*v18482-*p;
+  v17613=v11363*v2544-*p;
+  v15223=v6851*v11908-*p;
+  v126=v3106*v16197-*p;
+  v18405=v16298*v15463-*p;
+  v1841=v1829*v16740-*p;
+  v10613=v7084*v10962-*p;
+  v5323=v14580*v13369-*p;
+  v6641=v6784*v6201-*p;
+  v16102=v2375*v11304-*p;
+  v46=v10631*v16574-*p;
+  v485=v13392*v6745-*p;
+  v6760=v6113*v4562-*p;
+  v8172=v6894*v873-*p;
+  v16406=v13552*v11890-*p;
+  v5399=v324*v14920-*p;
+  v13675=v5377*v124-*p;
+  v9139=v11482*v3365-*p;
+  v2508=v8514*v17446-*p;
+  v6770=v4936*v18566-*p;
+  v12468=v15161*v4586-*p;
+  v17706=v8609*v9473-*p;
+  v11624=v18510*v10597-*p;
+  v6564=v1528*v7433-*p;
+  v12789=v15645*v9397-*p;
+  v273=v13910*v16869-*p;
+  v5809=v15551*v4248-*p;
+  v2340=v19659*v8781-*p;
+  v4227=v4620*v8355-*p;
+  v8877=v14559*v14321-*p;
+  v13254=v12252*v14783-*p;
+  v18585=v15123*v11314-*p;
+  v13627=v17732*v3559-*p;
+  v4752=v14602*v11360-*p;
+  v13330=v5794*v549-*p;
+  v6191=v7645*v13362-*p;
+  v7521=v4574*v17821-*p;
+  v4935=v15880*v4567-*p;
+  v13797=v307*v17283-*p;
+  v1730=v1916*v16007-*p;
+  v7096=v5529*v16398-*p;
+  v4935=v1563*v1005-*p;
+  v16841=v17496*v14893-*p;
+  v12233=v15300*v17905-*p;
+  v6629=v5073*v7573-*p;
+  v2859=v755*v11559-*p;
+  v3193=v14362*v2241-*p;
+  v765=v9809*v13314-*p;
+  v1142=v18735*v3122-*p;
+  v19748=v5293*v14398-*p;
+  v16807=v12671*v7234-*p;
+  v2809=v2327*v8652-*p;
+  v3022=v10117*v16723-*p;
+  v18962=v9009*v16717-*p;
+  v16421=v18171*v2610-*p;
+  v15844=v8903*v3757-*p;
+  v18941=v13211*v11652-*p;
+  v5898=v15698*v7544-*p;
+  v125=v1878*v2231-*p;
+  v19484=v19350*v12955-*p;
+  v15417=v9519*v8242-*p;
+  v6920=v12897*v8596-*p;
+  v10412=v10193*v3750-*p;
+  v16232=v14249*v16042-*p;
+  v13624=v10492*v12489-*p;
+  v15290=v14209*v1630-*p;
+  v16999=v4667*v18916-*p;
+  v7243=v11345*v6472-*p;
+  v11512=v3821*v4858-*p;
+  v11130=v4786*v3974-*p;
+  v6741=v6749*v7464-*p;
+  v13766=v9507*v12346-*p;
+  v10549=v13722*v5145-*p;
+  v10585=v15262*v3949-*p;
+  v6384=v10617*v526-*p;
+  v7287=v11946*v225-*p;
+  v49=v14784*v737-*p;
+  v3602=v15344*v7640-*p;
+  v16372=v17878*v9859-*p;
+  v6640=v218*v573-*p;
+  v12928=v16186*v14860-*p;
+  v14380=v10702*v16057-*p;
+  v18504=v18037*v10778-*p;
+  v7166=v16569*v9367-*p;
+  v3511=v7471*v3238-*p;
+  v18612=v3795*v15692-*p;
+  v2040=v3193*v13952-*p;
+  v9229=v6383*v5607-*p;
+  v5698=v6616*v11643-*p;
+  v2342=v17915*v13959-*p;
+  v9009=v6322*v9561-*p;
+  v19353=v11208*v17325-*p;
+  v8890=v19037*v18645-*p;
+  v4455=v5754*v8951-*p;
+  v17200=v12755*v5999-*p;
+  v6055=v1788*v12758-*p;
+  v11926=v11760*v9704-*p;
+  v19953=v1244*v4018-*p;
+  v4967=v1073*v15290-*p;
+  v1413=v4993*v2781-*p;
+  v4757=v2585*v15597-*p;
+  v8111=v4045*v3807-*p;
+  v6604=v5098*v14366-*p;
+  v15059=v5526*v14502-*p;
+  v15485=v7144*v8207-*p;
+  v7101=v3647*v16621-*p;
+  v15237=v3686*v14849-*p;
+  v10229=v2379*v7289-*p;
+  v15038=v9899*v15540-*p;
+  v2154=v2733*v19902-*p;
+  v10611=v1663*v19776-*p;
+  v11394=v19363*v6694-*p;
+  v8181=v6791*v584-*p;
+  v5431=v13061*v9474-*p;
+  v10026=v6979*v15781-*p;
+  v13004=v17811*v3763-*p;
+  v1548=v7629*v4788-*p;
+  v9285=v1884*v19511-*p;
+  v8025=v10539*v2150-*p;
+  v4234=v9029*v4903-*p;
+  v4679=v13209*v17981-*p;
+  v18707=v2603*v16404-*p;
+  v14145=v15287*v8257-*p;
+  v7446=v13878*v15027-*p;
+  v10584=v10926*v17740-*p;
+  v13858=v6162*v10827-*p;
+  v17468=v14005*v14827-*p;
+  v12954=v7470*v4986-*p;
+  v19731=v5088*v8177-*p;
+  v11850=v4614*v989-*p;
+  v368=v17257*v1064-*p;
+  v18184=v16490*v18164-*p;
+  v13926=v16970*v17103-*p;
+  v19492=v13480*v19367-*p;
+  v4371=v14463*v5698-*p;
+  v6205=v2856*v15272-*p;
+  v18570=v12818*v101-*p;
+  v19708=v11154*v104-*p;
+  v11762=v15036*v4541-*p;
+  v13728=v16519*v2861-*p;
+  v12004=v13896*v5436-*p;
+  v9854=v16586*v13895-*p;
+  v9441=v2663*v904-*p;
+  v10250=v12880*v16022-*p;
+  v18865=v9196*v17586-*p;
+  v11354=v6776*v14763-*p;
+  v11190=v19949*v2725-*p;
+  v13221=v2850*v3212-*p;
+  v607=v19940*v15759-*p;
+  v9747=v9397*v10484-*p;
+  v2189=v14695*v10720-*p;
+  v11299=v9445*v15412-*p;
+  v18928=v16502*v16906-*p;
+  v19537=v10097*v9498-*p;
+  v2842=v12061*v1977-*p;
+  v14091=v12629*v18940-*p;
+  v8814=v11717*v2988-*p;
+  v2439=v14659*v13432-*p;
+  v10926=v7423*v9875-*p;
+  v2239=v5819*v9070-*p;
+  v16292=v7482*v12748-*p;
+  v7610=v13385*v16459-*p;
+  v13227=v9075*v11354-*p;
+  v5872=v4026*v15262-*p;
+  v17987=v5183*v17290-*p;
+  v1454=v6194*v2438-*p;
+  v16866=v19358*v18109-*p;
+  v12760=v13560*v15370-*p;
+  v1420=v11695*v4878-*p;
+  v9432=v10713*v7911-*p;
+  v8962=v13761*v6383-*p;
+  v379=v14758*v16340-*p;
+  v8265=v718*v7870-*p;
+  v10972=v7926*v1560-*p;
+  v14708=v1230*v5170-*p;
+  v2445=v7121*v4126-*p;
+  v1422=v871*v12576-*p;
+  v8575=v17234*v13404-*p;
+  v13721=v16520*v8298-*p;
+  v6742=v13866*v4744-*p;
+  v13915=v536*v18701-*p;
+  v16898=v17840*v2844-*p;
+  v13417=v7239*v13924-*p;
+  v11171=v13561*v13925-*p;
+  v7889=v11044*v8608-*p;
+  v19423=v678*v56-*p;
+  v14488=v16120*v2288-*p;
+  v16200=v3437*v5116-*p;
+  v1059=v6917*v19463-*p;
+  v3158=v5402*v1212-*p;
+  v4777=v1567*v4987-*p;
+  v4117=v6421*v4301-*p;
+  v8936=v14424*v15673-*p;
+  v14504=v1531*v7534-*p;
+  v17761=v2637*v3849-*p;
+  v6465=v4066*v15641-*p;
+  v7595=v13304*v3591-*p;
+  v19480=v13843*v204-*p;
+  v6821=v12537*v12637-*p;
+  v10145=v9173*v14556-*p;
+  v8000=v7837*v13752-*p;
+  v5465=v306*v11834-*p;
+  v11330=v7974*v18077-*p;
+  v5292=v19435*v13219-*p;
+  v2208=v12524*v7750-*p;
+  v15125=v13134*v15414-*p;
+  v12060=v13016*v5315-*p;
+  v5927=v2943*v7259-*p;
+  v18396=v14051*v7144-*p;
+  v16281=v3761*v875-*p;
+  v1379=v2585*v7535-*p;
+  v16302=v1067*v11436-*p;
+  v12005=v16596*v11517-*p;
+  v16331=v523*v16583-*p;
+  v1694=v1669*v16148-*p;
+  v4384=v11163*v13316-*p;
+  v900=v7531*v3152-*p;
+  v17546=v4079*v12786-*p;
+  v11397=v4829*v18213-*p;
+  v10086=v8906*v2211-*p;
+  v18448=v15866*v14781-*p;
+  v10622=v11885*v14328-*p;
+  v14363=v1347*v4291-*p;
+  v8131=v1997*v7775-*p;
+  v1146=v19134*v12007-*p;
+  v9110=v10476*v5234-*p;
+  v2655=v10705*v192-*p;
+  v17916=v8776*v7151-*p;
+  v5195=v18828*v4249-*p;
+  v19810=v10409*v1206-*p;
+  v11983=v1775*v18150-*p;
+  v6849=v11516*v15804-*p;
+  v4962=v12128*v5185-*p;
+  v7293=v12383*v4909-*p;
+  v7447=v2006*v11851-*p;
+  v1009=v135*v1102-*p;
+  v3183=v12402*v3182-*p;
+  v8890=v17945*v3112-*p;
+  v4617=v67*v5226-*p;
+  v3565=v10336*v418-*p;
+  v17586=v6294*v7871-*p;
+  v18383=v6733*v4631-*p;
+  v19680=v14370*v14436-*p;
+  v4663=v5208*v11415-*p;
+  v7330=v3234*v12840-*p;
+  v5500=v6243*v1741-*p;
+  v1289=v2031*v1778-*p;
+  v1730=v13782*v5254-*p;
+  v2745=v4171*v14078-*p;
+  v11037=v14959*v1316-*p;
+  v5648=v328*v836-*p;
+  v13988=v17263*v8835-*p;
+  v16001=v812*v17567-*p;
+  v16098=v5495*v13589-*p;
+  v18665=v10449*v5580-*p;
+  v11457=v80*v16816-*p;
+  v14569=v7353*v12527-*p;
+  v9300=v5192*v8437-*p;
+  v14215=v243*v666-*p;
+  v3640=v10011*v1013-*p;
+  v9663=v3762*v2214-*p;
+  v18656=v6403*v1850-*p;
+  v11713=v6493*v7430-*p;
+  v12695=v19198*v7369-*p;
+  v18876=v5859*v5175-*p;
+  v17926=v14612*v19649-*p;
+  v539=v2292*v7615-*p;
+  v13016=v10605*v8236-*p;
+  v17297=v3522*v15342-*p;
+  v8922=v6397*v5058-*p;
+  v3480=v1698*v4496-*p;
+  v1722=v204*v4238-*p;
+  v5855=v13501*v8244-*p;
+  v1550=v10374*v15005-*p;
+  v5715=v10057*v13037-*p;
+  v10762=v4096*v6433-*p;
+  v13784=v3445*v13794-*p;
+  v10199=v9364*v11727-*p;
+  v19193=v2017*v8147-*p;
+  v1065=v11468*v11449-*p;
+  v10766=v7480*v6329-*p;
+  v11662=v7214*v16185-*p;
+  v18123=v12809*v16907-*p;
+  v13307=v396*v17994-*p;
+  v8694=v15085*v13378-*p;
+  v5744=v7219*v4940-*p;
+  v13371=v5820*v13161-*p;
+  v9981=v1233*v793-*p;
+  v18277=v7327*v11732-*p;
+  v19374=v3182*v10559-*p;
+  v8850=v3728*v6541-*p;
+  v3321=v6951*v12903-*p;
+  v14199=v17426*v14866-*p;
+  v18231=v4569*v15399-*p;
+  v628=v15064*v3811-*p;
+  v12414=v8935*v19696-*p;
+  v9536=v6226*v17202-*p;
+  v14091=v3457*v13953-*p;
+  v10647=v5386*v5537-*p;
+  v9330=v166*v3019-*p;
+  v11989=v18657*v14753-*p;
+  v6246=v18786*v17258-*p;
+  v8927=v3022*v776-*p;
+  v2449=v14607*v15985-*p;
+  v10882=v13406*v4010-*p;
+  v1623=v18575*v1548-*p;
+  v1042=v10617*v7560-*p;
+  v3882=v494*v3359-*p;
+  v11376=v3255*v13718-*p;
+  v1967=v8020*v2431-*p;
+  v3485=v9271*v464-*p;
+  v8724=v14551*v15629-*p;
+  v13114=v14616*v12886-*p;
+  v144=v16195*v15873-*p;
+  v10439=v3556*v3534-*p;
+  v18646=v4174*v7172-*p;
+  v15658=v9637*v2019-*p;
+  v2472=v6682*v18026-*p;
+  v1320=v18684*v16853-*p;
+  v15072=v3974*v16368-*p;
+  v13908=v10061*v16408-*p;
+  v11581=v14544*v1494-*p;
+  v9835=v9808*v5126-*p;
+  v16805=v4163*v6510-*p;
+  v19799=v439*v16718-*p;
+  v19938=v8521*v6098-*p;
+  v1093=v13091*v13943-*p;
+  v19926=v4120*v15612-*p;
+  v11093=v4095*v13452-*p;
+  v16966=v18841*v1338-*p;
+  v17439=v1417*v17951-*p;
+  v3151=v384*v3484-*p;
+  v12202=v13090*v6258-*p;
+  v2635=v2182*v11777-*p;
+  v86=v11972*v13991-*p;
+  v4774=v17419*v4387-*p;
+  v6263=v14502*v10867-*p;
+  v7211=v16536*v11905-*p;
+  v17663=v240*v19818-*p;
+  v7000=v15055*v11642-*p;
+  v11227=v7324*v16137-*p;
+  v6954=v4586*v16647-*p;
+  v16812=v6729*v7643-*p;
+  v4588=v3693*v15210-*p;
+  v8201=v4327*v8110-*p;
+  v11296=v18149*v19180-*p;
+  v12683=v14939*v2101-*p;
+  v19783=v16242*v346-*p;
+  v6963=v9096*v14936-*p;
+  v821=v15608*v17916-*p;
+  v8988=v9668*v11906-*p;
+  v4540=v13102*v12089-*p;
+  v3879=v16744*v9467-*p;
+  v5617=v9158*v18648-*p;
+  v1092=v15792*v9039-*p;
+  v9404=v1227*v3704-*p;
+  v16958=v14744*v1981-*p;
+  v5801=v10005*v10717-*p;
+  v12481=v8712*v8218-*p;
+  v9670=v5811*v15204-*p;
+  v14541=v4862*v1537-*p;
+  v11202=v9734*v1713-*p;
+  v5133=v9590*v10545-*p;
+  v8469=v14405*v16966-*p;
+  v2967=v6712*v9066-*p;
+  v242=v15996*v13895-*p;
+  v12356=v13332*v16564-*p;
+  v18565=v1565*v19088-*p;
+  v4174=v16774*v9514-*p;
+  v13438=v16889*v10617-*p;
+  v19366=v5764*v13451-*p;
+  v2122=v5201*v18196-*p;
+  v3445=v12621*v19569-*p;
+  v18814=v13741*v7919-*p;
+  v4531=v7775*v7954-*p;
+  v11330=v7777*v6139-*p;
+  v17255=v9232*v8662-*p;
+  v18258=v2926*v10106-*p;
+  v7506=v3989*v12680-*p;
+  v6498=v19066*v2444-*p;
+  v11751=v10012*v1815-*p;
+  v2095=v1867*v11601-*p;
+  v8170=v12731*v1361-*p;
+  v7850=v9171*v10996-*p;
+  v8555=v7416*v13364-*p;
+  v197=v13234*v18643-*p;
+  v4312=v14405*v9234-*p;
+  v6130=v1488*v9209-*p;
+  v16614=v4878*v9635-*p;
+  v14535=v14938*v2840-*p;
+  v10512=v15341*v15676-*p;
+  v296=v377*v5083-*p;
+  v17174=v514*v6598-*p;
+  v16236=v9000*v17340-*p;
+  v14204=v10798*v3355-*p;
+  v145=v1675*v10894-*p;
+  v711=v8068*v5432-*p;
+  v16801=v14629*v9029-*p;
+  v5800=v2687*v16123-*p;
+  v10041=v13438*v10406-*p;
+  v11134=v15608*v2962-*p;
+  v8135=v6461*v15596-*p;
+  v14934=v12646*v223-*p;
+  v9316=v9418*v18470-*p;
+  v9735=v2299*v13524-*p;
+  v17680=v63*v1093-*p;
+  v7871=v5899*v10065-*p;
+  v9218=v2761*v7007-*p;
+  v18075=v7889*v15609-*p;
+  v4422=v15085*v7356-*p;
+  v9699=v17863*v5674-*p;
+  v12816=v13632*v5273-*p;
+  v1790=v528*v17187-*p;
+  v2264=v17664*v9827-*p;
+  v8722=v17873*v13696-*p;
+  v11576=v17038*v15627-*p;
+  v17019=v8972*v15564-*p;
+  v16076=v4499*v3543-*p;
+  v15808=v10634*v1306-*p;
+  v13535=v14088*v1741-*p;
+  v14150=v13212*v9615-*p;
+  v12868=v2697*v15214-*p;
+  v19647=v490*v12977-*p;
+  v4591=v684*v11038-*p;
+  v10703=v6817*v18885-*p;
+  v3359=v18765*v4887-*p;
+  v17889=v2316*v17200-*p;
+  v5556=v10155*v3120-*p;
+  v16489=v18500*v16636-*p;
+  v15192=v4397*v10065-*p;
+  v9254=v13740*v15266-*p;
+  v13492=v18150*v5767-*p;
+  v2166=v6230*v3754-*p;
+  v5896=v17101*v12356-*p;
+  v17564=v16432*v7779-*p;
+  v18092=v17527*v190-*p;
+  v4618=v10378*v16604-*p;
+  v7155=v14788*v8129-*p;
+  v1190=v4669*v17542-*p;
+  v6991=v11969*v10646-*p;
+  v14033=v10069*v16248-*p;
+  v5490=v17325*v11104-*p;
+  v16050=v12951*v17789-*p;
+  v18374=v12517*v10966-*p;
+  v10996=v14693*v8468-*p;
+  v1502=v2057*v5632-*p;
+  v2286=v13015*v4064-*p;
+  v2796=v7113*v9891-*p;
+  v87=v15636*v15867-*p;
+  v13504=v17769*v3826-*p;
+  v2451=v18110*v8923-*p;
+  v8990=v1254*v5428-*p;
+  v14779=v8003*v16391-*p;
+  v12022=v5865*v4714-*p;
+  v7497=v11013*v19885-*p;
+  v8202=v11190*v517-*p;
+  v411=v8015*v3995-*p;
+  v9943=v4113*v3195-*p;
+  v3625=v13620*v726-*p;
+  v19465=v2286*v9988-*p;
+  v12272=v11106*v4020-*p;
+  v4113=v4229*v312-*p;
+  v5104=v6844*v17307-*p;
+  v4914=v17521*v19639-*p;
+  v14384=v19904*v2896-*p;
+  v16709=v7197*v6321-*p;
+  v19102=v5156*v5815-*p;
+  v2949=v11621*v1884-*p;
+  v17130=v3076*v18973-*p;
+  v4969=v18049*v12018-*p;
+  v2070=v5049*v10466-*p;
+  v3248=v14345*v19505-*p;
+  v12374=v2840*v19232-*p;
+  v2320=v16831*v3952-*p;
+  v18868=v13060*v14828-*p;
+  v15105=v2378*v13808-*p;
+  v12238=v19714*v19494-*p;
+  v3608=v17787*v11662-*p;
+  v13115=v19127*v9734-*p;
+  v9901=v12065*v11528-*p;
+  v13106=v15332*v7650-*p;
+  v12688=v3364*v13924-*p;
+  v9663=v7795*v17646-*p;
+  v959=v3593*v12178-*p;
+  v12193=v17391*v4945-*p;
+  v17186=v4782*v18845-*p;
+  v3942=v16993*v17453-*p;
+  v10674=v13835*v14608-*p;
+  v10290=v17053*v19884-*p;
+  v19260=v4431*v2681-*p;
+  v14547=v7284*v14407-*p;
+  v1579=v9958*v19765-*p;
+  v6875=v355*v12165-*p;
+  v15167=v9404*v132-*p;
+  v19603=v13445*v10484-*p;
+  v17608=v13760*v8424-*p;
+  v15271=v13141*v1653-*p;
+  v1807=v16979*v7007-*p;
+  v5303=v9594*v17224-*p;
+  v11682=v8747*v2262-*p;
+  v7563=v16930*v14497-*p;
+  v5568=v11413*v479-*p;
+  v19516=v8499*v11695-*p;
+  v7767=v12845*v7682-*p;
+  v17635=v13540*v71-*p;
+  v17235=v1419*v39-*p;
+  v3231=v15504*v10468-*p;
+  v6711=v11101*v8236-*p;
+  v18972=v4702*v12132-*p;
+  v11971=v104*v15444-*p;
+  v16487=v1223*v9730-*p;
+  v8810=v2894*v17120-*p;
+  v1770=v16242*v11652-*p;
+  v8818=v5100*v11480-*p;
+  v17411=v2800*v10873-*p;
+  v17599=v17811*v235-*p;
+  v5250=v5640*v11711-*p;
+  v16407=v18385*v17928-*p;
+  v2582=v12734*v8435-*p;
+  v7338=v13961*v11637-*p;
+  v8086=v18779*v4262-*p;
+  v1235=v906*v12649-*p;
+  v6184=v3441*v2200-*p;
+  v17625=v18206*v3336-*p;
+  v11923=v727*v5287-*p;
+  v13804=v13470*v9122-*p;
+  v3456=v18470*v12655-*p;
+  v1055=v351*v13389-*p;
+  v17990=v2935*v3199-*p;
+  v7506=v54*v1525-*p;
+  v178=v1956*v14735-*p;
+  v7359=v18585*v5684-*p;
+  v1319=v3459*v14421-*p;
+  v15024=v5910*v6833-*p;
+  v11090=v3745*v19585-*p;
+  v1477=v17545*v7627-*p;
+  v3638=v8716*v19975-*p;
+  v4656=v2132*v11493-*p;
+  v12033=v708*v18398-*p;
+  v6097=v1523*v7876-*p;
+  v188=v5941*v16046-*p;
+  v999=v9819*v12638-*p;
+  v12890=v11334*v16844-*p;
+  v11647=v15646*v4663-*p;
+  v12277=v15187*v18755-*p;
+  v1103=v7889*v6873-*p;
+  v15467=v6939*v5552-*p;
+  v14239=v12886*v18217-*p;
+  v12078=v15099*v986-*p;
+  v11311=v19761*v829-*p;
+  v15655=v8713*v9266-*p;
+  v10796=v17598*v16883-*p;
+  v19333=v5429*v4920-*p;
+  v17104=v14330*v11051-*p;
+  v17853=v3659*v6647-*p;
+  v8819=v4877*v17846-*p;
+  v13139=v4583*v16080-*p;
+  v15449=v5964*v7113-*p;
+  v7737=v7328*v15155-*p;
+  v5289=v11395*v17158-*p;
+  v7967=v5577*v17659-*p;
+  v1608=v19159*v2915-*p;
+  v17700=v1332*v5747-*p;
+  v5722=v7083*v17549-*p;
+  v2808=v13364*v16339-*p;
+  v10111=v16330*v15257-*p;
+  v3784=v8213*v19241-*p;
+  v3219=v11015*v3881-*p;
+  v4994=v3444*v9657-*p;
+  v9969=v3814*v9225-*p;
+  v13121=v12633*v11167-*p;
+  v8194=v16146*v10377-*p;
+  v5308=v5713*v16105-*p;
+  v12783=v10866*v2601-*p;
+  v1122=v12141*v17308-*p;
+  v19360=v3038*v17551-*p;
+  v18172=v10141*v19259-*p;
+  v5459=v6032*v17867-*p;
+  v17835=v28*v9466-*p;
+  v16508=v10543*v16756-*p;
+  v10534=v11378*v8429-*p;
+  v5263=v3402*v17775-*p;
+  v5157=v10293*v18502-*p;
+  v10251=v19210*v1405-*p;
+  v2123=v9682*v16011-*p;
+  v3900=v19636*v15092-*p;
+  v12838=v6532*v17617-*p;
+  v15854=v15209*v18124-*p;
+  v1864=v19075*v16861-*p;
+  v15454=v15960*v13794-*p;
+  v14298=v17357*v6396-*p;
+  v15612=v15057*v14611-*p;
+  v5850=v19562*v15618-*p;
+  v12772=v6458*v15260-*p;
+  v2533=v9957*v14802-*p;
+  v7749=v18880*v3723-*p;
+  v18326=v19524*v1161-*p;
+  v1048=v642*v7257-*p;
+  v17265=v8500*v9897-*p;
+  v13561=v14916*v6504-*p;
+  v15874=v13510*v19569-*p;
+  v19680=v7683*v15816-*p;
+  v3345=v14683*v3165-*p;
+  v9919=v3981*v14846-*p;
+  v12736=v5563*v15912-*p;
+  v17324=v18682*v7813-*p;
+  v19166=v1226*v13116-*p;
+  v14745=v12636*v8237-*p;
+  v15396=v10563*v1052-*p;
+  v15324=v705*v3200-*p;
+  v11481=v18795*v1938-*p;
+  v16198=v16562*v3027-*p;
+  v2810=v8989*v9361-*p;
+  v2213=v8593*v3727-*p;
+  v17220=v10676*v2020-*p;
+  v10685=v7490*v5419-*p;
+  v504=v18931*v11939-*p;
+  v3792=v5047*v6828-*p;
+  v9269=v6343*v11636-*p;
+  v13161=v19676*v5260-*p;
+  v14739=v8626*v8929-*p;
+  v19334=v6431*v14545-*p;
+  v2086=v3477*v53-*p;
+  v5599=v11680*v15454-*p;
+  v491=v985*v16076-*p;
+  v19971=v12167*v12911-*p;
+  v4913=v3713*v11902-*p;
+  v1857=v10791*v9028-*p;
+  v6553=v19312*v3531-*p;
+  v3537=v6741*v14855-*p;
+  v11882=v5226*v17669-*p;
+  v13622=v11638*v15410-*p;
+  v19215=v5530*v6710-*p;
+  v10490=v9003*v19748-*p;
+  v12593=v12470*v511-*p;
+  v5968=v14000*v12408-*p;
+  v7586=v846*v1174-*p;
+  v6037=v2600*v8351-*p;
+  v2726=v3351*v5591-*p;
+  v5887=v6922*v18189-*p;
+  v6124=v12534*v9608-*p;
+  v14858=v1635*v4177-*p;
+  v13868=v18894*v6122-*p;
+  v8981=v13088*v6192-*p;
+  v18958=v5376*v7189-*p;
+  v17317=v12912*v15867-*p;
+  v9128=v10892*v5550-*p;
+  v8161=v19059*v16841-*p;
+  v6000=v9778*v10514-*p;
+  v3258=v17783*v17892-*p;
+  v19991=v15697*v595-*p;
+  v14024=v18452*v18825-*p;
+  v19856=v13603*v18574-*p;
+  v13455=v9671*v5430-*p;
+  v6673=v15494*v3490-*p;
+  v11602=v18972*v7820-*p;
+  v17059=v13714*v19920-*p;
+  v4314=v15855*v1918-*p;
+  v3230=v11495*v3073-*p;
+  v5331=v9080*v13951-*p;
+  v10563=v13713*v7641-*p;
+  v11367=v16830*v7289-*p;
+  v651=v11877*v17818-*p;
+  v402=v15146*v4313-*p;
+  v3887=v14125*v1183-*p;
+  v19773=v17672*v4544-*p;
+  v2377=v9784*v4965-*p;
+  v9809=v2905*v12674-*p;
+  v5942=v18430*v17189-*p;
+  v1698=v567*v16583-*p;
+  v19963=v5421*v9394-*p;
+  v11661=v19229*v5579-*p;
+  v3862=v2116*v9161-*p;
+  v8684=v9541*v11892-*p;
+  v16591=v4839*v4526-*p;
+  v17921=v15419*v13165-*p;
+  v6429=v1640*v13294-*p;
+  v9166=v14688*v9088-*p;
+  v6643=v6095*v9509-*p;
+  v10086=v3974*v17766-*p;
+  v12000=v15393*v7003-*p;
+  v18640=v3142*v13355-*p;
+  v6026=v9715*v11527-*p;
+  v5929=v12855*v7048-*p;
+  v948=v7704*v5341-*p;
+  v1101=v19959*v11098-*p;
+  v1769=v14574*v13468-*p;
+  v2320=v3272*v1679-*p;
+  v10309=v8460*v16731-*p;
+  v8903=v13016*v5583-*p;
+  v15160=v13942*v13219-*p;
+  v10462=v16770*v720-*p;
+  v18298=v817*v3757-*p;
+  v19839=v16211*v14375-*p;
+  v11596=v615*v11373-*p;
+  v2956=v13100*v9993-*p;
+  v11624=v12613*v6895-*p;
+  v885=v4855*v1563-*p;
+  v14750=v14908*v9251-*p;
+  v2015=v18054*v14323-*p;
+  v11085=v13904*v5621-*p;
+  v14061=v14113*v18968-*p;
+  v7791=v18465*v2460-*p;
+  v18832=v280*v13816-*p;
+  v12448=v533*v5807-*p;
+  v14033=v12658*v7186-*p;
+  v17125=v7545*v17769-*p;
+  v283=v5525*v5069-*p;
+  v19005=v15508*v17212-*p;
+  v12800=v12482*v2022-*p;
+  v9618=v15602*v3967-*p;
+  v3730=v16288*v19329-*p;
+  v13999=v4332*v1097-*p;
+  v6018=v10723*v4675-*p;
+  v17020=v1122*v1269-*p;
+  v9337=v11993*v11040-*p;
+  v14902=v2745*v350-*p;
+  v8356=v6576*v9299-*p;
+  v19877=v204*v15612-*p;
+  v14011=v19649*v7567-*p;
+  v1016=v11129*v10031-*p;
+  v16222=v8781*v6733-*p;
+  v15580=v12175*v15594-*p;
+  v16405=v14339*v5558-*p;
+  v15954=v19313*v1890-*p;
+  v3137=v6434*v7127-*p;
+  v7349=v16868*v10239-*p;
+  v5021=v518*v17243-*p;
+  v11928=v8849*v3087-*p;
+  v19629=v1401*v1285-*p;
+  v16404=v7404*v9485-*p;
+  v8695=v15977*v6070-*p;
+  v7769=v16515*v5278-*p;
+  v5972=v19353*v8286-*p;
+  v16623=v9013*v2592-*p;
+  v10896=v6693*v10882-*p;
+  v14103=v19246*v16332-*p;
+  v1205=v16284*v14464-*p;
+  v5246=v4143*v9702-*p;
+  v1056=v12105*v10702-*p;
+  v14399=v550*v2137-*p;
+  v10691=v4128*v4208-*p;
+  v4770=v16705*v15190-*p;
+  v5226=v15242*v10972-*p;
+  v18164=v4560*v10439-*p;
+  v2849=v17375*v19455-*p;
+  v9317=v10482*v5199-*p;
+  v2735=v1098*v2356-*p;
+  v18827=v6846*v8129-*p;
+  v17990=v48*v3339-*p;
+  v975=v16524*v435-*p;
+  v19551=v14822*v18175-*p;
+  v14874=v9030*v5021-*p;
+  v7864=v12770*v11093-*p;
+  v17876=v12990*v7007-*p;
+  v18166=v3412*v7867-*p;
+  v18700=v1568*v8100-*p;
+  v9531=v15595*v12350-*p;
+  v17989=v17586*v16737-*p;
+  v17183=v7781*v12155-*p;
+  v3523=v5730*v6920-*p;
+  v7388=v7735*v7605-*p;
+  v11909=v8077*v19733-*p;
+  v15015=v15901*v19011-*p;
+  v77=v6206*v4993-*p;
+  v14835=v6889*v9211-*p;
+  v18706=v7955*v17530-*p;
+  v9683=v4034*v7497-*p;
+  v7495=v10220*v556-*p;
+  v18803=v6469*v14709-*p;
+  v8020=v4032*v3379-*p;
+  v1301=v9832*v5958-*p;
+  v12341=v1972*v19235-*p;
+  v6339=v3873*v7882-*p;
+  v19582=v379*v10815-*p;
+  v17400=v1326*v3749-*p;
+  v12486=v9445*v13763-*p;
+  v19895=v16175*v16499-*p;
+  v6783=v5384*v19638-*p;
+  v9121=v6349*v10745-*p;
+  v4269=v6342*v2815-*p;
+  v16122=v3843*v18921-*p;
+  v9932=v10716*v9534-*p;
+  v510=v17553*v5865-*p;
+  v5393=v13848*v5563-*p;
+  v162=v2916*v7285-*p;
+  v1618=v15618*v10159-*p;
+  v13760=v18180*v5462-*p;
+  v13498=v10790*v11574-*p;
+  v9565=v6492*v17677-*p;
+  v3521=v5988*v1735-*p;
+  v15700=v636*v17632-*p;
+  v1191=v13168*v5887-*p;
+  v13848=v4625*v4164-*p;
+  v14462=v4324*v5581-*p;
+  v1066=v15834*v5792-*p;
+  v13285=v6118*v7820-*p;
+  v14117=v1770*v18259-*p;
+  v2496=v3555*v6216-*p;
+  v9507=v11485*v397-*p;
+  v10319=v18628*v14323-*p;
+  v5937=v17902*v5889-*p;
+  v11303=v12956*v4710-*p;
+  v7544=v15473*v19719-*p;
+  v18995=v16949*v19145-*p;
+  v3151=v7176*v6092-*p;
+  v6798=v15397*v11641-*p;
+  v15762=v1567*v8652-*p;
+  v11984=v4274*v9474-*p;
+  v11056=v16178*v6959-*p;
+  v10216=v4988*v16576-*p;
+  v1114=v199*v7791-*p;
+  v14017=v8125*v5416-*p;
+  v12305=v19271*v16214-*p;
+  v4200=v13476*v8787-*p;
+  v3025=v14756*v19099-*p;
+  v18626=v18829*v13224-*p;
+  v4880=v15393*v10269-*p;
+  v15146=v595*v3919-*p;
+  v18250=v19206*v4355-*p;
+  v1540=v19861*v5122-*p;
+  v12667=v5293*v13750-*p;
+  v18810=v2818*v10233-*p;
+  v8240=v9990*v19990-*p;
+  v10738=v535*v5649-*p;
+  v8864=v648*v9279-*p;
+  v2103=v4476*v13006-*p;
+  v16665=v8995*v18594-*p;
+  v3269=v15686*v19275-*p;
+  v10181=v1379*v10062-*p;
+  v12639=v5090*v17825-*p;
+  v15099=v3738*v3962-*p;
+  v9845=v2498*v3317-*p;
+  v7567=v9695*v1571-*p;
+  v16278=v2990*v4189-*p;
+  v15454=v12255*v4734-*p;
+  v19220=v3728*v14417-*p;
+  v13398=v5230*v17151-*p;
+  v16393=v1605*v11650-*p;
+  v8833=v6265*v3309-*p;
+  v13701=v4118*v8253-*p;
+  v14315=v16061*v8692-*p;
+  v17397=v10109*v4248-*p;
+  v19635=v13784*v13412-*p;
+  v14259=v5264*v17036-*p;
+  v7277=v14336*v5061-*p;
+  v14470=v17466*v2778-*p;
+  v16114=v1703*v14171-*p;
+  v13890=v14713*v16704-*p;
+  v4100=v13397*v4697-*p;
+  v10028=v137*v13856-*p;
+  v16506=v3205*v17321-*p;
+  v9095=v10453*v19135-*p;
+  v10506=v10103*v11088-*p;
+  v1404=v10554*v12200-*p;
+  v11291=v12009*v2188-*p;
+  v16977=v18611*v19179-*p;
+  v6575=v4040*v4385-*p;
+  v4052=v19022*v7958-*p;
+  v10442=v2781*v1286-*p;
+  v6522=v3136*v18447-*p;
+  v393=v10687*v3235-*p;
+  v19067=v4248*v9315-*p;
+  v9162=v2036*v1946-*p;
+  v19096=v11051*v6709-*p;
+  v600=v2866*v10371-*p;
+  v16378=v12003*v10947-*p;
+  v17155=v18786*v9034-*p;
+  v8218=v12203*v16583-*p;
+  v1705=v3806*v19149-*p;
+  v9515=v1396*v16012-*p;
+  v13511=v13446*v14113-*p;
+  v19602=v12415*v1214-*p;
+  v13706=v13800*v4077-*p;
+  v3922=v3744*v17155-*p;
+  v16360=v12231*v19058-*p;
+  v9278=v9756*v18857-*p;
+  v15227=v13271*v16856-*p;
+  v12386=v5118*v7869-*p;
+  v9637=v6827*v15315-*p;
+  v2055=v1862*v4215-*p;
+  v3460=v11476*v13994-*p;
+  v13346=v15683*v16145-*p;
+  v18489=v10358*v8375-*p;
+  v829=v15765*v19938-*p;
+  v14016=v4596*v12321-*p;
+  v15480=v14302*v1314-*p;
+  v18397=v9755*v15913-*p;
+  v13476=v15430*v15175-*p;
+  v13288=v14871*v17513-*p;
+  v10360=v840*v17778-*p;
+  v9119=v5408*v13271-*p;
+  v17957=v15711*v2585-*p;
+  v18437=v6601*v4892-*p;
+  v1017=v12048*v17063-*p;
+  v16855=v16708*v960-*p;
+  v1157=v19960*v2075-*p;
+  v19250=v224*v12453-*p;
+  v13508=v15703*v11988-*p;
+  v4679=v14699*v6918-*p;
+  v2261=v16026*v5064-*p;
+  v2395=v10318*v14620-*p;
+  v5589=v9304*v11916-*p;
+  v6153=v19425*v11372-*p;
+  v17487=v19404*v8823-*p;
+  v19293=v14261*v17796-*p;
+  v14972=v14046*v17410-*p;
+  v9072=v9787*v2842-*p;
+  v12365=v7675*v3312-*p;
+  v5812=v18005*v6860-*p;
+  v4422=v2796*v5820-*p;
+  v17916=v7118*v4447-*p;
+  v10431=v6803*v8826-*p;
+  v2728=v9622*v5206-*p;
+  v19496=v3631*v7329-*p;
+  v2161=v5870*v4287-*p;
+  v251=v11163*v13218-*p;
+  v1746=v4151*v9031-*p;
+  v1968=v19256*v2274-*p;
+  v11937=v12098*v4211-*p;
+  v8500=v4239*v12074-*p;
+  v6375=v8601*v18866-*p;
+  v18342=v14836*v17400-*p;
+  v15522=v15342*v619-*p;
+  v5494=v10945*v6952-*p;
+  v3305=v4749*v4895-*p;
+  v15735=v13391*v13752-*p;
+  v6768=v7070*v19839-*p;
+  v12935=v14453*v8628-*p;
+  v5447=v8394*v6563-*p;
+  v17171=v16051*v9820-*p;
+  v13184=v14246*v127-*p;
+  v13602=v16464*v6539-*p;
+  v6172=v1276*v7390-*p;
+  v1760=v18652*v18032-*p;
+  v18804=v7797*v18223-*p;
+  v15961=v15023*v11394-*p;
+  v823=v5120*v19897-*p;
+  v4122=v14948*v6934-*p;
+  v9174=v17867*v13259-*p;
+  v5983=v15094*v9398-*p;
+  v6363=v5689*v6489-*p;
+  v18636=v10456*v19839-*p;
+  v17438=v13022*v2046-*p;
+  v13825=v11637*v4389-*p;
+  v6917=v11424*v7080-*p;
+  v12363=v7279*v16516-*p;
+  v701=v17235*v2524-*p;
+  v10776=v7153*v13576-*p;
+  v9330=v199*v14233-*p;
+  v6685=v2879*v13764-*p;
+  v3453=v14779*v1510-*p;
+  v14753=v1390*v10680-*p;
+  v3150=v1603*v4105-*p;
+  v17819=v2304*v4724-*p;
+  v14970=v415*v8125-*p;
+  v8659=v716*v19299-*p;
+  v10075=v3242*v403-*p;
+  v607=v11754*v5666-*p;
+  v73=v16795*v18287-*p;
+  v10235=v19332*v8266-*p;
+  v14428=v17478*v7268-*p;
+  v5621=v10236*v10367-*p;
+  v15764=v6024*v15962-*p;
+  v7505=v4651*v17965-*p;
+  v4665=v3208*v8372-*p;
+  v15558=v16835*v9552-*p;
+  v4356=v4453*v9649-*p;
+  v6652=v6023*v7416-*p;
+  v12249=v16807*v7387-*p;
+  v11868=v11890*v2689-*p;
+  v5100=v3888*v17625-*p;
+  v11529=v18895*v7230-*p;
+  v13536=v8188*v5663-*p;
+  v12688=v7008*v18923-*p;
+  v11983=v19324*v16162-*p;
+  v17470=v6256*v16508-*p;
+  v1088=v18129*v3424-*p;
+  v447=v2850*v15718-*p;
+  v10564=v19695*v5449-*p;
+  v1517=v9431*v12793-*p;
+  v1906=v12826*v723-*p;
+  v4097=v7251*v10937-*p;
+  v7069=v9239*v7644-*p;
+  v19675=v14754*v18677-*p;
+  v13497=v17053*v9091-*p;
+  v4775=v14177*v15457-*p;
+  v15843=v16507*v17171-*p;
+  v17562=v3029*v8352-*p;
+  v4032=v12628*v10633-*p;
+  v8336=v12128*v1350-*p;
+  v8872=v15572*v6659-*p;
+  v19077=v4152*v3901-*p;
+  v17243=v7749*v4208-*p;
+  v7582=v7957*v18808-*p;
+  v5681=v14340*v6125-*p;
+  v1254=v15429*v8381-*p;
+  v6334=v751*v6872-*p;
+  v7754=v18148*v8386-*p;
+  v3721=v7054*v3156-*p;
+  v13003=v12930*v16333-*p;
+  v19648=v12116*v766-*p;
+  v11666=v8998*v8331-*p;
+  v709=v11354*v34-*p;
+  v13307=v5975*v8607-*p;
+  v4311=v1732*v17866-*p;
+  v11478=v19846*v18386-*p;
+  v15545=v6462*v18586-*p;
+  v2199=v13854*v9454-*p;
+  v3866=v3533*v1581-*p;
+  v13469=v8522*v5162-*p;
+  v17453=v2017*v4361-*p;
+  v5115=v13355*v10335-*p;
+  v18943=v19699*v17435-*p;
+  v7439=v9486*v18842-*p;
+  v13124=v10117*v11840-*p;
+  v8109=v2600*v573-*p;
+  v9318=v18104*v14776-*p;
+  v8841=v5696*v18643-*p;
+  v5636=v12743*v19450-*p;
+  v7971=v10488*v12630-*p;
+  v12368=v11115*v14785-*p;
+  v2951=v18828*v942-*p;
+  v18154=v13550*v7894-*p;
+  v19808=v11093*v9637-*p;
+  v8705=v13863*v8202-*p;
+  v14593=v14504*v14046-*p;
+  v11935=v15421*v11874-*p;
+  v7294=v6209*v14500-*p;
+  v17970=v2661*v17149-*p;
+  v19207=v17598*v11854-*p;
+  v11028=v18247*v10721-*p;
+  v11443=v2043*v13036-*p;
+  v16952=v18475*v272-*p;
+  v1992=v6371*v10374-*p;
+  v14123=v12900*v681-*p;
+  v13953=v10485*v2039-*p;
+  v1727=v1665*v3290-*p;
+  v919=v18246*v8617-*p;
+  v17550=v14836*v2759-*p;
+  v6991=v1448*v9704-*p;
+  v12548=v4646*v6276-*p;
+  v2365=v14771*v10836-*p;
+  v13371=v2935*v4446-*p;
+  v7593=v15843*v8919-*p;
+  v15779=v1177*v18698-*p;
+  v10291=v12097*v14362-*p;
+  v11029=v6288*v19485-*p;
+  v5531=v15162*v6657-*p;
+  v1863=v15534*v3796-*p;
+  v5834=v5213*v12633-*p;
+  v5512=v16831*v15075-*p;
+  v3589=v18079*v13793-*p;
+  v8830=v19224*v9237-*p;
+  v19053=v18176*v16701-*p;
+  v15114=v11573*v15290-*p;
+  v17204=v1618*v5797-*p;
+  v12914=v14622*v12392-*p;
+  v19059=v4653*v16679-*p;
+  v10750=v13595*v14261-*p;
+  v4239=v11422*v8725-*p;
+  v17975=v4948*v609-*p;
+  v7480=v18958*v447-*p;
+  v663=v16455*v7255-*p;
+  v12718=v16569*v15474-*p;
+  v11496=v14868*v7668-*p;
+  v2373=v17336*v13453-*p;
+  v10677=v18627*v18454-*p;
+  v5124=v16733*v14768-*p;
+  v11132=v16428*v19560-*p;
+  v4525=v7790*v4026-*p;
+  v9940=v18506*v12744-*p;
+  v19295=v4070*v8468-*p;
+  v17286=v7016*v19575-*p;
+  v13938=v4474*v18052-*p;
+  v9566=v823*v3179-*p;
+  v15215=v19984*v4858-*p;
+  v6655=v1300*v3247-*p;
+  v16259=v100*v18553-*p;
+  v7165=v8772*v8171-*p;
+  v1448=v907*v3552-*p;
+  v17845=v13557*v3189-*p;
+  v7706=v11638*v2845-*p;
+  v5426=v3969*v14247-*p;
+  v6554=v16632*v18675-*p;
+  v1777=v13927*v12793-*p;
+  v12960=v12411*v8262-*p;
+  v10730=v11459*v3078-*p;
+  v5990=v5235*v14156-*p;
+  v18339=v11802*v4132-*p;
+  v14012=v19729*v11241-*p;
+  v12790=v2332*v15442-*p;
+  v10862=v9057*v3890-*p;
+  v12010=v1616*v4360-*p;
+  v230=v8553*v1751-*p;
+  v8113=v11496*v18555-*p;
+  v10803=v7215*v13832-*p;
+  v18882=v9284*v7638-*p;
+  v10462=v10181*v7561-*p;
+  v6177=v19710*v9720-*p;
+  v628=v12856*v6314-*p;
+  v11898=v15707*v12530-*p;
+  v16445=v17523*v19253-*p;
+  v9833=v12008*v15208-*p;
+  v9958=v10817*v7378-*p;
+  v5399=v15782*v12521-*p;
+  v19716=v4788*v16641-*p;
+  v13485=v12186*v8918-*p;
+  v14000=v17079*v7784-*p;
+  v497=v16038*v729-*p;
+  v13411=v17686*v19384-*p;
+  v11062=v8399*v5888-*p;
+  v19956=v8588*v2083-*p;
+  v15543=v17157*v3226-*p;
+  v11879=v4080*v7080-*p;
+  v3894=v13926*v1983-*p;
+  v5180=v13406*v6522-*p;
+  v15110=v19428*v16011-*p;
+  v1789=v9728*v19263-*p;
+  v3542=v19330*v8230-*p;
+  v9517=v7340*v4909-*p;
+  v14732=v8474*v17562-*p;
+  v16826=v18971*v3426-*p;
+  v6419=v9992*v3125-*p;
+  v16273=v3784*v11260-*p;
+  v6400=v5403*v11215-*p;
+  v12366=v1745*v2179-*p;
+  v15474=v9703*v4649-*p;
+  v3150=v13113*v3644-*p;
+  v18098=v17450*v15298-*p;
+  v18777=v17829*v1367-*p;
+  v10406=v3293*v4254-*p;
+  v12771=v10711*v3598-*p;
+  v11751=v16292*v17178-*p;
+  v1410=v14827*v1701-*p;
+  v17515=v6397*v16016-*p;
+  v1760=v17871*v16726-*p;
+  v15684=v14274*v4651-*p;
+  v16876=v7895*v3061-*p;
+  v7646=v11933*v19200-*p;
+  v837=v3643*v18709-*p;
+  v3695=v43*v1919-*p;
+  v1240=v3852*v17035-*p;
+  v10929=v12008*v4702-*p;
+  v19531=v12999*v8983-*p;
+  v3673=v13511*v8355-*p;
+  v18394=v9532*v17258-*p;
+  v5999=v16147*v19658-*p;
+  v9136=v19468*v15664-*p;
+  v19151=v1329*v19409-*p;
+  v7279=v6093*v5582-*p;
+  v13648=v13234*v6186-*p;
+  v7621=v7516*v11673-*p;
+  v17847=v1742*v15131-*p;
+  v16920=v16534*v12372-*p;
+  v12827=v14211*v13800-*p;
+  v7250=v629*v16284-*p;
+  v19014=v19862*v3879-*p;
+  v12660=v16301*v19980-*p;
+  v15109=v1036*v15035-*p;
+  v14732=v11166*v3619-*p;
+  v5037=v1657*v444-*p;
+  v5443=v6673*v8486-*p;
+  v5426=v1564*v19548-*p;
+  v10734=v10627*v15312-*p;
+  v16663=v15376*v5335-*p;
+  v4054=v8258*v2437-*p;
+  v3711=v2839*v3635-*p;
+  v10132=v3892*v17377-*p;
+  v8230=v11769*v12173-*p;
+  v7278=v7516*v16821-*p;
+  v2460=v5329*v8782-*p;
+  v17720=v7499*v16368-*p;
+  v4229=v9454*v2212-*p;
+  v10891=v3403*v16398-*p;
+  v3259=v10830*v994-*p;
+  v3828=v12413*v12811-*p;
+  v13076=v7612*v13215-*p;
+  v18485=v12223*v7220-*p;
+  v6455=v2282*v8393-*p;
+  v11618=v9865*v9855-*p;
+  v13584=v16743*v1574-*p;
+  v10293=v4368*v12515-*p;
+  v10547=v16486*v8341-*p;
+  v6816=v15634*v4798-*p;
+  v12397=v4172*v6150-*p;
+  v15369=v11991*v19341-*p;
+  v17890=v14401*v19909-*p;
+  v752=v2273*v6699-*p;
+  v17567=v15846*v11398-*p;
+  v6309=v5728*v5835-*p;
+  v7409=v5638*v8708-*p;
+  v4054=v15435*v4940-*p;
+  v17567=v14101*v13624-*p;
+  v7054=v16300*v14620-*p;
+  v9978=v13859*v8039-*p;
+  v2844=v11879*v30-*p;
+  v1791=v9437*v5459-*p;
+  v12867=v19887*v4238-*p;
+  v16825=v7503*v3839-*p;
+  v19693=v9309*v8378-*p;
+  v13962=v18191*v9369-*p;
+  v6291=v15756*v18080-*p;
+  v14205=v6033*v2780-*p;
+  v16528=v17044*v3379-*p;
+  v6870=v16328*v4864-*p;
+  v17979=v5407*v3604-*p;
+  v5315=v5100*v18993-*p;
+  v19211=v5961*v7175-*p;
+  v17667=v9708*v19082-*p;
+  v4519=v3162*v17666-*p;
+  v13982=v18722*v8060-*p;
+  v1453=v9627*v19478-*p;
+  v11744=v6671*v3743-*p;
+  v13970=v12098*v5447-*p;
+  v3867=v18187*v5867-*p;
+  v19036=v19590*v3551-*p;
+  v837=v18577*v12604-*p;
+  v3845=v15523*v8233-*p;
+  v14566=v19354*v2671-*p;
+  v17430=v3114*v8453-*p;
+  v19654=v2406*v13257-*p;
+  v18696=v7613*v8252-*p;
+  v9642=v6550*v3635-*p;
+  v11968=v12918*v10494-*p;
+  v19451=v11452*v12334-*p;
+  v8745=v5831*v15581-*p;
+  v6581=v9267*v15891-*p;
+  v16610=v16036*v16589-*p;
+  v8118=v3445*v886-*p;
+  v12006=v19921*v14702-*p;
+  v18848=v7498*v18252-*p;
+  v8072=v7846*v18158-*p;
+  v8263=v12281*v4584-*p;
+  v8745=v17411*v5672-*p;
+  v409=v11540*v2758-*p;
+  v14253=v817*v7019-*p;
+  v7259=v3768*v18277-*p;
+  v5346=v8884*v12158-*p;
+  v14213=v2912*v6573-*p;
+  v10224=v8698*v137-*p;
+  v12175=v7694*v14304-*p;
+  v6511=v17647*v6428-*p;
+  v4609=v3957*v15012-*p;
+  v17339=v10417*v15560-*p;
+  v7750=v4186*v15026-*p;
+  v11188=v11098*v8850-*p;
+  v18157=v1900*v8259-*p;
+  v3092=v16794*v18254-*p;
+  v8279=v9843*v6236-*p;
+  v1954=v16246*v5459-*p;
+  v3681=v5593*v5241-*p;
+  v17147=v16385*v7562-*p;
+  v19083=v3305*v11291-*p;
+  v17383=v1092*v19376-*p;
+  v16717=v15117*v11020-*p;
+  v14969=v15451*v12022-*p;
+  v13003=v17168*v148-*p;
+  v14943=v3654*v6309-*p;
+  v6098=v5947*v14262-*p;
+  v13769=v6142*v2847-*p;
+  v6933=v1160*v19630-*p;
+  v11520=v670*v3930-*p;
+  v13528=v2648*v17801-*p;
+  v13450=v2483*v17798-*p;
+  v13671=v13160*v10937-*p;
+  v6487=v16952*v11212-*p;
+  v6115=v2850*v17060-*p;
+  v300=v4499*v19457-*p;
+  v10497=v19809*v7370-*p;
+  v11843=v11754*v18348-*p;
+  v5678=v9270*v3614-*p;
+  v14713=v14905*v11170-*p;
+  v15453=v9075*v17015-*p;
+  v10385=v937*v888-*p;
+  v4766=v16372*v10881-*p;
+  v8746=v11863*v18882-*p;
+  v2874=v7680*v13726-*p;
+  v9729=v4327*v3514-*p;
+  v7261=v8786*v1363-*p;
+  v17874=v7677*v7051-*p;
+  v3589=v11691*v10901-*p;
+  v15250=v17228*v2764-*p;
+  v8194=v13204*v13790-*p;
+  v5605=v15768*v2515-*p;
+  v3695=v8849*v5084-*p;
+  v2332=v1843*v9155-*p;
+  v16304=v15598*v12433-*p;
+  v9029=v762*v2718-*p;
+  v11709=v11781*v11860-*p;
+  v10892=v11692*v8469-*p;
+  v4431=v2957*v2531-*p;
+  v7820=v17547*v10099-*p;
+  v4659=v14475*v15540-*p;
+  v16927=v5923*v11551-*p;
+  v17479=v16827*v12269-*p;
+  v6482=v16239*v6500-*p;
+  v11258=v12469*v17546-*p;
+  v11387=v15332*v4931-*p;
+  v990=v1058*v13764-*p;
+  v13166=v19931*v13291-*p;
+  v745=v10723*v14733-*p;
+  v19800=v18731*v8977-*p;
+  v11076=v3890*v6210-*p;
+  v5034=v9534*v6605-*p;
+  v18783=v372*v6929-*p;
+  v4690=v12067*v2912-*p;
+  v17809=v2942*v16242-*p;
+  v17325=v12769*v15888-*p;
+  v8581=v4825*v14031-*p;
+  v17473=v2629*v3721-*p;
+  v3158=v15561*v18781-*p;
+  v4199=v19074*v11931-*p;
+  v12208=v16219*v12351-*p;
+  v18553=v15462*v7594-*p;
+  v6472=v16988*v7363-*p;
+  v494=v3539*v16243-*p;
+  v7594=v4876*v19149-*p;
+  v10231=v6049*v2029-*p;
+  v2338=v17269*v6800-*p;
+  v6794=v5753*v19977-*p;
+  v17362=v6603*v3458-*p;
+  v10079=v7455*v12398-*p;
+  v6129=v80*v7339-*p;
+  v5536=v8545*v4781-*p;
+  v14440=v6321*v12627-*p;
+  v8105=v3251*v6681-*p;
+  v5246=v16777*v582-*p;
+  v3179=v1010*v11200-*p;
+  v4643=v16491*v9355-*p;
+  v6953=v3786*v3165-*p;
+  v950=v7475*v10770-*p;
+  v13047=v13660*v16370-*p;
+  v3174=v10712*v3358-*p;
+  v2742=v18888*v11044-*p;
+  v2987=v977*v12319-*p;
+  v4833=v15419*v7883-*p;
+  v10915=v1178*v14810-*p;
+  v9112=v7727*v19727-*p;
+  v3268=v15917*v1393-*p;
+  v17970=v19869*v14311-*p;
+  v11163=v15704*v16938-*p;
+  v1513=v6293*v16591-*p;
+  v15937=v2017*v12068-*p;
+  v12725=v12840*v12037-*p;
+  v15297=v7873*v5618-*p;
+  v3404=v18066*v1724-*p;
+  v17329=v7440*v18998-*p;
+  v15685=v11511*v4970-*p;
+  v1058=v17420*v5038-*p;
+  v462=v16114*v2289-*p;
+  v8920=v7672*v6138-*p;
+  v17701=v6368*v527-*p;
+  v8016=v9495*v14868-*p;
+  v12976=v12495*v16953-*p;
+  v18520=v14991*v14201-*p;
+  v4562=v1160*v7297-*p;
+  v1703=v1604*v11249-*p;
+  v12454=v7169*v11810-*p;
+  v6336=v2479*v6310-*p;
+  v19360=v12757*v1216-*p;
+  v7785=v12944*v7994-*p;
+  v14080=v893*v18499-*p;
+  v405=v3163*v8207-*p;
+  v8914=v13463*v16926-*p;
+  v9436=v12876*v14083-*p;
+  v10334=v10312*v18422-*p;
+  v10416=v13994*v13775-*p;
+  v1103=v18383*v12993-*p;
+  v2529=v18922*v4985-*p;
+  v1821=v16573*v11451-*p;
+  v10317=v17581*v4982-*p;
+  v352=v158*v18806-*p;
+  v7776=v11078*v7023-*p;
+  v17417=v17045*v8599-*p;
+  v19082=v15443*v792-*p;
+  v8589=v19471*v1325-*p;
+  v1182=v14170*v2238-*p;
+  v12876=v19218*v2735-*p;
+  v7287=v5714*v18445-*p;
+  v6899=v2617*v12878-*p;
+  v19346=v11142*v5165-*p;
+  v19239=v5873*v11353-*p;
+  v17711=v4138*v11303-*p;
+  v4287=v6618*v14791-*p;
+  v19533=v11632*v17273-*p;
+  v3549=v2621*v16905-*p;
+  v16634=v3443*v9080-*p;
+  v9232=v5478*v14527-*p;
+  v19969=v17380*v13908-*p;
+  v4045=v538*v16327-*p;
+  v11076=v17267*v437-*p;
+  v3473=v9404*v17620-*p;
+  v15874=v18967*v11287-*p;
+  v6374=v19782*v8060-*p;
+  v14331=v15963*v11861-*p;
+  v17045=v16929*v16963-*p;
+  v8800=v2683*v14307-*p;
+  v10755=v9541*v13411-*p;
+  v14284=v4693*v10897-*p;
+  v12393=v7311*v3536-*p;
+  v874=v17999*v17161-*p;
+  v8049=v16865*v5523-*p;
+  v19358=v16592*v4882-*p;
+  v17215=v1297*v18986-*p;
+  v14818=v17152*v19139-*p;
+  v19698=v3188*v6582-*p;
+  v4873=v11173*v8324-*p;
+  v16506=v9474*v7534-*p;
+  v9269=v15092*v5345-*p;
+  v17023=v7808*v558-*p;
+  v1255=v9113*v8773-*p;
+  v2972=v18633*v11825-*p;
+  v13729=v12427*v12425-*p;
+  v8801=v4550*v10657-*p;
+  v18582=v2846*v12783-*p;
+  v9533=v18321*v5475-*p;
+  v10977=v19290*v816-*p;
+  v8133=v13059*v2586-*p;
+  v13175=v14705*v16969-*p;
+  v11972=v1264*v7135-*p;
+  v19172=v6814*v19113-*p;
+  v4430=v8759*v4155-*p;
+  v19524=v3801*v2493-*p;
+  v1345=v1389*v16370-*p;
+  v1958=v18882*v6747-*p;
+  v16136=v5710*v11282-*p;
+  v5875=v14179*v1490-*p;
+  v5155=v9972*v12840-*p;
+  v4376=v5128*v10375-*p;
+  v16860=v2*v8390-*p;
+  v12397=v5832*v7286-*p;
+  v13592=v4829*v18128-*p;
+  v4118=v12713*v18867-*p;
+  v4912=v4221*v10758-*p;
+  v10435=v6618*v7025-*p;
+  v3898=v17957*v15135-*p;
+  v14396=v3852*v22-*p;
+  v12357=v4844*v1600-*p;
+  v16393=v3496*v1148-*p;
+  v14549=v1294*v152-*p;
+  v12075=v16468*v16926-*p;
+  v18155=v5436*v10089-*p;
+  v17810=v19264*v5824-*p;
+  v17442=v10345*v468-*p;
+  v13224=v9538*v19706-*p;
+  v19489=v1418*v2414-*p;
+  v19828=v9288*v6897-*p;
+  v2419=v6003*v265-*p;
+  v18835=v15264*v11070-*p;
+  v16258=v18522*v1052-*p;
+  v10289=v16159*v17419-*p;
+  v1631=v6389*v8746-*p;
+  v12150=v8522*v18157-*p;
+  v15132=v15191*v12682-*p;
+  v17950=v11011*v10650-*p;
+  v397=v9395*v17262-*p;
+  v15934=v2227*v12080-*p;
+  v16718=v3617*v9297-*p;
+  v13743=v14627*v17772-*p;
+  v2192=v1440*v183-*p;
+  v1206=v9118*v15718-*p;
+  v584=v3744*v8105-*p;
+  v17693=v14017*v6194-*p;
+  v16818=v9615*v6830-*p;
+  v18329=v16209*v8575-*p;
+  v15458=v13667*v7105-*p;
+  v2195=v18623*v16632-*p;
+  v4192=v98*v4517-*p;
+  v6610=v5561*v13899-*p;
+  v9819=v13110*v9757-*p;
+  v8876=v5698*v8497-*p;
+  v3003=v17858*v1316-*p;
+  v686=v15490*v3186-*p;
+  v17394=v9034*v18259-*p;
+  v3853=v2850*v7684-*p;
+  v12395=v6131*v7276-*p;
+  v13197=v9670*v4792-*p;
+  v572=v483*v9471-*p;
+  v5776=v9670*v1993-*p;
+  v16379=v9291*v15761-*p;
+  v8648=v16320*v8838-*p;
+  v12293=v9922*v13614-*p;
+  v10948=v2021*v6864-*p;
+  v4824=v7636*v9349-*p;
+  v14937=v19525*v3633-*p;
+  v12059=v10390*v7787-*p;
+  v17277=v11064*v14794-*p;
+  v10719=v12284*v13819-*p;
+  v5487=v12309*v4134-*p;
+  v16091=v17338*v15118-*p;
+  v6106=v383*v19420-*p;
+  v5762=v9274*v13828-*p;
+  v10202=v2854*v2827-*p;
+  v14907=v7317*v13597-*p;
+  v3337=v899*v4203-*p;
+  v7464=v17287*v16227-*p;
+  v5703=v18059*v7665-*p;
+  v17584=v8194*v5910-*p;
+  v15628=v8330*v4516-*p;
+  v6951=v111*v2226-*p;
+  v7506=v3385*v9693-*p;
+  v9554=v19718*v18105-*p;
+  v10105=v8970*v6042-*p;
+  v17632=v3889*v13559-*p;
+  v17504=v279*v400-*p;
+  v15696=v5635*v14537-*p;
+  v13185=v19172*v189-*p;
+  v7423=v16112*v19375-*p;
+  v1091=v17629*v17282-*p;
+  v19426=v4375*v12034-*p;
+  v19606=v6749*v16762-*p;
+  v2019=v9569*v7005-*p;
+  v12950=v16086*v14528-*p;
+  v14864=v12360*v14885-*p;
+  v2843=v14036*v8903-*p;
+  v7919=v4870*v13278-*p;
+  v7047=v3724*v19813-*p;
+  v2663=v8322*v16532-*p;
+  v3360=v13475*v13405-*p;
+  v12640=v12184*v5213-*p;
+  v3438=v18696*v15726-*p;
+  v19463=v6948*v17573-*p;
+  v12273=v2566*v11214-*p;
+  v2709=v4487*v2682-*p;
+  v11986=v8003*v1307-*p;
+  v1228=v6117*v14538-*p;
+  v19111=v3678*v15972-*p;
+  v19291=v5300*v2162-*p;
+  v13807=v13966*v11899-*p;
+  v9699=v3687*v8064-*p;
+  v17827=v4763*v681-*p;
+  v12049=v13545*v7815-*p;
+  v3890=v6074*v359-*p;
+  v6170=v7707*v11193-*p;
+  v9882=v304*v11465-*p;
+  v18333=v945*v8091-*p;
+  v19627=v8357*v18259-*p;
+  v19150=v19570*v5971-*p;
+  v10595=v14413*v7864-*p;
+  v7984=v11105*v3296-*p;
+  v13768=v3223*v7876-*p;
+  v6569=v2982*v15109-*p;
+  v5087=v1341*v13373-*p;
+  v17379=v12638*v6647-*p;
+  v13549=v4228*v6705-*p;
+  v15091=v12461*v16559-*p;
+  v7176=v820*v19218-*p;
+  v17648=v14829*v4596-*p;
+  v5938=v16117*v4410-*p;
+  v17890=v17877*v12012-*p;
+  v10305=v19609*v18656-*p;
+  v2537=v18168*v12174-*p;
+  v18602=v10665*v2669-*p;
+  v15096=v9318*v11716-*p;
+  v8216=v6747*v6817-*p;
+  v10818=v1650*v12871-*p;
+  v16630=v10734*v1948-*p;
+  v3645=v15833*v10338-*p;
+  v13085=v5677*v9298-*p;
+  v15406=v1812*v8993-*p;
+  v17377=v18093*v19640-*p;
+  v11360=v746*v6144-*p;
+  v6662=v7027*v5873-*p;
+  v17263=v7596*v6044-*p;
+  v13231=v5539*v15181-*p;
+  v3321=v9150*v5835-*p;
+  v5641=v17791*v6932-*p;
+  v18089=v9623*v820-*p;
+  v12617=v12160*v15448-*p;
+  v3686=v14849*v4712-*p;
+  v18031=v6263*v484-*p;
+  v15546=v5489*v15864-*p;
+  v13030=v7078*v1408-*p;
+  v1209=v14142*v6763-*p;
+  v10522=v4871*v4405-*p;
+  v11503=v13922*v3593-*p;
+  v9962=v10402*v5726-*p;
+  v9412=v17263*v6164-*p;
+  v16060=v13946*v394-*p;
+  v15704=v12868*v1446-*p;
+  v18818=v13039*v3277-*p;
+  v3453=v15303*v6817-*p;
+  v14013=v10426*v11696-*p;
+  v14105=v9996*v6832-*p;
+  v16832=v8419*v10294-*p;
+  v3934=v6248*v18468-*p;
+  v9399=v14484*v963-*p;
+  v217=v9585*v19970-*p;
+  v457=v18195*v19421-*p;
+  v4581=v2708*v18645-*p;
+  v16554=v18045*v9638-*p;
+  v4922=v2735*v12468-*p;
+  v1889=v3429*v8992-*p;
+  v16735=v13486*v1767-*p;
+  v19398=v11815*v16858-*p;
+  v802=v1799*v12464-*p;
+  v8652=v3278*v11774-*p;
+  v7102=v15440*v7775-*p;
+  v8215=v2558*v3849-*p;
+  v4297=v18485*v15075-*p;
+  v17980=v5712*v6420-*p;
+  v14711=v864*v9776-*p;
+  v9403=v15716*v8720-*p;
+  v13927=v9955*v9682-*p;
+  v10290=v891*v3091-*p;
+  v3159=v14677*v4413-*p;
+  v2512=v18380*v8088-*p;
+  v16746=v11918*v17050-*p;
+  v3204=v8325*v15721-*p;
+  v4445=v8429*v12445-*p;
+  v7292=v1116*v6843-*p;
+  v13590=v208*v18138-*p;
+  v6357=v3511*v2669-*p;
+  v13253=v16140*v17591-*p;
+  v2711=v5398*v13540-*p;
+  v10536=v16165*v3953-*p;
+  v17255=v1170*v2620-*p;
+  v15889=v14107*v17140-*p;
+  v12873=v14435*v16726-*p;
+  v7086=v14688*v6429-*p;
+  v568=v8006*v8957-*p;
+  v11328=v12203*v10753-*p;
+  v17644=v6511*v2049-*p;
+  v19170=v953*v16429-*p;
+  v17814=v6280*v6145-*p;
+  v13416=v433*v17267-*p;
+  v17914=v11447*v55-*p;
+  v2078=v15816*v9742-*p;
+  v6066=v19109*v6530-*p;
+  v18055=v6505*v11923-*p;
+  v4782=v8980*v17785-*p;
+  v16387=v2849*v17118-*p;
+  v19508=v17398*v4874-*p;
+  v4453=v4713*v13673-*p;
+  v4688=v3182*v5038-*p;
+  v12754=v17027*v9464-*p;
+  v8743=v15390*v16063-*p;
+  v7373=v17021*v14910-*p;
+  v16363=v8821*v7872-*p;
+  v3578=v1688*v6473-*p;
+  v6174=v16654*v7426-*p;
+  v11924=v9358*v14033-*p;
+  v3673=v15488*v14149-*p;
+  v1966=v524*v8875-*p;
+  v14845=v4759*v8578-*p;
+  v2318=v13478*v8571-*p;
+  v9157=v16910*v517-*p;
+  v4791=v9615*v17340-*p;
+  v15166=v1174*v689-*p;
+  v17830=v2589*v11449-*p;
+  v7897=v11632*v1767-*p;
+  v1620=v2118*v5835-*p;
+  v246=v2115*v18030-*p;
+  v916=v3771*v15532-*p;
+  v14917=v4282*v4222-*p;
+  v19587=v17966*v4093-*p;
+  v14264=v1766*v1813-*p;
+  v18865=v7880*v696-*p;
+  v3693=v8736*v16430-*p;
+  v4210=v11370*v10521-*p;
+  v14510=v12761*v13434-*p;
+  v879=v12108*v8331-*p;
+  v18719=v11981*v11146-*p;
+  v14770=v5065*v9512-*p;
+  v11461=v10776*v1029-*p;
+  v11601=v810*v3782-*p;
+  v16574=v13309*v16618-*p;
+  v11946=v2929*v14538-*p;
+  v5035=v4270*v3213-*p;
+  v15385=v10654*v11328-*p;
+  v6880=v16096*v6015-*p;
+  v2009=v11731*v19460-*p;
+  v944=v2000*v13570-*p;
+  v10075=v8398*v1117-*p;
+  v5481=v8084*v15933-*p;
+  v6973=v2360*v12242-*p;
+  v17219=v993*v9298-*p;
+  v1978=v18845*v15355-*p;
+  v15954=v7415*v19570-*p;
+  v10982=v2551*v1724-*p;
+  v16895=v6040*v4919-*p;
+  v10193=v10723*v14447-*p;
+  v4756=v3464*v9717-*p;
+  v2117=v14569*v3851-*p;
+  v13922=v393*v7684-*p;
+  v7808=v4228*v12110-*p;
+  v13413=v19566*v14626-*p;
+  v16234=v15190*v17994-*p;
+  v383=v10328*v10203-*p;
+  v4979=v10897*v14461-*p;
+  v15962=v1291*v17815-*p;
+  v6114=v7527*v12282-*p;
+  v3056=v10529*v4300-*p;
+  v17269=v2908*v1088-*p;
+  v834=v19323*v2660-*p;
+  v16918=v16603*v18129-*p;
+  v18960=v15276*v9036-*p;
+  v6293=v18058*v13367-*p;
+  v19863=v9881*v3218-*p;
+  v10387=v2676*v14826-*p;
+  v15209=v13560*v17208-*p;
+  v1430=v15499*v10257-*p;
+  v4019=v7049*v2628-*p;
+  v15659=v2761*v17644-*p;
+  v3709=v16189*v5090-*p;
+  v2867=v9499*v13142-*p;
+  v3514=v19612*v8965-*p;
+  v12253=v14379*v3569-*p;
+  v12670=v15911*v18635-*p;
+  v5547=v17621*v819-*p;
+  v7977=v15743*v15640-*p;
+  v2183=v258*v14547-*p;
+  v4457=v14359*v18102-*p;
+  v3768=v11297*v14832-*p;
+  v6759=v1520*v5897-*p;
+  v16452=v15932*v10873-*p;
+  v18652=v18675*v5557-*p;
+  v11494=v10907*v1516-*p;
+  v5966=v3000*v12975-*p;
+  v11461=v2908*v11555-*p;
+  v372=v142*v19977-*p;
+  v4361=v17043*v14051-*p;
+  v16001=v8997*v17595-*p;
+  v16914=v4453*v12266-*p;
+  v15659=v14290*v3751-*p;
+  v7148=v13942*v5304-*p;
+  v14500=v7479*v12322-*p;
+  v9326=v19807*v9549-*p;
+  v17176=v1608*v16025-*p;
+  v19966=v13905*v5704-*p;
+  v14438=v16859*v3629-*p;
+  v11758=v13831*v13611-*p;
+  v10451=v915*v19189-*p;
+  v12487=v6968*v18294-*p;
+  v11584=v11367*v12307-*p;
+  v12429=v17082*v6-*p;
+  v1311=v19508*v18606-*p;
+  v4943=v10886*v5369-*p;
+  v15436=v8778*v3155-*p;
+  v18115=v11871*v7425-*p;
+  v2266=v1849*v5481-*p;
+  v3654=v7273*v8805-*p;
+  v1494=v5711*v16635-*p;
+  v6925=v8050*v19289-*p;
+  v17941=v18965*v9912-*p;
+  v5559=v5836*v16917-*p;
+  v19214=v3771*v18363-*p;
+  v18844=v7278*v10127-*p;
+  v18063=v14641*v13507-*p;
+  v3444=v18850*v7364-*p;
+  v4479=v15238*v2189-*p;
+  v2806=v8118*v15419-*p;
+  v10363=v12791*v19849-*p;
+  v14251=v3622*v9383-*p;
+  v15551=v11889*v15985-*p;
+  v7495=v8135*v18235-*p;
+  v3185=v7966*v2572-*p;
+  v19362=v13094*v18068-*p;
+  v12103=v17481*v15870-*p;
+  v17698=v12759*v6130-*p;
+  v1324=v6083*v16403-*p;
+  v15785=v19917*v8903-*p;
+  v16897=v7331*v4225-*p;
+  v5942=v14567*v15479-*p;
+  v287=v17594*v4469-*p;
+  v17473=v19221*v4215-*p;
+  v4001=v2932*v14224-*p;
+  v939=v3774*v10299-*p;
+  v15189=v11977*v9153-*p;
+  v11978=v18690*v12276-*p;
+  v11141=v16171*v14572-*p;
+  v11817=v13954*v8729-*p;
+  v5171=v10814*v6074-*p;
+  v13732=v2590*v13513-*p;
+  v2550=v7341*v5609-*p;
+  v14405=v4067*v8399-*p;
+  v6655=v9952*v6047-*p;
+  v10100=v6568*v14969-*p;
+  v8049=v12412*v9421-*p;
+  v5963=v15287*v13369-*p;
+  v12166=v5098*v18561-*p;
+  v10804=v6787*v13350-*p;
+  v8535=v17189*v10911-*p;
+  v7400=v10845*v18184-*p;
+  v7465=v9773*v5933-*p;
+  v7879=v17371*v1093-*p;
+  v18724=v3030*v8355-*p;
+  v806=v10296*v2787-*p;
+  v18390=v7050*v11509-*p;
+  v17677=v19456*v3078-*p;
+  v4655=v13928*v4805-*p;
+  v14110=v10369*v7025-*p;
+  v11803=v10283*v13824-*p;
+  v16028=v8925*v18181-*p;
+  v7686=v490*v908-*p;
+  v4582=v16006*v3388-*p;
+  v1641=v938*v16111-*p;
+  v13883=v10498*v14742-*p;
+  v9941=v3278*v17551-*p;
+  v16340=v11521*v18325-*p;
+  v9681=v1550*v8089-*p;
+  v6309=v4592*v7201-*p;
+  v17134=v9250*v8289-*p;
+  v1196=v2338*v4284-*p;
+  v9940=v19730*v16203-*p;
+  v1083=v8411*v10590-*p;
+  v18869=v481*v1606-*p;
+  v2405=v15721*v12547-*p;
+  v10616=v411*v10935-*p;
+  v13499=v7239*v15867-*p;
+  v11224=v14165*v6571-*p;
+  v12604=v11883*v5148-*p;
+  v7250=v13135*v3806-*p;
+  v9680=v19585*v10404-*p;
+  v14686=v5708*v1678-*p;
+  v18912=v10704*v14141-*p;
+  v11437=v7073*v13316-*p;
+  v8702=v12997*v922-*p;
+  v19595=v14938*v9508-*p;
+  v8476=v11104*v9260-*p;
+  v18766=v11243*v4376-*p;
+  v2645=v11700*v388-*p;
+  v4614=v10587*v2720-*p;
+  v6335=v625*v10577-*p;
+  v4797=v7591*v19652-*p;
+  v292=v19574*v13208-*p;
+  v2700=v5586*v10344-*p;
+  v2271=v10325*v10777-*p;
+  v11246=v4666*v8394-*p;
+  v10000=v12646*v1409-*p;
+  v10214=v14041*v16961-*p;
+  v13512=v13988*v9780-*p;
+  v9515=v19683*v18768-*p;
+  v5728=v13509*v11217-*p;
+  v12546=v8306*v11635-*p;
+  v19280=v4768*v13600-*p;
+  v14904=v4316*v7562-*p;
+  v12298=v19903*v13956-*p;
+  v14074=v628*v14365-*p;
+  v9183=v5170*v10535-*p;
+  v2356=v718*v4306-*p;
+  v11390=v13462*v19650-*p;
+  v16034=v1424*v5546-*p;
+  v3122=v8999*v3296-*p;
+  v12709=v15068*v7111-*p;
+  v3875=v2164*v18501-*p;
+  v1549=v16120*v5561-*p;
+  v10769=v17138*v10337-*p;
+  v15939=v11875*v12566-*p;
+  v9886=v14013*v5160-*p;
+  v4145=v3887*v11609-*p;
+  v6175=v6988*v14615-*p;
+  v1002=v12196*v4885-*p;
+  v4865=v969*v15418-*p;
+  v17857=v10338*v19751-*p;
+  v7305=v17523*v14060-*p;
+  v3206=v7367*v1198-*p;
+  v2155=v16422*v6306-*p;
+  v6594=v15232*v13158-*p;
+  v7715=v3095*v8867-*p;
+  v9006=v10648*v19453-*p;
+  v6772=v5925*v2054-*p;
+  v9492=v11429*v11909-*p;
+  v14384=v11995*v1422-*p;
+  v2382=v12127*v1231-*p;
+  v9780=v13231*v19049-*p;
+  v7084=v1912*v13232-*p;
+  v3558=v6270*v7712-*p;
+  v7205=v17742*v13199-*p;
+  v13024=v17597*v12329-*p;
+  v1743=v11705*v10095-*p;
+  v15989=v1825*v4266-*p;
+  v9340=v19757*v17727-*p;
+  v19048=v10372*v13762-*p;
+  v7711=v16494*v16905-*p;
+  v3588=v14846*v4767-*p;
+  v3924=v687*v18226-*p;
+  v2306=v16766*v13528-*p;
+  v13137=v8048*v15586-*p;
+  v6415=v424*v5838-*p;
+  v7295=v5073*v9751-*p;
+  v12540=v16327*v16154-*p;
+  v8458=v16455*v17776-*p;
+  v9554=v6468*v2254-*p;
+  v11384=v1276*v11223-*p;
+  v3838=v3311*v14810-*p;
+  v18509=v6194*v17839-*p;
+  v18233=v6698*v8872-*p;
+  v5397=v1359*v15959-*p;
+  v2040=v9442*v9648-*p;
+  v7197=v13032*v14608-*p;
+  v3969=v1484*v4185-*p;
+  v8072=v2082*v7933-*p;
+  v4600=v18204*v13507-*p;
+  v5110=v7597*v14041-*p;
+  v9008=v4044*v11690-*p;
+  v2247=v12503*v16906-*p;
+  v6195=v11582*v14409-*p;
+  v9561=v12731*v14638-*p;
+  v5835=v7754*v15166-*p;
+  v18706=v3389*v10850-*p;
+  v18157=v13036*v15259-*p;
+  v15425=v7468*v9280-*p;
+  v10734=v1870*v2199-*p;
+  v13272=v7268*v1437-*p;
+  v8897=v14565*v6652-*p;
+  v19139=v13115*v2891-*p;
+  v1285=v1259*v18156-*p;
+  v16980=v17318*v12323-*p;
+  v13381=v9408*v7048-*p;
+  v10422=v206*v17412-*p;
+  v8896=v13624*v3212-*p;
+  v3585=v14175*v10111-*p;
+  v15602=v1729*v6595-*p;
+  v17403=v13675*v3585-*p;
+  v1284=v5971*v4396-*p;
+  v2851=v6748*v14492-*p;
+  v1744=v987*v9752-*p;
+  v3503=v6844*v12695-*p;
+  v9691=v6414*v9490-*p;
+  v19104=v18079*v15701-*p;
+  v9446=v13161*v95-*p;
+  v14965=v5634*v13190-*p;
+  v13458=v4518*v13670-*p;
+  v10238=v14244*v3999-*p;
+  v14839=v14321*v11868-*p;
+  v3238=v2718*v6308-*p;
+  v2040=v12751*v4757-*p;
+  v16881=v4081*v3381-*p;
+  v5660=v11915*v9419-*p;
+  v10098=v6719*v16273-*p;
+  v9739=v3923*v6264-*p;
+  v17822=v8893*v9412-*p;
+  v6217=v13635*v19650-*p;
+  v2962=v10485*v13065-*p;
+  v8645=v12586*v11789-*p;
+  v12803=v11651*v1079-*p;
+  v4610=v2203*v97-*p;
+  v11038=v9858*v11997-*p;
+  v6855=v10623*v1727-*p;
+  v13528=v10359*v467-*p;
+  v8150=v4790*v13871-*p;
+  v5167=v16890*v11544-*p;
+  v13043=v6763*v19625-*p;
+  v224=v16995*v16003-*p;
+  v1559=v7169*v7400-*p;
+  v18191=v18728*v12177-*p;
+  v18329=v18493*v2726-*p;
+  v8144=v10123*v9921-*p;
+  v18006=v8188*v16306-*p;
+  v11026=v12690*v12572-*p;
+  v9848=v2636*v2330-*p;
+  v12393=v8544*v16755-*p;
+  v19875=v4651*v3263-*p;
+  v10074=v3009*v3069-*p;
+  v5086=v6160*v10611-*p;
+  v16848=v15151*v11586-*p;
+  v9731=v977*v8077-*p;
+  v1830=v14485*v4423-*p;
+  v11384=v9355*v11910-*p;
+  v15723=v1511*v4922-*p;
+  v8029=v17246*v14282-*p;
+  v4530=v16857*v11109-*p;
+  v5225=v8724*v2409-*p;
+  v5173=v10939*v19028-*p;
+  v4543=v3757*v14508-*p;
+  v18069=v12460*v12995-*p;
+  v7773=v14454*v12956-*p;
+  v4724=v12552*v2743-*p;
+  v17328=v18142*v7608-*p;
+  v11126=v12992*v13806-*p;
+  v8760=v14128*v11489-*p;
+  v692=v12974*v10872-*p;
+  v16247=v15306*v12648-*p;
+  v14134=v18194*v18029-*p;
+  v9520=v11144*v6872-*p;
+  v9018=v11584*v2632-*p;
+  v16219=v2881*v1468-*p;
+  v4879=v4071*v6157-*p;
+  v15017=v5993*v2908-*p;
+  v19137=v17668*v9505-*p;
+  v3930=v1712*v1802-*p;
+  v11431=v9220*v7394-*p;
+  v10571=v5315*v4399-*p;
+  v1670=v3760*v3848-*p;
+  v7111=v8594*v14197-*p;
+  v16749=v14110*v10529-*p;
+  v14270=v13318*v14316-*p;
+  v10298=v8535*v1364-*p;
+  v14124=v6368*v15133-*p;
+  v15623=v4809*v8401-*p;
+  v13748=v1431*v11154-*p;
+  v16224=v4599*v12976-*p;
+  v17832=v17108*v7716-*p;
+  v5757=v18914*v12255-*p;
+  v9051=v6019*v10171-*p;
+  v3435=v2044*v16086-*p;
+  v13018=v2978*v2532-*p;
+  v2972=v10588*v11131-*p;
+  v11737=v6248*v7647-*p;
+  v14549=v3593*v4991-*p;
+  v15327=v17762*v12701-*p;
+  v60=v19315*v1363-*p;
+  v12846=v6279*v9527-*p;
+  v10743=v5735*v746-*p;
+  v14388=v14250*v13697-*p;
+  v9723=v2667*v6607-*p;
+  v7946=v8148*v9992-*p;
+  v3268=v10578*v5118-*p;
+  v8163=v17958*v805-*p;
+  v1846=v7484*v7592-*p;
+  v12996=v10833*v5726-*p;
+  v12493=v5143*v9379-*p;
+  v6106=v18014*v15545-*p;
+  v3249=v11944*v17575-*p;
+  v12438=v18567*v9366-*p;
+  v850=v13610*v10959-*p;
+  v12754=v12581*v13791-*p;
+  v18003=v14707*v7119-*p;
+  v8066=v8859*v10992-*p;
+  v152=v11117*v4347-*p;
+  v8270=v17302*v12911-*p;
+  v11407=v10471*v10308-*p;
+  v1845=v18424*v8522-*p;
+  v10457=v16524*v19092-*p;
+  v5778=v2538*v2875-*p;
+  v16183=v679*v5114-*p;
+  v2995=v14947*v337-*p;
+  v2526=v17904*v4155-*p;
+  v13200=v1534*v6082-*p;
+  v11614=v5862*v15420-*p;
+  v17510=v3944*v17270-*p;
+  v12331=v18980*v18911-*p;
+  v18947=v11359*v10632-*p;
+  v18591=v19923*v13924-*p;
+  v12609=v4240*v12716-*p;
+  v6510=v8551*v2510-*p;
+  v15364=v17027*v13075-*p;
+  v7912=v6357*v3328-*p;
+  v14614=v1332*v17473-*p;
+  v4473=v6838*v14420-*p;
+  v5923=v15621*v610-*p;
+  v8432=v16508*v5631-*p;
+  v7958=v14259*v15384-*p;
+  v16711=v12898*v14590-*p;
+  v9622=v6571*v14686-*p;
+  v2091=v5530*v7347-*p;
+  v15124=v16156*v2602-*p;
+  v6433=v9556*v19356-*p;
+  v11909=v10805*v13366-*p;
+  v13422=v18859*v7482-*p;
+  v11823=v8272*v19066-*p;
+  v14143=v18139*v14683-*p;
+  v15485=v11923*v12635-*p;
+  v14148=v10138*v17389-*p;
+  v11167=v16128*v17204-*p;
+  v12334=v12331*v12927-*p;
+  v18316=v8223*v7641-*p;
+  v16635=v12129*v538-*p;
+  v5119=v2096*v13517-*p;
+  v18388=v9494*v4617-*p;
+  v5065=v2454*v3938-*p;
+  v16474=v3845*v14914-*p;
+  v15510=v8109*v836-*p;
+  v16231=v13249*v12109-*p;
+  v11728=v13589*v12686-*p;
+  v18635=v7714*v3291-*p;
+  v15063=v9898*v14814-*p;
+  v12417=v15514*v19928-*p;
+  v15871=v2135*v4173-*p;
+  v8196=v16797*v14554-*p;
+  v3418=v15368*v7361-*p;
+  v9798=v8186*v15250-*p;
+  v10967=v9834*v747-*p;
+  v10085=v2064*v10194-*p;
+  v16775=v12573*v3778-*p;
+  v7448=v12328*v14397-*p;
+  v14293=v8787*v19091-*p;
+  v10637=v7331*v6720-*p;
+  v15049=v8853*v8947-*p;
+  v360=v4874*v10677-*p;
+  v10176=v16286*v18226-*p;
+  v1655=v9747*v4098-*p;
+  v8262=v4989*v2602-*p;
+  v6562=v18173*v2778-*p;
+  v3851=v13366*v19705-*p;
+  v909=v12459*v13903-*p;
+  v2497=v4974*v8554-*p;
+  v14800=v16475*v15548-*p;
+  v5343=v17504*v4533-*p;
+  v18610=v17124*v13125-*p;
+  v13837=v11760*v9475-*p;
+  v15895=v9810*v13215-*p;
+  v16177=v10032*v6804-*p;
+  v3140=v16845*v10024-*p;
+  v5104=v17857*v3622-*p;
+  v408=v18343*v3900-*p;
+  v9622=v12760*v18305-*p;
+  v9339=v14654*v1907-*p;
+  v14398=v3379*v10020-*p;
+  v7539=v12012*v4533-*p;
+  v8193=v8528*v1615-*p;
+  v14307=v17361*v6284-*p;
+  v5091=v8525*v19091-*p;
+  v8031=v17313*v12045-*p;
+  v13507=v7361*v19573-*p;
+  v8059=v6117*v15208-*p;
+  v18497=v12384*v5155-*p;
+  v16862=v179*v5006-*p;
+  v10325=v18078*v9570-*p;
+  v7862=v4374*v14482-*p;
+  v10457=v15928*v8100-*p;
+  v7024=v15524*v9607-*p;
+  v14425=v209*v18093-*p;
+  v8049=v5232*v14781-*p;
+  v9192=v15938*v13238-*p;
+  v17003=v7134*v7375-*p;
+  v16698=v3606*v6106-*p;
+  v2623=v4805*v8883-*p;
+  v17928=v10380*v6609-*p;
+  v17469=v15986*v6496-*p;
+  v12391=v6345*v6579-*p;
+  v4202=v13429*v18506-*p;
+  v15436=v9727*v6044-*p;
+  v219=v10279*v2334-*p;
+  v412=v8029*v9613-*p;
+  v1478=v2834*v12595-*p;
+  v5793=v4090*v18099-*p;
+  v3157=v19615*v15857-*p;
+  v14936=v6033*v15899-*p;
+  v1454=v14134*v4136-*p;
+  v10613=v4474*v19520-*p;
+  v12288=v1669*v10611-*p;
+  v17720=v17246*v13560-*p;
+  v11106=v1635*v3389-*p;
+  v8502=v6489*v9964-*p;
+  v2406=v7446*v15519-*p;
+  v5098=v19869*v18036-*p;
+  v1352=v15170*v716-*p;
+  v1716=v19930*v15971-*p;
+  v16110=v11978*v14368-*p;
+  v7670=v7160*v12116-*p;
+  v8240=v2745*v10145-*p;
+  v7898=v8311*v11124-*p;
+  v9957=v15495*v15998-*p;
+  v7320=v12062*v12388-*p;
+  v223=v5422*v15469-*p;
+  v11155=v1817*v11725-*p;
+  v6590=v2161*v11455-*p;
+  v15201=v16020*v11224-*p;
+  v18078=v18233*v13717-*p;
+  v10519=v2350*v4916-*p;
+  v10795=v3646*v4288-*p;
+  v2733=v1491*v2857-*p;
+  v9806=v9817*v2008-*p;
+  v13810=v6179*v3113-*p;
+  v2293=v854*v7536-*p;
+  v16212=v1161*v10977-*p;
+  v10189=v13260*v6920-*p;
+  v18131=v4030*v8433-*p;
+  v19954=v19780*v12894-*p;
+  v3373=v14794*v4632-*p;
+  v3139=v15771*v13461-*p;
+  v10094=v14573*v18629-*p;
+  v2268=v1442*v18468-*p;
+  v6736=v4869*v12346-*p;
+  v8601=v10186*v10017-*p;
+  v5092=v17310*v11782-*p;
+  v18370=v13201*v17183-*p;
+  v11370=v19387*v19360-*p;
+  v13352=v2746*v19050-*p;
+  v17365=v4841*v12115-*p;
+  v19920=v17389*v7537-*p;
+  v17248=v5832*v18313-*p;
+  v3129=v15875*v13095-*p;
+  v261=v7665*v953-*p;
+  v4067=v3056*v4252-*p;
+  v10229=v15954*v7902-*p;
+  v8032=v11002*v5829-*p;
+  v8396=v10976*v11209-*p;
+  v4474=v3598*v43-*p;
+  v5816=v16059*v16907-*p;
+  v17675=v736*v8533-*p;
+  v12402=v9136*v2211-*p;
+  v13884=v18548*v1035-*p;
+  v8994=v4566*v16896-*p;
+  v3066=v6317*v6113-*p;
+  v10205=v7606*v7205-*p;
+  v3040=v10646*v18991-*p;
+  v3302=v8443*v19950-*p;
+  v13002=v6996*v16469-*p;
+  v9213=v15072*v1972-*p;
+  v3399=v8491*v1813-*p;
+  v2964=v13428*v1726-*p;
+  v14415=v7607*v13682-*p;
+  v2928=v6760*v7332-*p;
+  v5779=v11317*v19881-*p;
+  v8506=v5694*v2606-*p;
+  v13048=v19209*v4683-*p;
+  v19996=v12164*v14043-*p;
+  v1385=v12995*v12983-*p;
+  v18616=v5455*v17207-*p;
+  v14390=v3678*v1843-*p;
+  v10723=v8569*v6775-*p;
+  v10208=v17392*v8561-*p;
+  v17172=v15653*v16965-*p;
+  v10665=v10147*v17107-*p;
+  v14955=v4180*v3845-*p;
+  v7270=v1336*v19027-*p;
+  v11792=v1256*v14154-*p;
+  v11876=v44*v2371-*p;
+  v16413=v13643*v6003-*p;
+  v2992=v17900*v15638-*p;
+  v18696=v13004*v10394-*p;
+  v1123=v5148*v16488-*p;
+  v17399=v19257*v5673-*p;
+  v6822=v6680*v9436-*p;
+  v16765=v19920*v154-*p;
+  v18229=v7285*v15545-*p;
+  v5142=v14040*v12647-*p;
+  v17081=v10671*v13163-*p;
+  v8010=v8612*v1270-*p;
+  v10718=v4942*v10596-*p;
+  v11670=v19198*v14939-*p;
+  v11911=v2385*v16128-*p;
+  v5332=v16204*v14561-*p;
+  v14096=v14714*v7318-*p;
+  v18906=v2370*v13462-*p;
+  v10184=v15577*v16376-*p;
+  v12478=v6374*v3335-*p;
+  v18422=v12590*v5714-*p;
+  v8480=v14060*v9441-*p;
+  v14736=v13189*v2940-*p;
+  v728=v1254*v19549-*p;
+  v13539=v18099*v18615-*p;
+  v19147=v2161*v13556-*p;
+  v3500=v19991*v905-*p;
+  v5174=v1585*v1577-*p;
+  v5499=v19266*v16820-*p;
+  v19849=v2038*v17054-*p;
+  v16154=v13672*v15956-*p;
+  v18060=v19691*v2054-*p;
+  v2559=v5380*v8757-*p;
+  v10683=v16690*v17175-*p;
+  v19722=v11325*v18698-*p;
+  v2287=v9438*v13488-*p;
+  v17421=v3775*v5698-*p;
+  v17265=v15445*v16108-*p;
+  v13096=v5990*v8631-*p;
+  v11473=v2894*v6514-*p;
+  v4937=v5392*v19381-*p;
+  v5783=v2141*v6093-*p;
+  v19454=v10457*v13201-*p;
+  v15982=v5498*v10636-*p;
+  v94=v11912*v11751-*p;
+  v18123=v8673*v8516-*p;
+  v6251=v9026*v5753-*p;
+  v18036=v6275*v18402-*p;
+  v6537=v14002*v6258-*p;
+  v8903=v7393*v17671-*p;
+  v9106=v19284*v31-*p;
+  v10655=v17337*v7619-*p;
+  v13171=v2039*v14860-*p;
+  v14741=v3312*v1025-*p;
+  v3835=v2941*v1795-*p;
+  v14876=v7055*v9030-*p;
+  v5997=v15136*v10821-*p;
+  v1802=v2565*v8536-*p;
+  v11603=v2513*v7589-*p;
+  v16562=v18254*v4353-*p;
+  v1296=v6850*v14764-*p;
+  v15638=v7323*v7516-*p;
+  v14664=v17469*v19822-*p;
+  v5230=v4060*v1024-*p;
+  v16166=v754*v722-*p;
+  v1670=v10146*v18599-*p;
+  v19046=v3494*v5374-*p;
+  v14320=v19345*v6444-*p;
+  v8894=v1293*v18601-*p;
+  v19909=v13239*v2851-*p;
+  v5943=v12451*v281-*p;
+  v11532=v16629*v15330-*p;
+  v15413=v1678*v9865-*p;
+  v18825=v4988*v5409-*p;
+  v5423=v17168*v16085-*p;
+  v9604=v13295*v8010-*p;
+  v11387=v2205*v13097-*p;
+  v18350=v15324*v16653-*p;
+  v16225=v12105*v8385-*p;
+  v5273=v5669*v6229-*p;
+  v4277=v14076*v6518-*p;
+  v7790=v3587*v12196-*p;
+  v5918=v6731*v17523-*p;
+  v19079=v9929*v994-*p;
+  v16418=v16627*v9106-*p;
+  v4985=v15100*v19640-*p;
+  v19755=v13710*v1691-*p;
+  v17405=v4676*v12657-*p;
+  v14005=v19814*v12334-*p;
+  v11407=v164*v9734-*p;
+  v7140=v7539*v14329-*p;
+  v15184=v16787*v12091-*p;
+  v14778=v2889*v14780-*p;
+  v14141=v2671*v9666-*p;
+  v9543=v8599*v14403-*p;
+  v5712=v19740*v15355-*p;
+  v4898=v5812*v11741-*p;
+  v3600=v7977*v7561-*p;
+  v19319=v17662*v17474-*p;
+  v13755=v2500*v7000-*p;
+  v14815=v3324*v18369-*p;
+  v19213=v9334*v11284-*p;
+  v5420=v17635*v7222-*p;
+  v8880=v12868*v8131-*p;
+  v13992=v17116*v14535-*p;
+  v11243=v12253*v3722-*p;
+  v12874=v13397*v13525-*p;
+  v1897=v17990*v19398-*p;
+  v4712=v18072*v2876-*p;
+  v1389=v12268*v16142-*p;
+  v6909=v19829*v18552-*p;
+  v17727=v6241*v3971-*p;
+  v10817=v4950*v6216-*p;
+  v1322=v17265*v8863-*p;
+  v7948=v7780*v15408-*p;
+  v4953=v5265*v14323-*p;
+  v6252=v1994*v11992-*p;
+  v6773=v11219*v18605-*p;
+  v13580=v1440*v3232-*p;
+  v9845=v10891*v7282-*p;
+  v14038=v4337*v2110-*p;
+  v16033=v5604*v7490-*p;
+  v10014=v9007*v18471-*p;
+  v12279=v13797*v8950-*p;
+  v7105=v10971*v7122-*p;
+  v4842=v710*v13754-*p;
+  v1322=v18626*v7260-*p;
+  v19558=v4370*v10415-*p;
+  v2985=v11167*v19396-*p;
+  v11036=v4677*v1667-*p;
+  v3394=v6*v14978-*p;
+  v10011=v8688*v3642-*p;
+  v15958=v13978*v18301-*p;
+  v8229=v13841*v11790-*p;
+  v16724=v17300*v8299-*p;
+  v4271=v13660*v14897-*p;
+  v12313=v3808*v735-*p;
+  v16145=v1772*v4851-*p;
+  v10831=v3910*v5281-*p;
+  v2132=v1742*v896-*p;
+  v15396=v19291*v6537-*p;
+  v4321=v12212*v1841-*p;
+  v8804=v4171*v15598-*p;
+  v3347=v4015*v17676-*p;
+  v12386=v2486*v14633-*p;
+  v3386=v11597*v11172-*p;
+  v11759=v1660*v15713-*p;
+  v13649=v18579*v237-*p;
+  v381=v14744*v16118-*p;
+  v14477=v10826*v16111-*p;
+  v6089=v12556*v18966-*p;
+  v8318=v4292*v12496-*p;
+  v14269=v7115*v3455-*p;
+  v733=v2006*v9084-*p;
+  v4399=v9205*v1480-*p;
+  v1598=v5359*v17179-*p;
+  v5099=v11331*v18525-*p;
+  v10433=v19931*v6512-*p;
+  v654=v11651*v5411-*p;
+  v11471=v9552*v8621-*p;
+  v11860=v19867*v4507-*p;
+  v6788=v11127*v2596-*p;
+  v477=v17479*v15469-*p;
+  v15228=v122*v3876-*p;
+  v4492=v8814*v8113-*p;
+  v19425=v9253*v3271-*p;
+  v11231=v5902*v12919-*p;
+  v17158=v4877*v18415-*p;
+  v10232=v8422*v11677-*p;
+  v17614=v14914*v19194-*p;
+  v16535=v11420*v5508-*p;
+  v15837=v9522*v18073-*p;
+  v6750=v13404*v11422-*p;
+  v15556=v5889*v2865-*p;
+  v2271=v5386*v1763-*p;
+  v4786=v12791*v18348-*p;
+  v16491=v15671*v12916-*p;
+  v16322=v5569*v6587-*p;
+  v14698=v19043*v8236-*p;
+  v4921=v2760*v2911-*p;
+  v5222=v7609*v11546-*p;
+  v17050=v2891*v16335-*p;
+  v16659=v8232*v19614-*p;
+  v9541=v13*v15690-*p;
+  v8799=v6412*v15961-*p;
+  v18752=v11443*v17880-*p;
+  v16559=v11724*v3506-*p;
+  v2836=v5976*v7975-*p;
+  v17409=v7126*v7510-*p;
+  v19983=v10353*v3370-*p;
+  v429=v14753*v1336-*p;
+  v10937=v7869*v6214-*p;
+  v19543=v3373*v1567-*p;
+  v9947=v16239*v17426-*p;
+  v15474=v2664*v9276-*p;
+  v10078=v8399*v2285-*p;
+  v9363=v12511*v11128-*p;
+  v5280=v10036*v13970-*p;
+  v2928=v2806*v2067-*p;
+  v3703=v15667*v9994-*p;
+  v14798=v8050*v5034-*p;
+  v12686=v15545*v12407-*p;
+  v14364=v15649*v6474-*p;
+  v7403=v18873*v16709-*p;
+  v4284=v7244*v2557-*p;
+  v10818=v4739*v18707-*p;
+  v8714=v8890*v10968-*p;
+  v18335=v19159*v9086-*p;
+  v709=v8496*v17368-*p;
+  v16692=v9709*v16758-*p;
+  v3057=v16378*v15123-*p;
+  v18382=v13147*v3875-*p;
+  v19493=v934*v9717-*p;
+  v13909=v18384*v14360-*p;
+  v728=v6256*v15821-*p;
+  v13616=v15335*v6809-*p;
+  v786=v6645*v1771-*p;
+  v12994=v2504*v11742-*p;
+  v18757=v17643*v19488-*p;
+  v4586=v6808*v18536-*p;
+  v16505=v14513*v16532-*p;
+  v15869=v13649*v7370-*p;
+  v13478=v9073*v9034-*p;
+  v14198=v17754*v6278-*p;
+  v19701=v19604*v7733-*p;
+  v2351=v4505*v10833-*p;
+  v19129=v7439*v14429-*p;
+  v1048=v15158*v14433-*p;
+  v4753=v2352*v5261-*p;
+  v765=v1251*v2779-*p;
+  v232=v785*v8935-*p;
+  v14374=v7175*v825-*p;
+  v2827=v1208*v16103-*p;
+  v5026=v16056*v5482-*p;
+  v19474=v15855*v10276-*p;
+  v16671=v13333*v3869-*p;
+  v964=v18393*v17453-*p;
+  v17070=v18737*v19936-*p;
+  v4671=v8377*v1863-*p;
+  v9986=v5486*v18397-*p;
+  v9925=v7816*v5660-*p;
+  v13036=v3479*v10015-*p;
+  v5960=v18632*v13277-*p;
+  v8941=v15456*v1809-*p;
+  v5678=v11287*v15788-*p;
+  v6575=v10725*v14353-*p;
+  v11565=v14706*v5092-*p;
+  v9487=v4320*v7799-*p;
+  v14274=v7802*v4850-*p;
+  v17250=v2954*v16768-*p;
+  v5603=v14613*v4086-*p;
+  v12321=v8018*v5288-*p;
+  v827=v19939*v19704-*p;
+  v8099=v18725*v11169-*p;
+  v14932=v4991*v2190-*p;
+  v5752=v10026*v7102-*p;
+  v1116=v6578*v5637-*p;
+  v19116=v11600*v17104-*p;
+  v9816=v19255*v6293-*p;
+  v2886=v15371*v16049-*p;
+  v8033=v6538*v7795-*p;
+  v11523=v15571*v19655-*p;
+  v6074=v14092*v4256-*p;
+  v14416=v14399*v12678-*p;
+  v19299=v18701*v6352-*p;
+  v11290=v9763*v4355-*p;
+  v9095=v11339*v7861-*p;
+  v10716=v3549*v12498-*p;
+  v18337=v16815*v7684-*p;
+  v15316=v13413*v4962-*p;
+  v16042=v1982*v18459-*p;
+  v13888=v6302*v9543-*p;
+  v18758=v10470*v9117-*p;
+  v4727=v10267*v14495-*p;
+  v16994=v17692*v415-*p;
+  v8989=v16841*v12179-*p;
+  v19503=v15341*v14982-*p;
+  v10756=v17700*v11825-*p;
+  v15388=v17049*v7110-*p;
+  v4668=v4569*v10907-*p;
+  v711=v8986*v6945-*p;
+  v6814=v8866*v15401-*p;
+  v6084=v3926*v6413-*p;
+  v2804=v3434*v7205-*p;
+  v5223=v19049*v14428-*p;
+  v18429=v9342*v16047-*p;
+  v18998=v10910*v12082-*p;
+  v7375=v4026*v3973-*p;
+  v7063=v15910*v7838-*p;
+  v14498=v9325*v17846-*p;
+  v7461=v19824*v13225-*p;
+  v12885=v598*v12044-*p;
+  v18047=v3836*v12200-*p;
+  v8866=v936*v7465-*p;
+  v2808=v3330*v14605-*p;
+  v4682=v18455*v13449-*p;
+  v17026=v1816*v7866-*p;
+  v7921=v9452*v18193-*p;
+  v12068=v7549*v13077-*p;
+  v9366=v5256*v14370-*p;
+  v844=v19199*v14556-*p;
+  v19468=v2587*v862-*p;
+  v16499=v207*v3782-*p;
+  v15511=v4340*v579-*p;
+  v4892=v15204*v1898-*p;
+  v4152=v17080*v8299-*p;
+  v11838=v5028*v2336-*p;
+  v2172=v2110*v7096-*p;
+  v4124=v16973*v2108-*p;
+  v7722=v12087*v4031-*p;
+  v3641=v11866*v5677-*p;
+  v15895=v10862*v16834-*p;
+  v13471=v14705*v13573-*p;
+  v769=v14812*v6084-*p;
+  v7854=v12443*v5268-*p;
+  v16641=v250*v8866-*p;
+  v6271=v7350*v17605-*p;
+  v14331=v2095*v8637-*p;
+  v7331=v10254*v2810-*p;
+  v1857=v19491*v18618-*p;
+  v11307=v3997*v5906-*p;
+  v19941=v16080*v12585-*p;
+  v1538=v19667*v5797-*p;
+  v2703=v3901*v5710-*p;
+  v17997=v18875*v5107-*p;
+  v7837=v14275*v3231-*p;
+  v4386=v13201*v19021-*p;
+  v14172=v10651*v18771-*p;
+  v13381=v742*v5328-*p;
+  v7559=v2015*v12105-*p;
+  v18186=v18990*v661-*p;
+  v1881=v8253*v5993-*p;
+  v19025=v17567*v18752-*p;
+  v13387=v10067*v15982-*p;
+  v2419=v994*v5083-*p;
+  v16412=v15028*v3042-*p;
+  v14093=v14021*v15239-*p;
+  v12677=v13087*v5902-*p;
+  v6729=v1190*v9987-*p;
+  v6088=v276*v13414-*p;
+  v12622=v9321*v12485-*p;
+  v18633=v10806*v6920-*p;
+  v18508=v15706*v5320-*p;
+  v7516=v11640*v5231-*p;
+  v15172=v620*v11680-*p;
+  v3264=v887*v14924-*p;
+  v16685=v17391*v1629-*p;
+  v2165=v3150*v16824-*p;
+  v620=v2036*v13293-*p;
+  v16279=v1290*v17143-*p;
+  v18294=v18472*v12531-*p;
+  v15685=v14361*v775-*p;
+  v421=v2020*v12565-*p;
+  v625=v1529*v8219-*p;
+  v6397=v15429*v16962-*p;
+  v1442=v673*v9043-*p;
+  v2586=v3085*v8593-*p;
+  v5603=v4128*v5872-*p;
+  v17811=v14204*v18095-*p;
+  v16889=v1128*v1100-*p;
+  v9520=v10878*v1396-*p;
+  v13741=v15312*v10260-*p;
+  v14994=v18402*v5680-*p;
+  v919=v3565*v7542-*p;
+  v17272=v1198*v6935-*p;
+  v1274=v3885*v17375-*p;
+  v16477=v6735*v7870-*p;
+  v8146=v5401*v13856-*p;
+  v17640=v4837*v5546-*p;
+  v15695=v14629*v12436-*p;
+  v10617=v3170*v10444-*p;
+  v12587=v12581*v6797-*p;
+  v14995=v7679*v15721-*p;
+  v8426=v8869*v1121-*p;
+  v14529=v1597*v16840-*p;
+  v17572=v15869*v10671-*p;
+  v13986=v7354*v8908-*p;
+  v8188=v12852*v5265-*p;
+  v3734=v17749*v4735-*p;
+  v10650=v9460*v11246-*p;
+  v11237=v13255*v3799-*p;
+  v13957=v8229*v4999-*p;
+  v8927=v2506*v6859-*p;
+  v4768=v15531*v9669-*p;
+  v17754=v19420*v11103-*p;
+  v3818=v15723*v3414-*p;
+  v14895=v14061*v11441-*p;
+  v16974=v6386*v4620-*p;
+  v17032=v13763*v16647-*p;
+  v4895=v16923*v18594-*p;
+  v5939=v16154*v1345-*p;
+  v19676=v12697*v12213-*p;
+  v13156=v13684*v6623-*p;
+  v14465=v17808*v6615-*p;
+  v6539=v11090*v10245-*p;
+  v10899=v9484*v1723-*p;
+  v2089=v6711*v9178-*p;
+  v2854=v11114*v13418-*p;
+  v4015=v12565*v1764-*p;
+  v3909=v10367*v19051-*p;
+  v17724=v17455*v2009-*p;
+  v8259=v10989*v9912-*p;
+  v14963=v2020*v5222-*p;
+  v3494=v16197*v667-*p;
+  v19597=v14942*v14349-*p;
+  v6958=v11795*v16409-*p;
+  v8215=v7025*v2753-*p;
+  v28=v17518*v17021-*p;
+  v16396=v13663*v16151-*p;
+  v19656=v11843*v17803-*p;
+  v4772=v10243*v18689-*p;
+  v11391=v3515*v7880-*p;
+  v11799=v5906*v11067-*p;
+  v17735=v3314*v9651-*p;
+  v9458=v13060*v13320-*p;
+  v16542=v2350*v7807-*p;
+  v5497=v4587*v8422-*p;
+  v7623=v3239*v12135-*p;
+  v10875=v6734*v16475-*p;
+  v10416=v4358*v5713-*p;
+  v9206=v8194*v15503-*p;
+  v17706=v7784*v1528-*p;
+  v17381=v16161*v14447-*p;
+  v3298=v4683*v1938-*p;
+  v1304=v11516*v11260-*p;
+  v17108=v17717*v19522-*p;
+  v18843=v14857*v13803-*p;
+  v18729=v14023*v16739-*p;
+  v1270=v978*v11325-*p;
+  v6965=v9639*v1549-*p;
+  v2117=v3885*v14500-*p;
+  v9448=v10349*v12996-*p;
+  v16622=v204*v460-*p;
+  v16300=v6046*v11338-*p;
+  v2208=v6824*v11820-*p;
+  v18491=v3802*v5293-*p;
+  v9216=v10792*v8420-*p;
+  v9404=v13371*v2813-*p;
+  v7057=v16664*v57-*p;
+  v17505=v14260*v7297-*p;
+  v9627=v12458*v8803-*p;
+  v1549=v16054*v10267-*p;
+  v7319=v15616*v2175-*p;
+  v288=v9857*v8316-*p;
+  v1388=v7638*v17111-*p;
+  v16515=v4900*v3316-*p;
+  v12977=v16126*v17567-*p;
+  v14671=v12224*v19316-*p;
+  v19781=v6867*v15456-*p;
+  v7339=v13939*v17029-*p;
+  v15405=v11239*v17998-*p;
+  v3273=v1810*v19539-*p;
+  v9284=v8995*v19015-*p;
+  v10080=v15544*v3724-*p;
+  v15830=v15602*v16465-*p;
+  v18663=v6660*v3813-*p;
+  v14799=v13275*v12139-*p;
+  v9453=v4078*v15160-*p;
+  v7005=v10141*v780-*p;
+  v11453=v15832*v2882-*p;
+  v8003=v19276*v13698-*p;
+  v3895=v10211*v1354-*p;
+  v13537=v10252*v10509-*p;
+  v10286=v9271*v15137-*p;
+  v12882=v2361*v8712-*p;
+  v2298=v10441*v2269-*p;
+  v6997=v6380*v10321-*p;
+  v3834=v9364*v16775-*p;
+  v6036=v6936*v5852-*p;
+  v16632=v18466*v16333-*p;
+  v12737=v15409*v9059-*p;
+  v7034=v15092*v282-*p;
+  v7546=v9957*v15652-*p;
+  v5098=v748*v19774-*p;
+  v5874=v5529*v13423-*p;
+  v5914=v10163*v7874-*p;
+  v8239=v12537*v1627-*p;
+  v14737=v11499*v2353-*p;
+  v18148=v3688*v4460-*p;
+  v18048=v6965*v18779-*p;
+  v1831=v7811*v17220-*p;
+  v17552=v10250*v321-*p;
+  v17945=v1609*v10594-*p;
+  v18706=v6334*v4145-*p;
+  v14428=v17400*v4193-*p;
+  v8113=v595*v13099-*p;
+  v14987=v2111*v1546-*p;
+  v3007=v6073*v8052-*p;
+  v6383=v19579*v3902-*p;
+  v15626=v5294*v3961-*p;
+  v16317=v15628*v11509-*p;
+  v10434=v7904*v14474-*p;
+  v9831=v7525*v6885-*p;
+  v4922=v5430*v12704-*p;
+  v15424=v7508*v4164-*p;
+  v12229=v10887*v9618-*p;
+  v18592=v12026*v13252-*p;
+  v3553=v12480*v2995-*p;
+  v10255=v12757*v15747-*p;
+  v15690=v14979*v14175-*p;
+  v10109=v735*v5390-*p;
+  v5461=v8885*v12889-*p;
+  v12891=v15239*v3159-*p;
+  v9528=v4600*v6072-*p;
+  v17926=v9671*v1762-*p;
+  v12790=v14242*v7510-*p;
+  v18749=v9281*v3436-*p;
+  v14955=v3902*v13132-*p;
+  v4760=v4838*v18459-*p;
+  v4273=v10291*v15423-*p;
+  v19937=v3296*v8517-*p;
+  v16823=v4474*v19876-*p;
+  v6827=v1062*v15077-*p;
+  v5509=v9039*v3024-*p;
+  v3930=v8855*v14879-*p;
+  v12540=v12703*v233-*p;
+  v10680=v14286*v9619-*p;
+  v2167=v3034*v9200-*p;
+  v13362=v10333*v1116-*p;
+  v16626=v7065*v17519-*p;
+  v3223=v17921*v12185-*p;
+  v14440=v10975*v13234-*p;
+  v7645=v8532*v1785-*p;
+  v19400=v16447*v11009-*p;
+  v11225=v18387*v9964-*p;
+  v9437=v15288*v11557-*p;
+  v836=v18685*v13939-*p;
+  v9938=v5286*v7939-*p;
+  v1804=v6218*v4991-*p;
+  v15004=v7841*v13700-*p;
+  v1166=v14720*v11639-*p;
+  v16436=v10828*v14520-*p;
+  v18627=v910*v14991-*p;
+  v13800=v9288*v11549-*p;
+  v1219=v18778*v18854-*p;
+  v19720=v2323*v15655-*p;
+  v1857=v9196*v3637-*p;
+  v13031=v18785*v4371-*p;
+  v10081=v13802*v2300-*p;
+  v16263=v12615*v14516-*p;
+  v880=v13426*v9181-*p;
+  v19711=v3426*v3095-*p;
+  v2685=v15938*v5720-*p;
+  v12078=v11290*v14336-*p;
+  v18612=v16351*v18259-*p;
+  v19796=v10327*v18354-*p;
+  v15474=v18842*v10631-*p;
+  v322=v18667*v19469-*p;
+  v18344=v3503*v13571-*p;
+  v18054=v13925*v9374-*p;
+  v6287=v9258*v17757-*p;
+  v5973=v5616*v17358-*p;
+  v152=v10298*v13551-*p;
+  v3998=v3375*v929-*p;
+  v10639=v5234*v12056-*p;
+  v19463=v2310*v716-*p;
+  v4054=v15979*v19416-*p;
+  v19108=v2233*v1092-*p;
+  v7626=v13984*v8294-*p;
+  v1547=v2974*v16221-*p;
+  v6396=v14196*v4201-*p;
+  v13139=v14981*v14765-*p;
+  v9978=v9924*v10410-*p;
+  v14193=v10149*v17679-*p;
+  v522=v18482*v1563-*p;
+  v11001=v3960*v15480-*p;
+  v12216=v4649*v3921-*p;
+  v1559=v10604*v6191-*p;
+  v9512=v13157*v17284-*p;
+  v116=v3727*v11583-*p;
+  v8298=v993*v15571-*p;
+  v19165=v11812*v5619-*p;
+  v17239=v6175*v12359-*p;
+  v2689=v13916*v10833-*p;
+  v15546=v18608*v11132-*p;
+  v1966=v12140*v14813-*p;
+  v2194=v9618*v15226-*p;
+  v12067=v15548*v19011-*p;
+  v12933=v19907*v12087-*p;
+  v13748=v12881*v1652-*p;
+  v12923=v15464*v6200-*p;
+  v13697=v7555*v12409-*p;
+  v11693=v10648*v12784-*p;
+  v3016=v6640*v6103-*p;
+  v17004=v2901*v11813-*p;
+  v17449=v13150*v17735-*p;
+  v981=v1529*v14185-*p;
+  v17736=v13300*v15370-*p;
+  v17029=v4733*v4306-*p;
+  v17800=v3875*v10644-*p;
+  v7920=v3588*v19709-*p;
+  v16115=v2695*v17936-*p;
+  v19362=v4926*v9467-*p;
+  v16188=v9395*v1882-*p;
+  v14752=v9769*v5872-*p;
+  v17295=v4135*v17458-*p;
+  v19734=v1278*v12936-*p;
+  v2648=v324*v6189-*p;
+  v4203=v3134*v9764-*p;
+  v12807=v9410*v15541-*p;
+  v14861=v1287*v15944-*p;
+  v949=v13339*v7146-*p;
+  v13218=v18535*v8225-*p;
+  v4322=v7058*v12465-*p;
+  v10029=v5276*v5072-*p;
+  v19329=v3612*v1316-*p;
+  v15450=v1502*v17961-*p;
+  v1194=v10833*v1966-*p;
+  v8891=v9758*v13312-*p;
+  v14136=v1545*v18977-*p;
+  v12478=v18628*v5078-*p;
+  v5182=v7508*v16782-*p;
+  v3622=v7368*v4104-*p;
+  v18731=v18105*v9607-*p;
+  v1609=v7453*v13469-*p;
+  v13136=v22*v12800-*p;
+  v5610=v19600*v1804-*p;
+  v3464=v9263*v19149-*p;
+  v419=v8400*v18970-*p;
+  v9745=v17770*v18433-*p;
+  v5696=v1113*v10041-*p;
+  v5773=v10556*v7064-*p;
+  v2379=v10469*v11144-*p;
+  v18515=v8235*v15435-*p;
+  v9294=v8514*v2968-*p;
+  v9119=v1703*v9039-*p;
+  v18895=v17383*v13938-*p;
+  v12676=v16584*v8017-*p;
+  v11285=v5673*v5809-*p;
+  v6259=v1492*v7226-*p;
+  v12934=v18170*v14505-*p;
+  v16398=v9939*v13408-*p;
+  v8972=v9831*v17955-*p;
+  v10377=v12174*v6003-*p;
+  v13587=v4016*v10834-*p;
+  v5566=v9707*v5849-*p;
+  v9977=v4814*v17228-*p;
+  v10331=v18966*v5083-*p;
+  v2824=v9501*v11508-*p;
+  v2234=v2819*v8589-*p;
+  v66=v9870*v10213-*p;
+  v12316=v5101*v5690-*p;
+  v1706=v7238*v1494-*p;
+  v14775=v19323*v15544-*p;
+  v10601=v17733*v15209-*p;
+  v11580=v6141*v1318-*p;
+  v14375=v2935*v7815-*p;
+  v14738=v15285*v4020-*p;
+  v3233=v19055*v11140-*p;
+  v15393=v2934*v9814-*p;
+  v7066=v2956*v545-*p;
+  v16912=v9217*v1303-*p;
+  v16060=v406*v18228-*p;
+  v10804=v1598*v1587-*p;
+  v17075=v10915*v8378-*p;
+  v3319=v18380*v969-*p;
+  v713=v9473*v9165-*p;
+  v17110=v17066*v16215-*p;
+  v19705=v15197*v2300-*p;
+  v16433=v14256*v8625-*p;
+  v4196=v13874*v18792-*p;
+  v12897=v18513*v5716-*p;
+  v12063=v11261*v13118-*p;
+  v7501=v326*v10590-*p;
+  v11618=v10628*v14537-*p;
+  v12697=v12508*v6519-*p;
+  v1318=v3352*v5338-*p;
+  v3514=v3486*v1485-*p;
+  v19247=v11116*v17663-*p;
+  v13234=v12244*v17876-*p;
+  v18732=v19941*v9756-*p;
+  v7349=v19832*v14398-*p;
+  v236=v8810*v19266-*p;
+  v8991=v16324*v17846-*p;
+  v17879=v13454*v3645-*p;
+  v13031=v8973*v13389-*p;
+  v9880=v5955*v15774-*p;
+  v3891=v3739*v9831-*p;
+  v12701=v16764*v13217-*p;
+  v10763=v3543*v2513-*p;
+  v10474=v14251*v4793-*p;
+  v17895=v11623*v288-*p;
+  v13481=v10346*v10266-*p;
+  v15493=v2532*v8447-*p;
+  v14383=v1263*v6078-*p;
+  v13742=v3932*v16683-*p;
+  v13299=v521*v7234-*p;
+  v1546=v13900*v496-*p;
+  v8493=v8465*v751-*p;
+  v8436=v11771*v4970-*p;
+  v11186=v15982*v2528-*p;
+  v15253=v7090*v2336-*p;
+  v5047=v3972*v3814-*p;
+  v13628=v8999*v8160-*p;
+  v11432=v16119*v8019-*p;
+  v18926=v4174*v8098-*p;
+  v8807=v18944*v14103-*p;
+  v16536=v5933*v13910-*p;
+  v4001=v17187*v13785-*p;
+  v17730=v19973*v9784-*p;
+  v15352=v11975*v12457-*p;
+  v11777=v9595*v825-*p;
+  v8537=v8705*v9709-*p;
+  v3565=v4105*v15951-*p;
+  v14057=v2285*v1577-*p;
+  v7926=v15018*v8354-*p;
+  v3446=v10412*v8715-*p;
+  v18330=v5126*v922-*p;
+  v11968=v9293*v4454-*p;
+  v11881=v8528*v13292-*p;
+  v17282=v9573*v18280-*p;
+  v3344=v3947*v10227-*p;
+  v16294=v4586*v9505-*p;
+  v8569=v19268*v4538-*p;
+  v15021=v9579*v17011-*p;
+  v18385=v14851*v17743-*p;
+  v1973=v11435*v1495-*p;
+  v7727=v13953*v17598-*p;
+  v15960=v3612*v17186-*p;
+  v7469=v1909*v6226-*p;
+  v17525=v19189*v1241-*p;
+  v2247=v4832*v10458-*p;
+  v2541=v17947*v12032-*p;
+  v1967=v3202*v8775-*p;
+  v11327=v26*v2356-*p;
+  v2994=v16837*v4561-*p;
+  v18009=v10634*v19449-*p;
+  v13792=v16595*v2860-*p;
+  v17151=v3665*v7574-*p;
+  v4297=v15217*v14755-*p;
+  v3142=v15384*v14374-*p;
+  v13690=v16031*v8609-*p;
+  v12344=v139*v16790-*p;
+  v6001=v14528*v3356-*p;
+  v376=v15387*v142-*p;
+  v2635=v3770*v13568-*p;
+  v2763=v15351*v5536-*p;
+  v8359=v9485*v14810-*p;
+  v6998=v19328*v11524-*p;
+  v18211=v16528*v5809-*p;
+  v6927=v12995*v12300-*p;
+  v7782=v267*v12769-*p;
+  v6814=v9621*v18904-*p;
+  v6791=v4582*v16717-*p;
+  v16815=v9392*v18209-*p;
+  v2438=v5679*v16902-*p;
+  v6412=v19025*v19793-*p;
+  v18906=v207*v13685-*p;
+  v5851=v17787*v16627-*p;
+  v1408=v19400*v3521-*p;
+  v15453=v36*v9221-*p;
+  v17878=v19327*v2772-*p;
+  v10301=v13007*v15663-*p;
+  v7225=v8149*v19490-*p;
+  v1725=v2304*v11187-*p;
+  v18706=v2059*v11390-*p;
+  v12818=v2750*v15875-*p;
+  v18519=v14650*v6565-*p;
+  v18566=v7581*v1244-*p;
+  v11340=v16794*v15656-*p;
+  v3191=v7218*v13337-*p;
+  v1218=v12783*v18317-*p;
+  v4817=v12696*v16942-*p;
+  v19329=v17283*v4447-*p;
+  v7604=v18529*v15595-*p;
+  v18729=v10095*v48-*p;
+  v3516=v3235*v5050-*p;
+  v18280=v18624*v7620-*p;
+  v6938=v10591*v5541-*p;
+  v8355=v4083*v8054-*p;
+  v10087=v16624*v8660-*p;
+  v11434=v19542*v8284-*p;
+  v15838=v2390*v3541-*p;
+  v19663=v17611*v19928-*p;
+  v7002=v16616*v12037-*p;
+  v9215=v15725*v17718-*p;
+  v1360=v19469*v17889-*p;
+  v4563=v4854*v11785-*p;
+  v11417=v2068*v19130-*p;
+  v8606=v13964*v7589-*p;
+  v18691=v15171*v15238-*p;
+  v1781=v16420*v12086-*p;
+  v14784=v8280*v8629-*p;
+  v11976=v6391*v1134-*p;
+  v4338=v15855*v5784-*p;
+  v6037=v16731*v2186-*p;
+  v11990=v5389*v2346-*p;
+  v712=v17769*v16862-*p;
+  v6833=v18192*v9298-*p;
+  v18393=v6067*v15639-*p;
+  v14025=v6917*v17309-*p;
+  v10969=v7244*v10869-*p;
+  v8664=v16411*v539-*p;
+  v8909=v13649*v9067-*p;
+  v18874=v6973*v7525-*p;
+  v6691=v15576*v12809-*p;
+  v18237=v9975*v17978-*p;
+  v18468=v1993*v9641-*p;
+  v2000=v18303*v4219-*p;
+  v8489=v6794*v14113-*p;
+  v14192=v18918*v13705-*p;
+  v13550=v8785*v10099-*p;
+  v9684=v17990*v9558-*p;
+  v17562=v5184*v8144-*p;
+  v15666=v8877*v6674-*p;
+  v16190=v9630*v11329-*p;
+  v9068=v14492*v3184-*p;
+  v2129=v4924*v869-*p;
+  v7295=v154*v11320-*p;
+  v8920=v6819*v1623-*p;
+  v5936=v12645*v3158-*p;
+  v18679=v12139*v12111-*p;
+  v17324=v8407*v10681-*p;
+  v19867=v17050*v19276-*p;
+  v13771=v18631*v8728-*p;
+  v5456=v2567*v10639-*p;
+  v4367=v6093*v13600-*p;
+  v3592=v12038*v16760-*p;
+  v4517=v18784*v2556-*p;
+  v5476=v6685*v5941-*p;
+  v11826=v137*v13346-*p;
+  v7827=v19135*v14693-*p;
+  v273=v7724*v12803-*p;
+  v1918=v4408*v19812-*p;
+  v14274=v622*v11584-*p;
+  v8236=v724*v13061-*p;
+  v9490=v6673*v934-*p;
+  v19678=v2959*v19437-*p;
+  v3858=v3994*v6731-*p;
+  v3073=v19550*v16753-*p;
+  v2851=v12660*v11229-*p;
+  v6330=v1797*v9240-*p;
+  v9036=v6157*v15059-*p;
+  v6785=v9209*v15938-*p;
+  v2279=v12805*v3357-*p;
+  v16039=v13862*v12608-*p;
+  v6440=v9256*v5962-*p;
+  v18676=v3137*v5322-*p;
+  v7659=v12732*v5823-*p;
+  v14612=v1867*v4501-*p;
+  v18289=v10755*v7615-*p;
+  v14762=v588*v440-*p;
+  v5239=v1185*v635-*p;
+  v18283=v1058*v17524-*p;
+  v698=v17060*v12882-*p;
+  v18609=v16736*v4282-*p;
+  v3144=v5828*v19613-*p;
+  v15425=v13626*v19169-*p;
+  v11470=v19157*v10870-*p;
+  v13640=v11118*v8791-*p;
+  v10488=v19588*v3339-*p;
+  v11623=v11427*v24-*p;
+  v13122=v18938*v9671-*p;
+  v14782=v13832*v2819-*p;
+  v18996=v4160*v13049-*p;
+  v14468=v18274*v15422-*p;
+  v8382=v9551*v13300-*p;
+  v12606=v16569*v18305-*p;
+  v10626=v15598*v12540-*p;
+  v13424=v3543*v11170-*p;
+  v4396=v8163*v9745-*p;
+  v10170=v14099*v18055-*p;
+  v8763=v2128*v18851-*p;
+  v12585=v4103*v9732-*p;
+  v3050=v15458*v5785-*p;
+  v11405=v15236*v19116-*p;
+  v17703=v939*v10746-*p;
+  v6299=v19242*v12399-*p;
+  v12792=v1445*v17356-*p;
+  v14858=v9212*v13943-*p;
+  v7990=v3565*v18452-*p;
+  v2751=v8984*v9581-*p;
+  v2514=v5853*v13273-*p;
+  v6681=v14592*v1881-*p;
+  v16121=v4692*v8469-*p;
+  v17876=v12862*v13907-*p;
+  v2074=v4716*v14920-*p;
+  v13494=v9887*v3157-*p;
+  v15244=v19538*v19805-*p;
+  v17963=v2120*v8169-*p;
+  v18401=v9184*v18027-*p;
+  v850=v3900*v10820-*p;
+  v16756=v4777*v17416-*p;
+  v5361=v18863*v14677-*p;
+  v176=v17075*v2608-*p;
+  v2537=v2615*v3099-*p;
+  v11228=v19935*v9149-*p;
+  v19708=v11363*v16004-*p;
+  v8503=v7060*v17638-*p;
+  v3804=v5683*v13324-*p;
+  v3624=v17525*v19017-*p;
+  v18114=v7540*v887-*p;
+  v12576=v6899*v9586-*p;
+  v18128=v9083*v7030-*p;
+  v8801=v13012*v3271-*p;
+  v4896=v15442*v1439-*p;
+  v7482=v1178*v7655-*p;
+  v11261=v2215*v4996-*p;
+  v3092=v7082*v15330-*p;
+  v16068=v11915*v775-*p;
+  v12098=v13726*v19551-*p;
+  v7269=v7398*v5181-*p;
+  v19885=v9910*v3170-*p;
+  v9886=v10604*v10012-*p;
+  v17853=v9661*v3212-*p;
+  v15956=v15608*v6452-*p;
+  v7178=v10668*v19337-*p;
+  v14443=v7136*v100-*p;
+  v16619=v13584*v15216-*p;
+  v5438=v3245*v18768-*p;
+  v10632=v18447*v9323-*p;
+  v10840=v18583*v18128-*p;
+  v4174=v7843*v722-*p;
+  v19887=v15259*v9720-*p;
+  v2045=v1536*v10718-*p;
+  v1285=v7741*v5451-*p;
+  v2771=v6563*v5085-*p;
+  v420=v4142*v12707-*p;
+  v12725=v9342*v4575-*p;
+  v6206=v7412*v17046-*p;
+  v11990=v9784*v12493-*p;
+  v14757=v2100*v10696-*p;
+  v11869=v2187*v11280-*p;
+  v17427=v11416*v8110-*p;
+  v19914=v7545*v1949-*p;
+  v1063=v9657*v6742-*p;
+  v15121=v12132*v5797-*p;
+  v16931=v2268*v101-*p;
+  v15001=v2048*v16600-*p;
+  v7867=v6173*v18892-*p;
+  v14408=v13408*v7447-*p;
+  v7032=v19746*v13765-*p;
+  v973=v1521*v4814-*p;
+  v15882=v10911*v1915-*p;
+  v12279=v16045*v1097-*p;
+  v1938=v1123*v6433-*p;
+  v2289=v13764*v6022-*p;
+  v11918=v11396*v18461-*p;
+  v12963=v2554*v6619-*p;
+  v19286=v4656*v355-*p;
+  v17447=v3086*v7053-*p;
+  v3814=v7762*v10579-*p;
+  v6167=v3805*v1935-*p;
+  v427=v16457*v1662-*p;
+  v15966=v769*v7133-*p;
+  v11483=v3589*v7124-*p;
+  v6030=v15508*v11447-*p;
+  v17499=v10828*v5270-*p;
+  v4142=v11232*v11177-*p;
+  v8029=v7565*v8765-*p;
+  v19585=v4726*v1234-*p;
+  v4225=v7574*v1810-*p;
+  v1038=v5458*v19778-*p;
+  v9528=v12479*v4918-*p;
+  v1835=v14772*v7637-*p;
+  v5920=v6872*v2949-*p;
+  v2353=v8468*v13877-*p;
+  v18770=v6879*v3778-*p;
+  v2634=v9932*v12667-*p;
+  v4231=v19224*v4822-*p;
+  v17637=v840*v9972-*p;
+  v19920=v18811*v12647-*p;
+  v10296=v16469*v7884-*p;
+  v13705=v242*v14034-*p;
+  v1300=v3330*v10425-*p;
+  v5487=v14356*v6684-*p;
+  v9750=v9475*v1511-*p;
+  v2792=v4399*v6220-*p;
+  v4041=v1143*v13204-*p;
+  v10846=v10749*v11370-*p;
+  v9282=v18346*v9245-*p;
+  v10896=v278*v10152-*p;
+  v8614=v16902*v16285-*p;
+  v6534=v11458*v16924-*p;
+  v6126=v4943*v5178-*p;
+  v15796=v13179*v14371-*p;
+  v4536=v12644*v4447-*p;
+  v3775=v19*v4748-*p;
+  v12921=v11335*v9988-*p;
+  v12262=v7157*v12679-*p;
+  v862=v18786*v17374-*p;
+  v16457=v4395*v8784-*p;
+  v2590=v18511*v13158-*p;
+  v1750=v10259*v17371-*p;
+  v15360=v6722*v12257-*p;
+  v10302=v10452*v14268-*p;
+  v14450=v2475*v9835-*p;
+  v9461=v10243*v19826-*p;
+  v5457=v4983*v14912-*p;
+  v713=v10925*v13366-*p;
+  v6683=v1936*v18911-*p;
+  v12270=v1372*v7035-*p;
+  v7157=v5955*v7671-*p;
+  v14891=v3194*v9980-*p;
+  v5998=v16085*v13873-*p;
+  v18599=v357*v180-*p;
+  v16941=v18554*v15812-*p;
+  v4562=v5048*v3338-*p;
+  v12247=v10410*v11283-*p;
+  v342=v9416*v6946-*p;
+  v12852=v17008*v7498-*p;
+  v2629=v4017*v18753-*p;
+  v10439=v12160*v14219-*p;
+  v15126=v18576*v12762-*p;
+  v6728=v12287*v12875-*p;
+  v13313=v17759*v9554-*p;
+  v3115=v14067*v6656-*p;
+  v15439=v1940*v11449-*p;
+  v6907=v907*v1031-*p;
+  v7517=v16618*v11472-*p;
+  v2891=v17135*v8257-*p;
+  v4577=v5375*v5813-*p;
+  v19194=v17518*v15837-*p;
+  v7999=v472*v13794-*p;
+  v1663=v3053*v18752-*p;
+  v2728=v1612*v7063-*p;
+  v11591=v4776*v10186-*p;
+  v8712=v12803*v15865-*p;
+  v8132=v2977*v790-*p;
+  v2930=v8123*v4848-*p;
+  v16415=v7306*v17463-*p;
+  v9723=v10989*v389-*p;
+  v13715=v1012*v1903-*p;
+  v166=v3846*v9029-*p;
+  v2450=v8369*v15303-*p;
+  v12961=v8138*v17416-*p;
+  v14670=v5484*v5395-*p;
+  v17426=v5952*v14753-*p;
+  v15050=v18959*v8838-*p;
+  v4005=v17352*v366-*p;
+  v5404=v9383*v18451-*p;
+  v6997=v8328*v3709-*p;
+  v14411=v4978*v6489-*p;
+  v143=v10289*v8448-*p;
+  v9944=v3250*v12893-*p;
+  v11855=v4169*v15583-*p;
+  v6842=v3588*v123-*p;
+  v11904=v918*v103-*p;
+  v14308=v13276*v3180-*p;
+  v10720=v5381*v1891-*p;
+  v3053=v3259*v8836-*p;
+  v17999=v2608*v5339-*p;
+  v964=v4427*v9442-*p;
+  v16985=v15673*v9426-*p;
+  v19964=v19477*v12149-*p;
+  v9318=v5501*v9460-*p;
+  v14708=v374*v17195-*p;
+  v6255=v18106*v4536-*p;
+  v16117=v2294*v5371-*p;
+  v14805=v1462*v4777-*p;
+  v19048=v6072*v6295-*p;
+  v8186=v7563*v19350-*p;
+  v18259=v5487*v12630-*p;
+  v18211=v11864*v12476-*p;
+  v1619=v9414*v18226-*p;
+  v19135=v12965*v4917-*p;
+  v7977=v11734*v12663-*p;
+  v9616=v12190*v6788-*p;
+  v8400=v15742*v5708-*p;
+  v2401=v18554*v11408-*p;
+  v11817=v12710*v10743-*p;
+  v3593=v12360*v8264-*p;
+  v17199=v15416*v403-*p;
+  v13151=v6587*v13299-*p;
+  v1926=v17273*v2934-*p;
+  v17591=v19910*v4557-*p;
+  v6811=v19009*v1957-*p;
+  v1019=v11665*v10577-*p;
+  v4447=v10383*v19194-*p;
+  v18875=v1088*v14318-*p;
+  v7924=v14289*v15995-*p;
+  v14634=v4470*v725-*p;
+  v2364=v11355*v8190-*p;
+  v3048=v11700*v2488-*p;
+  v19774=v10213*v2388-*p;
+  v5499=v16818*v5626-*p;
+  v5930=v9558*v7341-*p;
+  v12778=v7738*v17309-*p;
+  v13469=v19459*v3128-*p;
+  v7632=v10652*v11641-*p;
+  v12970=v17410*v19317-*p;
+  v15412=v6244*v5874-*p;
+  v13939=v9017*v11855-*p;
+  v411=v16285*v1126-*p;
+  v7435=v741*v9128-*p;
+  v16150=v11375*v16086-*p;
+  v11861=v3694*v9158-*p;
+  v12199=v738*v412-*p;
+  v1833=v16619*v3463-*p;
+  v15587=v5725*v1556-*p;
+  v10210=v3558*v15967-*p;
+  v5743=v8083*v19761-*p;
+  v5201=v3187*v16575-*p;
+  v11002=v290*v3852-*p;
+  v5071=v9120*v10682-*p;
+  v8996=v4994*v408-*p;
+  v8536=v18452*v9908-*p;
+  v3655=v10650*v15451-*p;
+  v13973=v10998*v9531-*p;
+  v16250=v12146*v6289-*p;
+  v16980=v11844*v8719-*p;
+  v18612=v10911*v2618-*p;
+  v13548=v11476*v18446-*p;
+  v15406=v6247*v278-*p;
+  v19947=v10107*v187-*p;
+  v14493=v19807*v8821-*p;
+  v13762=v11688*v12839-*p;
+  v8059=v11626*v9321-*p;
+  v15388=v1317*v17-*p;
+  v3280=v8035*v16934-*p;
+  v14292=v11110*v17454-*p;
+  v3386=v17014*v9349-*p;
+  v9127=v28*v6934-*p;
+  v4231=v3743*v8944-*p;
+  v18861=v14100*v4164-*p;
+  v19355=v10419*v1893-*p;
+  v18519=v11913*v7035-*p;
+  v19422=v13086*v19515-*p;
+  v9766=v16530*v6399-*p;
+  v5447=v5634*v17820-*p;
+  v18613=v10322*v8032-*p;
+  v1014=v10354*v3694-*p;
+  v12677=v2383*v6922-*p;
+  v2277=v16462*v4986-*p;
+  v8994=v12799*v6855-*p;
+  v13353=v37*v13405-*p;
+  v6017=v7732*v4772-*p;
+  v17516=v19128*v14752-*p;
+  v10880=v3440*v18725-*p;
+  v16386=v9865*v3736-*p;
+  v589=v3584*v6978-*p;
+  v8348=v9545*v7226-*p;
+  v28=v16026*v10856-*p;
+  v16711=v10559*v11670-*p;
+  v4452=v19084*v7397-*p;
+  v4708=v10845*v13377-*p;
+  v6001=v5459*v13850-*p;
+  v7361=v14759*v5797-*p;
+  v16912=v8221*v14805-*p;
+  v12993=v3280*v10832-*p;
+  v7361=v15945*v15274-*p;
+  v7781=v1506*v11617-*p;
+  v19748=v12887*v5954-*p;
+  v12091=v4831*v7834-*p;
+  v4905=v17757*v1275-*p;
+  v6086=v19266*v11520-*p;
+  v7946=v12059*v4209-*p;
+  v8932=v19482*v15048-*p;
+  v18076=v10332*v5288-*p;
+  v14950=v13975*v14489-*p;
+  v5929=v17801*v12694-*p;
+  v19262=v3025*v114-*p;
+  v3547=v18152*v19352-*p;
+  v6263=v12726*v8072-*p;
+  v18317=v16591*v17029-*p;
+  v12485=v15939*v7968-*p;
+  v13976=v18987*v9797-*p;
+  v16615=v3878*v17703-*p;
+  v3038=v18915*v9913-*p;
+  v14733=v2398*v18368-*p;
+  v16582=v3023*v12983-*p;
+  v12031=v13584*v13209-*p;
+  v16168=v16361*v11185-*p;
+  v2854=v3485*v1587-*p;
+  v3905=v11547*v13896-*p;
+  v13210=v8820*v10754-*p;
+  v19173=v18422*v3923-*p;
+  v13974=v17221*v2153-*p;
+  v12428=v8747*v5619-*p;
+  v18349=v10360*v14129-*p;
+  v17050=v3525*v11783-*p;
+  v5140=v16342*v15106-*p;
+  v6346=v2499*v18209-*p;
+  v3478=v1460*v12810-*p;
+  v5487=v15936*v17651-*p;
+  v3455=v8737*v10600-*p;
+  v7262=v18525*v5532-*p;
+  v12162=v4000*v19656-*p;
+  v18672=v19288*v4867-*p;
+  v812=v17352*v19052-*p;
+  v29=v15203*v16808-*p;
+  v17742=v2581*v19262-*p;
+  v9426=v12350*v1350-*p;
+  v11897=v8710*v13553-*p;
+  v16909=v4568*v8074-*p;
+  v19370=v293*v17313-*p;
+  v13857=v7649*v5421-*p;
+  v2710=v14521*v12325-*p;
+  v15600=v3441*v6958-*p;
+  v10911=v6875*v13690-*p;
+  v11489=v15108*v17792-*p;
+  v15112=v1023*v11063-*p;
+  v18573=v283*v7863-*p;
+  v4529=v3453*v14563-*p;
+  v8810=v12564*v11160-*p;
+  v8641=v5813*v15332-*p;
+  v415=v16105*v11256-*p;
+  v15831=v7000*v11788-*p;
+  v3835=v19850*v6105-*p;
+  v16925=v18876*v3420-*p;
+  v376=v14904*v6966-*p;
+  v7040=v13670*v13028-*p;
+  v1442=v8756*v3967-*p;
+  v11365=v14855*v4588-*p;
+  v18092=v3823*v16505-*p;
+  v11423=v3402*v19934-*p;
+  v16709=v11302*v14105-*p;
+  v5547=v9289*v6553-*p;
+  v7325=v1541*v17008-*p;
+  v12137=v15252*v13990-*p;
+  v2798=v6063*v14372-*p;
+  v10178=v3722*v11913-*p;
+  v1825=v18188*v19393-*p;
+  v19202=v8188*v17209-*p;
+  v18378=v2656*v3875-*p;
+  v5808=v17999*v12842-*p;
+  v17464=v15058*v1115-*p;
+  v10251=v11785*v18672-*p;
+  v2490=v6210*v9449-*p;
+  v17901=v16638*v2476-*p;
+  v13746=v18119*v4196-*p;
+  v14662=v2812*v710-*p;
+  v2871=v16957*v5852-*p;
+  v17218=v17526*v203-*p;
+  v12589=v12376*v6154-*p;
+  v1353=v12701*v19927-*p;
+  v9425=v2521*v4230-*p;
+  v14629=v14159*v19589-*p;
+  v9195=v13342*v2583-*p;
+  v5784=v3371*v7725-*p;
+  v1476=v4777*v4216-*p;
+  v18231=v12246*v16743-*p;
+  v2215=v16549*v908-*p;
+  v70=v9279*v12689-*p;
+  v16989=v208*v3228-*p;
+  v12601=v8736*v12487-*p;
+  v8684=v5225*v2389-*p;
+  v15906=v15076*v2037-*p;
+  v9901=v15190*v13605-*p;
+  v6229=v13829*v19825-*p;
+  v7965=v7489*v3719-*p;
+  v1734=v14321*v11098-*p;
+  v900=v17682*v5381-*p;
+  v14455=v3652*v10942-*p;
+  v5785=v3503*v9396-*p;
+  v11786=v10129*v12620-*p;
+  v5479=v14254*v17003-*p;
+  v7618=v5873*v10894-*p;
+  v19834=v18872*v12662-*p;
+  v16435=v13227*v10441-*p;
+  v6301=v9708*v499-*p;
+  v15930=v6811*v9808-*p;
+  v11032=v7014*v8674-*p;
+  v8077=v9893*v14420-*p;
+  v718=v13013*v17054-*p;
+  v4548=v13752*v7662-*p;
+  v13449=v9207*v1140-*p;
+  v9688=v12490*v15644-*p;
+  v18714=v19839*v14772-*p;
+  v11170=v16662*v8151-*p;
+  v10134=v12787*v16388-*p;
+  v14813=v9555*v4067-*p;
+  v15934=v12231*v3533-*p;
+  v4138=v15942*v8086-*p;
+  v16632=v11089*v10131-*p;
+  v2870=v18867*v12800-*p;
+  v18670=v14852*v18437-*p;
+  v13781=v7811*v5546-*p;
+  v4354=v14765*v11119-*p;
+  v4150=v9270*v3265-*p;
+  v10679=v14287*v4782-*p;
+  v18052=v17999*v2195-*p;
+  v3594=v1748*v11051-*p;
+  v7849=v5197*v12430-*p;
+  v18297=v10593*v12576-*p;
+  v9710=v15233*v18415-*p;
+  v4173=v4372*v8334-*p;
+  v4924=v1568*v18574-*p;
+  v16820=v14268*v1797-*p;
+  v14030=v13236*v14128-*p;
+  v19258=v7475*v1739-*p;
+  v19866=v18561*v2923-*p;
+  v12257=v1103*v10110-*p;
+  v12978=v14476*v13296-*p;
+  v11124=v10855*v5617-*p;
+  v4981=v3535*v17381-*p;
+  v11716=v5173*v13372-*p;
+  v15312=v14712*v1346-*p;
+  v2661=v8108*v15055-*p;
+  v6513=v2428*v7532-*p;
+  v16281=v13973*v2856-*p;
+  v6252=v6812*v10833-*p;
+  v2106=v13759*v15412-*p;
+  v2306=v14746*v8011-*p;
+  v4568=v16437*v15044-*p;
+  v12310=v12483*v13083-*p;
+  v16207=v11447*v4317-*p;
+  v9431=v10697*v9468-*p;
+  v16069=v17828*v17609-*p;
+  v17386=v9398*v18428-*p;
+  v3107=v7483*v13344-*p;
+  v8923=v3906*v1031-*p;
+  v4874=v19436*v9329-*p;
+  v17287=v8280*v18466-*p;
+  v799=v10317*v15775-*p;
+  v18725=v2165*v12068-*p;
+  v9922=v11909*v14530-*p;
+  v16287=v9871*v1231-*p;
+  v9720=v19540*v16980-*p;
+  v7474=v14264*v995-*p;
+  v17670=v17859*v6000-*p;
+  v16656=v10986*v10184-*p;
+  v11163=v12968*v1265-*p;
+  v2616=v7005*v12557-*p;
+  v4748=v11629*v10971-*p;
+  v4667=v14011*v15274-*p;
+  v10550=v7916*v3472-*p;
+  v7525=v12053*v16008-*p;
+  v3413=v9820*v2574-*p;
+  v18720=v10929*v10749-*p;
+  v6656=v15387*v11470-*p;
+  v7569=v7352*v3038-*p;
+  v10943=v15537*v14752-*p;
+  v13031=v18447*v3543-*p;
+  v7613=v4668*v19994-*p;
+  v16843=v7371*v8063-*p;
+  v6463=v6801*v4015-*p;
+  v5176=v13906*v1710-*p;
+  v19209=v873*v1779-*p;
+  v18084=v14251*v11576-*p;
+  v12546=v13377*v6895-*p;
+  v10589=v402*v12714-*p;
+  v16326=v19741*v7316-*p;
+  v12816=v13784*v600-*p;
+  v3604=v14640*v9636-*p;
+  v2383=v9765*v13603-*p;
+  v9818=v15349*v2880-*p;
+  v8436=v4664*v6146-*p;
+  v16984=v16294*v4433-*p;
+  v16747=v6609*v8758-*p;
+  v18652=v17532*v1973-*p;
+  v5339=v12107*v3352-*p;
+  v3302=v2478*v18786-*p;
+  v5593=v51*v16568-*p;
+  v7323=v3980*v16703-*p;
+  v19595=v19327*v5061-*p;
+  v19981=v6614*v3173-*p;
+  v19573=v7919*v2472-*p;
+  v5334=v10973*v18218-*p;
+  v7094=v3119*v15992-*p;
+  v19341=v6791*v862-*p;
+  v17726=v17834*v13352-*p;
+  v19878=v16497*v9660-*p;
+  v11163=v347*v17422-*p;
+  v12404=v19944*v14037-*p;
+  v16687=v8625*v3340-*p;
+  v14456=v6283*v11836-*p;
+  v5597=v15636*v13647-*p;
+  v8076=v3561*v17059-*p;
+  v5085=v6249*v10291-*p;
+  v16309=v15007*v8782-*p;
+  v944=v5686*v11362-*p;
+  v16977=v1094*v6709-*p;
+  v19444=v7037*v18170-*p;
+  v19115=v10246*v6486-*p;
+  v6658=v2808*v4336-*p;
+  v17241=v211*v16907-*p;
+  v18608=v7041*v3174-*p;
+  v7511=v8294*v2623-*p;
+  v19486=v8217*v16440-*p;
+  v15235=v4524*v4946-*p;
+  v9311=v6972*v7478-*p;
+  v10652=v17359*v9689-*p;
+  v17742=v971*v6142-*p;
+  v8419=v8732*v12472-*p;
+  v1198=v1638*v3595-*p;
+  v6465=v3567*v1619-*p;
+  v3578=v732*v598-*p;
+  v12483=v9729*v8770-*p;
+  v14568=v17355*v18451-*p;
+  v7224=v18800*v17119-*p;
+  v11982=v16049*v19447-*p;
+  v2930=v19608*v15169-*p;
+  v5378=v14719*v12772-*p;
+  v8238=v4946*v18140-*p;
+  v18146=v1168*v205-*p;
+  v8952=v16777*v11490-*p;
+  v2951=v4812*v4292-*p;
+  v14400=v16085*v10879-*p;
+  v8782=v231*v7450-*p;
+  v17560=v7276*v7974-*p;
+  v7719=v19450*v13209-*p;
+  v15308=v1805*v2365-*p;
+  v11013=v5130*v2437-*p;
+  v19816=v6006*v7933-*p;
+  v11490=v14977*v10136-*p;
+  v13764=v7414*v15328-*p;
+  v1057=v10636*v8685-*p;
+  v11135=v2697*v13173-*p;
+  v4820=v4315*v1664-*p;
+  v18914=v9151*v1509-*p;
+  v8984=v19611*v1491-*p;
+  v19148=v7798*v6100-*p;
+  v4389=v17672*v3338-*p;
+  v6767=v12461*v5452-*p;
+  v10942=v14668*v13379-*p;
+  v7679=v9974*v13074-*p;
+  v12415=v11065*v1022-*p;
+  v11612=v3706*v14281-*p;
+  v19349=v13720*v18811-*p;
+  v9206=v13514*v14126-*p;
+  v8268=v14048*v3309-*p;
+  v19699=v11146*v6232-*p;
+  v10093=v7885*v6343-*p;
+  v17847=v5769*v15346-*p;
+  v843=v13704*v1840-*p;
+  v5385=v7346*v18339-*p;
+  v10245=v6264*v7242-*p;
+  v6563=v14396*v13008-*p;
+  v3394=v11054*v4855-*p;
+  v747=v13550*v7156-*p;
+  v11772=v6096*v16077-*p;
+  v14051=v7604*v16525-*p;
+  v3997=v12023*v5727-*p;
+  v18406=v11603*v19420-*p;
+  v19563=v17174*v3419-*p;
+  v12649=v8772*v5775-*p;
+  v18672=v9221*v16465-*p;
+  v7546=v4352*v3404-*p;
+  v17010=v12109*v1965-*p;
+  v18978=v17616*v459-*p;
+  v12574=v12885*v8630-*p;
+  v562=v13971*v15439-*p;
+  v102=v7827*v29-*p;
+  v4966=v17656*v14065-*p;
+  v6666=v907*v19373-*p;
+  v3295=v7986*v2163-*p;
+  v11979=v1730*v10065-*p;
+  v18817=v17266*v1511-*p;
+  v2117=v17124*v18717-*p;
+  v5812=v12315*v8449-*p;
+  v6074=v2733*v7536-*p;
+  v6776=v16937*v1411-*p;
+  v3221=v5957*v15769-*p;
+  v1211=v7330*v11665-*p;
+  v1666=v16560*v6313-*p;
+  v3660=v2990*v7554-*p;
+  v5948=v15039*v16647-*p;
+  v15457=v2848*v18430-*p;
+  v16120=v17503*v7901-*p;
+  v11040=v149*v4344-*p;
+  v10604=v18299*v6807-*p;
+  v14264=v5595*v1516-*p;
+  v13912=v3008*v6044-*p;
+  v11084=v9296*v10063-*p;
+  v11600=v5659*v13656-*p;
+  v13841=v11120*v6715-*p;
+  v14151=v14026*v19478-*p;
+  v9406=v14157*v8133-*p;
+  v18952=v128*v6883-*p;
+  v15124=v1542*v19454-*p;
+  v18757=v9276*v10632-*p;
+  v4383=v4728*v2766-*p;
+  v13311=v6819*v17021-*p;
+  v4670=v18909*v814-*p;
+  v835=v15701*v12148-*p;
+  v13064=v14258*v18170-*p;
+  v46=v7088*v9963-*p;
+  v11120=v15993*v7637-*p;
+  v4282=v1084*v14341-*p;
+  v15073=v5825*v19870-*p;
+  v8988=v19310*v18730-*p;
+  v10980=v11544*v12120-*p;
+  v8633=v11130*v14844-*p;
+  v7557=v1009*v12697-*p;
+  v3775=v19056*v2872-*p;
+  v1415=v17315*v6860-*p;
+  v18720=v1568*v2706-*p;
+  v1863=v2057*v1430-*p;
+  v15860=v14822*v17670-*p;
+  v19976=v10082*v42-*p;
+  v19045=v7396*v2479-*p;
+  v6994=v377*v14347-*p;
+  v9432=v10728*v18687-*p;
+  v10391=v8753*v18116-*p;
+  v16065=v16322*v17852-*p;
+  v8474=v16526*v7040-*p;
+  v16845=v18959*v13966-*p;
+  v5866=v2200*v10422-*p;
+  v2338=v7493*v19177-*p;
+  v18396=v13878*v9869-*p;
+  v12579=v4819*v11980-*p;
+  v7552=v3046*v18874-*p;
+  v9859=v548*v12779-*p;
+  v11363=v7636*v9900-*p;
+  v8947=v14839*v19930-*p;
+  v2517=v10453*v17095-*p;
+  v384=v2915*v15469-*p;
+  v6445=v15535*v4060-*p;
+  v9963=v17354*v8019-*p;
+  v10607=v1283*v16815-*p;
+  v2976=v12139*v5483-*p;
+  v14935=v19066*v2786-*p;
+  v12061=v3693*v8318-*p;
+  v19023=v11142*v15147-*p;
+  v2997=v2905*v4514-*p;
+  v13759=v4903*v18999-*p;
+  v1496=v18923*v14295-*p;
+  v18004=v14258*v18623-*p;
+  v17038=v17918*v19757-*p;
+  v6202=v18636*v19002-*p;
+  v12843=v625*v14383-*p;
+  v8054=v13439*v18874-*p;
+  v14477=v16977*v19435-*p;
+  v12333=v2672*v14331-*p;
+  v13676=v5967*v15496-*p;
+  v17133=v5850*v5682-*p;
+  v14837=v19679*v19297-*p;
+  v10731=v11177*v7428-*p;
+  v10624=v466*v12929-*p;
+  v7059=v2724*v6747-*p;
+  v16268=v450*v17813-*p;
+  v13341=v11782*v16275-*p;
+  v13454=v4798*v18562-*p;
+  v13272=v9077*v8074-*p;
+  v7109=v18042*v19698-*p;
+  v2655=v6236*v10003-*p;
+  v14077=v11626*v16876-*p;
+  v16179=v4803*v5904-*p;
+  v5320=v11614*v6688-*p;
+  v7445=v3038*v5351-*p;
+  v10274=v18544*v2540-*p;
+  v15982=v18645*v16479-*p;
+  v11196=v1337*v17467-*p;
+  v4526=v15237*v15421-*p;
+  v7611=v10036*v17420-*p;
+  v13979=v1720*v18261-*p;
+  v9320=v10789*v7492-*p;
+  v7953=v13313*v19474-*p;
+  v14475=v15627*v6435-*p;
+  v8530=v6413*v6530-*p;
+  v603=v15906*v17647-*p;
+  v17917=v11757*v5687-*p;
+  v19437=v13259*v10665-*p;
+  v5693=v13691*v13777-*p;
+  v8620=v14721*v19140-*p;
+  v17145=v2949*v6784-*p;
+  v19847=v11112*v603-*p;
+  v9792=v6777*v2650-*p;
+  v18496=v18269*v14197-*p;
+  v1542=v13360*v10022-*p;
+  v2410=v2819*v10992-*p;
+  v17385=v15304*v15521-*p;
+  v6105=v11563*v9332-*p;
+  v13570=v18944*v11850-*p;
+  v19485=v3673*v3911-*p;
+  v4489=v9539*v9784-*p;
+  v8486=v16313*v9635-*p;
+  v9647=v4802*v12303-*p;
+  v12288=v7419*v16518-*p;
+  v15964=v16977*v7376-*p;
+  v7394=v5522*v6997-*p;
+  v1759=v4557*v14004-*p;
+  v2726=v18257*v11496-*p;
+  v16851=v9855*v10904-*p;
+  v17864=v7758*v5299-*p;
+  v2349=v18246*v9101-*p;
+  v4956=v6580*v14437-*p;
+  v13922=v4918*v15629-*p;
+  v5381=v4113*v16502-*p;
+  v2987=v15486*v11001-*p;
+  v1388=v5639*v6363-*p;
+  v743=v2801*v1919-*p;
+  v5522=v16667*v3863-*p;
+  v3712=v2441*v17037-*p;
+  v18324=v95*v12328-*p;
+  v19581=v19777*v6241-*p;
+  v17919=v1653*v19555-*p;
+  v5903=v3618*v12384-*p;
+  v81=v1055*v18662-*p;
+  v15480=v11338*v11349-*p;
+  v12627=v14395*v2135-*p;
+  v16874=v18805*v11540-*p;
+  v5980=v8674*v1048-*p;
+  v15996=v10050*v14126-*p;
+  v11565=v7750*v4259-*p;
+  v2578=v16414*v4140-*p;
+  v4495=v18155*v5910-*p;
+  v7900=v14818*v16210-*p;
+  v12054=v9574*v18605-*p;
+  v19410=v4277*v6171-*p;
+  v7198=v8222*v5915-*p;
+  v18895=v11834*v13501-*p;
+  v3191=v7784*v17713-*p;
+  v5741=v17510*v7215-*p;
+  v4549=v19341*v16180-*p;
+  v15613=v9564*v16234-*p;
+  v8425=v10827*v14768-*p;
+  v16204=v12999*v17690-*p;
+  v3412=v10824*v13916-*p;
+  v10736=v9322*v2310-*p;
+  v3517=v6833*v16386-*p;
+  v9570=v1027*v374-*p;
+  v15713=v178*v11589-*p;
+  v17590=v17468*v128-*p;
+  v14412=v10128*v19432-*p;
+  v6519=v13651*v11146-*p;
+  v12741=v1210*v17101-*p;
+  v16546=v5470*v15022-*p;
+  v6882=v3458*v5582-*p;
+  v9019=v12997*v16757-*p;
+  v16771=v11564*v9740-*p;
+  v13769=v17001*v4970-*p;
+  v19671=v9493*v14067-*p;
+  v8761=v10391*v2927-*p;
+  v2071=v17116*v5529-*p;
+  v14597=v1200*v9811-*p;
+  v8054=v9314*v2125-*p;
+  v15896=v8526*v16392-*p;
+  v5181=v8253*v12571-*p;
+  v9882=v18566*v3106-*p;
+  v15178=v8263*v16189-*p;
+  v3856=v1390*v1082-*p;
+  v8523=v480*v14650-*p;
+  v11967=v15783*v10208-*p;
+  v2994=v7123*v18714-*p;
+  v11555=v3623*v6812-*p;
+  v18550=v7464*v12752-*p;
+  v11113=v17174*v1398-*p;
+  v1031=v74*v14092-*p;
+  v1629=v10884*v14830-*p;
+  v10180=v15225*v5029-*p;
+  v19667=v17371*v10158-*p;
+  v5888=v7372*v15640-*p;
+  v6608=v5173*v12286-*p;
+  v13552=v3950*v6847-*p;
+  v5483=v3153*v9118-*p;
+  v5537=v8730*v4129-*p;
+  v19983=v7745*v11645-*p;
+  v4296=v9432*v13224-*p;
+  v12245=v12687*v19624-*p;
+  v13912=v3772*v3258-*p;
+  v10293=v3203*v13429-*p;
+  v19123=v11080*v12092-*p;
+  v15709=v15344*v19217-*p;
+  v2398=v12733*v11998-*p;
+  v13706=v12490*v18568-*p;
+  v222=v10254*v9589-*p;
+  v18400=v10819*v16171-*p;
+  v14167=v4394*v2135-*p;
+  v1284=v5002*v14247-*p;
+  v6146=v12503*v19971-*p;
+  v14039=v14824*v15029-*p;
+  v886=v9099*v446-*p;
+  v14064=v6976*v4240-*p;
+  v19347=v5292*v13366-*p;
+  v12744=v7223*v7658-*p;
+  v15972=v5344*v4648-*p;
+  v19905=v9021*v16093-*p;
+  v3746=v11367*v17373-*p;
+  v19259=v4972*v9119-*p;
+  v13051=v5534*v11671-*p;
+  v17024=v5878*v15022-*p;
+  v7087=v7715*v19100-*p;
+  v14423=v3224*v16620-*p;
+  v12386=v6443*v7796-*p;
+  v16848=v1300*v11279-*p;
+  v19975=v5347*v3092-*p;
+  v10681=v4441*v7123-*p;
+  v7746=v12043*v9471-*p;
+  v3827=v7314*v15219-*p;
+  v8037=v2728*v19293-*p;
+  v1076=v15252*v5455-*p;
+  v10666=v15628*v17390-*p;
+  v9479=v11611*v14458-*p;
+  v13344=v1447*v6209-*p;
+  v16851=v18209*v13262-*p;
+  v11735=v990*v2675-*p;
+  v8027=v15590*v12852-*p;
+  v5788=v4594*v15867-*p;
+  v9341=v6288*v2585-*p;
+  v5670=v10639*v19724-*p;
+  v4934=v19223*v6546-*p;
+  v2251=v10067*v4659-*p;
+  v1909=v4906*v11059-*p;
+  v10167=v17090*v208-*p;
+  v14947=v9628*v16023-*p;
+  v16970=v5206*v2629-*p;
+  v6379=v4121*v14463-*p;
+  v16391=v2371*v14608-*p;
+  v18344=v12164*v6202-*p;
+  v14767=v18913*v2291-*p;
+  v18692=v2639*v16817-*p;
+  v10023=v5908*v2835-*p;
+  v2897=v11390*v11437-*p;
+  v2392=v13827*v11366-*p;
+  v8251=v16497*v7009-*p;
+  v8988=v11077*v19439-*p;
+  v6017=v18645*v14173-*p;
+  v2985=v2938*v12590-*p;
+  v8491=v8391*v16868-*p;
+  v8578=v13443*v15565-*p;
+  v966=v10812*v3529-*p;
+  v13440=v11379*v7079-*p;
+  v2573=v18439*v7437-*p;
+  v9131=v12184*v16244-*p;
+  v18087=v1400*v5573-*p;
+  v2842=v18251*v2611-*p;
+  v19280=v10784*v18838-*p;
+  v2145=v6074*v18857-*p;
+  v4407=v19759*v9794-*p;
+  v10231=v11966*v3328-*p;
+  v5632=v17061*v16393-*p;
+  v18382=v17308*v18980-*p;
+  v305=v3227*v16024-*p;
+  v1947=v6868*v727-*p;
+  v15084=v1113*v2916-*p;
+  v3951=v17760*v13477-*p;
+  v17366=v2430*v4949-*p;
+  v2640=v3487*v1029-*p;
+  v19710=v5438*v874-*p;
+  v12226=v1226*v18891-*p;
+  v10739=v11451*v12842-*p;
+  v17932=v8986*v819-*p;
+  v11018=v555*v7640-*p;
+  v8101=v5003*v1038-*p;
+  v5523=v303*v11525-*p;
+  v10399=v54*v11991-*p;
+  v10823=v3559*v11364-*p;
+  v2351=v15092*v13031-*p;
+  v11426=v9824*v11509-*p;
+  v3511=v8177*v7-*p;
+  v930=v17084*v16853-*p;
+  v2578=v12663*v3628-*p;
+  v15273=v6232*v17412-*p;
+  v17074=v10244*v6776-*p;
+  v14415=v12972*v3834-*p;
+  v9886=v19222*v5728-*p;
+  v7928=v13768*v16233-*p;
+  v3123=v15039*v13936-*p;
+  v16702=v61*v1254-*p;
+  v12927=v1290*v15988-*p;
+  v5616=v9123*v790-*p;
+  v17387=v3633*v19210-*p;
+  v8526=v8187*v18895-*p;
+  v13656=v2531*v7699-*p;
+  v8920=v5788*v11767-*p;
+  v11133=v14560*v10582-*p;
+  v1268=v1298*v7145-*p;
+  v14256=v11419*v1439-*p;
+  v16606=v4541*v18357-*p;
+  v12262=v15292*v1505-*p;
+  v6824=v4712*v15428-*p;
+  v842=v15656*v3620-*p;
+  v17341=v17731*v11702-*p;
+  v18588=v19066*v7034-*p;
+  v14095=v18757*v906-*p;
+  v14107=v9210*v17343-*p;
+  v12262=v6138*v8463-*p;
+  v728=v11142*v846-*p;
+  v6311=v3328*v17220-*p;
+  v12169=v6141*v16103-*p;
+  v1937=v13224*v3946-*p;
+  v4349=v13874*v10848-*p;
+  v12355=v10951*v10899-*p;
+  v12493=v12335*v6753-*p;
+  v9266=v7848*v17355-*p;
+  v3714=v12172*v12193-*p;
+  v9062=v14178*v1591-*p;
+  v17332=v13819*v13503-*p;
+  v5706=v3894*v11058-*p;
+  v18464=v3341*v1580-*p;
+  v10518=v16183*v6987-*p;
+  v15240=v1242*v1115-*p;
+  v12197=v5504*v6396-*p;
+  v19147=v11033*v17424-*p;
+  v5643=v17321*v14693-*p;
+  v2952=v15275*v9714-*p;
+  v15983=v18425*v14563-*p;
+  v1641=v19284*v16710-*p;
+  v6823=v18851*v7042-*p;
+  v10614=v15432*v12387-*p;
+  v4808=v11567*v4413-*p;
+  v10284=v31*v1519-*p;
+  v11511=v18178*v13070-*p;
+  v11238=v5222*v8963-*p;
+  v5209=v6492*v9349-*p;
+  v10368=v10786*v13525-*p;
+  v13717=v3330*v14171-*p;
+  v13455=v8141*v9789-*p;
+  v622=v17274*v9785-*p;
+  v18536=v14542*v7233-*p;
+  v10941=v6456*v1541-*p;
+  v2023=v6277*v12409-*p;
+  v6446=v18471*v11922-*p;
+  v13405=v10*v722-*p;
+  v2427=v12589*v15175-*p;
+  v7922=v12670*v2844-*p;
+  v6610=v11082*v19385-*p;
+  v16839=v10576*v11953-*p;
+  v18735=v15100*v11630-*p;
+  v10932=v13193*v11517-*p;
+  v2677=v19050*v937-*p;
+  v6896=v17682*v5151-*p;
+  v1895=v8249*v8278-*p;
+  v12574=v9036*v12759-*p;
+  v18901=v18551*v17889-*p;
+  v5528=v18169*v1149-*p;
+  v303=v12375*v9450-*p;
+  v17092=v959*v12747-*p;
+  v13029=v3528*v1293-*p;
+  v2740=v7484*v17310-*p;
+  v4205=v17132*v3715-*p;
+  v1525=v3134*v6269-*p;
+  v19945=v6551*v17350-*p;
+  v18778=v7133*v3671-*p;
+  v6902=v13010*v4917-*p;
+  v4468=v4754*v3061-*p;
+  v13335=v14267*v14044-*p;
+  v7265=v11714*v5203-*p;
+  v1769=v3912*v15397-*p;
+  v18331=v1442*v3232-*p;
+  v17098=v15419*v15516-*p;
+  v15714=v14178*v633-*p;
+  v18652=v15192*v10849-*p;
+  v9814=v11003*v4298-*p;
+  v16147=v19419*v14040-*p;
+  v16408=v10690*v10655-*p;
+  v8996=v5191*v15620-*p;
+  v15824=v11212*v18890-*p;
+  v16909=v15004*v5242-*p;
+  v6684=v11847*v11001-*p;
+  v12688=v9102*v12434-*p;
+  v8024=v9277*v8630-*p;
+  v6045=v14590*v15517-*p;
+  v18766=v9784*v11267-*p;
+  v6142=v6948*v5834-*p;
+  v1436=v8403*v4524-*p;
+  v13904=v14351*v6281-*p;
+  v7385=v15405*v8625-*p;
+  v9116=v16338*v18784-*p;
+  v5331=v321*v5891-*p;
+  v16907=v2987*v11144-*p;
+  v10712=v10761*v14155-*p;
+  v8383=v17544*v4578-*p;
+  v16204=v14993*v1684-*p;
+  v13006=v7217*v1202-*p;
+  v12638=v11924*v5398-*p;
+  v9732=v3624*v11018-*p;
+  v9895=v1356*v12571-*p;
+  v4830=v17063*v8429-*p;
+  v17409=v16243*v6744-*p;
+  v18698=v4193*v19868-*p;
+  v5531=v202*v5814-*p;
+  v2205=v1579*v17942-*p;
+  v12796=v16660*v7288-*p;
+  v8858=v18981*v17157-*p;
+  v7739=v4011*v2330-*p;
+  v19802=v13820*v16347-*p;
+  v8379=v9683*v17353-*p;
+  v10865=v9927*v17525-*p;
+  v17758=v12331*v16853-*p;
+  v2658=v19369*v18268-*p;
+  v8638=v10184*v2354-*p;
+  v17105=v7875*v1439-*p;
+  v7768=v10591*v14971-*p;
+  v1390=v4670*v6729-*p;
+  v11758=v15183*v6620-*p;
+  v14604=v3116*v8905-*p;
+  v11407=v2198*v3713-*p;
+  v14305=v4946*v4455-*p;
+  v1214=v11033*v1385-*p;
+  v6871=v6941*v4974-*p;
+  v14853=v13522*v7462-*p;
+  v3498=v5649*v19026-*p;
+  v4735=v8140*v18399-*p;
+  v9649=v3820*v1284-*p;
+  v3070=v11187*v8778-*p;
+  v4294=v10556*v5251-*p;
+  v51=v3189*v14685-*p;
+  v12109=v1846*v6504-*p;
+  v19824=v826*v2260-*p;
+  v9678=v22*v13625-*p;
+  v16603=v5935*v8655-*p;
+  v2028=v15039*v10399-*p;
+  v12007=v6857*v12418-*p;
+  v8574=v4607*v15454-*p;
+  v12017=v14334*v4828-*p;
+  v9999=v10807*v2736-*p;
+  v7791=v19243*v2146-*p;
+  v4503=v12061*v18649-*p;
+  v6057=v6880*v16610-*p;
+  v15727=v6909*v13612-*p;
+  v19114=v12669*v8219-*p;
+  v575=v12054*v9611-*p;
+  v9767=v15757*v5624-*p;
+  v3279=v9647*v15316-*p;
+  v18501=v16019*v1121-*p;
+  v7965=v5535*v7645-*p;
+  v2171=v15676*v17906-*p;
+  v1418=v7839*v5509-*p;
+  v13093=v11179*v12130-*p;
+  v5601=v350*v7347-*p;
+  v17491=v15624*v1117-*p;
+  v14203=v11655*v7196-*p;
+  v18608=v3144*v18096-*p;
+  v6698=v173*v250-*p;
+  v6351=v9287*v5320-*p;
+  v10039=v6697*v16075-*p;
+  v1629=v5267*v15732-*p;
+  v11830=v19332*v9298-*p;
+  v4321=v11878*v8954-*p;
+  v12606=v10592*v8015-*p;
+  v16124=v4719*v18566-*p;
+  v3102=v805*v8278-*p;
+  v3291=v10690*v14528-*p;
+  v3170=v7004*v13918-*p;
+  v3872=v17776*v3509-*p;
+  v8235=v16386*v17786-*p;
+  v15737=v1768*v14370-*p;
+  v4996=v16262*v7250-*p;
+  v15945=v17546*v15398-*p;
+  v13948=v4514*v4246-*p;
+  v19016=v13259*v10591-*p;
+  v19027=v11446*v7700-*p;
+  v6385=v7278*v2831-*p;
+  v1037=v138*v10308-*p;
+  v5992=v2685*v7960-*p;
+  v5109=v11972*v12409-*p;
+  v7569=v12900*v19690-*p;
+  v13123=v2943*v452-*p;
+  v13472=v15227*v15169-*p;
+  v2247=v10569*v16143-*p;
+  v16673=v18233*v5270-*p;
+  v17316=v6695*v16644-*p;
+  v1248=v2359*v14214-*p;
+  v16342=v16539*v3509-*p;
+  v1659=v13496*v10203-*p;
+  v43=v19317*v1832-*p;
+  v16502=v7977*v10402-*p;
+  v2283=v9234*v2892-*p;
+  v10402=v17693*v1557-*p;
+  v5735=v13392*v11848-*p;
+  v433=v11822*v3509-*p;
+  v17887=v3601*v7044-*p;
+  v475=v9923*v16458-*p;
+  v9821=v17270*v11741-*p;
+  v8478=v15303*v10561-*p;
+  v6724=v3843*v11509-*p;
+  v9799=v5859*v14249-*p;
+  v3059=v10688*v15164-*p;
+  v9217=v3438*v935-*p;
+  v11758=v15557*v14479-*p;
+  v2077=v9248*v7578-*p;
+  v2257=v958*v6430-*p;
+  v6758=v14028*v2703-*p;
+  v18745=v2690*v4570-*p;
+  v2990=v7383*v18349-*p;
+  v16414=v6781*v19631-*p;
+  v1157=v6863*v8810-*p;
+  v11731=v10146*v1081-*p;
+  v434=v9142*v1714-*p;
+  v13376=v5369*v360-*p;
+  v3795=v15660*v12396-*p;
+  v13545=v8497*v15972-*p;
+  v8140=v17463*v15290-*p;
+  v12520=v18951*v19392-*p;
+  v9122=v3707*v11937-*p;
+  v1595=v10739*v802-*p;
+  v7991=v11398*v12874-*p;
+  v14280=v15641*v9221-*p;
+  v17107=v5697*v552-*p;
+  v17497=v892*v7509-*p;
+  v9726=v11157*v15740-*p;
+  v5269=v5001*v210-*p;
+  v2385=v3930*v10552-*p;
+  v4519=v2540*v19183-*p;
+  v10974=v19707*v3992-*p;
+  v5932=v19143*v12902-*p;
+  v6723=v253*v8616-*p;
+  v6137=v11564*v2416-*p;
+  v17357=v2770*v4735-*p;
+  v3560=v8461*v8497-*p;
+  v2220=v4136*v13615-*p;
+  v6244=v1773*v10840-*p;
+  v3774=v9115*v2286-*p;
+  v15258=v5614*v7445-*p;
+  v8044=v18056*v11016-*p;
+  v15379=v19926*v5699-*p;
+  v13901=v15898*v2843-*p;
+  v16769=v11805*v3795-*p;
+  v3856=v17494*v5561-*p;
+  v15991=v7565*v4546-*p;
+  v7104=v13492*v6968-*p;
+  v12795=v16646*v18846-*p;
+  v4221=v12753*v13490-*p;
+  v17652=v9731*v1662-*p;
+  v4141=v7880*v8319-*p;
+  v2183=v16938*v11516-*p;
+  v9350=v18152*v19822-*p;
+  v4732=v2990*v17676-*p;
+  v9900=v4089*v18798-*p;
+  v11093=v19168*v1276-*p;
+  v13217=v18106*v4520-*p;
+  v8192=v17989*v9217-*p;
+  v15600=v10780*v8667-*p;
+  v19354=v13640*v9879-*p;
+  v17893=v3937*v4687-*p;
+  v2325=v6913*v12092-*p;
+  v9024=v9915*v18129-*p;
+  v17571=v2834*v13435-*p;
+  v9877=v9052*v16287-*p;
+  v3703=v9509*v15906-*p;
+  v18856=v19420*v17749-*p;
+  v13196=v19829*v13152-*p;
+  v10282=v2609*v13378-*p;
+  v13304=v5302*v2478-*p;
+  v2245=v12369*v15547-*p;
+  v15697=v10098*v17942-*p;
+  v5701=v5259*v7518-*p;
+  v1769=v7184*v18645-*p;
+  v7233=v5987*v17727-*p;
+  v3981=v11648*v19506-*p;
+  v12163=v17317*v4162-*p;
+  v8321=v5627*v1541-*p;
+  v8927=v17056*v8394-*p;
+  v10202=v18966*v17387-*p;
+  v14956=v7872*v3487-*p;
+  v13463=v3405*v9059-*p;
+  v12504=v3869*v9921-*p;
+  v10048=v1558*v18156-*p;
+  v6149=v12378*v11098-*p;
+  v16926=v9890*v5275-*p;
+  v14260=v10592*v7931-*p;
+  v5339=v11969*v1578-*p;
+  v7076=v4300*v4986-*p;
+  v11742=v17650*v9927-*p;
+  v1874=v15144*v15333-*p;
+  v8324=v10559*v2614-*p;
+  v6252=v7154*v1708-*p;
+  v13320=v8317*v15770-*p;
+  v8421=v16405*v14571-*p;
+  v18475=v1091*v6677-*p;
+  v9012=v9521*v8474-*p;
+  v1107=v6287*v6191-*p;
+  v7975=v14061*v6438-*p;
+  v1539=v11364*v7930-*p;
+  v15954=v9516*v16919-*p;
+  v12362=v10118*v1886-*p;
+  v1521=v10700*v8974-*p;
+  v4136=v7946*v19964-*p;
+  v5511=v16282*v16244-*p;
+  v4294=v13846*v9418-*p;
+  v8501=v2693*v12799-*p;
+  v15791=v1064*v5850-*p;
+  v957=v10676*v9723-*p;
+  v3897=v9615*v6997-*p;
+  v10012=v4703*v814-*p;
+  v10027=v18251*v15561-*p;
+  v5881=v18782*v11807-*p;
+  v19947=v14439*v882-*p;
+  v1280=v11283*v16773-*p;
+  v9006=v5016*v19229-*p;
+  v14301=v5334*v6842-*p;
+  v2323=v13451*v1492-*p;
+  v19779=v17228*v9704-*p;
+  v7963=v5603*v1565-*p;
+  v18577=v18743*v2539-*p;
+  v16049=v16246*v2248-*p;
+  v13139=v5226*v9319-*p;
+  v14205=v13830*v6134-*p;
+  v19634=v1429*v6760-*p;
+  v1170=v2592*v12823-*p;
+  v15871=v6039*v10298-*p;
+  v14402=v7735*v19017-*p;
+  v15813=v19822*v15429-*p;
+  v1825=v3049*v17245-*p;
+  v9313=v378*v17312-*p;
+  v10591=v11250*v8757-*p;
+  v3777=v3343*v14638-*p;
+  v15331=v19720*v14884-*p;
+  v11434=v17883*v8786-*p;
+  v10376=v17775*v3725-*p;
+  v8099=v19599*v17522-*p;
+  v1818=v8415*v13694-*p;
+  v16798=v7229*v18264-*p;
+  v124=v17014*v19391-*p;
+  v11769=v1099*v15029-*p;
+  v5258=v13572*v5829-*p;
+  v18005=v18189*v338-*p;
+  v5114=v10418*v9104-*p;
+  v19378=v9620*v15285-*p;
+  v12193=v3604*v11924-*p;
+  v5486=v19666*v7956-*p;
+  v13358=v18765*v5548-*p;
+  v17744=v17146*v19510-*p;
+  v19728=v4004*v8536-*p;
+  v6312=v19062*v10436-*p;
+  v6476=v16819*v15873-*p;
+  v14653=v12988*v6039-*p;
+  v13031=v11220*v11134-*p;
+  v2501=v12519*v11428-*p;
+  v16769=v16966*v4637-*p;
+  v19251=v18131*v1003-*p;
+  v18740=v9809*v15650-*p;
+  v3726=v16540*v1180-*p;
+  v14165=v12054*v18061-*p;
+  v2740=v3558*v10616-*p;
+  v9244=v19050*v18565-*p;
+  v6828=v5956*v579-*p;
+  v15471=v15724*v9890-*p;
+  v5715=v902*v13468-*p;
+  v12490=v18777*v1254-*p;
+  v14792=v3265*v6936-*p;
+  v12588=v4175*v19260-*p;
+  v6699=v15978*v17043-*p;
+  v5284=v12755*v7932-*p;
+  v14704=v10730*v17529-*p;
+  v2496=v13291*v18292-*p;
+  v7662=v7849*v3101-*p;
+  v4537=v7141*v17542-*p;
+  v13848=v6758*v3058-*p;
+  v16085=v6146*v16798-*p;
+  v9098=v8646*v17413-*p;
+  v12291=v16387*v10091-*p;
+  v1618=v2987*v15412-*p;
+  v14134=v10607*v7453-*p;
+  v7706=v5597*v11237-*p;
+  v9860=v3766*v3586-*p;
+  v15216=v16566*v10491-*p;
+  v8793=v13854*v9891-*p;
+  v10180=v19756*v664-*p;
+  v4185=v14368*v5994-*p;
+  v4339=v17309*v17553-*p;
+  v2184=v8160*v11438-*p;
+  v8655=v18079*v10378-*p;
+  v15025=v17451*v19273-*p;
+  v16838=v11768*v7335-*p;
+  v18434=v715*v19647-*p;
+  v10570=v6758*v5486-*p;
+  v15762=v10378*v11709-*p;
+  v16109=v10742*v13916-*p;
+  v5425=v6532*v2820-*p;
+  v9437=v59*v16294-*p;
+  v8378=v14532*v7637-*p;
+  v8846=v15042*v11304-*p;
+  v2598=v17802*v785-*p;
+  v10976=v10575*v19743-*p;
+  v13304=v1197*v11313-*p;
+  v10127=v2133*v17473-*p;
+  v1483=v12542*v5085-*p;
+  v4808=v5671*v6849-*p;
+  v3797=v3007*v5899-*p;
+  v6856=v12475*v8036-*p;
+  v13993=v3700*v1531-*p;
+  v16478=v11498*v13842-*p;
+  v14689=v1621*v14816-*p;
+  v11829=v15897*v6757-*p;
+  v17247=v12512*v9487-*p;
+  v2832=v10999*v7221-*p;
+  v1420=v17453*v2825-*p;
+  v6633=v489*v5761-*p;
+  v10177=v16564*v6330-*p;
+  v6647=v15527*v5341-*p;
+  v15487=v9093*v15941-*p;
+  v13328=v2716*v15758-*p;
+  v9587=v3231*v19767-*p;
+  v13449=v11581*v7755-*p;
+  v11655=v16983*v632-*p;
+  v10547=v12842*v4366-*p;
+  v4022=v10148*v10668-*p;
+  v3215=v6947*v1619-*p;
+  v133=v18179*v16075-*p;
+  v3887=v15043*v1468-*p;
+  v9950=v10101*v19113-*p;
+  v17160=v10081*v11177-*p;
+  v12315=v17130*v2862-*p;
+  v10773=v3444*v17384-*p;
+  v18490=v15914*v12307-*p;
+  v7549=v9911*v12791-*p;
+  v2534=v2751*v18645-*p;
+  v1319=v16520*v3129-*p;
+  v19167=v3677*v3467-*p;
+  v3967=v5731*v2898-*p;
+  v19543=v16113*v1281-*p;
+  v2880=v18395*v1125-*p;
+  v18883=v13215*v12322-*p;
+  v9189=v10656*v6761-*p;
+  v8466=v12734*v3249-*p;
+  v973=v14304*v16282-*p;
+  v17750=v883*v8472-*p;
+  v11735=v13482*v4588-*p;
+  v9842=v1514*v6460-*p;
+  v17639=v10729*v15584-*p;
+  v6419=v17688*v15789-*p;
+  v19077=v19568*v15672-*p;
+  v11726=v14950*v10222-*p;
+  v7376=v4840*v19265-*p;
+  v2020=v282*v9711-*p;
+  v18274=v14885*v5067-*p;
+  v11045=v18203*v18262-*p;
+  v6999=v8*v13009-*p;
+  v3340=v19143*v17368-*p;
+  v5114=v5820*v3323-*p;
+  v7861=v11094*v17779-*p;
+  v4113=v9413*v2135-*p;
+  v6522=v16182*v3899-*p;
+  v336=v2612*v4924-*p;
+  v19513=v3551*v2131-*p;
+  v4812=v1518*v1384-*p;
+  v15292=v14143*v6956-*p;
+  v7745=v5933*v8714-*p;
+  v16961=v19477*v12161-*p;
+  v4725=v8304*v7245-*p;
+  v10820=v17343*v8302-*p;
+  v10266=v15780*v4135-*p;
+  v11285=v17924*v3635-*p;
+  v6259=v17576*v19362-*p;
+  v8558=v5939*v11401-*p;
+  v16377=v6504*v16631-*p;
+  v9153=v14955*v8675-*p;
+  v11856=v19944*v16919-*p;
+  v14379=v3192*v154-*p;
+  v19429=v18026*v2153-*p;
+  v11225=v1556*v10116-*p;
+  v11875=v6293*v5186-*p;
+  v2963=v550*v9882-*p;
+  v5127=v12708*v4979-*p;
+  v10016=v2*v3706-*p;
+  v19381=v7129*v12756-*p;
+  v13668=v15337*v1449-*p;
+  v3219=v9775*v14430-*p;
+  v9188=v781*v14314-*p;
+  v8529=v9648*v19142-*p;
+  v12749=v13172*v12194-*p;
+  v7193=v5065*v7953-*p;
+  v9317=v17675*v15782-*p;
+  v17180=v2493*v13247-*p;
+  v7429=v1598*v7870-*p;
+  v1879=v9958*v5682-*p;
+  v17562=v1175*v3280-*p;
+  v10361=v9557*v1550-*p;
+  v13461=v6362*v5041-*p;
+  v9176=v1148*v9324-*p;
+  v5704=v19417*v9498-*p;
+  v18439=v13215*v1002-*p;
+  v9906=v8492*v11667-*p;
+  v16419=v16676*v16385-*p;
+  v4055=v10714*v7431-*p;
+  v2358=v1953*v2117-*p;
+  v12591=v6227*v10150-*p;
+  v11905=v16633*v5724-*p;
+  v13550=v14975*v12047-*p;
+  v9416=v5185*v12392-*p;
+  v5566=v10377*v5335-*p;
+  v10324=v3679*v6219-*p;
+  v16542=v5489*v16832-*p;
+  v15171=v3045*v14682-*p;
+  v13076=v8004*v4799-*p;
+  v19978=v1008*v15142-*p;
+  v3391=v16117*v3745-*p;
+  v2951=v14264*v17068-*p;
+  v13717=v10696*v6637-*p;
+  v13639=v16056*v16977-*p;
+  v6812=v2184*v7378-*p;
+  v673=v15032*v1603-*p;
+  v10798=v13082*v3281-*p;
+  v3168=v6262*v5903-*p;
+  v2279=v5779*v3921-*p;
+  v4311=v10865*v16954-*p;
+  v14661=v15217*v9891-*p;
+  v426=v4418*v11710-*p;
+  v12277=v18074*v375-*p;
+  v1600=v16333*v382-*p;
+  v12314=v9032*v3688-*p;
+  v17645=v11058*v1732-*p;
+  v11209=v4117*v7294-*p;
+  v17026=v10374*v6517-*p;
+  v13347=v19625*v1043-*p;
+  v7398=v10836*v5070-*p;
+  v4752=v13348*v19263-*p;
+  v12987=v1397*v14622-*p;
+  v15529=v7699*v341-*p;
+  v7805=v18136*v16767-*p;
+  v4857=v7902*v15568-*p;
+  v17412=v19521*v9535-*p;
+  v17330=v10258*v19821-*p;
+  v4806=v4498*v13811-*p;
+  v9290=v19922*v7748-*p;
+  v3256=v501*v12689-*p;
+  v12343=v4228*v11485-*p;
+  v16925=v2282*v7173-*p;
+  v8=v16606*v12589-*p;
+  v12323=v12350*v6375-*p;
+  v3491=v11750*v7693-*p;
+  v18103=v11016*v14897-*p;
+  v14521=v19455*v1737-*p;
+  v10568=v19611*v19725-*p;
+  v12494=v6135*v11923-*p;
+  v14000=v13176*v12523-*p;
+  v14556=v16658*v8747-*p;
+  v6389=v15340*v9028-*p;
+  v11003=v19790*v17986-*p;
+  v8595=v16919*v4821-*p;
+  v1450=v13017*v12961-*p;
+  v11105=v17160*v10889-*p;
+  v4338=v17423*v8369-*p;
+  v18987=v14923*v14242-*p;
+  v7947=v14517*v18585-*p;
+  v17216=v11766*v330-*p;
+  v19422=v10946*v9200-*p;
+  v4042=v2596*v9416-*p;
+  v5464=v4593*v3125-*p;
+  v5049=v8238*v17741-*p;
+  v15482=v16751*v5220-*p;
+  v1906=v10001*v7228-*p;
+  v16296=v5481*v15191-*p;
+  v267=v17696*v495-*p;
+  v14104=v11934*v3528-*p;
+  v14137=v18543*v13826-*p;
+  v17255=v5931*v8508-*p;
+  v4803=v5464*v11282-*p;
+  v8749=v10396*v2884-*p;
+  v8438=v14790*v4376-*p;
+  v663=v12129*v16269-*p;
+  v5776=v342*v19253-*p;
+  v12144=v3662*v16319-*p;
+  v19176=v9499*v4172-*p;
+  v1017=v4301*v8832-*p;
+  v521=v11880*v11549-*p;
+  v5753=v2444*v5386-*p;
+  v19395=v17636*v16368-*p;
+  v1855=v1178*v5733-*p;
+  v4048=v1276*v12486-*p;
+  v18125=v15863*v2635-*p;
+  v10747=v16409*v11442-*p;
+  v8182=v12735*v1930-*p;
+  v8160=v6899*v6837-*p;
+  v14127=v4292*v10444-*p;
+  v14226=v11825*v7408-*p;
+  v15219=v13357*v4047-*p;
+  v9947=v17024*v15221-*p;
+  v19949=v10100*v12136-*p;
+  v9995=v7054*v13088-*p;
+  v6621=v5573*v1275-*p;
+  v46=v10212*v17457-*p;
+  v2936=v5128*v1010-*p;
+  v19924=v6122*v17727-*p;
+  v18927=v4293*v9394-*p;
+  v19250=v18201*v9094-*p;
+  v10816=v8513*v10143-*p;
+  v8195=v8497*v9381-*p;
+  v11134=v19652*v5733-*p;
+  v16188=v19362*v10226-*p;
+  v277=v1667*v10358-*p;
+  v19333=v2543*v17065-*p;
+  v18598=v5097*v19167-*p;
+  v11314=v12663*v14581-*p;
+  v12358=v309*v2162-*p;
+  v16831=v9606*v14642-*p;
+  v17403=v1706*v15684-*p;
+  v6101=v13457*v12753-*p;
+  v8128=v15777*v17618-*p;
+  v11576=v9417*v14732-*p;
+  v12334=v12626*v3098-*p;
+  v12949=v10227*v16400-*p;
+  v16728=v16732*v17285-*p;
+  v19871=v12623*v1783-*p;
+  v1967=v8196*v14674-*p;
+  v8422=v1608*v1929-*p;
+  v16018=v13867*v13952-*p;
+  v12633=v10318*v11685-*p;
+  v9199=v18454*v14188-*p;
+  v14341=v15156*v1453-*p;
+  v15845=v12285*v9743-*p;
+  v19994=v8500*v15481-*p;
+  v125=v19211*v15995-*p;
+  v18368=v6697*v19057-*p;
+  v628=v13184*v15840-*p;
+  v10576=v12798*v4624-*p;
+  v7316=v5853*v14882-*p;
+  v2892=v6794*v9189-*p;
+  v18056=v4033*v4613-*p;
+  v16464=v4417*v17904-*p;
+  v2919=v15274*v1010-*p;
+  v8652=v19324*v2556-*p;
+  v18585=v9288*v11535-*p;
+  v17656=v7389*v890-*p;
+  v19804=v4650*v5954-*p;
+  v2973=v2119*v4782-*p;
+  v16931=v11330*v13572-*p;
+  v10948=v10655*v2427-*p;
+  v9146=v6175*v14388-*p;
+  v12802=v10012*v13940-*p;
+  v9921=v18328*v19334-*p;
+  v5629=v15556*v552-*p;
+  v8138=v2744*v19644-*p;
+  v13751=v19777*v8439-*p;
+  v19455=v2056*v5408-*p;
+  v6511=v6166*v7125-*p;
+  v14807=v14467*v18269-*p;
+  v2179=v8314*v1464-*p;
+  v6953=v6673*v2944-*p;
+  v13920=v485*v3229-*p;
+  v1239=v10619*v5141-*p;
+  v1337=v14302*v8625-*p;
+  v16120=v4319*v16709-*p;
+  v19955=v2449*v6576-*p;
+  v16225=v11175*v17239-*p;
+  v19394=v16730*v3749-*p;
+  v948=v1971*v13711-*p;
+  v13912=v850*v12266-*p;
+  v7225=v19907*v4261-*p;
+  v15549=v11793*v1667-*p;
+  v2953=v4360*v16034-*p;
+  v16093=v4777*v8517-*p;
+  v4386=v15401*v1640-*p;
+  v3930=v112*v3294-*p;
+  v18576=v14003*v17198-*p;
+  v6697=v364*v18873-*p;
+  v13743=v1449*v11844-*p;
+  v6888=v12665*v17292-*p;
+  v13609=v14008*v2331-*p;
+  v18646=v17667*v1833-*p;
+  v18630=v4152*v18121-*p;
+  v537=v19216*v5734-*p;
+  v10269=v16910*v18697-*p;
+  v15229=v2486*v16629-*p;
+  v11367=v16934*v2691-*p;
+  v6410=v12123*v15054-*p;
+  v3990=v10185*v7146-*p;
+  v6698=v3495*v6441-*p;
+  v16565=v15401*v1840-*p;
+  v1872=v6822*v16909-*p;
+  v10475=v15301*v9367-*p;
+  v18840=v1064*v2530-*p;
+  v9017=v8369*v9396-*p;
+  v16941=v17063*v1440-*p;
+  v7846=v18772*v7853-*p;
+  v12184=v10746*v12699-*p;
+  v5194=v16648*v2500-*p;
+  v6617=v7915*v18501-*p;
+  v439=v14418*v10987-*p;
+  v16079=v14538*v11851-*p;
+  v8161=v18039*v19211-*p;
+  v528=v16942*v4864-*p;
+  v3850=v11846*v17677-*p;
+  v6670=v14862*v16725-*p;
+  v9875=v17173*v13594-*p;
+  v16423=v16154*v8625-*p;
+  v10138=v6040*v11833-*p;
+  v5866=v7859*v12783-*p;
+  v5838=v8792*v4463-*p;
+  v4094=v2508*v6295-*p;
+  v15=v18023*v15931-*p;
+  v108=v11809*v1801-*p;
+  v1686=v7670*v12656-*p;
+  v19089=v18853*v12718-*p;
+  v991=v4913*v19467-*p;
+  v19750=v19551*v4644-*p;
+  v363=v12787*v8990-*p;
+  v1964=v4177*v7299-*p;
+  v17177=v1055*v2830-*p;
+  v9523=v17922*v19617-*p;
+  v18058=v14698*v12945-*p;
+  v12856=v5985*v12339-*p;
+  v10296=v11699*v2025-*p;
+  v11917=v369*v17995-*p;
+  v16318=v9569*v5035-*p;
+  v3112=v5715*v18676-*p;
+  v17351=v146*v13090-*p;
+  v13265=v19204*v9778-*p;
+  v4564=v158*v18477-*p;
+  v12505=v5339*v10063-*p;
+  v11761=v1889*v8275-*p;
+  v8787=v16167*v15658-*p;
+  v8761=v7335*v9951-*p;
+  v10790=v445*v6788-*p;
+  v5771=v10370*v8190-*p;
+  v12239=v11329*v12391-*p;
+  v16848=v11269*v19024-*p;
+  v6483=v2196*v999-*p;
+  v17921=v9660*v5094-*p;
+  v11373=v19547*v5975-*p;
+  v17125=v8255*v19710-*p;
+  v948=v18408*v2229-*p;
+  v1037=v14864*v15839-*p;
+  v11850=v15771*v9212-*p;
+  v1859=v15236*v16040-*p;
+  v14390=v8082*v3105-*p;
+  v17268=v18592*v1009-*p;
+  v9111=v6771*v6454-*p;
+  v922=v13523*v18497-*p;
+  v4253=v9686*v8886-*p;
+  v6225=v2883*v4835-*p;
+  v11443=v5584*v930-*p;
+  v42=v7922*v6051-*p;
+  v6452=v10503*v4036-*p;
+  v16669=v450*v2016-*p;
+  v2355=v11862*v12228-*p;
+  v15185=v13834*v7102-*p;
+  v2449=v19999*v962-*p;
+  v17887=v4313*v2865-*p;
+  v193=v1266*v9323-*p;
+  v10435=v8491*v17361-*p;
+  v12973=v16862*v16182-*p;
+  v13354=v3983*v5822-*p;
+  v17639=v15284*v8682-*p;
+  v7103=v530*v12183-*p;
+  v18220=v315*v857-*p;
+  v18934=v9156*v19049-*p;
+  v16651=v9696*v628-*p;
+  v16128=v12706*v6974-*p;
+  v2530=v6504*v19284-*p;
+  v19320=v6119*v4769-*p;
+  v19731=v4597*v13456-*p;
+  v10087=v10747*v4134-*p;
+  v7290=v9728*v8413-*p;
+  v4396=v12883*v13805-*p;
+  v2817=v6512*v4304-*p;
+  v19452=v19527*v15302-*p;
+  v6988=v3965*v13194-*p;
+  v10991=v9408*v3199-*p;
+  v7530=v16718*v2675-*p;
+  v3323=v11042*v9875-*p;
+  v6740=v6902*v14362-*p;
+  v13163=v3956*v9286-*p;
+  v10768=v3663*v14630-*p;
+  v16244=v15677*v13709-*p;
+  v7024=v43*v497-*p;
+  v18506=v301*v16492-*p;
+  v2672=v2017*v15049-*p;
+  v12933=v3842*v12935-*p;
+  v8006=v4035*v3151-*p;
+  v4170=v14525*v14288-*p;
+  v5956=v1683*v9506-*p;
+  v6974=v19415*v3584-*p;
+  v1562=v10000*v3565-*p;
+  v3167=v14449*v4003-*p;
+  v19264=v13447*v1641-*p;
+  v9540=v7406*v13416-*p;
+  v5677=v15039*v13414-*p;
+  v10126=v15197*v1428-*p;
+  v13994=v5314*v2449-*p;
+  v1933=v15005*v1031-*p;
+  v13916=v2558*v1273-*p;
+  v18426=v4868*v4115-*p;
+  v8978=v11988*v5806-*p;
+  v4980=v11940*v13094-*p;
+  v15473=v3249*v16281-*p;
+  v15928=v15197*v4493-*p;
+  v15657=v4421*v14446-*p;
+  v5119=v5302*v11311-*p;
+  v7694=v10665*v16476-*p;
+  v11366=v9597*v18425-*p;
+  v7169=v13777*v11414-*p;
+  v17920=v18559*v15007-*p;
+  v5102=v14429*v7050-*p;
+  v8548=v5058*v11698-*p;
+  v2535=v18551*v3396-*p;
+  v9636=v2277*v17359-*p;
+  v10482=v12359*v5743-*p;
+  v17306=v700*v8880-*p;
+  v8873=v6891*v19189-*p;
+  v12287=v10201*v18399-*p;
+  v16525=v15407*v6989-*p;
+  v11115=v17522*v1041-*p;
+  v8010=v8464*v15769-*p;
+  v3594=v3521*v17596-*p;
+  v2943=v191*v9743-*p;
+  v7966=v14047*v17631-*p;
+  v9838=v5807*v407-*p;
+  v10299=v2278*v15406-*p;
+  v5539=v12222*v9706-*p;
+  v9756=v5846*v7533-*p;
+  v14023=v18583*v9455-*p;
+  v10398=v15103*v15996-*p;
+  v9938=v15595*v7664-*p;
+  v14022=v19162*v7660-*p;
+  v2758=v3168*v2000-*p;
+  v6110=v10254*v4280-*p;
+  v8439=v4348*v3260-*p;
+  v2696=v6700*v9123-*p;
+  v15481=v7752*v13685-*p;
+  v1618=v11944*v6105-*p;
+  v19129=v18567*v3159-*p;
+  v7825=v16355*v11598-*p;
+  v15630=v15507*v840-*p;
+  v14059=v15987*v10688-*p;
+  v8000=v7728*v135-*p;
+  v2040=v14266*v14581-*p;
+  v3789=v11901*v15791-*p;
+  v784=v16822*v19625-*p;
+  v1015=v805*v18846-*p;
+  v14060=v15493*v15721-*p;
+  v15720=v6572*v19254-*p;
+  v13882=v19648*v8437-*p;
+  v6374=v14698*v9303-*p;
+  v12126=v4055*v6621-*p;
+  v7667=v4560*v2815-*p;
+  v1081=v6645*v9911-*p;
+  v11321=v11008*v4237-*p;
+  v521=v3374*v893-*p;
+  v15592=v8147*v18536-*p;
+  v4633=v7171*v13344-*p;
+  v18096=v1608*v10200-*p;
+  v8802=v19961*v288-*p;
+  v9010=v11127*v6140-*p;
+  v4364=v380*v17528-*p;
+  v11903=v8126*v10102-*p;
+  v13507=v12935*v16964-*p;
+  v1846=v13009*v11503-*p;
+  v12306=v1515*v3169-*p;
+  v4868=v18765*v10431-*p;
+  v17302=v16672*v11811-*p;
+  v6406=v16250*v1921-*p;
+  v18867=v16520*v14570-*p;
+  v6054=v9666*v5270-*p;
+  v3145=v2101*v17439-*p;
+  v12609=v19838*v19852-*p;
+  v18008=v7606*v10612-*p;
+  v2577=v16241*v14740-*p;
+  v7632=v16494*v1770-*p;
+  v2241=v34*v13467-*p;
+  v13978=v3555*v10196-*p;
+  v10810=v6326*v6940-*p;
+  v5221=v16639*v10480-*p;
+  v19693=v9430*v4383-*p;
+  v1969=v13126*v19671-*p;
+  v16097=v16944*v18828-*p;
+  v16131=v2144*v17100-*p;
+  v13926=v13951*v14766-*p;
+  v12358=v11292*v10932-*p;
+  v17769=v410*v4855-*p;
+  v9553=v3849*v14077-*p;
+  v18841=v772*v999-*p;
+  v2562=v11432*v3229-*p;
+  v4649=v12422*v1905-*p;
+  v12743=v7901*v18226-*p;
+  v14054=v5410*v3307-*p;
+  v17274=v17481*v9284-*p;
+  v14639=v1011*v8120-*p;
+  v18779=v14110*v10504-*p;
+  v17859=v12482*v14358-*p;
+  v2369=v4755*v1307-*p;
+  v12148=v13747*v11614-*p;
+  v3717=v6725*v2860-*p;
+  v19898=v9331*v15147-*p;
+  v4761=v8587*v4185-*p;
+  v8594=v7344*v1433-*p;
+  v13384=v10095*v11973-*p;
+  v13584=v14111*v9273-*p;
+  v1026=v18123*v5191-*p;
+  v19620=v16537*v17167-*p;
+  v11731=v8962*v9261-*p;
+  v16847=v18995*v16031-*p;
+  v15852=v6359*v7621-*p;
+  v11893=v4477*v10086-*p;
+  v6285=v9796*v7908-*p;
+  v18902=v1677*v11006-*p;
+  v14912=v14849*v1056-*p;
+  v19086=v4692*v1801-*p;
+  v6447=v16994*v10007-*p;
+  v15729=v3861*v9104-*p;
+  v17484=v18003*v5507-*p;
+  v18130=v11574*v8519-*p;
+  v11543=v496*v11226-*p;
+  v19335=v12211*v19142-*p;
+  v15145=v11325*v4668-*p;
+  v12207=v9723*v10558-*p;
+  v16676=v9038*v19540-*p;
+  v4836=v11982*v1584-*p;
+  v13996=v8493*v15697-*p;
+  v13180=v11072*v7257-*p;
+  v11389=v10750*v18300-*p;
+  v2994=v19885*v11697-*p;
+  v1346=v10496*v11402-*p;
+  v2846=v15106*v3885-*p;
+  v15545=v14331*v9754-*p;
+  v4019=v4559*v849-*p;
+  v15968=v5152*v17288-*p;
+  v4769=v7394*v17906-*p;
+  v11047=v12954*v5335-*p;
+  v9157=v13604*v6597-*p;
+  v16266=v2410*v7014-*p;
+  v1460=v18586*v15435-*p;
+  v7348=v11864*v14641-*p;
+  v14504=v11379*v15865-*p;
+  v17290=v18121*v9515-*p;
+  v6950=v10717*v19020-*p;
+  v17135=v16359*v4306-*p;
+  v3944=v18492*v9579-*p;
+  v4660=v4522*v5549-*p;
+  v912=v11228*v13860-*p;
+  v15452=v19676*v19154-*p;
+  v11328=v16958*v7813-*p;
+  v14651=v2616*v14850-*p;
+  v17440=v9615*v14735-*p;
+  v588=v12688*v15090-*p;
+  v11584=v13422*v16471-*p;
+  v18814=v12298*v18969-*p;
+  v19519=v7872*v13004-*p;
+  v16601=v11293*v16348-*p;
+  v2099=v7814*v19052-*p;
+  v14940=v6643*v4443-*p;
+  v17367=v12929*v18854-*p;
+  v6008=v13326*v19463-*p;
+  v18549=v3195*v3458-*p;
+  v8188=v8439*v3366-*p;
+  v13258=v8627*v7643-*p;
+  v19069=v17828*v8222-*p;
+  v13468=v16588*v1235-*p;
+  v10313=v8228*v8809-*p;
+  v18080=v11087*v10634-*p;
+  v4060=v5519*v5268-*p;
+  v15430=v9743*v15519-*p;
+  v14910=v12768*v9865-*p;
+  v13246=v5183*v12400-*p;
+  v13120=v3960*v1884-*p;
+  v5916=v16707*v3346-*p;
+  v14412=v4205*v10510-*p;
+  v3121=v201*v12949-*p;
+  v13369=v6932*v3675-*p;
+  v1374=v18635*v13821-*p;
+  v8363=v2761*v1287-*p;
+  v7124=v9345*v12647-*p;
+  v12822=v3141*v19812-*p;
+  v15834=v5441*v8223-*p;
+  v6833=v11459*v14076-*p;
+  v6761=v4159*v10688-*p;
+  v2380=v10432*v10093-*p;
+  v3462=v15921*v5723-*p;
+  v4210=v18080*v3750-*p;
+  v4902=v1319*v2506-*p;
+  v3542=v19110*v5980-*p;
+  v6324=v16760*v14759-*p;
+  v17751=v2048*v1702-*p;
+  v6152=v13421*v14613-*p;
+  v14880=v18330*v18710-*p;
+  v5402=v5539*v15987-*p;
+  v9230=v6855*v6956-*p;
+  v4125=v4577*v10246-*p;
+  v9593=v13327*v7865-*p;
+  v7944=v17049*v18841-*p;
+  v12941=v9910*v1270-*p;
+  v18278=v3273*v11317-*p;
+  v13915=v19784*v12774-*p;
+  v13891=v14059*v7263-*p;
+  v6561=v9234*v1159-*p;
+  v10619=v6248*v3406-*p;
+  v13009=v5566*v14618-*p;
+  v8853=v11463*v12157-*p;
+  v11765=v16940*v19021-*p;
+  v4961=v6390*v4238-*p;
+  v3193=v12741*v19802-*p;
+  v14035=v12283*v19168-*p;
+  v10524=v12463*v3220-*p;
+  v13184=v8433*v5838-*p;
+  v14539=v2901*v10941-*p;
+  v14524=v5542*v9102-*p;
+  v11184=v5749*v8807-*p;
+  v1968=v6351*v12888-*p;
+  v18115=v4697*v227-*p;
+  v11193=v5759*v1204-*p;
+  v6170=v5786*v3226-*p;
+  v5717=v14584*v18749-*p;
+  v1936=v3678*v18359-*p;
+  v13089=v11543*v18361-*p;
+  v1548=v16546*v5851-*p;
+  v7342=v4992*v2717-*p;
+  v15109=v18860*v3844-*p;
+  v12435=v3802*v6442-*p;
+  v17044=v12143*v6863-*p;
+  v560=v3464*v19609-*p;
+  v14589=v14783*v16944-*p;
+  v3468=v12057*v18232-*p;
+  v564=v5318*v6200-*p;
+  v16444=v15268*v16598-*p;
+  v16053=v5316*v16972-*p;
+  v15261=v11307*v13911-*p;
+  v11986=v14369*v17795-*p;
+  v10896=v9067*v3906-*p;
+  v6232=v10115*v14517-*p;
+  v3860=v8237*v318-*p;
+  v8424=v3218*v5470-*p;
+  v18318=v1477*v9558-*p;
+  v1341=v13986*v18989-*p;
+  v4939=v15862*v608-*p;
+  v5824=v13535*v70-*p;
+  v13061=v16776*v19291-*p;
+  v10458=v18352*v6379-*p;
+  v9172=v7293*v7291-*p;
+  v19861=v5678*v16450-*p;
+  v1067=v10951*v12809-*p;
+  v6598=v10963*v10469-*p;
+  v10657=v18972*v7259-*p;
+  v7104=v13471*v2143-*p;
+  v15603=v4111*v15075-*p;
+  v10184=v10717*v18139-*p;
+  v13416=v10056*v17451-*p;
+  v6791=v18023*v17613-*p;
+  v6443=v11950*v15958-*p;
+  v11355=v1832*v19651-*p;
+  v10178=v6639*v14843-*p;
+  v17773=v5279*v17475-*p;
+  v6470=v11269*v9418-*p;
+  v2386=v16605*v5954-*p;
+  v13243=v3276*v15185-*p;
+  v525=v4366*v14144-*p;
+  v16828=v5231*v6573-*p;
+  v19767=v5821*v17762-*p;
+  v5015=v855*v14827-*p;
+  v10450=v6570*v1977-*p;
+  v1857=v8755*v13831-*p;
+  v13901=v1514*v14187-*p;
+  v5387=v9781*v4524-*p;
+  v4034=v10369*v6124-*p;
+  v16127=v2229*v1700-*p;
+  v16179=v538*v17274-*p;
+  v8607=v11627*v6149-*p;
+  v17019=v752*v18025-*p;
+  v10553=v7635*v3098-*p;
+  v16322=v7508*v17459-*p;
+  v1659=v19045*v16495-*p;
+  v19372=v6524*v11225-*p;
+  v6881=v13628*v2091-*p;
+  v5430=v5826*v10176-*p;
+  v16540=v19101*v14674-*p;
+  v19422=v19525*v3520-*p;
+  v14765=v8923*v40-*p;
+  v13187=v2635*v6871-*p;
+  v10950=v1248*v5434-*p;
+  v2987=v3597*v2736-*p;
+  v10236=v3564*v14057-*p;
+  v8785=v14598*v6527-*p;
+  v9666=v12831*v8060-*p;
+  v10856=v19130*v19279-*p;
+  v16663=v11927*v2414-*p;
+  v9385=v4923*v993-*p;
+  v15301=v9587*v14679-*p;
+  v9604=v7969*v3944-*p;
+  v15540=v7513*v12831-*p;
+  v5156=v18373*v6724-*p;
+  v2011=v11018*v19616-*p;
+  v3594=v12751*v3504-*p;
+  v16262=v15677*v17369-*p;
+  v15425=v937*v15721-*p;
+  v11703=v1048*v9970-*p;
+  v19789=v1832*v3159-*p;
+  v1773=v14609*v1654-*p;
+  v4965=v3965*v15160-*p;
+  v5034=v15683*v6976-*p;
+  v8827=v11180*v13299-*p;
+  v11296=v2063*v17492-*p;
+  v13519=v11837*v3243-*p;
+  v15953=v10132*v17496-*p;
+  v2320=v5268*v4732-*p;
+  v10544=v14047*v1503-*p;
+  v9247=v5293*v6761-*p;
+  v5315=v9032*v2934-*p;
+  v14031=v2455*v15804-*p;
+  v19632=v5985*v16354-*p;
+  v12529=v9896*v13743-*p;
+  v3200=v4148*v14202-*p;
+  v8961=v12696*v1408-*p;
+  v16900=v17415*v13373-*p;
+  v18806=v11885*v11338-*p;
+  v19830=v8942*v9528-*p;
+  v17409=v8414*v13213-*p;
+  v2252=v18584*v6265-*p;
+  v1992=v11047*v6311-*p;
+  v1160=v8122*v16431-*p;
+  v10490=v8862*v15571-*p;
+  v17675=v6280*v1958-*p;
+  v17469=v5088*v3448-*p;
+  v3593=v11431*v6607-*p;
+  v15638=v13971*v1833-*p;
+  v18010=v3226*v11146-*p;
+  v18987=v18867*v13179-*p;
+  v11518=v15214*v4757-*p;
+  v14140=v4628*v9076-*p;
+  v10501=v19968*v15996-*p;
+  v8061=v19353*v12979-*p;
+  v5168=v18618*v5953-*p;
+  v776=v1689*v11985-*p;
+  v1063=v19334*v14094-*p;
+  v6510=v16089*v9226-*p;
+  v15927=v8286*v19557-*p;
+  v2455=v15070*v7655-*p;
+  v19761=v1867*v16736-*p;
+  v13458=v11723*v5122-*p;
+  v17502=v19075*v15090-*p;
+  v753=v1077*v18192-*p;
+  v18070=v3926*v4881-*p;
+  v15843=v15382*v1177-*p;
+  v17856=v11226*v16087-*p;
+  v18200=v6401*v7097-*p;
+  v3213=v1516*v5117-*p;
+  v7827=v17650*v5343-*p;
+  v14512=v19836*v19934-*p;
+  v16563=v17248*v10948-*p;
+  v4171=v9922*v7258-*p;
+  v12828=v622*v13649-*p;
+  v6390=v13501*v10038-*p;
+  v9531=v1094*v6185-*p;
+  v4419=v14434*v10584-*p;
+  v12249=v8544*v12115-*p;
+  v16734=v1039*v14460-*p;
+  v3624=v419*v11082-*p;
+  v14674=v4395*v18401-*p;
+  v13783=v3592*v17609-*p;
+  v5253=v12214*v19990-*p;
+  v17053=v4608*v14794-*p;
+  v1195=v17427*v19234-*p;
+  v6302=v10420*v17335-*p;
+  v941=v3124*v9479-*p;
+  v3463=v2776*v987-*p;
+  v533=v1938*v13574-*p;
+  v1495=v7628*v7396-*p;
+  v17002=v16508*v13073-*p;
+  v10287=v19564*v16314-*p;
+  v2648=v12471*v11499-*p;
+  v2188=v2176*v5214-*p;
+  v6023=v1135*v9205-*p;
+  v4234=v19925*v1513-*p;
+  v11193=v16351*v4178-*p;
+  v8051=v395*v12685-*p;
+  v16272=v8436*v6430-*p;
+  v17910=v8045*v5117-*p;
+  v16617=v6299*v16455-*p;
+  v9007=v6091*v8778-*p;
+  v19488=v19997*v18140-*p;
+  v10069=v5909*v2683-*p;
+  v16301=v8332*v16114-*p;
+  v3299=v15919*v13681-*p;
+  v4202=v12722*v2115-*p;
+  v11031=v3595*v10074-*p;
+  v5373=v5088*v11925-*p;
+  v7687=v158*v643-*p;
+  v389=v11929*v9219-*p;
+  v495=v18003*v6803-*p;
+  v6798=v12675*v10069-*p;
+  v4371=v6267*v9806-*p;
+  v17295=v894*v12818-*p;
+  v18386=v19118*v8305-*p;
+  v17601=v2997*v18713-*p;
+  v10408=v7049*v16371-*p;
+  v6365=v16435*v7928-*p;
+  v17214=v265*v5531-*p;
+  v10971=v18517*v12935-*p;
+  v3741=v1375*v17216-*p;
+  v6402=v16143*v19583-*p;
+  v3831=v10799*v19610-*p;
+  v8313=v16609*v12043-*p;
+  v1903=v10770*v4941-*p;
+  v11320=v16096*v19200-*p;
+  v2999=v4142*v9395-*p;
+  v18957=v13875*v10688-*p;
+  v12249=v8627*v19267-*p;
+  v18131=v6708*v16698-*p;
+  v5680=v15932*v5835-*p;
+  v9174=v4470*v3445-*p;
+  v2699=v754*v12337-*p;
+  v10938=v8241*v10475-*p;
+  v7882=v17010*v13127-*p;
+  v17329=v8295*v18832-*p;
+  v14947=v16990*v17479-*p;
+  v4611=v12493*v19658-*p;
+  v19893=v7813*v13370-*p;
+  v9304=v827*v2188-*p;
+  v8042=v4728*v17906-*p;
+  v13981=v6856*v18513-*p;
+  v7651=v2344*v14535-*p;
+  v8045=v68*v3555-*p;
+  v14532=v10431*v3242-*p;
+  v13977=v11014*v8778-*p;
+  v4492=v18099*v9042-*p;
+  v18724=v9913*v14693-*p;
+  v17588=v17533*v18276-*p;
+  v12969=v11888*v2606-*p;
+  v8034=v5198*v19590-*p;
+  v4394=v18465*v13388-*p;
+  v8321=v2790*v11600-*p;
+  v1285=v5389*v18820-*p;
+  v7951=v18565*v5617-*p;
+  v17484=v19649*v8610-*p;
+  v14528=v5163*v10433-*p;
+  v10423=v8814*v11422-*p;
+  v11946=v5330*v12710-*p;
+  v1544=v9144*v10158-*p;
+  v1912=v8738*v8931-*p;
+  v12996=v16645*v7448-*p;
+  v12772=v13536*v6148-*p;
+  v17121=v6220*v5863-*p;
+  v11966=v18428*v10809-*p;
+  v16006=v19289*v2372-*p;
+  v15776=v3534*v10541-*p;
+  v7953=v10625*v14415-*p;
+  v6545=v1206*v4604-*p;
+  v16352=v11430*v10717-*p;
+  v1263=v14726*v225-*p;
+  v13915=v3292*v6288-*p;
+  v3230=v2409*v1811-*p;
+  v18115=v5606*v14994-*p;
+  v2564=v19957*v1025-*p;
+  v11135=v19678*v6479-*p;
+  v19213=v17393*v7517-*p;
+  v14383=v12588*v7011-*p;
+  v1850=v13106*v7303-*p;
+  v8850=v15848*v16617-*p;
+  v13555=v18913*v10744-*p;
+  v15122=v5492*v13647-*p;
+  v5208=v18093*v12801-*p;
+  v19302=v12109*v1590-*p;
+  v18266=v14132*v6116-*p;
+  v15051=v15847*v16419-*p;
+  v502=v13807*v9710-*p;
+  v5100=v19989*v3097-*p;
+  v15758=v17360*v4947-*p;
+  v14816=v1110*v10227-*p;
+  v3317=v4662*v1465-*p;
+  v19392=v2655*v5119-*p;
+  v18090=v731*v16483-*p;
+  v19594=v10095*v1902-*p;
+  v14636=v11279*v15499-*p;
+  v16876=v13709*v10099-*p;
+  v14301=v2770*v13067-*p;
+  v7687=v5393*v19573-*p;
+  v8893=v1577*v1209-*p;
+  v3822=v18719*v19693-*p;
+  v516=v14304*v1616-*p;
+  v13916=v3140*v17652-*p;
+  v11813=v5740*v8874-*p;
+  v7538=v18123*v7224-*p;
+  v8113=v1543*v9888-*p;
+  v18020=v12979*v14727-*p;
+  v17322=v13761*v8188-*p;
+  v12823=v13999*v11326-*p;
+  v9734=v8582*v18398-*p;
+  v77=v10896*v1769-*p;
+  v10311=v264*v10583-*p;
+  v12783=v17203*v13645-*p;
+  v5872=v5739*v3353-*p;
+  v15033=v17194*v8573-*p;
+  v18750=v2296*v11606-*p;
+  v11799=v15134*v9032-*p;
+  v12619=v6652*v8518-*p;
+  v6897=v17131*v14901-*p;
+  v5980=v9604*v19073-*p;
+  v7358=v5714*v6758-*p;
+  v7239=v16349*v13899-*p;
+  v8111=v18631*v8594-*p;
+  v10068=v11508*v1035-*p;
+  v9270=v554*v6790-*p;
+  v14357=v668*v4472-*p;
+  v12347=v3746*v2007-*p;
+  v10806=v10514*v1404-*p;
+  v15307=v2423*v14570-*p;
+  v11569=v11635*v929-*p;
+  v17578=v5186*v19378-*p;
+  v4162=v7338*v8663-*p;
+  v14283=v1826*v8970-*p;
+  v2244=v10303*v7098-*p;
+  v8393=v2529*v15370-*p;
+  v6518=v5971*v16147-*p;
+  v18066=v18557*v18003-*p;
+  v5923=v15738*v10314-*p;
+  v7457=v2180*v19642-*p;
+  v18563=v10186*v16713-*p;
+  v12195=v15264*v16173-*p;
+  v1699=v7760*v12240-*p;
+  v3833=v6363*v10067-*p;
+  v17132=v4385*v14103-*p;
+  v6819=v11615*v5998-*p;
+  v19500=v9517*v14255-*p;
+  v7919=v11001*v6250-*p;
+  v2516=v8774*v2851-*p;
+  v2750=v19903*v19619-*p;
+  v5740=v13474*v12591-*p;
+  v7642=v17041*v459-*p;
+  v12861=v7107*v16378-*p;
+  v10163=v7889*v14359-*p;
+  v7199=v19519*v10315-*p;
+  v14669=v8416*v14093-*p;
+  v19727=v5933*v6967-*p;
+  v15757=v17284*v7098-*p;
+  v18196=v10314*v2289-*p;
+  v499=v9949*v7582-*p;
+  v4287=v3358*v14101-*p;
+  v17133=v1027*v6660-*p;
+  v5593=v19912*v5767-*p;
+  v17324=v14686*v5608-*p;
+  v19573=v5544*v9625-*p;
+  v7005=v2175*v14207-*p;
+  v697=v2651*v17402-*p;
+  v18857=v18196*v19300-*p;
+  v18359=v5929*v7001-*p;
+  v18048=v7043*v3693-*p;
+  v8297=v19580*v1115-*p;
+  v17212=v3159*v5963-*p;
+  v35=v4517*v3162-*p;
+  v9081=v3848*v3503-*p;
+  v5099=v11696*v13946-*p;
+  v19866=v2790*v12358-*p;
+  v747=v3725*v19562-*p;
+  v7937=v12216*v7878-*p;
+  v8159=v8821*v18060-*p;
+  v572=v2362*v6763-*p;
+  v15328=v14274*v10887-*p;
+  v10375=v10273*v4353-*p;
+  v9759=v14502*v14043-*p;
+  v19398=v19356*v19822-*p;
+  v8084=v12646*v5710-*p;
+  v19754=v14912*v675-*p;
+  v15754=v19442*v8143-*p;
+  v8251=v11777*v17484-*p;
+  v10145=v7470*v3139-*p;
+  v10331=v1797*v13242-*p;
+  v6921=v18587*v13387-*p;
+  v878=v18510*v18619-*p;
+  v2916=v15012*v10221-*p;
+  v19547=v2935*v12017-*p;
+  v5964=v18913*v9317-*p;
+  v9419=v10325*v14225-*p;
+  v1031=v4390*v4142-*p;
+  v19772=v645*v13723-*p;
+  v7896=v7659*v12113-*p;
+  v9962=v12306*v1106-*p;
+  v13834=v5922*v18650-*p;
+  v13870=v13467*v15614-*p;
+  v3143=v17616*v7934-*p;
+  v12389=v2567*v1484-*p;
+  v17665=v10247*v17616-*p;
+  v19787=v19111*v4009-*p;
+  v7681=v14558*v16607-*p;
+  v14138=v8292*v13367-*p;
+  v13573=v13907*v1725-*p;
+  v13898=v19387*v10296-*p;
+  v12147=v7495*v7090-*p;
+  v15849=v13522*v13003-*p;
+  v4053=v11301*v2512-*p;
+  v3259=v9118*v12366-*p;
+  v18137=v4939*v16262-*p;
+  v7888=v5770*v4807-*p;
+  v17494=v8854*v17164-*p;
+  v9459=v751*v18861-*p;
+  v2013=v8823*v987-*p;
+  v12088=v7017*v412-*p;
+  v15173=v2288*v3946-*p;
+  v11838=v14925*v9663-*p;
+  v11244=v9889*v5772-*p;
+  v10469=v16420*v952-*p;
+  v14972=v3683*v11159-*p;
+  v12636=v16021*v6044-*p;
+  v404=v14739*v18566-*p;
+  v16457=v588*v11653-*p;
+  v9177=v19260*v4521-*p;
+  v4024=v8887*v11776-*p;
+  v8563=v6084*v441-*p;
+  v8673=v16380*v15605-*p;
+  v13362=v7497*v1237-*p;
+  v9700=v8317*v13841-*p;
+  v4147=v14718*v16742-*p;
+  v1666=v9161*v11756-*p;
+  v17577=v12032*v13488-*p;
+  v10719=v4167*v5258-*p;
+  v16373=v11473*v3603-*p;
+  v6520=v14662*v6894-*p;
+  v12046=v7520*v16554-*p;
+  v13261=v7367*v3580-*p;
+  v16170=v15446*v8661-*p;
+  v4882=v9700*v9373-*p;
+  v11453=v12027*v4333-*p;
+  v4471=v7604*v12805-*p;
+  v13590=v9030*v2207-*p;
+  v15240=v19664*v3901-*p;
+  v9317=v12702*v14214-*p;
+  v16980=v3937*v18164-*p;
+  v9549=v2069*v8731-*p;
+  v13717=v15015*v4579-*p;
+  v11988=v13344*v4529-*p;
+  v4462=v5319*v18430-*p;
+  v3354=v7670*v7316-*p;
+  v15497=v8843*v19189-*p;
+  v14769=v4380*v19202-*p;
+  v7672=v11367*v16506-*p;
+  v15118=v14702*v18526-*p;
+  v15489=v10547*v15377-*p;
+  v9350=v10390*v119-*p;
+  v1772=v17964*v13529-*p;
+  v15017=v2142*v3324-*p;
+  v3654=v2946*v11613-*p;
+  v18447=v5141*v2978-*p;
+  v19390=v17194*v17939-*p;
+  v10961=v7439*v6294-*p;
+  v8893=v9789*v19534-*p;
+  v18873=v16710*v11209-*p;
+  v17084=v12857*v10858-*p;
+  v14836=v10478*v14739-*p;
+  v9099=v417*v7178-*p;
+  v2503=v13790*v10995-*p;
+  v16620=v7469*v15273-*p;
+  v54=v9055*v1707-*p;
+  v15752=v2924*v3091-*p;
+  v1469=v13131*v4092-*p;
+  v8857=v7012*v1611-*p;
+  v12868=v488*v6270-*p;
+  v12363=v3241*v6620-*p;
+  v7467=v4220*v10345-*p;
+  v8617=v9915*v15229-*p;
+  v6062=v3949*v17650-*p;
+  v18712=v3604*v13878-*p;
+  v16375=v11483*v1201-*p;
+  v8751=v6596*v6366-*p;
+  v12644=v9542*v348-*p;
+  v11869=v6236*v4074-*p;
+  v3505=v9575*v15764-*p;
+  v9886=v10224*v854-*p;
+  v7275=v3037*v10321-*p;
+  v1770=v1503*v9188-*p;
+  v2920=v4697*v4363-*p;
+  v4625=v19058*v5178-*p;
+  v10806=v13026*v872-*p;
+  v13=v19564*v6961-*p;
+  v8529=v17529*v1788-*p;
+  v17041=v10396*v17661-*p;
+  v13491=v14471*v19974-*p;
+  v9581=v2923*v9627-*p;
+  v15472=v8531*v14988-*p;
+  v12032=v2871*v16289-*p;
+  v18229=v16979*v18205-*p;
+  v8954=v5559*v4229-*p;
+  v7287=v10150*v12066-*p;
+  v13857=v13473*v17662-*p;
+  v4700=v16392*v6249-*p;
+  v19618=v13715*v8426-*p;
+  v15551=v5649*v2807-*p;
+  v5561=v3252*v7112-*p;
+  v12118=v4774*v767-*p;
+  v3140=v13755*v8789-*p;
+  v10030=v5175*v19840-*p;
+  v13002=v18959*v9822-*p;
+  v16208=v5725*v15224-*p;
+  v5002=v6856*v3369-*p;
+  v5121=v16088*v5227-*p;
+  v9318=v2942*v13399-*p;
+  v1020=v18297*v19396-*p;
+  v16336=v13311*v1545-*p;
+  v17838=v3490*v13420-*p;
+  v4033=v10652*v13528-*p;
+  v14539=v11901*v3003-*p;
+  v10565=v6108*v8873-*p;
+  v4031=v13064*v4459-*p;
+  v8305=v12166*v2359-*p;
+  v2910=v15576*v3114-*p;
+  v12868=v18269*v718-*p;
+  v8051=v13338*v11220-*p;
+  v11823=v18453*v16092-*p;
+  v19802=v3298*v10667-*p;
+  v16032=v596*v10807-*p;
+  v8942=v7881*v10164-*p;
+  v3380=v6306*v418-*p;
+  v6666=v18656*v2470-*p;
+  v18005=v7393*v6260-*p;
+  v17147=v6834*v10666-*p;
+  v8988=v17697*v9745-*p;
+  v2675=v11318*v14802-*p;
+  v13575=v7401*v1251-*p;
+  v14068=v2187*v2919-*p;
+  v14744=v2827*v14852-*p;
+  v9231=v16681*v469-*p;
+  v3937=v2299*v3748-*p;
+  v8584=v5296*v13966-*p;
+  v12459=v19411*v5096-*p;
+  v11010=v4821*v14985-*p;
+  v18148=v18294*v8961-*p;
+  v19331=v17957*v16947-*p;
+  v265=v5812*v4681-*p;
+  v1703=v19169*v7538-*p;
+  v13468=v13586*v12803-*p;
+  v4650=v10025*v11328-*p;
+  v10752=v16750*v9494-*p;
+  v963=v15291*v2231-*p;
+  v19976=v19339*v19221-*p;
+  v16859=v19808*v5540-*p;
+  v18872=v6297*v164-*p;
+  v19999=v1228*v6052-*p;
+  v19050=v14271*v6734-*p;
+  v11277=v16386*v17436-*p;
+  v15817=v16877*v31-*p;
+  v4241=v12555*v7041-*p;
+  v10987=v18892*v814-*p;
+  v6752=v6548*v11353-*p;
+  v9849=v6143*v12155-*p;
+  v1871=v13441*v2736-*p;
+  v13139=v8174*v2188-*p;
+  v15492=v529*v14438-*p;
+  v12330=v814*v2391-*p;
+  v6784=v12298*v3002-*p;
+  v15544=v5114*v13333-*p;
+  v14305=v14292*v18222-*p;
+  v3026=v1811*v12354-*p;
+  v10579=v14454*v165-*p;
+  v12978=v18584*v10703-*p;
+  v18270=v12692*v6550-*p;
+  v643=v6278*v3571-*p;
+  v4462=v16050*v4008-*p;
+  v11030=v8219*v5035-*p;
+  v9674=v15184*v4736-*p;
+  v1015=v10889*v15324-*p;
+  v12489=v14434*v16259-*p;
+  v2781=v15826*v17450-*p;
+  v9368=v19618*v17789-*p;
+  v18024=v15725*v10968-*p;
+  v14161=v4971*v16068-*p;
+  v2121=v16561*v9946-*p;
+  v1598=v8866*v5748-*p;
+  v13835=v11020*v4680-*p;
+  v6687=v4029*v4768-*p;
+  v12429=v7017*v5702-*p;
+  v974=v8977*v11386-*p;
+  v1426=v17443*v16803-*p;
+  v7727=v699*v19980-*p;
+  v9102=v2963*v14897-*p;
+  v19015=v16274*v3870-*p;
+  v5766=v5335*v17387-*p;
+  v4662=v1630*v4770-*p;
+  v7597=v2449*v15235-*p;
+  v16714=v11610*v18323-*p;
+  v10968=v8692*v4178-*p;
+  v15063=v11613*v10446-*p;
+  v4089=v10725*v15677-*p;
+  v6179=v12427*v442-*p;
+  v4312=v16020*v7962-*p;
+  v15478=v7001*v16312-*p;
+  v13922=v7873*v17517-*p;
+  v14264=v3346*v1072-*p;
+  v8233=v19462*v13930-*p;
+  v3800=v3327*v3685-*p;
+  v19220=v16283*v15211-*p;
+  v8552=v17060*v11260-*p;
+  v16710=v19909*v13621-*p;
+  v9719=v12607*v4679-*p;
+  v1036=v8449*v7443-*p;
+  v18509=v5785*v14725-*p;
+  v8404=v17206*v1129-*p;
+  v5160=v5898*v11277-*p;
+  v13415=v9845*v1502-*p;
+  v10408=v18934*v17532-*p;
+  v11350=v1807*v1379-*p;
+  v7069=v3943*v14158-*p;
+  v10885=v6979*v5423-*p;
+  v9011=v10929*v9298-*p;
+  v4194=v744*v4698-*p;
+  v11703=v16306*v1090-*p;
+  v6788=v17671*v3774-*p;
+  v3738=v13839*v8863-*p;
+  v12782=v10777*v1022-*p;
+  v14104=v12608*v6464-*p;
+  v6069=v6469*v3256-*p;
+  v14278=v1471*v6071-*p;
+  v17491=v637*v9494-*p;
+  v253=v1466*v5594-*p;
+  v12993=v14645*v2354-*p;
+  v4051=v6644*v16306-*p;
+  v13978=v11894*v16469-*p;
+  v11405=v19568*v11928-*p;
+  v5138=v4619*v17448-*p;
+  v694=v3884*v15150-*p;
+  v11486=v12288*v2226-*p;
+  v9982=v12841*v16937-*p;
+  v11940=v5399*v11249-*p;
+  v15679=v14161*v5618-*p;
+  v13912=v16339*v502-*p;
+  v11141=v2852*v13332-*p;
+  v8990=v11662*v3645-*p;
+  v14970=v10891*v7502-*p;
+  v15124=v106*v5182-*p;
+  v2948=v12944*v19699-*p;
+  v15194=v1075*v16714-*p;
+  v11321=v1830*v18733-*p;
+  v2053=v8322*v9437-*p;
+  v14269=v15438*v12438-*p;
+  v1709=v1167*v8675-*p;
+  v3326=v11560*v2205-*p;
+  v12793=v6291*v4793-*p;
+  v4627=v7249*v598-*p;
+  v17260=v1376*v6267-*p;
+  v7315=v10061*v14946-*p;
+  v4830=v10645*v11593-*p;
+  v12871=v5856*v3298-*p;
+  v1079=v16471*v8560-*p;
+  v7589=v6750*v16793-*p;
+  v13004=v17884*v11708-*p;
+  v9376=v6105*v7700-*p;
+  v9153=v18389*v2365-*p;
+  v4469=v9215*v3463-*p;
+  v4351=v16704*v3237-*p;
+  v2488=v985*v12288-*p;
+  v12376=v17175*v11229-*p;
+  v14888=v1484*v13754-*p;
+  v907=v6295*v1178-*p;
+  v6456=v3997*v3958-*p;
+  v18913=v14850*v4397-*p;
+  v15042=v8138*v12317-*p;
+  v13167=v1537*v14488-*p;
+  v16563=v9394*v7326-*p;
+  v13243=v14875*v686-*p;
+  v1984=v7581*v5025-*p;
+  v3439=v8957*v18019-*p;
+  v8879=v10290*v16239-*p;
+  v15961=v2772*v15582-*p;
+  v1854=v13580*v17593-*p;
+  v17297=v16018*v8682-*p;
+  v16536=v14634*v18927-*p;
+  v6399=v6416*v2500-*p;
+  v11787=v13933*v18381-*p;
+  v14690=v10221*v17219-*p;
+  v18549=v17817*v18230-*p;
+  v12022=v17828*v2309-*p;
+  v4308=v1509*v14116-*p;
+  v5802=v2875*v18535-*p;
+  v10488=v11569*v16167-*p;
+  v12399=v7622*v6267-*p;
+  v10148=v16823*v3-*p;
+  v4576=v10784*v8455-*p;
+  v8861=v2363*v14332-*p;
+  v3120=v16234*v36-*p;
+  v918=v4676*v19808-*p;
+  v1946=v9814*v2533-*p;
+  v6612=v2423*v3866-*p;
+  v13458=v5788*v15203-*p;
+  v4038=v3442*v17043-*p;
+  v7141=v859*v5827-*p;
+  v11187=v12291*v5907-*p;
+  v14703=v5498*v4286-*p;
+  v6335=v5326*v12985-*p;
+  v18460=v18651*v16002-*p;
+  v7615=v16392*v4721-*p;
+  v6266=v14306*v8441-*p;
+  v5226=v19086*v825-*p;
+  v6052=v4*v1637-*p;
+  v2047=v12668*v14621-*p;
+  v6949=v19845*v17605-*p;
+  v7217=v18637*v6178-*p;
+  v3414=v12633*v19139-*p;
+  v16173=v9456*v15448-*p;
+  v176=v18227*v13855-*p;
+  v6635=v3323*v3207-*p;
+  v15606=v12928*v16466-*p;
+  v15865=v19490*v19420-*p;
+  v2859=v11485*v18565-*p;
+  v7754=v9897*v7113-*p;
+  v11008=v19742*v13965-*p;
+  v19635=v18378*v9682-*p;
+  v11014=v4980*v251-*p;
+  v5665=v8158*v11490-*p;
+  v4402=v16322*v10994-*p;
+  v9978=v8770*v329-*p;
+  v15096=v4103*v19139-*p;
+  v12153=v17325*v18827-*p;
+  v19574=v6135*v13617-*p;
+  v11149=v2434*v2674-*p;
+  v5993=v11084*v15404-*p;
+  v18661=v5101*v14960-*p;
+  v9619=v19030*v8365-*p;
+  v12534=v16763*v6292-*p;
+  v10082=v5151*v8620-*p;
+  v16009=v17062*v16782-*p;
+  v6937=v12464*v7306-*p;
+  v3762=v4592*v5986-*p;
+  v1917=v8929*v2692-*p;
+  v18626=v11499*v8515-*p;
+  v1262=v13606*v10592-*p;
+  v7283=v8584*v12801-*p;
+  v8185=v13837*v2568-*p;
+  v5703=v8477*v14886-*p;
+  v12775=v1085*v18300-*p;
+  v332=v7869*v11505-*p;
+  v5194=v13361*v2188-*p;
+  v13494=v15680*v11175-*p;
+  v19167=v13030*v17444-*p;
+  v19869=v16342*v19340-*p;
+  v14009=v16118*v11746-*p;
+  v11579=v13034*v12491-*p;
+  v1854=v9008*v4078-*p;
+  v9862=v13970*v827-*p;
+  v18510=v15012*v18336-*p;
+  v10328=v11437*v12226-*p;
+  v18551=v18546*v15512-*p;
+  v6377=v19601*v4109-*p;
+  v3229=v12870*v12829-*p;
+  v3964=v1622*v10060-*p;
+  v19505=v3775*v544-*p;
+  v2853=v12851*v11852-*p;
+  v3815=v15994*v7784-*p;
+  v1744=v7595*v8346-*p;
+  v491=v7001*v7742-*p;
+  v668=v6483*v11962-*p;
+  v17382=v13959*v19442-*p;
+  v15065=v1867*v16579-*p;
+  v6390=v1964*v9036-*p;
+  v11215=v13513*v15693-*p;
+  v14188=v5822*v13221-*p;
+  v18314=v4577*v10939-*p;
+  v14568=v17321*v9603-*p;
+  v17814=v19772*v16780-*p;
+  v6159=v12072*v6145-*p;
+  v3793=v8552*v946-*p;
+  v18143=v1902*v18279-*p;
+  v6378=v12356*v14538-*p;
+  v12583=v17754*v1652-*p;
+  v18374=v14454*v16638-*p;
+  v17500=v17851*v13542-*p;
+  v14281=v17584*v17698-*p;
+  v1025=v13129*v14453-*p;
+  v6439=v2393*v10249-*p;
+  v13092=v6656*v2895-*p;
+  v11727=v8202*v11853-*p;
+  v16570=v4197*v16496-*p;
+  v2103=v408*v3377-*p;
+  v1776=v2759*v1060-*p;
+  v2306=v5793*v1983-*p;
+  v16747=v4416*v9548-*p;
+  v17280=v16239*v10539-*p;
+  v776=v17698*v2466-*p;
+  v5868=v10248*v13599-*p;
+  v19315=v8934*v104-*p;
+  v8956=v3468*v2382-*p;
+  v11675=v11850*v147-*p;
+  v17556=v17158*v643-*p;
+  v8463=v4539*v408-*p;
+  v17880=v12902*v18860-*p;
+  v16557=v2651*v16518-*p;
+  v9573=v19090*v2214-*p;
+  v8622=v14411*v42-*p;
+  v14162=v13870*v8943-*p;
+  v13872=v12673*v452-*p;
+  v5016=v1509*v17738-*p;
+  v2736=v1273*v14923-*p;
+  v13512=v13516*v19470-*p;
+  v12501=v9094*v4457-*p;
+  v11307=v2838*v17828-*p;
+  v1067=v12828*v1841-*p;
+  v12460=v19025*v3246-*p;
+  v4545=v2151*v12764-*p;
+  v6533=v13683*v13654-*p;
+  v3292=v17374*v10072-*p;
+  v2611=v3466*v1910-*p;
+  v14084=v6235*v17702-*p;
+  v8334=v19740*v10550-*p;
+  v13822=v17786*v10089-*p;
+  v9236=v2303*v16184-*p;
+  v12247=v8112*v11926-*p;
+  v15816=v9729*v6524-*p;
+  v7426=v10176*v2332-*p;
+  v5517=v17983*v1733-*p;
+  v11759=v7281*v1111-*p;
+  v14601=v8502*v18985-*p;
+  v19695=v6685*v2532-*p;
+  v5829=v8887*v7453-*p;
+  v9417=v4280*v4677-*p;
+  v10370=v5239*v15339-*p;
+  v17667=v12518*v11620-*p;
+  v7528=v2614*v18325-*p;
+  v14711=v4708*v11220-*p;
+  v17527=v10934*v5587-*p;
+  v646=v16916*v5913-*p;
+  v3884=v3067*v15736-*p;
+  v14760=v4963*v3556-*p;
+  v15828=v4084*v5057-*p;
+  v9436=v8002*v9273-*p;
+  v9455=v2371*v4397-*p;
+  v16045=v17481*v17845-*p;
+  v9108=v5390*v10433-*p;
+  v3522=v8039*v12854-*p;
+  v8584=v13077*v9772-*p;
+  v6367=v2417*v6961-*p;
+  v10911=v2470*v1857-*p;
+  v15021=v16222*v1152-*p;
+  v4141=v18744*v3527-*p;
+  v9819=v19116*v19410-*p;
+  v7218=v3262*v8161-*p;
+  v10402=v3584*v15299-*p;
+  v10853=v17731*v15842-*p;
+  v6554=v19904*v180-*p;
+  v6820=v10000*v18871-*p;
+  v17788=v13119*v13589-*p;
+  v13885=v19947*v14936-*p;
+  v15234=v17233*v2576-*p;
+  v12075=v3378*v8519-*p;
+  v18768=v18213*v3671-*p;
+  v9980=v7080*v10727-*p;
+  v5015=v17671*v5016-*p;
+  v17212=v7080*v692-*p;
+  v1153=v4435*v2380-*p;
+  v14823=v11698*v19256-*p;
+  v3487=v18570*v10314-*p;
+  v15765=v6037*v9317-*p;
+  v11375=v5055*v11861-*p;
+  v3017=v15333*v18782-*p;
+  v12476=v16557*v11902-*p;
+  v16393=v13427*v9340-*p;
+  v16245=v10878*v1320-*p;
+  v608=v6436*v605-*p;
+  v7504=v5951*v19629-*p;
+  v2875=v16157*v2846-*p;
+  v12503=v9336*v13035-*p;
+  v6431=v12776*v3230-*p;
+  v12706=v17229*v12638-*p;
+  v16391=v15600*v2120-*p;
+  v13382=v43*v1034-*p;
+  v10646=v19942*v3076-*p;
+  v16797=v5975*v890-*p;
+  v7242=v9797*v14512-*p;
+  v6183=v7474*v6771-*p;
+  v16250=v19286*v16917-*p;
+  v5440=v1759*v11472-*p;
+  v10404=v12181*v18358-*p;
+  v6654=v15766*v6675-*p;
+  v14209=v4436*v18388-*p;
+  v12313=v19616*v16004-*p;
+  v2393=v14843*v11180-*p;
+  v2135=v11265*v201-*p;
+  v6088=v8106*v1663-*p;
+  v19557=v1181*v5893-*p;
+  v12555=v12732*v11342-*p;
+  v17683=v5409*v13482-*p;
+  v18360=v9355*v8198-*p;
+  v12305=v17517*v238-*p;
+  v19938=v18835*v7081-*p;
+  v7217=v826*v7615-*p;
+  v10795=v344*v4052-*p;
+  v3937=v14171*v14638-*p;
+  v9052=v11781*v11795-*p;
+  v18795=v10549*v13840-*p;
+  v525=v17315*v8501-*p;
+  v376=v7868*v9269-*p;
+  v7986=v5041*v3369-*p;
+  v8628=v4444*v1879-*p;
+  v19666=v1219*v16921-*p;
+  v2230=v9129*v5269-*p;
+  v9612=v51*v10913-*p;
+  v13175=v19381*v12818-*p;
+  v12167=v4963*v15092-*p;
+  v6222=v7645*v13285-*p;
+  v2644=v8524*v13004-*p;
+  v16378=v9781*v1071-*p;
+  v2030=v15794*v9873-*p;
+  v2127=v19384*v4437-*p;
+  v3676=v17757*v3362-*p;
+  v16799=v12187*v1753-*p;
+  v11240=v11293*v2698-*p;
+  v19256=v17555*v12524-*p;
+  v6653=v581*v11158-*p;
+  v13298=v12923*v15-*p;
+  v12564=v17861*v13926-*p;
+  v13845=v10646*v5317-*p;
+  v16039=v2090*v4127-*p;
+  v16689=v5785*v11887-*p;
+  v9580=v17649*v1467-*p;
+  v1524=v14725*v13460-*p;
+  v15560=v9533*v4517-*p;
+  v454=v18553*v3419-*p;
+  v1982=v18335*v9306-*p;
+  v8604=v7412*v10880-*p;
+  v13144=v6465*v589-*p;
+  v9576=v405*v3034-*p;
+  v7721=v17850*v8099-*p;
+  v7114=v2774*v9269-*p;
+  v10426=v1383*v57-*p;
+  v15385=v19962*v2206-*p;
+  v9784=v9225*v11842-*p;
+  v5579=v1024*v10287-*p;
+  v8480=v17253*v1210-*p;
+  v9303=v3702*v1602-*p;
+  v16310=v18385*v9872-*p;
+  v15824=v14647*v18643-*p;
+  v4073=v19327*v18851-*p;
+  v17459=v7901*v1714-*p;
+  v17123=v13608*v2035-*p;
+  v9132=v713*v19443-*p;
+  v2947=v1494*v4870-*p;
+  v16021=v16560*v18336-*p;
+  v17445=v15628*v9370-*p;
+  v10470=v14611*v11939-*p;
+  v11129=v1924*v10856-*p;
+  v17426=v19593*v19150-*p;
+  v12876=v4339*v619-*p;
+  v9580=v11084*v18075-*p;
+  v1912=v14846*v4998-*p;
+  v6163=v13961*v15316-*p;
+  v10083=v10996*v7719-*p;
+  v6069=v7716*v15995-*p;
+  v8133=v13721*v18890-*p;
+  v5355=v11047*v434-*p;
+  v17679=v8150*v17337-*p;
+  v12708=v1784*v17211-*p;
+  v8361=v13385*v19023-*p;
+  v12312=v295*v15504-*p;
+  v11604=v10886*v19709-*p;
+  v14211=v13736*v19374-*p;
+  v15983=v11600*v930-*p;
+  v341=v18808*v12584-*p;
+  v13551=v9016*v4235-*p;
+  v18519=v1411*v5172-*p;
+  v8722=v18989*v15072-*p;
+  v19311=v2882*v19880-*p;
+  v5027=v15967*v3024-*p;
+  v11131=v11894*v5981-*p;
+  v13168=v10537*v3099-*p;
+  v3501=v13042*v16124-*p;
+  v6968=v9748*v11537-*p;
+  v17822=v7441*v16168-*p;
+  v19381=v16519*v14237-*p;
+  v17790=v3555*v11154-*p;
+  v17336=v2831*v17988-*p;
+  v10589=v15134*v16251-*p;
+  v18993=v18394*v4898-*p;
+  v5767=v5300*v17279-*p;
+  v6835=v16752*v9868-*p;
+  v8154=v12847*v10495-*p;
+  v3927=v13298*v13928-*p;
+  v15062=v16117*v977-*p;
+  v10779=v9320*v2787-*p;
+  v6080=v14995*v6181-*p;
+  v10363=v9390*v15858-*p;
+  v8257=v11302*v8019-*p;
+  v3844=v5952*v4675-*p;
+  v17633=v5744*v13865-*p;
+  v16031=v18762*v19610-*p;
+  v12694=v5383*v14354-*p;
+  v12568=v9902*v11888-*p;
+  v17392=v8594*v11515-*p;
+  v4794=v7261*v12209-*p;
+  v11401=v14980*v8990-*p;
+  v11770=v17211*v5429-*p;
+  v25=v1327*v13642-*p;
+  v6192=v11294*v11589-*p;
+  v2630=v10278*v17193-*p;
+  v1402=v13014*v10358-*p;
+  v13100=v16964*v559-*p;
+  v6442=v18617*v7370-*p;
+  v19718=v14488*v17526-*p;
+  v9982=v16211*v6938-*p;
+  v3219=v16382*v13996-*p;
+  v13933=v18929*v10357-*p;
+  v4910=v11966*v5459-*p;
+  v12501=v14622*v17492-*p;
+  v4736=v3045*v13051-*p;
+  v285=v7515*v8657-*p;
+  v10621=v2879*v11408-*p;
+  v214=v17555*v339-*p;
+  v15734=v171*v16588-*p;
+  v19015=v2311*v17425-*p;
+  v15566=v1939*v11373-*p;
+  v9552=v10727*v14907-*p;
+  v17745=v14514*v19539-*p;
+  v5918=v16466*v5070-*p;
+  v9096=v5208*v17532-*p;
+  v7248=v10167*v3283-*p;
+  v13047=v11677*v19715-*p;
+  v17836=v19123*v3098-*p;
+  v14169=v4860*v16617-*p;
+  v6939=v1634*v11787-*p;
+  v9340=v4631*v1222-*p;
+  v9853=v19181*v1247-*p;
+  v19067=v3226*v4436-*p;
+  v2995=v6686*v202-*p;
+  v14843=v10711*v18170-*p;
+  v3943=v10256*v15979-*p;
+  v15116=v8855*v8147-*p;
+  v8378=v3796*v10439-*p;
+  v1113=v14817*v6974-*p;
+  v7042=v4852*v2925-*p;
+  v6356=v19931*v8215-*p;
+  v18864=v1554*v13396-*p;
+  v8578=v8767*v14366-*p;
+  v12073=v10945*v9687-*p;
+  v54=v5985*v9499-*p;
+  v2858=v3101*v5202-*p;
+  v9609=v5739*v1913-*p;
+  v2614=v12418*v9456-*p;
+  v16246=v11601*v13834-*p;
+  v17033=v14908*v19412-*p;
+  v7430=v17789*v17895-*p;
+  v5114=v11236*v19903-*p;
+  v7178=v5953*v7984-*p;
+  v9801=v4503*v7523-*p;
+  v999=v8506*v19969-*p;
+  v6693=v4531*v1859-*p;
+  v12084=v18886*v918-*p;
+  v7053=v11744*v10443-*p;
+  v13024=v10343*v10845-*p;
+  v961=v14451*v8199-*p;
+  v17914=v11853*v10713-*p;
+  v13180=v19941*v2708-*p;
+  v6089=v729*v3464-*p;
+  v18757=v6774*v9002-*p;
+  v16470=v4650*v3752-*p;
+  v3714=v18241*v6146-*p;
+  v2487=v16053*v2687-*p;
+  v15326=v95*v17670-*p;
+  v131=v3470*v16879-*p;
+  v8192=v11573*v7246-*p;
+  v390=v2849*v9290-*p;
+  v5213=v15228*v2495-*p;
+  v3492=v7372*v7206-*p;
+  v12075=v6115*v18812-*p;
+  v11756=v1618*v8555-*p;
+  v12264=v6964*v2733-*p;
+  v2580=v19065*v12199-*p;
+  v14820=v15426*v1493-*p;
+  v3332=v19012*v7670-*p;
+  v966=v16563*v14806-*p;
+  v7491=v3349*v2609-*p;
+  v3641=v10984*v6352-*p;
+  v17889=v1537*v12364-*p;
+  v2318=v16622*v11398-*p;
+  v611=v6425*v13722-*p;
+  v12983=v19624*v9950-*p;
+  v1045=v692*v18910-*p;
+  v4085=v8960*v5216-*p;
+  v15090=v1384*v9052-*p;
+  v4976=v19519*v2228-*p;
+  v9622=v15660*v10066-*p;
+  v4880=v19090*v19503-*p;
+  v16034=v10010*v19029-*p;
+  v14114=v3688*v436-*p;
+  v17948=v2623*v1535-*p;
+  v16724=v3662*v8874-*p;
+  v11521=v16736*v13702-*p;
+  v12343=v6316*v4157-*p;
+  v2906=v4025*v5713-*p;
+  v3063=v9535*v12070-*p;
+  v11853=v11872*v2487-*p;
+  v14730=v19056*v12116-*p;
+  v16213=v8335*v16564-*p;
+  v295=v6266*v9201-*p;
+  v2773=v3601*v15930-*p;
+  v14886=v6608*v13670-*p;
+  v13666=v18704*v18939-*p;
+  v6628=v13933*v587-*p;
+  v7833=v1110*v9100-*p;
+  v2523=v5909*v2731-*p;
+  v19768=v15990*v5943-*p;
+  v6038=v10954*v15634-*p;
+  v1985=v14697*v4360-*p;
+  v17991=v13092*v18415-*p;
+  v1105=v10813*v2009-*p;
+  v9676=v18211*v17948-*p;
+  v6=v9229*v6546-*p;
+  v15079=v18973*v17172-*p;
+  v9594=v12513*v6444-*p;
+  v15350=v1466*v19702-*p;
+  v12856=v4235*v1565-*p;
+  v10531=v8457*v16089-*p;
+  v16306=v1295*v3210-*p;
+  v3143=v18413*v11358-*p;
+  v17720=v12530*v4272-*p;
+  v3487=v6130*v3716-*p;
+  v11479=v16555*v13521-*p;
+  v439=v12601*v7435-*p;
+  v8382=v16203*v18763-*p;
+  v4578=v18879*v11620-*p;
+  v17156=v10102*v4144-*p;
+  v4784=v7136*v6044-*p;
+  v14966=v5200*v14053-*p;
+  v10238=v18497*v10251-*p;
+  v1628=v392*v15993-*p;
+  v10596=v7246*v2014-*p;
+  v11536=v17866*v5507-*p;
+  v16419=v1517*v15128-*p;
+  v11080=v12769*v7901-*p;
+  v18874=v19313*v17076-*p;
+  v2103=v12930*v14153-*p;
+  v5332=v52*v13742-*p;
+  v6851=v2579*v452-*p;
+  v5921=v15686*v1025-*p;
+  v12053=v5153*v18966-*p;
+  v4091=v3970*v8964-*p;
+  v5910=v19991*v16153-*p;
+  v5316=v11000*v7353-*p;
+  v12062=v14521*v9117-*p;
+  v2014=v5736*v15357-*p;
+  v6478=v15284*v950-*p;
+  v17085=v14903*v1642-*p;
+  v1130=v12888*v15775-*p;
+  v15868=v9302*v6702-*p;
+  v16754=v18821*v12044-*p;
+  v180=v18574*v8833-*p;
+  v15876=v19113*v9394-*p;
+  v17366=v5377*v19425-*p;
+  v10824=v15810*v1564-*p;
+  v14575=v15924*v15713-*p;
+  v6755=v18149*v2789-*p;
+  v16482=v361*v2825-*p;
+  v302=v12181*v16876-*p;
+  v17439=v5282*v14404-*p;
+  v8156=v1961*v8746-*p;
+  v3445=v16198*v14879-*p;
+  v5684=v1146*v10035-*p;
+  v18174=v9076*v14631-*p;
+  v13702=v13586*v3814-*p;
+  v18190=v17198*v494-*p;
+  v14485=v10310*v6481-*p;
+  v7104=v3265*v6563-*p;
+  v7532=v11226*v3933-*p;
+  v9164=v19669*v5102-*p;
+  v12488=v287*v16670-*p;
+  v11740=v5971*v9862-*p;
+  v8227=v11949*v1926-*p;
+  v4958=v17193*v10951-*p;
+  v14092=v15262*v11406-*p;
+  v6673=v12944*v964-*p;
+  v2529=v16477*v12075-*p;
+  v10503=v17972*v1332-*p;
+  v346=v4783*v1039-*p;
+  v763=v2229*v18-*p;
+  v19789=v18395*v9858-*p;
+  v2481=v7127*v3943-*p;
+  v12824=v1289*v11684-*p;
+  v9986=v16079*v10353-*p;
+  v16290=v13809*v7179-*p;
+  v19365=v4525*v10293-*p;
+  v18170=v15812*v15931-*p;
+  v3716=v5599*v11776-*p;
+  v6835=v6968*v11038-*p;
+  v3975=v16055*v13797-*p;
+  v6733=v7040*v9652-*p;
+  v6994=v7473*v5352-*p;
+  v14526=v8246*v6462-*p;
+  v12414=v11589*v1986-*p;
+  v625=v4808*v3787-*p;
+  v18292=v17938*v19908-*p;
+  v13002=v9390*v8614-*p;
+  v17936=v12180*v10039-*p;
+  v4407=v2923*v3793-*p;
+  v1802=v2585*v5104-*p;
+  v9483=v10979*v950-*p;
+  v9212=v2733*v18982-*p;
+  v18978=v9384*v16253-*p;
+  v13323=v17879*v2012-*p;
+  v13103=v11906*v9452-*p;
+  v3089=v875*v6520-*p;
+  v15817=v8346*v14590-*p;
+  v18678=v4410*v8182-*p;
+  v8795=v4629*v9169-*p;
+  v2167=v12708*v9920-*p;
+  v10985=v778*v873-*p;
+  v4560=v12832*v2089-*p;
+  v14055=v11402*v16964-*p;
+  v5425=v10439*v12858-*p;
+  v1073=v14660*v19472-*p;
+  v17651=v650*v2935-*p;
+  v11753=v3631*v8391-*p;
+  v970=v4398*v172-*p;
+  v11342=v2670*v11995-*p;
+  v8817=v13573*v11797-*p;
+  v2782=v13765*v7733-*p;
+  v4735=v12490*v18101-*p;
+  v4851=v4882*v799-*p;
+  v15408=v16998*v8940-*p;
+  v7463=v3384*v8790-*p;
+  v19495=v14478*v10686-*p;
+  v9009=v13891*v19868-*p;
+  v520=v17477*v2048-*p;
+  v10507=v18098*v36-*p;
+  v11204=v5574*v12210-*p;
+  v16443=v17398*v7649-*p;
+  v6982=v15558*v18680-*p;
+  v11018=v7329*v15783-*p;
+  v15746=v1517*v9444-*p;
+  v18137=v1993*v15947-*p;
+  v19341=v10424*v1973-*p;
+  v18098=v17920*v7111-*p;
+  v14337=v3572*v9948-*p;
+  v4611=v17246*v15804-*p;
+  v19996=v19082*v11653-*p;
+  v3287=v9131*v2232-*p;
+  v4920=v6678*v11336-*p;
+  v17656=v7209*v19443-*p;
+  v17079=v16540*v9670-*p;
+  v2072=v19309*v16161-*p;
+  v10587=v5405*v18753-*p;
+  v16438=v14084*v2250-*p;
+  v8106=v13277*v4983-*p;
+  v3798=v6420*v7483-*p;
+  v877=v5434*v13501-*p;
+  v13385=v4411*v19769-*p;
+  v4149=v19246*v506-*p;
+  v6904=v15982*v1929-*p;
+  v4790=v19370*v12350-*p;
+  v15828=v15209*v3287-*p;
+  v85=v17272*v19183-*p;
+  v10293=v13019*v15508-*p;
+  v15299=v5279*v16994-*p;
+  v4497=v16715*v9609-*p;
+  v16498=v4999*v1454-*p;
+  v13168=v10306*v12387-*p;
+  v19379=v2145*v9871-*p;
+  v17831=v13654*v13877-*p;
+  v5597=v7715*v8165-*p;
+  v8552=v19151*v7256-*p;
+  v2181=v14186*v14655-*p;
+  v13429=v15786*v7646-*p;
+  v15629=v9168*v10698-*p;
+  v5177=v18203*v4644-*p;
+  v610=v12195*v7485-*p;
+  v18131=v3252*v1779-*p;
+  v3122=v17046*v3878-*p;
+  v9225=v12405*v9392-*p;
+  v4103=v15431*v12065-*p;
+  v10545=v19169*v17459-*p;
+  v2932=v16054*v16950-*p;
+  v5429=v900*v16763-*p;
+  v7479=v14656*v2451-*p;
+  v2990=v9668*v9939-*p;
+  v5661=v15521*v5009-*p;
+  v12985=v18516*v19361-*p;
+  v1825=v8171*v9280-*p;
+  v14442=v4445*v7771-*p;
+  v15938=v12899*v19886-*p;
+  v19796=v8408*v10006-*p;
+  v517=v13270*v16390-*p;
+  v13190=v19952*v13348-*p;
+  v2609=v8481*v1528-*p;
+  v8392=v14672*v2138-*p;
+  v2002=v3142*v13780-*p;
+  v8575=v3601*v9018-*p;
+  v15528=v5950*v1566-*p;
+  v3668=v13570*v1033-*p;
+  v18661=v15054*v6478-*p;
+  v2212=v18255*v12670-*p;
+  v17233=v16501*v7667-*p;
+  v18207=v10133*v18750-*p;
+  v5889=v6269*v5568-*p;
+  v9840=v1116*v18739-*p;
+  v16271=v12493*v13527-*p;
+  v3103=v5087*v834-*p;
+  v19906=v469*v3911-*p;
+  v824=v19759*v17171-*p;
+  v7754=v12782*v16472-*p;
+  v19935=v3653*v6083-*p;
+  v6632=v13015*v11386-*p;
+  v2484=v14165*v1347-*p;
+  v16871=v10600*v11212-*p;
+  v12101=v4685*v18136-*p;
+  v5926=v9276*v13609-*p;
+  v13269=v4223*v10656-*p;
+  v15072=v7141*v19407-*p;
+  v9854=v8985*v3491-*p;
+  v1937=v11236*v18837-*p;
+  v8666=v7171*v15724-*p;
+  v10474=v2847*v15246-*p;
+  v10242=v1721*v735-*p;
+  v6061=v16186*v8760-*p;
+  v14249=v16787*v11415-*p;
+  v14474=v13713*v12600-*p;
+  v18442=v9316*v19008-*p;
+  v3174=v11652*v13659-*p;
+  v12333=v14321*v374-*p;
+  v15765=v12903*v728-*p;
+  v19358=v19831*v19750-*p;
+  v5631=v1262*v480-*p;
+  v17056=v11021*v9655-*p;
+  v11001=v1925*v15223-*p;
+  v10058=v8608*v6377-*p;
+  v5993=v2248*v16662-*p;
+  v6505=v4633*v16202-*p;
+  v14271=v12196*v9325-*p;
+  v6468=v569*v4115-*p;
+  v4485=v13249*v14954-*p;
+  v4186=v12661*v4539-*p;
+  v14780=v7259*v9162-*p;
+  v1252=v1829*v8970-*p;
+  v11775=v4810*v19280-*p;
+  v3730=v6643*v18471-*p;
+  v2871=v12778*v11522-*p;
+  v2168=v10285*v10503-*p;
+  v1570=v13298*v14168-*p;
+  v4537=v4381*v10371-*p;
+  v19739=v15947*v9860-*p;
+  v19001=v3488*v15508-*p;
+  v3492=v2573*v122-*p;
+  v14369=v1331*v5367-*p;
+  v3536=v6900*v17096-*p;
+  v12679=v12247*v15016-*p;
+  v19920=v14369*v4161-*p;
+  v12708=v3913*v14103-*p;
+  v12537=v11469*v8917-*p;
+  v14238=v9555*v3844-*p;
+  v4141=v19216*v19155-*p;
+  v6535=v15029*v15552-*p;
+  v6434=v4157*v177-*p;
+  v65=v14*v12433-*p;
+  v16980=v7415*v18303-*p;
+  v1421=v17522*v8075-*p;
+  v10952=v6330*v1577-*p;
+  v8495=v15225*v13529-*p;
+  v1138=v9207*v14847-*p;
+  v10869=v7171*v0-*p;
+  v17539=v17435*v12879-*p;
+  v9682=v4989*v4835-*p;
+  v9205=v9923*v18168-*p;
+  v14378=v13460*v7266-*p;
+  v2659=v16983*v16450-*p;
+  v19122=v4717*v16670-*p;
+  v9956=v14540*v18169-*p;
+  v2396=v1591*v4910-*p;
+  v12995=v2777*v13445-*p;
+  v5030=v6039*v2436-*p;
+  v9807=v17900*v17588-*p;
+  v13156=v6083*v11765-*p;
+  v14028=v5023*v18909-*p;
+  v17809=v2731*v17984-*p;
+  v18470=v3648*v3094-*p;
+  v11482=v14860*v3970-*p;
+  v5398=v19450*v6645-*p;
+  v2041=v1077*v12065-*p;
+  v10371=v12678*v8270-*p;
+  v17710=v10151*v1065-*p;
+  v11401=v12235*v18540-*p;
+  v14758=v3908*v2560-*p;
+  v16502=v6715*v6072-*p;
+  v4800=v14546*v17167-*p;
+  v5031=v7273*v12769-*p;
+  v8944=v15497*v9555-*p;
+  v5663=v18269*v9111-*p;
+  v8810=v14947*v15334-*p;
+  v419=v15640*v18087-*p;
+  v15472=v13659*v13042-*p;
+  v247=v3461*v191-*p;
+  v16024=v9476*v3147-*p;
+  v13573=v18543*v10499-*p;
+  v11787=v14989*v2709-*p;
+  v13569=v9525*v5984-*p;
+  v12970=v11692*v6725-*p;
+  v12153=v5704*v10626-*p;
+  v13914=v7350*v14318-*p;
+  v5375=v3666*v6196-*p;
+  v19031=v6023*v11368-*p;
+  v13745=v1442*v10037-*p;
+  v16105=v5616*v11321-*p;
+  v13300=v17009*v10092-*p;
+  v3672=v5092*v8836-*p;
+  v15434=v9112*v3581-*p;
+  v19145=v16700*v17086-*p;
+  v1706=v3170*v7882-*p;
+  v16004=v4065*v10217-*p;
+  v8718=v5914*v19089-*p;
+  v6299=v13783*v18245-*p;
+  v19849=v15469*v3755-*p;
+  v5195=v207*v1979-*p;
+  v1462=v9931*v13888-*p;
+  v9426=v17277*v11929-*p;
+  v13880=v17330*v11865-*p;
+  v11339=v967*v12685-*p;
+  v8347=v969*v2012-*p;
+  v991=v16733*v16195-*p;
+  v16088=v18573*v6972-*p;
+  v480=v5497*v1948-*p;
+  v2789=v10389*v671-*p;
+  v1456=v19499*v11724-*p;
+  v8994=v7421*v775-*p;
+  v19858=v17771*v5203-*p;
+  v18024=v16774*v15886-*p;
+  v5200=v9122*v4524-*p;
+  v17549=v9213*v1813-*p;
+  v10125=v4001*v9201-*p;
+  v17980=v3038*v3377-*p;
+  v6924=v8921*v3499-*p;
+  v7671=v17282*v18394-*p;
+  v17806=v5236*v8163-*p;
+  v1148=v2288*v1561-*p;
+  v19124=v58*v7652-*p;
+  v6995=v12151*v13610-*p;
+  v11543=v17386*v8862-*p;
+  v10942=v18732*v14029-*p;
+  v9040=v15753*v8710-*p;
+  v15289=v4333*v10109-*p;
+  v18933=v16542*v2617-*p;
+  v2532=v2838*v2862-*p;
+  v10934=v9835*v14045-*p;
+  v19847=v11053*v6694-*p;
+  v19254=v12506*v8787-*p;
+  v3149=v14385*v1112-*p;
+  v16040=v154*v10933-*p;
+  v6201=v2211*v930-*p;
+  v18986=v15038*v19789-*p;
+  v3041=v15807*v17384-*p;
+  v19997=v17728*v10026-*p;
+  v18223=v12091*v1965-*p;
+  v7945=v494*v16210-*p;
+  v19646=v15064*v3413-*p;
+  v9664=v5069*v13002-*p;
+  v1008=v7553*v3209-*p;
+  v1781=v7663*v19312-*p;
+  v7154=v6580*v4647-*p;
+  v6675=v1263*v13290-*p;
+  v3758=v3140*v18342-*p;
+  v11514=v13642*v7181-*p;
+  v6727=v8234*v16195-*p;
+  v13479=v3453*v1860-*p;
+  v2869=v15121*v2889-*p;
+  v15751=v6455*v11273-*p;
+  v3909=v5270*v17875-*p;
+  v5014=v15065*v16757-*p;
+  v4028=v6933*v16276-*p;
+  v11845=v9677*v3318-*p;
+  v4037=v11635*v17982-*p;
+  v14629=v10899*v3424-*p;
+  v11795=v12208*v7599-*p;
+  v17007=v18499*v16650-*p;
+  v16820=v15546*v1199-*p;
+  v13399=v11278*v15942-*p;
+  v4350=v10733*v7113-*p;
+  v1916=v18607*v14710-*p;
+  v12712=v7650*v7756-*p;
+  v9172=v3527*v6895-*p;
+  v13399=v1787*v11410-*p;
+  v10179=v167*v6313-*p;
+  v16058=v2104*v19315-*p;
+  v16939=v9741*v364-*p;
+  v6431=v9111*v17589-*p;
+  v10259=v12272*v6257-*p;
+  v3728=v2836*v13738-*p;
+  v19819=v2078*v19787-*p;
+  v19869=v7813*v103-*p;
+  v17110=v7112*v13666-*p;
+  v2268=v4618*v9585-*p;
+  v631=v17518*v19956-*p;
+  v6046=v18215*v5216-*p;
+  v4529=v10333*v9031-*p;
+  v14549=v18459*v9598-*p;
+  v9924=v86*v8658-*p;
+  v1899=v9159*v11512-*p;
+  v3734=v80*v11797-*p;
+  v14558=v1078*v3131-*p;
+  v18093=v18778*v19576-*p;
+  v7049=v7577*v11687-*p;
+  v8648=v19514*v14393-*p;
+  v8909=v5561*v4658-*p;
+  v8202=v16767*v638-*p;
+  v6486=v4050*v9893-*p;
+  v8913=v15649*v219-*p;
+  v2067=v573*v15677-*p;
+  v8997=v12693*v12559-*p;
+  v6976=v16302*v7610-*p;
+  v14502=v18346*v13298-*p;
+  v13618=v4095*v9130-*p;
+  v811=v6770*v15748-*p;
+  v8748=v6863*v8386-*p;
+  v211=v1211*v16384-*p;
+  v19632=v11226*v19629-*p;
+  v10685=v1934*v16578-*p;
+  v7652=v17697*v16389-*p;
+  v14367=v14699*v7401-*p;
+  v7919=v13122*v2849-*p;
+  v12641=v11018*v15418-*p;
+  v742=v7420*v16766-*p;
+  v19041=v11155*v11950-*p;
+  v12037=v12958*v944-*p;
+  v15531=v17632*v14231-*p;
+  v15094=v12971*v17387-*p;
+  v267=v16643*v13020-*p;
+  v15326=v14458*v5665-*p;
+  v12379=v16981*v1264-*p;
+  v2654=v17990*v4864-*p;
+  v9357=v16106*v5011-*p;
+  v12573=v10067*v18485-*p;
+  v5510=v7545*v1329-*p;
+  v19635=v19000*v1274-*p;
+  v13231=v16361*v16110-*p;
+  v4472=v19777*v737-*p;
+  v17862=v7693*v3877-*p;
+  v777=v17302*v19163-*p;
+  v17417=v4000*v6446-*p;
+  v9793=v3096*v10044-*p;
+  v9571=v11313*v1121-*p;
+  v19943=v4899*v15614-*p;
+  v10552=v560*v15280-*p;
+  v2753=v1983*v5693-*p;
+  v4701=v19592*v14671-*p;
+  v15543=v14812*v8472-*p;
+  v5470=v12762*v4841-*p;
+  v12809=v3084*v3482-*p;
+  v6222=v7388*v19685-*p;
+  v6264=v5112*v2457-*p;
+  v18889=v17787*v11744-*p;
+  v9377=v7899*v1546-*p;
+  v19136=v18593*v1032-*p;
+  v852=v2771*v6425-*p;
+  v11696=v13998*v11354-*p;
+  v11707=v19001*v17665-*p;
+  v11489=v12600*v19848-*p;
+  v15615=v558*v2958-*p;
+  v10462=v8768*v3941-*p;
+  v13465=v17603*v1868-*p;
+  v16469=v15780*v14090-*p;
+  v10954=v8614*v3347-*p;
+  v10417=v4016*v15960-*p;
+  v3691=v16821*v11302-*p;
+  v14421=v9483*v11458-*p;
+  v17160=v13955*v11643-*p;
+  v5172=v18183*v1228-*p;
+  v6615=v5371*v9636-*p;
+  v14585=v9645*v15978-*p;
+  v18783=v18911*v239-*p;
+  v11789=v18678*v13666-*p;
+  v6424=v16551*v13576-*p;
+  v10725=v15705*v575-*p;
+  v7918=v8965*v19409-*p;
+  v12468=v8061*v15957-*p;
+  v14362=v14666*v8052-*p;
+  v17917=v9445*v2580-*p;
+  v1251=v2824*v6426-*p;
+  v17192=v19145*v8660-*p;
+  v10354=v9763*v494-*p;
+  v15076=v17296*v11532-*p;
+  v419=v19571*v12496-*p;
+  v11689=v2011*v14362-*p;
+  v11963=v2134*v8199-*p;
+  v1056=v9264*v9239-*p;
+  v5664=v281*v9631-*p;
+  v18260=v10938*v3811-*p;
+  v2029=v11072*v10769-*p;
+  v4141=v16643*v12135-*p;
+  v18417=v6749*v17254-*p;
+  v11236=v18027*v15684-*p;
+  v8822=v17090*v328-*p;
+  v8626=v16731*v12626-*p;
+  v16872=v18015*v14465-*p;
+  v3823=v8120*v2815-*p;
+  v7216=v410*v7726-*p;
+  v1203=v12802*v18065-*p;
+  v6689=v10008*v6125-*p;
+  v348=v9511*v2875-*p;
+  v1452=v7138*v2166-*p;
+  v10143=v12695*v16126-*p;
+  v5474=v13135*v9811-*p;
+  v485=v19308*v6444-*p;
+  v2618=v12633*v10885-*p;
+  v19660=v10320*v12905-*p;
+  v13958=v7808*v11181-*p;
+  v4608=v17202*v6583-*p;
+  v15915=v15829*v16169-*p;
+  v2926=v10194*v10071-*p;
+  v10059=v7499*v1556-*p;
+  v11555=v2256*v7239-*p;
+  v15378=v14064*v3459-*p;
+  v4097=v15327*v16240-*p;
+  v7704=v8749*v9905-*p;
+  v18549=v8115*v3978-*p;
+  v2400=v8543*v4433-*p;
+  v7744=v1945*v19829-*p;
+  v17883=v19933*v4224-*p;
+  v10932=v17048*v11037-*p;
+  v12507=v2592*v15957-*p;
+  v14334=v8077*v13255-*p;
+  v7204=v17861*v12302-*p;
+  v13398=v15027*v17001-*p;
+  v13696=v8587*v11083-*p;
+  v10808=v13367*v9202-*p;
+  v11801=v9253*v16337-*p;
+  v11082=v7063*v1794-*p;
+  v12739=v6365*v13982-*p;
+  v7511=v16597*v3780-*p;
+  v17599=v13271*v5833-*p;
+  v8382=v3121*v13957-*p;
+  v740=v14067*v66-*p;
+  v14531=v4962*v18564-*p;
+  v17749=v17934*v15226-*p;
+  v10885=v410*v9333-*p;
+  v16927=v19995*v5852-*p;
+  v8197=v7244*v7681-*p;
+  v11627=v9934*v10627-*p;
+  v7302=v7877*v15009-*p;
+  v5611=v8124*v5225-*p;
+  v4713=v5879*v10031-*p;
+  v13830=v8331*v7790-*p;
+  v8577=v18781*v11824-*p;
+  v15446=v2627*v4398-*p;
+  v3270=v15276*v1809-*p;
+  v5321=v16383*v12359-*p;
+  v2500=v7463*v5109-*p;
+  v5347=v6389*v5636-*p;
+  v686=v11750*v4776-*p;
+  v13845=v14425*v4200-*p;
+  v15575=v69*v3726-*p;
+  v10116=v6167*v13532-*p;
+  v18716=v9575*v8106-*p;
+  v10698=v19367*v19926-*p;
+  v15832=v9816*v2245-*p;
+  v1086=v17976*v19553-*p;
+  v5691=v19122*v11843-*p;
+  v17451=v11028*v16296-*p;
+  v9363=v1896*v503-*p;
+  v15291=v18050*v7884-*p;
+  v12016=v3721*v2509-*p;
+  v7419=v17941*v11581-*p;
+  v4644=v7954*v6850-*p;
+  v12189=v10894*v5092-*p;
+  v2211=v10844*v8803-*p;
+  v12158=v11339*v1642-*p;
+  v4831=v2535*v9460-*p;
+  v16903=v10690*v13549-*p;
+  v958=v4221*v1677-*p;
+  v10114=v1412*v17852-*p;
+  v15544=v2415*v6623-*p;
+  v1855=v8605*v985-*p;
+  v6768=v5556*v15927-*p;
+  v6826=v3941*v1689-*p;
+  v9934=v9183*v3947-*p;
+  v9185=v10783*v662-*p;
+  v5865=v3879*v15446-*p;
+  v92=v17678*v482-*p;
+  v15060=v11559*v8707-*p;
+  v16355=v19718*v10847-*p;
+  v3411=v13893*v15556-*p;
+  v12519=v5100*v5321-*p;
+  v4571=v12321*v3973-*p;
+  v372=v18817*v7630-*p;
+  v3869=v12048*v8361-*p;
+  v3557=v12168*v4262-*p;
+  v11379=v15602*v2861-*p;
+  v2669=v2499*v17459-*p;
+  v11336=v4346*v13560-*p;
+  v15872=v10281*v16382-*p;
+  v9211=v18056*v4747-*p;
+  v12732=v18433*v8686-*p;
+  v3139=v50*v1955-*p;
+  v19327=v18252*v16136-*p;
+  v17199=v12936*v13724-*p;
+  v4993=v4811*v7219-*p;
+  v10813=v16126*v15962-*p;
+  v17583=v18754*v16137-*p;
+  v12721=v5574*v14281-*p;
+  v18055=v19828*v7114-*p;
+  v3143=v17044*v1528-*p;
+  v1961=v8422*v7575-*p;
+  v8436=v9691*v1228-*p;
+  v19214=v16309*v9505-*p;
+  v12784=v5305*v322-*p;
+  v10966=v3467*v8926-*p;
+  v9051=v2663*v8980-*p;
+  v12124=v10237*v18957-*p;
+  v11955=v18038*v10548-*p;
+  v2342=v9984*v4115-*p;
+  v19496=v19741*v3624-*p;
+  v19724=v8996*v15890-*p;
+  v3903=v5146*v1984-*p;
+  v8498=v12577*v13006-*p;
+  v12455=v7749*v15129-*p;
+  v11252=v613*v8445-*p;
+  v12710=v12189*v5044-*p;
+  v2716=v4681*v6559-*p;
+  v9985=v10723*v11212-*p;
+  v8868=v19649*v4302-*p;
+  v6899=v10052*v2904-*p;
+  v2866=v19917*v15144-*p;
+  v15073=v3762*v16379-*p;
+  v11431=v5043*v12784-*p;
+  v9859=v19780*v5869-*p;
+  v10943=v8947*v12382-*p;
+  v16728=v18773*v1761-*p;
+  v4387=v18809*v11208-*p;
+  v16668=v10152*v16691-*p;
+  v6313=v3479*v1961-*p;
+  v11776=v4154*v4440-*p;
+  v13753=v8438*v11148-*p;
+  v3016=v40*v18138-*p;
+  v2991=v7485*v11339-*p;
+  v5700=v3001*v12892-*p;
+  v4588=v5495*v18187-*p;
+  v9299=v1179*v16561-*p;
+  v12438=v14027*v16588-*p;
+  v19157=v16389*v9446-*p;
+  v19524=v926*v2598-*p;
+  v16218=v2398*v6795-*p;
+  v3648=v12623*v12397-*p;
+  v16529=v4955*v7887-*p;
+  v5043=v8713*v16225-*p;
+  v12083=v17148*v10341-*p;
+  v8496=v11926*v137-*p;
+  v19806=v8362*v17409-*p;
+  v14329=v19577*v19229-*p;
+  v19075=v7100*v472-*p;
+  v19255=v15799*v15157-*p;
+  v10985=v18952*v3592-*p;
+  v1006=v19900*v17512-*p;
+  v5855=v12617*v144-*p;
+  v12258=v2483*v16650-*p;
+  v12045=v4741*v17999-*p;
+  v3113=v14008*v6347-*p;
+  v560=v4336*v17217-*p;
+  v11152=v8620*v962-*p;
+  v9109=v3881*v11821-*p;
+  v19972=v18871*v10468-*p;
+  v195=v14641*v1013-*p;
+  v19716=v17381*v9150-*p;
+  v6435=v10767*v15587-*p;
+  v10408=v7736*v2664-*p;
+  v9536=v6370*v8245-*p;
+  v9296=v19046*v12611-*p;
+  v11846=v8549*v2597-*p;
+  v13103=v5452*v5620-*p;
+  v809=v16651*v15903-*p;
+  v4748=v8079*v2759-*p;
+  v8376=v2699*v2713-*p;
+  v3704=v12944*v19117-*p;
+  v3803=v17161*v11249-*p;
+  v13982=v14939*v1060-*p;
+  v11211=v12270*v15524-*p;
+  v5528=v16393*v19788-*p;
+  v15436=v19588*v4580-*p;
+  v15252=v13783*v14593-*p;
+  v5491=v13186*v14514-*p;
+  v4659=v6262*v2974-*p;
+  v18051=v17055*v10015-*p;
+  v10290=v6334*v8240-*p;
+  v19076=v1093*v1841-*p;
+  v2895=v4720*v11595-*p;
+  v10729=v3547*v18563-*p;
+  v2325=v3038*v2952-*p;
+  v3965=v3516*v12729-*p;
+  v8711=v4554*v19322-*p;
+  v13804=v12207*v1450-*p;
+  v15901=v12538*v11593-*p;
+  v5691=v7671*v12112-*p;
+  v13547=v1904*v17879-*p;
+  v16981=v18535*v16470-*p;
+  v15255=v471*v7656-*p;
+  v13404=v10556*v3815-*p;
+  v16995=v7548*v7052-*p;
+  v11260=v9407*v1371-*p;
+  v3526=v6889*v12478-*p;
+  v18570=v2878*v11722-*p;
+  v6164=v13385*v11308-*p;
+  v4434=v3376*v10012-*p;
+  v18453=v7106*v475-*p;
+  v11939=v3943*v11988-*p;
+  v7274=v14942*v7706-*p;
+  v19063=v19275*v19052-*p;
+  v15720=v17663*v14542-*p;
+  v17221=v2057*v7264-*p;
+  v17636=v19827*v7476-*p;
+  v13167=v1166*v12839-*p;
+  v14194=v6854*v6849-*p;
+  v8571=v4537*v10934-*p;
+  v17948=v2428*v14334-*p;
+  v1458=v17313*v18613-*p;
+  v3636=v12988*v6863-*p;
+  v15268=v2965*v10059-*p;
+  v13213=v4388*v3289-*p;
+  v18646=v1625*v12223-*p;
+  v7042=v6914*v18414-*p;
+  v17050=v13745*v7306-*p;
+  v14515=v19519*v16531-*p;
+  v6523=v10924*v6-*p;
+  v16316=v7378*v12150-*p;
+  v17345=v12414*v7136-*p;
+  v8490=v1302*v3496-*p;
+  v2594=v1052*v7537-*p;
+  v17088=v7055*v5248-*p;
+  v583=v4868*v10740-*p;
+  v2380=v8835*v304-*p;
+  v18166=v17209*v11571-*p;
+  v14436=v12073*v12558-*p;
+  v9719=v13552*v7849-*p;
+  v19677=v9869*v18751-*p;
+  v5447=v15512*v16025-*p;
+  v17139=v3284*v5669-*p;
+  v17190=v4039*v16243-*p;
+  v7534=v6360*v11056-*p;
+  v18476=v9004*v11389-*p;
+  v6028=v9089*v9499-*p;
+  v12095=v10101*v6071-*p;
+  v16072=v4266*v14376-*p;
+  v11314=v7141*v10758-*p;
+  v3179=v17343*v5321-*p;
+  v17599=v16852*v17005-*p;
+  v12230=v4639*v7013-*p;
+  v10228=v18254*v10986-*p;
+  v16327=v19958*v1279-*p;
+  v10191=v14361*v7800-*p;
+  v15652=v17286*v5521-*p;
+  v2779=v17290*v1134-*p;
+  v17753=v3304*v10438-*p;
+  v12970=v16380*v4627-*p;
+  v4533=v3546*v11199-*p;
+  v4605=v6182*v9487-*p;
+  v9004=v17363*v10266-*p;
+  v10502=v5150*v12573-*p;
+  v9273=v10364*v16986-*p;
+  v14578=v18503*v5784-*p;
+  v8616=v584*v10544-*p;
+  v5137=v6255*v8365-*p;
+  v8802=v2935*v9968-*p;
+  v3341=v6703*v1368-*p;
+  v4555=v311*v247-*p;
+  v19024=v5189*v12230-*p;
+  v13870=v11485*v19325-*p;
+  v11052=v4118*v10304-*p;
+  v4787=v2199*v17382-*p;
+  v3386=v2611*v11834-*p;
+  v2565=v13822*v9066-*p;
+  v5553=v4014*v10302-*p;
+  v2652=v14567*v14332-*p;
+  v18228=v14208*v14972-*p;
+  v5277=v5953*v18724-*p;
+  v6154=v4100*v121-*p;
+  v18155=v13528*v8763-*p;
+  v19633=v18899*v13472-*p;
+  v5355=v17108*v14969-*p;
+  v19332=v15976*v5334-*p;
+  v17458=v17735*v10881-*p;
+  v12426=v2344*v9733-*p;
+  v16097=v14503*v18493-*p;
+  v18569=v6192*v17487-*p;
+  v16388=v1521*v1893-*p;
+  v7080=v13583*v15675-*p;
+  v11551=v17780*v15404-*p;
+  v9895=v17242*v9401-*p;
+  v3686=v19664*v8373-*p;
+  v19725=v2911*v11907-*p;
+  v1304=v8689*v6040-*p;
+  v145=v11730*v14309-*p;
+  v7917=v10363*v10678-*p;
+  v5606=v9681*v3612-*p;
+  v16469=v14107*v16513-*p;
+  v15138=v6281*v10685-*p;
+  v7041=v11495*v12014-*p;
+  v17650=v10003*v17968-*p;
+  v4814=v7675*v17056-*p;
+  v17044=v19574*v5830-*p;
+  v15922=v11212*v14961-*p;
+  v5653=v5776*v10706-*p;
+  v3187=v18572*v17050-*p;
+  v4529=v13522*v17703-*p;
+  v4190=v1292*v6175-*p;
+  v10582=v2382*v49-*p;
+  v5408=v13620*v2590-*p;
+  v12339=v15141*v6985-*p;
+  v2233=v7139*v14985-*p;
+  v14944=v19851*v12067-*p;
+  v17758=v4635*v14518-*p;
+  v12999=v9968*v16250-*p;
+  v3881=v6937*v3463-*p;
+  v19703=v2076*v2482-*p;
+  v18531=v9683*v10609-*p;
+  v9207=v7429*v17281-*p;
+  v13332=v17561*v9846-*p;
+  v12365=v1496*v16669-*p;
+  v2231=v15880*v2956-*p;
+  v13281=v17065*v791-*p;
+  v13109=v18123*v16465-*p;
+  v16391=v14123*v2511-*p;
+  v16940=v15613*v18612-*p;
+  v4341=v5942*v2735-*p;
+  v5032=v3905*v7421-*p;
+  v10345=v14017*v14004-*p;
+  v1301=v494*v19787-*p;
+  v18065=v17219*v14707-*p;
+  v11306=v1250*v1815-*p;
+  v5374=v16461*v9779-*p;
+  v19523=v8774*v1651-*p;
+  v14861=v8721*v18843-*p;
+  v18406=v8763*v13112-*p;
+  v2582=v18301*v13798-*p;
+  v9959=v6822*v4252-*p;
+  v1926=v2530*v17104-*p;
+  v1129=v6446*v523-*p;
+  v6611=v9830*v3124-*p;
+  v1236=v13155*v6218-*p;
+  v4444=v638*v5511-*p;
+  v9114=v10613*v14120-*p;
+  v11493=v14822*v11983-*p;
+  v15828=v15464*v13412-*p;
+  v19375=v18318*v4837-*p;
+  v940=v3376*v17073-*p;
+  v8283=v17570*v5441-*p;
+  v17034=v16527*v10840-*p;
+  v13841=v17579*v6907-*p;
+  v2054=v5497*v9009-*p;
+  v17518=v63*v2882-*p;
+  v8683=v8796*v3556-*p;
+  v17981=v3999*v16896-*p;
+  v8207=v12743*v3109-*p;
+  v7252=v17650*v19053-*p;
+  v13500=v18683*v6646-*p;
+  v15058=v10547*v8444-*p;
+  v15505=v3283*v8359-*p;
+  v12356=v6526*v18057-*p;
+  v18267=v2779*v9789-*p;
+  v2158=v18993*v9097-*p;
+  v6331=v12600*v8296-*p;
+  v14836=v10287*v13760-*p;
+  v9143=v175*v7672-*p;
+  v3695=v6250*v12353-*p;
+  v16067=v13278*v12832-*p;
+  v6720=v17490*v10749-*p;
+  v6735=v19201*v14895-*p;
+  v7508=v4822*v19189-*p;
+  v4471=v11364*v10054-*p;
+  v15643=v6399*v7171-*p;
+  v10016=v2289*v3523-*p;
+  v17044=v12246*v2493-*p;
+  v5718=v18153*v15580-*p;
+  v19295=v6*v6583-*p;
+  v5402=v175*v12399-*p;
+  v19376=v947*v16151-*p;
+  v7541=v19460*v14574-*p;
+  v11069=v8140*v19580-*p;
+  v12230=v6804*v2168-*p;
+  v14396=v8232*v6013-*p;
+  v169=v6092*v2849-*p;
+  v8999=v8069*v17565-*p;
+  v11708=v4462*v17353-*p;
+  v5816=v1465*v16975-*p;
+  v19945=v2644*v16016-*p;
+  v16547=v16512*v13540-*p;
+  v6326=v12689*v540-*p;
+  v5371=v19843*v1206-*p;
+  v15114=v3825*v11101-*p;
+  v7866=v17418*v11911-*p;
+  v15585=v6724*v5895-*p;
+  v2238=v166*v5264-*p;
+  v2134=v14902*v6465-*p;
+  v796=v4208*v9463-*p;
+  v14128=v7387*v14227-*p;
+  v1412=v18079*v5212-*p;
+  v18117=v6209*v1994-*p;
+  v13223=v5793*v12563-*p;
+  v15172=v4430*v13289-*p;
+  v14819=v2428*v1178-*p;
+  v2368=v13874*v6411-*p;
+  v5568=v12053*v9806-*p;
+  v18735=v15610*v6511-*p;
+  v16912=v3416*v5216-*p;
+  v16003=v2077*v19431-*p;
+  v11102=v7264*v13739-*p;
+  v1952=v4818*v11360-*p;
+  v3105=v4072*v4803-*p;
+  v3161=v17299*v6010-*p;
+  v2222=v12696*v9541-*p;
+  v4630=v14917*v11002-*p;
+  v8457=v6586*v5796-*p;
+  v1767=v13008*v18394-*p;
+  v14706=v12484*v1699-*p;
+  v10479=v2047*v16851-*p;
+  v18989=v6833*v871-*p;
+  v2227=v16237*v19262-*p;
+  v13945=v11433*v2653-*p;
+  v18281=v14160*v19976-*p;
+  v17365=v18516*v15194-*p;
+  v3464=v11589*v4446-*p;
+  v5598=v3277*v12758-*p;
+  v2217=v12268*v3502-*p;
+  v10358=v5438*v10748-*p;
+  v17565=v19060*v10001-*p;
+  v5640=v399*v12310-*p;
+  v8372=v11672*v11980-*p;
+  v5268=v9508*v12231-*p;
+  v9367=v16422*v14695-*p;
+  v19496=v4946*v12376-*p;
+  v3291=v12103*v7602-*p;
+  v11132=v12928*v12809-*p;
+  v18350=v314*v11121-*p;
+  v15418=v6801*v9629-*p;
+  v6794=v15697*v8074-*p;
+  v17437=v1329*v16931-*p;
+  v3209=v5244*v7384-*p;
+  v16410=v2363*v3662-*p;
+  v14632=v3239*v3886-*p;
+  v5681=v13963*v785-*p;
+  v1528=v16975*v19263-*p;
+  v14280=v7497*v10749-*p;
+  v4805=v4211*v4879-*p;
+  v18649=v15409*v4638-*p;
+  v16619=v13003*v14372-*p;
+  v13530=v6025*v15307-*p;
+  v8508=v8443*v565-*p;
+  v7416=v3580*v7861-*p;
+  v8586=v9344*v9215-*p;
+  v10353=v11546*v2675-*p;
+  v4229=v5900*v769-*p;
+  v6557=v19965*v4720-*p;
+  v16688=v2178*v16943-*p;
+  v17315=v19632*v5965-*p;
+  v2610=v15585*v9604-*p;
+  v753=v13344*v1260-*p;
+  v17197=v941*v2644-*p;
+  v9206=v15427*v16222-*p;
+  v13958=v14715*v18424-*p;
+  v15469=v3514*v38-*p;
+  v3700=v5446*v10852-*p;
+  v19414=v451*v3781-*p;
+  v14130=v4631*v4857-*p;
+  v10178=v974*v14429-*p;
+  v11862=v4367*v15398-*p;
+  v4425=v8254*v9981-*p;
+  v6465=v6938*v1834-*p;
+  v13957=v9667*v814-*p;
+  v6475=v13500*v6941-*p;
+  v261=v19859*v7763-*p;
+  v9143=v679*v12956-*p;
+  v7558=v6945*v10723-*p;
+  v19318=v10839*v12785-*p;
+  v6196=v11086*v18227-*p;
+  v7469=v6512*v13626-*p;
+  v9228=v15170*v6234-*p;
+  v15494=v15210*v10701-*p;
+  v8874=v7325*v12516-*p;
+  v11165=v1353*v4632-*p;
+  v972=v19546*v11830-*p;
+  v2958=v10155*v15725-*p;
+  v3491=v4261*v10554-*p;
+  v7290=v7895*v13405-*p;
+  v2421=v17655*v10522-*p;
+  v10188=v14699*v7527-*p;
+  v10127=v3741*v271-*p;
+  v14979=v3911*v14880-*p;
+  v15723=v11851*v12487-*p;
+  v10223=v176*v19631-*p;
+  v4976=v6984*v13092-*p;
+  v18564=v6011*v19361-*p;
+  v9619=v7715*v11128-*p;
+  v19447=v7414*v14392-*p;
+  v11539=v4139*v10558-*p;
+  v7362=v14441*v4330-*p;
+  v2895=v12257*v13276-*p;
+  v15983=v5706*v4526-*p;
+  v12249=v8371*v19309-*p;
+  v9919=v10884*v6983-*p;
+  v15005=v17242*v11306-*p;
+  v16396=v5094*v13517-*p;
+  v8319=v339*v16246-*p;
+  v10370=v18039*v2699-*p;
+  v6068=v2867*v5785-*p;
+  v946=v2886*v15791-*p;
+  v3819=v4725*v12971-*p;
+  v17650=v8556*v3477-*p;
+  v18860=v7651*v9950-*p;
+  v13787=v11849*v4660-*p;
+  v17478=v12216*v4274-*p;
+  v18106=v4720*v10089-*p;
+  v6702=v12408*v5399-*p;
+  v8385=v11495*v10248-*p;
+  v12768=v1621*v5388-*p;
+  v13787=v17118*v12199-*p;
+  v8241=v17460*v14057-*p;
+  v17700=v13237*v8387-*p;
+  v5839=v12066*v6538-*p;
+  v6234=v9416*v10676-*p;
+  v11651=v6393*v612-*p;
+  v7572=v15665*v6578-*p;
+  v15989=v2033*v16886-*p;
+  v15720=v7050*v18732-*p;
+  v18312=v17787*v4046-*p;
+  v13050=v15274*v15417-*p;
+  v3873=v15088*v1385-*p;
+  v3497=v12688*v19942-*p;
+  v10797=v19874*v6211-*p;
+  v3527=v7228*v18050-*p;
+  v8358=v12518*v7238-*p;
+  v15024=v5224*v9665-*p;
+  v11215=v6282*v8508-*p;
+  v19482=v19219*v8346-*p;
+  v14407=v6230*v12761-*p;
+  v10206=v2291*v6803-*p;
+  v6110=v13852*v9009-*p;
+  v7772=v19593*v16001-*p;
+  v857=v19834*v4716-*p;
+  v10851=v15315*v19931-*p;
+  v16565=v15933*v982-*p;
+  v11167=v11189*v13949-*p;
+  v4601=v16139*v5195-*p;
+  v3070=v9161*v283-*p;
+  v2581=v12120*v4730-*p;
+  v8950=v12446*v7091-*p;
+  v6557=v22*v2260-*p;
+  v885=v11586*v10024-*p;
+  v1659=v9394*v14573-*p;
+  v13745=v8424*v18255-*p;
+  v12363=v8521*v13676-*p;
+  v4991=v2198*v10532-*p;
+  v4141=v4165*v8744-*p;
+  v5644=v2977*v4086-*p;
+  v10648=v8086*v19278-*p;
+  v14280=v1682*v5313-*p;
+  v18359=v5072*v18104-*p;
+  v10562=v10260*v9634-*p;
+  v1202=v6000*v15336-*p;
+  v3264=v1169*v19003-*p;
+  v6578=v14453*v10209-*p;
+  v17627=v16798*v16467-*p;
+  v3870=v17241*v19333-*p;
+  v6398=v12125*v5258-*p;
+  v3973=v5276*v16241-*p;
+  v3086=v18611*v19906-*p;
+  v17361=v19593*v7584-*p;
+  v18096=v4636*v17755-*p;
+  v18957=v7372*v3850-*p;
+  v3536=v12366*v1240-*p;
+  v13793=v15252*v200-*p;
+  v13882=v101*v14762-*p;
+  v5892=v10695*v15918-*p;
+  v1256=v12620*v7708-*p;
+  v13324=v12503*v10958-*p;
+  v10401=v4548*v17878-*p;
+  v14269=v6552*v16790-*p;
+  v7402=v15041*v17144-*p;
+  v8146=v14730*v2710-*p;
+  v15700=v7059*v9451-*p;
+  v17672=v4696*v11504-*p;
+  v11771=v5286*v8892-*p;
+  v16533=v13885*v15490-*p;
+  v3087=v6623*v18750-*p;
+  v14964=v9366*v19600-*p;
+  v826=v4284*v14715-*p;
+  v6182=v9954*v16915-*p;
+  v4112=v434*v12911-*p;
+  v5408=v13078*v6717-*p;
+  v18212=v240*v6028-*p;
+  v5791=v7226*v4887-*p;
+  v2466=v8786*v9370-*p;
+  v3003=v19646*v11552-*p;
+  v10192=v11305*v674-*p;
+  v2241=v2282*v3900-*p;
+  v18128=v10523*v13321-*p;
+  v11253=v19344*v15925-*p;
+  v3355=v977*v14233-*p;
+  v8405=v19587*v8041-*p;
+  v16186=v1564*v10702-*p;
+  v3274=v241*v1259-*p;
+  v13447=v7899*v3372-*p;
+  v1183=v1093*v8905-*p;
+  v7289=v1234*v12013-*p;
+  v15614=v699*v4701-*p;
+  v5580=v12352*v6756-*p;
+  v17363=v16047*v9922-*p;
+  v3417=v13558*v13007-*p;
+  v14954=v10713*v4063-*p;
+  v14173=v8438*v12675-*p;
+  v1051=v18870*v2081-*p;
+  v931=v9772*v11782-*p;
+  v14202=v14792*v14941-*p;
+  v14725=v14184*v15334-*p;
+  v7458=v12966*v4242-*p;
+  v2797=v15634*v12368-*p;
+  v3152=v2403*v1163-*p;
+  v11341=v5277*v11529-*p;
+  v14244=v14306*v397-*p;
+  v1927=v11313*v9303-*p;
+  v19874=v12866*v16364-*p;
+  v9005=v19452*v10963-*p;
+  v4057=v14414*v1029-*p;
+  v355=v8514*v11436-*p;
+  v14950=v6692*v3043-*p;
+  v200=v7719*v8196-*p;
+  v17033=v15871*v10325-*p;
+  v18504=v10609*v6179-*p;
+  v8555=v14635*v837-*p;
+  v12687=v6673*v19195-*p;
+  v8133=v11629*v8519-*p;
+  v11754=v10554*v4817-*p;
+  v27=v14589*v10401-*p;
+  v4947=v4096*v541-*p;
+  v3501=v15402*v19391-*p;
+  v16392=v18645*v19523-*p;
+  v8960=v7690*v8766-*p;
+  v9808=v4481*v889-*p;
+  v12457=v7289*v5837-*p;
+  v16551=v12545*v12964-*p;
+  v6749=v7432*v15939-*p;
+  v14153=v4300*v18403-*p;
+  v19391=v4912*v16881-*p;
+  v10244=v10831*v3264-*p;
+  v2448=v3578*v5982-*p;
+  v18356=v15464*v7244-*p;
+  v4119=v6921*v12150-*p;
+  v15950=v18317*v11199-*p;
+  v15363=v3484*v12966-*p;
+  v11702=v13332*v8366-*p;
+  v1943=v12309*v8139-*p;
+  v553=v4067*v15920-*p;
+  v5159=v9436*v13200-*p;
+  v12999=v2180*v18029-*p;
+  v10814=v5884*v6321-*p;
+  v8664=v19909*v5422-*p;
+  v17713=v15745*v17263-*p;
+  v10999=v17381*v14594-*p;
+  v908=v13755*v1476-*p;
+  v8805=v19391*v12003-*p;
+  v14868=v5139*v19170-*p;
+  v5532=v19288*v8828-*p;
+  v5185=v3832*v12897-*p;
+  v16042=v7198*v3359-*p;
+  v1087=v9711*v4261-*p;
+  v2162=v18089*v14895-*p;
+  v14787=v2984*v13283-*p;
+  v5050=v5038*v10983-*p;
+  v7843=v19612*v15007-*p;
+  v1799=v18933*v3710-*p;
+  v10330=v3113*v11476-*p;
+  v12490=v17350*v5869-*p;
+  v15667=v4800*v14162-*p;
+  v5493=v851*v18021-*p;
+  v1649=v9712*v11713-*p;
+  v4087=v2299*v888-*p;
+  v11569=v5744*v1673-*p;
+  v6291=v19071*v6139-*p;
+  v9439=v18470*v375-*p;
+  v11469=v550*v1791-*p;
+  v12247=v4527*v7560-*p;
+  v4000=v17015*v2269-*p;
+  v6084=v19964*v14895-*p;
+  v19529=v14333*v13009-*p;
+  v270=v604*v17472-*p;
+  v196=v4031*v3156-*p;
+  v19303=v14758*v9922-*p;
+  v17547=v4765*v2628-*p;
+  v12141=v16544*v4328-*p;
+  v5471=v7205*v4722-*p;
+  v1370=v3237*v13998-*p;
+  v1629=v15350*v11776-*p;
+  v15465=v10244*v15971-*p;
+  v13088=v876*v9780-*p;
+  v18661=v7618*v12649-*p;
+  v15217=v18495*v6747-*p;
+  v551=v1974*v13536-*p;
+  v11019=v19185*v9738-*p;
+  v17469=v9597*v16010-*p;
+  v17762=v14463*v5331-*p;
+  v6223=v10814*v11447-*p;
+  v2593=v3174*v5058-*p;
+  v1436=v2658*v849-*p;
+  v11434=v18022*v5782-*p;
+  v18173=v1719*v8703-*p;
+  v6480=v15208*v16476-*p;
+  v5556=v10364*v4211-*p;
+  v6388=v16175*v16269-*p;
+  v19443=v7981*v9139-*p;
+  v10523=v8682*v1947-*p;
+  v19808=v12600*v9799-*p;
+  v7831=v12311*v424-*p;
+  v14772=v2767*v18778-*p;
+  v12359=v12050*v18988-*p;
+  v19381=v3334*v8441-*p;
+  v1617=v15636*v4885-*p;
+  v17558=v2683*v3893-*p;
+  v15936=v6421*v12696-*p;
+  v6114=v11993*v9604-*p;
+  v14375=v14138*v13104-*p;
+  v16194=v16583*v2711-*p;
+  v17571=v17366*v13532-*p;
+  v11497=v11775*v9043-*p;
+  v11105=v13519*v11107-*p;
+  v219=v19463*v17227-*p;
+  v5580=v14618*v9488-*p;
+  v5186=v15957*v3737-*p;
+  v10381=v19757*v2153-*p;
+  v16529=v15133*v12522-*p;
+  v16028=v18293*v475-*p;
+  v12508=v11790*v2348-*p;
+  v12348=v6502*v1868-*p;
+  v12319=v13563*v13814-*p;
+  v15465=v5916*v19057-*p;
+  v19647=v2615*v10384-*p;
+  v16490=v16119*v5270-*p;
+  v15773=v13985*v6019-*p;
+  v12168=v8492*v15668-*p;
+  v18268=v6747*v15675-*p;
+  v17388=v1342*v1381-*p;
+  v17740=v2063*v11912-*p;
+  v4412=v19788*v17410-*p;
+  v1769=v4661*v13182-*p;
+  v8122=v17930*v5839-*p;
+  v1436=v14750*v7941-*p;
+  v2093=v10529*v10197-*p;
+  v18971=v3616*v9236-*p;
+  v9245=v3317*v1441-*p;
+  v3116=v6574*v5918-*p;
+  v203=v13633*v13262-*p;
+  v3776=v6258*v7938-*p;
+  v5993=v1759*v9226-*p;
+  v13732=v2819*v18094-*p;
+  v383=v4833*v5335-*p;
+  v11725=v14671*v18303-*p;
+  v18779=v2470*v2895-*p;
+  v8604=v2539*v17015-*p;
+  v1385=v11318*v1538-*p;
+  v17964=v15745*v19500-*p;
+  v12280=v3487*v11301-*p;
+  v132=v1452*v2289-*p;
+  v14745=v18376*v2768-*p;
+  v552=v726*v13071-*p;
+  v10759=v3862*v6023-*p;
+  v10193=v5399*v476-*p;
+  v15093=v19174*v19745-*p;
+  v482=v7334*v172-*p;
+  v11924=v11526*v9446-*p;
+  v15234=v15255*v5728-*p;
+  v8159=v3063*v5405-*p;
+  v11796=v10976*v3244-*p;
+  v519=v2093*v13523-*p;
+  v18072=v10339*v1302-*p;
+  v5891=v5426*v639-*p;
+  v7369=v2507*v17906-*p;
+  v11732=v17187*v862-*p;
+  v18442=v16848*v10811-*p;
+  v1460=v11132*v6291-*p;
+  v10321=v11783*v5982-*p;
+  v1436=v13986*v15666-*p;
+  v13425=v6268*v12591-*p;
+  v12111=v17654*v13243-*p;
+  v12840=v1498*v17445-*p;
+  v9389=v19217*v11993-*p;
+  v400=v7430*v8455-*p;
+  v5121=v3167*v17126-*p;
+  v19974=v9715*v16877-*p;
+  v9097=v8729*v11017-*p;
+  v16078=v5946*v2007-*p;
+  v3135=v6685*v10444-*p;
+  v8977=v18176*v16252-*p;
+  v8064=v1464*v16921-*p;
+  v14827=v9654*v7128-*p;
+  v5504=v2183*v9274-*p;
+  v8983=v5461*v17395-*p;
+  v16260=v9014*v4492-*p;
+  v8046=v6946*v9001-*p;
+  v455=v17113*v1925-*p;
+  v8100=v19129*v19909-*p;
+  v9930=v4777*v3319-*p;
+  v8222=v8898*v16770-*p;
+  v161=v19402*v12319-*p;
+  v13501=v16411*v14784-*p;
+  v17539=v8718*v11774-*p;
+  v517=v14237*v11464-*p;
+  v13152=v1941*v14093-*p;
+  v14848=v9629*v4535-*p;
+  v19682=v873*v16742-*p;
+  v17031=v9462*v11445-*p;
+  v15732=v10925*v15076-*p;
+  v2430=v13938*v16083-*p;
+  v19186=v16492*v18586-*p;
+  v17384=v10932*v13784-*p;
+  v1050=v19423*v10471-*p;
+  v5614=v17189*v8199-*p;
+  v11903=v11776*v5127-*p;
+  v13992=v13429*v9388-*p;
+  v17948=v10318*v8025-*p;
+  v12219=v8970*v16794-*p;
+  v2082=v893*v18395-*p;
+  v10792=v271*v5404-*p;
+  v12735=v7709*v10196-*p;
+  v14218=v14258*v1178-*p;
+  v18812=v12791*v19127-*p;
+  v14447=v17819*v8927-*p;
+  v6894=v1000*v1322-*p;
+  v19372=v8543*v3327-*p;
+  v1685=v14298*v8997-*p;
+  v5077=v6993*v14255-*p;
+  v4471=v15671*v5622-*p;
+  v6487=v1190*v3330-*p;
+  v5270=v17959*v11337-*p;
+  v9126=v2973*v18120-*p;
+  v15872=v15457*v10018-*p;
+  v10133=v15690*v3301-*p;
+  v5462=v18907*v16232-*p;
+  v6272=v17135*v6388-*p;
+  v18541=v10814*v14912-*p;
+  v14132=v1962*v3220-*p;
+  v12529=v5143*v667-*p;
+  v1643=v18336*v4312-*p;
+  v8624=v18438*v8515-*p;
+  v17915=v6885*v7195-*p;
+  v8657=v17487*v3633-*p;
+  v12961=v8710*v11188-*p;
+  v6687=v6530*v16236-*p;
+  v12482=v11122*v4053-*p;
+  v7818=v17972*v5271-*p;
+  v14635=v11212*v6069-*p;
+  v17603=v7903*v1006-*p;
+  v11071=v15145*v2056-*p;
+  v10095=v19581*v2562-*p;
+  v12901=v14737*v19054-*p;
+  v1257=v18355*v13936-*p;
+  v1900=v5984*v14541-*p;
+  v18010=v12866*v2186-*p;
+  v19891=v2735*v5794-*p;
+  v17372=v19792*v4207-*p;
+  v12892=v4652*v2117-*p;
+  v4447=v3899*v6269-*p;
+  v11818=v1748*v14633-*p;
+  v18808=v13678*v8521-*p;
+  v18967=v13197*v9701-*p;
+  v8789=v4738*v14530-*p;
+  v13198=v9342*v127-*p;
+  v5733=v4744*v5352-*p;
+  v18489=v4292*v2918-*p;
+  v8519=v8240*v3159-*p;
+  v7198=v14112*v2320-*p;
+  v10615=v15210*v5364-*p;
+  v609=v16610*v897-*p;
+  v13577=v17278*v14282-*p;
+  v1044=v6794*v5400-*p;
+  v10831=v14157*v4300-*p;
+  v19378=v13087*v9876-*p;
+  v4317=v16716*v16371-*p;
+  v13700=v11608*v5152-*p;
+  v16066=v1128*v3010-*p;
+  v11077=v18281*v19913-*p;
+  v1155=v6966*v7970-*p;
+  v17299=v18791*v2673-*p;
+  v16445=v749*v15916-*p;
+  v13753=v10086*v11535-*p;
+  v18672=v19766*v430-*p;
+  v15857=v9798*v1404-*p;
+  v14479=v13907*v10068-*p;
+  v12128=v16437*v4454-*p;
+  v11979=v16685*v5556-*p;
+  v16431=v19236*v17245-*p;
+  v11534=v5511*v7800-*p;
+  v14418=v9347*v5655-*p;
+  v19108=v729*v17743-*p;
+  v19323=v652*v10346-*p;
+  v17760=v12318*v13271-*p;
+  v4535=v10326*v12555-*p;
+  v12300=v1508*v4521-*p;
+  v2269=v19039*v2669-*p;
+  v10220=v17262*v14732-*p;
+  v16645=v10442*v4124-*p;
+  v5203=v5767*v15769-*p;
+  v8937=v17859*v14723-*p;
+  v7235=v19113*v10074-*p;
+  v15375=v11148*v4901-*p;
+  v10112=v18969*v1231-*p;
+  v11362=v16031*v5243-*p;
+  v11571=v10965*v15225-*p;
+  v4581=v17160*v6522-*p;
+  v6377=v10884*v17389-*p;
+  v4506=v19294*v5131-*p;
+  v15453=v824*v19282-*p;
+  v5178=v19034*v16000-*p;
+  v10527=v15195*v3271-*p;
+  v10928=v8390*v15012-*p;
+  v9342=v2638*v9410-*p;
+  v8542=v16809*v16103-*p;
+  v11382=v494*v16494-*p;
+  v1582=v4908*v12116-*p;
+  v9858=v15780*v4549-*p;
+  v18577=v12546*v10916-*p;
+  v6997=v10921*v19746-*p;
+  v3050=v18832*v10673-*p;
+  v15920=v9191*v529-*p;
+  v6382=v10449*v8905-*p;
+  v7335=v18606*v17860-*p;
+  v10191=v3557*v4690-*p;
+  v12719=v6809*v13266-*p;
+  v18840=v2034*v17701-*p;
+  v16913=v6025*v1237-*p;
+  v6734=v3457*v2350-*p;
+  v17143=v12118*v3045-*p;
+  v15707=v18966*v5839-*p;
+  v11785=v4434*v12141-*p;
+  v17065=v9712*v16058-*p;
+  v17526=v17445*v5964-*p;
+  v1603=v8803*v7210-*p;
+  v15784=v12594*v362-*p;
+  v17425=v12894*v8411-*p;
+  v15279=v9712*v11520-*p;
+  v15246=v6208*v14998-*p;
+  v8726=v13269*v12291-*p;
+  v4730=v13360*v15468-*p;
+  v777=v7745*v2625-*p;
+  v8797=v350*v315-*p;
+  v11099=v4177*v18439-*p;
+  v10655=v19989*v17705-*p;
+  v19774=v19272*v6764-*p;
+  v155=v16506*v16304-*p;
+  v15043=v10194*v19762-*p;
+  v19427=v18544*v3665-*p;
+  v1621=v8587*v5412-*p;
+  v16740=v15932*v3816-*p;
+  v6463=v3246*v15968-*p;
+  v14709=v5554*v18179-*p;
+  v13610=v13492*v15588-*p;
+  v19404=v12559*v18402-*p;
+  v16424=v3631*v898-*p;
+  v10673=v1067*v9154-*p;
+  v1174=v3852*v14128-*p;
+  v4604=v19640*v4721-*p;
+  v12380=v9644*v19595-*p;
+  v15595=v4375*v10039-*p;
+  v16839=v16427*v11455-*p;
+  v1828=v19145*v6378-*p;
+  v14183=v1175*v9-*p;
+  v16303=v14006*v11037-*p;
+  v12282=v9508*v13783-*p;
+  v15636=v6484*v16990-*p;
+  v17019=v14512*v5532-*p;
+  v15608=v15272*v3532-*p;
+  v15135=v13662*v19-*p;
+  v15714=v8176*v11750-*p;
+  v9618=v5265*v9045-*p;
+  v277=v14659*v14737-*p;
+  v5377=v7962*v16449-*p;
+  v10770=v13299*v14136-*p;
+  v3983=v19592*v18071-*p;
+  v8715=v12375*v16124-*p;
+  v15983=v18561*v12682-*p;
+  v2871=v15857*v3232-*p;
+  v16110=v14929*v5879-*p;
+  v3655=v16707*v13583-*p;
+  v4102=v7783*v11839-*p;
+  v3364=v15415*v12945-*p;
+  v17572=v6243*v10452-*p;
+  v7721=v12187*v1539-*p;
+  v5690=v13643*v16499-*p;
+  v15046=v14136*v1378-*p;
+  v14178=v3974*v16462-*p;
+  v12921=v11360*v7404-*p;
+  v5470=v2616*v4731-*p;
+  v1525=v9093*v4825-*p;
+  v16666=v3534*v7187-*p;
+  v6565=v3722*v18432-*p;
+  v15477=v13429*v6239-*p;
+  v7795=v15486*v1025-*p;
+  v8896=v15275*v1154-*p;
+  v19841=v13686*v9276-*p;
+  v18025=v10281*v6542-*p;
+  v17498=v14461*v14860-*p;
+  v18831=v4736*v13463-*p;
+  v8062=v7234*v12633-*p;
+  v606=v13445*v7041-*p;
+  v9528=v14646*v15979-*p;
+  v18968=v13853*v18087-*p;
+  v573=v17757*v9110-*p;
+  v4717=v8485*v14722-*p;
+  v7193=v4285*v14348-*p;
+  v16829=v3070*v10046-*p;
+  v12258=v7463*v8054-*p;
+  v18770=v53*v13732-*p;
+  v146=v16387*v16397-*p;
+  v13786=v13939*v685-*p;
+  v2860=v2387*v13378-*p;
+  v18850=v19353*v896-*p;
+  v13182=v8619*v15612-*p;
+  v9119=v14383*v12822-*p;
+  v17085=v12467*v2861-*p;
+  v18951=v2454*v255-*p;
+  v4981=v4114*v16756-*p;
+  v2607=v8264*v7893-*p;
+  v12216=v8438*v6824-*p;
+  v208=v13248*v5409-*p;
+  v7519=v7036*v19981-*p;
+  v438=v9859*v3149-*p;
+  v10768=v6658*v18782-*p;
+  v13123=v1416*v14433-*p;
+  v17930=v2769*v3647-*p;
+  v10963=v16941*v10771-*p;
+  v8423=v3675*v13831-*p;
+  v7409=v11066*v10486-*p;
+  v16518=v14254*v7799-*p;
+  v1248=v13218*v15034-*p;
+  v2107=v8826*v16590-*p;
+  v17087=v11618*v3696-*p;
+  v2982=v3031*v10031-*p;
+  v12334=v15754*v2440-*p;
+  v2614=v6065*v15796-*p;
+  v8454=v19058*v3835-*p;
+  v12578=v18661*v6046-*p;
+  v3966=v747*v12773-*p;
+  v17622=v13569*v18642-*p;
+  v755=v15687*v3816-*p;
+  v13550=v15059*v952-*p;
+  v17018=v6171*v12634-*p;
+  v8167=v10340*v10403-*p;
+  v18704=v5251*v7803-*p;
+  v8171=v18863*v1272-*p;
+  v7770=v10333*v12450-*p;
+  v7622=v9477*v1804-*p;
+  v474=v1377*v5917-*p;
+  v6295=v15235*v3090-*p;
+  v7746=v1016*v5300-*p;
+  v11812=v12740*v16969-*p;
+  v5272=v3555*v9923-*p;
+  v12555=v260*v8572-*p;
+  v13578=v1823*v810-*p;
+  v15967=v10667*v13739-*p;
+  v8763=v15258*v85-*p;
+  v8536=v567*v4526-*p;
+  v5519=v2654*v737-*p;
+  v14704=v12460*v6687-*p;
+  v7163=v13728*v15542-*p;
+  v9971=v11142*v18098-*p;
+  v19171=v10258*v5031-*p;
+  v6317=v5621*v9656-*p;
+  v14080=v475*v11233-*p;
+  v7146=v16203*v15543-*p;
+  v3299=v3344*v5692-*p;
+  v6105=v11408*v13113-*p;
+  v11617=v17923*v4545-*p;
+  v1824=v18774*v7268-*p;
+  v916=v4232*v1298-*p;
+  v16882=v4076*v18130-*p;
+  v5181=v8885*v3816-*p;
+  v267=v7137*v18200-*p;
+  v2000=v9724*v17958-*p;
+  v18590=v14849*v4359-*p;
+  v1751=v4977*v18783-*p;
+  v6666=v1404*v1479-*p;
+  v19936=v7373*v1651-*p;
+  v1069=v6239*v1693-*p;
+  v10263=v18153*v15136-*p;
+  v19824=v1020*v1585-*p;
+  v14246=v1340*v666-*p;
+  v3969=v2268*v14858-*p;
+  v10834=v10213*v6594-*p;
+  v2425=v6758*v2223-*p;
+  v19281=v927*v3236-*p;
+  v11422=v8126*v7050-*p;
+  v13982=v13303*v7966-*p;
+  v5474=v12807*v6564-*p;
+  v16143=v9571*v17287-*p;
+  v5892=v6408*v5195-*p;
+  v6195=v3566*v18214-*p;
+  v1782=v6580*v386-*p;
+  v7442=v3221*v12663-*p;
+  v13241=v3023*v12869-*p;
+  v5830=v2516*v19788-*p;
+  v3559=v17104*v15945-*p;
+  v9137=v19883*v17436-*p;
+  v1351=v18275*v1815-*p;
+  v7409=v2926*v17775-*p;
+  v7354=v14336*v16571-*p;
+  v2740=v12063*v5823-*p;
+  v9977=v19486*v8481-*p;
+  v10864=v4811*v10939-*p;
+  v11090=v1848*v836-*p;
+  v6283=v6999*v16895-*p;
+  v11861=v19513*v9426-*p;
+  v15010=v3379*v704-*p;
+  v12974=v8612*v5780-*p;
+  v15879=v8732*v12056-*p;
+  v14319=v14238*v12211-*p;
+  v8721=v10517*v15311-*p;
+  v8366=v6089*v2322-*p;
+  v9506=v16826*v1207-*p;
+  v6860=v5444*v13575-*p;
+  v18924=v8944*v1777-*p;
+  v11910=v2125*v2695-*p;
+  v18866=v4084*v8081-*p;
+  v17615=v11367*v4197-*p;
+  v8705=v17742*v4726-*p;
+  v14914=v9548*v9133-*p;
+  v316=v12184*v2873-*p;
+  v5994=v14715*v18790-*p;
+  v7311=v18624*v15294-*p;
+  v16278=v7570*v1906-*p;
+  v3069=v3139*v7445-*p;
+  v12578=v6823*v14156-*p;
+  v18416=v1600*v18369-*p;
+  v19661=v4404*v19350-*p;
+  v8570=v14609*v195-*p;
+  v12591=v5923*v3095-*p;
+  v15984=v15521*v15769-*p;
+  v13888=v11698*v9156-*p;
+  v13914=v11442*v7471-*p;
+  v5665=v6402*v10996-*p;
+  v5498=v17460*v9626-*p;
+  v8721=v15709*v6786-*p;
+  v16325=v8115*v12417-*p;
+  v18449=v3058*v71-*p;
+  v5962=v3817*v8782-*p;
+  v5142=v5787*v18515-*p;
+  v12805=v5999*v1196-*p;
+  v13652=v8818*v17721-*p;
+  v1185=v19267*v12841-*p;
+  v6123=v3679*v10502-*p;
+  v14099=v8274*v1565-*p;
+  v7850=v4269*v12845-*p;
+  v2352=v7573*v17567-*p;
+  v14114=v9413*v1109-*p;
+  v13808=v3117*v6111-*p;
+  v15840=v14605*v10197-*p;
+  v19361=v5198*v12997-*p;
+  v6349=v16816*v11672-*p;
+  v11691=v1071*v909-*p;
+  v7477=v18355*v13690-*p;
+  v5844=v6655*v3911-*p;
+  v5437=v7754*v12978-*p;
+  v2042=v12817*v2067-*p;
+  v4740=v6273*v17999-*p;
+  v7952=v6996*v18245-*p;
+  v9850=v10921*v15531-*p;
+  v9605=v1045*v8084-*p;
+  v3068=v10830*v3022-*p;
+  v3914=v7586*v15450-*p;
+  v19679=v4381*v2304-*p;
+  v886=v8619*v19238-*p;
+  v3115=v7491*v7311-*p;
+  v15214=v14290*v14398-*p;
+  v15010=v13310*v10346-*p;
+  v11842=v5086*v7934-*p;
+  v1358=v10787*v2559-*p;
+  v18045=v18625*v4702-*p;
+  v15803=v6863*v14519-*p;
+  v13626=v10975*v2734-*p;
+  v18829=v10025*v17974-*p;
+  v8895=v18396*v2561-*p;
+  v561=v15630*v4893-*p;
+  v12556=v1180*v15271-*p;
+  v18285=v1224*v1039-*p;
+  v9480=v15251*v17358-*p;
+  v16162=v16507*v1047-*p;
+  v10332=v10405*v1542-*p;
+  v14861=v5047*v16547-*p;
+  v7772=v17133*v9736-*p;
+  v9010=v4657*v5599-*p;
+  v18457=v13165*v33-*p;
+  v17679=v9981*v19690-*p;
+  v15586=v10118*v18854-*p;
+  v1480=v12175*v10482-*p;
+  v4143=v8862*v8225-*p;
+  v16403=v19507*v5465-*p;
+  v10210=v4159*v562-*p;
+  v8124=v11920*v9365-*p;
+  v9538=v6361*v4224-*p;
+  v18268=v6751*v1008-*p;
+  v4284=v16246*v17346-*p;
+  v16849=v18065*v5641-*p;
+  v12700=v19232*v9600-*p;
+  v17473=v12718*v2984-*p;
+  v17337=v13578*v6117-*p;
+  v16140=v12675*v4508-*p;
+  v11091=v18241*v15843-*p;
+  v17056=v8553*v8408-*p;
+  v7683=v15865*v1785-*p;
+  v12517=v4938*v6224-*p;
+  v12960=v2339*v4918-*p;
+  v15212=v17072*v6606-*p;
+  v12024=v5069*v16319-*p;
+  v6204=v2830*v3950-*p;
+  v18264=v16031*v10501-*p;
+  v4868=v19808*v19189-*p;
+  v6859=v11574*v8634-*p;
+  v17265=v8026*v337-*p;
+  v15936=v3916*v17636-*p;
+  v14293=v15475*v10667-*p;
+  v16901=v17606*v11272-*p;
+  v7393=v8621*v12756-*p;
+  v11374=v6881*v1059-*p;
+  v19461=v2580*v268-*p;
+  v13204=v11363*v11789-*p;
+  v15713=v10400*v3289-*p;
+  v4200=v3772*v13732-*p;
+  v7760=v1096*v4296-*p;
+  v5217=v16212*v6774-*p;
+  v4375=v8969*v2450-*p;
+  v15557=v5583*v5579-*p;
+  v16303=v10597*v4673-*p;
+  v14850=v3204*v11142-*p;
+  v18800=v9595*v4716-*p;
+  v2736=v3683*v7625-*p;
+  v19792=v14175*v6731-*p;
+  v2106=v10461*v5288-*p;
+  v18567=v17018*v9536-*p;
+  v2351=v19742*v7839-*p;
+  v15939=v16925*v1259-*p;
+  v6022=v8583*v11886-*p;
+  v12032=v847*v13958-*p;
+  v285=v507*v10988-*p;
+  v6914=v12513*v4007-*p;
+  v10694=v6769*v16129-*p;
+  v17727=v8525*v3046-*p;
+  v7060=v18927*v9180-*p;
+  v15331=v4174*v9396-*p;
+  v13563=v6013*v8621-*p;
+  v16072=v8651*v1738-*p;
+  v19246=v19281*v12785-*p;
+  v1336=v19394*v14430-*p;
+  v11326=v10820*v6754-*p;
+  v8972=v6125*v5484-*p;
+  v603=v15680*v6135-*p;
+  v9966=v8478*v17690-*p;
+  v15021=v762*v15435-*p;
+  v5065=v15622*v6310-*p;
+  v6079=v4254*v7375-*p;
+  v14825=v13862*v8300-*p;
+  v1762=v15460*v4435-*p;
+  v19428=v6661*v6552-*p;
+  v9478=v11413*v1528-*p;
+  v17170=v2681*v15435-*p;
+  v19995=v10643*v14799-*p;
+  v8398=v6825*v8713-*p;
+  v4024=v6542*v12466-*p;
+  v194=v16898*v4663-*p;
+  v11580=v5497*v15330-*p;
+  v10463=v16551*v1624-*p;
+  v3799=v1038*v19116-*p;
+  v10024=v10542*v11422-*p;
+  v2715=v7481*v4289-*p;
+  v9355=v6492*v2228-*p;
+  v9934=v3933*v17505-*p;
+  v2264=v3459*v18700-*p;
+  v2020=v17130*v13684-*p;
+  v4418=v11423*v2542-*p;
+  v19155=v5062*v6003-*p;
+  v5263=v7505*v6143-*p;
+  v10419=v4250*v5290-*p;
+  v1276=v5045*v1831-*p;
+  v14069=v19855*v9780-*p;
+  v5267=v11703*v17480-*p;
+  v6157=v16923*v7613-*p;
+  v394=v8348*v3657-*p;
+  v12344=v4994*v1725-*p;
+  v8251=v17120*v17058-*p;
+  v15868=v11785*v13882-*p;
+  v15026=v14963*v4837-*p;
+  v8368=v11902*v917-*p;
+  v19633=v17530*v5994-*p;
+  v4327=v14545*v19900-*p;
+  v12406=v15665*v3647-*p;
+  v8289=v8808*v3723-*p;
+  v19077=v8311*v5132-*p;
+  v11249=v2163*v17962-*p;
+  v1378=v11777*v6086-*p;
+  v1675=v3815*v458-*p;
+  v17530=v10526*v8619-*p;
+  v4422=v19561*v3466-*p;
+  v5337=v10740*v16682-*p;
+  v17395=v5142*v10358-*p;
+  v5882=v19256*v2455-*p;
+  v5542=v15637*v6485-*p;
+  v17136=v18021*v13057-*p;
+  v2905=v19038*v11972-*p;
+  v12716=v2423*v16910-*p;
+  v15593=v13044*v6488-*p;
+  v17870=v7118*v10397-*p;
+  v2682=v2113*v7031-*p;
+  v2250=v6566*v17207-*p;
+  v14574=v6618*v2339-*p;
+  v16212=v10362*v9762-*p;
+  v1863=v17560*v11361-*p;
+  v9046=v11878*v19279-*p;
+  v6357=v12630*v3312-*p;
+  v4667=v11505*v12005-*p;
+  v19874=v10523*v14109-*p;
+  v18142=v15065*v2045-*p;
+  v15524=v15627*v3631-*p;
+  v12017=v18366*v1872-*p;
+  v902=v18541*v14471-*p;
+  v638=v16282*v1825-*p;
+  v17336=v11259*v6614-*p;
+  v11776=v5510*v1363-*p;
+  v19860=v8490*v2484-*p;
+  v7196=v11186*v7632-*p;
+  v7741=v18427*v11189-*p;
+  v3198=v12905*v1363-*p;
+  v18623=v8246*v18162-*p;
+  v13904=v410*v11393-*p;
+  v5339=v5901*v3637-*p;
+  v17551=v12192*v3048-*p;
+  v13294=v8583*v19582-*p;
+  v13486=v2454*v18862-*p;
+  v10913=v17025*v12226-*p;
+  v14449=v15416*v2108-*p;
+  v19451=v157*v15162-*p;
+  v6024=v10844*v11818-*p;
+  v18043=v213*v7774-*p;
+  v17574=v1992*v3098-*p;
+  v15358=v9753*v3300-*p;
+  v8476=v2559*v9379-*p;
+  v6249=v12194*v7070-*p;
+  v15385=v18743*v3116-*p;
+  v3055=v16607*v18375-*p;
+  v9286=v3491*v3546-*p;
+  v19594=v12781*v17981-*p;
+  v232=v10108*v4959-*p;
+  v4671=v5302*v10087-*p;
+  v15450=v16625*v5410-*p;
+  v1442=v3738*v13478-*p;
+  v10637=v8009*v2819-*p;
+  v5836=v6204*v13893-*p;
+  v12448=v5614*v6572-*p;
+  v2744=v11163*v852-*p;
+  v7219=v5306*v16150-*p;
+  v16221=v11123*v6802-*p;
+  v16520=v11696*v7134-*p;
+  v10643=v4721*v2958-*p;
+  v353=v10046*v8383-*p;
+  v10678=v707*v14425-*p;
+  v2826=v8740*v3474-*p;
+  v16394=v5291*v15090-*p;
+  v10364=v14604*v12831-*p;
+  v14108=v17207*v8103-*p;
+  v17739=v3135*v897-*p;
+  v9861=v13702*v2367-*p;
+  v1728=v19543*v15161-*p;
+  v14965=v19502*v885-*p;
+  v17602=v10772*v19240-*p;
+  v10666=v881*v17764-*p;
+  v10577=v12302*v9327-*p;
+  v10824=v13726*v10600-*p;
+  v19711=v3415*v992-*p;
+  v5645=v1046*v5836-*p;
+  v3373=v6499*v5121-*p;
+  v8669=v3521*v10063-*p;
+  v4978=v8400*v17008-*p;
+  v8619=v17367*v14001-*p;
+  v6764=v1723*v17539-*p;
+  v15701=v19442*v2720-*p;
+  v2790=v2843*v13395-*p;
+  v821=v11730*v597-*p;
+  v14967=v6937*v1343-*p;
+  v183=v5895*v440-*p;
+  v19359=v14935*v16834-*p;
+  v15743=v9486*v9913-*p;
+  v19073=v3309*v3474-*p;
+  v1308=v17492*v19359-*p;
+  v11615=v11609*v10444-*p;
+  v4870=v6472*v10083-*p;
+  v1770=v4152*v10388-*p;
+  v19441=v14*v1679-*p;
+  v16920=v8955*v13886-*p;
+  v17541=v14144*v19628-*p;
+  v17337=v5325*v14654-*p;
+  v8531=v6012*v3608-*p;
+  v17432=v12027*v12202-*p;
+  v9619=v8749*v6099-*p;
+  v6001=v4507*v11914-*p;
+  v11136=v17288*v17034-*p;
+  v12243=v19538*v17570-*p;
+  v10980=v15198*v7290-*p;
+  v19865=v5187*v2127-*p;
+  v15631=v19862*v18606-*p;
+  v18346=v19726*v4150-*p;
+  v3288=v1435*v3287-*p;
+  v18075=v11054*v2953-*p;
+  v8759=v4086*v14382-*p;
+  v16369=v14594*v8991-*p;
+  v6712=v3390*v7717-*p;
+  v1744=v4421*v1624-*p;
+  v12722=v19067*v8387-*p;
+  v18081=v2944*v1209-*p;
+  v15172=v11895*v16055-*p;
+  v14425=v18711*v10270-*p;
+  v5404=v8383*v8360-*p;
+  v19125=v1079*v18847-*p;
+  v4785=v14670*v11799-*p;
+  v4006=v19161*v19744-*p;
+  v2576=v14218*v12401-*p;
+  v5708=v2424*v10071-*p;
+  v14030=v13190*v1571-*p;
+  v1327=v1864*v11923-*p;
+  v13725=v12463*v10266-*p;
+  v4239=v721*v17737-*p;
+  v16703=v17399*v18984-*p;
+  v12802=v695*v19236-*p;
+  v5131=v1381*v6661-*p;
+  v16036=v9143*v2794-*p;
+  v595=v9706*v16131-*p;
+  v13098=v5102*v1242-*p;
+  v597=v5674*v15723-*p;
+  v18933=v3255*v14662-*p;
+  v12877=v2198*v14779-*p;
+  v9393=v10682*v13541-*p;
+  v7703=v14001*v10437-*p;
+  v3742=v3547*v10150-*p;
+  v5665=v5722*v363-*p;
+  v5131=v18881*v18189-*p;
+  v2660=v13750*v16093-*p;
+  v2813=v4835*v17788-*p;
+  v17095=v14927*v1210-*p;
+  v19124=v9306*v8551-*p;
+  v13602=v12549*v7247-*p;
+  v7478=v2848*v10129-*p;
+  v1960=v15890*v13344-*p;
+  v2923=v6162*v14003-*p;
+  v7576=v17943*v9748-*p;
+  v17546=v11286*v4228-*p;
+  v12144=v11524*v17068-*p;
+  v19077=v2143*v12820-*p;
+  v17461=v12803*v2918-*p;
+  v13718=v4808*v12302-*p;
+  v3186=v9927*v2185-*p;
+  v12679=v16885*v19119-*p;
+  v11265=v1032*v7733-*p;
+  v8228=v11191*v8449-*p;
+  v14266=v11094*v19363-*p;
+  v17914=v4145*v4363-*p;
+  v19872=v4827*v5591-*p;
+  v3219=v6786*v3941-*p;
+  v15747=v16729*v8195-*p;
+  v8441=v15026*v4999-*p;
+  v19172=v2956*v14840-*p;
+  v11931=v14051*v11670-*p;
+  v14263=v7404*v8687-*p;
+  v13622=v6440*v12633-*p;
+  v15349=v4331*v1732-*p;
+  v4940=v3591*v10757-*p;
+  v17727=v16480*v19534-*p;
+  v14613=v8186*v9144-*p;
+  v2880=v18118*v18545-*p;
+  v2124=v1282*v11495-*p;
+  v225=v11955*v7447-*p;
+  v4526=v2353*v13068-*p;
+  v6870=v18441*v16105-*p;
+  v268=v13124*v8382-*p;
+  v15181=v6619*v9414-*p;
+  v15335=v8794*v8608-*p;
+  v7942=v5742*v3878-*p;
+  v9742=v16361*v18359-*p;
+  v16761=v4728*v10081-*p;
+  v2797=v6330*v1673-*p;
+  v18213=v13037*v19786-*p;
+  v10029=v18356*v7596-*p;
+  v19853=v17758*v10380-*p;
+  v17543=v6781*v19400-*p;
+  v4081=v8878*v16127-*p;
+  v13446=v14176*v16322-*p;
+  v14790=v12505*v19921-*p;
+  v9067=v17247*v10576-*p;
+  v11694=v10965*v6162-*p;
+  v14599=v18493*v19439-*p;
+  v2845=v4578*v2498-*p;
+  v1192=v2423*v1122-*p;
+  v2300=v10791*v11966-*p;
+  v4624=v6133*v11343-*p;
+  v8790=v124*v4651-*p;
+  v626=v18800*v6595-*p;
+  v10056=v15810*v13714-*p;
+  v7813=v18209*v3753-*p;
+  v15121=v6952*v2311-*p;
+  v19733=v19471*v17645-*p;
+  v1670=v7749*v4212-*p;
+  v17805=v14547*v3471-*p;
+  v8463=v7610*v10575-*p;
+  v12365=v9225*v11258-*p;
+  v6911=v2173*v6756-*p;
+  v556=v4631*v3682-*p;
+  v1056=v14167*v18646-*p;
+  v6681=v11235*v4310-*p;
+  v6374=v19033*v8016-*p;
+  v17970=v14363*v7754-*p;
+  v16409=v16839*v13005-*p;
+  v6012=v362*v14507-*p;
+  v18454=v414*v3004-*p;
+  v2548=v2279*v15368-*p;
+  v14420=v11164*v8017-*p;
+  v1549=v7797*v1540-*p;
+  v2549=v17299*v2517-*p;
+  v8698=v2602*v1015-*p;
+  v4657=v5181*v3264-*p;
+  v14027=v2933*v12322-*p;
+  v1425=v14744*v1241-*p;
+  v6477=v9687*v4576-*p;
+  v9080=v15328*v3867-*p;
+  v16524=v12544*v706-*p;
+  v5565=v11681*v15175-*p;
+  v17806=v7573*v9258-*p;
+  v1244=v6847*v17580-*p;
+  v2720=v18131*v10095-*p;
+  v7197=v10004*v11792-*p;
+  v97=v4568*v17821-*p;
+  v17127=v5176*v19698-*p;
+  v3259=v1385*v19749-*p;
+  v9637=v8851*v19732-*p;
+  v12228=v15767*v2708-*p;
+  v3291=v1237*v151-*p;
+  v18623=v19189*v2828-*p;
+  v12075=v9266*v18216-*p;
+  v2770=v3929*v17708-*p;
+  v19345=v6651*v11230-*p;
+  v17717=v2558*v399-*p;
+  v13332=v15952*v11644-*p;
+  v19591=v11380*v191-*p;
+  v833=v5653*v2605-*p;
+  v9315=v3493*v10754-*p;
+  v17273=v17059*v14580-*p;
+  v14958=v1351*v1958-*p;
+  v9792=v7628*v2390-*p;
+  v15994=v9123*v13133-*p;
+  v6915=v7953*v3114-*p;
+  v13497=v2757*v4379-*p;
+  v579=v9914*v19951-*p;
+  v4417=v16132*v10441-*p;
+  v5060=v11567*v7036-*p;
+  v14216=v11716*v15500-*p;
+  v16214=v7198*v17061-*p;
+  v3195=v14721*v5319-*p;
+  v15304=v6005*v8373-*p;
+  v9210=v16602*v2240-*p;
+  v6826=v10400*v762-*p;
+  v13424=v6209*v8235-*p;
+  v17290=v9208*v15580-*p;
+  v10095=v6830*v5876-*p;
+  v16804=v13157*v9036-*p;
+  v6018=v3431*v1706-*p;
+  v6824=v19008*v518-*p;
+  v11490=v16421*v19208-*p;
+  v2306=v3717*v4268-*p;
+  v8659=v2223*v16973-*p;
+  v488=v6317*v4252-*p;
+  v6290=v7741*v18860-*p;
+  v9179=v11668*v3167-*p;
+  v16744=v4991*v2084-*p;
+  v10674=v19960*v8968-*p;
+  v216=v9021*v454-*p;
+  v15586=v3998*v7019-*p;
+  v12425=v2662*v4894-*p;
+  v11003=v16898*v19057-*p;
+  v9606=v1546*v7151-*p;
+  v9492=v13087*v9061-*p;
+  v18846=v14085*v8106-*p;
+  v6659=v9944*v10718-*p;
+  v8738=v10137*v4451-*p;
+  v18227=v11471*v9429-*p;
+  v3108=v16680*v16149-*p;
+  v1952=v1288*v1976-*p;
+  v16090=v1296*v11149-*p;
+  v9319=v17920*v5567-*p;
+  v19006=v2876*v11343-*p;
+  v5644=v19268*v5270-*p;
+  v10337=v6066*v17354-*p;
+  v4876=v3725*v11365-*p;
+  v18405=v4547*v8019-*p;
+  v15408=v12794*v5370-*p;
+  v3835=v8339*v13280-*p;
+  v12203=v16440*v17285-*p;
+  v14175=v19258*v623-*p;
+  v3532=v14708*v19602-*p;
+  v1184=v4690*v13558-*p;
+  v11370=v11408*v7085-*p;
+  v4186=v1155*v1954-*p;
+  v10244=v16578*v7335-*p;
+  v3912=v15705*v17223-*p;
+  v4751=v10692*v219-*p;
+  v3499=v8664*v16753-*p;
+  v12344=v9197*v9276-*p;
+  v9090=v14121*v17827-*p;
+  v16289=v14158*v3158-*p;
+  v10281=v10235*v6177-*p;
+  v19072=v18422*v2167-*p;
+  v12796=v1070*v15775-*p;
+  v9921=v19847*v9022-*p;
+  v7313=v12039*v124-*p;
+  v12422=v18133*v9361-*p;
+  v3297=v14095*v12409-*p;
+  v14431=v8989*v13084-*p;
+  v6399=v11675*v12293-*p;
+  v5467=v3149*v15170-*p;
+  v10865=v2683*v8989-*p;
+  v11379=v6178*v9408-*p;
+  v11876=v8289*v12341-*p;
+  v3062=v3642*v864-*p;
+  v18161=v12904*v521-*p;
+  v14126=v7433*v8068-*p;
+  v1760=v4687*v2233-*p;
+  v15447=v8759*v539-*p;
+  v6170=v17497*v15935-*p;
+  v10047=v19343*v3629-*p;
+  v7191=v15749*v16175-*p;
+  v17737=v13693*v14896-*p;
+  v16222=v12244*v1731-*p;
+  v11581=v8178*v19198-*p;
+  v6284=v13026*v7673-*p;
+  v6980=v9169*v10748-*p;
+  v1757=v6017*v11849-*p;
+  v7795=v6760*v2948-*p;
+  v7289=v13175*v3077-*p;
+  v6468=v16783*v11997-*p;
+  v2418=v11645*v4756-*p;
+  v8461=v9488*v7812-*p;
+  v17501=v10741*v649-*p;
+  v15525=v10532*v8701-*p;
+  v12367=v12529*v14844-*p;
+  v19697=v1822*v9004-*p;
+  v8706=v2442*v7925-*p;
+  v8114=v18654*v4000-*p;
+  v12128=v4278*v1572-*p;
+  v2561=v2162*v800-*p;
+  v19735=v5375*v5877-*p;
+  v12935=v17985*v6190-*p;
+  v4882=v13227*v13097-*p;
+  v11996=v410*v10858-*p;
+  v662=v13359*v5610-*p;
+  v257=v1373*v18497-*p;
+  v4661=v13836*v16613-*p;
+  v16594=v17379*v8375-*p;
+  v14171=v9365*v17364-*p;
+  v2577=v13910*v19139-*p;
+  v2842=v9935*v880-*p;
+  v3826=v5154*v4291-*p;
+  v6672=v17211*v14470-*p;
+  v10565=v375*v18557-*p;
+  v8793=v7051*v2066-*p;
+  v9405=v6322*v324-*p;
+  v10792=v9326*v18735-*p;
+  v15438=v13024*v4641-*p;
+  v18364=v9502*v18808-*p;
+  v19248=v4795*v14635-*p;
+  v9597=v4010*v10633-*p;
+  v14951=v716*v5771-*p;
+  v608=v3638*v1292-*p;
+  v697=v9727*v13812-*p;
+  v1340=v5814*v7614-*p;
+  v1118=v4154*v2510-*p;
+  v2762=v13125*v14502-*p;
+  v1805=v10378*v5966-*p;
+  v3115=v6622*v16345-*p;
+  v14992=v9921*v1847-*p;
+  v19623=v12490*v16137-*p;
+  v13961=v65*v10896-*p;
+  v14602=v17553*v1130-*p;
+  v6321=v7866*v12050-*p;
+  v193=v16136*v3039-*p;
+  v13099=v5535*v2545-*p;
+  v168=v11919*v2223-*p;
+  v13570=v8053*v1854-*p;
+  v17999=v7097*v16017-*p;
+  v6280=v6660*v10591-*p;
+  v8785=v16141*v17383-*p;
+  v4148=v11331*v13138-*p;
+  v18212=v14289*v3178-*p;
+  v8901=v643*v17347-*p;
+  v17223=v19936*v11979-*p;
+  v14689=v11287*v19764-*p;
+  v16843=v11275*v1058-*p;
+  v7259=v10773*v487-*p;
+  v12382=v7560*v15263-*p;
+  v15583=v13651*v2321-*p;
+  v10352=v3139*v458-*p;
+  v1113=v9337*v3120-*p;
+  v3721=v3383*v5328-*p;
+  v16600=v14027*v1491-*p;
+  v11943=v11663*v8830-*p;
+  v1809=v8257*v2566-*p;
+  v8222=v6722*v14362-*p;
+  v7318=v4428*v406-*p;
+  v15660=v2826*v7050-*p;
+  v8163=v18780*v6602-*p;
+  v3751=v16834*v14291-*p;
+  v6141=v12008*v3948-*p;
+  v11190=v12317*v4336-*p;
+  v17455=v8629*v14155-*p;
+  v14677=v18772*v19671-*p;
+  v13024=v4093*v12659-*p;
+  v18961=v207*v11525-*p;
+  v8658=v7692*v14930-*p;
+  v5263=v9975*v15091-*p;
+  v15162=v2298*v13986-*p;
+  v18773=v16861*v13359-*p;
+  v14951=v2341*v16135-*p;
+  v19392=v1290*v13422-*p;
+  v10879=v6157*v8936-*p;
+  v16751=v16455*v10121-*p;
+  v4019=v15109*v17113-*p;
+  v1728=v9929*v4013-*p;
+  v8777=v4827*v34-*p;
+  v3713=v17756*v2875-*p;
+  v1615=v2478*v2508-*p;
+  v3913=v13186*v14508-*p;
+  v4303=v16972*v16649-*p;
+  v9018=v7397*v16114-*p;
+  v682=v5281*v14222-*p;
+  v4105=v16737*v4217-*p;
+  v4062=v4854*v14118-*p;
+  v6853=v7592*v18878-*p;
+  v14162=v5360*v9953-*p;
+  v3934=v13194*v790-*p;
+  v2989=v8072*v5926-*p;
+  v3381=v2179*v2106-*p;
+  v17995=v3255*v17916-*p;
+  v13248=v15748*v8691-*p;
+  v19095=v7786*v8978-*p;
+  v7263=v5434*v740-*p;
+  v18097=v832*v767-*p;
+  v2806=v11877*v8303-*p;
+  v7443=v4309*v10695-*p;
+  v11594=v5450*v10091-*p;
+  v8344=v5564*v7230-*p;
+  v14384=v17445*v5677-*p;
+  v16068=v13436*v18426-*p;
+  v2537=v14045*v14643-*p;
+  v14751=v7715*v5400-*p;
+  v5739=v11970*v8105-*p;
+  v10899=v1181*v19246-*p;
+  v4488=v22*v14724-*p;
+  v16503=v3130*v13291-*p;
+  v10936=v15668*v5517-*p;
+  v930=v13677*v15007-*p;
+  v1561=v1992*v9894-*p;
+  v11569=v16149*v15227-*p;
+  v10521=v6479*v11498-*p;
+  v16782=v9986*v2732-*p;
+  v4727=v10323*v19193-*p;
+  v1531=v16311*v16782-*p;
+  v5777=v3908*v2473-*p;
+  v12451=v2343*v1298-*p;
+  v4049=v4946*v702-*p;
+  v10881=v9078*v14958-*p;
+  v17919=v3393*v19413-*p;
+  v2071=v18393*v16537-*p;
+  v10193=v17358*v17497-*p;
+  v3157=v15408*v19746-*p;
+  v6244=v9280*v10858-*p;
+  v6830=v14484*v11507-*p;
+  v2723=v17682*v19576-*p;
+  v19525=v15124*v17610-*p;
+  v11917=v230*v2411-*p;
+  v15619=v18389*v11775-*p;
+  v12503=v11914*v7421-*p;
+  v5434=v12120*v14312-*p;
+  v7127=v11588*v10163-*p;
+  v8226=v18322*v15884-*p;
+  v14070=v5795*v6980-*p;
+  v13686=v5743*v16672-*p;
+  v4894=v325*v4904-*p;
+  v12566=v11668*v5726-*p;
+  v11485=v15227*v15456-*p;
+  v9652=v6812*v13100-*p;
+  v19228=v3345*v15480-*p;
+  v11130=v3382*v2725-*p;
+  v10430=v10143*v4759-*p;
+  v75=v13016*v17848-*p;
+  v15249=v8206*v16076-*p;
+  v15427=v10592*v1578-*p;
+  v18603=v778*v4013-*p;
+  v19484=v16461*v2227-*p;
+  v16121=v4150*v12354-*p;
+  v2207=v12626*v12890-*p;
+  v15960=v6636*v1307-*p;
+  v1088=v14554*v11800-*p;
+  v4079=v19909*v12492-*p;
+  v16954=v19806*v7968-*p;
+  v6881=v988*v19506-*p;
+  v3975=v4436*v12015-*p;
+  v3036=v19805*v2178-*p;
+  v210=v7698*v9319-*p;
+  v15149=v10558*v9930-*p;
+  v3345=v10223*v16951-*p;
+  v4259=v15150*v7610-*p;
+  v8703=v7342*v3052-*p;
+  v17648=v14840*v14106-*p;
+  v7639=v18542*v16024-*p;
+  v1160=v18595*v1596-*p;
+  v18033=v8767*v4748-*p;
+  v16492=v17467*v6625-*p;
+  v3578=v10275*v1969-*p;
+  v17967=v16612*v10034-*p;
+  v15728=v3044*v9863-*p;
+  v16774=v6623*v8099-*p;
+  v4472=v1483*v15272-*p;
+  v15642=v18937*v18214-*p;
+  v18359=v738*v5830-*p;
+  v4671=v10557*v6351-*p;
+  v16276=v9102*v965-*p;
+  v4270=v18969*v3851-*p;
+  v940=v11324*v1031-*p;
+  v15246=v17265*v9975-*p;
+  v4770=v19324*v2220-*p;
+  v5=v4482*v13923-*p;
+  v683=v4591*v6090-*p;
+  v7482=v14133*v16311-*p;
+  v17160=v17908*v5929-*p;
+  v12456=v17169*v4209-*p;
+  v10193=v7555*v14499-*p;
+  v19337=v11205*v3018-*p;
+  v14379=v12328*v4308-*p;
+  v5847=v3632*v5404-*p;
+  v1699=v509*v7369-*p;
+  v12744=v17416*v15589-*p;
+  v1953=v789*v6558-*p;
+  v13513=v9563*v3718-*p;
+  v15370=v18281*v19687-*p;
+  v11079=v6228*v3936-*p;
+  v16405=v4192*v341-*p;
+  v4752=v11995*v19030-*p;
+  v1619=v3588*v8211-*p;
+  v15895=v16771*v18978-*p;
+  v14427=v1652*v14232-*p;
+  v13733=v14825*v3093-*p;
+  v14892=v18157*v8502-*p;
+  v17043=v5681*v14951-*p;
+  v12680=v2994*v11767-*p;
+  v18324=v12080*v1423-*p;
+  v8548=v16880*v15843-*p;
+  v19885=v12691*v8220-*p;
+  v12933=v4746*v9631-*p;
+  v17032=v6169*v1015-*p;
+  v1852=v4627*v15267-*p;
+  v16084=v2155*v5609-*p;
+  v4046=v1201*v10720-*p;
+  v1057=v13613*v4641-*p;
+  v18703=v2088*v16270-*p;
+  v15010=v1580*v3747-*p;
+  v14237=v17476*v7279-*p;
+  v7411=v10701*v18276-*p;
+  v14181=v15392*v17614-*p;
+  v14490=v14177*v17395-*p;
+  v13523=v1549*v4248-*p;
+  v8581=v15094*v18185-*p;
+  v16124=v2213*v14830-*p;
+  v1570=v5201*v11205-*p;
+  v12417=v17085*v13443-*p;
+  v7167=v2330*v1155-*p;
+  v480=v19495*v19449-*p;
+  v10319=v8580*v14982-*p;
+  v264=v4284*v9496-*p;
+  v15197=v6538*v10210-*p;
+  v13022=v12933*v5848-*p;
+  v10400=v15983*v7295-*p;
+  v2273=v17797*v13191-*p;
+  v8279=v11388*v4271-*p;
+  v1684=v10933*v3135-*p;
+  v249=v5144*v1132-*p;
+  v198=v18954*v11045-*p;
+  v10897=v8007*v4203-*p;
+  v7781=v11548*v15110-*p;
+  v4087=v18733*v2849-*p;
+  v3730=v15469*v8191-*p;
+  v19669=v6737*v1532-*p;
+  v8988=v15173*v12865-*p;
+  v7898=v12815*v1177-*p;
+  v3857=v14377*v11931-*p;
+  v17041=v18960*v5856-*p;
+  v816=v4256*v12108-*p;
+  v12322=v19768*v8764-*p;
+  v11527=v18622*v3124-*p;
+  v13807=v10458*v58-*p;
+  v3827=v18036*v17876-*p;
+  v8122=v2081*v11841-*p;
+  v2112=v10821*v5533-*p;
+  v3844=v406*v15812-*p;
+  v3625=v6874*v4447-*p;
+  v1408=v6073*v5401-*p;
+  v12628=v4490*v11828-*p;
+  v242=v19901*v15545-*p;
+  v12846=v1975*v415-*p;
+  v15787=v12655*v9385-*p;
+  v14872=v2568*v4699-*p;
+  v6221=v2068*v11024-*p;
+  v19281=v6295*v16420-*p;
+  v14530=v13740*v1549-*p;
+  v7971=v2204*v17994-*p;
+  v19377=v13659*v9526-*p;
+  v9011=v11335*v10718-*p;
+  v10997=v13808*v16555-*p;
+  v16787=v5980*v5129-*p;
+  v1492=v6035*v12779-*p;
+  v14302=v15943*v5332-*p;
+  v34=v4377*v10995-*p;
+  v11231=v7774*v6329-*p;
+  v6285=v12428*v2832-*p;
+  v2951=v14641*v12108-*p;
+  v17267=v14244*v9645-*p;
+  v2614=v5688*v2214-*p;
+  v8930=v18360*v17553-*p;
+  v2781=v5345*v10104-*p;
+  v15566=v15601*v15283-*p;
+  v13803=v5892*v289-*p;
+  v12462=v12259*v4232-*p;
+  v16835=v19771*v16855-*p;
+  v16885=v14016*v14969-*p;
+  v3273=v14194*v6680-*p;
+  v11767=v6465*v9491-*p;
+  v239=v9339*v8781-*p;
+  v12062=v5927*v17960-*p;
+  v14052=v17623*v11721-*p;
+  v5668=v9832*v14224-*p;
+  v596=v7636*v7733-*p;
+  v4309=v2196*v17317-*p;
+  v14860=v6078*v13923-*p;
+  v16482=v19393*v5752-*p;
+  v13659=v18124*v15502-*p;
+  v9896=v4397*v18120-*p;
+  v8317=v19091*v9677-*p;
+  v8246=v2500*v18313-*p;
+  v17363=v5995*v355-*p;
+  v12607=v4159*v4940-*p;
+  v9183=v12103*v12015-*p;
+  v17804=v22*v18675-*p;
+  v8683=v14758*v2726-*p;
+  v16389=v879*v15520-*p;
+  v3673=v1364*v9338-*p;
+  v17068=v9649*v1471-*p;
+  v16683=v16206*v18496-*p;
+  v13230=v17231*v14928-*p;
+  v6053=v19274*v10796-*p;
+  v2304=v934*v17325-*p;
+  v1764=v18886*v3855-*p;
+  v13559=v10277*v18284-*p;
+  v12316=v9780*v2746-*p;
+  v14844=v4813*v1104-*p;
+  v6254=v14158*v12526-*p;
+  v5345=v12162*v3720-*p;
+  v2051=v1950*v9017-*p;
+  v9879=v19501*v7865-*p;
+  v14753=v4894*v15337-*p;
+  v15846=v12812*v9904-*p;
+  v19204=v9072*v2755-*p;
+  v16045=v19390*v13272-*p;
+  v9574=v17504*v4474-*p;
+  v11470=v3715*v5891-*p;
+  v8075=v3572*v19159-*p;
+  v19574=v13308*v19578-*p;
+  v1650=v17883*v2636-*p;
+  v8553=v4847*v12047-*p;
+  v11562=v3498*v14007-*p;
+  v17316=v16259*v12821-*p;
+  v18874=v8770*v18842-*p;
+  v5107=v9321*v13204-*p;
+  v15270=v12159*v14920-*p;
+  v6153=v1238*v18870-*p;
+  v2087=v11338*v11588-*p;
+  v8390=v1942*v15539-*p;
+  v16873=v17554*v679-*p;
+  v18933=v17387*v13809-*p;
+  v5607=v8262*v12881-*p;
+  v14854=v1012*v13575-*p;
+  v6577=v1383*v7277-*p;
+  v8487=v18352*v8142-*p;
+  v17531=v16133*v15271-*p;
+  v13703=v5602*v13092-*p;
+  v15544=v13664*v12644-*p;
+  v5892=v3298*v5735-*p;
+  v1306=v7453*v9457-*p;
+  v11438=v10019*v12338-*p;
+  v6184=v14426*v5245-*p;
+  v518=v12345*v12440-*p;
+  v3497=v14331*v16636-*p;
+  v16527=v9327*v12270-*p;
+  v13982=v6113*v12139-*p;
+  v17083=v6097*v14904-*p;
+  v14215=v9180*v1816-*p;
+  v17156=v14380*v16591-*p;
+  v11687=v11932*v6375-*p;
+  v5868=v13074*v14129-*p;
+  v12984=v1260*v19757-*p;
+  v18752=v5792*v10029-*p;
+  v11383=v5021*v5325-*p;
+  v13527=v7463*v10246-*p;
+  v9196=v3905*v9805-*p;
+  v2551=v4873*v7261-*p;
+  v11712=v977*v7610-*p;
+  v6252=v4608*v10356-*p;
+  v866=v1903*v14997-*p;
+  v10514=v7148*v16242-*p;
+  v14544=v3861*v19418-*p;
+  v4181=v2753*v2173-*p;
+  v17771=v18193*v10225-*p;
+  v11816=v13636*v2560-*p;
+  v1943=v1076*v4112-*p;
+  v8151=v4988*v12938-*p;
+  v9522=v18076*v8079-*p;
+  v18491=v57*v6642-*p;
+  v634=v14042*v4280-*p;
+  v8139=v7974*v16997-*p;
+  v13401=v10090*v8504-*p;
+  v3761=v3892*v5289-*p;
+  v19420=v12161*v31-*p;
+  v1506=v5544*v6025-*p;
+  v669=v9112*v15707-*p;
+  v9780=v10833*v13342-*p;
+  v14958=v17966*v2543-*p;
+  v16987=v14419*v9557-*p;
+  v18315=v18184*v7370-*p;
+  v1921=v17601*v3241-*p;
+  v11206=v13834*v6367-*p;
+  v3428=v4465*v7701-*p;
+  v12438=v17478*v14546-*p;
+  v16490=v11398*v1943-*p;
+  v18493=v4661*v19148-*p;
+  v8844=v6826*v11180-*p;
+  v12424=v43*v8525-*p;
+  v14254=v7691*v389-*p;
+  v6880=v3562*v8367-*p;
+  v18847=v2213*v11118-*p;
+  v17160=v5633*v8316-*p;
+  v1145=v3471*v13799-*p;
+  v1820=v7113*v2120-*p;
+  v18055=v19706*v7276-*p;
+  v727=v6354*v9368-*p;
+  v676=v10714*v18603-*p;
+  v7210=v4089*v12813-*p;
+  v7302=v14303*v18767-*p;
+  v16576=v12572*v12253-*p;
+  v6302=v13158*v5581-*p;
+  v3991=v19341*v8400-*p;
+  v6875=v10239*v17680-*p;
+  v15784=v11520*v11656-*p;
+  v16811=v10128*v19134-*p;
+  v16951=v126*v6979-*p;
+  v1307=v2*v12984-*p;
+  v10952=v692*v835-*p;
+  v7346=v17716*v3710-*p;
+  v5112=v12830*v4005-*p;
+  v8632=v12130*v8578-*p;
+  v9683=v6904*v19878-*p;
+  v13715=v5829*v8602-*p;
+  v5314=v16338*v10361-*p;
+  v466=v19721*v11954-*p;
+  v1473=v10358*v7007-*p;
+  v7870=v8105*v18258-*p;
+  v9368=v10203*v7756-*p;
+  v13377=v4*v16841-*p;
+  v2314=v5070*v15772-*p;
+  v18654=v1599*v996-*p;
+  v932=v3731*v14721-*p;
+  v17953=v19771*v12745-*p;
+  v11866=v19819*v14891-*p;
+  v17322=v3519*v1694-*p;
+  v3838=v6489*v7638-*p;
+  v13495=v10774*v15209-*p;
+  v9623=v17969*v16360-*p;
+  v5299=v7504*v8103-*p;
+  v17753=v14243*v1949-*p;
+  v8757=v1089*v1728-*p;
+  v10679=v8881*v13420-*p;
+  v18659=v14556*v17417-*p;
+  v1007=v2574*v7290-*p;
+  v16836=v17994*v11267-*p;
+  v7789=v9653*v2969-*p;
+  v5688=v4945*v11187-*p;
+  v5930=v10702*v11014-*p;
+  v17952=v9106*v16478-*p;
+  v7392=v14675*v4682-*p;
+  v6752=v15043*v3218-*p;
+  v14017=v4215*v13383-*p;
+  v3646=v16344*v10213-*p;
+  v4210=v10101*v7263-*p;
+  v6489=v15493*v19013-*p;
+  v9878=v4273*v12932-*p;
+  v12999=v6952*v9797-*p;
+  v78=v19770*v11450-*p;
+  v9804=v5491*v14135-*p;
+  v16699=v8683*v16763-*p;
+  v17310=v825*v9596-*p;
+  v14725=v18555*v15121-*p;
+  v1786=v15761*v2876-*p;
+  v14097=v1595*v4815-*p;
+  v19647=v16442*v3427-*p;
+  v11060=v10179*v6779-*p;
+  v8015=v19852*v11946-*p;
+  v19138=v16487*v15841-*p;
+  v5314=v1304*v6282-*p;
+  v12391=v4885*v3226-*p;
+  v19204=v1205*v3095-*p;
+  v6901=v11301*v13581-*p;
+  v6176=v8695*v19051-*p;
+  v5579=v15439*v1072-*p;
+  v3427=v12867*v10722-*p;
+  v6887=v16910*v1501-*p;
+  v11579=v38*v18844-*p;
+  v2617=v14688*v15194-*p;
+  v9305=v10091*v3537-*p;
+  v7236=v15296*v818-*p;
+  v2231=v1957*v12159-*p;
+  v19405=v17733*v14299-*p;
+  v16047=v13946*v6310-*p;
+  v4129=v17386*v12242-*p;
+  v8382=v13021*v6598-*p;
+  v10789=v16691*v9202-*p;
+  v19117=v16273*v11643-*p;
+  v11205=v9163*v19643-*p;
+  v3087=v10617*v18168-*p;
+  v11808=v2159*v7290-*p;
+  v5908=v16927*v50-*p;
+  v8170=v13162*v17730-*p;
+  v14258=v6121*v10190-*p;
+  v229=v1031*v14240-*p;
+  v7218=v3423*v3376-*p;
+  v3461=v9013*v9380-*p;
+  v11815=v10846*v2768-*p;
+  v17857=v8593*v7270-*p;
+  v5188=v3031*v8650-*p;
+  v9157=v7546*v5465-*p;
+  v12414=v15317*v7709-*p;
+  v15536=v14558*v7327-*p;
+  v4006=v231*v16247-*p;
+  v2201=v18910*v11529-*p;
+  v15029=v1956*v3625-*p;
+  v18217=v15135*v1740-*p;
+  v10805=v13575*v16599-*p;
+  v7647=v5616*v7161-*p;
+  v16036=v1958*v14918-*p;
+  v11046=v12565*v12060-*p;
+  v11611=v17727*v17911-*p;
+  v7967=v4956*v13219-*p;
+  v16433=v17259*v18526-*p;
+  v13535=v13207*v6891-*p;
+  v3904=v19753*v19858-*p;
+  v6400=v12074*v13798-*p;
+  v8497=v15504*v19674-*p;
+  v10805=v334*v10632-*p;
+  v9966=v13105*v1102-*p;
+  v12347=v19953*v5230-*p;
+  v5662=v14278*v14361-*p;
+  v22=v6748*v3749-*p;
+  v12834=v18171*v11497-*p;
+  v5426=v1748*v12029-*p;
+  v15642=v8349*v11640-*p;
+  v14416=v11677*v15070-*p;
+  v14841=v4659*v18739-*p;
+  v9269=v17341*v19534-*p;
+  v17045=v19201*v5078-*p;
+  v8391=v16894*v13242-*p;
+  v11125=v13051*v17992-*p;
+  v1294=v19092*v1853-*p;
+  v3288=v10083*v5487-*p;
+  v7492=v2373*v14346-*p;
+  v533=v2918*v11278-*p;
+  v9809=v10138*v16074-*p;
+  v2626=v7382*v18231-*p;
+  v6751=v2023*v12204-*p;
+  v12970=v13883*v19316-*p;
+  v4908=v1304*v8194-*p;
+  v3373=v4831*v19492-*p;
+  v8754=v16192*v9974-*p;
+  v8875=v7092*v16850-*p;
+  v1922=v18532*v5505-*p;
+  v8181=v7828*v17121-*p;
+  v4344=v13592*v7182-*p;
+  v15648=v16064*v19644-*p;
+  v16971=v15005*v13573-*p;
+  v12475=v1786*v15819-*p;
+  v9143=v19912*v14431-*p;
+  v11567=v16797*v7333-*p;
+  v7773=v19779*v13431-*p;
+  v10883=v11124*v10775-*p;
+  v2301=v5049*v3298-*p;
+  v12844=v18256*v11772-*p;
+  v6170=v10546*v4065-*p;
+  v18722=v13047*v3857-*p;
+  v18815=v1089*v1422-*p;
+  v4497=v9050*v2460-*p;
+  v5883=v6940*v4807-*p;
+  v7597=v8544*v6950-*p;
+  v13082=v14109*v6001-*p;
+  v2650=v11732*v2815-*p;
+  v14436=v1700*v17568-*p;
+  v9212=v15244*v7452-*p;
+  v16513=v3824*v18422-*p;
+  v19971=v9198*v829-*p;
+  v17119=v1654*v12970-*p;
+  v5197=v18251*v8750-*p;
+  v6225=v4597*v16728-*p;
+  v11177=v15009*v9679-*p;
+  v13513=v18656*v6241-*p;
+  v19959=v5396*v1373-*p;
+  v2692=v18051*v10605-*p;
+  v17303=v5263*v15594-*p;
+  v12233=v18135*v6855-*p;
+  v6269=v8943*v14213-*p;
+  v1664=v18983*v4467-*p;
+  v18598=v14227*v2366-*p;
+  v8550=v13200*v9649-*p;
+  v13646=v17248*v3367-*p;
+  v19465=v7807*v9201-*p;
+  v2014=v11569*v17293-*p;
+  v711=v13267*v13857-*p;
+  v10333=v11430*v14016-*p;
+  v1945=v16830*v12946-*p;
+  v12103=v1964*v8939-*p;
+  v13761=v3341*v12437-*p;
+  v3880=v9570*v7738-*p;
+  v19557=v14502*v228-*p;
+  v14523=v10677*v12861-*p;
+  v7641=v12969*v5864-*p;
+  v17513=v9140*v6458-*p;
+  v7080=v1653*v5705-*p;
+  v13485=v16328*v2334-*p;
+  v4770=v11867*v6982-*p;
+  v19826=v13655*v4629-*p;
+  v6733=v12179*v14351-*p;
+  v6340=v2541*v2073-*p;
+  v12934=v19233*v10992-*p;
+  v7011=v15560*v1188-*p;
+  v12197=v12332*v13488-*p;
+  v17576=v17937*v14896-*p;
+  v18293=v15467*v5236-*p;
+  v17752=v811*v11302-*p;
+  v7592=v6283*v13310-*p;
+  v6208=v8391*v5083-*p;
+  v5292=v2452*v10550-*p;
+  v9987=v553*v14045-*p;
+  v18638=v15712*v19862-*p;
+  v11819=v7040*v3650-*p;
+  v6124=v18601*v11406-*p;
+  v7117=v12681*v11752-*p;
+  v17235=v6729*v6012-*p;
+  v15374=v1579*v5741-*p;
+  v121=v11912*v13344-*p;
+  v8429=v12053*v18200-*p;
+  v412=v3627*v1223-*p;
+  v8586=v10178*v16597-*p;
+  v4594=v5951*v12820-*p;
+  v13889=v5632*v16488-*p;
+  v10055=v14349*v14827-*p;
+  v5626=v18135*v12783-*p;
+  v15743=v2988*v1174-*p;
+  v1840=v1751*v9389-*p;
+  v8038=v17902*v6300-*p;
+  v1868=v8810*v8456-*p;
+  v6710=v4602*v19295-*p;
+  v15815=v4732*v13039-*p;
+  v12058=v4297*v11093-*p;
+  v16569=v9242*v17626-*p;
+  v19309=v10147*v4892-*p;
+  v6702=v10556*v19908-*p;
+  v7344=v19630*v6686-*p;
+  v13129=v10688*v18610-*p;
+  v9828=v19321*v9868-*p;
+  v19612=v17109*v4685-*p;
+  v16653=v18768*v14878-*p;
+  v11713=v8672*v6500-*p;
+  v6056=v19007*v2145-*p;
+  v1653=v8398*v17900-*p;
+  v15612=v15427*v18202-*p;
+  v7717=v16891*v14254-*p;
+  v10656=v17532*v17437-*p;
+  v1357=v12917*v18401-*p;
+  v8708=v16466*v3687-*p;
+  v10761=v2009*v15225-*p;
+  v445=v5729*v5178-*p;
+  v8651=v9237*v13045-*p;
+  v2575=v10230*v17691-*p;
+  v18657=v16602*v2751-*p;
+  v3002=v16394*v5803-*p;
+  v4249=v10585*v9068-*p;
+  v12317=v19388*v12655-*p;
+  v16708=v16825*v17066-*p;
+  v3958=v8227*v7759-*p;
+  v13571=v4030*v2454-*p;
+  v9701=v14331*v12243-*p;
+  v4367=v13541*v19227-*p;
+  v8908=v9098*v10733-*p;
+  v12781=v429*v11022-*p;
+  v12221=v10156*v13352-*p;
+  v13435=v15565*v16684-*p;
+  v9769=v18588*v3388-*p;
+  v17222=v9025*v6949-*p;
+  v7979=v16712*v14256-*p;
+  v9012=v4262*v1828-*p;
+  v858=v11065*v11499-*p;
+  v2025=v5380*v17732-*p;
+  v13445=v9551*v9065-*p;
+  v4605=v542*v2874-*p;
+  v17187=v5408*v1825-*p;
+  v5640=v5924*v1662-*p;
+  v16819=v14945*v9342-*p;
+  v740=v12111*v4033-*p;
+  v11043=v6685*v18523-*p;
+  v1084=v8907*v14790-*p;
+  v7571=v18293*v7594-*p;
+  v18321=v8696*v772-*p;
+  v7788=v1144*v14229-*p;
+  v17524=v1525*v17754-*p;
+  v13314=v6325*v4133-*p;
+  v1518=v8209*v6677-*p;
+  v4671=v18085*v2330-*p;
+  v1561=v19113*v8516-*p;
+  v7573=v13180*v7810-*p;
+  v17450=v9266*v9497-*p;
+  v16548=v11779*v16544-*p;
+  v17370=v15290*v5062-*p;
+  v17051=v16967*v3809-*p;
+  v5507=v12031*v2543-*p;
+  v4179=v8429*v12700-*p;
+  v15964=v3982*v13387-*p;
+  v17461=v7318*v16234-*p;
+  v19876=v4753*v4871-*p;
+  v19426=v14952*v2295-*p;
+  v8613=v9270*v14414-*p;
+  v3035=v6905*v3504-*p;
+  v17810=v5288*v5774-*p;
+  v16800=v2395*v14884-*p;
+  v899=v5460*v12590-*p;
+  v15975=v12259*v33-*p;
+  v4583=v2462*v2527-*p;
+  v821=v14539*v18271-*p;
+  v4845=v3024*v1126-*p;
+  v413=v8263*v6198-*p;
+  v7147=v7848*v11895-*p;
+  v16527=v19056*v14084-*p;
+  v7233=v11363*v1435-*p;
+  v11101=v12630*v18069-*p;
+  v19476=v16006*v15575-*p;
+  v10261=v4134*v18669-*p;
+  v1090=v10647*v7860-*p;
+  v14046=v14726*v14646-*p;
+  v9441=v10913*v18382-*p;
+  v7515=v9942*v19408-*p;
+  v16360=v11410*v19490-*p;
+  v2252=v10258*v16484-*p;
+  v9765=v12139*v7334-*p;
+  v277=v14045*v9099-*p;
+  v5451=v14968*v19297-*p;
+  v1816=v6748*v7929-*p;
+  v1800=v3653*v12254-*p;
+  v934=v1170*v3365-*p;
+  v4666=v14684*v5734-*p;
+  v12324=v18710*v15306-*p;
+  v1278=v3237*v11582-*p;
+  v13113=v12451*v18687-*p;
+  v2714=v19875*v11912-*p;
+  v18181=v10755*v15159-*p;
+  v16296=v10074*v11478-*p;
+  v2938=v13475*v5244-*p;
+  v17163=v12799*v293-*p;
+  v8519=v8706*v14909-*p;
+  v4239=v4334*v1007-*p;
+  v6478=v7613*v7011-*p;
+  v6082=v15279*v5686-*p;
+  v12879=v13417*v14945-*p;
+  v16877=v9723*v17804-*p;
+  v7406=v16513*v18545-*p;
+  v19743=v9370*v14076-*p;
+  v9442=v10432*v6359-*p;
+  v15602=v19835*v1661-*p;
+  v15624=v19556*v15869-*p;
+  v18045=v16021*v12530-*p;
+  v18063=v3198*v14054-*p;
+  v3602=v6861*v9132-*p;
+  v7150=v16191*v8620-*p;
+  v15309=v1095*v7285-*p;
+  v176=v16732*v18731-*p;
+  v12000=v4186*v8310-*p;
+  v1825=v6239*v892-*p;
+  v5734=v15774*v9304-*p;
+  v813=v9138*v1827-*p;
+  v14730=v4236*v4384-*p;
+  v15472=v3462*v8238-*p;
+  v18203=v1502*v10026-*p;
+  v15154=v17198*v14281-*p;
+  v10187=v1449*v9685-*p;
+  v16212=v15182*v602-*p;
+  v12825=v16853*v13919-*p;
+  v18780=v14737*v16424-*p;
+  v7826=v17323*v4766-*p;
+  v9635=v13503*v3459-*p;
+  v7946=v19975*v11117-*p;
+  v11870=v19289*v1962-*p;
+  v3534=v10466*v18010-*p;
+  v11902=v13285*v3625-*p;
+  v11557=v6296*v10622-*p;
+  v11934=v4331*v8352-*p;
+  v10535=v5962*v19138-*p;
+  v10220=v9300*v2866-*p;
+  v13179=v5760*v18057-*p;
+  v5352=v2492*v7044-*p;
+  v16553=v14494*v1885-*p;
+  v6424=v3472*v14125-*p;
+  v9711=v12127*v12515-*p;
+  v4409=v8980*v17879-*p;
+  v6015=v13410*v1541-*p;
+  v10487=v7125*v18269-*p;
+  v5527=v17759*v13180-*p;
+  v15008=v6474*v17957-*p;
+  v1538=v1528*v6133-*p;
+  v240=v5527*v8375-*p;
+  v230=v10540*v18822-*p;
+  v13092=v13590*v5559-*p;
+  v17533=v12926*v8087-*p;
+  v3960=v1864*v2342-*p;
+  v7298=v3927*v13086-*p;
+  v13802=v8687*v8642-*p;
+  v15088=v9723*v19248-*p;
+  v18079=v2957*v17081-*p;
+  v1846=v6812*v2073-*p;
+  v3758=v19334*v17794-*p;
+  v7391=v13450*v16205-*p;
+  v6526=v1048*v12476-*p;
+  v3563=v5386*v4340-*p;
+  v1759=v1025*v19062-*p;
+  v13292=v843*v11982-*p;
+  v1852=v8931*v5097-*p;
+  v16679=v12090*v16131-*p;
+  v7113=v3216*v3116-*p;
+  v8601=v10702*v12223-*p;
+  v5779=v1625*v8084-*p;
+  v14778=v1093*v4081-*p;
+  v14328=v3343*v10398-*p;
+  v18976=v6464*v6343-*p;
+  v11941=v17613*v18439-*p;
+  v15861=v2040*v15629-*p;
+  v5569=v15464*v1728-*p;
+  v9703=v16577*v19838-*p;
+  v9868=v9136*v12828-*p;
+  v9338=v17057*v17894-*p;
+  v7240=v13402*v19656-*p;
+  v18939=v2965*v7917-*p;
+  v5895=v793*v2470-*p;
+  v5919=v8536*v10441-*p;
+  v15527=v19993*v13646-*p;
+  v9942=v892*v9801-*p;
+  v8222=v4478*v6116-*p;
+  v42=v8530*v2734-*p;
+  v5914=v3665*v8238-*p;
+  v2529=v18057*v3883-*p;
+  v19127=v12300*v6434-*p;
+  v5229=v12687*v10998-*p;
+  v5205=v773*v8191-*p;
+  v19275=v2443*v8715-*p;
+  v4048=v7203*v6482-*p;
+  v12228=v1644*v12138-*p;
+  v3712=v7172*v11634-*p;
+  v3987=v4815*v13685-*p;
+  v3338=v12238*v7946-*p;
+  v8320=v4829*v2460-*p;
+  v10668=v4354*v2927-*p;
+  v9348=v15645*v18356-*p;
+  v13889=v11423*v16763-*p;
+  v9802=v3147*v702-*p;
+  v956=v10037*v9371-*p;
+  v213=v3822*v8014-*p;
+  v19427=v13483*v12610-*p;
+  v8980=v7063*v4524-*p;
+  v13089=v4114*v18318-*p;
+  v7522=v2725*v8310-*p;
+  v16687=v7296*v14994-*p;
+  v1205=v13973*v12103-*p;
+  v1540=v16147*v8430-*p;
+  v16397=v13972*v18521-*p;
+  v8171=v8734*v14119-*p;
+  v1593=v10930*v11392-*p;
+  v11670=v4793*v16831-*p;
+  v8392=v2761*v17897-*p;
+  v12915=v16324*v18538-*p;
+  v481=v10642*v9459-*p;
+  v18192=v7378*v3665-*p;
+  v9324=v3856*v17705-*p;
+  v1134=v10565*v16479-*p;
+  v12575=v19940*v3877-*p;
+  v12549=v15580*v11619-*p;
+  v2617=v19891*v4618-*p;
+  v8662=v310*v7904-*p;
+  v9014=v18539*v18016-*p;
+  v13874=v11854*v2656-*p;
+  v1138=v3106*v1437-*p;
+  v17986=v19027*v622-*p;
+  v1282=v13181*v4429-*p;
+  v15531=v5182*v9851-*p;
+  v4805=v18734*v1215-*p;
+  v9661=v16645*v12356-*p;
+  v11358=v7281*v16382-*p;
+  v11999=v10618*v11915-*p;
+  v16928=v3341*v18836-*p;
+  v1917=v2437*v14095-*p;
+  v6665=v1573*v9323-*p;
+  v1683=v1835*v12181-*p;
+  v13244=v6187*v3332-*p;
+  v13351=v17921*v368-*p;
+  v628=v4976*v18812-*p;
+  v11547=v18944*v14694-*p;
+  v8122=v17052*v3922-*p;
+  v11080=v9417*v1311-*p;
+  v16638=v17758*v14722-*p;
+  v16047=v14541*v17972-*p;
+  v9055=v7598*v760-*p;
+  v6796=v9954*v9727-*p;
+  v2932=v17279*v8418-*p;
+  v17436=v4940*v15290-*p;
+  v18181=v18089*v1896-*p;
+  v6807=v10718*v16239-*p;
+  v9630=v9495*v12067-*p;
+  v17148=v16818*v14040-*p;
+  v3727=v5017*v15880-*p;
+  v14719=v9950*v5514-*p;
+  v5266=v13835*v15099-*p;
+  v17121=v14670*v13332-*p;
+  v18892=v3416*v9684-*p;
+  v7445=v2075*v4262-*p;
+  v4618=v17358*v6209-*p;
+  v10597=v8606*v14813-*p;
+  v2316=v9669*v8748-*p;
+  v5871=v7793*v3680-*p;
+  v25=v13254*v8431-*p;
+  v16844=v9303*v2785-*p;
+  v4841=v9453*v2943-*p;
+  v8420=v8358*v2607-*p;
+  v10626=v1724*v15840-*p;
+  v12709=v16728*v12457-*p;
+  v19766=v19416*v15450-*p;
+  v16694=v4329*v7542-*p;
+  v7766=v12424*v9020-*p;
+  v17311=v16587*v12436-*p;
+  v9225=v9237*v9965-*p;
+  v8219=v15755*v7843-*p;
+  v14283=v8821*v9502-*p;
+  v7619=v9966*v4928-*p;
+  v19449=v13953*v18055-*p;
+  v7738=v15135*v5456-*p;
+  v1225=v13819*v16886-*p;
+  v14125=v1267*v1457-*p;
+  v4878=v3112*v4086-*p;
+  v3558=v8049*v12787-*p;
+  v14852=v19360*v15988-*p;
+  v10031=v7630*v3137-*p;
+  v4916=v5009*v9807-*p;
+  v1821=v9036*v11389-*p;
+  v17020=v7525*v2363-*p;
+  v4439=v17199*v18716-*p;
+  v8709=v15104*v16854-*p;
+  v10011=v18799*v3290-*p;
+  v5335=v4439*v5925-*p;
+  v961=v14884*v17115-*p;
+  v3102=v17655*v7066-*p;
+  v19192=v15840*v10681-*p;
+  v3369=v19607*v6347-*p;
+  v10510=v4906*v1912-*p;
+  v10089=v16963*v9425-*p;
+  v17068=v18734*v14201-*p;
+  v18954=v16677*v17190-*p;
+  v18016=v8951*v5141-*p;
+  v15769=v2434*v11947-*p;
+  v19247=v18210*v19913-*p;
+  v7595=v15199*v13979-*p;
+  v10255=v18231*v14620-*p;
+  v2426=v8508*v11010-*p;
+  v1653=v12131*v2733-*p;
+  v7498=v9060*v12367-*p;
+  v4482=v7683*v15956-*p;
+  v4293=v19792*v12540-*p;
+  v2756=v1746*v7121-*p;
+  v9994=v19752*v15579-*p;
+  v14224=v10930*v7798-*p;
+  v8803=v5264*v18914-*p;
+  v17981=v9163*v17889-*p;
+  v16484=v14363*v7329-*p;
+  v4572=v11685*v14551-*p;
+  v4548=v7602*v6969-*p;
+  v10722=v8204*v6674-*p;
+  v842=v15382*v19912-*p;
+  v470=v12982*v11275-*p;
+  v8168=v19450*v3873-*p;
+  v16338=v16663*v352-*p;
+  v7895=v12083*v2278-*p;
+  v12252=v16393*v16131-*p;
+  v1896=v18355*v7486-*p;
+  v3530=v17624*v3564-*p;
+  v11889=v18587*v10257-*p;
+  v16878=v13047*v14620-*p;
+  v8156=v12572*v8562-*p;
+  v16764=v18290*v4497-*p;
+  v19712=v12476*v6359-*p;
+  v15969=v16006*v10961-*p;
+  v1045=v14002*v17451-*p;
+  v6542=v13335*v8345-*p;
+  v2682=v14833*v4959-*p;
+  v2291=v16157*v968-*p;
+  v13577=v1913*v7305-*p;
+  v5733=v5796*v13576-*p;
+  v18078=v4555*v2688-*p;
+  v3179=v4301*v6972-*p;
+  v17336=v17028*v14964-*p;
+  v15993=v3063*v4666-*p;
+  v14785=v1759*v9941-*p;
+  v4528=v11201*v18801-*p;
+  v19273=v11561*v398-*p;
+  v5775=v7664*v8718-*p;
+  v12255=v19391*v17230-*p;
+  v5110=v11620*v15832-*p;
+  v7090=v16317*v2039-*p;
+  v10931=v17718*v15560-*p;
+  v6541=v10833*v6556-*p;
+  v15323=v16469*v5211-*p;
+  v15061=v3310*v3430-*p;
+  v1578=v1856*v11684-*p;
+  v19712=v8975*v13672-*p;
+  v19288=v10433*v3466-*p;
+  v15648=v18725*v13287-*p;
+  v7641=v13918*v6507-*p;
+  v5670=v10311*v4721-*p;
+  v13039=v17244*v11694-*p;
+  v18471=v18808*v17709-*p;
+  v1296=v9822*v4274-*p;
+  v6859=v11432*v9578-*p;
+  v19263=v5364*v5402-*p;
+  v15294=v11377*v4310-*p;
+  v17042=v13259*v6685-*p;
+  v1156=v8393*v13443-*p;
+  v14394=v16613*v19821-*p;
+  v6524=v11480*v15142-*p;
+  v7677=v17591*v14622-*p;
+  v10042=v14173*v2846-*p;
+  v4667=v11089*v11505-*p;
+  v1998=v8488*v19974-*p;
+  v19725=v5986*v18308-*p;
+  v2176=v4380*v13266-*p;
+  v2741=v17796*v3729-*p;
+  v18772=v8376*v7205-*p;
+  v5994=v8962*v1950-*p;
+  v10932=v4997*v1723-*p;
+  v7159=v2460*v15718-*p;
+  v15808=v580*v19373-*p;
+  v4963=v7620*v8356-*p;
+  v6191=v9833*v9358-*p;
+  v9594=v15825*v18008-*p;
+  v5580=v12769*v14819-*p;
+  v13866=v3073*v5018-*p;
+  v18464=v1131*v2626-*p;
+  v16080=v7565*v9532-*p;
+  v7517=v4482*v15325-*p;
+  v17787=v4680*v4056-*p;
+  v15639=v4152*v3383-*p;
+  v12500=v3024*v16847-*p;
+  v4678=v10944*v6329-*p;
+  v17441=v15262*v17311-*p;
+  v4169=v1949*v4460-*p;
+  v12031=v1958*v12523-*p;
+  v6529=v14701*v11598-*p;
+  v6348=v11593*v11859-*p;
+  v6280=v873*v13955-*p;
+  v16445=v18819*v19413-*p;
+  v14319=v6399*v63-*p;
+  v13179=v17790*v13418-*p;
+  v2613=v5053*v7193-*p;
+  v5561=v16389*v12529-*p;
+  v1057=v14899*v14662-*p;
+  v18218=v11342*v6189-*p;
+  v11364=v8523*v16049-*p;
+  v3969=v11811*v953-*p;
+  v16113=v2039*v17836-*p;
+  v6685=v15580*v10646-*p;
+  v9143=v8478*v12793-*p;
+  v15179=v10985*v376-*p;
+  v4728=v6640*v1341-*p;
+  v15845=v16033*v500-*p;
+  v8410=v19620*v5950-*p;
+  v17086=v12467*v5251-*p;
+  v15063=v15375*v5646-*p;
+  v13944=v13398*v18255-*p;
+  v5199=v2262*v3739-*p;
+  v16383=v7392*v18008-*p;
+  v1332=v6123*v12871-*p;
+  v15095=v17136*v1930-*p;
+  v12300=v1414*v7959-*p;
+  v9849=v5405*v3139-*p;
+  v12120=v18365*v6420-*p;
+  v7084=v17914*v11761-*p;
+  v3397=v3229*v18619-*p;
+  return v19999;
+}
@@ -0,0 +1,50004 @@
+int main() {
+  int i=0; int j=0; int k=0; int s=0;
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>296) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>895) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>189) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>902) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>134) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>595) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>727) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>510) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>104) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1068) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>808) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>182) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>416) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>272) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>961) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1001) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>622) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>894) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>818) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>930) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>848) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>155) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>622) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>441) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1075) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>194) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>461) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1078) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1020) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>642) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>227) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>838) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>599) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>364) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>498) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>999) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1054) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>149) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>495) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>300) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>171) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>469) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>986) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>881) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>466) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>799) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>674) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>153) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>872) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>582) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>857) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>565) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>126) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>653) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>690) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>679) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>246) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>340) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>720) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>103) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>229) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>262) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1085) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>901) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>748) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>445) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>585) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1098) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>410) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>296) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>501) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>461) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>566) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>237) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>269) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>356) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>106) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>956) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>807) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>849) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>957) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>655) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1081) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>512) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>186) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>265) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>664) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1072) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>485) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>657) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>953) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>102) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>680) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>271) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>609) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>459) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>640) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>422) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>105) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>973) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>345) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>267) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>549) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>365) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>803) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1094) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>203) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>387) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>822) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>566) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>832) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>836) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>572) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>862) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>613) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1078) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>967) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>799) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>963) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1050) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>171) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>989) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>763) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>767) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>991) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>199) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>106) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>219) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>527) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>895) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>619) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>658) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>925) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>944) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>272) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1051) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>347) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>793) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>343) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>422) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>711) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>631) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>142) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>645) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>914) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>881) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>947) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>661) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>661) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>923) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>514) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1046) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>156) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>977) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>399) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1033) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>315) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>348) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>215) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>762) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>526) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>861) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>525) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1098) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1085) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>992) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>368) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>953) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1086) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>299) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>937) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>123) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>102) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>463) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>354) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>872) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>648) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>323) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>851) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>659) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1077) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>106) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>635) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>203) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>298) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>308) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>560) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>589) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>495) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>479) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>822) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>416) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1065) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>807) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>813) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>634) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>673) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1091) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>114) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>466) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>265) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>900) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1058) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>213) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>877) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>283) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>269) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>688) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>431) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>555) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1056) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>209) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>774) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>265) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>422) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>832) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>405) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>251) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>480) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>759) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>662) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>688) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>665) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1022) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>509) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>281) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>477) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>892) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>523) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>501) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>200) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>872) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>627) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1019) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>468) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>799) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>477) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>678) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>200) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>866) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>484) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>903) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>410) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>937) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1018) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>500) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>282) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>911) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>259) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1059) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>477) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1039) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>209) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>970) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>228) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1087) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1037) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>525) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>205) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>891) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>645) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>866) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>637) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>622) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>695) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>652) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>969) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>190) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>189) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1098) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>404) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>534) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>700) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>347) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>118) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1040) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>585) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>624) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>308) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>780) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>259) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>391) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>497) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>233) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>997) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>596) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1085) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>931) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>946) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1066) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>188) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>896) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>377) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>848) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>370) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>460) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>892) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>129) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>162) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>858) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>480) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>150) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>198) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>979) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>154) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>697) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>179) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>965) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>709) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>467) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>559) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>930) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>161) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>498) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>310) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>275) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>231) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>694) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>935) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>483) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>535) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1081) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>680) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>279) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>318) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>624) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>259) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1087) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1052) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>185) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>556) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>809) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>447) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>650) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>881) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>763) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>987) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>147) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>591) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>140) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>896) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>483) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>492) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>601) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>193) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>100) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>651) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>260) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1068) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>626) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>912) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>227) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>462) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>390) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>724) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1009) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>578) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>755) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>442) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>347) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>471) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>333) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>372) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>318) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>220) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>748) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>761) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>868) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>887) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>979) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1063) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>336) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>743) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>942) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>268) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>226) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>920) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>275) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>836) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>307) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>957) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>498) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1008) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1063) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>984) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>200) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>846) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>771) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1005) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>327) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>155) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>836) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>434) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>697) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>457) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>132) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>324) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>744) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>619) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>284) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>129) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1056) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>415) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>311) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>133) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>904) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>965) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>376) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>276) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>952) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>359) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>534) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>286) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>645) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>758) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>401) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>660) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1085) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>513) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>762) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>796) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>895) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>341) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>969) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>236) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>153) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>476) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>867) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>941) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>831) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>510) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1052) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>324) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>538) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>835) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>554) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>199) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>956) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>343) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>234) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>879) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>885) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1078) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>986) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1001) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>716) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>876) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>510) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>338) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>418) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>889) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>756) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>694) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>428) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>735) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>267) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>639) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>682) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>899) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>221) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>677) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>123) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>271) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>675) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>931) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>308) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1019) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>174) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>804) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>190) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>848) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>380) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>189) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>232) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>699) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>871) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>352) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>905) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>450) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>874) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>154) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>275) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>651) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>792) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>155) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>119) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1000) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>372) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>293) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>264) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>304) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>670) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>137) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>461) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1088) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>835) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>929) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>902) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>700) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>569) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1002) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>472) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>104) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>577) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>458) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>599) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>465) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>573) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>862) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>157) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>962) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>603) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>939) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1018) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>435) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>748) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1083) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>709) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>758) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>636) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>465) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>879) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>418) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>230) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>654) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>907) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>589) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>383) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1094) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>777) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1016) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>232) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>658) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>301) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1099) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>536) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>535) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>911) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>162) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>907) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>609) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1059) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>122) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>711) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>151) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>940) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>880) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>442) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>191) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>502) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1014) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>665) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>654) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>300) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>252) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>636) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>648) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>471) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>291) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>154) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>950) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>306) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>338) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>618) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>344) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>227) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>982) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>803) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>419) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>117) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>575) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1093) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>499) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>943) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>950) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>217) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>849) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>396) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>978) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>204) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>476) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>567) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>697) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>910) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>132) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>469) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>599) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>400) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>664) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>633) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>184) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>882) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>572) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>879) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>216) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>152) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>426) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>789) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>765) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>808) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>322) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>228) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>733) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>141) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>709) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>721) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1006) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>241) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>405) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>146) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>203) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>582) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>956) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>867) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>709) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>816) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>880) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>392) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>767) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>233) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>695) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>651) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>473) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>161) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>173) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1022) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>613) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>878) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>297) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>838) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>471) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>203) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>712) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>895) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>218) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>262) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>285) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>496) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>965) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>768) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>149) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>355) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>266) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>364) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>732) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>582) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>775) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>708) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>446) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>124) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>565) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>807) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>623) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>223) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>994) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>653) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>535) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>235) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>654) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>698) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>225) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>844) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>846) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>980) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>181) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>899) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>957) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1083) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>866) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>397) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>414) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>963) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>552) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>789) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>862) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1064) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>788) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>858) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>420) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>156) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1001) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>933) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>744) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>530) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>808) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>136) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>594) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>789) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>728) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>633) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>900) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>717) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>406) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>855) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>415) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1091) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1064) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>760) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>641) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>870) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>683) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>657) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>274) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>516) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>885) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>143) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>883) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>137) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>818) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>460) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>353) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>376) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>973) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>667) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>838) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>239) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>215) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>589) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>124) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>793) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>183) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>397) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>418) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>976) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>251) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1038) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1015) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1098) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>263) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>192) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>556) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1075) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>480) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>359) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>304) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>711) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>671) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>268) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1090) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>821) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>816) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>302) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1022) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>424) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>738) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>326) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>988) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1094) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>380) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>193) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>596) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1038) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1087) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>641) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>237) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>252) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>721) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>335) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>548) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>712) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>946) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>940) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1048) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>683) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>805) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>448) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>892) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>357) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>855) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>911) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>347) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>281) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>278) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>362) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>865) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>812) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>601) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>909) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>234) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1030) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>232) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>280) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>996) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>295) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>725) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>690) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1009) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>524) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>233) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>480) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>289) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>113) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>566) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>899) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>413) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>347) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1079) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>734) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>527) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>306) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>551) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>148) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>590) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>335) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1057) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>735) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1027) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>470) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1095) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1033) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>836) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>898) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>731) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>497) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>365) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>227) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>395) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>900) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>462) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>167) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>523) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>361) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>417) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>432) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>300) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1063) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1045) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>587) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1016) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>439) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>186) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>445) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>418) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1013) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>753) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>895) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>112) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>459) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>100) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>127) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>921) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1073) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>901) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>162) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>383) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>284) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>183) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>811) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1072) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>107) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1093) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>944) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>790) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1065) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>964) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>460) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1018) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1002) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>687) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>846) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>859) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>881) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>850) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>350) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>858) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>642) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1059) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>901) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>557) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>239) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>846) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>742) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>800) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>255) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>615) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>581) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>426) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>106) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>397) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>742) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>533) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1075) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>609) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1016) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1006) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1032) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>397) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>695) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>263) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>541) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>283) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>901) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>222) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>609) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>255) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>184) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>896) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>139) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>656) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>239) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1062) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>246) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>428) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>962) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>339) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>229) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>702) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>449) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>162) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1082) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>170) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>941) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>320) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>494) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>802) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>258) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>195) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1046) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>926) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>248) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>598) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>633) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>640) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>542) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>892) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>403) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>293) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>329) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>798) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>727) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1095) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>412) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1078) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>313) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>708) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>618) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>924) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>768) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>962) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>563) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>368) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>549) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>445) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>611) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>856) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>685) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>144) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>227) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>680) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>345) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>367) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>391) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1006) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>836) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>829) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>425) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1062) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>456) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>571) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>893) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>402) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>492) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>448) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>385) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>930) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>693) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>880) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1048) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>598) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>897) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>970) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1013) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>707) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>484) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1008) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1069) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>704) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>317) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>204) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>442) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>955) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>349) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>727) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>116) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>210) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>926) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>482) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>584) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>852) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>780) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>707) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>196) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>656) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>165) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>655) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>143) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>161) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>568) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>566) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>950) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>281) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>403) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>252) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>427) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>699) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>634) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>906) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>758) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>708) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>887) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>150) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>287) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>693) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>827) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1079) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>984) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>858) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>988) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>316) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>129) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>164) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>381) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>326) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>325) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>388) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>512) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1080) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>146) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1005) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>895) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>349) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>726) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>383) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>117) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>915) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>196) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>566) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>499) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>612) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>900) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1088) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>538) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>598) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1005) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>751) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>144) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>785) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>585) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>672) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>115) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1059) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>493) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>890) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>421) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>113) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>364) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>102) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>376) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>664) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>295) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>954) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1022) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1062) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>306) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>144) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>532) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>158) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>858) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>855) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1093) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>458) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>882) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1047) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>214) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>711) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>576) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>658) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>249) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1020) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>703) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>603) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1080) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>683) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>238) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>251) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>692) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>132) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>104) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>927) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>482) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>367) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>590) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>127) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>682) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>641) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>200) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>294) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>368) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>537) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>110) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>306) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>479) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1080) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>464) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>466) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>989) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>472) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>366) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1078) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>639) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>532) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1077) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>215) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>771) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>540) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>733) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>952) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>354) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>826) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>928) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>110) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>163) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>432) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>852) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>561) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>576) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>623) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>365) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>480) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>591) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1019) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>794) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>403) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>490) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>283) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>804) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>971) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>491) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>207) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>658) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>431) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1029) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>196) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1043) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>988) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>900) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>620) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>203) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>648) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>957) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>560) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>995) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>587) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>458) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>103) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>281) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>239) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>199) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>109) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>536) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>469) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>323) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>458) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>390) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>860) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>620) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>285) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>760) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>362) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>707) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>200) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1024) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>866) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>474) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>145) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>636) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>343) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>753) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1036) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>816) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1004) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>954) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>539) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>416) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>562) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>165) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>822) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>431) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>164) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>398) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>416) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>243) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>142) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>543) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>310) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>985) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>818) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1098) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>649) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>910) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>801) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>398) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>538) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>576) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>922) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>943) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>890) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1021) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>347) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>436) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>733) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>249) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>176) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>857) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>935) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>930) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>805) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>902) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>832) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>192) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>696) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1005) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>143) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>131) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>153) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>736) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>239) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>333) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>953) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>569) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>763) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>307) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>424) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>948) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>526) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>407) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>553) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>849) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>556) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>646) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>648) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>665) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>548) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1085) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>186) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>485) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>503) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>228) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>363) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1072) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>180) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>648) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>273) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1008) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>213) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>670) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>350) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>444) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>357) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>593) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>933) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1084) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>431) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>407) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>826) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>778) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>586) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>300) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>769) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>713) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>462) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>509) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>197) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>275) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>765) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1002) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>479) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>597) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>307) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1044) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>627) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>422) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>519) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>727) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>272) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1057) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>967) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>199) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>601) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>175) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>768) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>374) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1023) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>239) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>601) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>781) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>802) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>878) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>475) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>916) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>223) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>709) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>837) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>922) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>728) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1090) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1088) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>293) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>735) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>833) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>847) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>170) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1072) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>316) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>945) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>765) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>879) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>283) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>259) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>740) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>898) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>491) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>604) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1015) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>703) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1040) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>361) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>690) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1027) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>718) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>252) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>625) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>899) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>574) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1064) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>570) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>733) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>448) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>529) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>989) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>428) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>912) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>220) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>880) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1029) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>377) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>230) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>263) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>850) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>782) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>383) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>294) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>572) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>747) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>859) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>431) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>221) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>337) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>758) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>696) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>685) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>796) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>899) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>194) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>977) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>150) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>768) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>710) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>837) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>319) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>948) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>556) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1072) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>810) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>116) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>445) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>518) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1085) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>938) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>270) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>605) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>679) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>538) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>764) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>857) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1050) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>420) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>859) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>513) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>633) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1056) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>181) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>799) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>839) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>939) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>665) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1040) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>422) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>109) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>254) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>821) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>857) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>292) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>302) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>842) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>549) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>564) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>426) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>749) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>618) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>308) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1061) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>852) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>704) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>686) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>951) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>974) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1040) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>926) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>548) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>625) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>528) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>126) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>858) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>219) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>620) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>623) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>187) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>811) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>474) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>978) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>603) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>918) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>232) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>972) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>867) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>939) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>604) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>328) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>484) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>169) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>774) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>953) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>889) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>480) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>357) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>350) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>759) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>616) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>410) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>564) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>234) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>118) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>117) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>117) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>500) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>121) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>870) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>254) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>589) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>660) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>202) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1061) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1058) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>546) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>939) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>605) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1083) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>846) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>903) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>707) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>411) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>672) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1040) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>958) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>994) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>746) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>646) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>509) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>528) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>148) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>289) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>619) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>874) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>639) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>266) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>870) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>441) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>190) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>977) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1095) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>887) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>572) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>477) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>412) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>177) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>654) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>851) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>870) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>326) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>627) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>561) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>592) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>191) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>298) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>618) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>340) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>517) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>563) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>298) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>110) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>237) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>556) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1001) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>589) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>340) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>343) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>302) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>152) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>896) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>111) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>114) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>773) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>871) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>745) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>861) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>145) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>910) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>397) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1077) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>448) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1037) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>743) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>279) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1071) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>970) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>115) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>790) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>564) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>320) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>914) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>281) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>697) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1092) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>997) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>626) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>772) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>547) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>872) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>869) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>746) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>622) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>453) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>996) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>189) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>592) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>807) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>507) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>994) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>446) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>690) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>272) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>833) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>460) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>960) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>632) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>659) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>457) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>208) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1013) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>864) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>351) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>465) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>252) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>356) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>357) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>791) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1065) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>139) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>604) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>271) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>844) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>832) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1017) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>138) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>532) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>903) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>878) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>331) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>695) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1024) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>677) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>814) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>161) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>320) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>378) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1001) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>452) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>790) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>564) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>688) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>549) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>303) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>410) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>177) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>511) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>738) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>196) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>761) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>456) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>452) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>474) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>983) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>796) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>995) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>373) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>169) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>930) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>783) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>179) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>301) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>213) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>884) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>145) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>703) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1078) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>674) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>638) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>817) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>776) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>469) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>314) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>485) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>879) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>206) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>764) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>845) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>574) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>314) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>738) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>419) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>696) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>627) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>986) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>743) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>148) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>171) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>412) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>475) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>422) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>709) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>477) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1065) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>564) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>865) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>754) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1093) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>451) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1058) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1019) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>300) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>813) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>243) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>146) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>244) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>185) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>345) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>244) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>990) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>441) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>325) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>796) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>272) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>175) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>665) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>786) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>944) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>935) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>292) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>216) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>402) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>350) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>931) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>274) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>830) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>694) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>956) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>746) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>991) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>870) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>477) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>683) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>801) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>449) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>359) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1099) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>678) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>501) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>854) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>961) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>162) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>531) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>356) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>953) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1065) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>866) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>105) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>776) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>446) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>849) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>763) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>952) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1020) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>421) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1098) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>276) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>654) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>559) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>305) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1031) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1083) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>221) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>340) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1073) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>590) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>345) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>871) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>253) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>922) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>627) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>974) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>160) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>959) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>510) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>995) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>404) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1042) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>298) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>170) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>640) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>501) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>716) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>854) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>913) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>917) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>938) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>877) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1014) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>986) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>908) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>644) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>770) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>508) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>956) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>906) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1012) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>637) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>109) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>975) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>989) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>656) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>143) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>827) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>570) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>129) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>392) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>108) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>124) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>124) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>862) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>926) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>814) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>782) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>875) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1053) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>254) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>270) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>223) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>557) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>952) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1030) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>313) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>147) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>611) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1037) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>279) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>502) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>194) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>268) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>221) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>813) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>616) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>455) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>812) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>144) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>244) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>495) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>152) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1089) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>543) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>459) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>355) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>306) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>138) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>379) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>354) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>271) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>543) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>412) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1047) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>252) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>993) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>650) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>822) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>513) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>508) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>926) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1075) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>892) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>672) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>104) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>772) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>829) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>167) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>863) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>710) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>115) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>125) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>540) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>978) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1060) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>569) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>905) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>467) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>621) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>861) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>138) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>647) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>923) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>717) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>847) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>193) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1086) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>464) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>305) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>989) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>601) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>186) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>108) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>657) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>614) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>819) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1064) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>339) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>330) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>853) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>886) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>686) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>241) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>764) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>204) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1045) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>468) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>528) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>787) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>482) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1013) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>800) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>643) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>873) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>578) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>104) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>791) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>411) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>528) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>108) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1071) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>473) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>571) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1001) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>840) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>584) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>295) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>372) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>691) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>482) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>659) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>361) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>158) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>238) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>610) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>970) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>879) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>363) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>735) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>397) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>811) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>417) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>186) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>298) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>292) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1039) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>196) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>715) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>151) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>841) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1019) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1070) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>370) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>464) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>460) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>928) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>749) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>379) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>354) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>690) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>100) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>165) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1068) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>637) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>927) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>569) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>848) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>104) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>472) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>730) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>403) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>594) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1058) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1096) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>322) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>248) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>738) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>799) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>638) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1006) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>569) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>879) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>598) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>489) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>583) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>220) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>635) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>802) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>222) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>577) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>168) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>967) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>798) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>263) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1077) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1095) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>146) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>474) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>482) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1049) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>368) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>624) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>684) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>956) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>134) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>665) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>455) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1038) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>805) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1053) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>342) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>752) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>558) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>463) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>316) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>223) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>226) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1058) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>609) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>403) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>593) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>241) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>871) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>495) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>599) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>603) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>973) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>937) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>837) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>580) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>973) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>219) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>655) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>340) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1030) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>748) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>704) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1038) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>347) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>619) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>860) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>874) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>378) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>638) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>283) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1077) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>509) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>753) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>874) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>233) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>692) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>569) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1075) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>837) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>736) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>519) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1088) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>419) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>847) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>803) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>118) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>796) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>720) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>883) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>745) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>570) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>936) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>261) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>919) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>471) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>802) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>630) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>893) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>914) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1075) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>495) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>189) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1026) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>246) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>422) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>247) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>535) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>661) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>283) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>110) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1038) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>754) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>990) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>399) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>487) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>333) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>917) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>242) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>256) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>423) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>848) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>734) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>255) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>293) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>576) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>103) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>265) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1046) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>516) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1006) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>233) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>493) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>523) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>743) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>195) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>104) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>594) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>925) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>393) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>909) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>107) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>812) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>148) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>706) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>407) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>295) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>920) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>645) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>640) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>807) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>878) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>398) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>790) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1058) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>231) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>792) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>292) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>180) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>249) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>213) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>194) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1087) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>707) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1047) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>661) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>683) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>311) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>800) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>551) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>735) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>872) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>923) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>543) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>422) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>207) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>727) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>424) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>797) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>128) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>189) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>188) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>693) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>276) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>460) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>852) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>651) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>667) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>511) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>330) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>536) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>285) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>994) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1003) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>431) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>707) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>259) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>449) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>265) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>670) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>727) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>948) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>697) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>738) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>790) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>492) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>311) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>860) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>687) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>919) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>409) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>122) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>884) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>686) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>134) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>550) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>476) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>694) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>592) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>129) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>938) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>138) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>830) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>611) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>630) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>584) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1026) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>996) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>309) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>569) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>414) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>548) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>377) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>743) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>931) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>953) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>440) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>292) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>295) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>171) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>687) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>695) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>125) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1093) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>987) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>740) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>416) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>587) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>566) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>742) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>197) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>645) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>382) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1010) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>981) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>621) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>310) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>209) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>704) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>553) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>204) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1067) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>346) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>980) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>649) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>335) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1064) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1045) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1060) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>299) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>417) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>155) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>244) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>217) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>214) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>142) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>381) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>119) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>383) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>123) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>717) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>873) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>396) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>164) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>192) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>298) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>314) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>487) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>797) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>946) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>410) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>506) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>468) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>874) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>245) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>267) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1037) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>200) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>952) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>685) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1089) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>792) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>818) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>384) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>943) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>556) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>565) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>945) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>959) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>329) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>698) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1033) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>882) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1078) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>211) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>413) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>794) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>658) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>485) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>755) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>185) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>765) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>188) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>261) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>874) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>535) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1084) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>440) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>207) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>102) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1009) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>845) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>580) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>423) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>582) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>226) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>127) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>960) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>587) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>559) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1003) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>600) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>161) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>343) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>114) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>684) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>307) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>754) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>296) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>162) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>415) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1087) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>422) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>851) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>621) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1006) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>429) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>358) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>502) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1024) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>177) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>670) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>190) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>726) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>199) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>699) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>972) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>532) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1011) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1073) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>343) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>334) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>966) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>600) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>731) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>693) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>246) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>660) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1000) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>147) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>242) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>718) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>854) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>828) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>677) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>124) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>258) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>451) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>413) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>745) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>770) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>703) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>542) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>757) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>550) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>203) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>732) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>838) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>593) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>211) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>321) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>700) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>915) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>596) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>976) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>612) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>867) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>859) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>777) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>517) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>509) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>895) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>589) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>706) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>517) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>492) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>429) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>171) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>728) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>621) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>545) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>197) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>118) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>544) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1066) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>263) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>128) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>283) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>300) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>901) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>616) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>359) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>732) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>373) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>376) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>413) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>886) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>503) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>711) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>595) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>776) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>149) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>816) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1067) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>801) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>619) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>850) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>458) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>952) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>706) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1076) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>721) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>437) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>744) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1067) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>702) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>894) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>668) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>571) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>117) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>516) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>481) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>801) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>558) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>560) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>538) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>732) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>459) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>201) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>664) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>573) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>639) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>583) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1070) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>684) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>313) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>610) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>932) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>526) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>360) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>189) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>418) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>447) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>261) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>184) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>700) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>845) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>819) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>268) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>342) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>786) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>646) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>565) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>185) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>607) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>793) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>366) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>746) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>883) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>567) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>340) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1015) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>257) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1065) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>183) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>220) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>574) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>452) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>278) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>234) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>632) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>802) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>761) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>184) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1021) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>246) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>251) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>361) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>297) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>437) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>342) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>241) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>248) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>423) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>630) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>797) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>797) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>339) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>280) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>341) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>725) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>293) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>736) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1067) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>509) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>576) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1065) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>190) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>531) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>981) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>543) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>691) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>993) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>298) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>717) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>929) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>323) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>876) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1040) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>953) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>517) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1083) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>392) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>721) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>974) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>805) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>523) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>369) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>867) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>912) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1087) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>951) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>308) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>235) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>832) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>641) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>770) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>309) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>202) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>271) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>123) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>250) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1044) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>657) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>679) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>429) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>307) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>270) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>177) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>619) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>665) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>845) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>745) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>922) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>310) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>306) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>117) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>384) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>864) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>773) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>598) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>752) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1051) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>688) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1043) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>167) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>244) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>117) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1037) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>210) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>782) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>780) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>321) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>814) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>152) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>279) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>897) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>674) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>832) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>908) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>906) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>273) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>838) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>636) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>418) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>678) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>936) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>453) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>735) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>545) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>673) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1029) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>247) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>337) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>805) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>496) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>359) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>720) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>520) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>441) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>715) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>254) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>931) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1063) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>888) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>859) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>459) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1026) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>450) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>192) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>855) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>514) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>670) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>597) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1083) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>277) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>428) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>780) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>148) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>821) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>892) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>615) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>872) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>105) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>274) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>705) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>123) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>103) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>435) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>392) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>423) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>994) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>351) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>514) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>613) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>538) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>866) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>944) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>463) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1023) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>614) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>937) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>703) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>346) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>383) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>260) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>670) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1018) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>615) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>242) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>895) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>106) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>883) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>623) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>689) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>579) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>251) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>843) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>897) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>693) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>558) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>810) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1056) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>144) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>640) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>217) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>447) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1071) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>200) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>676) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>603) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>668) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>594) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>699) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>475) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>579) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>610) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>515) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>976) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>100) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>314) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>764) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>562) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>244) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>609) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>620) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>726) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>509) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>567) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>227) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>323) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>424) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>745) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>881) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>530) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>884) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>514) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>644) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>730) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>359) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>932) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1061) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>216) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>114) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>329) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>258) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>427) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>296) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>785) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>875) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>113) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>637) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>534) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>243) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1022) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>996) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>175) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>156) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1068) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>529) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>154) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>422) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>987) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1052) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1059) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>292) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>183) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>410) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1092) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>679) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>656) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>691) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>121) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>840) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1091) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>515) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>568) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>512) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>246) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>363) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>586) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>154) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>379) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>106) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>583) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>830) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>869) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>234) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>904) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>297) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1031) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>771) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>238) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>975) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>122) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>298) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>836) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>566) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>868) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>124) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>893) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>904) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>403) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1078) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1066) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>399) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>780) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>375) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>707) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1093) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>304) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>285) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>234) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>397) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>450) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>393) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>111) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>637) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>351) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>428) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>976) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>118) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>592) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>443) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>658) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>715) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>253) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>626) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>256) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>704) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>620) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>121) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>942) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>722) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1050) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>899) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>305) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>267) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>471) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>468) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>838) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>169) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>221) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>564) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>926) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>205) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>388) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>988) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>605) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>363) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>480) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>905) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>557) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>278) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>296) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>516) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>245) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>718) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>436) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>725) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>772) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>205) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>935) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>720) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>384) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>553) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1084) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>676) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>328) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>785) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>654) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>257) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>216) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>347) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>640) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>707) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>149) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1060) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>246) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>467) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>908) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>898) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>583) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>225) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>332) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>499) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>561) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>944) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1054) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>733) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>188) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>231) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>700) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>700) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>556) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>459) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>734) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>866) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>704) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>353) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>782) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>484) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>873) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>488) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>200) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1089) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>364) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>243) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>953) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1089) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>348) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>491) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>805) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1031) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>736) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1017) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>293) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>622) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>946) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>400) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>268) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>924) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>248) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>655) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>453) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>325) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>481) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>152) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>711) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>945) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>584) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>337) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1090) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>466) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>970) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>718) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>964) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>693) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>797) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>674) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>813) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>881) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>420) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>991) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>795) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>230) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>850) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>174) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1014) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>798) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>751) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>770) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1070) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>198) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>555) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>789) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>400) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1017) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>195) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1055) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1033) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>571) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>308) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>268) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>592) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1033) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>674) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1093) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>316) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>721) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>832) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>778) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>906) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>386) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>532) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>449) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>110) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>896) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>197) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>203) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>524) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>279) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>358) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>660) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>807) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>453) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>245) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>658) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>200) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>456) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>347) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>402) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1084) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>833) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>411) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>484) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>681) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>393) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>994) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>531) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>491) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1069) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>630) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>722) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>108) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>657) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>573) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>686) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>531) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>652) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>338) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>852) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>709) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>651) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>697) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>854) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>345) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>927) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1077) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>863) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>685) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1012) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>324) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>937) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>651) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1093) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>298) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>328) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>775) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>203) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>324) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>919) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>572) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>228) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>975) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>822) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>237) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>338) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>153) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>823) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>165) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1018) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>196) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>594) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>277) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>744) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>815) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1085) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>139) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1029) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>190) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>448) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>749) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>601) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>144) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>112) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>497) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>131) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>911) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>136) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>891) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>158) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>204) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>299) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>715) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>578) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>508) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>641) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>616) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>842) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>214) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1072) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>196) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>444) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>217) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>925) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>725) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>675) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>348) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>323) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>440) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>377) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>906) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>994) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>571) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>189) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>158) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1027) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>341) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>664) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>425) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>531) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>438) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>155) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>506) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>679) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>237) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>221) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>608) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>834) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>572) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1046) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>122) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>248) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>207) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>585) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>399) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>952) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>528) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>157) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>308) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>888) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>599) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>714) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>591) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>691) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>704) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>151) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>267) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>729) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>664) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1097) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>569) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>486) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1055) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>757) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>328) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>740) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1070) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>729) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>293) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1017) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>207) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>867) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>217) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>177) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>209) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>724) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>837) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>876) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1019) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>772) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>210) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>985) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1098) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>486) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>947) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>623) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>460) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>663) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>563) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1062) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>977) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>518) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>753) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>582) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>159) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>972) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>365) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>174) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>525) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>434) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>160) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1096) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1079) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>429) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>607) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>115) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>625) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>500) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>937) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>412) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>393) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>905) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>861) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>213) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>963) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>446) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>267) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>375) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>172) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>632) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>841) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>790) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>928) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>240) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>992) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>106) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1022) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>413) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>888) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>634) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>547) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>851) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>938) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>325) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>465) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>802) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>509) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>696) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>623) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>948) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>744) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>822) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>640) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>997) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>725) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>424) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>262) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>991) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>152) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>547) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>751) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>310) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1092) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>257) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>370) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>441) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>851) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1013) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>134) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1014) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>786) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>390) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>104) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>170) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>449) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>408) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1050) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>610) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>279) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1026) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>168) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>175) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>252) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>151) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>338) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>614) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>427) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>204) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>405) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>377) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>179) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>661) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1006) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>912) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>824) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>756) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>489) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>527) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>741) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>831) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>671) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1075) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>602) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>357) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>250) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>218) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>995) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>595) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>462) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>586) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>168) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>652) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1071) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>889) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>708) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>665) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>490) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>951) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1039) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>512) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>370) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>284) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>223) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1066) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>552) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>639) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>241) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>119) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>437) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>261) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>564) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>975) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1000) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>519) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>201) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>273) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>519) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>481) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>950) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>960) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>452) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>286) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>786) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>354) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>287) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>894) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>737) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>727) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>888) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>666) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>246) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>575) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>130) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>939) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>700) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>818) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>568) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>881) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1082) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1019) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>279) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>444) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>569) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>719) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1076) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>376) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>561) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>392) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>615) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>662) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>325) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>272) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>159) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>177) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>707) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>211) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>243) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>913) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>959) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>182) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1034) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>409) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>691) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>691) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>225) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>757) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>914) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>629) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>825) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>887) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>330) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>893) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>147) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1005) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>615) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1045) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>338) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>224) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>421) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>215) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>690) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>291) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>196) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>524) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>187) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>208) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1007) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>471) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>939) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>306) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>963) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>472) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>645) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>306) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>677) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>701) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>597) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>650) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>475) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>204) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>962) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1042) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>748) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>631) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>255) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>819) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>169) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>817) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>893) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>491) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1065) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>187) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>551) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>215) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>790) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>497) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>469) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>253) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>532) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>914) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>234) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>935) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>196) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1049) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>703) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>582) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>336) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>801) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>287) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>808) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>194) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>733) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1015) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>581) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>471) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>198) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1079) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>597) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>604) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>720) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>105) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1049) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>917) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>124) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>337) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>771) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>775) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>144) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>856) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1059) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>388) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>464) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>344) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1095) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>199) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>418) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>721) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>604) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>776) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1024) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>312) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>725) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>264) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>589) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>999) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>589) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>545) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>858) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>569) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>574) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>577) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>210) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>628) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>312) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>347) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>435) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1059) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>747) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>802) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>550) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>746) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>136) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>512) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>539) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>506) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>247) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>167) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>679) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>459) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>402) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>306) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>627) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>851) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>689) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>173) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>112) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>437) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>610) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>990) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>809) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>608) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>866) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>577) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>132) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>598) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>718) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>256) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>427) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>179) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>968) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>443) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>609) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>768) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>247) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1086) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>227) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>740) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>421) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>553) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>838) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>776) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>608) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>555) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>873) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>884) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>400) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1040) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>604) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>556) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>175) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>570) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>963) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>449) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>144) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>470) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>400) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>462) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>429) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>639) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>720) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>572) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>127) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>743) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1088) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>999) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>529) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>471) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>276) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>830) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>830) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1024) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>767) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>455) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>147) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>447) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>287) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>415) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>553) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>695) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>351) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>910) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>360) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>909) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>208) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>466) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>659) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>907) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>794) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>236) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>583) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>986) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>437) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>599) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>748) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>170) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>283) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>741) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>513) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>477) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>955) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1050) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>503) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>383) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>248) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>667) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>943) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>694) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>314) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>369) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>964) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>514) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>644) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>312) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>519) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>719) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>912) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>840) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>953) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>627) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>665) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>151) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>544) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>984) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>852) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>212) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>171) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>578) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>633) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>382) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>190) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>735) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>543) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>502) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>335) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1073) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>805) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>402) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>505) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>513) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>340) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>705) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>524) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1075) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>541) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>775) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>836) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1017) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>684) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1065) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>427) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>620) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>466) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>907) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>393) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1011) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>866) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>624) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>321) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>874) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>695) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>397) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>300) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>190) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>297) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>459) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>668) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>357) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>260) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>424) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>422) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>478) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>787) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>852) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>965) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>839) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>128) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>247) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>864) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>399) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>922) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>275) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>825) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>474) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>392) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>637) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>923) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>630) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>458) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>552) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>572) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>780) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>661) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>729) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>559) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>625) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>848) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1009) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>192) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>416) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1050) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>135) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1054) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>597) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>307) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1026) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>497) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>104) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1025) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1085) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>781) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1083) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>423) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1036) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>848) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>472) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>979) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1055) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>314) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>752) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>137) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>559) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>637) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>381) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>629) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>659) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>350) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>200) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>358) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>522) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>984) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>653) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>105) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>761) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>631) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>215) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>934) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1098) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>551) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>132) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>904) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>171) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>187) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>287) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>253) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>330) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>315) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>422) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>931) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1005) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>147) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>342) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>734) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>107) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>366) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1044) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>274) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>934) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>733) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>440) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>248) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>224) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>308) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>362) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>797) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>346) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>183) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>527) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>215) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>174) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>755) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1063) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>159) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>405) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>299) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>371) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>344) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>103) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1071) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>542) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>347) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>636) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1056) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1096) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1091) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>448) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>299) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>497) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>652) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>105) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>694) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>981) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>308) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>701) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>402) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>563) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>469) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>722) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>534) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>621) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>363) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>477) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>148) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>289) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>741) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>125) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>771) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1043) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>598) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1006) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>933) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>553) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>629) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>280) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>803) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1041) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>709) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>953) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>109) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>260) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>216) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1061) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>481) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>413) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>545) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>621) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>922) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>479) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>254) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1070) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>827) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>209) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>819) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>808) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>508) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>293) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>554) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>558) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>274) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>920) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>679) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>976) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>117) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>752) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>780) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>938) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1043) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>270) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>802) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>914) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1074) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>412) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1084) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>127) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>454) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>374) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>975) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>841) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>881) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>958) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>430) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>354) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>595) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>721) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>104) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>829) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>768) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>263) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1055) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>911) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>764) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>592) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>747) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>433) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>964) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>539) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>849) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>320) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1023) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>989) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>590) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>442) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1086) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>786) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>333) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>136) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>540) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1079) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>535) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>874) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>878) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>890) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>605) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>579) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>880) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>200) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>500) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>731) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>593) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>826) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>699) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>935) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>696) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>152) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1066) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1067) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>777) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>781) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1081) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>310) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>262) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>303) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>526) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>280) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>333) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>968) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>303) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>696) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>251) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>562) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>949) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1043) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>623) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>442) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1004) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>880) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>198) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>297) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>683) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>854) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>291) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>215) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>593) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>839) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>197) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>236) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>693) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>751) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1065) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>204) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>989) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>777) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1036) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>203) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1072) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>134) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>835) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>620) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>296) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>765) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>468) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>865) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>555) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>786) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>435) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>697) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>538) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>127) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>806) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>148) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>882) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>534) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>366) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>526) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>695) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>437) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>876) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>352) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>157) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>892) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>680) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>823) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>848) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>186) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>678) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>321) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>850) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>710) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>153) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>510) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>857) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>823) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>216) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>998) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>390) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>778) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1091) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>246) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>712) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>854) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>752) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>133) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>538) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>724) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>173) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>231) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>260) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>135) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>131) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>993) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>403) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>390) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>149) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>301) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>312) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>986) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>186) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>851) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>256) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>752) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>367) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>874) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>659) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>260) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>621) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>488) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>965) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>345) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>472) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>257) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>175) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>530) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>460) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>915) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>453) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>570) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>121) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>840) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>874) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>967) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>305) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1007) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>924) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>793) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>781) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>776) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>921) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1011) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>372) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>749) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>635) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1085) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>802) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>698) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>963) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>949) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>499) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>425) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>975) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>828) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>907) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>275) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>273) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1070) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>484) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>219) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>121) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>401) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>382) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>960) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>887) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>252) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>151) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>502) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>891) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>426) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>886) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>140) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>801) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>276) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>861) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>187) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1074) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>913) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>797) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>647) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>810) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1069) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>560) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>560) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>503) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>792) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>475) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>982) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>583) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>584) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>519) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>692) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1025) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1051) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1005) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>454) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>127) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>720) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>532) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>225) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>967) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>962) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>211) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>462) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>614) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>563) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>460) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>599) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>198) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>917) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>879) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>768) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>499) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>564) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1029) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1094) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>643) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>436) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>414) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>163) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>631) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>794) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>640) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>222) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>514) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>326) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>309) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>577) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>531) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>520) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1050) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>106) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>625) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1086) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>533) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>653) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>896) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>443) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>756) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>305) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>477) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>631) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>377) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>902) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>280) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1007) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>135) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1067) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>229) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>818) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>804) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>528) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>712) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1074) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>201) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>802) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>890) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>797) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>932) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>432) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>250) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>953) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1022) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>388) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>965) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>560) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>104) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>974) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>447) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>549) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>261) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>791) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>836) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1013) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>302) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>886) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>480) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>702) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>923) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1076) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>684) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>130) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>220) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>665) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>745) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>573) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>686) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>741) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>884) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>960) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>363) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>646) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1031) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>297) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>579) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>474) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>663) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>852) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>443) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>982) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>301) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>705) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1025) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>515) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>107) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>519) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>585) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>433) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>263) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>890) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>735) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>563) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>461) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>546) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>387) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>381) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>558) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>978) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>877) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>163) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>342) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>921) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>674) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>309) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>430) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>933) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>937) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>731) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>610) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>128) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>401) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>695) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>383) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>733) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>222) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>184) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>815) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>191) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>342) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>380) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>486) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>629) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>353) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>196) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>112) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>616) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>893) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>225) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>837) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>632) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1031) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1042) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>226) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>164) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>817) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>465) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>369) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>657) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>586) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>540) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1034) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>617) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>402) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>376) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>500) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>748) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>487) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>204) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>165) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1005) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>625) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>505) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1007) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1056) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>144) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1025) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>701) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>584) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>665) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1063) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>855) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>211) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>172) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>688) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>957) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>527) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>688) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>953) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>694) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>877) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>986) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>425) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>439) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>551) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>538) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>121) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>747) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>278) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1068) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>351) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>496) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>671) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>463) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1024) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1039) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1076) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>315) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>962) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1002) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>234) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>586) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1008) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>986) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>151) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>108) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>864) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>626) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>374) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>697) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>566) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>152) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>943) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>976) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>124) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>584) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>533) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>283) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>938) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>989) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>356) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>942) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>176) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>599) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>402) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>504) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>105) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>108) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>575) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>187) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>652) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>777) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>740) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>695) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>904) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1077) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>632) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>637) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1003) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>928) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>501) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>805) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>316) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>300) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>174) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>225) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>222) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>836) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>774) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>444) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>662) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>376) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>275) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>883) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>421) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>381) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>340) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>994) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>316) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>106) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>980) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>330) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>911) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>317) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>253) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>821) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>341) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>702) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>803) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1035) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>760) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>161) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>357) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>319) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>970) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>586) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>813) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>420) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>749) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>186) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1081) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>818) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>326) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>646) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>281) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>406) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>737) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>319) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>404) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>795) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>124) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>102) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>297) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>374) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>981) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>975) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>280) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>551) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>978) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>935) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>443) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>478) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>607) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1090) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>990) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>428) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>435) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>274) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>743) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>586) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>117) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>502) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>128) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>126) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>271) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>448) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>905) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>853) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>246) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>452) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1054) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>487) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>209) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>986) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>216) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>517) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>260) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>839) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>114) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>737) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1039) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>198) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>584) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1041) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>964) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>599) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>553) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>107) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>269) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>445) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>865) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>629) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>274) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>608) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>584) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>738) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>295) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>388) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>250) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>860) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>473) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>732) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>178) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>604) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>407) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>117) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1016) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>743) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>751) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>819) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>851) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>657) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1085) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1047) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>459) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>875) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>767) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>300) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>923) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>843) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>730) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>789) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>560) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>124) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>142) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1040) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>350) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>664) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>399) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>963) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>605) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>705) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>221) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>904) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>280) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>276) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>127) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>155) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>925) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>831) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>334) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1065) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>320) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>447) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>344) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>600) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>955) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>771) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1045) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>575) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>244) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>300) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>174) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>534) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>501) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>204) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>231) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>960) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>359) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>833) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>731) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>967) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>958) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>801) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>198) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>391) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>441) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>439) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>978) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>341) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>852) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>996) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>180) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>323) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>320) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>947) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>780) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>959) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>385) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>295) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>349) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>513) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>496) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>339) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>828) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>617) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>340) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>588) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>430) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>718) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>533) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>557) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>921) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>198) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>802) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>218) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>642) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>876) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>230) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>959) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>105) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>759) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>630) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>417) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>604) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>856) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>342) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>183) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>607) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>719) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>219) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>908) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>871) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>530) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>523) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>467) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>971) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>107) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>642) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>820) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>907) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>992) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>486) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>418) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>307) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>336) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>590) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>424) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>761) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>124) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>923) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>684) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>284) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>425) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>118) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>915) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>935) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>417) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>696) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>941) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>869) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>662) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>120) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>921) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>573) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>481) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>619) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>473) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>771) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>576) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>969) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>242) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>523) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1074) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>741) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>581) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>175) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>548) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>354) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>795) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>774) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>261) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>839) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>195) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>423) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1072) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>701) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>150) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>337) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>972) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>287) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>377) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>434) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>287) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>138) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>765) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>272) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>795) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>281) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>480) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>215) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>138) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>164) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>290) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>924) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>690) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>564) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>270) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>260) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>885) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1038) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>997) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>200) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>587) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>666) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>278) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>612) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1003) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>469) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>888) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>577) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>177) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>281) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>877) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>126) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>993) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>423) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>344) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>233) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>873) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>678) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>445) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1051) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>898) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>420) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>895) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>439) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>911) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>813) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>876) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>371) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>322) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>560) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>870) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1057) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>787) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>971) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>817) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>384) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>652) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>934) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>763) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>495) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>576) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>970) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>555) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>524) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>255) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>708) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>176) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>962) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>576) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>250) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>416) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>404) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>156) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>852) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>639) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>603) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>375) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>670) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>661) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>743) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>446) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>207) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>256) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>991) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1051) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>622) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1024) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>866) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>796) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>656) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>347) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>799) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>824) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>883) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>541) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>363) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>495) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>425) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1020) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>772) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>875) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>243) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>222) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>353) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>174) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>781) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>473) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>677) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>485) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>945) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>343) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>151) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>962) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>543) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>780) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>240) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1074) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>278) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>930) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>693) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1058) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>470) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>362) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>437) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>623) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>319) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>273) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>778) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>485) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>749) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1076) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>689) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>177) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>185) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>449) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>120) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>513) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1074) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1009) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>862) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>546) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>585) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>854) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>399) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>322) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>609) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>686) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>844) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>757) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>736) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>466) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>271) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>409) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>217) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>229) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>193) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>980) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1074) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>404) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>996) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>331) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>260) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>611) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>554) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>731) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>382) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>139) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>831) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>940) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>723) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1074) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>675) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>744) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>456) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>931) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>843) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>418) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>755) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>706) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>218) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>989) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1044) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>594) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>966) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>809) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1009) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>171) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>247) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>998) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>880) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>929) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>135) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>460) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1042) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>197) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>513) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>317) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>949) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>451) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>200) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>349) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>948) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>306) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>535) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>764) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>491) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>242) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>732) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>603) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>900) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>147) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>884) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>945) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>409) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>714) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>390) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1039) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1036) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>627) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>612) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>641) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>731) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>631) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>769) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>440) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1064) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>571) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>640) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>209) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>692) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>367) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>489) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>264) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>373) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1000) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>115) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>238) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>810) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>974) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>422) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>352) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>146) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>469) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>207) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>619) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>730) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>162) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>409) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>738) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>165) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>312) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>290) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>942) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1067) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>145) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>699) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>227) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1009) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1095) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>312) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>211) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>984) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>797) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>125) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1055) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1094) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>971) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>948) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>214) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>540) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1021) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>627) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>629) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>395) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>972) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>764) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>628) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>410) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>989) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>530) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>388) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>328) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>565) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>648) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1087) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>783) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>339) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>316) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>350) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>972) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>163) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>484) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1059) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>819) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>636) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>279) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>406) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>149) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>801) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>914) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>739) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>919) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>699) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>832) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>186) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>753) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>691) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>868) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>666) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>846) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1088) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>240) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>545) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>381) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>785) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>998) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>576) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>792) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>988) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>350) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1036) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>168) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>505) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>503) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>851) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>109) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>813) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>828) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>383) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>164) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>839) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>267) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>884) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>786) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>310) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>631) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>275) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>539) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>305) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>443) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>966) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>481) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>962) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>232) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>494) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>553) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>410) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>315) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>780) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>404) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>403) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>166) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>681) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>747) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>316) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>243) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>430) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>796) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>519) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>635) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>460) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>890) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>672) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>525) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>659) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1096) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>448) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>248) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>271) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>171) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>402) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>689) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1059) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>149) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>524) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>513) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>117) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>475) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>747) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>732) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>478) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>859) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>742) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>450) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>352) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>300) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>1090) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>310) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>109) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>453) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>760) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>134) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>906) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>897) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>973) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>319) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>715) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>101) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>520) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>697) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1055) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>905) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>550) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>434) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>708) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>530) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>141) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>158) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>395) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>487) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>864) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>168) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>926) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>694) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>914) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>905) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>175) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>951) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>497) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>455) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>714) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>619) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>153) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>705) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>861) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1058) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>615) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>169) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>269) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>206) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>145) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>602) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>772) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>1017) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>974) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>812) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>1079) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>516) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>205) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>476) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>847) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>543) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>834) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>915) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>178) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>477) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>922) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1055) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>152) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>222) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>270) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>165) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>732) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>820) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>156) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>212) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>328) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>507) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>422) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>305) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<9; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>969) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>487) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<3; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>922) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>969) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>665) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>820) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>262) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>307) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>1000) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>698) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>359) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>408) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<4; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1065) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>665) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<3) s=s+k*j; else s=s-i;
+        while (s>660) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<10; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>621) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<7; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>956) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>465) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>181) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<8; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>146) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<6; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>345) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>669) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<0) s=s+k*j; else s=s-i;
+        while (s>599) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<1) s=s+k*j; else s=s-i;
+        while (s>148) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<5; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<2) s=s+k*j; else s=s-i;
+        while (s>974) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<1; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>584) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  for (i=0; i<2; i=i+1) {
+    j=0;
+    while (j<i) {
+      for (k=0; k<j; k=k+1) {
+        if (k<4) s=s+k*j; else s=s-i;
+        while (s>1026) s=s/2;
+      }
+      j=j+1;
+    }
+  }
+  return s;
+}
@@ -0,0 +1,122 @@
+#include "9cc.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// On-disk cache of generated code, one file per function.
+//
+// A function's key is a 128-bit hash of its tokens, from the return
+// type to the closing brace, plus the compiler's cache version and
+// any options that change the generated code. Code for a function
+// depends only on its own tokens, so a function whose key is in the
+// cache does not need to be parsed, type-checked or generated again.
+// Whitespace changes do not change the key.
+
+// Bump this when a change to the compiler changes its output.
+#define CACHE_VERSION "9cc-cache-13"
+
+static char *cache_dir;
+static char *cache_salt;
+
+typedef struct {
+  unsigned long h1;
+  unsigned long h2;
+} Hasher;
+
+static void hash_bytes(Hasher *h, void *p, size_t len) {
+  // Two FNV-1a variants with different offset bases and primes.
+  unsigned char *s = p;
+  for (size_t i = 0; i < len; i++) {
+    h->h1 = (h->h1 ^ s[i]) * 0x100000001b3ul;
+    h->h2 = (h->h2 ^ s[i]) * 0x1000000000000c1ful;
+  }
+}
+
+// Enables the cache. `salt` describes the options that affect
+// code generation.
+void cache_init(char *dir, char *salt) {
+  if (mkdir(dir, 0755) < 0 && errno != EEXIST)
+    error("cannot create cache directory %s: %s", dir, strerror(errno));
+  cache_dir = dir;
+  cache_salt = salt;
+}
+
+bool cache_enabled(void) {
+  return cache_dir;
+}
+
+// Computes the key of the tokens in [begin, end).
+void cache_key(Token *begin, Token *end, char *buf) {
+  Hasher h = {0xcbf29ce484222325ul, 0x6c62272e07bb0142ul};
+  hash_bytes(&h, CACHE_VERSION, strlen(CACHE_VERSION));
+  hash_bytes(&h, cache_salt, strlen(cache_salt) + 1);
+
+  for (Token *tok = begin; tok != end; tok = tok->next) {
+    hash_bytes(&h, &tok->kind, sizeof(tok->kind));
+    hash_bytes(&h, &tok->len, sizeof(tok->len));
+    hash_bytes(&h, tok->str, tok->len);
+  }
+
+  sprintf(buf, "%016lx%016lx", h.h1, h.h2);
+}
+
+static char *cache_path(char *key) {
+  char *path = malloc(strlen(cache_dir) + strlen(key) + 4);
+  sprintf(path, "%s/%s.s", cache_dir, key);
+  return path;
+}
+
+// Returns the cached assembly for `key`, or NULL if there is none.
+// The caller owns the returned memory.
+char *cache_lookup(char *key, size_t *len) {
+  char *path = cache_path(key);
+  int fd = open(path, O_RDONLY);
+  free(path);
+  if (fd < 0)
+    return NULL;
+
+  struct stat st;
+  char *buf = NULL;
+  if (fstat(fd, &st) == 0 && (buf = malloc(st.st_size + 1))) {
+    size_t n = 0;
+    while (n < st.st_size) {
+      ssize_t r = read(fd, buf + n, st.st_size - n);
+      if (r <= 0)
+        break;
+      n += r;
+    }
+    if (n != st.st_size) {
+      free(buf);
+      buf = NULL;
+    }
+    *len = n;
+  }
+  close(fd);
+  return buf;
+}
+
+// Stores assembly for `key`. The file is written under a temporary
+// name and renamed, so concurrent compilers never see a partial
+// entry. Failures are ignored; the cache is only an optimization.
+void cache_store(char *key, char *text, size_t len) {
+  char *path = cache_path(key);
+  char *tmp = malloc(strlen(path) + 32);
+  sprintf(tmp, "%s.%d.%lx.tmp", path, getpid(), (unsigned long)text);
+
+  int fd = open(tmp, O_WRONLY | O_CREAT | O_EXCL, 0644);
+  if (fd >= 0) {
+    size_t n = 0;
+    while (n < len) {
+      ssize_t w = write(fd, text + n, len - n);
+      if (w <= 0)
+        break;
+      n += w;
+    }
+    close(fd);
+    if (n != len || rename(tmp, path) < 0)
+      unlink(tmp);
+  }
+
+  free(tmp);
+  free(path);
+}
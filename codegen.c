@@ -1,247 +1,521 @@
 #include "9cc.h"
+#include <pthread.h>
+#include <stdatomic.h>
 
-static char *argreg[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
+// This file lowers the IR of each function to x86-64 instructions
+// once its virtual registers have been mapped to real ones. They are
+// printed as assembly, or encoded into machine code by asm.c if the
+// output is an object.
 
-static int labelseq = 1;
-static char *funcname;
+// Registers available to the register allocator. The first
+// num_caller_saved of them are not preserved across calls; the
+// others are saved by the prologue if they are used.
+int regs[] = {R10, R11, RBX, R12, R13, R14, R15};
+int num_regs = sizeof(regs) / sizeof(*regs);
+int num_caller_saved = 2;
 
-static void gen(Node *node);
+// Argument registers are never allocated, so they can be set up for
+// a call without disturbing any live value. rax, rdx, rdi and rsi
+// are scratch registers for division, multiplication and spilled
+// values.
+static int argreg[] = {RDI, RSI, RDX, RCX, R8, R9};
 
-// Pushes the given node's address to the stack.
-static void gen_addr(Node *node) {
-  switch (node->kind) {
-  case ND_VAR:
-    printf("  lea rax, [rbp-%d]\n", node->var->offset);
-    printf("  push rax\n");
-    return;
-  case ND_DEREF:
-    gen(node->lhs);
-    return;
+// Per-function state. Functions may be generated on different
+// threads, so this is thread-local. Block labels are numbered per
+// function and are qualified by the function's name.
+static _Thread_local char *funcname;
+static _Thread_local int funcname_len;
+
+// Set by codegen_object(), which does not print the instructions
+static bool encode;
+
+static atomic_long instructions;
+
+static Operand reg(int rn, int size) {
+  return (Operand){.kind = OPD_REG, .reg = rn, .size = size};
+}
+
+static Operand imm(long val) {
+  return (Operand){.kind = OPD_IMM, .imm = val};
+}
+
+// [base+disp], accessing `size` bytes if it is not 0
+static Operand mem(int base, long disp, int size) {
+  return (Operand){
+    .kind = OPD_MEM, .size = size, .base = base, .index = -1, .scale = 1,
+    .disp = disp,
+  };
+}
+
+static Operand sym(char *name) {
+  return (Operand){.kind = OPD_SYM, .sym = name, .symlen = strlen(name)};
+}
+
+// Label 0 is the function's return label.
+static Operand label(int n) {
+  return (Operand){
+    .kind = OPD_LABEL, .imm = n, .sym = funcname, .symlen = funcname_len,
+  };
+}
+
+// Instructions are collected and handed to the peephole optimizer
+// before they are printed. Long functions are optimized a window at
+// a time, which keeps the instructions in cache. Windows end at a
+// label once they have WINDOW instructions, where cutting loses
+// little, and are cut anywhere at WINDOW_MAX.
+#define WINDOW 256
+#define WINDOW_MAX 1024
+
+static _Thread_local Insn window[WINDOW_MAX];
+static _Thread_local int nwindow;
+
+static void flush_window(void) {
+  int n = peephole(window, nwindow);
+  long ninsns = 0;
+  for (int i = 0; i < n; i++) {
+    if (window[i].mn != I_LABEL && window[i].mn != I_GLOBAL)
+      ninsns++;
+    if (encode)
+      asm_insn(&window[i]);
+    else
+      emit_insn(&window[i]);
+  }
+  atomic_fetch_add(&instructions, ninsns);
+  nwindow = 0;
+}
+
+static Insn *new_insn(Mnemonic mn, int nops) {
+  if (nwindow == WINDOW_MAX || (nwindow >= WINDOW && mn == I_LABEL))
+    flush_window();
+  Insn *in = &window[nwindow++];
+  in->mn = mn;
+  in->nops = nops;
+  return in;
+}
+
+static void insn0(Mnemonic mn) {
+  new_insn(mn, 0);
+}
+
+static void insn1(Mnemonic mn, Operand a) {
+  new_insn(mn, 1)->ops[0] = a;
+}
+
+static void insn2(Mnemonic mn, Operand a, Operand b) {
+  Insn *in = new_insn(mn, 2);
+  in->ops[0] = a;
+  in->ops[1] = b;
+}
+
+// Returns the register holding `r`. A spilled register is loaded
+// into `scratch` first.
+static int use(Reg *r, int scratch) {
+  if (r->rn >= 0)
+    return regs[r->rn];
+  insn2(I_MOV, reg(scratch, 8), mem(RBP, -r->offset, 0));
+  return scratch;
+}
+
+// Returns the register to write `r` to. Spilled registers are
+// written to rax and stored by writeback().
+static int def(Reg *r) {
+  return r->rn >= 0 ? regs[r->rn] : RAX;
+}
+
+static void writeback(Reg *r) {
+  if (r->rn < 0)
+    insn2(I_MOV, mem(RBP, -r->offset, 0), reg(RAX, 8));
+}
+
+// Emits dst = a op b with a two-operand instruction.
+static void gen_binop(IR *ir, Mnemonic mn, bool commutative) {
+  int a = use(ir->a, RDI);
+  int b = use(ir->b, RSI);
+  int d = def(ir->dst);
+
+  if (d == a) {
+    insn2(mn, reg(d, 8), reg(b, 8));
+  } else if (d != b) {
+    insn2(I_MOV, reg(d, 8), reg(a, 8));
+    insn2(mn, reg(d, 8), reg(b, 8));
+  } else if (commutative) {
+    insn2(mn, reg(d, 8), reg(a, 8));
+  } else {
+    insn2(I_MOV, reg(RAX, 8), reg(a, 8));
+    insn2(mn, reg(RAX, 8), reg(b, 8));
+    insn2(I_MOV, reg(d, 8), reg(RAX, 8));
   }
+  writeback(ir->dst);
+}
 
-  error_tok(node->tok, "not an lvalue");
+// Emits dst = a op imm with a shift instruction.
+static void gen_shift(IR *ir, Mnemonic mn) {
+  int a = use(ir->a, RDI);
+  int d = def(ir->dst);
+  if (a != d)
+    insn2(I_MOV, reg(d, 8), reg(a, 8));
+  insn2(mn, reg(d, 8), imm(ir->imm));
+  writeback(ir->dst);
 }
 
-static void load(void) {
-  printf("  pop rax\n");
-  printf("  mov rax, [rax]\n");
-  printf("  push rax\n");
+static void gen_cmp(IR *ir, Mnemonic mn) {
+  int a = use(ir->a, RDI);
+  int b = use(ir->b, RSI);
+  insn2(I_CMP, reg(a, 8), reg(b, 8));
+  insn1(mn, reg(RAX, 1));
+  insn2(I_MOVZB, reg(def(ir->dst), 8), reg(RAX, 1));
+  writeback(ir->dst);
 }
 
-static void store(void) {
-  printf("  pop rdi\n");
-  printf("  pop rax\n");
-  printf("  mov [rax], rdi\n");
-  printf("  push rdi\n");
+// Returns the conditional jump taken if `cond` holds, or if it does
+// not hold if `negate` is true.
+static Mnemonic jcc(IROp cond, bool negate) {
+  switch (cond) {
+  case IR_EQ:
+    return negate ? I_JNE : I_JE;
+  case IR_NE:
+    return negate ? I_JE : I_JNE;
+  case IR_LT:
+    return negate ? I_JGE : I_JL;
+  case IR_LE:
+    return negate ? I_JG : I_JLE;
+  }
+  unreachable();
 }
 
-// Generate code for a given node.
-static void gen(Node *node) {
-  switch (node->kind) {
-  case ND_NULL:
+static void gen_call(IR *ir) {
+  for (int i = 0; i < ir->nargs; i++) {
+    int r = use(ir->args[i], argreg[i]);
+    if (r != argreg[i])
+      insn2(I_MOV, reg(argreg[i], 8), reg(r, 8));
+  }
+
+  // RSP is aligned to 16 bytes, as the ABI requires at calls, by
+  // the prologue and does not move in the function body.
+  // RAX is set to 0 for variadic function.
+  insn2(I_MOV, reg(RAX, 8), imm(0));
+  insn1(I_CALL, sym(ir->name));
+
+  if (ir->dst->rn >= 0)
+    insn2(I_MOV, reg(regs[ir->dst->rn], 8), reg(RAX, 8));
+  writeback(ir->dst);
+}
+
+static void gen_insn(IR *ir, BB *next) {
+  switch (ir->op) {
+  case IR_IMM:
+    insn2(I_MOV, reg(def(ir->dst), 8), imm(ir->imm));
+    writeback(ir->dst);
+    return;
+  case IR_MOV: {
+    int a = use(ir->a, RDI);
+    int d = def(ir->dst);
+    if (a != d)
+      insn2(I_MOV, reg(d, 8), reg(a, 8));
+    writeback(ir->dst);
+    return;
+  }
+  case IR_ARG:
+    insn2(I_MOV, reg(def(ir->dst), 8), reg(argreg[ir->imm], 8));
+    writeback(ir->dst);
     return;
-  case ND_NUM:
-    printf("  push %ld\n", node->val);
+  case IR_BPREL:
+    insn2(I_LEA, reg(def(ir->dst), 8), mem(RBP, -ir->var->offset, 0));
+    writeback(ir->dst);
     return;
-  case ND_EXPR_STMT:
-    gen(node->lhs);
-    printf("  add rsp, 8\n");
+  case IR_ADD:
+    gen_binop(ir, I_ADD, true);
     return;
-  case ND_VAR:
-    gen_addr(node);
-    load();
+  case IR_SUB:
+    gen_binop(ir, I_SUB, false);
     return;
-  case ND_ASSIGN:
-    gen_addr(node->lhs);
-    gen(node->rhs);
-    store();
+  case IR_MUL:
+    gen_binop(ir, I_IMUL, true);
+    return;
+  case IR_DIV: {
+    int a = use(ir->a, RDI);
+    int b = use(ir->b, RSI);
+    insn2(I_MOV, reg(RAX, 8), reg(a, 8));
+    insn0(I_CQO);
+    insn1(I_IDIV, reg(b, 8));
+    if (ir->dst->rn >= 0)
+      insn2(I_MOV, reg(regs[ir->dst->rn], 8), reg(RAX, 8));
+    writeback(ir->dst);
+    return;
+  }
+  case IR_SHL:
+    gen_shift(ir, I_SHL);
     return;
-  case ND_ADDR:
-    gen_addr(node->lhs);
+  case IR_SHR:
+    gen_shift(ir, I_SHR);
+    return;
+  case IR_SAR:
+    gen_shift(ir, I_SAR);
+    return;
+  case IR_LEA: {
+    int a = use(ir->a, RDI);
+    int b = use(ir->b, RSI);
+    Operand m = mem(a, 0, 0);
+    m.index = b;
+    m.scale = ir->imm;
+    insn2(I_LEA, reg(def(ir->dst), 8), m);
+    writeback(ir->dst);
+    return;
+  }
+  case IR_MULHI: {
+    // The one-operand imul leaves the high half in rdx.
+    int a = use(ir->a, RDI);
+    insn2(I_MOV, reg(RAX, 8), imm(ir->imm));
+    insn1(I_IMUL, reg(a, 8));
+    insn2(I_MOV, reg(def(ir->dst), 8), reg(RDX, 8));
+    writeback(ir->dst);
+    return;
+  }
+  case IR_EQ:
+    gen_cmp(ir, I_SETE);
     return;
-  case ND_DEREF:
-    gen(node->lhs);
-    load();
+  case IR_NE:
+    gen_cmp(ir, I_SETNE);
     return;
-  case ND_IF: {
-    int seq = labelseq++;
-    if (node->els) {
-      gen(node->cond);
-      printf("  pop rax\n");
-      printf("  cmp rax, 0\n");
-      printf("  je  .L.else.%d\n", seq);
-      gen(node->then);
-      printf("  jmp .L.end.%d\n", seq);
-      printf(".L.else.%d:\n", seq);
-      gen(node->els);
-      printf(".L.end.%d:\n", seq);
-    } else {
-      gen(node->cond);
-      printf("  pop rax\n");
-      printf("  cmp rax, 0\n");
-      printf("  je  .L.end.%d\n", seq);
-      gen(node->then);
-      printf(".L.end.%d:\n", seq);
+  case IR_LT:
+    gen_cmp(ir, I_SETL);
+    return;
+  case IR_LE:
+    gen_cmp(ir, I_SETLE);
+    return;
+  case IR_SEXT: {
+    int a = use(ir->a, RDI);
+    Mnemonic mn = ir->size == 4 ? I_MOVSXD : I_MOVSX;
+    insn2(mn, reg(def(ir->dst), 8), reg(a, ir->size));
+    writeback(ir->dst);
+    return;
+  }
+  case IR_LOAD: {
+    int a = use(ir->a, RDI);
+    int d = def(ir->dst);
+    if (ir->size == 8)
+      insn2(I_MOV, reg(d, 8), mem(a, 0, 0));
+    else
+      insn2(ir->size == 4 ? I_MOVSXD : I_MOVSX, reg(d, 8), mem(a, 0, ir->size));
+    writeback(ir->dst);
+    return;
+  }
+  case IR_STORE: {
+    int a = use(ir->a, RDI);
+    int b = use(ir->b, RSI);
+    insn2(I_MOV, mem(a, 0, 0), reg(b, ir->size));
+    return;
+  }
+  case IR_CALL:
+    gen_call(ir);
+    return;
+  case IR_JMP:
+    if (ir->bb1 != next)
+      insn1(I_JMP, label(ir->bb1->label));
+    return;
+  case IR_BR: {
+    int a = use(ir->a, RDI);
+    if (ir->b)
+      insn2(I_CMP, reg(a, 8), reg(use(ir->b, RSI), 8));
+    else
+      insn2(I_CMP, reg(a, 8), imm(0));
+    if (ir->bb1 == next) {
+      insn1(jcc(ir->cond, true), label(ir->bb2->label));
+      return;
     }
+    insn1(jcc(ir->cond, false), label(ir->bb1->label));
+    if (ir->bb2 != next)
+      insn1(I_JMP, label(ir->bb2->label));
     return;
   }
-  case ND_WHILE: {
-    int seq = labelseq++;
-    printf(".L.begin.%d:\n", seq);
-    gen(node->cond);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  je  .L.end.%d\n", seq);
-    gen(node->then);
-    printf("  jmp .L.begin.%d\n", seq);
-    printf(".L.end.%d:\n", seq);
-    return;
-  }
-  case ND_FOR: {
-    int seq = labelseq++;
-    if (node->init)
-      gen(node->init);
-    printf(".L.begin.%d:\n", seq);
-    if (node->cond) {
-      gen(node->cond);
-      printf("  pop rax\n");
-      printf("  cmp rax, 0\n");
-      printf("  je  .L.end.%d\n", seq);
+  case IR_RET:
+    if (ir->a) {
+      int a = use(ir->a, RDI);
+      insn2(I_MOV, reg(RAX, 8), reg(a, 8));
     }
-    gen(node->then);
-    if (node->inc)
-      gen(node->inc);
-    printf("  jmp .L.begin.%d\n", seq);
-    printf(".L.end.%d:\n", seq);
-    return;
-  }
-  case ND_BLOCK:
-    for (Node *n = node->body; n; n = n->next)
-      gen(n);
-    return;
-  case ND_FUNCALL: {
-    int nargs = 0;
-    for (Node *arg = node->args; arg; arg = arg->next) {
-      gen(arg);
-      nargs++;
+    if (next)
+      insn1(I_JMP, label(0));
+    return;
+  }
+
+  unreachable();
+}
+
+static void gen_func(Function *fn) {
+  size_t len;
+  FILE *dump = dump_ir ? open_memstream(&fn->ir_dump, &len) : NULL;
+
+  gen_ir(fn);
+  if (dump)
+    print_ir(fn, dump, "gen_ir");
+
+  reduce_strength(fn);
+  if (dump)
+    print_ir(fn, dump, "reduce_strength");
+
+  hoist_invariants(fn);
+  if (dump) {
+    print_ir(fn, dump, "hoist_invariants");
+    fclose(dump);
+  }
+
+  alloc_regs(fn);
+
+  if (encode)
+    asm_begin();
+  else
+    emit_begin();
+  funcname = fn->name;
+  funcname_len = strlen(fn->name);
+
+  insn1(I_GLOBAL, sym(fn->name));
+  insn1(I_LABEL, sym(fn->name));
+
+  // Prologue. Callee-saved registers are saved below the variables
+  // and spill slots.
+  int nsaved = 0;
+  for (int i = num_caller_saved; i < num_regs; i++)
+    if (fn->used_regs & (1 << i))
+      nsaved++;
+
+  // RSP is 8 below a 16-byte boundary on entry, so it is aligned
+  // once RBP is pushed if the frame size is a multiple of 16.
+  int frame_size = (fn->stack_size + nsaved * 8 + 15) & ~15;
+  insn1(I_PUSH, reg(RBP, 8));
+  insn2(I_MOV, reg(RBP, 8), reg(RSP, 8));
+  if (frame_size)
+    insn2(I_SUB, reg(RSP, 8), imm(frame_size));
+
+  int offset = fn->stack_size;
+  for (int i = num_caller_saved; i < num_regs; i++) {
+    if (fn->used_regs & (1 << i)) {
+      offset += 8;
+      insn2(I_MOV, mem(RBP, -offset, 0), reg(regs[i], 8));
     }
+  }
 
-    for (int i = nargs - 1; i >= 0; i--)
-      printf("  pop %s\n", argreg[i]);
-
-    // We need to align RSP to a 16 byte boundary before
-    // calling a function because it is an ABI requirement.
-    // RAX is set to 0 for variadic function.
-    int seq = labelseq++;
-    printf("  mov rax, rsp\n");
-    printf("  and rax, 15\n");
-    printf("  jnz .L.call.%d\n", seq);
-    printf("  mov rax, 0\n");
-    printf("  call %s\n", node->funcname);
-    printf("  jmp .L.end.%d\n", seq);
-    printf(".L.call.%d:\n", seq);
-    printf("  sub rsp, 8\n");
-    printf("  mov rax, 0\n");
-    printf("  call %s\n", node->funcname);
-    printf("  add rsp, 8\n");
-    printf(".L.end.%d:\n", seq);
-    printf("  push rax\n");
-    return;
-  }
-  case ND_RETURN:
-    gen(node->lhs);
-    printf("  pop rax\n");
-    printf("  jmp .L.return.%s\n", funcname);
-    return;
-  }
-
-  gen(node->lhs);
-  gen(node->rhs);
-
-  printf("  pop rdi\n");
-  printf("  pop rax\n");
-
-  switch (node->kind) {
-  case ND_ADD:
-    printf("  add rax, rdi\n");
-    break;
-  case ND_PTR_ADD:
-    printf("  imul rdi, 8\n");
-    printf("  add rax, rdi\n");
-    break;
-  case ND_SUB:
-    printf("  sub rax, rdi\n");
-    break;
-  case ND_PTR_SUB:
-    printf("  imul rdi, 8\n");
-    printf("  sub rax, rdi\n");
-    break;
-  case ND_PTR_DIFF:
-    printf("  sub rax, rdi\n");
-    printf("  cqo\n");
-    printf("  mov rdi, 8\n");
-    printf("  idiv rdi\n");
-    break;
-  case ND_MUL:
-    printf("  imul rax, rdi\n");
-    break;
-  case ND_DIV:
-    printf("  cqo\n");
-    printf("  idiv rdi\n");
-    break;
-  case ND_EQ:
-    printf("  cmp rax, rdi\n");
-    printf("  sete al\n");
-    printf("  movzb rax, al\n");
-    break;
-  case ND_NE:
-    printf("  cmp rax, rdi\n");
-    printf("  setne al\n");
-    printf("  movzb rax, al\n");
-    break;
-  case ND_LT:
-    printf("  cmp rax, rdi\n");
-    printf("  setl al\n");
-    printf("  movzb rax, al\n");
-    break;
-  case ND_LE:
-    printf("  cmp rax, rdi\n");
-    printf("  setle al\n");
-    printf("  movzb rax, al\n");
-    break;
-  }
-
-  printf("  push rax\n");
-}
-
-void codegen(Function *prog) {
-  printf(".intel_syntax noprefix\n");
+  // Emit code
+  for (BB *bb = fn->bbs; bb; bb = bb->next) {
+    if (bb != fn->bbs)
+      insn1(I_LABEL, label(bb->label));
+    for (IR *ir = bb->ir; ir; ir = ir->next)
+      gen_insn(ir, bb->next);
+  }
 
-  for (Function *fn = prog; fn; fn = fn->next) {
-    printf(".global %s\n", fn->name);
-    printf("%s:\n", fn->name);
-    funcname = fn->name;
-
-    // Prologue
-    printf("  push rbp\n");
-    printf("  mov rbp, rsp\n");
-    printf("  sub rsp, %d\n", fn->stack_size);
-
-    // Push arguments to the stack
-    int i = 0;
-    for (VarList *vl = fn->params; vl; vl = vl->next) {
-      Var *var = vl->var;
-      printf("  mov [rbp-%d], %s\n", var->offset, argreg[i++]);
+  // Epilogue
+  insn1(I_LABEL, label(0));
+  offset = fn->stack_size;
+  for (int i = num_caller_saved; i < num_regs; i++) {
+    if (fn->used_regs & (1 << i)) {
+      offset += 8;
+      insn2(I_MOV, reg(regs[i], 8), mem(RBP, -offset, 0));
+    }
+  }
+  insn2(I_MOV, reg(RSP, 8), reg(RBP, 8));
+  insn1(I_POP, reg(RBP, 8));
+  insn0(I_RET);
+  flush_window();
+
+  if (encode)
+    fn->text = asm_end(&fn->text_len);
+  else
+    fn->text = emit_end(&fn->text_len);
+  ir_free();
+}
+
+// Functions are handed out to workers one at a time in source order.
+typedef struct {
+  Function **fns;
+  int nfns;
+  atomic_int next;
+} WorkQueue;
+
+static void *worker(void *arg) {
+  WorkQueue *q = arg;
+  for (;;) {
+    int i = atomic_fetch_add(&q->next, 1);
+    if (i >= q->nfns)
+      return NULL;
+    if (!q->fns[i]->cached)
+      gen_func(q->fns[i]);
+  }
+}
+
+// Generates code for all functions of `prog` that were not found in
+// the cache, using up to `nthreads` threads. Each function is
+// generated into its own buffer, so the output does not depend on
+// the number of threads.
+static void gen_funcs(Function *prog, int nthreads) {
+  int nfns = 0;
+  for (Function *fn = prog; fn; fn = fn->next)
+    nfns++;
+
+  Function **fns = malloc(sizeof(Function *) * (nfns + 1));
+  nfns = 0;
+  for (Function *fn = prog; fn; fn = fn->next)
+    fns[nfns++] = fn;
+
+  WorkQueue q = {fns, nfns};
+  if (nthreads > nfns)
+    nthreads = nfns;
+
+  instructions = 0;
+  pthread_t *threads = malloc(sizeof(pthread_t) * (nthreads + 1));
+  int nstarted = 0;
+  for (int i = 1; i < nthreads; i++)
+    if (!pthread_create(&threads[nstarted], NULL, worker, &q))
+      nstarted++;
+  worker(&q);
+  for (int i = 0; i < nstarted; i++)
+    pthread_join(threads[i], NULL);
+
+  for (int i = 0; i < nfns; i++) {
+    Function *fn = fns[i];
+    if (*fn->cache_key && !fn->cached)
+      cache_store(fn->cache_key, fn->text, fn->text_len);
+
+    if (fn->ir_dump) {
+      fputs(fn->ir_dump, stderr);
+      free(fn->ir_dump);
+      fn->ir_dump = NULL;
     }
+  }
 
-    // Emit code
-    for (Node *node = fn->node; node; node = node->next)
-      gen(node);
+  free(threads);
+  free(fns);
+}
 
-    // Epilogue
-    printf(".L.return.%s:\n", funcname);
-    printf("  mov rsp, rbp\n");
-    printf("  pop rbp\n");
-    printf("  ret\n");
+// Generates assembly for all functions and writes it out in source
+// order.
+void codegen(Function *prog, int nthreads) {
+  encode = false;
+  gen_funcs(prog, nthreads);
+
+  char *header = ".intel_syntax noprefix\n";
+  emit_raw(header, strlen(header));
+  for (Function *fn = prog; fn; fn = fn->next) {
+    emit_raw(fn->text, fn->text_len);
+    free(fn->text);
+    fn->text = NULL;
   }
 }
+
+// Generates machine code for all functions and links it.
+Object *codegen_object(Function *prog, int nthreads) {
+  encode = true;
+  gen_funcs(prog, nthreads);
+
+  Object *obj = asm_link(prog);
+  for (Function *fn = prog; fn; fn = fn->next) {
+    free(fn->text);
+    fn->text = NULL;
+  }
+  return obj;
+}
+
+// Returns the number of instructions generated by the last call of
+// codegen() or codegen_object(). Functions taken from the cache are
+// not counted.
+long codegen_instructions(void) {
+  return instructions;
+}
@@ -0,0 +1,165 @@
+#include "9cc.h"
+#include <elf.h>
+
+// Writes an assembled Object as a relocatable ELF object file for
+// x86-64. The file has a single .text section, a symbol table with
+// the functions it defines and the external functions it calls, and
+// a .rela.text section with a PLT32 relocation for each such call.
+
+enum {
+  SEC_NULL,
+  SEC_TEXT,
+  SEC_RELA,
+  SEC_SYMTAB,
+  SEC_STRTAB,
+  SEC_SHSTRTAB,
+  SEC_NOTE,
+  NUM_SECTIONS,
+};
+
+static char shstrtab[] =
+  "\0.text\0.rela.text\0.symtab\0.strtab\0.shstrtab\0.note.GNU-stack";
+
+static int shstr_offset(char *name) {
+  for (int i = 1; i < sizeof(shstrtab); i += strlen(shstrtab + i) + 1)
+    if (!strcmp(shstrtab + i, name))
+      return i;
+  return 0;
+}
+
+static size_t align_to(size_t n, size_t align) {
+  return (n + align - 1) / align * align;
+}
+
+// Returns an ELF image of `obj`. The caller owns the returned memory.
+char *elf_image(Object *obj, size_t *size) {
+  // ELF wants local symbols before global ones. Symbol 0 is null.
+  int *elf_index = calloc(obj->nsyms + 1, sizeof(int));
+  int nsyms = 1;
+  for (int pass = 0; pass < 2; pass++)
+    for (int i = 0; i < obj->nsyms; i++)
+      if (obj->syms[i].global == pass)
+        elf_index[i] = nsyms++;
+
+  int first_global = 1;
+  for (int i = 0; i < obj->nsyms; i++)
+    if (!obj->syms[i].global)
+      first_global++;
+
+  size_t strtab_size = 1;
+  for (int i = 0; i < obj->nsyms; i++)
+    strtab_size += strlen(obj->syms[i].name) + 1;
+
+  // Layout
+  size_t text_off = align_to(sizeof(Elf64_Ehdr), 16);
+  size_t rela_off = align_to(text_off + obj->text_len, 8);
+  size_t rela_size = sizeof(Elf64_Rela) * obj->nrelocs;
+  size_t symtab_off = align_to(rela_off + rela_size, 8);
+  size_t symtab_size = sizeof(Elf64_Sym) * nsyms;
+  size_t strtab_off = symtab_off + symtab_size;
+  size_t shstrtab_off = strtab_off + strtab_size;
+  size_t shdr_off = align_to(shstrtab_off + sizeof(shstrtab), 8);
+  *size = shdr_off + sizeof(Elf64_Shdr) * NUM_SECTIONS;
+
+  char *buf = calloc(1, *size);
+  if (!buf || !elf_index)
+    error("out of memory");
+
+  Elf64_Ehdr *eh = (Elf64_Ehdr *)buf;
+  memcpy(eh->e_ident, ELFMAG, SELFMAG);
+  eh->e_ident[EI_CLASS] = ELFCLASS64;
+  eh->e_ident[EI_DATA] = ELFDATA2LSB;
+  eh->e_ident[EI_VERSION] = EV_CURRENT;
+  eh->e_ident[EI_OSABI] = ELFOSABI_SYSV;
+  eh->e_type = ET_REL;
+  eh->e_machine = EM_X86_64;
+  eh->e_version = EV_CURRENT;
+  eh->e_shoff = shdr_off;
+  eh->e_ehsize = sizeof(Elf64_Ehdr);
+  eh->e_shentsize = sizeof(Elf64_Shdr);
+  eh->e_shnum = NUM_SECTIONS;
+  eh->e_shstrndx = SEC_SHSTRTAB;
+
+  memcpy(buf + text_off, obj->text, obj->text_len);
+
+  Elf64_Rela *rela = (Elf64_Rela *)(buf + rela_off);
+  for (int i = 0; i < obj->nrelocs; i++) {
+    Reloc *r = &obj->relocs[i];
+    rela[i].r_offset = r->offset;
+    rela[i].r_info = ELF64_R_INFO(elf_index[r->sym], R_X86_64_PLT32);
+    rela[i].r_addend = r->addend;
+  }
+
+  Elf64_Sym *syms = (Elf64_Sym *)(buf + symtab_off);
+  char *strtab = buf + strtab_off;
+  int stroff = 1;
+  for (int i = 0; i < obj->nsyms; i++) {
+    Symbol *s = &obj->syms[i];
+    Elf64_Sym *es = &syms[elf_index[i]];
+    es->st_name = stroff;
+    strcpy(strtab + stroff, s->name);
+    stroff += strlen(s->name) + 1;
+
+    int bind = s->global ? STB_GLOBAL : STB_LOCAL;
+    if (s->defined) {
+      es->st_info = ELF64_ST_INFO(bind, STT_FUNC);
+      es->st_shndx = SEC_TEXT;
+      es->st_value = s->offset;
+    } else {
+      es->st_info = ELF64_ST_INFO(bind, STT_NOTYPE);
+      es->st_shndx = SHN_UNDEF;
+    }
+  }
+
+  memcpy(buf + shstrtab_off, shstrtab, sizeof(shstrtab));
+
+  Elf64_Shdr *sh = (Elf64_Shdr *)(buf + shdr_off);
+
+  sh[SEC_TEXT].sh_name = shstr_offset(".text");
+  sh[SEC_TEXT].sh_type = SHT_PROGBITS;
+  sh[SEC_TEXT].sh_flags = SHF_ALLOC | SHF_EXECINSTR;
+  sh[SEC_TEXT].sh_offset = text_off;
+  sh[SEC_TEXT].sh_size = obj->text_len;
+  sh[SEC_TEXT].sh_addralign = 16;
+
+  sh[SEC_RELA].sh_name = shstr_offset(".rela.text");
+  sh[SEC_RELA].sh_type = SHT_RELA;
+  sh[SEC_RELA].sh_flags = SHF_INFO_LINK;
+  sh[SEC_RELA].sh_offset = rela_off;
+  sh[SEC_RELA].sh_size = rela_size;
+  sh[SEC_RELA].sh_link = SEC_SYMTAB;
+  sh[SEC_RELA].sh_info = SEC_TEXT;
+  sh[SEC_RELA].sh_addralign = 8;
+  sh[SEC_RELA].sh_entsize = sizeof(Elf64_Rela);
+
+  sh[SEC_SYMTAB].sh_name = shstr_offset(".symtab");
+  sh[SEC_SYMTAB].sh_type = SHT_SYMTAB;
+  sh[SEC_SYMTAB].sh_offset = symtab_off;
+  sh[SEC_SYMTAB].sh_size = symtab_size;
+  sh[SEC_SYMTAB].sh_link = SEC_STRTAB;
+  sh[SEC_SYMTAB].sh_info = first_global;
+  sh[SEC_SYMTAB].sh_addralign = 8;
+  sh[SEC_SYMTAB].sh_entsize = sizeof(Elf64_Sym);
+
+  sh[SEC_STRTAB].sh_name = shstr_offset(".strtab");
+  sh[SEC_STRTAB].sh_type = SHT_STRTAB;
+  sh[SEC_STRTAB].sh_offset = strtab_off;
+  sh[SEC_STRTAB].sh_size = strtab_size;
+  sh[SEC_STRTAB].sh_addralign = 1;
+
+  sh[SEC_SHSTRTAB].sh_name = shstr_offset(".shstrtab");
+  sh[SEC_SHSTRTAB].sh_type = SHT_STRTAB;
+  sh[SEC_SHSTRTAB].sh_offset = shstrtab_off;
+  sh[SEC_SHSTRTAB].sh_size = sizeof(shstrtab);
+  sh[SEC_SHSTRTAB].sh_addralign = 1;
+
+  // An empty .note.GNU-stack tells the linker that the object does
+  // not need an executable stack.
+  sh[SEC_NOTE].sh_name = shstr_offset(".note.GNU-stack");
+  sh[SEC_NOTE].sh_type = SHT_PROGBITS;
+  sh[SEC_NOTE].sh_offset = shdr_off;
+  sh[SEC_NOTE].sh_addralign = 1;
+
+  free(elf_index);
+  return buf;
+}
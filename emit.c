@@ -0,0 +1,291 @@
+#include "9cc.h"
+#include <stdatomic.h>
+#include <unistd.h>
+
+// Generated assembly is accumulated in a buffer and written out in
+// large blocks. The code generator passes instructions with
+// structured operands rather than text, so nothing parses a format
+// string: emit_insn() copies mnemonics and register names from
+// tables and formats integers by hand.
+//
+// Each thread writes to its own current buffer. By default that is
+// the output file's buffer, but output can be captured into a
+// private buffer with emit_begin()/emit_end(). Code generation uses
+// that to generate functions in parallel and write them out in order
+// afterwards. Captures nest.
+
+#define FLUSH_SIZE (1 << 20)
+
+// Room that is always available at the end of the buffer. An
+// instruction, apart from the symbols in it, must fit in it.
+#define SLACK 1024
+
+typedef struct Buffer Buffer;
+struct Buffer {
+  Buffer *prev; // Enclosing capture
+  char *data;
+  size_t len;
+  size_t cap;
+};
+
+static int out_fd = 1;
+static Buffer file_buf;
+static atomic_size_t allocated;
+static _Thread_local Buffer *cur;
+
+static void write_all(char *p, size_t n) {
+  while (n > 0) {
+    ssize_t w = write(out_fd, p, n);
+    if (w < 0)
+      error("write failed: %s", strerror(errno));
+    p += w;
+    n -= w;
+  }
+}
+
+static void reserve(Buffer *b, size_t n) {
+  if (b->len + n <= b->cap)
+    return;
+  size_t oldcap = b->cap;
+  while (b->len + n > b->cap)
+    b->cap = b->cap ? b->cap * 2 : 4096;
+  atomic_fetch_add(&allocated, b->cap - oldcap);
+  b->data = realloc(b->data, b->cap);
+  if (!b->data)
+    out_of_memory();
+}
+
+// Formats `val` in decimal at `p` and returns the end of the digits.
+static char *format_long(char *p, long val) {
+  char tmp[24];
+  char *q = tmp + sizeof(tmp);
+  unsigned long u = val < 0 ? -(unsigned long)val : val;
+
+  do {
+    *--q = '0' + u % 10;
+    u /= 10;
+  } while (u);
+  if (val < 0)
+    *--q = '-';
+
+  while (q < tmp + sizeof(tmp))
+    *p++ = *q++;
+  return p;
+}
+
+// Register names, indexed by size and register number. Names are
+// at most four letters, so they are copied four bytes at a time.
+static char reg_names[9][16][5] = {
+  [8] = {"rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+         "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"},
+  [4] = {"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi",
+         "r8d", "r9d", "r10d", "r11d", "r12d", "r13d", "r14d", "r15d"},
+  [2] = {"ax", "cx", "dx", "bx", "sp", "bp", "si", "di",
+         "r8w", "r9w", "r10w", "r11w", "r12w", "r13w", "r14w", "r15w"},
+  [1] = {"al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil",
+         "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b"},
+};
+
+// Returns the name of the low `size` bytes of register `reg`.
+char *reg_name(int reg, int size) {
+  return reg_names[size][reg];
+}
+
+static char *put_reg(char *w, int reg, int size) {
+  char *name = reg_names[size][reg];
+  memcpy(w, name, 4);
+  return w + (name[2] ? name[3] ? 4 : 3 : 2);
+}
+
+typedef struct {
+  char text[12];
+  int len;
+} Fixed;
+
+#define FIXED(s) {s, sizeof(s) - 1}
+
+// Mnemonics with their indentation, padded to three letters
+static Fixed mnemonics[] = {
+  [I_MOV] = FIXED("  mov "),     [I_MOVSX] = FIXED("  movsx "),
+  [I_MOVSXD] = FIXED("  movsxd "), [I_MOVZB] = FIXED("  movzb "),
+  [I_LEA] = FIXED("  lea "),     [I_ADD] = FIXED("  add "),
+  [I_SUB] = FIXED("  sub "),     [I_IMUL] = FIXED("  imul "),
+  [I_IDIV] = FIXED("  idiv "),   [I_CQO] = FIXED("  cqo"),
+  [I_SHL] = FIXED("  shl "),     [I_SHR] = FIXED("  shr "),
+  [I_SAR] = FIXED("  sar "),     [I_CMP] = FIXED("  cmp "),
+  [I_SETE] = FIXED("  sete "),   [I_SETNE] = FIXED("  setne "),
+  [I_SETL] = FIXED("  setl "),   [I_SETLE] = FIXED("  setle "),
+  [I_JMP] = FIXED("  jmp "),     [I_JE] = FIXED("  je  "),
+  [I_JNE] = FIXED("  jne "),     [I_JL] = FIXED("  jl  "),
+  [I_JGE] = FIXED("  jge "),     [I_JLE] = FIXED("  jle "),
+  [I_JG] = FIXED("  jg  "),      [I_CALL] = FIXED("  call "),
+  [I_PUSH] = FIXED("  push "),   [I_POP] = FIXED("  pop "),
+  [I_RET] = FIXED("  ret"),
+};
+
+static Fixed mem_prefixes[] = {
+  [0] = FIXED("["),            [1] = FIXED("BYTE PTR ["),
+  [2] = FIXED("WORD PTR ["),   [4] = FIXED("DWORD PTR ["),
+  [8] = FIXED("QWORD PTR ["),
+};
+
+static char *put_fixed(char *w, Fixed *f) {
+  memcpy(w, f->text, sizeof(f->text));
+  return w + f->len;
+}
+
+static char *put_operand(char *w, Operand *op) {
+  switch (op->kind) {
+  case OPD_REG:
+    return put_reg(w, op->reg, op->size);
+  case OPD_IMM:
+    return format_long(w, op->imm);
+  case OPD_SYM:
+    memcpy(w, op->sym, op->symlen);
+    return w + op->symlen;
+  case OPD_LABEL:
+    if (!op->imm) {
+      memcpy(w, ".L.return.", 10);
+      memcpy(w + 10, op->sym, op->symlen);
+      return w + 10 + op->symlen;
+    }
+    memcpy(w, ".L.", 3);
+    memcpy(w + 3, op->sym, op->symlen);
+    w += 3 + op->symlen;
+    *w++ = '.';
+    return format_long(w, op->imm);
+  case OPD_MEM: {
+    w = put_fixed(w, &mem_prefixes[op->size]);
+    bool reg = op->base >= 0 || op->index >= 0;
+    if (op->base >= 0)
+      w = put_reg(w, op->base, 8);
+    if (op->index >= 0) {
+      if (op->base >= 0)
+        *w++ = '+';
+      w = put_reg(w, op->index, 8);
+      *w++ = '*';
+      *w++ = '0' + op->scale;
+    }
+    if (op->disp > 0 && reg)
+      *w++ = '+';
+    if (op->disp || !reg)
+      w = format_long(w, op->disp);
+    *w++ = ']';
+    return w;
+  }
+  }
+  unreachable();
+}
+
+// Appends an instruction to the output. Register names, integers
+// and labels are copied straight into the buffer.
+void emit_insn(Insn *in) {
+  Buffer *b = cur ? cur : &file_buf;
+
+  // Only symbols are not of bounded length.
+  size_t n = SLACK;
+  for (int i = 0; i < in->nops; i++)
+    n += in->ops[i].symlen;
+  reserve(b, n);
+
+  char *w = b->data + b->len;
+
+  switch (in->mn) {
+  case I_LABEL:
+    w = put_operand(w, &in->ops[0]);
+    *w++ = ':';
+    break;
+  case I_GLOBAL:
+    memcpy(w, ".global ", 8);
+    w = put_operand(w + 8, &in->ops[0]);
+    break;
+  default:
+    w = put_fixed(w, &mnemonics[in->mn]);
+    if (in->nops > 0)
+      w = put_operand(w, &in->ops[0]);
+    if (in->nops > 1) {
+      *w++ = ',';
+      *w++ = ' ';
+      w = put_operand(w, &in->ops[1]);
+    }
+  }
+  *w++ = '\n';
+
+  b->len = w - b->data;
+  if (b == &file_buf && out_fd >= 0 && b->len >= FLUSH_SIZE)
+    emit_flush();
+}
+
+// Appends `len` bytes of already formatted text to the output.
+void emit_raw(char *s, size_t len) {
+  if (cur) {
+    reserve(cur, len);
+    memcpy(cur->data + cur->len, s, len);
+    cur->len += len;
+    return;
+  }
+
+  if (out_fd >= 0 && file_buf.len + len >= FLUSH_SIZE)
+    emit_flush();
+  if (out_fd >= 0 && len >= FLUSH_SIZE) {
+    write_all(s, len);
+    return;
+  }
+  reserve(&file_buf, len);
+  memcpy(file_buf.data + file_buf.len, s, len);
+  file_buf.len += len;
+}
+
+// Starts capturing the calling thread's output into a new buffer.
+void emit_begin(void) {
+  Buffer *b = calloc(1, sizeof(Buffer));
+  if (!b)
+    out_of_memory();
+  b->prev = cur;
+  cur = b;
+}
+
+// Stops the innermost capture and returns the captured text. The
+// caller owns the returned memory.
+char *emit_end(size_t *len) {
+  Buffer *b = cur;
+  char *data = b->data;
+  *len = b->len;
+  cur = b->prev;
+  free(b);
+  return data;
+}
+
+// Sets the file descriptor the output is written to. If `fd` is -1,
+// the output is kept in memory until it is taken by emit_take().
+void emit_open(int fd) {
+  // Drop captures left behind by a compilation that failed.
+  while (cur) {
+    size_t len;
+    free(emit_end(&len));
+  }
+
+  out_fd = fd;
+  file_buf.len = 0;
+}
+
+// Writes out everything emitted to the output file so far.
+void emit_flush(void) {
+  if (out_fd < 0)
+    return;
+  write_all(file_buf.data, file_buf.len);
+  file_buf.len = 0;
+}
+
+// Returns the output kept in memory and empties the buffer. The
+// returned text is valid until the next output is emitted.
+char *emit_take(size_t *len) {
+  *len = file_buf.len;
+  file_buf.len = 0;
+  return file_buf.data;
+}
+
+// Returns the number of bytes ever allocated for output buffers.
+size_t emit_allocated(void) {
+  return allocated;
+}
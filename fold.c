@@ -0,0 +1,181 @@
+#include "9cc.h"
+#include <limits.h>
+
+// Constant folding and algebraic simplification on the typed AST.
+//
+// Integer subtrees whose operands are constants are replaced by
+// their value, and identities such as x+0, x*1 and - -x are
+// simplified. Pointer arithmetic is never folded as if it were
+// integer arithmetic: only its integer operand is folded, and p+0
+// and p-0 become p.
+//
+// Folding follows the machine's semantics. Arithmetic wraps around,
+// and divisions that would trap (by zero, or LONG_MIN by -1) are
+// left for run time.
+
+static bool is_num(Node *node, long val) {
+  return node->kind == ND_NUM && node->val == val;
+}
+
+static bool has_side_effects(Node *node) {
+  if (!node)
+    return false;
+
+  switch (node->kind) {
+  case ND_ASSIGN:
+  case ND_FUNCALL:
+    return true;
+  case ND_NUM:
+  case ND_VAR:
+    return false;
+  case ND_ADDR:
+  case ND_DEREF:
+    return has_side_effects(node->lhs);
+  }
+  return has_side_effects(node->lhs) || has_side_effects(node->rhs);
+}
+
+// Turns `node` into a constant. Every expression node has room for
+// a value, so this is done in place.
+static Node *to_num(Node *node, long val) {
+  node->kind = ND_NUM;
+  node->val = val;
+  return node;
+}
+
+// Replaces `node` by `with`, which takes over its place in a list.
+static Node *replace(Node *node, Node *with) {
+  with->next = node->next;
+  return with;
+}
+
+static Node *fold_expr(Node *node);
+
+static Node *fold_binary(Node *node) {
+  node->lhs = fold_expr(node->lhs);
+  node->rhs = fold_expr(node->rhs);
+  Node *lhs = node->lhs;
+  Node *rhs = node->rhs;
+
+  if (lhs->kind == ND_NUM && rhs->kind == ND_NUM) {
+    unsigned long a = lhs->val;
+    unsigned long b = rhs->val;
+
+    switch (node->kind) {
+    case ND_ADD:
+      return to_num(node, a + b);
+    case ND_SUB:
+      return to_num(node, a - b);
+    case ND_MUL:
+      return to_num(node, a * b);
+    case ND_DIV:
+      if (b == 0 || (lhs->val == LONG_MIN && rhs->val == -1))
+        return node;
+      return to_num(node, lhs->val / rhs->val);
+    case ND_EQ:
+      return to_num(node, a == b);
+    case ND_NE:
+      return to_num(node, a != b);
+    case ND_LT:
+      return to_num(node, lhs->val < rhs->val);
+    case ND_LE:
+      return to_num(node, lhs->val <= rhs->val);
+    }
+  }
+
+  switch (node->kind) {
+  case ND_ADD:
+    if (is_num(rhs, 0))
+      return replace(node, lhs);
+    if (is_num(lhs, 0))
+      return replace(node, rhs);
+    return node;
+  case ND_SUB:
+    if (is_num(rhs, 0))
+      return replace(node, lhs);
+    // - -x
+    if (is_num(lhs, 0) && rhs->kind == ND_SUB && is_num(rhs->lhs, 0))
+      return replace(node, rhs->rhs);
+    return node;
+  case ND_PTR_ADD:
+  case ND_PTR_SUB:
+    if (is_num(rhs, 0))
+      return replace(node, lhs);
+    return node;
+  case ND_MUL:
+    if (is_num(rhs, 1))
+      return replace(node, lhs);
+    if (is_num(lhs, 1))
+      return replace(node, rhs);
+    if ((is_num(rhs, 0) && !has_side_effects(lhs)) ||
+        (is_num(lhs, 0) && !has_side_effects(rhs)))
+      return to_num(node, 0);
+    return node;
+  case ND_DIV:
+    if (is_num(rhs, 1))
+      return replace(node, lhs);
+    return node;
+  }
+  return node;
+}
+
+static Node *fold_expr(Node *node) {
+  switch (node->kind) {
+  case ND_NUM:
+  case ND_VAR:
+    return node;
+  case ND_ADDR:
+  case ND_DEREF:
+    node->lhs = fold_expr(node->lhs);
+    return node;
+  case ND_ASSIGN:
+    node->lhs = fold_expr(node->lhs);
+    node->rhs = fold_expr(node->rhs);
+    return node;
+  case ND_FUNCALL:
+    for (Node **p = &node->args; *p; p = &(*p)->next)
+      *p = fold_expr(*p);
+    return node;
+  }
+  return fold_binary(node);
+}
+
+static void fold_stmt(Node *node) {
+  if (!node)
+    return;
+
+  switch (node->kind) {
+  case ND_NULL:
+    return;
+  case ND_EXPR_STMT:
+  case ND_RETURN:
+    node->lhs = fold_expr(node->lhs);
+    return;
+  case ND_IF:
+    node->cond = fold_expr(node->cond);
+    fold_stmt(node->then);
+    fold_stmt(node->els);
+    return;
+  case ND_WHILE:
+    node->cond = fold_expr(node->cond);
+    fold_stmt(node->then);
+    return;
+  case ND_FOR:
+    fold_stmt(node->init);
+    if (node->cond)
+      node->cond = fold_expr(node->cond);
+    fold_stmt(node->inc);
+    fold_stmt(node->then);
+    return;
+  case ND_BLOCK:
+    for (Node *n = node->body; n; n = n->next)
+      fold_stmt(n);
+    return;
+  }
+}
+
+void fold(Function *prog) {
+  for (Function *fn = prog; fn; fn = fn->next)
+    for (Node *node = fn->node; node; node = node->next)
+      fold_stmt(node);
+}
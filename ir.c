@@ -0,0 +1,686 @@
+#include "9cc.h"
+
+// This file translates the AST of a function into a three-address
+// intermediate representation. Instructions operate on an unlimited
+// number of virtual registers and are grouped into basic blocks,
+// which form the function's control flow graph. regalloc.c then maps
+// virtual registers to real ones, and codegen.c lowers the result
+// to x86-64.
+//
+// Variables whose address is never taken are kept in virtual
+// registers of their own. Pointer arithmetic can reach any variable
+// from the address of another one, so functions that take an
+// address keep all their variables in memory. Arrays are always in
+// memory, but indexing is only defined within an array, so using
+// one does not count as taking an address.
+//
+// Every block ends with a jump, a branch or a return. Temporaries
+// are only used in the block that defines them, and only variables
+// live across blocks, until loop.c moves temporaries out of loops.
+
+// Print the IR of each function to stderr
+bool dump_ir;
+
+//
+// Allocation
+//
+// IR only lives while its function is compiled, and functions are
+// compiled on several threads at once, so it is not allocated from
+// the arena. Each thread has its own pool instead, which ir_free()
+// empties after each function. The pool keeps its first chunk, so
+// small functions do not go back to malloc.
+//
+
+#define POOL_CHUNK_SIZE (1 << 16)
+
+typedef struct PoolChunk PoolChunk;
+struct PoolChunk {
+  PoolChunk *next;
+  char *cur;
+  char *end;
+  char buf[];
+};
+
+static _Thread_local PoolChunk *pool;
+
+void *ir_alloc(size_t size) {
+  size = (size + 7) & ~(size_t)7;
+
+  if (!pool || pool->end - pool->cur < size) {
+    size_t cap = size > POOL_CHUNK_SIZE ? size : POOL_CHUNK_SIZE;
+    PoolChunk *c = malloc(sizeof(PoolChunk) + cap);
+    if (!c)
+      out_of_memory();
+    c->cur = c->buf;
+    c->end = c->buf + cap;
+    c->next = pool;
+    pool = c;
+  }
+
+  void *p = pool->cur;
+  pool->cur += size;
+  return memset(p, 0, size);
+}
+
+// Frees the IR of the function compiled last.
+void ir_free(void) {
+  if (!pool)
+    return;
+  while (pool->next) {
+    PoolChunk *next = pool->next;
+    free(pool);
+    pool = next;
+  }
+  pool->cur = pool->buf;
+}
+
+//
+// Construction
+//
+
+static _Thread_local Function *fn;
+static _Thread_local BB *out;      // Block being filled
+static _Thread_local BB *last_bb;  // Last block in layout order
+static _Thread_local Reg *last_reg;
+static _Thread_local int nlabel;
+
+// new_reg(), new_bb() and new_ir() are also used by passes that
+// rewrite the IR of the function built last on the same thread.
+Reg *new_reg(void) {
+  Reg *r = ir_alloc(sizeof(Reg));
+  r->vn = ++fn->nregs;
+  if (last_reg)
+    last_reg->next = r;
+  else
+    fn->regs = r;
+  last_reg = r;
+  return r;
+}
+
+BB *new_bb(void) {
+  BB *bb = ir_alloc(sizeof(BB));
+  bb->label = ++nlabel;
+  return bb;
+}
+
+static bool is_terminated(BB *bb) {
+  return bb->last && (bb->last->op == IR_JMP || bb->last->op == IR_BR ||
+                      bb->last->op == IR_RET);
+}
+
+static IR *emit(IROp op, Reg *dst, Reg *a, Reg *b);
+
+// Makes `bb` the block that instructions are added to. If control
+// can reach the end of the current block, it continues in `bb`.
+static void start_bb(BB *bb) {
+  if (out && !is_terminated(out))
+    emit(IR_JMP, NULL, NULL, NULL)->bb1 = bb;
+
+  if (last_bb)
+    last_bb->next = bb;
+  else
+    fn->bbs = bb;
+  last_bb = bb;
+  out = bb;
+}
+
+// Returns an instruction that is not in any block yet.
+IR *new_ir(IROp op, Reg *dst, Reg *a, Reg *b) {
+  IR *ir = ir_alloc(sizeof(IR));
+  ir->op = op;
+  ir->dst = dst;
+  ir->a = a;
+  ir->b = b;
+  if (dst && !dst->var)
+    dst->def = ir;
+  return ir;
+}
+
+static IR *emit(IROp op, Reg *dst, Reg *a, Reg *b) {
+  // Code after a jump or a return is unreachable. It still gets
+  // a block, which is removed once the CFG is built.
+  if (is_terminated(out))
+    start_bb(new_bb());
+
+  IR *ir = new_ir(op, dst, a, b);
+  if (out->last)
+    out->last->next = ir;
+  else
+    out->ir = ir;
+  out->last = ir;
+  return ir;
+}
+
+static Reg *imm(long val) {
+  Reg *r = new_reg();
+  emit(IR_IMM, r, NULL, NULL)->imm = val;
+  return r;
+}
+
+static Reg *binop(IROp op, Reg *a, Reg *b) {
+  Reg *r = new_reg();
+  emit(op, r, a, b);
+  return r;
+}
+
+// Returns `val` truncated to `size` bytes and sign-extended back.
+static long truncate(long val, int size) {
+  switch (size) {
+  case 1:
+    return (signed char)val;
+  case 2:
+    return (short)val;
+  case 4:
+    return (int)val;
+  }
+  return val;
+}
+
+// Values are kept in registers sign-extended to 64 bits. This
+// returns `r` converted to `ty`, which only changes it if `ty` is
+// narrower than a register.
+static Reg *cast(Reg *r, Type *ty) {
+  if (ty->size == 8)
+    return r;
+  if (r->def && r->def->op == IR_IMM)
+    return imm(truncate(r->def->imm, ty->size));
+  Reg *dst = new_reg();
+  emit(IR_SEXT, dst, r, NULL)->size = ty->size;
+  return dst;
+}
+
+// An array is not loaded; its value is the address of its first
+// element.
+static Reg *load(Reg *addr, Type *ty) {
+  if (ty->kind == TY_ARRAY)
+    return addr;
+  Reg *r = new_reg();
+  emit(IR_LOAD, r, addr, NULL)->size = ty->size;
+  return r;
+}
+
+static void store(Reg *addr, Reg *val, Type *ty) {
+  emit(IR_STORE, NULL, addr, val)->size = ty->size;
+}
+
+static void jmp(BB *bb) {
+  emit(IR_JMP, NULL, NULL, NULL)->bb1 = bb;
+}
+
+static void br(IROp cond, Reg *a, Reg *b, BB *then, BB *els) {
+  IR *ir = emit(IR_BR, NULL, a, b);
+  ir->cond = cond;
+  ir->bb1 = then;
+  ir->bb2 = els;
+}
+
+static Reg *gen_expr(Node *node);
+
+// Branches to `then` if `node` is true and to `els` otherwise. A
+// comparison is not turned into a 0 or 1 first; its operands are
+// compared by the branch itself.
+static void gen_cond(Node *node, BB *then, BB *els) {
+  IROp cond;
+  switch (node->kind) {
+  case ND_EQ:
+    cond = IR_EQ;
+    break;
+  case ND_NE:
+    cond = IR_NE;
+    break;
+  case ND_LT:
+    cond = IR_LT;
+    break;
+  case ND_LE:
+    cond = IR_LE;
+    break;
+  default:
+    br(IR_NE, gen_expr(node), NULL, then, els);
+    return;
+  }
+
+  Reg *a = gen_expr(node->lhs);
+  Reg *b = gen_expr(node->rhs);
+  br(cond, a, b, then, els);
+}
+
+static Reg *gen_addr(Node *node) {
+  switch (node->kind) {
+  case ND_VAR:
+    if (node->var->reg)
+      break;
+    Reg *r = new_reg();
+    emit(IR_BPREL, r, NULL, NULL)->var = node->var;
+    return r;
+  case ND_DEREF:
+    return gen_expr(node->lhs);
+  }
+
+  unreachable();
+}
+
+static Reg *gen_funcall(Node *node) {
+  Reg *args[6];
+  int nargs = 0;
+  for (Node *arg = node->args; arg; arg = arg->next)
+    args[nargs++] = gen_expr(arg);
+
+  Reg *r = new_reg();
+  IR *ir = emit(IR_CALL, r, NULL, NULL);
+  ir->name = node->funcname;
+  ir->nargs = nargs;
+  ir->args = ir_alloc(sizeof(Reg *) * nargs);
+  memcpy(ir->args, args, sizeof(Reg *) * nargs);
+
+  // Functions return int, whose upper 32 bits in RAX are undefined.
+  return cast(r, int_type);
+}
+
+static Reg *gen_expr(Node *node) {
+  switch (node->kind) {
+  case ND_NUM:
+    return imm(node->val);
+  case ND_VAR:
+    if (node->var->reg)
+      return node->var->reg;
+    return load(gen_addr(node), node->ty);
+  case ND_ASSIGN: {
+    if (node->lhs->kind == ND_VAR && node->lhs->var->reg) {
+      Reg *var = node->lhs->var->reg;
+      Reg *val = gen_expr(node->rhs);
+      if (node->ty->size == 8 || (val->def && val->def->op == IR_IMM)) {
+        val = cast(val, node->ty);
+        emit(IR_MOV, var, val, NULL);
+        return val;
+      }
+
+      // Sign-extend into the variable itself. The value of the
+      // expression is a copy, which is deleted if it is not used.
+      emit(IR_SEXT, var, val, NULL)->size = node->ty->size;
+      return binop(IR_MOV, var, NULL);
+    }
+    Reg *addr = gen_addr(node->lhs);
+    Reg *val = gen_expr(node->rhs);
+    store(addr, val, node->ty);
+    return cast(val, node->ty);
+  }
+  case ND_ADDR:
+    return gen_addr(node->lhs);
+  case ND_DEREF:
+    return load(gen_expr(node->lhs), node->ty);
+  case ND_FUNCALL:
+    return gen_funcall(node);
+  }
+
+  Reg *a = gen_expr(node->lhs);
+  Reg *b = gen_expr(node->rhs);
+
+  switch (node->kind) {
+  case ND_ADD:
+    return binop(IR_ADD, a, b);
+  case ND_PTR_ADD:
+    return binop(IR_ADD, a, binop(IR_MUL, b, imm(node->ty->base->size)));
+  case ND_SUB:
+    return binop(IR_SUB, a, b);
+  case ND_PTR_SUB:
+    return binop(IR_SUB, a, binop(IR_MUL, b, imm(node->ty->base->size)));
+  case ND_PTR_DIFF: {
+    Reg *size = imm(node->lhs->ty->base->size);
+    Reg *r = binop(IR_DIV, binop(IR_SUB, a, b), size);
+    r->def->exact = true;
+    return r;
+  }
+  case ND_MUL:
+    return binop(IR_MUL, a, b);
+  case ND_DIV:
+    return binop(IR_DIV, a, b);
+  case ND_EQ:
+    return binop(IR_EQ, a, b);
+  case ND_NE:
+    return binop(IR_NE, a, b);
+  case ND_LT:
+    return binop(IR_LT, a, b);
+  case ND_LE:
+    return binop(IR_LE, a, b);
+  }
+
+  unreachable();
+}
+
+static void gen_stmt(Node *node) {
+  switch (node->kind) {
+  case ND_NULL:
+    return;
+  case ND_EXPR_STMT:
+    gen_expr(node->lhs);
+    return;
+  case ND_RETURN:
+    emit(IR_RET, NULL, cast(gen_expr(node->lhs), fn->ty), NULL);
+    return;
+  case ND_IF: {
+    BB *then = new_bb();
+    BB *els = new_bb();
+    BB *end = node->els ? new_bb() : els;
+
+    gen_cond(node->cond, then, els);
+    start_bb(then);
+    gen_stmt(node->then);
+    if (node->els) {
+      jmp(end);
+      start_bb(els);
+      gen_stmt(node->els);
+    }
+    start_bb(end);
+    return;
+  }
+  case ND_WHILE:
+  case ND_FOR: {
+    // Loops are rotated so that the condition is tested at the
+    // bottom, where a single branch goes back to the body or falls
+    // through to the end. The test is also done once in front of
+    // the loop, which may not run at all.
+    BB *body = new_bb();
+    BB *end = new_bb();
+
+    if (node->kind == ND_FOR && node->init)
+      gen_stmt(node->init);
+    if (node->cond)
+      gen_cond(node->cond, body, end);
+    start_bb(body);
+    gen_stmt(node->then);
+    if (node->kind == ND_FOR && node->inc)
+      gen_stmt(node->inc);
+    if (node->cond)
+      gen_cond(node->cond, body, end);
+    else
+      jmp(body);
+    start_bb(end);
+    return;
+  }
+  case ND_BLOCK:
+    for (Node *n = node->body; n; n = n->next)
+      gen_stmt(n);
+    return;
+  }
+
+  unreachable();
+}
+
+static bool takes_address(Node *node) {
+  if (!node)
+    return false;
+
+  switch (node->kind) {
+  case ND_NUM:
+  case ND_VAR:
+  case ND_NULL:
+    return false;
+  case ND_ADDR:
+    // &a[i] is an element of an array, which is in memory anyway.
+    if (node->lhs->kind == ND_DEREF)
+      return takes_address(node->lhs);
+    return true;
+  case ND_EXPR_STMT:
+  case ND_RETURN:
+  case ND_DEREF:
+    return takes_address(node->lhs);
+  case ND_IF:
+    return takes_address(node->cond) || takes_address(node->then) ||
+           takes_address(node->els);
+  case ND_WHILE:
+    return takes_address(node->cond) || takes_address(node->then);
+  case ND_FOR:
+    return takes_address(node->init) || takes_address(node->cond) ||
+           takes_address(node->then) || takes_address(node->inc);
+  case ND_BLOCK:
+    for (Node *n = node->body; n; n = n->next)
+      if (takes_address(n))
+        return true;
+    return false;
+  case ND_FUNCALL:
+    for (Node *n = node->args; n; n = n->next)
+      if (takes_address(n))
+        return true;
+    return false;
+  }
+
+  return takes_address(node->lhs) || takes_address(node->rhs);
+}
+
+//
+// Control flow graph
+//
+
+static void add_edge(BB *from, BB *to) {
+  from->succ[from->nsucc++] = to;
+  to->npred++;
+}
+
+// Computes successors and predecessors, and removes blocks that
+// cannot be reached from the entry block.
+static void build_cfg(void) {
+  // Mark reachable blocks with a depth-first search.
+  int nbbs = 0;
+  for (BB *bb = fn->bbs; bb; bb = bb->next)
+    nbbs++;
+
+  BB **stack = malloc(sizeof(BB *) * (nbbs + 1));
+  int sp = 0;
+  stack[sp++] = fn->bbs;
+  fn->bbs->reachable = true;
+
+  while (sp > 0) {
+    BB *bb = stack[--sp];
+    IR *ir = bb->last;
+    BB *succ[] = {ir->bb1, ir->op == IR_BR ? ir->bb2 : NULL};
+    for (int i = 0; i < 2; i++) {
+      if (succ[i] && !succ[i]->reachable) {
+        succ[i]->reachable = true;
+        stack[sp++] = succ[i];
+      }
+    }
+  }
+  free(stack);
+
+  for (BB **p = &fn->bbs; *p;) {
+    if ((*p)->reachable)
+      p = &(*p)->next;
+    else
+      *p = (*p)->next;
+  }
+
+  for (BB *bb = fn->bbs; bb; bb = bb->next) {
+    IR *ir = bb->last;
+    if (ir->op == IR_JMP) {
+      add_edge(bb, ir->bb1);
+    } else if (ir->op == IR_BR) {
+      add_edge(bb, ir->bb1);
+      add_edge(bb, ir->bb2);
+    }
+  }
+
+  for (BB *bb = fn->bbs; bb; bb = bb->next) {
+    bb->pred = ir_alloc(sizeof(BB *) * bb->npred);
+    bb->npred = 0;
+  }
+  for (BB *bb = fn->bbs; bb; bb = bb->next)
+    for (int i = 0; i < bb->nsucc; i++)
+      bb->succ[i]->pred[bb->succ[i]->npred++] = bb;
+}
+
+// Builds the IR of `f`.
+void gen_ir(Function *f) {
+  fn = f;
+  fn->bbs = NULL;
+  fn->regs = NULL;
+  fn->nregs = 0;
+  out = NULL;
+  last_bb = NULL;
+  last_reg = NULL;
+  nlabel = 0;
+
+  bool in_regs = true;
+  for (Node *node = fn->node; node; node = node->next)
+    if (takes_address(node))
+      in_regs = false;
+
+  for (VarList *vl = fn->locals; vl; vl = vl->next) {
+    vl->var->reg = NULL;
+    if (in_regs && vl->var->ty->kind != TY_ARRAY) {
+      vl->var->reg = new_reg();
+      vl->var->reg->var = vl->var;
+    }
+  }
+
+  start_bb(new_bb());
+
+  // Move arguments to their variables
+  int i = 0;
+  for (VarList *vl = fn->params; vl; vl = vl->next) {
+    Var *var = vl->var;
+    Reg *r = var->reg ? var->reg : new_reg();
+    emit(IR_ARG, r, NULL, NULL)->imm = i++;
+    if (!var->reg) {
+      Reg *addr = new_reg();
+      emit(IR_BPREL, addr, NULL, NULL)->var = var;
+      store(addr, r, var->ty);
+    } else if (var->ty->size < 8) {
+      emit(IR_SEXT, r, r, NULL)->size = var->ty->size;
+    }
+  }
+
+  for (Node *node = fn->node; node; node = node->next)
+    gen_stmt(node);
+
+  if (!is_terminated(out))
+    emit(IR_RET, NULL, NULL, NULL);
+
+  build_cfg();
+}
+
+//
+// Dump
+//
+
+static char *opname(IROp op) {
+  switch (op) {
+  case IR_ADD: return "add";
+  case IR_SUB: return "sub";
+  case IR_MUL: return "mul";
+  case IR_DIV: return "div";
+  case IR_EQ: return "eq";
+  case IR_NE: return "ne";
+  case IR_LT: return "lt";
+  case IR_LE: return "le";
+  case IR_SHL: return "shl";
+  case IR_SHR: return "shr";
+  case IR_SAR: return "sar";
+  case IR_MULHI: return "mulhi";
+  }
+  return "?";
+}
+
+static char *condname(IROp cond) {
+  switch (cond) {
+  case IR_EQ: return "==";
+  case IR_NE: return "!=";
+  case IR_LT: return "<";
+  case IR_LE: return "<=";
+  }
+  return "?";
+}
+
+static void print_insn(FILE *out, IR *ir) {
+  fprintf(out, "  ");
+  if (ir->dst)
+    fprintf(out, "v%d = ", ir->dst->vn);
+
+  switch (ir->op) {
+  case IR_IMM:
+    fprintf(out, "%ld\n", ir->imm);
+    return;
+  case IR_MOV:
+    fprintf(out, "v%d\n", ir->a->vn);
+    return;
+  case IR_ARG:
+    fprintf(out, "arg %ld\n", ir->imm);
+    return;
+  case IR_BPREL:
+    fprintf(out, "&%s\n", ir->var->name);
+    return;
+  case IR_SHL:
+  case IR_SHR:
+  case IR_SAR:
+  case IR_MULHI:
+    fprintf(out, "%s v%d, %ld\n", opname(ir->op), ir->a->vn, ir->imm);
+    return;
+  case IR_LEA:
+    fprintf(out, "lea v%d, v%d, %ld\n", ir->a->vn, ir->b->vn, ir->imm);
+    return;
+  case IR_SEXT:
+    fprintf(out, "sext v%d, %d\n", ir->a->vn, ir->size);
+    return;
+  case IR_LOAD:
+    fprintf(out, "load v%d, %d\n", ir->a->vn, ir->size);
+    return;
+  case IR_STORE:
+    fprintf(out, "store v%d, v%d, %d\n", ir->a->vn, ir->b->vn, ir->size);
+    return;
+  case IR_CALL:
+    fprintf(out, "call %s(", ir->name);
+    for (int i = 0; i < ir->nargs; i++)
+      fprintf(out, "%sv%d", i ? ", " : "", ir->args[i]->vn);
+    fprintf(out, ")\n");
+    return;
+  case IR_JMP:
+    fprintf(out, "jmp .L%d\n", ir->bb1->label);
+    return;
+  case IR_BR:
+    if (ir->b)
+      fprintf(out, "br v%d %s v%d, .L%d, .L%d\n", ir->a->vn, condname(ir->cond),
+              ir->b->vn, ir->bb1->label, ir->bb2->label);
+    else
+      fprintf(out, "br v%d, .L%d, .L%d\n", ir->a->vn, ir->bb1->label,
+              ir->bb2->label);
+    return;
+  case IR_RET:
+    if (ir->a)
+      fprintf(out, "ret v%d\n", ir->a->vn);
+    else
+      fprintf(out, "ret\n");
+    return;
+  }
+
+  fprintf(out, "%s v%d, v%d", opname(ir->op), ir->a->vn, ir->b->vn);
+  if (ir->op == IR_DIV && ir->exact)
+    fprintf(out, " ; exact");
+  fprintf(out, "\n");
+}
+
+// Prints the IR of `fn` after the pass named `pass`.
+void print_ir(Function *fn, FILE *out, char *pass) {
+  fprintf(out, "%s: after %s\n", fn->name, pass);
+
+  bool first = true;
+  for (VarList *vl = fn->locals; vl; vl = vl->next) {
+    if (!vl->var->reg)
+      continue;
+    fprintf(out, "%s%s=v%d", first ? "  ; " : ", ", vl->var->name,
+            vl->var->reg->vn);
+    first = false;
+  }
+  if (!first)
+    fprintf(out, "\n");
+
+  for (BB *bb = fn->bbs; bb; bb = bb->next) {
+    fprintf(out, ".L%d:", bb->label);
+    if (bb->npred) {
+      fprintf(out, "  ; preds");
+      for (int i = 0; i < bb->npred; i++)
+        fprintf(out, " .L%d", bb->pred[i]->label);
+    }
+    fprintf(out, "\n");
+    for (IR *ir = bb->ir; ir; ir = ir->next)
+      print_insn(out, ir);
+  }
+}
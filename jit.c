@@ -0,0 +1,75 @@
+#include "9cc.h"
+#include <dlfcn.h>
+#include <sys/mman.h>
+
+// Runs the machine code of a program in the current process. The
+// Object comes straight from the instructions codegen built (see
+// asm.c); no assembly text is involved. The code is copied into
+// memory from mmap, calls to functions it does not define are
+// resolved with dlsym, and the memory is made executable before main
+// is called.
+//
+// A rel32 call cannot reach an arbitrary address in the host process,
+// so each external function gets a stub after the code that jumps to
+// its absolute address:
+//
+//   movabs rax, <address>
+//   jmp rax
+
+#define STUB_SIZE 16
+
+static void put_stub(unsigned char *p, void *addr) {
+  unsigned long a = (unsigned long)addr;
+  p[0] = 0x48;
+  p[1] = 0xb8;
+  for (int i = 0; i < 8; i++)
+    p[2 + i] = (a >> (i * 8)) & 0xff;
+  p[10] = 0xff;
+  p[11] = 0xe0;
+}
+
+// Calls main in `obj` and returns its return value.
+int jit_run(Object *obj) {
+  size_t stubs_off = (obj->text_len + STUB_SIZE - 1) / STUB_SIZE * STUB_SIZE;
+  size_t size = stubs_off + STUB_SIZE * obj->nsyms;
+  if (size == 0)
+    size = 1;
+
+  unsigned char *mem = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mem == MAP_FAILED)
+    error("cannot map code: %s", strerror(errno));
+  memcpy(mem, obj->text, obj->text_len);
+
+  int (*main_fn)(void) = NULL;
+  for (int i = 0; i < obj->nsyms; i++) {
+    Symbol *sym = &obj->syms[i];
+    if (sym->defined) {
+      if (!strcmp(sym->name, "main"))
+        main_fn = (int (*)(void))(mem + sym->offset);
+      continue;
+    }
+
+    void *addr = dlsym(RTLD_DEFAULT, sym->name);
+    if (!addr)
+      error("undefined symbol: %s", sym->name);
+    put_stub(mem + stubs_off + STUB_SIZE * i, addr);
+  }
+
+  if (!main_fn)
+    error("undefined symbol: main");
+
+  for (int i = 0; i < obj->nrelocs; i++) {
+    Reloc *r = &obj->relocs[i];
+    long target = (long)(mem + stubs_off + STUB_SIZE * r->sym);
+    int rel = target + r->addend - (long)(mem + r->offset);
+    memcpy(mem + r->offset, &rel, 4);
+  }
+
+  if (mprotect(mem, size, PROT_READ | PROT_EXEC) < 0)
+    error("cannot make code executable: %s", strerror(errno));
+
+  int ret = main_fn();
+  munmap(mem, size);
+  return ret;
+}
@@ -0,0 +1,553 @@
+#include "9cc.h"
+
+// Loop-invariant code motion.
+//
+// Loops are found from back edges in the CFG, which are edges to a
+// block that dominates their source. A loop consists of the header,
+// which is the target of its back edges, and every block that
+// reaches a back edge without passing through the header.
+//
+// An instruction in a loop is invariant if it computes a temporary
+// from values that do not change while the loop runs: variables the
+// loop does not assign, and temporaries defined outside the loop or
+// by other invariant instructions. Invariant instructions are moved
+// to a preheader, a block inserted before the header that every
+// entry into the loop goes through. Loops are visited innermost
+// first, so an instruction can move out of several loops.
+//
+// The loop may not run at all, so only instructions that cannot
+// trap are moved. Loading a variable kept in memory cannot, since
+// its stack slot always exists, and the load is invariant if nothing
+// in the loop can store to the variable: neither a store to it, nor
+// a store through any other pointer, nor a call.
+//
+// Constants and addresses of variables are not worth a register
+// across a loop, as they fold into the instructions that use them.
+// They are copied to the preheader when an instruction moving there
+// needs them, and are otherwise left where they are.
+//
+// Moved temporaries are used outside the block that defines them, so
+// they are marked global for register allocation.
+
+typedef struct Loop Loop;
+struct Loop {
+  Loop *parent;  // Innermost enclosing loop
+  int header;    // Index of the header in rpo
+  BB *preheader;
+
+  int *blocks;   // Blocks in the loop by index in rpo
+  int nblocks;
+
+  BB **inner;    // Preheaders of loops nested in this one
+  int ninner;
+  int cap;
+};
+
+// Blocks of the function in reverse postorder, and the index of
+// each block in it by label. Preheaders are not numbered.
+static _Thread_local BB **rpo;
+static _Thread_local int *rpo_index;
+static _Thread_local int max_label;
+
+// Predecessors of rpo[i] by index in rpo, which are
+// preds[pred_start[i]] to preds[pred_start[i + 1] - 1]. Walking the
+// CFG on these arrays is much faster than following pointers into
+// blocks scattered across memory.
+static _Thread_local int *pred_start;
+static _Thread_local int *preds;
+
+// Immediate dominator by index in rpo
+static _Thread_local int *idom;
+
+// Block before each one in layout order by index in rpo
+static _Thread_local BB **layout_prev;
+
+// defined[vn] == stamp if register vn is written in the loop being
+// processed.
+static _Thread_local int *defined;
+static _Thread_local int defined_cap;
+static _Thread_local int stamp;
+
+static int index_of(BB *bb) {
+  return bb->label <= max_label ? rpo_index[bb->label] : -1;
+}
+
+static void add_inner(Loop *loop, BB *ph) {
+  if (loop->ninner == loop->cap) {
+    loop->cap = loop->cap ? loop->cap * 2 : 4;
+    BB **inner = ir_alloc(sizeof(BB *) * loop->cap);
+    memcpy(inner, loop->inner, sizeof(BB *) * loop->ninner);
+    loop->inner = inner;
+  }
+  loop->inner[loop->ninner++] = ph;
+}
+
+// Numbers the blocks in reverse postorder, which comes to a block
+// before its successors except along back edges, and indexes their
+// predecessors.
+static void order_blocks(Function *fn, int nbbs) {
+  BB **stack = malloc(sizeof(BB *) * nbbs);
+  int *next = malloc(sizeof(int) * nbbs);
+  bool *seen = calloc(max_label + 1, sizeof(bool));
+  int sp = 0;
+  int n = nbbs;
+
+  // Edges by label, as the blocks are not numbered yet
+  int *from = malloc(sizeof(int) * nbbs * 2);
+  int *to = malloc(sizeof(int) * nbbs * 2);
+  int nedges = 0;
+
+  stack[sp] = fn->bbs;
+  next[sp++] = 0;
+  seen[fn->bbs->label] = true;
+
+  while (sp > 0) {
+    BB *bb = stack[sp - 1];
+    if (next[sp - 1] < bb->nsucc) {
+      BB *succ = bb->succ[next[sp - 1]++];
+      from[nedges] = bb->label;
+      to[nedges++] = succ->label;
+      if (!seen[succ->label]) {
+        seen[succ->label] = true;
+        stack[sp] = succ;
+        next[sp++] = 0;
+      }
+      continue;
+    }
+    sp--;
+    rpo[--n] = bb;
+    rpo_index[bb->label] = n;
+  }
+
+  pred_start = calloc(nbbs + 1, sizeof(int));
+  preds = malloc(sizeof(int) * (nedges + 1));
+  for (int i = 0; i < nedges; i++)
+    pred_start[rpo_index[to[i]] + 1]++;
+  for (int i = 0; i < nbbs; i++) {
+    pred_start[i + 1] += pred_start[i];
+    next[i] = pred_start[i];
+  }
+  for (int i = 0; i < nedges; i++)
+    preds[next[rpo_index[to[i]]]++] = rpo_index[from[i]];
+
+  free(stack);
+  free(next);
+  free(seen);
+  free(from);
+  free(to);
+}
+
+static int intersect(int a, int b) {
+  while (a != b) {
+    while (a > b)
+      a = idom[a];
+    while (b > a)
+      b = idom[b];
+  }
+  return a;
+}
+
+// Computes immediate dominators with the iterative algorithm of
+// Cooper, Harvey and Kennedy.
+static void find_dominators(int nbbs) {
+  idom[0] = 0;
+  for (int i = 1; i < nbbs; i++)
+    idom[i] = -1;
+
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (int i = 1; i < nbbs; i++) {
+      int d = -1;
+      for (int j = pred_start[i]; j < pred_start[i + 1]; j++) {
+        int p = preds[j];
+        if (idom[p] < 0)
+          continue;
+        d = (d < 0) ? p : intersect(p, d);
+      }
+      if (d != idom[i]) {
+        idom[i] = d;
+        changed = true;
+      }
+    }
+  }
+}
+
+static bool dominates(int a, int b) {
+  while (b > a)
+    b = idom[b];
+  return a == b;
+}
+
+// Returns the loop headed by rpo[h], or NULL if it heads none.
+// `mark` is used to collect the blocks of the loop, and `stack` has
+// room for every block.
+static Loop *find_loop(int h, int *mark, int *stack) {
+  bool is_header = false;
+  int sp = 0;
+  mark[h] = h;
+  for (int i = pred_start[h]; i < pred_start[h + 1]; i++) {
+    int p = preds[i];
+    if (!dominates(h, p))
+      continue;
+    is_header = true;
+    if (mark[p] != h) {
+      mark[p] = h;
+      stack[sp++] = p;
+    }
+  }
+  if (!is_header)
+    return NULL;
+
+  // Walk backwards from the back edges to the header. The blocks
+  // end up in the stack below the ones still to visit.
+  int n = 0;
+  while (n < sp) {
+    int b = stack[n++];
+    for (int i = pred_start[b]; i < pred_start[b + 1]; i++) {
+      int p = preds[i];
+      if (mark[p] != h) {
+        mark[p] = h;
+        stack[sp++] = p;
+      }
+    }
+  }
+
+  Loop *loop = ir_alloc(sizeof(Loop));
+  loop->header = h;
+  loop->nblocks = n + 1;
+  loop->blocks = ir_alloc(sizeof(int) * loop->nblocks);
+  loop->blocks[0] = h;
+  memcpy(loop->blocks + 1, stack, sizeof(int) * n);
+  return loop;
+}
+
+static int compare_loops(const void *p, const void *q) {
+  Loop *a = *(Loop **)p;
+  Loop *b = *(Loop **)q;
+  if (a->nblocks != b->nblocks)
+    return a->nblocks - b->nblocks;
+  return a->header - b->header;
+}
+
+static bool is_defined(Reg *r) {
+  return r->vn < defined_cap && defined[r->vn] == stamp;
+}
+
+// Constants and addresses of variables, which are recomputed rather
+// than kept in a register.
+static bool is_cheap(IR *ir) {
+  return ir && (ir->op == IR_IMM || ir->op == IR_BPREL);
+}
+
+static bool is_invariant(Reg *r) {
+  return !r || !is_defined(r) || is_cheap(r->def);
+}
+
+// What the loop being processed may store to.
+typedef struct {
+  bool any;      // Calls or stores through pointers
+  Var **vars;    // Variables stored to directly
+  int nvars;
+} Stores;
+
+static bool may_store(Stores *st, Var *var) {
+  if (st->any)
+    return true;
+  for (int i = 0; i < st->nvars; i++)
+    if (st->vars[i] == var)
+      return true;
+  return false;
+}
+
+static bool can_hoist(IR *ir, Stores *st) {
+  if (!ir->dst || ir->dst->var)
+    return false;
+
+  switch (ir->op) {
+  case IR_ADD:
+  case IR_SUB:
+  case IR_MUL:
+  case IR_SHL:
+  case IR_SHR:
+  case IR_SAR:
+  case IR_LEA:
+  case IR_MULHI:
+  case IR_SEXT:
+  case IR_EQ:
+  case IR_NE:
+  case IR_LT:
+  case IR_LE:
+    return is_invariant(ir->a) && is_invariant(ir->b);
+  case IR_LOAD: {
+    IR *addr = ir->a->def;
+    return addr && addr->op == IR_BPREL && !may_store(st, addr->var);
+  }
+  }
+  return false;
+}
+
+// Adds `ir` to the end of the preheader, before its jump.
+static void append(BB *ph, IR *ir) {
+  IR **p = &ph->ir;
+  while (*p != ph->last)
+    p = &(*p)->next;
+  ir->next = ph->last;
+  *p = ir;
+}
+
+// Returns an operand that can be used in the preheader in place of
+// `r`, copying the constant or address it holds if it is defined in
+// the loop.
+static Reg *materialize(BB *ph, Reg *r) {
+  if (!r || !is_defined(r))
+    return r;
+
+  Reg *copy = new_reg();
+  IR *ir = new_ir(r->def->op, copy, NULL, NULL);
+  if (ir->op == IR_IMM)
+    ir->imm = r->def->imm;
+  else
+    ir->var = r->def->var;
+  append(ph, ir);
+  return copy;
+}
+
+static void retarget(BB *bb, BB *from, BB *to) {
+  IR *ir = bb->last;
+  if (ir->bb1 == from)
+    ir->bb1 = to;
+  if (ir->op == IR_BR && ir->bb2 == from)
+    ir->bb2 = to;
+  for (int i = 0; i < bb->nsucc; i++)
+    if (bb->succ[i] == from)
+      bb->succ[i] = to;
+}
+
+// Inserts a block in front of the loop's header that all edges into
+// the loop from outside go through. `mark` has the loop's header
+// index for blocks in the loop.
+static BB *make_preheader(Loop *loop, int *mark) {
+  BB *h = rpo[loop->header];
+  BB *ph = new_bb();
+  IR *jmp = new_ir(IR_JMP, NULL, NULL, NULL);
+  jmp->bb1 = h;
+  ph->ir = ph->last = jmp;
+  ph->reachable = true;
+  ph->succ[0] = h;
+  ph->nsucc = 1;
+  ph->pred = ir_alloc(sizeof(BB *) * h->npred);
+
+  int n = 0;
+  for (int i = 0; i < h->npred; i++) {
+    BB *pred = h->pred[i];
+    int p = index_of(pred);
+    if (p >= 0 && mark[p] == loop->header) {
+      h->pred[n++] = pred;
+      continue;
+    }
+    ph->pred[ph->npred++] = pred;
+    retarget(pred, h, ph);
+  }
+  h->pred[n++] = ph;
+  h->npred = n;
+
+  // The header is not the entry block, which has no predecessors.
+  layout_prev[loop->header]->next = ph;
+  ph->next = h;
+  layout_prev[loop->header] = ph;
+
+  for (Loop *l = loop->parent; l; l = l->parent)
+    add_inner(l, ph);
+  return ph;
+}
+
+// Deletes constants and addresses in `bb` that have no readers
+// left because the instructions that used them were moved. They
+// were only used in their own block.
+static void remove_unused(BB *bb) {
+  for (IR *ir = bb->ir; ir; ir = ir->next)
+    if (is_cheap(ir))
+      ir->dst->uses = 0;
+  for (IR *ir = bb->ir; ir; ir = ir->next) {
+    if (ir->a)
+      ir->a->uses++;
+    if (ir->b)
+      ir->b->uses++;
+    for (int i = 0; i < ir->nargs; i++)
+      ir->args[i]->uses++;
+  }
+
+  for (IR **p = &bb->ir; *p;) {
+    IR *ir = *p;
+    if (is_cheap(ir) && !ir->dst->var && ir->dst->uses == 0)
+      *p = ir->next;
+    else
+      p = &ir->next;
+  }
+}
+
+static void hoist(Function *fn, Loop *loop, int *mark) {
+  int h = loop->header;
+  for (int i = 0; i < loop->nblocks; i++)
+    mark[loop->blocks[i]] = h;
+
+  // The loop needs an entry from outside to put a preheader on.
+  bool entered = false;
+  for (int i = pred_start[h]; i < pred_start[h + 1]; i++)
+    if (mark[preds[i]] != h)
+      entered = true;
+  if (!entered)
+    return;
+
+  // Blocks to look at: the loop's own and the preheaders of inner
+  // loops, which may have received instructions invariant here too.
+  int nbbs = loop->nblocks + loop->ninner;
+  BB **bbs = malloc(sizeof(BB *) * nbbs);
+  for (int i = 0; i < loop->nblocks; i++)
+    bbs[i] = rpo[loop->blocks[i]];
+  for (int i = 0; i < loop->ninner; i++)
+    bbs[loop->nblocks + i] = loop->inner[i];
+
+  if (defined_cap <= fn->nregs) {
+    defined_cap = fn->nregs * 2 + 1;
+    defined = realloc(defined, sizeof(int) * defined_cap);
+    memset(defined, 0, sizeof(int) * defined_cap);
+    stamp = 0;
+  }
+  stamp++;
+
+  Stores st = {};
+  int cap = 0;
+  for (int i = 0; i < nbbs; i++) {
+    for (IR *ir = bbs[i]->ir; ir; ir = ir->next) {
+      if (ir->dst)
+        defined[ir->dst->vn] = stamp;
+      if (ir->op == IR_CALL)
+        st.any = true;
+      if (ir->op != IR_STORE)
+        continue;
+      IR *addr = ir->a->def;
+      if (!addr || addr->op != IR_BPREL) {
+        st.any = true;
+        continue;
+      }
+      if (st.nvars == cap) {
+        cap = cap ? cap * 2 : 8;
+        st.vars = realloc(st.vars, sizeof(Var *) * cap);
+      }
+      st.vars[st.nvars++] = addr->var;
+    }
+  }
+
+  // Moving an instruction can make others invariant.
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (int i = 0; i < nbbs; i++) {
+      BB *bb = bbs[i];
+      bool moved = false;
+      for (IR **p = &bb->ir; *p;) {
+        IR *ir = *p;
+        if (!can_hoist(ir, &st)) {
+          p = &ir->next;
+          continue;
+        }
+
+        if (!loop->preheader)
+          loop->preheader = make_preheader(loop, mark);
+
+        *p = ir->next;
+        ir->a = materialize(loop->preheader, ir->a);
+        ir->b = materialize(loop->preheader, ir->b);
+        append(loop->preheader, ir);
+        ir->dst->global = true;
+        if (ir->dst->vn < defined_cap)
+          defined[ir->dst->vn] = 0;
+        changed = moved = true;
+      }
+      if (moved)
+        remove_unused(bb);
+    }
+  }
+  free(st.vars);
+  free(bbs);
+}
+
+void hoist_invariants(Function *fn) {
+  // Labels in layout order
+  int nbbs = 0;
+  int cap = 64;
+  int *layout = malloc(sizeof(int) * cap);
+  max_label = 0;
+  for (BB *bb = fn->bbs; bb; bb = bb->next) {
+    if (nbbs == cap) {
+      cap *= 2;
+      layout = realloc(layout, sizeof(int) * cap);
+    }
+    layout[nbbs++] = bb->label;
+    if (bb->label > max_label)
+      max_label = bb->label;
+  }
+
+  rpo = malloc(sizeof(BB *) * nbbs);
+  rpo_index = malloc(sizeof(int) * (max_label + 1));
+  idom = malloc(sizeof(int) * nbbs);
+  layout_prev = malloc(sizeof(BB *) * nbbs);
+  int *mark = malloc(sizeof(int) * nbbs);
+  int *stack = malloc(sizeof(int) * nbbs);
+  for (int i = 0; i < nbbs; i++)
+    mark[i] = -1;
+
+  order_blocks(fn, nbbs);
+  layout_prev[0] = NULL;
+  for (int i = 1; i < nbbs; i++)
+    layout_prev[rpo_index[layout[i]]] = rpo[rpo_index[layout[i - 1]]];
+  free(layout);
+  find_dominators(nbbs);
+
+  Loop **loops = malloc(sizeof(Loop *) * nbbs);
+  int nloops = 0;
+  for (int i = 0; i < nbbs; i++) {
+    Loop *loop = find_loop(i, mark, stack);
+    if (loop)
+      loops[nloops++] = loop;
+  }
+
+  if (nloops) {
+    // Innermost loops first. The parent of a loop is the smallest
+    // one containing it, found as the outermost loop found so far
+    // for a block when a larger loop comes across it.
+    qsort(loops, nloops, sizeof(Loop *), compare_loops);
+    Loop **inner = calloc(nbbs, sizeof(Loop *));
+    for (int i = 0; i < nloops; i++) {
+      Loop *loop = loops[i];
+      for (int j = 0; j < loop->nblocks; j++) {
+        int k = loop->blocks[j];
+        Loop *l = inner[k];
+        if (!l) {
+          inner[k] = loop;
+          continue;
+        }
+        while (l->parent)
+          l = l->parent;
+        if (l != loop)
+          l->parent = loop;
+      }
+    }
+    free(inner);
+
+    for (int i = 0; i < nbbs; i++)
+      mark[i] = -1;
+    for (int i = 0; i < nloops; i++)
+      hoist(fn, loops[i], mark);
+  }
+
+  free(loops);
+  free(mark);
+  free(stack);
+  free(idom);
+  free(layout_prev);
+  free(preds);
+  free(pred_start);
+  free(rpo_index);
+  free(rpo);
+}
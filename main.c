@@ -1,28 +1,390 @@
 #include "9cc.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
 
-int main(int argc, char **argv) {
-  if (argc != 2) {
-    error("Invalid number of arguments");
+static char *opt_o;
+static bool opt_c;
+static bool opt_run;
+static int opt_j;
+static bool opt_time_report;
+static bool opt_time_json;
+static char *opt_cache_dir;
+static bool opt_server;
+static char *opt_socket;
+static char *input_path;
+
+static void usage(void) {
+  error("usage: 9cc [ -c ] [ -o <path> ] [ -j <threads> ] [ -ftime-report[=json] ]\n"
+        "           [ -fcache-dir=<dir> ] [ -fno-peephole ] [ -dump-ir ] <file>\n"
+        "       9cc --run [ -j <threads> ] <file>\n"
+        "       9cc [ -j <threads> ] --server[=<socket>]");
+}
+
+static void parse_args(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-o")) {
+      if (++i == argc)
+        usage();
+      opt_o = argv[i];
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-o", 2)) {
+      opt_o = argv[i] + 2;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-c")) {
+      opt_c = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-j")) {
+      if (++i == argc)
+        usage();
+      opt_j = atoi(argv[i]);
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-j", 2)) {
+      opt_j = atoi(argv[i] + 2);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-ftime-report")) {
+      opt_time_report = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-ftime-report=json")) {
+      opt_time_report = true;
+      opt_time_json = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-peephole")) {
+      no_peephole = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-dump-ir")) {
+      dump_ir = true;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fcache-dir=", 12)) {
+      opt_cache_dir = argv[i] + 12;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--run")) {
+      opt_run = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--server")) {
+      opt_server = true;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "--server=", 9)) {
+      opt_server = true;
+      opt_socket = argv[i] + 9;
+      continue;
+    }
+
+    if (input_path)
+      usage();
+    input_path = argv[i];
+  }
+
+  if (!input_path && !opt_server)
+    usage();
+  if (opt_run && (opt_c || opt_o || opt_server))
+    usage();
+
+  if (opt_j <= 0)
+    opt_j = sysconf(_SC_NPROCESSORS_ONLN);
+  if (opt_j <= 0)
+    opt_j = 1;
+}
+
+// Reads a file that cannot be mapped, such as a pipe.
+static char *read_stream(int fd, char *path) {
+  size_t cap = 4096;
+  size_t len = 0;
+  char *buf = malloc(cap);
+
+  for (;;) {
+    if (cap - len < 4096) {
+      cap *= 2;
+      buf = realloc(buf, cap);
+    }
+    if (!buf)
+      error("out of memory");
+
+    ssize_t n = read(fd, buf + len, cap - len - 1);
+    if (n == 0)
+      break;
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      error("cannot read %s: %s", path, strerror(errno));
+    }
+    len += n;
+  }
+
+  buf[len] = '\0';
+  return buf;
+}
+
+// Returns the contents of a given file as a NUL-terminated string.
+//
+// Regular files are mapped into memory rather than copied. The file
+// is mapped over an anonymous mapping that is one byte longer, so
+// the byte after the last one always exists and is zero even if the
+// file size is a multiple of the page size.
+static char *read_file(char *path) {
+  int fd = 0;
+  if (strcmp(path, "-")) {
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+      error("cannot open %s: %s", path, strerror(errno));
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+    char *buf = read_stream(fd, path);
+    if (fd != 0)
+      close(fd);
+    return buf;
+  }
+
+  size_t size = st.st_size;
+  char *buf = mmap(NULL, size + 1, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (buf == MAP_FAILED)
+    error("cannot map %s: %s", path, strerror(errno));
+  if (mmap(buf, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+    error("cannot map %s: %s", path, strerror(errno));
+
+  close(fd);
+  return buf;
+}
+
+static int open_output(void) {
+  if (!opt_o || !strcmp(opt_o, "-"))
     return 1;
+
+  int fd = open(opt_o, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+    error("cannot open output file: %s: %s", opt_o, strerror(errno));
+  return fd;
+}
+
+//
+// -ftime-report
+//
+// Each phase records its wall time and the number of bytes it
+// allocated, either from the arena or for output buffers.
+//
+
+typedef struct {
+  char *name;
+  double ms;
+  size_t bytes;
+} Phase;
+
+static Phase phases[8];
+static int nphases;
+static struct timespec phase_time;
+static size_t phase_bytes;
+
+static size_t bytes_allocated(void) {
+  return arena_used() + emit_allocated();
+}
+
+static void start_phase(void) {
+  clock_gettime(CLOCK_MONOTONIC, &phase_time);
+  phase_bytes = bytes_allocated();
+}
+
+static void end_phase(char *name) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  Phase *ph = &phases[nphases++];
+  ph->name = name;
+  ph->ms = (now.tv_sec - phase_time.tv_sec) * 1e3 +
+           (now.tv_nsec - phase_time.tv_nsec) / 1e6;
+  ph->bytes = bytes_allocated() - phase_bytes;
+  start_phase();
+}
+
+// Prints `s` as a JSON string literal.
+static void print_json_string(FILE *out, char *s) {
+  fputc('"', out);
+  for (unsigned char *p = (unsigned char *)s; *p; p++) {
+    if (*p == '"' || *p == '\\')
+      fprintf(out, "\\%c", *p);
+    else if (*p < 0x20)
+      fprintf(out, "\\u%04x", *p);
+    else
+      fputc(*p, out);
   }
-  
-  // tokenize and parse
-  user_input = argv[1];
-  token = tokenize();
-  
-  Function *prog = program(); 
-  for (Function *fn = prog; fn; fn = fn->next) {
-    int offset = 0;
+  fputc('"', out);
+}
+
+static void print_time_report(long ntokens, long nfuncs) {
+  double total_ms = 0;
+  size_t total_bytes = 0;
+  long ninsns = codegen_instructions();
+  for (int i = 0; i < nphases; i++) {
+    total_ms += phases[i].ms;
+    total_bytes += phases[i].bytes;
+  }
+
+  if (opt_time_json) {
+    fprintf(stderr, "{\"file\": ");
+    print_json_string(stderr, filename);
+    fprintf(stderr, ", \"phases\": [");
+    for (int i = 0; i < nphases; i++)
+      fprintf(stderr, "%s{\"name\": \"%s\", \"ms\": %.3f, \"bytes\": %zu}",
+              i ? ", " : "", phases[i].name, phases[i].ms, phases[i].bytes);
+    fprintf(stderr, "], \"total_ms\": %.3f, \"total_bytes\": %zu, "
+            "\"tokens\": %ld, \"nodes\": %ld, \"types\": %ld, "
+            "\"functions\": %ld, \"instructions\": %ld, "
+            "\"peephole_eliminated\": %ld, \"arena_peak\": %zu}\n",
+            total_ms, total_bytes, ntokens, node_count, type_count, nfuncs,
+            ninsns, peephole_eliminated(), arena_peak());
+    return;
+  }
+
+  fprintf(stderr, "%-12s %12s %14s\n", "phase", "wall (ms)", "allocated");
+  for (int i = 0; i < nphases; i++)
+    fprintf(stderr, "%-12s %12.3f %14zu\n", phases[i].name, phases[i].ms,
+            phases[i].bytes);
+  fprintf(stderr, "%-12s %12.3f %14zu\n", "total", total_ms, total_bytes);
+  fprintf(stderr, "tokens: %ld, nodes: %ld, types: %ld, functions: %ld, "
+          "instructions: %ld (%ld eliminated by peephole), "
+          "arena peak: %zu bytes\n",
+          ntokens, node_count, type_count, nfuncs, ninsns,
+          peephole_eliminated(), arena_peak());
+}
+
+// Emits `obj` as an ELF object file.
+static void emit_object(Object *obj) {
+  size_t size;
+  char *image = elf_image(obj, &size);
+  emit_raw(image, size);
+  free(image);
+}
+
+// Assigns offsets to the local variables of `fn`. Variables are
+// placed in order of decreasing alignment, so none of them needs
+// padding and the frame is only as large as the variables in it.
+// The size is rounded up to 8 bytes for the spill slots that
+// register allocation adds below it.
+static void layout_frame(Function *fn) {
+  int offset = 0;
+  for (int align = 8; align > 0; align /= 2) {
     for (VarList *vl = fn->locals; vl; vl = vl->next) {
-      offset +=8;
+      if (vl->var->ty->align != align)
+        continue;
+      offset += vl->var->ty->size;
       vl->var->offset = offset;
     }
-    fn->stack_size = offset;
   }
-  
-  codegen(prog);
+  fn->stack_size = (offset + 7) & ~7;
+}
+
+// Compiles `src` and emits assembly for it, or an object file if -c
+// is given. With --run, nothing is emitted and the machine code is
+// returned instead. `path` is only used in error messages.
+Object *compile(char *path, char *src, int nthreads) {
+  nphases = 0;
+  peephole_reset();
+  init_types();
+  start_phase();
+
+  // tokenize and parse
+  filename = path;
+  user_input = src;
+  token = tokenize();
+  end_phase("tokenize");
+
+  long ntokens = 0;
+  if (opt_time_report)
+    for (Token *tok = token; tok; tok = tok->next)
+      ntokens++;
+
+  Function *prog = program();
+  end_phase("parse");
+
+  fold(prog);
+  end_phase("fold");
+
+  long nfuncs = 0;
+  for (Function *fn = prog; fn; fn = fn->next) {
+    layout_frame(fn);
+    nfuncs++;
+  }
+  end_phase("frame");
+
+  Object *obj = NULL;
+  if (opt_c || opt_run)
+    obj = codegen_object(prog, nthreads);
+  else
+    codegen(prog, nthreads);
+  end_phase("codegen");
 
-  
+  if (opt_c) {
+    emit_object(obj);
+    object_free(obj);
+    obj = NULL;
+    end_phase("elf");
+  }
+
+  if (opt_time_report)
+    print_time_report(ntokens, nfuncs);
+  return obj;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  // Functions found in the cache are not compiled, so there
+  // would be no IR to dump. Machine code and assembly are cached
+  // under different keys.
+  if (opt_cache_dir && !dump_ir) {
+    bool object = opt_c || opt_run;
+    char *salt = no_peephole ? (object ? "-c -fno-peephole" : "-fno-peephole")
+                             : (object ? "-c" : "");
+    cache_init(opt_cache_dir, salt);
+  }
+
+  if (opt_server) {
+    run_server(opt_socket, opt_j);
+    return 0;
+  }
+
+  char *src = read_file(input_path);
+
+  // Compile to memory and run the program in this process. Functions
+  // it calls are looked up in the libraries 9cc itself has loaded,
+  // which includes anything in LD_PRELOAD.
+  if (opt_run) {
+    Object *obj = compile(input_path, src, opt_j);
+    int ret = jit_run(obj);
+    object_free(obj);
+    return ret;
+  }
 
+  emit_open(open_output());
+  compile(input_path, src, opt_j);
+  emit_flush();
+  arena_reset();
   return 0;
 }
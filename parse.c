@@ -1,21 +1,138 @@
 #include "9cc.h"
+#include <limits.h>
 
 // All local variable instances created during parsing are
 // accumulated to this list.
 static VarList *locals;
 
+// Variables that are visible at the current point of parsing.
+//
+// Names are interned by the tokenizer, so the table is keyed by the
+// address of a name and entries are compared by pointer. Each bucket
+// is a chain with the innermost declaration first, so the first
+// match is the variable in scope. Entries are also linked in
+// declaration order through `up` so that leaving a block can drop
+// its variables without searching.
+typedef struct VarScope VarScope;
+struct VarScope {
+  VarScope *next; // Next entry in the same bucket
+  VarScope *up;   // Previously declared entry
+  Var *var;
+};
+
+static VarScope **scope_buckets;
+static int scope_cap;
+static int scope_used;
+static VarScope *scope_top;
+
+static int hash_name(char *name) {
+  unsigned long h = (unsigned long)name >> 3;
+  return (int)((h * 0x9E3779B97F4A7C15ul) >> 32) & (scope_cap - 1);
+}
+
+static void grow_scope(void) {
+  VarScope **old = scope_buckets;
+  int oldcap = scope_cap;
+
+  scope_cap = oldcap ? oldcap * 2 : 64;
+  scope_buckets = arena_alloc(sizeof(VarScope *) * scope_cap);
+
+  // Chains keep their relative order, so inner declarations
+  // still shadow outer ones after rehashing.
+  VarScope **tails = arena_alloc(sizeof(VarScope *) * scope_cap);
+  for (int i = 0; i < oldcap; i++) {
+    for (VarScope *sc = old[i]; sc;) {
+      VarScope *next = sc->next;
+      int h = hash_name(sc->var->name);
+      sc->next = NULL;
+      if (tails[h])
+        tails[h]->next = sc;
+      else
+        scope_buckets[h] = sc;
+      tails[h] = sc;
+      sc = next;
+    }
+  }
+}
+
+static void push_scope(Var *var) {
+  if (scope_used * 2 >= scope_cap)
+    grow_scope();
+
+  int h = hash_name(var->name);
+  VarScope *sc = arena_alloc(sizeof(VarScope));
+  sc->var = var;
+  sc->next = scope_buckets[h];
+  sc->up = scope_top;
+  scope_buckets[h] = sc;
+  scope_top = sc;
+  scope_used++;
+}
+
+// Starts a new block scope. The returned value must be passed
+// to leave_scope() when the block ends.
+static VarScope *enter_scope(void) {
+  return scope_top;
+}
+
+// Removes variables declared since the matching enter_scope().
+// They were pushed last, so each of them is the head of its bucket.
+static void leave_scope(VarScope *sc) {
+  while (scope_top != sc) {
+    int h = hash_name(scope_top->var->name);
+    scope_buckets[h] = scope_top->next;
+    scope_top = scope_top->up;
+    scope_used--;
+  }
+}
+
 // Find a local variable by name.
 static Var *find_var(Token *tok) {
-  for (VarList *vl = locals; vl; vl = vl->next) {
-    Var *var = vl->var;
-    if (strlen(var->name) == tok->len && !strncmp(tok->str, var->name, tok->len))
-      return var;
-  }
+  if (!scope_cap)
+    return NULL;
+  for (VarScope *sc = scope_buckets[hash_name(tok->name)]; sc; sc = sc->next)
+    if (sc->var->name == tok->name)
+      return sc->var;
   return NULL;
 }
 
+// Number of nodes created by the current compilation
+long node_count;
+
+#define NODE_END(field) (offsetof(Node, field) + sizeof(((Node *)0)->field))
+
+// Returns the number of bytes a node of a given kind needs.
+static size_t node_size(NodeKind kind) {
+  switch (kind) {
+  case ND_NULL:
+    return offsetof(Node, lhs);
+  case ND_ADDR:
+  case ND_DEREF:
+  case ND_RETURN:
+  case ND_EXPR_STMT:
+    return NODE_END(lhs);
+  case ND_IF:
+    return NODE_END(els);
+  case ND_WHILE:
+    return NODE_END(then);
+  case ND_FOR:
+    return NODE_END(inc);
+  case ND_BLOCK:
+    return NODE_END(body);
+  case ND_FUNCALL:
+    return NODE_END(args);
+  case ND_VAR:
+    return NODE_END(var);
+  case ND_NUM:
+    return NODE_END(val);
+  default:
+    return NODE_END(rhs);
+  }
+}
+
 static Node *new_node(NodeKind kind, Token *tok) {
-  Node *node = calloc(1, sizeof(Node));
+  node_count++;
+  Node *node = arena_alloc(node_size(kind));
   node->kind = kind;
   node->tok = tok;
   return node;
@@ -47,14 +164,15 @@ static Node *new_var_node(Var *var, Token *tok) {
 }
 
 static Var *new_lvar(char *name, Type *ty) {
-  Var *var = calloc(1, sizeof(Var));
+  Var *var = arena_alloc(sizeof(Var));
   var->name = name;
   var->ty = ty;
 
-  VarList *vl = calloc(1, sizeof(VarList));
+  VarList *vl = arena_alloc(sizeof(VarList));
   vl->var = var;
   vl->next = locals;
   locals = vl;
+  push_scope(var);
   return var;
 }
 
@@ -69,6 +187,7 @@ static Node *relational(void);
 static Node *add(void);
 static Node *mul(void);
 static Node *unary(void);
+static Node *postfix(void);
 static Node *primary(void);
 
 // program = function*
@@ -76,6 +195,12 @@ Function *program(void) {
   Function head = {};
   Function *cur = &head;
 
+  node_count = 0;
+  scope_buckets = NULL;
+  scope_cap = 0;
+  scope_used = 0;
+  scope_top = NULL;
+
   while (!at_eof()) {
     cur->next = function();
     cur = cur->next;
@@ -83,31 +208,64 @@ Function *program(void) {
   return head.next;
 }
 
-// basetype = "int" "*"*
+static bool is_typename(void) {
+  return peek(KW_CHAR) || peek(KW_SHORT) || peek(KW_INT) || peek(KW_LONG);
+}
+
+// basetype = ("char" | "short" | "int" | "long") "*"*
 static Type *basetype(void) {
-  expect("int");
-  Type *ty = int_type;
-  while (consume("*"))
+  Type *ty;
+  if (consume(KW_CHAR))
+    ty = char_type;
+  else if (consume(KW_SHORT))
+    ty = short_type;
+  else if (consume(KW_LONG))
+    ty = long_type;
+  else {
+    expect(KW_INT);
+    ty = int_type;
+  }
+
+  while (consume(PU_STAR))
     ty = pointer_to(ty);
   return ty;
 }
 
+// type-suffix = ("[" num "]" type-suffix)?
+static Type *type_suffix(Type *ty) {
+  if (!consume(PU_LBRACKET))
+    return ty;
+  Token *tok = token;
+  long len = expect_number();
+  if (len <= 0 || len > INT_MAX / ty->size)
+    error_tok(tok, "invalid array length");
+  expect(PU_RBRACKET);
+  ty = type_suffix(ty);
+  return array_of(ty, len);
+}
+
 static VarList *read_func_param(void) {
-  VarList *vl = calloc(1, sizeof(VarList));
+  VarList *vl = arena_alloc(sizeof(VarList));
   Type *ty = basetype();
-  vl->var = new_lvar(expect_ident(), ty);
+  char *name = expect_ident();
+  ty = type_suffix(ty);
+
+  // An array parameter is a pointer to its first element.
+  if (ty->kind == TY_ARRAY)
+    ty = pointer_to(ty->base);
+  vl->var = new_lvar(name, ty);
   return vl;
 }
 
 static VarList *read_func_params(void) {
-  if (consume(")"))
+  if (consume(PU_RPAREN))
     return NULL;
 
   VarList *head = read_func_param();
   VarList *cur = head;
 
-  while (!consume(")")) {
-    expect(",");
+  while (!consume(PU_RPAREN)) {
+    expect(PU_COMMA);
     cur->next = read_func_param();
     cur = cur->next;
   }
@@ -115,44 +273,87 @@ static VarList *read_func_params(void) {
   return head;
 }
 
+// Returns the token after the closing brace of the function that
+// starts at `tok`, or NULL if the braces are not balanced.
+static Token *skip_function(Token *tok) {
+  while (tok->kind != TK_EOF &&
+         !(tok->kind == TK_RESERVED && tok->id == PU_LBRACE))
+    tok = tok->next;
+
+  int depth = 0;
+  for (; tok->kind != TK_EOF; tok = tok->next) {
+    if (tok->kind != TK_RESERVED)
+      continue;
+    if (tok->id == PU_LBRACE)
+      depth++;
+    if (tok->id == PU_RBRACE && --depth == 0)
+      return tok->next;
+  }
+  return NULL;
+}
+
+// Looks up a function in the compilation cache. On a hit, the
+// function's tokens are skipped without being parsed.
+static bool lookup_cache(Function *fn) {
+  Token *end = skip_function(token);
+  if (!end)
+    return false;
+
+  cache_key(token, end, fn->cache_key);
+  fn->text = cache_lookup(fn->cache_key, &fn->text_len);
+  if (!fn->text)
+    return false;
+
+  fn->cached = true;
+  token = end;
+  return true;
+}
+
 // function = basetype ident "(" params? ")" "{" stmt* "}"
 // params   = param ("," param)*
 // param    = basetype ident
 static Function *function(void) {
+  Function *fn = arena_alloc(sizeof(Function));
+  if (cache_enabled() && lookup_cache(fn))
+    return fn;
+
   locals = NULL;
+  VarScope *sc = enter_scope();
 
-  Function *fn = calloc(1, sizeof(Function));
-  basetype();
+  fn->ty = basetype();
   fn->name = expect_ident();
-  expect("(");
+  expect(PU_LPAREN);
   fn->params = read_func_params();
-  expect("{");
+  expect(PU_LBRACE);
 
   Node head = {};
   Node *cur = &head;
-  while (!consume("}")) {
+  while (!consume(PU_RBRACE)) {
     cur->next = stmt();
     cur = cur->next;
   }
 
   fn->node = head.next;
   fn->locals = locals;
+  leave_scope(sc);
   return fn;
 }
 
-// declaration = basetype ident ("=" expr) ";"
+// declaration = basetype ident type-suffix ("=" expr)? ";"
 static Node *declaration(void) {
   Token *tok = token;
   Type *ty = basetype();
-  Var *var = new_lvar(expect_ident(), ty);
+  char *name = expect_ident();
+  ty = type_suffix(ty);
+  Var *var = new_lvar(name, ty);
 
-  if (consume(";"))
+  if (consume(PU_SEMI))
     return new_node(ND_NULL, tok);
 
-  expect("=");
+  expect(PU_ASSIGN);
   Node *lhs = new_var_node(var, tok);
   Node *rhs = expr();
-  expect(";");
+  expect(PU_SEMI);
   Node *node = new_binary(ND_ASSIGN, lhs, rhs, tok);
   return new_unary(ND_EXPR_STMT, node, tok);
 }
@@ -177,70 +378,72 @@ static Node *stmt(void) {
 //       | expr ";"
 static Node *stmt2(void) {
   Token *tok;
-  if (tok = consume("return")) {
+  if (tok = consume(KW_RETURN)) {
     Node *node = new_unary(ND_RETURN, expr(), tok);
-    expect(";");
+    expect(PU_SEMI);
     return node;
   }
 
-  if (tok = consume("if")) {
+  if (tok = consume(KW_IF)) {
     Node *node = new_node(ND_IF, tok);
-    expect("(");
+    expect(PU_LPAREN);
     node->cond = expr();
-    expect(")");
+    expect(PU_RPAREN);
     node->then = stmt();
-    if (consume("else"))
+    if (consume(KW_ELSE))
       node->els = stmt();
     return node;
   }
 
-  if (tok = consume("while")) {
+  if (tok = consume(KW_WHILE)) {
     Node *node = new_node(ND_WHILE, tok);
-    expect("(");
+    expect(PU_LPAREN);
     node->cond = expr();
-    expect(")");
+    expect(PU_RPAREN);
     node->then = stmt();
     return node;
   }
 
-  if (tok = consume("for")) {
+  if (tok = consume(KW_FOR)) {
     Node *node = new_node(ND_FOR, tok);
-    expect("(");
-    if (!consume(";")) {
+    expect(PU_LPAREN);
+    if (!consume(PU_SEMI)) {
       node->init = read_expr_stmt();
-      expect(";");
+      expect(PU_SEMI);
     }
-    if (!consume(";")) {
+    if (!consume(PU_SEMI)) {
       node->cond = expr();
-      expect(";");
+      expect(PU_SEMI);
     }
-    if (!consume(")")) {
+    if (!consume(PU_RPAREN)) {
       node->inc = read_expr_stmt();
-      expect(")");
+      expect(PU_RPAREN);
     }
     node->then = stmt();
     return node;
   }
 
-  if (tok = consume("{")) {
+  if (tok = consume(PU_LBRACE)) {
     Node head = {};
     Node *cur = &head;
 
-    while (!consume("}")) {
+    VarScope *sc = enter_scope();
+    while (!consume(PU_RBRACE)) {
       cur->next = stmt();
       cur = cur->next;
     }
+    leave_scope(sc);
 
     Node *node = new_node(ND_BLOCK, tok);
     node->body = head.next;
     return node;
   }
 
-  if (tok = peek("int"))
+  if (is_typename())
     return declaration();
 
   Node *node = read_expr_stmt();
-  expect(";");
+  expect(PU_SEMI);
   return node;
 }
 
@@ -253,7 +456,7 @@ static Node *expr(void) {
 static Node *assign(void) {
   Node *node = equality();
   Token *tok;
-  if (tok = consume("="))
+  if (tok = consume(PU_ASSIGN))
     node = new_binary(ND_ASSIGN, node, assign(), tok);
   return node;
 }
@@ -264,9 +467,9 @@ static Node *equality(void) {
   Token *tok;
 
   for (;;) {
-    if (tok = consume("=="))
+    if (tok = consume(PU_EQ))
       node = new_binary(ND_EQ, node, relational(), tok);
-    else if (tok = consume("!="))
+    else if (tok = consume(PU_NE))
       node = new_binary(ND_NE, node, relational(), tok);
     else
       return node;
@@ -279,13 +482,13 @@ static Node *relational(void) {
   Token *tok;
 
   for (;;) {
-    if (tok = consume("<"))
+    if (tok = consume(PU_LT))
       node = new_binary(ND_LT, node, add(), tok);
-    else if (tok = consume("<="))
+    else if (tok = consume(PU_LE))
       node = new_binary(ND_LE, node, add(), tok);
-    else if (tok = consume(">"))
+    else if (tok = consume(PU_GT))
       node = new_binary(ND_LT, add(), node, tok);
-    else if (tok = consume(">="))
+    else if (tok = consume(PU_GE))
       node = new_binary(ND_LE, add(), node, tok);
     else
       return node;
@@ -324,9 +527,9 @@ static Node *add(void) {
   Token *tok;
 
   for (;;) {
-    if (tok = consume("+"))
+    if (tok = consume(PU_PLUS))
       node = new_add(node, mul(), tok);
-    else if (tok = consume("-"))
+    else if (tok = consume(PU_MINUS))
       node = new_sub(node, mul(), tok);
     else
       return node;
@@ -339,9 +542,9 @@ static Node *mul(void) {
   Token *tok;
 
   for (;;) {
-    if (tok = consume("*"))
+    if (tok = consume(PU_STAR))
       node = new_binary(ND_MUL, node, unary(), tok);
-    else if (tok = consume("/"))
+    else if (tok = consume(PU_SLASH))
       node = new_binary(ND_DIV, node, unary(), tok);
     else
       return node;
@@ -349,49 +552,73 @@ static Node *mul(void) {
 }
 
 // unary = ("+" | "-" | "*" | "&")? unary
-//       | primary
+//       | "sizeof" unary
+//       | postfix
 static Node *unary(void) {
   Token *tok;
-  if (consume("+"))
+  if (tok = consume(KW_SIZEOF)) {
+    Node *node = unary();
+    add_type(node);
+    return new_num(node->ty->size, tok);
+  }
+  if (consume(PU_PLUS))
     return unary();
-  if (tok = consume("-"))
+  if (tok = consume(PU_MINUS))
     return new_binary(ND_SUB, new_num(0, tok), unary(), tok);
-  if (tok = consume("&"))
+  if (tok = consume(PU_AMP))
     return new_unary(ND_ADDR, unary(), tok);
-  if (tok = consume("*"))
+  if (tok = consume(PU_STAR))
     return new_unary(ND_DEREF, unary(), tok);
-  return primary();
+  return postfix();
+}
+
+// postfix = primary ("[" expr "]")*
+static Node *postfix(void) {
+  Node *node = primary();
+  Token *tok;
+
+  // x[y] is short for *(x+y)
+  while (tok = consume(PU_LBRACKET)) {
+    Node *exp = new_add(node, expr(), tok);
+    expect(PU_RBRACKET);
+    node = new_unary(ND_DEREF, exp, tok);
+  }
+  return node;
 }
 
 // func-args = "(" (assign ("," assign)*)? ")"
 static Node *func_args(void) {
-  if (consume(")"))
+  if (consume(PU_RPAREN))
     return NULL;
 
   Node *head = assign();
   Node *cur = head;
-  while (consume(",")) {
+  int nargs = 1;
+  while (consume(PU_COMMA)) {
+    Token *tok = token;
     cur->next = assign();
     cur = cur->next;
+    if (++nargs > 6)
+      error_tok(tok, "too many arguments");
   }
-  expect(")");
+  expect(PU_RPAREN);
   return head;
 }
 
 // primary = "(" expr ")" | ident func-args? | num
 static Node *primary(void) {
-  if (consume("(")) {
+  if (consume(PU_LPAREN)) {
     Node *node = expr();
-    expect(")");
+    expect(PU_RPAREN);
     return node;
   }
 
   Token *tok;
   if (tok = consume_ident()) {
     // Function call
-    if (consume("(")) {
+    if (consume(PU_LPAREN)) {
       Node *node = new_node(ND_FUNCALL, tok);
-      node->funcname = duplicate(tok->str, tok->len);
+      node->funcname = tok->name;
 
       node->args = func_args();
       return node;
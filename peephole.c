@@ -0,0 +1,574 @@
+#include "9cc.h"
+#include <stdatomic.h>
+
+// Peephole optimizer.
+//
+// Code generation lowers one IR instruction at a time, so its output
+// has seams: constants and addresses are computed into a register
+// that is read once by the next instruction, values are copied into
+// a register only to be copied again, and a jump can land right
+// after itself. This pass rewrites the instructions of a function
+// before they are printed:
+//
+//  - mov A, X followed by an instruction whose only use of A is a
+//    source operand becomes that instruction reading X, if A is dead
+//    afterwards.
+//  - lea A, [M] followed by an instruction that addresses memory
+//    through [A] becomes that instruction addressing [M].
+//  - mov, lea and movzx to a register that is dead are deleted.
+//  - A jump to the next label is deleted, and a conditional jump
+//    over an unconditional one is inverted.
+//
+// Whether a register is dead is found by following the code forward,
+// across jumps, until the register is either read or overwritten.
+// The search gives up, assuming the register live, after a fixed
+// number of instructions or where it leaves the instructions it
+// was given.
+
+// Set by -fno-peephole
+bool no_peephole;
+
+static atomic_long eliminated;
+
+// What the pass knows about an instruction
+typedef struct {
+  int target;   // Index of the label jumped to, or -1
+  int seen;     // Used by live_after()
+  bool deleted;
+
+  // Registers read, written, and entirely overwritten
+  unsigned short use;
+  unsigned short def;
+  unsigned short kill;
+} Info;
+
+typedef struct {
+  Insn *insns;
+  Info *info;
+  int n;
+  int stamp;  // For Info.seen
+} Code;
+
+#define BIT(r) (1u << (r))
+
+// Registers a call reads, and registers it does not preserve
+#define CALL_USE (BIT(RAX) | BIT(RDI) | BIT(RSI) | BIT(RDX) | BIT(RCX) | \
+                  BIT(R8) | BIT(R9))
+#define CALL_KILL (BIT(RAX) | BIT(RCX) | BIT(RDX) | BIT(RSI) | BIT(RDI) | \
+                   BIT(R8) | BIT(R9) | BIT(R10) | BIT(R11))
+
+// Registers that hold a value when a function returns
+#define RET_USE (BIT(RAX) | BIT(RBX) | BIT(RSP) | BIT(RBP) | BIT(R12) | \
+                 BIT(R13) | BIT(R14) | BIT(R15))
+
+// How many instructions live_after() looks at before giving up
+#define SEARCH_LIMIT 256
+
+//
+// Analysis
+//
+
+static bool is_jump(Insn *in) {
+  return I_JMP <= in->mn && in->mn <= I_JG;
+}
+
+static bool is_label(Insn *in) {
+  return in->mn == I_LABEL || in->mn == I_GLOBAL;
+}
+
+static bool is_movx(Insn *in) {
+  return in->mn == I_MOVSX || in->mn == I_MOVSXD || in->mn == I_MOVZB;
+}
+
+static unsigned mem_regs(Operand *op) {
+  unsigned set = 0;
+  if (op->kind == OPD_MEM) {
+    if (op->base >= 0)
+      set |= BIT(op->base);
+    if (op->index >= 0)
+      set |= BIT(op->index);
+  }
+  return set;
+}
+
+static unsigned reg_bit(Operand *op) {
+  return op->kind == OPD_REG ? BIT(op->reg) : 0;
+}
+
+// Records that `op` is written. Writing a 32-bit register clears
+// the upper half, so only 8- and 16-bit writes keep the old value.
+static void write_operand(Info *f, Operand *op) {
+  f->use |= mem_regs(op);
+  if (op->kind != OPD_REG)
+    return;
+  f->def |= BIT(op->reg);
+  if (op->size >= 4)
+    f->kill |= BIT(op->reg);
+  else
+    f->use |= BIT(op->reg);
+}
+
+static void read_operand(Info *f, Operand *op) {
+  f->use |= mem_regs(op) | reg_bit(op);
+}
+
+// Computes the registers `in` reads and writes.
+static void find_effects(Insn *in, Info *f) {
+  f->use = f->def = f->kill = 0;
+  Operand *a = &in->ops[0];
+  Operand *b = &in->ops[1];
+
+  switch (in->mn) {
+  case I_MOV:
+  case I_MOVSX:
+  case I_MOVSXD:
+  case I_MOVZB:
+  case I_LEA:
+  case I_POP:
+    if (in->mn == I_LEA)
+      f->use |= mem_regs(b);
+    else if (in->nops == 2)
+      read_operand(f, b);
+    write_operand(f, a);
+    if (in->mn == I_POP)
+      f->use |= BIT(RSP);
+    return;
+  case I_ADD:
+  case I_SUB:
+  case I_SHL:
+  case I_SHR:
+  case I_SAR:
+  case I_CMP:
+  case I_PUSH:
+    for (int i = 0; i < in->nops; i++)
+      read_operand(f, &in->ops[i]);
+    if (in->mn == I_PUSH)
+      f->use |= BIT(RSP);
+    if (in->mn != I_CMP && in->mn != I_PUSH && a->kind == OPD_REG)
+      f->def |= BIT(a->reg);
+    return;
+  case I_IMUL:
+    if (in->nops == 1) {
+      f->use |= BIT(RAX);
+      read_operand(f, a);
+      f->def = f->kill = BIT(RAX) | BIT(RDX);
+    } else if (b->kind != OPD_IMM) {
+      read_operand(f, a);
+      read_operand(f, b);
+      f->def |= reg_bit(a);
+    } else {
+      read_operand(f, a);
+      write_operand(f, a);
+    }
+    return;
+  case I_IDIV:
+    f->use |= BIT(RAX) | BIT(RDX);
+    read_operand(f, a);
+    f->def = f->kill = BIT(RAX) | BIT(RDX);
+    return;
+  case I_CQO:
+    f->use = BIT(RAX);
+    f->def = f->kill = BIT(RDX);
+    return;
+  case I_SETE:
+  case I_SETNE:
+  case I_SETL:
+  case I_SETLE:
+    write_operand(f, a);
+    return;
+  case I_CALL:
+    f->use = CALL_USE;
+    f->def = f->kill = CALL_KILL;
+    return;
+  case I_RET:
+    f->use = RET_USE;
+    return;
+  default:
+    return;
+  }
+}
+
+static unsigned hash_label(long n) {
+  return n * 2654435761u;
+}
+
+// Finds the label each jump goes to. Labels outside the instructions
+// given, such as the return label of a long function, are not found.
+static void resolve_jumps(Code *c) {
+  int nlabels = 0;
+  for (int i = 0; i < c->n; i++)
+    if (c->insns[i].mn == I_LABEL)
+      nlabels++;
+
+  int cap = 16;
+  while (cap < nlabels * 2)
+    cap *= 2;
+  int *table = malloc(sizeof(int) * cap);
+  for (int i = 0; i < cap; i++)
+    table[i] = -1;
+
+  for (int i = 0; i < c->n; i++) {
+    Operand *op = &c->insns[i].ops[0];
+    if (c->insns[i].mn != I_LABEL || op->kind != OPD_LABEL)
+      continue;
+    unsigned h = hash_label(op->imm);
+    while (table[h & (cap - 1)] >= 0)
+      h++;
+    table[h & (cap - 1)] = i;
+  }
+
+  for (int i = 0; i < c->n; i++) {
+    c->info[i].target = -1;
+    if (!is_jump(&c->insns[i]))
+      continue;
+    long label = c->insns[i].ops[0].imm;
+    for (unsigned h = hash_label(label);; h++) {
+      int j = table[h & (cap - 1)];
+      if (j < 0)
+        break;
+      if (c->insns[j].ops[0].imm == label) {
+        c->info[i].target = j;
+        break;
+      }
+    }
+  }
+  free(table);
+}
+
+// Returns true if `reg` may be read after instruction `i` before it
+// is overwritten.
+static bool live_after(Code *c, int i, int reg) {
+  int stack[SEARCH_LIMIT];
+  int sp = 0;
+  int budget = SEARCH_LIMIT;
+  unsigned bit = BIT(reg);
+
+  c->stamp++;
+  stack[sp++] = i + 1;
+
+  while (sp > 0) {
+    for (int k = stack[--sp];; k++) {
+      if (k >= c->n || --budget == 0)
+        return true;
+
+      Insn *in = &c->insns[k];
+      Info *f = &c->info[k];
+      if (f->seen == c->stamp)
+        break;
+      f->seen = c->stamp;
+
+      if (f->deleted || is_label(in))
+        continue;
+      if (f->use & bit)
+        return true;
+      if (in->mn == I_RET || (f->kill & bit))
+        break;
+
+      if (is_jump(in)) {
+        if (f->target < 0 || sp == SEARCH_LIMIT)
+          return true;
+        stack[sp++] = f->target;
+        if (in->mn == I_JMP)
+          break;
+      }
+    }
+  }
+  return false;
+}
+
+// Returns the index of the next instruction after `i` that has not
+// been deleted, or -1 if a label comes first.
+static int next_insn(Code *c, int i) {
+  for (int j = i + 1; j < c->n; j++) {
+    if (c->info[j].deleted)
+      continue;
+    if (is_label(&c->insns[j]))
+      return -1;
+    return j;
+  }
+  return -1;
+}
+
+// Returns how many of the operands of `in` read `reg`. A register
+// that a move only writes is not counted.
+static int count_reads(Insn *in, int reg) {
+  bool move = in->mn == I_MOV || is_movx(in) || in->mn == I_LEA;
+  int n = 0;
+  for (int i = 0; i < in->nops; i++) {
+    Operand *op = &in->ops[i];
+    if (op->kind == OPD_REG && op->reg == reg && !(move && i == 0))
+      n++;
+    if (op->kind == OPD_MEM)
+      n += (op->base == reg) + (op->index == reg);
+  }
+  return n;
+}
+
+static bool is_imm32(long v) {
+  return -2147483648L <= v && v <= 2147483647L;
+}
+
+static bool is_reg64(Operand *op) {
+  return op->kind == OPD_REG && op->size == 8 && op->reg != RSP &&
+         op->reg != RBP;
+}
+
+static void delete(Code *c, int i) {
+  c->info[i].deleted = true;
+}
+
+static void update(Code *c, int i) {
+  find_effects(&c->insns[i], &c->info[i]);
+}
+
+//
+// Rules
+//
+
+// mov A, X; op Y, A => op Y, X
+static bool forward_copy(Code *c, int i) {
+  Insn *mov = &c->insns[i];
+  if (mov->mn != I_MOV || !is_reg64(&mov->ops[0]))
+    return false;
+  int a = mov->ops[0].reg;
+  Operand *x = &mov->ops[1];
+  if (x->kind == OPD_MEM && x->size && x->size != 8)
+    return false;
+  if (x->kind == OPD_REG && x->size != 8)
+    return false;
+
+  int j = next_insn(c, i);
+  if (j < 0)
+    return false;
+  Insn *in = &c->insns[j];
+  Operand *dst = &in->ops[0];
+  Operand *src = &in->ops[1];
+
+  if (in->nops != 2 || src->kind != OPD_REG || src->reg != a ||
+      count_reads(in, a) != 1)
+    return false;
+
+  // Part of a register is only replaced where it is stored or
+  // extended. A constant is truncated to the width of the store, and
+  // a register is used in the same width.
+  int size = src->size;
+  if (size != 8 && x->kind != OPD_IMM && x->kind != OPD_REG)
+    return false;
+  if (size != 8 && !(in->mn == I_MOV && dst->kind == OPD_MEM) &&
+      !(is_movx(in) && x->kind == OPD_REG))
+    return false;
+
+  switch (in->mn) {
+  case I_MOVSX:
+  case I_MOVSXD:
+  case I_MOVZB:
+    if (size == 8)
+      return false;
+    break;
+  case I_MOV:
+    if (dst->kind == OPD_MEM && x->kind == OPD_MEM)
+      return false;
+    if (dst->kind == OPD_MEM && x->kind == OPD_IMM && !is_imm32(x->imm))
+      return false;
+    break;
+  case I_ADD:
+  case I_SUB:
+  case I_CMP:
+  case I_IMUL:
+    if (dst->kind != OPD_REG || (x->kind == OPD_IMM && !is_imm32(x->imm)))
+      return false;
+    break;
+  default:
+    return false;
+  }
+
+  // A move into A itself leaves nothing of the old value.
+  bool redefines = (in->mn == I_MOV || is_movx(in)) &&
+                   dst->kind == OPD_REG && dst->reg == a && dst->size >= 4;
+  if (!redefines && live_after(c, j, a))
+    return false;
+
+  *src = *x;
+  if (src->kind == OPD_REG)
+    src->size = size;
+  if (src->kind == OPD_IMM) {
+    if (size == 1)
+      src->imm = (signed char)src->imm;
+    else if (size == 2)
+      src->imm = (short)src->imm;
+    else if (size == 4)
+      src->imm = (int)src->imm;
+  }
+  if (dst->kind == OPD_MEM && x->kind == OPD_IMM)
+    dst->size = size;
+  update(c, j);
+  delete(c, i);
+  return true;
+}
+
+// lea A, [M]; ...; op [A+d] => op [M+d]
+static bool fold_lea(Code *c, int i) {
+  Insn *lea = &c->insns[i];
+  if (lea->mn != I_LEA || !is_reg64(&lea->ops[0]))
+    return false;
+  int a = lea->ops[0].reg;
+  Operand *m = &lea->ops[1];
+  unsigned mregs = mem_regs(m);
+
+  for (int j = i + 1; j < c->n; j++) {
+    Insn *in = &c->insns[j];
+    Info *f = &c->info[j];
+    if (f->deleted)
+      continue;
+    if (is_label(in) || is_jump(in) || in->mn == I_CALL || in->mn == I_RET)
+      return false;
+
+    if (!(f->use & BIT(a))) {
+      if (f->def & (mregs | BIT(a)))
+        return false;
+      continue;
+    }
+
+    // This is the first instruction to read A. It must only use A as
+    // the base of a memory operand.
+    if (count_reads(in, a) != 1)
+      return false;
+    Operand *op = NULL;
+    for (int k = 0; k < in->nops; k++)
+      if (in->ops[k].kind == OPD_MEM && in->ops[k].base == a)
+        op = &in->ops[k];
+    if (!op || op->index >= 0 || !is_imm32(op->disp + m->disp))
+      return false;
+    if (!(f->kill & BIT(a)) && live_after(c, j, a))
+      return false;
+
+    op->base = m->base;
+    op->index = m->index;
+    op->scale = m->scale;
+    op->disp += m->disp;
+    update(c, j);
+    delete(c, i);
+    return true;
+  }
+  return false;
+}
+
+// Deletes a move to a register that is never read.
+static bool remove_dead_move(Code *c, int i) {
+  Insn *in = &c->insns[i];
+  if (in->mn != I_MOV && !is_movx(in) && in->mn != I_LEA)
+    return false;
+  Operand *dst = &in->ops[0];
+  if (!is_reg64(dst) && !(dst->kind == OPD_REG && dst->size == 4))
+    return false;
+  if (dst->reg == RSP || dst->reg == RBP || live_after(c, i, dst->reg))
+    return false;
+  delete(c, i);
+  return true;
+}
+
+// Returns true if only labels lie between `i` and `target`.
+static bool falls_into(Code *c, int i, int target) {
+  if (target <= i)
+    return false;
+  for (int j = i + 1; j < target; j++)
+    if (!c->info[j].deleted && c->insns[j].mn != I_LABEL)
+      return false;
+  return true;
+}
+
+static Mnemonic invert_jump(Mnemonic mn) {
+  switch (mn) {
+  case I_JE:
+    return I_JNE;
+  case I_JNE:
+    return I_JE;
+  case I_JL:
+    return I_JGE;
+  case I_JGE:
+    return I_JL;
+  case I_JLE:
+    return I_JG;
+  case I_JG:
+    return I_JLE;
+  }
+  unreachable();
+}
+
+static bool simplify_jump(Code *c, int i) {
+  Insn *in = &c->insns[i];
+  int target = c->info[i].target;
+
+  // jmp L; L:
+  if (in->mn == I_JMP && falls_into(c, i, target)) {
+    delete(c, i);
+    return true;
+  }
+
+  // jcc L1; jmp L2; L1: => jncc L2; L1:
+  if (!is_jump(in) || in->mn == I_JMP)
+    return false;
+  int j = next_insn(c, i);
+  if (j < 0)
+    return false;
+  Insn *jmp = &c->insns[j];
+  if (jmp->mn != I_JMP || !falls_into(c, j, target))
+    return false;
+
+  in->mn = invert_jump(in->mn);
+  in->ops[0] = jmp->ops[0];
+  c->info[i].target = c->info[j].target;
+  delete(c, j);
+  return true;
+}
+
+// Applies the rules to the `n` instructions at `insns` until none
+// applies, and moves the remaining ones to the front. Returns how
+// many remain. Nothing is assumed about code outside the
+// instructions given, so a long function can be optimized a window
+// at a time.
+int peephole(Insn *insns, int n) {
+  if (no_peephole)
+    return n;
+
+  Code c = {insns, malloc(sizeof(Info) * (n + 1)), n, 0};
+  for (int i = 0; i < n; i++) {
+    c.info[i].seen = 0;
+    c.info[i].deleted = false;
+    find_effects(&insns[i], &c.info[i]);
+  }
+  resolve_jumps(&c);
+
+  long removed = 0;
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (int i = 0; i < n; i++) {
+      if (c.info[i].deleted)
+        continue;
+      if (remove_dead_move(&c, i) || forward_copy(&c, i) || fold_lea(&c, i) ||
+          simplify_jump(&c, i)) {
+        removed++;
+        changed = true;
+      }
+    }
+  }
+
+  int j = 0;
+  for (int i = 0; i < n; i++)
+    if (!c.info[i].deleted)
+      insns[j++] = insns[i];
+
+  free(c.info);
+  atomic_fetch_add(&eliminated, removed);
+  return j;
+}
+
+// Returns the number of instructions deleted since the last call to
+// peephole_reset().
+long peephole_eliminated(void) {
+  return eliminated;
+}
+
+void peephole_reset(void) {
+  eliminated = 0;
+}
@@ -0,0 +1,300 @@
+#include "9cc.h"
+
+// Strength reduction.
+//
+// Multiplications and divisions by constants are replaced by cheaper
+// instructions. Multiplying by a power of two becomes a shift, and
+// multiplying by 3, 5 or 9 a lea. An addition of a value scaled by
+// 2, 4 or 8, which is how pointer arithmetic indexes memory, becomes
+// a single lea.
+//
+// Dividing by a power of two becomes an arithmetic shift, which
+// rounds toward negative infinity, so the dividend is biased first
+// if it is negative. Pointer differences are exact: they need no
+// bias, and other element sizes become a multiplication by the
+// inverse of the size.
+//
+// Other divisors are handled by multiplying by a "magic number"
+// approximating 2^(64+s)/d and keeping the high half of the product
+// (Hacker's Delight, chapter 10).
+//
+// Temporaries are defined once, in the block that uses them, so the
+// constant in a temporary is found through its defining instruction.
+// Instructions left without readers are deleted afterwards.
+
+// Instructions are inserted before *cur, which is where the rewritten
+// instruction is.
+static _Thread_local IR **cur;
+
+static Reg *insert(IROp op, Reg *a, Reg *b, long imm) {
+  Reg *r = new_reg();
+  IR *ir = new_ir(op, r, a, b);
+  ir->imm = imm;
+  ir->next = *cur;
+  *cur = ir;
+  cur = &ir->next;
+
+  if (a)
+    a->uses++;
+  if (b)
+    b->uses++;
+  return r;
+}
+
+static IR *const_def(Reg *r) {
+  if (r->def && r->def->op == IR_IMM)
+    return r->def;
+  return NULL;
+}
+
+// Returns log2(val) if `val` is a power of two, or -1.
+static int log2_exact(unsigned long val) {
+  if (val == 0 || (val & (val - 1)))
+    return -1;
+  return __builtin_ctzl(val);
+}
+
+// Makes `ir` compute `op a, b` with an immediate operand, releasing
+// its current operands.
+static void rewrite(IR *ir, IROp op, Reg *a, Reg *b, long imm) {
+  if (a)
+    a->uses++;
+  if (b)
+    b->uses++;
+  ir->a->uses--;
+  if (ir->b)
+    ir->b->uses--;
+
+  ir->op = op;
+  ir->a = a;
+  ir->b = b;
+  ir->imm = imm;
+}
+
+static void reduce_mul(IR *ir) {
+  if (const_def(ir->a) && !const_def(ir->b)) {
+    Reg *tmp = ir->a;
+    ir->a = ir->b;
+    ir->b = tmp;
+  }
+
+  IR *c = const_def(ir->b);
+  if (!c || c->imm <= 0)
+    return;
+
+  Reg *a = ir->a;
+  int k = log2_exact(c->imm);
+  if (k == 0)
+    rewrite(ir, IR_MOV, a, NULL, 0);
+  else if (k > 0)
+    rewrite(ir, IR_SHL, a, NULL, k);
+  else if (c->imm == 3 || c->imm == 5 || c->imm == 9)
+    rewrite(ir, IR_LEA, a, a, c->imm - 1);
+}
+
+// Returns true if `r` is not written between `from` and `to`.
+static bool unchanged(Reg *r, IR *from, IR *to) {
+  if (!r->var)
+    return true;
+  for (IR *ir = from->next; ir != to; ir = ir->next)
+    if (ir->dst == r)
+      return false;
+  return true;
+}
+
+// a + (x << k) becomes lea a, x, 1 << k if nothing else needs the
+// shifted value.
+static void reduce_add(IR *ir) {
+  for (int i = 0; i < 2; i++) {
+    Reg *base = i ? ir->b : ir->a;
+    Reg *scaled = i ? ir->a : ir->b;
+    IR *shl = scaled->def;
+    if (!shl || shl->op != IR_SHL || shl->imm > 3 || scaled->uses != 1 ||
+        !unchanged(shl->a, shl, ir))
+      continue;
+    rewrite(ir, IR_LEA, base, shl->a, 1L << shl->imm);
+    return;
+  }
+}
+
+static void reduce_div(IR *ir) {
+  IR *c = const_def(ir->b);
+  if (!c || c->imm == 0)
+    return;
+
+  Reg *n = ir->a;
+  long d = c->imm;
+  unsigned long ad = d < 0 ? -(unsigned long)d : d;
+  int k = log2_exact(ad);
+
+  if (d == 1) {
+    rewrite(ir, IR_MOV, n, NULL, 0);
+    return;
+  }
+
+  if (ir->exact && d > 0) {
+    // Shift out the power of two in d, and multiply by the inverse
+    // of the odd part modulo 2^64. Newton's iteration doubles the
+    // number of correct low bits each time, starting from 3 bits.
+    int tz = __builtin_ctzl(d);
+    unsigned long odd = d >> tz;
+    if (odd == 1) {
+      rewrite(ir, IR_SAR, n, NULL, tz);
+      return;
+    }
+    unsigned long inv = odd;
+    for (int i = 0; i < 5; i++)
+      inv *= 2 - odd * inv;
+    if (tz)
+      n = insert(IR_SAR, n, NULL, tz);
+    rewrite(ir, IR_MUL, n, insert(IR_IMM, NULL, NULL, inv), 0);
+    return;
+  }
+
+  if (d == -1) {
+    rewrite(ir, IR_SUB, insert(IR_IMM, NULL, NULL, 0), n, 0);
+    return;
+  }
+
+  if (k > 0) {
+    // Add 2^k-1 to negative dividends so that the shift rounds
+    // toward zero.
+    Reg *sign = k == 1 ? n : insert(IR_SAR, n, NULL, 63);
+    Reg *bias = insert(IR_SHR, sign, NULL, 64 - k);
+    Reg *biased = insert(IR_ADD, n, bias, 0);
+    if (d > 0) {
+      rewrite(ir, IR_SAR, biased, NULL, k);
+      return;
+    }
+    Reg *q = insert(IR_SAR, biased, NULL, k);
+    rewrite(ir, IR_SUB, insert(IR_IMM, NULL, NULL, 0), q, 0);
+    return;
+  }
+
+  // Find the magic number m and shift s for d.
+  unsigned long two63 = 1UL << 63;
+  unsigned long t = two63 + ((unsigned long)d >> 63);
+  unsigned long anc = t - 1 - t % ad;
+  int p = 63;
+  unsigned long q1 = two63 / anc, r1 = two63 - q1 * anc;
+  unsigned long q2 = two63 / ad, r2 = two63 - q2 * ad;
+  unsigned long delta;
+  do {
+    p++;
+    q1 *= 2;
+    r1 *= 2;
+    if (r1 >= anc) {
+      q1++;
+      r1 -= anc;
+    }
+    q2 *= 2;
+    r2 *= 2;
+    if (r2 >= ad) {
+      q2++;
+      r2 -= ad;
+    }
+    delta = ad - r2;
+  } while (q1 < delta || (q1 == delta && r1 == 0));
+
+  long m = q2 + 1;
+  if (d < 0)
+    m = -m;
+  int s = p - 64;
+
+  Reg *q = insert(IR_MULHI, n, NULL, m);
+  if (d > 0 && m < 0)
+    q = insert(IR_ADD, q, n, 0);
+  else if (d < 0 && m > 0)
+    q = insert(IR_SUB, q, n, 0);
+  if (s > 0)
+    q = insert(IR_SAR, q, NULL, s);
+
+  // Add one if the quotient is negative.
+  rewrite(ir, IR_ADD, q, insert(IR_SHR, q, NULL, 63), 0);
+}
+
+static bool is_pure(IR *ir) {
+  switch (ir->op) {
+  case IR_IMM:
+  case IR_MOV:
+  case IR_BPREL:
+  case IR_ADD:
+  case IR_SUB:
+  case IR_MUL:
+  case IR_SHL:
+  case IR_SHR:
+  case IR_SAR:
+  case IR_LEA:
+  case IR_MULHI:
+  case IR_SEXT:
+  case IR_EQ:
+  case IR_NE:
+  case IR_LT:
+  case IR_LE:
+    return true;
+  }
+  return false;
+}
+
+// Deletes instructions whose results are never read. Temporaries are
+// only read after their definition in the same block, so a single
+// backward walk over each block finds everything that became dead.
+static void remove_dead(BB *bb) {
+  int n = 0;
+  for (IR *ir = bb->ir; ir; ir = ir->next)
+    n++;
+
+  IR **insns = malloc(sizeof(IR *) * (n + 1));
+  n = 0;
+  for (IR *ir = bb->ir; ir; ir = ir->next)
+    insns[n++] = ir;
+
+  IR *next = NULL;
+  for (int i = n - 1; i >= 0; i--) {
+    IR *ir = insns[i];
+    if (ir->dst && !ir->dst->var && ir->dst->uses == 0 && is_pure(ir)) {
+      if (ir->a)
+        ir->a->uses--;
+      if (ir->b)
+        ir->b->uses--;
+      continue;
+    }
+    ir->next = next;
+    next = ir;
+  }
+  bb->ir = next;
+  free(insns);
+}
+
+void reduce_strength(Function *fn) {
+  for (Reg *r = fn->regs; r; r = r->next)
+    r->uses = 0;
+  for (BB *bb = fn->bbs; bb; bb = bb->next) {
+    for (IR *ir = bb->ir; ir; ir = ir->next) {
+      if (ir->a)
+        ir->a->uses++;
+      if (ir->b)
+        ir->b->uses++;
+      for (int i = 0; i < ir->nargs; i++)
+        ir->args[i]->uses++;
+    }
+  }
+
+  for (BB *bb = fn->bbs; bb; bb = bb->next) {
+    for (cur = &bb->ir; *cur; cur = &(*cur)->next) {
+      IR *ir = *cur;
+      switch (ir->op) {
+      case IR_MUL:
+        reduce_mul(ir);
+        break;
+      case IR_ADD:
+        reduce_add(ir);
+        break;
+      case IR_DIV:
+        reduce_div(ir);
+        break;
+      }
+    }
+    remove_dead(bb);
+  }
+}
@@ -0,0 +1,242 @@
+#include "9cc.h"
+#include <limits.h>
+
+// Linear scan register allocation.
+//
+// Instructions are numbered in layout order, and each virtual
+// register gets a live interval from its first to its last
+// appearance. Registers live across blocks, which are those holding
+// variables and temporaries marked global, are extended over the
+// blocks they are live in by a liveness analysis on the CFG.
+// Intervals are then visited in order of their start and given a
+// free real register. If none is left, the interval that ends last
+// is spilled to the stack.
+//
+// regs[0] to regs[num_caller_saved - 1] are not preserved across
+// calls, so intervals that contain a call only get the others.
+
+static void touch(Reg *r, int pos) {
+  if (pos < r->start)
+    r->start = pos;
+  if (pos > r->end)
+    r->end = pos;
+}
+
+static bool test_bit(unsigned long *set, int i) {
+  return set[i / 64] & (1ul << (i % 64));
+}
+
+static void set_bit(unsigned long *set, int i) {
+  set[i / 64] |= 1ul << (i % 64);
+}
+
+// Records a read of `r` at `pos` in `bb`.
+static void read_reg(BB *bb, Reg *r, int pos) {
+  touch(r, pos);
+  if (r->live >= 0 && !test_bit(bb->def, r->live))
+    set_bit(bb->use, r->live);
+}
+
+static void write_reg(BB *bb, Reg *r, int pos) {
+  touch(r, pos);
+  if (r->live >= 0)
+    set_bit(bb->def, r->live);
+}
+
+// Computes which registers live across blocks are live on entry to
+// and exit from each block. in = use | (out & ~def), and out is the
+// union of the successors' in.
+static void liveness(Function *fn, int nwords) {
+  int nbbs = 0;
+  for (BB *bb = fn->bbs; bb; bb = bb->next)
+    nbbs++;
+
+  // Visiting blocks backwards makes this converge faster.
+  BB **order = malloc(sizeof(BB *) * (nbbs + 1));
+  int i = nbbs;
+  for (BB *bb = fn->bbs; bb; bb = bb->next)
+    order[--i] = bb;
+
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (i = 0; i < nbbs; i++) {
+      BB *bb = order[i];
+      for (int w = 0; w < nwords; w++) {
+        unsigned long out = 0;
+        for (int j = 0; j < bb->nsucc; j++)
+          out |= bb->succ[j]->in[w];
+        unsigned long in = bb->use[w] | (out & ~bb->def[w]);
+        if (in != bb->in[w] || out != bb->out[w])
+          changed = true;
+        bb->in[w] = in;
+        bb->out[w] = out;
+      }
+    }
+  }
+  free(order);
+}
+
+static void spill(Function *fn, Reg *r) {
+  r->rn = -1;
+  fn->stack_size += 8;
+  r->offset = fn->stack_size;
+}
+
+void alloc_regs(Function *fn) {
+  Reg **all = malloc(sizeof(Reg *) * (fn->nregs + 1));
+  Reg **live = malloc(sizeof(Reg *) * (fn->nregs + 1));
+  int nall = 0;
+  int nlive = 0;
+  for (Reg *r = fn->regs; r; r = r->next) {
+    r->live = -1;
+    if (r->var || r->global) {
+      r->live = nlive;
+      live[nlive++] = r;
+    }
+    r->start = INT_MAX;
+    r->end = -1;
+    r->rn = -1;
+    all[nall++] = r;
+  }
+
+  int nwords = (nlive + 63) / 64;
+  for (BB *bb = fn->bbs; bb; bb = bb->next) {
+    bb->def = ir_alloc(sizeof(long) * nwords);
+    bb->use = ir_alloc(sizeof(long) * nwords);
+    bb->in = ir_alloc(sizeof(long) * nwords);
+    bb->out = ir_alloc(sizeof(long) * nwords);
+  }
+
+  // Number instructions and find the positions of calls.
+  int ncalls = 0;
+  int pos = 0;
+  for (BB *bb = fn->bbs; bb; bb = bb->next)
+    for (IR *ir = bb->ir; ir; ir = ir->next, pos++)
+      if (ir->op == IR_CALL)
+        ncalls++;
+
+  int *calls = malloc(sizeof(int) * (ncalls + 1));
+  ncalls = 0;
+  pos = 0;
+  for (BB *bb = fn->bbs; bb; bb = bb->next) {
+    bb->start = pos;
+    for (IR *ir = bb->ir; ir; ir = ir->next, pos++) {
+      if (ir->a)
+        read_reg(bb, ir->a, pos);
+      if (ir->b)
+        read_reg(bb, ir->b, pos);
+      for (int i = 0; i < ir->nargs; i++)
+        read_reg(bb, ir->args[i], pos);
+      if (ir->dst)
+        write_reg(bb, ir->dst, pos);
+      if (ir->op == IR_CALL)
+        calls[ncalls++] = pos;
+    }
+    bb->end = pos - 1;
+  }
+
+  if (nlive) {
+    liveness(fn, nwords);
+    for (BB *bb = fn->bbs; bb; bb = bb->next) {
+      for (int i = 0; i < nlive; i++) {
+        if (!bb->in[i / 64] && !bb->out[i / 64]) {
+          i |= 63;
+          continue;
+        }
+        if (test_bit(bb->in, i))
+          touch(live[i], bb->start);
+        if (test_bit(bb->out, i))
+          touch(live[i], bb->end);
+      }
+    }
+  }
+
+  // An interval crosses a call if a call is strictly inside it.
+  // Calls are in ascending order, so find the first one after the
+  // start by binary search.
+  for (int i = 0; i < nall; i++) {
+    Reg *r = all[i];
+    int lo = 0, hi = ncalls;
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (calls[mid] <= r->start)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    r->crosses_call = lo < ncalls && calls[lo] < r->end;
+  }
+
+  // Sort intervals by their start with a counting sort over
+  // positions. Registers that never appear need no register.
+  int *count = calloc(pos + 1, sizeof(int));
+  for (int i = 0; i < nall; i++)
+    if (all[i]->end >= 0)
+      count[all[i]->start + 1]++;
+  for (int i = 0; i < pos; i++)
+    count[i + 1] += count[i];
+
+  Reg **sorted = malloc(sizeof(Reg *) * (nall + 1));
+  int n = 0;
+  for (int i = 0; i < nall; i++) {
+    if (all[i]->end >= 0) {
+      sorted[count[all[i]->start]++] = all[i];
+      n++;
+    }
+  }
+  free(count);
+  free(all);
+  all = sorted;
+  nall = n;
+
+  // Active intervals, indexed by the real register they hold
+  Reg *active[num_regs];
+  for (int i = 0; i < num_regs; i++)
+    active[i] = NULL;
+
+  fn->used_regs = 0;
+
+  for (int i = 0; i < nall; i++) {
+    Reg *r = all[i];
+
+    // Intervals that end where this one starts can give up their
+    // register: an instruction reads its operands before it writes
+    // its result.
+    for (int j = 0; j < num_regs; j++)
+      if (active[j] && active[j]->end <= r->start)
+        active[j] = NULL;
+
+    int first = r->crosses_call ? num_caller_saved : 0;
+    int rn = -1;
+    for (int j = first; j < num_regs; j++) {
+      if (!active[j]) {
+        rn = j;
+        break;
+      }
+    }
+
+    if (rn < 0) {
+      // Spill whichever of this interval and the ones holding a
+      // usable register ends last.
+      int victim = -1;
+      for (int j = first; j < num_regs; j++)
+        if (victim < 0 || active[j]->end > active[victim]->end)
+          victim = j;
+
+      if (active[victim]->end <= r->end) {
+        spill(fn, r);
+        continue;
+      }
+      spill(fn, active[victim]);
+      rn = victim;
+    }
+
+    r->rn = rn;
+    active[rn] = r;
+    fn->used_regs |= 1 << rn;
+  }
+
+  free(calls);
+  free(live);
+  free(all);
+}
@@ -0,0 +1,131 @@
+#include "9cc.h"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// A compile server keeps one process alive for many compilations,
+// so that batch builds do not pay for process startup for each file.
+//
+// Requests and responses are framed by a header line:
+//
+//   request:  <length>\n<source text>
+//   response: <status> <length>\n<assembly or error message>
+//
+// Status is 0 on success and 1 if the program had an error, in
+// which case the payload is the error message. Requests are read
+// until end of file.
+
+// Reads one request. Returns NULL at end of input.
+static char *read_request(FILE *in) {
+  size_t len;
+  if (fscanf(in, "%zu", &len) != 1)
+    return NULL;
+  if (getc(in) != '\n')
+    return NULL;
+
+  char *buf = malloc(len + 1);
+  if (!buf)
+    error("out of memory");
+  if (fread(buf, 1, len, in) != len) {
+    free(buf);
+    return NULL;
+  }
+  buf[len] = '\0';
+  return buf;
+}
+
+static void write_response(FILE *out, int status, char *buf, size_t len) {
+  fprintf(out, "%d %zu\n", status, len);
+  fwrite(buf, 1, len, out);
+  fflush(out);
+}
+
+// Compiles one request. Compiler errors are caught and returned to
+// the client instead of terminating the server.
+static void handle_request(FILE *out, char *src, int nthreads) {
+  char *msg = NULL;
+  size_t msglen = 0;
+  error_stream = open_memstream(&msg, &msglen);
+
+  jmp_buf jmp;
+  error_jmp = &jmp;
+
+  emit_open(-1);
+
+  if (setjmp(jmp) == 0) {
+    compile("-", src, nthreads);
+    size_t len;
+    char *text = emit_take(&len);
+    write_response(out, 0, text, len);
+  } else {
+    fclose(error_stream);
+    error_stream = NULL;
+    write_response(out, 1, msg, msglen);
+  }
+
+  if (error_stream)
+    fclose(error_stream);
+  error_stream = NULL;
+  error_jmp = NULL;
+  free(msg);
+
+  // Everything the compilation allocated goes away at once.
+  token = NULL;
+  user_input = NULL;
+  arena_reset();
+}
+
+static void serve(FILE *in, FILE *out, int nthreads) {
+  for (;;) {
+    char *src = read_request(in);
+    if (!src)
+      return;
+    handle_request(out, src, nthreads);
+    free(src);
+  }
+}
+
+static void serve_socket(char *path, int nthreads) {
+  int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (sock < 0)
+    error("socket: %s", strerror(errno));
+
+  struct sockaddr_un addr = {.sun_family = AF_UNIX};
+  if (strlen(path) >= sizeof(addr.sun_path))
+    error("socket path too long: %s", path);
+  strcpy(addr.sun_path, path);
+  unlink(path);
+
+  if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+    error("bind %s: %s", path, strerror(errno));
+  if (listen(sock, 16) < 0)
+    error("listen: %s", strerror(errno));
+
+  // Clients are served one at a time. Each connection may send
+  // any number of requests.
+  for (;;) {
+    int fd = accept(sock, NULL, NULL);
+    if (fd < 0) {
+      if (errno == EINTR)
+        continue;
+      error("accept: %s", strerror(errno));
+    }
+
+    FILE *in = fdopen(fd, "r");
+    FILE *out = fdopen(dup(fd), "w");
+    if (!in || !out)
+      error("fdopen: %s", strerror(errno));
+    serve(in, out, nthreads);
+    fclose(in);
+    fclose(out);
+  }
+}
+
+// Serves compile requests on stdin/stdout, or on a Unix domain
+// socket at `socket_path` if it is given.
+void run_server(char *socket_path, int nthreads) {
+  if (socket_path)
+    serve_socket(socket_path, nthreads);
+  else
+    serve(stdin, stdout, nthreads);
+}
@@ -1,5 +1,11 @@
 #!/bin/bash
-cat <<EOF | gcc -xc -c -o tmp2.o -
+
+# Functions for test programs to call. They are built outside the
+# source tree, where the Makefile would pick up a .c file.
+lib=$(mktemp -d) || exit
+trap 'rm -rf "$lib"' EXIT
+
+cat <<EOF > "$lib/lib.c"
 int ret3() { return 3; }
 int ret5() { return 5; }
 int add(int x, int y) { return x+y; }
@@ -7,21 +13,44 @@ int sub(int x, int y) { return x-y; }
 int add6(int a, int b, int c, int d, int e, int f) {
   return a+b+c+d+e+f;
 }
+int aligned() { return ((long)__builtin_frame_address(0) & 15) == 0; }
 EOF
+gcc -c -o "$lib/lib.o" "$lib/lib.c" || exit
+gcc -shared -fPIC -o "$lib/lib.so" "$lib/lib.c" || exit
 
 assert() {
   expected="$1"
   input="$2"
 
-  ./9cc "$input" > tmp.s
-  gcc -o tmp tmp.s tmp2.o
+  echo "$input" | ./9cc -o tmp.s - || exit
+  gcc -o tmp tmp.s "$lib/lib.o"
   ./tmp
   actual="$?"
 
+  if [ "$actual" != "$expected" ]; then
+    echo "$input => $expected expected, but got $actual"
+    exit 1
+  fi
+
+  # The same program encoded by 9cc itself
+  echo "$input" | ./9cc -c -o tmp.o - || exit
+  gcc -o tmp tmp.o "$lib/lib.o"
+  ./tmp
+  actual="$?"
+
+  if [ "$actual" != "$expected" ]; then
+    echo "$input => $expected expected, but got $actual (-c)"
+    exit 1
+  fi
+
+  # The same program run in-process
+  echo "$input" | LD_PRELOAD="$lib/lib.so" ./9cc --run -
+  actual="$?"
+
   if [ "$actual" = "$expected" ]; then
     echo "$input => $actual"
   else
-    echo "$input => $expected expected, but got $actual"
+    echo "$input => $expected expected, but got $actual (--run)"
     exit 1
   fi
 }
@@ -36,6 +65,16 @@ assert 4 'int main() { return (3+5)/2; }'
 assert 10 'int main() { return -10+20; }'
 assert 10 'int main() { return - -10; }'
 assert 10 'int main() { return - - +10; }'
+assert 253 'int main() { return -7/2; }'
+assert 4 'int main() { int x=4; return - -x; }'
+assert 7 'int main() { int x=3; return (x+0)*1 + 0*x + 4/1 - 0; }'
+assert 5 'int main() { int x=0; (x=5)*0; return x; }'
+assert 2 'int main() { return ret3()*0 + 2; }'
+assert 14 'int main() { int x=100; return x/7; }'
+assert 242 'int main() { int x=0-100; return x/7; }'
+assert 255 'int main() { int x=0-7; return x/4; }'
+assert 4 'int main() { int x=0-9; return x/(0-2); }'
+assert 91 'int main() { int x=7; return x*5 + x*8; }'
 
 assert 0 'int main() { return 0==1; }'
 assert 1 'int main() { return 42==42; }'
@@ -75,23 +114,44 @@ assert 2 'int main() { if (2-1) return 2; return 3; }'
 
 assert 3 'int main() { {1; {2;} return 3;} }'
 
+assert 2 'int main() { int x=2; { int x=3; } return x; }'
+assert 3 'int main() { int x=2; { int x=3; return x; } }'
+assert 3 'int main() { int x=2; { x=3; } return x; }'
+assert 5 'int main() { int x=2; { int y=3; { int x=y; x=x+2; return x; } } }'
+
 assert 10 'int main() { int i=0; i=0; while(i<10) i=i+1; return i; }'
 assert 55 'int main() { int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} return j; }'
 
 assert 55 'int main() { int i=0; int j=0; for (i=0; i<=10; i=i+1) j=i+j; return j; }'
 assert 3 'int main() { for (;;) return 3; return 5; }'
+assert 3 'int main() { int i=0; while (i!=3) i=i+1; return i; }'
+assert 4 'int main() { int i=0; for (;i<=3;) i=i+1; return i; }'
+assert 2 'int main() { int x=3; if (x>=3) return 2; return 1; }'
+assert 1 'int main() { int x=3; if (x>3) return 2; return 1; }'
+assert 6 'int main() { int x=3; if (x==3) x=x*2; return x; }'
 
 assert 3 'int main() { return ret3(); }'
 assert 5 'int main() { return ret5(); }'
 assert 8 'int main() { return add(3, 5); }'
 assert 2 'int main() { return sub(5, 3); }'
 assert 21 'int main() { return add6(1,2,3,4,5,6); }'
+assert 1 'int main() { return aligned(); }'
+assert 1 'int main() { int x; int *p=&x; int y; return aligned(); }'
+assert 1 'int f(int x) { int y=x+1; return aligned()+y-y; } int main() { return f(1); }'
 
 assert 32 'int main() { return ret32(); } int ret32() { return 32; }'
 assert 7 'int main() { return add2(3,4); } int add2(int x, int y) { return x+y; }'
 assert 1 'int main() { return sub2(4,3); } int sub2(int x, int y) { return x-y; }'
 assert 55 'int main() { return fib(9); } int fib(int x) { if (x<=1) return 1; return fib(x-1) + fib(x-2); }'
 
+assert 45 'int main() { return 1+(2+(3+(4+(5+(6+(7+(8+9))))))); }'
+assert 6 'int main() { return 100/(2+(3+(4+(5+(6+(7+(8-(40/(1+1))))))))); }'
+assert 35 'int main() { return 1+(2+(3+(4+(5+(6+(7+add(ret3(), 4))))))); }'
+assert 35 'int main() { int x; int *p=&x; return 1+(2+(3+(4+(5+(6+(*p=7))))))+x; }'
+assert 28 'int main() { int a=1; int b=2; int c=3; int d=4; int e=5; int f=6; int i; for (i=0; i<3; i=i+1) a=a+add(b,c); return a+d+e+f-i; }'
+
+assert 67 'int main() { int a=1; int b=2; int c=3; int d=4; int e=5; int f=6; int g=7; int h=8; int i; int j=10; for (i=0; i<3; i=i+1) { a=a+add(b,c); j=j+i; } return a+b+c+d+e+f+g+h+i+j; }'
+
 assert 3 'int main() { int x=3; return *&x; }'
 assert 3 'int main() { int x=3; int *y=&x; int **z=&y; return **z; }'
 assert 5 'int main() { int x=3; int y=5; return *(&x+1); }'
@@ -105,4 +165,232 @@ assert 7 'int main() { int x=3; int y=5; *(&x+1)=7; return y; }'
 assert 7 'int main() { int x=3; int y=5; *(&y-1)=7; return x; }'
 assert 8 'int main() { int x=3; int y=5; return foo(&x, y); } int foo(int *x, int y) { return *x + y; }'
 
+assert 44 'int main() { char c=300; return c; }'
+assert 44 'int main() { char c=300; char *p=&c; return *p; }'
+assert 1 'int main() { short s=70000; return s==4464; }'
+assert 1 'int main() { int i=2147483647; i=i+1; return i<0; }'
+assert 1 'int main() { int i; int *p=&i; *p=2147483647; i=i+1; return i<0; }'
+assert 1 'int main() { long l=2147483647; l=l+1; return l>0; }'
+assert 5 'int main() { long x=3; long y=5; return *(&x+1); }'
+assert 5 'int main() { char c; return (&c+5)-&c; }'
+assert 3 'int main() { short s; return (&s+3)-&s; }'
+assert 44 'int main() { return f(300); } int f(char c) { return c; }'
+assert 44 'int main() { return f(300); } char f(int x) { return x; }'
+assert 1 'int main() { return sub(3, 5) < 0; }'
+
+assert 3 'int main() { int x[3]; *x=3; *(x+1)=4; *(x+2)=5; return *x; }'
+assert 4 'int main() { int x[3]; *x=3; *(x+1)=4; *(x+2)=5; return *(x+1); }'
+assert 5 'int main() { int x[3]; *x=3; *(x+1)=4; *(x+2)=5; return *(x+2); }'
+assert 3 'int main() { int x[2]; int *y=&x; *y=3; return *x; }'
+assert 5 'int main() { int x[2][3]; int *y=x; *(y+5)=5; return *(*(x+1)+2); }'
+assert 5 'int main() { int x[2][3]; int *y=x; y[5]=5; return x[1][2]; }'
+assert 4 'int main() { int x[3]; x[0]=3; x[1]=4; x[2]=5; return 1[x]; }'
+assert 2 'int main() { long x[5]; return &x[4] - &x[2]; }'
+assert 45 'int main() { int a[10]; int i; int s=0; for (i=0; i<10; i=i+1) a[i]=i; for (i=0; i<10; i=i+1) s=s+a[i]; return s; }'
+assert 7 'int main() { int a[3]; a[2]=7; return f(a); } int f(int x[3]) { return x[2]; }'
+assert 4 'int main() { int x; return sizeof(x); }'
+assert 8 'int main() { int *x; return sizeof x; }'
+assert 48 'int main() { int x[3][4]; return sizeof(x); }'
+assert 16 'int main() { int x[3][4]; return sizeof(x[0]); }'
+assert 3 'int main() { char x[3]; return sizeof(x); }'
+assert 8 'int main() { char x[3]; return sizeof(x+1); }'
+assert 2 'int main() { short x; return sizeof(x+x) - sizeof(x); }'
+
+assert 60 'int main() { int a=3; int b=4; int s=0; int i; for (i=0; i<5; i=i+1) s=s+a*b; return s; }'
+assert 0 'int main() { int a=3; int b=4; int s=0; int i; for (i=0; i<0; i=i+1) s=s+a*b; return s; }'
+assert 108 'int main() { int n=3; int s=0; int i; int j; for (i=0; i<n; i=i+1) for (j=0; j<n; j=j+1) s=s+n*n+i*n; return s; }'
+assert 20 'int main() { int x=1; int *p=&x; int s=0; int i; for (i=0; i<5; i=i+1) { *p=*p+1; s=s+x; } return s; }'
+assert 10 'int main() { int x=1; int s=0; int i; for (i=0; i<4; i=i+1) { s=s+x; inc(&x); } return s; } int inc(int *p) { *p=*p+1; return 0; }'
+assert 55 'int main() { int i=0; int n=0; while ((i=i+1) < 10) n=n+i; return n+i; }'
+assert 9 'int main() { int i=9; while (i<3) i=i+1; return i; }'
+assert 7 'int main() { int i; for (i=0;; i=i+1) if (i==7) return i; return 0; }'
+assert 10 'int main() { int a[2]; int s=0; int i; a[0]=1; for (i=0; i<4; i=i+1) { s=s+a[0]; a[0]=a[0]+1; } return s; }'
+
+# Locals are packed by size and alignment.
+echo 'int main() { char a; char b; char c; char d; char *p=&a; return 0; }' |
+  ./9cc -o tmp.s - || exit
+if ! grep -q 'sub rsp, 16$' tmp.s; then
+  echo "frame layout failed"
+  exit 1
+fi
+
+# A function without a frame does not adjust RSP.
+echo 'int main() { return 3; }' | ./9cc -o tmp.s - || exit
+if grep -q 'sub rsp' tmp.s; then
+  echo "empty frame was allocated"
+  exit 1
+fi
+
+# Indexing an array does not move other variables into memory.
+echo 'int main() { int a[4]; int i; for (i=0; i<4; i=i+1) a[i]=i; return a[3]; }' |
+  ./9cc -dump-ir -o /dev/null - 2> tmp.out || exit
+if ! grep -q '; .*i=v' tmp.out; then
+  echo "array indexing forced variables into memory"
+  exit 1
+fi
+
+# Code generation must not depend on the number of threads.
+prog='int f(int x) { if (x) return 1; return 0; } int g(int x) { while (x) x=x-1; return x; } int main() { return f(1)+g(3); }'
+echo "$prog" | ./9cc -j 1 -o tmp1.s - || exit
+echo "$prog" | ./9cc -j 3 -o tmp3.s - || exit
+if ! cmp -s tmp1.s tmp3.s; then
+  echo "output differs between -j 1 and -j 3"
+  exit 1
+fi
+
+# Functions found in the cache must produce the same output.
+rm -rf tmp-cache
+prog='int f(int x) { return x*2; } int main() { return f(3); }'
+echo "$prog" | ./9cc -o tmp1.s - || exit
+echo "$prog" | ./9cc -fcache-dir=tmp-cache -o tmp2.s - || exit
+echo "$prog" | ./9cc -fcache-dir=tmp-cache -o tmp3.s - || exit
+if ! cmp -s tmp1.s tmp2.s || ! cmp -s tmp1.s tmp3.s; then
+  echo "output differs with -fcache-dir"
+  exit 1
+fi
+prog='int f(int x) { return x*3; } int main() { return f(3); }'
+echo "$prog" | ./9cc -fcache-dir=tmp-cache -o tmp.s - || exit
+gcc -o tmp tmp.s && ./tmp
+if [ "$?" != 9 ]; then
+  echo "stale function taken from the cache"
+  exit 1
+fi
+
+# Machine code is cached apart from assembly.
+echo "$prog" | ./9cc -fcache-dir=tmp-cache -c -o tmp.o - || exit
+echo "$prog" | ./9cc -fcache-dir=tmp-cache -c -o tmp1.o - || exit
+gcc -o tmp tmp1.o && ./tmp
+if [ "$?" != 9 ] || ! cmp -s tmp.o tmp1.o; then
+  echo "object code differs with -fcache-dir"
+  exit 1
+fi
+
+# --run resolves calls against the libraries 9cc has loaded.
+echo 'int main() { return abs(0-7); }' | ./9cc --run -
+if [ "$?" != 7 ]; then
+  echo "--run failed to call a host function"
+  exit 1
+fi
+if echo 'int main() { return nosuch(); }' | ./9cc --run - 2>/dev/null; then
+  echo "--run accepted an undefined function"
+  exit 1
+fi
+
+# --run takes machine code from the cache.
+prog='int sq(int x) { return x*x; } int main() { return sq(5)+sq(2); }'
+for i in 1 2; do
+  echo "$prog" | ./9cc -fcache-dir=tmp-cache --run -
+  if [ "$?" != 29 ]; then
+    echo "--run failed with -fcache-dir"
+    exit 1
+  fi
+done
+
+# -dump-ir prints each function's basic blocks.
+echo 'int main() { int i=0; while (i<3) i=i+1; return i; }' |
+  ./9cc -dump-ir -o /dev/null - 2> tmp.out || exit
+if ! grep -q '^main: after gen_ir' tmp.out || ! grep -q '^  br v' tmp.out; then
+  echo "-dump-ir failed"
+  exit 1
+fi
+
+# Constant subtrees are folded before code generation.
+echo 'int main() { return 5*(9-6); }' | ./9cc -dump-ir -o /dev/null - 2> tmp.out || exit
+if ! grep -q '= 15$' tmp.out || grep -q 'mul' tmp.out; then
+  echo "constant folding failed"
+  exit 1
+fi
+
+# Multiplications and divisions by constants are strength-reduced.
+echo 'int main() { int x=100; int *p=&x; return x/7 + x*8 + ((p+3)-p); }' |
+  ./9cc -dump-ir -o /dev/null - 2> tmp.out || exit
+if sed -n '/after reduce_strength/,$p' tmp.out | grep -q ' = \(mul\|div\) ' ||
+   ! grep -q ' = mulhi' tmp.out || ! grep -q ' = lea' tmp.out; then
+  echo "strength reduction failed"
+  exit 1
+fi
+
+# Invariant expressions are computed once, before their loop.
+echo 'int main() { int a=3; int b=4; int s=0; int i; for (i=0; i<5; i=i+1) s=s+a*b; return s; }' |
+  ./9cc -dump-ir -o /dev/null - 2> tmp.out || exit
+ir=$(sed -n '/after hoist_invariants/,$p' tmp.out)
+if ! grep -q ' = mul ' <<< "$ir" ||
+   ! awk '/^\.L/ { mul = 0 } / = mul / { mul = 1 } / br / && mul { exit 1 }' <<< "$ir"; then
+  echo "loop-invariant code motion failed"
+  exit 1
+fi
+
+# Comparisons in conditions branch on the flags directly.
+echo 'int main() { int i=0; while (i<10) i=i+1; return i; }' |
+  ./9cc -o tmp.s - || exit
+if grep -q 'set\|movzb' tmp.s || ! grep -q 'jge' tmp.s; then
+  echo "compare-and-branch fusion failed"
+  exit 1
+fi
+
+# Loops test their condition at the bottom, so an iteration takes
+# only one branch.
+echo 'int main() { int i=0; while (i<10) i=i+1; return i; }' |
+  ./9cc -o tmp.s - || exit
+if grep -q 'jmp' tmp.s || [ "$(grep -c '^  j' tmp.s)" != 2 ]; then
+  echo "loop rotation failed"
+  exit 1
+fi
+
+# The peephole optimizer removes instructions without changing
+# what the program does.
+prog='int main() { int x=3; int *p=&x; int i; for (i=0; i<4; i=i+1) *p=*p+i; return x; }'
+echo "$prog" | ./9cc -ftime-report -o tmp.s - 2> tmp.out || exit
+echo "$prog" | ./9cc -fno-peephole -o tmp1.s - || exit
+gcc -o tmp tmp.s && ./tmp
+actual="$?"
+gcc -o tmp tmp1.s && ./tmp
+if [ "$?" != 9 ] || [ "$actual" != 9 ] ||
+   ! grep -q '[1-9][0-9]* eliminated by peephole' tmp.out ||
+   [ "$(wc -l < tmp.s)" -ge "$(wc -l < tmp1.s)" ]; then
+  echo "peephole optimization failed"
+  exit 1
+fi
+
+# -ftime-report=json escapes the file name.
+src="$lib/a\"b\\c.c"
+echo 'int main() { return 0; }' > "$src"
+./9cc -ftime-report=json -o /dev/null "$src" 2> tmp.out || exit
+if ! grep -qF "{\"file\": \"$lib/a\\\"b\\\\c.c\", " tmp.out; then
+  echo "-ftime-report=json failed"
+  exit 1
+fi
+
+# A compile server must keep going after a failed request.
+request() {
+  printf '%s\n%s' "${#1}" "$1"
+}
+{
+  request 'int main() { return 3; }'
+  request 'int main() { return x; }'
+  request 'int main() { int x=4; int *y=&x; return *y; }'
+  request 'int main() { int x=4; int *y=&x; int **z=&y; return **z; }'
+} | ./9cc --server > tmp.out || exit
+if [ "$(grep -c '^[01] [0-9]*$' tmp.out)" != 4 ] || ! grep -q '^1 ' tmp.out ||
+   ! grep -q 'undefined variable' tmp.out; then
+  echo "server mode failed"
+  exit 1
+fi
+
+# Errors are found before functions are handed to codegen threads.
+big="int big() { int s=0; $(printf 's=s+1; %.0s' $(seq 2000)) return s; }"
+bad='int bad() { return g(1,2,3,4,5,6,7); }'
+{
+  for i in 1 2 3 4 5; do
+    request "$big
+$bad $bad $bad $bad"
+    request 'int main() { return 3; }'
+  done
+} | ./9cc --server -j4 > tmp.out || exit
+if [ "$(grep -c '^[01] [0-9]*$' tmp.out)" != 10 ] ||
+   ! grep -q 'too many arguments' tmp.out; then
+  echo "server mode with threads failed"
+  exit 1
+fi
+
 echo OK
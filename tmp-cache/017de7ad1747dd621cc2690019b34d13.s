@@ -0,0 +1,14 @@
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  mov rdi, 3
+  mov rax, 0
+  call f
+  movsxd r10, eax
+  movsxd r10, r10d
+  mov rax, r10
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,13 @@
+.global f
+f:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  movsxd r10, edi
+  lea r10, [r10+r10*2]
+  movsxd r10, r10d
+  mov rax, r10
+.L.return.f:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,36 @@
+.intel_syntax noprefix
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-24], rbx
+  mov DWORD PTR [rbp-16], 3
+  lea r11, [rbp-16]
+  mov [rbp-8], r11
+  mov DWORD PTR [rbp-12], 0
+  movsxd r10, DWORD PTR [rbp-12]
+  cmp r10, 4
+  jge .L.main.3
+.L.main.2:
+  mov r10, [rbp-8]
+  mov r11, [rbp-8]
+  movsxd r11, DWORD PTR [r11]
+  movsxd rbx, DWORD PTR [rbp-12]
+  add r11, rbx
+  mov [r10], r11d
+  movsxd r11, DWORD PTR [rbp-12]
+  add r11, 1
+  mov [rbp-12], r11d
+  movsxd r10, DWORD PTR [rbp-12]
+  cmp r10, 4
+  jl  .L.main.2
+.L.main.3:
+  movsxd r10, DWORD PTR [rbp-16]
+  movsxd r10, r10d
+  mov rax, r10
+.L.return.main:
+  mov rbx, [rbp-24]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,52 @@
+.intel_syntax noprefix
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-24], rbx
+  lea r10, [rbp-16]
+  mov r11, 3
+  mov [r10], r11d
+  lea r10, [rbp-8]
+  lea r11, [rbp-16]
+  mov [r10], r11
+  lea r10, [rbp-12]
+  mov r11, 0
+  mov [r10], r11d
+  lea r10, [rbp-12]
+  movsxd r10, DWORD PTR [r10]
+  mov r11, 4
+  cmp r10, r11
+  jge .L.main.3
+.L.main.2:
+  lea r10, [rbp-8]
+  mov r10, [r10]
+  lea r11, [rbp-8]
+  mov r11, [r11]
+  movsxd r11, DWORD PTR [r11]
+  lea rbx, [rbp-12]
+  movsxd rbx, DWORD PTR [rbx]
+  add r11, rbx
+  mov [r10], r11d
+  lea r10, [rbp-12]
+  lea r11, [rbp-12]
+  movsxd r11, DWORD PTR [r11]
+  mov rbx, 1
+  add r11, rbx
+  mov [r10], r11d
+  lea r10, [rbp-12]
+  movsxd r10, DWORD PTR [r10]
+  mov r11, 4
+  cmp r10, r11
+  jl  .L.main.2
+.L.main.3:
+  lea r10, [rbp-16]
+  movsxd r10, DWORD PTR [r10]
+  movsxd r10, r10d
+  mov rax, r10
+.L.return.main:
+  mov rbx, [rbp-24]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,28 @@
+.intel_syntax noprefix
+.global f
+f:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  movsxd r10, edi
+  shl r10, 1
+  movsxd r10, r10d
+  mov rax, r10
+.L.return.f:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  mov rdi, 3
+  mov rax, 0
+  call f
+  movsxd r10, eax
+  movsxd r10, r10d
+  mov rax, r10
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -1,26 +1,73 @@
 #include "9cc.h"
 
+char *filename;
 char *user_input;
 Token *token;
 
+// Where error messages are written. Defaults to stderr.
+FILE *error_stream;
+
+// If set, reporting an error jumps here instead of exiting, so that
+// a long-running process can go on with the next compilation.
+jmp_buf *error_jmp;
+
+static FILE *error_file(void) {
+  return error_stream ? error_stream : stderr;
+}
+
+static noreturn void fail(void) {
+  if (error_jmp)
+    longjmp(*error_jmp, 1);
+  exit(1);
+}
+
 // Reports an error and exit.
 void error(char *fmt, ...) {
   va_list ap;
   va_start(ap, fmt);
-  vfprintf(stderr, fmt, ap);
-  fprintf(stderr, "\n");
-  exit(1);
+  vfprintf(error_file(), fmt, ap);
+  fprintf(error_file(), "\n");
+  fail();
 }
 
-// Reports an error location and exit.
-static void verror_at(char *loc, char *fmt, va_list ap) {
-  int pos = loc - user_input;
-  fprintf(stderr, "%s\n", user_input);
-  fprintf(stderr, "%*s", pos, ""); // print pos spaces.
-  fprintf(stderr, "^ ");
-  vfprintf(stderr, fmt, ap);
-  fprintf(stderr, "\n");
-  exit(1);
+// Reports that memory ran out and aborts. Allocations also fail on
+// codegen threads, where error() cannot unwind to its caller.
+void out_of_memory(void) {
+  fprintf(stderr, "out of memory\n");
+  abort();
+}
+
+// Reports an error message in the following format and exit.
+//
+// foo.c:10: x = y + 1;
+//               ^ <error message here>
+static noreturn void verror_at(char *loc, char *fmt, va_list ap) {
+  // Find a line containing `loc`.
+  char *line = loc;
+  while (user_input < line && line[-1] != '\n')
+    line--;
+
+  char *end = loc;
+  while (*end && *end != '\n')
+    end++;
+
+  // Get a line number.
+  int line_num = 1;
+  for (char *p = user_input; p < line; p++)
+    if (*p == '\n')
+      line_num++;
+
+  // Print out the line.
+  int indent = fprintf(error_file(), "%s:%d: ", filename, line_num);
+  fprintf(error_file(), "%.*s\n", (int)(end - line), line);
+
+  // Show the error message.
+  int pos = loc - line + indent;
+  fprintf(error_file(), "%*s", pos, ""); // print pos spaces.
+  fprintf(error_file(), "^ ");
+  vfprintf(error_file(), fmt, ap);
+  fprintf(error_file(), "\n");
+  fail();
 }
 
 // Reports an error location and exit.
@@ -37,20 +84,31 @@ void error_tok(Token *tok, char *fmt, ...) {
   verror_at(tok->str, fmt, ap);
 }
 
-// Consumes the current token if it matches `op`.
-Token *consume(char *op) {
-  if (token->kind != TK_RESERVED || strlen(op) != token->len ||
-      strncmp(token->str, op, token->len))
+static char *reserved_str[] = {
+  [KW_RETURN] = "return", [KW_IF] = "if", [KW_ELSE] = "else",
+  [KW_WHILE] = "while", [KW_FOR] = "for", [KW_SIZEOF] = "sizeof",
+  [KW_CHAR] = "char", [KW_SHORT] = "short", [KW_INT] = "int",
+  [KW_LONG] = "long",
+  [PU_EQ] = "==", [PU_NE] = "!=", [PU_LE] = "<=", [PU_GE] = ">=",
+  [PU_LT] = "<", [PU_GT] = ">", [PU_ASSIGN] = "=", [PU_PLUS] = "+",
+  [PU_MINUS] = "-", [PU_STAR] = "*", [PU_SLASH] = "/", [PU_AMP] = "&",
+  [PU_SEMI] = ";", [PU_COMMA] = ",", [PU_LPAREN] = "(", [PU_RPAREN] = ")",
+  [PU_LBRACE] = "{", [PU_RBRACE] = "}", [PU_LBRACKET] = "[",
+  [PU_RBRACKET] = "]",
+};
+
+// Consumes the current token if it is a given keyword or punctuator.
+Token *consume(Reserved id) {
+  if (token->kind != TK_RESERVED || token->id != id)
     return NULL;
   Token *t = token;
   token = token->next;
   return t;
 }
 
-// Returns true if the current token matches a given string.
-Token *peek(char *s) {
-  if (token->kind != TK_RESERVED || strlen(s) != token->len ||
-      strncmp(token->str, s, token->len))
+// Returns the current token if it is a given keyword or punctuator.
+Token *peek(Reserved id) {
+  if (token->kind != TK_RESERVED || token->id != id)
     return NULL;
   return token;
 }
@@ -64,10 +122,10 @@ Token *consume_ident(void) {
   return t;
 }
 
-// Ensure that the current token is a given string
-void expect(char *s) {
-  if (!peek(s))
-    error_tok(token, "expected \"%s\"", s);
+// Ensure that the current token is a given keyword or punctuator.
+void expect(Reserved id) {
+  if (!peek(id))
+    error_tok(token, "expected \"%s\"", reserved_str[id]);
   token = token->next;
 }
 
@@ -81,7 +139,7 @@ long expect_number(void) {
 }
 
 char *duplicate(char *str, int len) {
-  char *buffer = malloc(len + 1);
+  char *buffer = arena_alloc(len + 1);
   memcpy(buffer, str, len);
   buffer[len] = '\0';
 
@@ -92,7 +150,7 @@ char *duplicate(char *str, int len) {
 char *expect_ident(void) {
   if (token->kind != TK_IDENT)
     error_tok(token, "expected an identifier");
-  char *s = duplicate(token->str, token->len);
+  char *s = token->name;
   token = token->next;
   return s;
 }
@@ -101,9 +159,86 @@ bool at_eof(void) {
   return token->kind == TK_EOF;
 }
 
+// Identifier strings are interned, so that each distinct name is
+// stored once and two names can be compared by pointer. The table
+// uses open addressing and is doubled when it gets half full.
+// Keywords are entered into the same table up front, so telling
+// them apart from identifiers costs a single lookup.
+typedef struct {
+  char *name;
+  int len;
+  unsigned hash;
+  int keyword; // Reserved ID + 1 if this is a keyword, or 0
+} InternEntry;
+
+static InternEntry *interns;
+static int interns_cap;
+static int interns_used;
+
+static unsigned hash_string(char *str, int len) {
+  // FNV-1a
+  unsigned hash = 2166136261u;
+  for (int i = 0; i < len; i++)
+    hash = (hash ^ (unsigned char)str[i]) * 16777619u;
+  return hash;
+}
+
+static void grow_interns(void) {
+  InternEntry *old = interns;
+  int oldcap = interns_cap;
+
+  interns_cap = oldcap ? oldcap * 2 : 256;
+  interns = arena_alloc(sizeof(InternEntry) * interns_cap);
+
+  for (int i = 0; i < oldcap; i++) {
+    if (!old[i].name)
+      continue;
+    int j = old[i].hash & (interns_cap - 1);
+    while (interns[j].name)
+      j = (j + 1) & (interns_cap - 1);
+    interns[j] = old[i];
+  }
+}
+
+static InternEntry *intern_entry(char *str, int len) {
+  if (interns_used * 2 >= interns_cap)
+    grow_interns();
+
+  unsigned hash = hash_string(str, len);
+  int i = hash & (interns_cap - 1);
+
+  for (; interns[i].name; i = (i + 1) & (interns_cap - 1)) {
+    InternEntry *e = &interns[i];
+    if (e->hash == hash && e->len == len && !memcmp(e->name, str, len))
+      return e;
+  }
+
+  interns[i].name = duplicate(str, len);
+  interns[i].len = len;
+  interns[i].hash = hash;
+  interns_used++;
+  return &interns[i];
+}
+
+// Returns the canonical copy of a given name.
+char *intern(char *str, int len) {
+  return intern_entry(str, len)->name;
+}
+
+static void init_interns(void) {
+  interns = NULL;
+  interns_cap = 0;
+  interns_used = 0;
+
+  for (Reserved id = KW_RETURN; id <= KW_LONG; id++) {
+    char *kw = reserved_str[id];
+    intern_entry(kw, strlen(kw))->keyword = id + 1;
+  }
+}
+
 // Create a new token and add it as the next token of `cur`.
 static Token *new_token(TokenKind kind, Token *cur, char *str, int len) {
-  Token *tok = calloc(1, sizeof(Token));
+  Token *tok = arena_alloc(sizeof(Token));
   tok->kind = kind;
   tok->str = str;
   tok->len = len;
@@ -111,10 +246,6 @@ static Token *new_token(TokenKind kind, Token *cur, char *str, int len) {
   return tok;
 }
 
-static bool startswith(char *p, char *q) {
-  return strncmp(p, q, strlen(q)) == 0;
-}
-
 static bool is_alpha(char c) {
   return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_';
 }
@@ -123,24 +254,39 @@ static bool is_alnum(char c) {
   return is_alpha(c) || ('0' <= c && c <= '9');
 }
 
-static char *starts_with_reserved(char *p) {
-  // Keyword
-  static char *kw[] = {"return", "if", "else", "while", "for", "int"};
-
-  for (int i = 0; i < sizeof(kw) / sizeof(*kw); i++) {
-    int len = strlen(kw[i]);
-    if (startswith(p, kw[i]) && !is_alnum(p[len]))
-      return kw[i];
+// Reads a punctuator at `p` and returns its length, or 0 if there
+// is none.
+static int read_punct(char *p, Reserved *id) {
+  switch (*p) {
+  case '=':
+    *id = (p[1] == '=') ? PU_EQ : PU_ASSIGN;
+    return (p[1] == '=') ? 2 : 1;
+  case '!':
+    if (p[1] != '=')
+      return 0;
+    *id = PU_NE;
+    return 2;
+  case '<':
+    *id = (p[1] == '=') ? PU_LE : PU_LT;
+    return (p[1] == '=') ? 2 : 1;
+  case '>':
+    *id = (p[1] == '=') ? PU_GE : PU_GT;
+    return (p[1] == '=') ? 2 : 1;
+  case '+': *id = PU_PLUS; return 1;
+  case '-': *id = PU_MINUS; return 1;
+  case '*': *id = PU_STAR; return 1;
+  case '/': *id = PU_SLASH; return 1;
+  case '&': *id = PU_AMP; return 1;
+  case ';': *id = PU_SEMI; return 1;
+  case ',': *id = PU_COMMA; return 1;
+  case '(': *id = PU_LPAREN; return 1;
+  case ')': *id = PU_RPAREN; return 1;
+  case '{': *id = PU_LBRACE; return 1;
+  case '}': *id = PU_RBRACE; return 1;
+  case '[': *id = PU_LBRACKET; return 1;
+  case ']': *id = PU_RBRACKET; return 1;
   }
-
-  // Multi-letter punctuator
-  static char *ops[] = {"==", "!=", "<=", ">="};
-
-  for (int i = 0; i < sizeof(ops) / sizeof(*ops); i++)
-    if (startswith(p, ops[i]))
-      return ops[i];
-
-  return NULL;
+  return 0;
 }
 
 // Tokenize `user_input` and returns new tokens.
@@ -149,6 +295,8 @@ Token *tokenize(void) {
   Token head = {};
   Token *cur = &head;
 
+  init_interns();
+
   while (*p) {
     // Skip whitespace characters.
     if (isspace(*p)) {
@@ -156,27 +304,29 @@ Token *tokenize(void) {
       continue;
     }
 
-    // Keywords or multi-letter punctuators
-    char *kw = starts_with_reserved(p);
-    if (kw) {
-      int len = strlen(kw);
-      cur = new_token(TK_RESERVED, cur, p, len);
-      p += len;
-      continue;
-    }
-
-    // Identifier
+    // Identifier or keyword
     if (is_alpha(*p)) {
       char *q = p++;
       while (is_alnum(*p))
         p++;
-      cur = new_token(TK_IDENT, cur, q, p - q);
+      InternEntry *e = intern_entry(q, p - q);
+      if (e->keyword) {
+        cur = new_token(TK_RESERVED, cur, q, p - q);
+        cur->id = e->keyword - 1;
+      } else {
+        cur = new_token(TK_IDENT, cur, q, p - q);
+        cur->name = e->name;
+      }
       continue;
     }
 
-    // Single-letter punctuators
-    if (ispunct(*p)) {
-      cur = new_token(TK_RESERVED, cur, p++, 1);
+    // Punctuators
+    Reserved id;
+    int len = read_punct(p, &id);
+    if (len) {
+      cur = new_token(TK_RESERVED, cur, p, len);
+      cur->id = id;
+      p += len;
       continue;
     }
 
@@ -1,62 +1,151 @@
 #include "9cc.h"
 
-Type *int_type = &(Type){ TY_INT };
+Type *char_type = &(Type){ TY_CHAR, 1, 1 };
+Type *short_type = &(Type){ TY_SHORT, 2, 2 };
+Type *int_type = &(Type){ TY_INT, 4, 4 };
+Type *long_type = &(Type){ TY_LONG, 8, 8 };
+
+// Number of types created by the current compilation
+long type_count;
+
+// Derived types are allocated from the arena, so caches on the
+// builtin types must be cleared before each compilation.
+void init_types(void) {
+  char_type->pointer = NULL;
+  short_type->pointer = NULL;
+  int_type->pointer = NULL;
+  long_type->pointer = NULL;
+  type_count = 0;
+}
 
 bool is_integer(Type *ty) {
-  return ty->kind == TY_INT;
+  TypeKind k = ty->kind;
+  return k == TY_CHAR || k == TY_SHORT || k == TY_INT || k == TY_LONG;
 }
 
+// Returns the pointer type to `base`. Each pointer type is created
+// only once, so two pointer types are the same iff they are equal
+// as pointers.
 Type *pointer_to(Type *base) {
-  Type *ty = calloc(1, sizeof(Type));
+  if (base->pointer)
+    return base->pointer;
+
+  type_count++;
+  Type *ty = arena_alloc(sizeof(Type));
   ty->kind = TY_PTR;
+  ty->size = 8;
+  ty->align = 8;
+  ty->base = base;
+  base->pointer = ty;
+  return ty;
+}
+
+// Returns the type that arithmetic on operands of types `a` and `b`
+// is done in. Values narrower than int are promoted to int.
+static Type *common_type(Type *a, Type *b) {
+  if (a->kind == TY_LONG || b->kind == TY_LONG)
+    return long_type;
+  return int_type;
+}
+
+Type *array_of(Type *base, int len) {
+  type_count++;
+  Type *ty = arena_alloc(sizeof(Type));
+  ty->kind = TY_ARRAY;
+  ty->size = base->size * len;
+  ty->align = base->align;
   ty->base = base;
+  ty->array_len = len;
   return ty;
 }
 
+static bool is_lvalue(Node *node) {
+  return node->kind == ND_VAR || node->kind == ND_DEREF;
+}
+
 void add_type(Node *node) {
   if (!node || node->ty)
     return;
 
-  add_type(node->lhs);
-  add_type(node->rhs);
-  add_type(node->cond);
-  add_type(node->then);
-  add_type(node->els);
-  add_type(node->init);
-  add_type(node->inc);
-
-  for (Node *n = node->body; n; n = n->next)
-    add_type(n);
-  for (Node *n = node->args; n; n = n->next)
-    add_type(n);
+  switch (node->kind) {
+  case ND_IF:
+    add_type(node->cond);
+    add_type(node->then);
+    add_type(node->els);
+    return;
+  case ND_WHILE:
+    add_type(node->cond);
+    add_type(node->then);
+    return;
+  case ND_FOR:
+    add_type(node->init);
+    add_type(node->cond);
+    add_type(node->inc);
+    add_type(node->then);
+    return;
+  case ND_BLOCK:
+    for (Node *n = node->body; n; n = n->next)
+      add_type(n);
+    return;
+  case ND_FUNCALL:
+    for (Node *n = node->args; n; n = n->next)
+      add_type(n);
+    break;
+  case ND_VAR:
+  case ND_NUM:
+  case ND_NULL:
+    break;
+  case ND_ADDR:
+  case ND_DEREF:
+  case ND_RETURN:
+  case ND_EXPR_STMT:
+    add_type(node->lhs);
+    break;
+  default:
+    add_type(node->lhs);
+    add_type(node->rhs);
+  }
 
   switch (node->kind) {
   case ND_ADD:
   case ND_SUB:
-  case ND_PTR_DIFF:
   case ND_MUL:
   case ND_DIV:
+    node->ty = common_type(node->lhs->ty, node->rhs->ty);
+    return;
+  case ND_PTR_DIFF:
+    node->ty = long_type;
+    return;
   case ND_EQ:
   case ND_NE:
   case ND_LT:
   case ND_LE:
   case ND_FUNCALL:
-  case ND_NUM:
     node->ty = int_type;
     return;
+  case ND_NUM:
+    node->ty = (node->val == (int)node->val) ? int_type : long_type;
+    return;
   case ND_PTR_ADD:
   case ND_PTR_SUB:
+    // An array operand decays to a pointer to its first element.
+    node->ty = pointer_to(node->lhs->ty->base);
+    return;
   case ND_ASSIGN:
+    if (!is_lvalue(node->lhs) || node->lhs->ty->kind == TY_ARRAY)
+      error_tok(node->lhs->tok, "not an lvalue");
     node->ty = node->lhs->ty;
     return;
   case ND_VAR:
     node->ty = node->var->ty;
     return;
   case ND_ADDR:
+    if (!is_lvalue(node->lhs))
+      error_tok(node->lhs->tok, "not an lvalue");
     node->ty = pointer_to(node->lhs->ty);
     return;
   case ND_DEREF:
-    if (node->lhs->ty->kind != TY_PTR)
+    if (!node->lhs->ty->base)
       error_tok(node->tok, "invalid pointer dereference");
     node->ty = node->lhs->ty->base;
     return;